@@ -0,0 +1,31 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_ALGO_THREAD_INDEX_H
+#define CDSLIB_ALGO_THREAD_INDEX_H
+
+#include <cds/algo/base.h>
+#include <cds/algo/atomic.h>
+
+namespace cds { namespace algo {
+
+    /// Process-wide index of the current thread
+    /**
+        The first call in a thread assigns the next free index 0, 1, 2, ... to the thread.
+        The index is never reused, so the containers take it modulo the count of their
+        per-thread-group objects (buffers, reader slots, home segments and so on).
+
+        Unlike \p cds::threading::Manager the function does not require the thread to be attached.
+    */
+    inline size_t thread_index()
+    {
+        static atomics::atomic<size_t> s_nThreadCount( 0 );
+        static thread_local size_t s_nIndex = s_nThreadCount.fetch_add( 1, atomics::memory_order_relaxed );
+        return s_nIndex;
+    }
+
+}} // namespace cds::algo
+
+#endif // #ifndef CDSLIB_ALGO_THREAD_INDEX_H
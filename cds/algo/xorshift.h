@@ -0,0 +1,38 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_ALGO_XORSHIFT_H
+#define CDSLIB_ALGO_XORSHIFT_H
+
+#include <cds/algo/base.h>
+#include <cds/os/timer.h>
+
+namespace cds { namespace algo {
+
+    /// Fast per-thread pseudo-random number generator
+    /**
+        The function is Marsaglia's xorshift32 with thread-local state, so it needs no synchronization.
+        The state of each thread is seeded on the first call from \p cds::OS::Timer::random_seed()
+        and the address of the state. The quality is enough for choosing random heaps, levels and so on,
+        but not for cryptography or statistics.
+
+        The function never returns 0.
+    */
+    inline uint32_t xorshift32()
+    {
+        static thread_local uint32_t s_nSeed = 0;
+        uint32_t x = s_nSeed;
+        if ( x == 0 )
+            x = ( static_cast<uint32_t>( cds::OS::Timer::random_seed()) ^ static_cast<uint32_t>( reinterpret_cast<uintptr_t>( &s_nSeed ))) | 1;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        s_nSeed = x;
+        return x;
+    }
+
+}} // namespace cds::algo
+
+#endif // #ifndef CDSLIB_ALGO_XORSHIFT_H
@@ -93,6 +93,9 @@
 #define cds_likely( expr )   __builtin_expect( !!( expr ), 1 )
 #define cds_unlikely( expr ) __builtin_expect( !!( expr ), 0 )
 
+// Prefetch the cache line of \p addr for reading
+#define cds_prefetch( addr )  __builtin_prefetch( (addr), 0, 3 )
+
 // Exceptions
 #if defined( __EXCEPTIONS ) && __EXCEPTIONS == 1
 #   define CDS_EXCEPTION_ENABLED
@@ -41,6 +41,10 @@
 #endif
 
 //if constexpr support (C++17)
+#ifndef cds_prefetch
+#   define cds_prefetch( addr ) ((void)( addr ))
+#endif
+
 #ifndef constexpr_if
 #   define constexpr_if if
 #endif
@@ -154,6 +154,12 @@
 #   endif
 #endif
 
+// Prefetch the cache line of \p addr for reading
+#if defined( _M_IX86 ) || defined( _M_X64 )
+#   include <xmmintrin.h>
+#   define cds_prefetch( addr )  _mm_prefetch( reinterpret_cast<char const*>( addr ), _MM_HINT_T0 )
+#endif
+
 // Sanitizer attributes (not supported)
 #define CDS_SUPPRESS_SANITIZE( ... )
 
@@ -0,0 +1,1954 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_CTRIE_MAP_RCU_H
+#define CDSLIB_CONTAINER_CTRIE_MAP_RCU_H
+
+#include <functional>   // ref
+#include <iterator>
+#include <tuple>
+#include <cds/container/details/ctrie_base.h>
+#include <cds/urcu/details/check_deadlock.h>
+#include <cds/algo/split_bitstring.h>
+#include <cds/algo/bitop.h>
+#include <cds/details/allocator.h>
+
+namespace cds { namespace container {
+
+    /// Concurrent hash trie map with O(1) snapshots (Ctrie), \ref cds_urcu_desc "RCU" specialization
+    /** @ingroup cds_nonintrusive_map
+        @anchor cds_container_CtrieMap_rcu
+
+        Source:
+            - [2012] Aleksandar Prokopec, Nathan Bronson, Phil Bagwell, Martin Odersky
+                "Concurrent Tries with Efficient Non-Blocking Snapshots"
+
+        \p %CtrieMap is a lock-free hash array mapped trie. Each level of the trie consumes 5 bits
+        of the hash value (\p cds::algo::split_bitstring is used to split the hash), the inner nodes are
+        32-way bitmap-indexed arrays. The keys with equal hash values are stored in a list node at the bottom of the trie.
+
+        Any update creates the copy of the inner node and installs it by generation-compare-and-swap (GCAS):
+        the new node is committed only if the generation of the root has not been changed. \p snapshot()
+        replaces the root with the copy having new generation by RDCSS (restricted double-compare single-swap),
+        so the snapshot costs O(1) regardless of the map size. The inner nodes are shared between the map and
+        its snapshots and copied lazily on the first update of each generation; a read-only snapshot
+        is never copied and is immutable, so it can be iterated consistently without blocking the writers.
+
+        Since a node may be shared by several snapshots, the nodes are reference-counted; the node
+        whose reference count drops to zero is retired by RCU. \p %CtrieMap supports RCU only,
+        the lookup and the traversal of the inner nodes are protected by RCU lock.
+
+        Template arguments:
+        - \p RCU - one of \ref cds_urcu_gc "RCU type"
+        - \p Key - key type
+        - \p T - mapped type
+        - \p Traits - map traits, default is \p ctrie::traits.
+            Instead of defining \p Traits struct directly you may use option-based \p ctrie::make_traits metafunction.
+
+        The map's value type is <tt>std::pair< Key const, T ></tt>. Since the items are shared with
+        the snapshots, the items are immutable: \p update() changes a copy of the item.
+
+        @note Before including <tt><cds/container/ctrie_map_rcu.h></tt> you should include appropriate RCU header file,
+        see \ref cds_urcu_gc "RCU type" for list of existing RCU class and corresponding header files.
+    */
+    template <
+        class RCU,
+        typename Key,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = ctrie::traits
+#else
+        class Traits
+#endif
+    >
+    class CtrieMap< cds::urcu::gc< RCU >, Key, T, Traits >
+    {
+    public:
+        typedef cds::urcu::gc< RCU > gc;    ///< RCU Garbage collector
+        typedef Key     key_type;           ///< type of a key stored in the map
+        typedef T       mapped_type;        ///< type of value stored in the map
+        typedef std::pair< key_type const, mapped_type > value_type; ///< Key-value pair stored in the map
+        typedef Traits  traits;             ///< Map traits
+
+        /// Hash functor, \p std::hash<Key> if \p traits::hash is not specified
+        typedef typename cds::opt::v::hash_selector< typename traits::hash >::type hash;
+
+        /// Key equality functor built from \p traits::equal_to, \p traits::compare or \p traits::less
+        typedef typename cds::opt::details::make_equal_to< key_type, traits >::type key_equal_to;
+
+        typedef typename traits::allocator      allocator;      ///< Node allocator
+        typedef typename traits::memory_model   memory_model;   ///< Memory model
+        typedef typename traits::stat           stat;           ///< Internal statistics
+        typedef typename traits::rcu_check_deadlock rcu_check_deadlock; ///< RCU deadlock checking policy
+
+        typedef size_t      hash_type;          ///< Hash value type
+        typedef uint64_t    generation_type;    ///< Generation of the trie nodes
+
+        typedef typename gc::scoped_lock    rcu_lock;  ///< RCU scoped lock
+
+        static constexpr unsigned const c_nLevelBits = 5;   ///< Count of hash bits consumed by each level of the trie
+        static constexpr unsigned const c_nHashBits = static_cast<unsigned>( sizeof( hash_type ) * 8 ); ///< Hash value size in bits
+
+    protected:
+        //@cond
+        typedef cds::urcu::details::check_deadlock_policy< gc, rcu_check_deadlock > check_deadlock_policy;
+        typedef cds::algo::split_bitstring< hash_type, 0, unsigned > hash_splitter;
+
+        // Max count of the nodes from the root to an item: the inner nodes of all levels and the list node
+        static constexpr unsigned const c_nMaxDepth = ( c_nHashBits + c_nLevelBits - 1 ) / c_nLevelBits + 1;
+
+        enum node_kind: unsigned char {
+            kind_inode,     // indirection node
+            kind_cnode,     // inner node: bitmap-indexed array of branches
+            kind_tnode,     // tomb node: the single item of the removed inner node waiting for compression
+            kind_lnode,     // list of items with the same hash value
+            kind_snode,     // item node
+            kind_failed,    // failed GCAS mark
+            kind_dead,      // main node of the released indirection node
+            kind_rdcss      // RDCSS descriptor of the root
+        };
+
+        struct node_base
+        {
+            atomics::atomic<size_t> m_nRefCount;
+            node_base *             m_pNextRetired; // next in the list of the nodes retired or being released
+            node_kind const         m_nKind;
+
+            explicit node_base( node_kind kind )
+                : m_nRefCount( 1 )
+                , m_pNextRetired( nullptr )
+                , m_nKind( kind )
+            {}
+        };
+
+        struct snode: public node_base
+        {
+            hash_type   m_nHash;
+            value_type  m_Value;
+
+            template <typename K, typename... Args>
+            explicit snode( K&& key, Args&&... args )
+                : node_base( kind_snode )
+                , m_nHash( 0 )
+                , m_Value( std::piecewise_construct, std::forward_as_tuple( std::forward<K>( key )), std::forward_as_tuple( std::forward<Args>( args )... ))
+            {}
+        };
+
+        struct main_node: public node_base
+        {
+            // Previous main node of the indirection node while the GCAS is not committed,
+            // failed_node if the GCAS is failed, nullptr if committed
+            atomics::atomic<main_node *> m_pPrev;
+
+            explicit main_node( node_kind kind )
+                : node_base( kind )
+                , m_pPrev( nullptr )
+            {}
+        };
+
+        struct cnode: public main_node
+        {
+            generation_type const   m_nGen;
+            uint32_t const          m_nBitmap;
+            node_base *             m_arrBranch[1]; // inode or snode, the real size is the count of bits in m_nBitmap
+
+            cnode( generation_type nGen, uint32_t nBitmap )
+                : main_node( kind_cnode )
+                , m_nGen( nGen )
+                , m_nBitmap( nBitmap )
+            {}
+
+            size_t size() const
+            {
+                return static_cast<size_t>( cds::bitop::SBC( m_nBitmap ));
+            }
+        };
+
+        struct tnode: public main_node
+        {
+            snode * const m_pSNode;
+
+            explicit tnode( snode * pNode )
+                : main_node( kind_tnode )
+                , m_pSNode( pNode )
+            {}
+        };
+
+        struct lnode: public main_node
+        {
+            size_t const    m_nSize;
+            snode *         m_arrItems[1];  // the real size is m_nSize
+
+            explicit lnode( size_t nSize )
+                : main_node( kind_lnode )
+                , m_nSize( nSize )
+            {}
+        };
+
+        struct failed_node: public main_node
+        {
+            main_node * const m_pOld;   // main node to be restored
+
+            explicit failed_node( main_node * pOld )
+                : main_node( kind_failed )
+                , m_pOld( pOld )
+            {}
+        };
+
+        struct inode: public node_base
+        {
+            atomics::atomic<main_node *> m_pMain;
+            generation_type const        m_nGen;
+
+            inode( main_node * pMain, generation_type nGen )
+                : node_base( kind_inode )
+                , m_pMain( pMain )
+                , m_nGen( nGen )
+            {}
+        };
+
+        enum rdcss_state {
+            rdcss_undecided,
+            rdcss_committed,
+            rdcss_aborted
+        };
+
+        struct rdcss_descriptor: public node_base
+        {
+            inode * const       m_pOld;
+            main_node * const   m_pExpected;
+            inode * const       m_pNew;
+            atomics::atomic<int> m_nState;
+
+            rdcss_descriptor( inode * pOld, main_node * pExpected, inode * pNew )
+                : node_base( kind_rdcss )
+                , m_pOld( pOld )
+                , m_pExpected( pExpected )
+                , m_pNew( pNew )
+                , m_nState( rdcss_undecided )
+            {}
+        };
+
+        typedef cds::details::Allocator< snode, allocator >             cxx_snode_allocator;
+        typedef cds::details::Allocator< cnode, allocator >             cxx_cnode_allocator;
+        typedef cds::details::Allocator< tnode, allocator >             cxx_tnode_allocator;
+        typedef cds::details::Allocator< lnode, allocator >             cxx_lnode_allocator;
+        typedef cds::details::Allocator< failed_node, allocator >       cxx_failed_node_allocator;
+        typedef cds::details::Allocator< inode, allocator >             cxx_inode_allocator;
+        typedef cds::details::Allocator< rdcss_descriptor, allocator >  cxx_rdcss_allocator;
+
+        enum update_result {
+            result_restart,     // the operation should be restarted from the root
+            result_not_found,   // the key is not found, nothing is changed
+            result_found,       // the key is found, nothing is changed
+            result_inserted,    // new item is inserted
+            result_updated,     // existing item is replaced
+            result_erased       // the item is removed
+        };
+
+        // Releases the references and retires the nodes whose reference counter has dropped to zero
+        class rcu_disposer
+        {
+        public:
+            rcu_disposer()
+                : m_pRetired( nullptr )
+            {}
+
+            ~rcu_disposer()
+            {
+                assert( !gc::is_locked());
+                gc::batch_retire( [this]() -> cds::urcu::retired_ptr {
+                    node_base * p = m_pRetired;
+                    if ( !p )
+                        return cds::urcu::retired_ptr();
+                    m_pRetired = p->m_pNextRetired;
+                    return cds::urcu::retired_ptr( static_cast<void *>( p ), free_node );
+                });
+            }
+
+            // Releases the reference to p. The referenced nodes of the dead nodes are released iteratively
+            void release( node_base * p )
+            {
+                if ( !unref( p ))
+                    return;
+
+                p->m_pNextRetired = nullptr;
+                node_base * pDead = p;
+                while ( pDead ) {
+                    node_base * pNode = pDead;
+                    pDead = pNode->m_pNextRetired;
+
+                    release_children( pNode, [&pDead]( node_base * pChild ) {
+                        if ( unref( pChild )) {
+                            pChild->m_pNextRetired = pDead;
+                            pDead = pChild;
+                        }
+                    });
+                    retire( pNode );
+                }
+            }
+
+            // Retires the node that is not reference-counted (RDCSS descriptor, failed GCAS mark)
+            void retire( node_base * p )
+            {
+                p->m_pNextRetired = m_pRetired;
+                m_pRetired = p;
+            }
+
+        private:
+            static bool unref( node_base * p )
+            {
+                return p->m_nRefCount.fetch_sub( 1, memory_model::memory_order_acq_rel ) == 1;
+            }
+
+            template <typename Func>
+            void release_children( node_base * pNode, Func f )
+            {
+                switch ( pNode->m_nKind ) {
+                case kind_inode:
+                    release_inode_main( static_cast<inode *>( pNode ), f );
+                    break;
+                case kind_cnode:
+                    {
+                        cnode * cn = static_cast<cnode *>( pNode );
+                        for ( size_t i = 0, nSize = cn->size(); i < nSize; ++i )
+                            f( cn->m_arrBranch[i] );
+                    }
+                    break;
+                case kind_tnode:
+                    f( static_cast<tnode *>( pNode )->m_pSNode );
+                    break;
+                case kind_lnode:
+                    {
+                        lnode * ln = static_cast<lnode *>( pNode );
+                        for ( size_t i = 0; i < ln->m_nSize; ++i )
+                            f( ln->m_arrItems[i] );
+                    }
+                    break;
+                default:
+                    break;
+                }
+
+                if ( pNode->m_nKind != kind_inode && pNode->m_nKind != kind_snode ) {
+                    // The failed GCAS mark is owned by the main node
+                    main_node * pPrev = static_cast<main_node *>( pNode )->m_pPrev.load( memory_model::memory_order_acquire );
+                    if ( pPrev && pPrev->m_nKind == kind_failed )
+                        retire( pPrev );
+                }
+            }
+
+            // The dead inode can still be reached by the concurrent operations that have read the stale branch,
+            // they find the dead main node and restart. The pending GCAS of the dead inode is failed
+            template <typename Func>
+            void release_inode_main( inode * in, Func& f )
+            {
+                main_node * m = in->m_pMain.exchange( dead_node(), memory_model::memory_order_acq_rel );
+                main_node * pPrev = m->m_pPrev.load( memory_model::memory_order_acquire );
+                while ( true ) {
+                    if ( !pPrev ) {
+                        // m is committed
+                        f( m );
+                        return;
+                    }
+                    if ( pPrev->m_nKind == kind_failed ) {
+                        // m has been failed but it has not been rolled back yet
+                        f( m );
+                        f( static_cast<failed_node *>( pPrev )->m_pOld );
+                        return;
+                    }
+
+                    failed_node * fn = cxx_failed_node_allocator().New( pPrev );
+                    if ( m->m_pPrev.compare_exchange_strong( pPrev, fn, memory_model::memory_order_acq_rel, atomics::memory_order_acquire )) {
+                        f( m );
+                        f( fn->m_pOld );
+                        return;
+                    }
+                    cxx_failed_node_allocator().Delete( fn );
+                }
+            }
+
+        private:
+            node_base * m_pRetired;
+        };
+        //@endcond
+
+    public:
+        /// Forward iterator over a read-only snapshot of the map
+        /**
+            The iterator holds the read-only snapshot taken by \p begin(), so it visits exactly the items
+            that were in the map at the moment of \p begin() call and never blocks the writers.
+            The items cannot be changed via the iterator.
+
+            The iterator locks RCU only while it descends to an inner node, so it can be kept for a long time.
+            However, it must not be incremented or destroyed inside RCU critical section.
+        */
+        class const_iterator
+        {
+        public:
+            typedef std::forward_iterator_tag   iterator_category;
+            typedef typename CtrieMap::value_type const value_type;
+            typedef std::ptrdiff_t              difference_type;
+            typedef value_type *                pointer;
+            typedef value_type &                reference;
+
+        private:
+            //@cond
+            friend class CtrieMap;
+
+            struct frame {
+                main_node * pNode;
+                size_t      nIdx;
+            };
+            //@endcond
+
+        public:
+            /// Default ctor, the result is equal to \p end()
+            const_iterator()
+                : m_pRoot( nullptr )
+                , m_nDepth( 0 )
+                , m_pCur( nullptr )
+            {}
+
+            /// Copy ctor
+            const_iterator( const_iterator const& src )
+                : m_pRoot( src.m_pRoot )
+                , m_nDepth( src.m_nDepth )
+                , m_pCur( src.m_pCur )
+            {
+                if ( m_pRoot )
+                    m_pRoot->m_nRefCount.fetch_add( 1, memory_model::memory_order_relaxed );
+                std::copy( src.m_Stack, src.m_Stack + m_nDepth, m_Stack );
+            }
+
+            /// Dtor releases the snapshot
+            ~const_iterator()
+            {
+                free_root();
+            }
+
+            /// Assignment operator
+            const_iterator& operator=( const_iterator const& src )
+            {
+                if ( this != &src ) {
+                    if ( src.m_pRoot )
+                        src.m_pRoot->m_nRefCount.fetch_add( 1, memory_model::memory_order_relaxed );
+                    free_root();
+                    m_pRoot = src.m_pRoot;
+                    m_nDepth = src.m_nDepth;
+                    m_pCur = src.m_pCur;
+                    std::copy( src.m_Stack, src.m_Stack + m_nDepth, m_Stack );
+                }
+                return *this;
+            }
+
+            /// Returns pointer to the item, \p nullptr for \p end()
+            pointer operator->() const
+            {
+                return m_pCur ? &m_pCur->m_Value : nullptr;
+            }
+
+            /// Returns reference to the item
+            reference operator*() const
+            {
+                assert( m_pCur );
+                return m_pCur->m_Value;
+            }
+
+            /// Pre-increment
+            const_iterator& operator++()
+            {
+                next();
+                return *this;
+            }
+
+            /// Iterator comparison
+            bool operator==( const_iterator const& rhs ) const
+            {
+                return m_pCur == rhs.m_pCur;
+            }
+
+            /// Iterator comparison
+            bool operator!=( const_iterator const& rhs ) const
+            {
+                return !( *this == rhs );
+            }
+
+        private:
+            //@cond
+            // pRoot is the root of a read-only snapshot, the iterator holds a reference to it
+            explicit const_iterator( inode * pRoot )
+                : m_pRoot( pRoot )
+                , m_nDepth( 0 )
+                , m_pCur( nullptr )
+            {
+                push( pRoot );
+                next();
+            }
+
+            void push( inode * in )
+            {
+                main_node * m;
+                {
+                    rcu_lock l;
+                    m = gcas_read_ro( in );
+                }
+                // The subtree of a read-only snapshot is immutable and is held by the root
+                assert( m->m_nKind != kind_dead );
+                assert( m_nDepth < c_nMaxDepth );
+                m_Stack[m_nDepth].pNode = m;
+                m_Stack[m_nDepth].nIdx = 0;
+                ++m_nDepth;
+            }
+
+            void next()
+            {
+                while ( m_nDepth > 0 ) {
+                    frame& f = m_Stack[m_nDepth - 1];
+                    switch ( f.pNode->m_nKind ) {
+                    case kind_cnode:
+                        {
+                            cnode * cn = static_cast<cnode *>( f.pNode );
+                            if ( f.nIdx < cn->size()) {
+                                node_base * pBranch = cn->m_arrBranch[f.nIdx++];
+                                if ( pBranch->m_nKind == kind_snode ) {
+                                    m_pCur = static_cast<snode *>( pBranch );
+                                    return;
+                                }
+                                push( static_cast<inode *>( pBranch ));
+                                continue;
+                            }
+                        }
+                        break;
+                    case kind_tnode:
+                        if ( f.nIdx++ == 0 ) {
+                            m_pCur = static_cast<tnode *>( f.pNode )->m_pSNode;
+                            return;
+                        }
+                        break;
+                    case kind_lnode:
+                        {
+                            lnode * ln = static_cast<lnode *>( f.pNode );
+                            if ( f.nIdx < ln->m_nSize ) {
+                                m_pCur = ln->m_arrItems[f.nIdx++];
+                                return;
+                            }
+                        }
+                        break;
+                    default:
+                        assert( false );
+                        break;
+                    }
+                    --m_nDepth;
+                }
+
+                // end of the snapshot
+                m_pCur = nullptr;
+                free_root();
+            }
+
+            void free_root()
+            {
+                if ( m_pRoot ) {
+                    rcu_disposer disp;
+                    disp.release( m_pRoot );
+                    m_pRoot = nullptr;
+                }
+            }
+            //@endcond
+
+        private:
+            //@cond
+            inode *     m_pRoot;
+            frame       m_Stack[c_nMaxDepth];
+            unsigned    m_nDepth;
+            snode *     m_pCur;
+            //@endcond
+        };
+
+        /// Iterator type; the items of the map are immutable, so it is the same as \p const_iterator
+        typedef const_iterator iterator;
+
+    public:
+        /// Creates empty map
+        CtrieMap()
+            : m_pRoot( alloc_root())
+            , m_bReadOnly( false )
+        {}
+
+        /// Move ctor. \p src becomes empty
+        CtrieMap( CtrieMap&& src )
+            : m_pRoot( src.m_pRoot.load( memory_model::memory_order_acquire ))
+            , m_bReadOnly( src.m_bReadOnly )
+        {
+            src.m_pRoot.store( alloc_root(), memory_model::memory_order_release );
+        }
+
+        /// Destroys the map. The nodes shared with the snapshots are alive while the snapshots are alive
+        ~CtrieMap()
+        {
+            check_deadlock_policy::check();
+
+            rcu_disposer disp;
+            node_base * pRoot = m_pRoot.load( memory_model::memory_order_acquire );
+            assert( pRoot->m_nKind == kind_inode );
+            disp.release( pRoot );
+        }
+
+        /// Returns \p true if the map is a read-only snapshot
+        bool is_read_only() const
+        {
+            return m_bReadOnly;
+        }
+
+        /// Inserts new node with key and default value
+        /**
+            The function creates a node with \p key and default value, and then inserts the node created into the map.
+
+            Preconditions:
+            - The \p key_type should be constructible from value of type \p K.
+            - The \p mapped_type should be default-constructible.
+
+            Returns \p true if inserting successful, \p false otherwise.
+            The function always returns \p false for a read-only snapshot.
+
+            RCU \p synchronize() method can be called. RCU should not be locked.
+        */
+        template <typename K>
+        bool insert( K const& key )
+        {
+            return insert_with( key, []( value_type& ) {} );
+        }
+
+        /// Inserts new node with the key and the value
+        /**
+            The function creates a node with copy of \p val value
+            and then inserts the node created into the map.
+
+            Preconditions:
+            - The \p key_type should be constructible from \p key of type \p K.
+            - The \p mapped_type should be constructible from \p val of type \p V.
+
+            Returns \p true if \p val is inserted into the map, \p false otherwise.
+
+            RCU \p synchronize() method can be called. RCU should not be locked.
+        */
+        template <typename K, typename V>
+        bool insert( K&& key, V&& val )
+        {
+            return emplace( std::forward<K>( key ), std::forward<V>( val ));
+        }
+
+        /// Inserts new node and initialize it by a functor
+        /**
+            This function inserts new node with key \p key and if inserting is successful then it calls
+            \p func functor with signature
+            \code
+                struct functor {
+                    void operator()( value_type& item );
+                };
+            \endcode
+
+            The argument \p item of user-defined functor \p func is the reference
+            to the map's item inserted. The functor is called once under RCU lock before the item
+            is published in the map, so no synchronization is needed.
+
+            RCU \p synchronize() method can be called. RCU should not be locked.
+        */
+        template <typename K, typename Func>
+        bool insert_with( K const& key, Func func )
+        {
+            if ( is_read_only()) {
+                m_Stat.onReadOnlyModify();
+                return false;
+            }
+
+            hash_type const nHash = hash_value( key );
+            insert_with_op<K, Func> op( key, nHash, func );
+            update_result res = do_update( key, nHash, op );
+            if ( res == result_inserted ) {
+                m_Stat.onInsertSuccess();
+                return true;
+            }
+            m_Stat.onInsertFailed();
+            return false;
+        }
+
+        /// For key \p key inserts data of type \p mapped_type created in-place from \p args
+        /**
+            Returns \p true if inserting successful, \p false otherwise.
+
+            RCU \p synchronize() method can be called. RCU should not be locked.
+        */
+        template <typename K, typename... Args>
+        bool emplace( K&& key, Args&&... args )
+        {
+            if ( is_read_only()) {
+                m_Stat.onReadOnlyModify();
+                return false;
+            }
+
+            hash_type const nHash = hash_value( key );
+            snode * pNode = alloc_snode( nHash, std::forward<K>( key ), std::forward<Args>( args )... );
+
+            insert_op op( pNode );
+            update_result res = do_update( pNode->m_Value.first, nHash, op );
+            if ( res == result_inserted ) {
+                m_Stat.onInsertSuccess();
+                return true;
+            }
+            m_Stat.onInsertFailed();
+            return false;
+        }
+
+        /// Updates data by \p key
+        /**
+            The operation performs inserting or replacing the element with lock-free manner.
+
+            If the \p key not found in the map, then the new item created from \p key
+            will be inserted into the map iff \p bInsert is \p true
+            (note that in this case the \ref key_type should be constructible from type \p K).
+            Otherwise, if \p key is found, the item is replaced by its copy changed by the functor \p func.
+
+            The functor \p Func signature is:
+            \code
+                struct my_functor {
+                    void operator()( bool bNew, value_type& item );
+                };
+            \endcode
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - the item to be published
+
+            The functor is called under RCU lock before the item is published, the item may be changed freely.
+            Since the map may be changed concurrently, the functor may be called several times
+            for the different copies of the item.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is \p true if operation is successful,
+            \p second is \p true if new item has been added or \p false if the item with \p key
+            already exists.
+
+            RCU \p synchronize() method can be called. RCU should not be locked.
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> update( K const& key, Func func, bool bInsert = true )
+        {
+            if ( is_read_only()) {
+                m_Stat.onReadOnlyModify();
+                return std::make_pair( false, false );
+            }
+
+            hash_type const nHash = hash_value( key );
+            update_op<K, Func> op( key, nHash, func, bInsert );
+            update_result res = do_update( key, nHash, op );
+            switch ( res ) {
+            case result_inserted:
+                m_Stat.onUpdateNew();
+                return std::make_pair( true, true );
+            case result_updated:
+                m_Stat.onUpdateExisting();
+                return std::make_pair( true, false );
+            default:
+                m_Stat.onUpdateFailed();
+                return std::make_pair( false, false );
+            }
+        }
+
+        /// Deletes \p key from the map
+        /**
+            Returns \p true if \p key is found and deleted, \p false otherwise.
+            The function always returns \p false for a read-only snapshot.
+
+            RCU \p synchronize() method can be called. RCU should not be locked.
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            return erase( key, []( value_type const& ) {} );
+        }
+
+        /// Deletes the item from the map
+        /**
+            The function searches an item with key \p key, calls \p f functor
+            and deletes the item. If \p key is not found, the functor is not called.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()( value_type const& item ) { ... }
+            };
+            \endcode
+
+            The functor is called under RCU lock after the item has been removed from the map.
+
+            Returns \p true if key is found and deleted, \p false otherwise.
+
+            RCU \p synchronize() method can be called. RCU should not be locked.
+        */
+        template <typename K, typename Func>
+        bool erase( K const& key, Func f )
+        {
+            if ( is_read_only()) {
+                m_Stat.onReadOnlyModify();
+                return false;
+            }
+
+            check_deadlock_policy::check();
+
+            hash_type const nHash = hash_value( key );
+            rcu_disposer disp;
+            while ( true ) {
+                update_result res;
+                {
+                    rcu_lock l;
+                    inode * pRoot = read_root( false, disp );
+                    res = rec_remove( pRoot, key, nHash, f, 0, nullptr, pRoot->m_nGen, disp );
+                }
+                if ( res == result_erased ) {
+                    m_Stat.onEraseSuccess();
+                    return true;
+                }
+                if ( res != result_restart ) {
+                    m_Stat.onEraseFailed();
+                    return false;
+                }
+                m_Stat.onRestart();
+            }
+        }
+
+        /// Finds the key \p key
+        /**
+            The function searches the item with key equal to \p key and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type const& item );
+            };
+            \endcode
+
+            The functor is called under RCU lock. The item is immutable.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+
+            The function applies RCU lock internally.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f )
+        {
+            check_deadlock_policy::check();
+
+            hash_type const nHash = hash_value( key );
+            rcu_disposer disp;
+            while ( true ) {
+                update_result res;
+                {
+                    rcu_lock l;
+                    res = lookup( key, nHash, f, disp );
+                }
+                if ( res == result_found ) {
+                    m_Stat.onFindSuccess();
+                    return true;
+                }
+                if ( res == result_not_found ) {
+                    m_Stat.onFindFailed();
+                    return false;
+                }
+                m_Stat.onRestart();
+            }
+        }
+
+        /// Checks whether the map contains \p key
+        /**
+            The function applies RCU lock internally.
+        */
+        template <typename K>
+        bool contains( K const& key )
+        {
+            return find( key, []( value_type const& ) {} );
+        }
+
+        /// Returns writable snapshot of the map
+        /**
+            The function costs O(1): the snapshot shares all nodes with the map,
+            the nodes are copied lazily when they are changed in the map or in the snapshot.
+            The snapshot and the map are independent, the changes of one are not visible in other.
+
+            The snapshot of a read-only map is a writable copy of the read-only map.
+
+            RCU \p synchronize() method can be called. RCU should not be locked.
+        */
+        CtrieMap snapshot()
+        {
+            check_deadlock_policy::check();
+
+            if ( is_read_only()) {
+                rcu_disposer disp;
+                rcu_lock l;
+                inode * pRoot = read_root( false, disp );
+                main_node * pMain = gcas_read( pRoot, disp );
+                bool bAcquired = try_acquire( pMain );
+                assert( bAcquired );
+                CDS_UNUSED( bAcquired );
+                m_Stat.onSnapshot();
+                return CtrieMap( alloc_inode( pMain, next_generation()), false );
+            }
+
+            rcu_disposer disp;
+            while ( true ) {
+                {
+                    rcu_lock l;
+                    inode * pRoot = read_root( false, disp );
+                    main_node * pMain = gcas_read( pRoot, disp );
+                    if ( pMain->m_nKind != kind_dead && try_acquire( pMain )) {
+                        if ( try_acquire( pMain )) {
+                            inode * pSnapshot = alloc_inode( pMain, next_generation());
+                            if ( rdcss_root( pRoot, pMain, alloc_inode( pMain, next_generation()), disp )) {
+                                m_Stat.onSnapshot();
+                                return CtrieMap( pSnapshot, false );
+                            }
+                            disp.release( pSnapshot );
+                        }
+                        else
+                            disp.release( pMain );
+                    }
+                }
+                m_Stat.onSnapshotRetry();
+            }
+        }
+
+        /// Returns read-only snapshot of the map
+        /**
+            The function costs O(1). The read-only snapshot shares the current root with the map
+            and is never changed, so it can be consistently iterated and searched while the map is modified.
+            All modifying functions of the read-only snapshot return \p false.
+
+            RCU \p synchronize() method can be called. RCU should not be locked.
+        */
+        CtrieMap read_only_snapshot()
+        {
+            check_deadlock_policy::check();
+            return CtrieMap( read_only_root(), true );
+        }
+
+        /// Clears the map
+        /**
+            The function replaces the root of the map with a new empty one in O(1).
+            The items are freed when they are not referenced by any snapshot.
+            The function does nothing for a read-only snapshot.
+
+            RCU \p synchronize() method can be called. RCU should not be locked.
+        */
+        void clear()
+        {
+            if ( is_read_only()) {
+                m_Stat.onReadOnlyModify();
+                return;
+            }
+
+            check_deadlock_policy::check();
+
+            rcu_disposer disp;
+            while ( true ) {
+                {
+                    rcu_lock l;
+                    inode * pRoot = read_root( false, disp );
+                    main_node * pMain = gcas_read( pRoot, disp );
+                    if ( pMain->m_nKind != kind_dead && rdcss_root( pRoot, pMain, alloc_root(), disp ))
+                        break;
+                }
+                m_Stat.onRestart();
+            }
+            m_Stat.onClear();
+        }
+
+        /// Checks if the map is empty
+        /**
+            The function applies RCU lock internally.
+        */
+        bool empty()
+        {
+            check_deadlock_policy::check();
+
+            rcu_disposer disp;
+            rcu_lock l;
+            return !has_items( read_root( false, disp ), disp );
+        }
+
+        /// Returns item count in the map
+        /**
+            The function takes the read-only snapshot and counts its items, so it is O(N).
+
+            RCU \p synchronize() method can be called. RCU should not be locked.
+        */
+        size_t size()
+        {
+            size_t nCount = 0;
+            for ( const_iterator it = cbegin(), itEnd = cend(); it != itEnd; ++it )
+                ++nCount;
+            return nCount;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    public:
+        ///@name Forward iterators
+        //@{
+
+        /// Returns an iterator over the read-only snapshot of the map taken by the call
+        /**
+            RCU \p synchronize() method can be called. RCU should not be locked.
+        */
+        const_iterator begin()
+        {
+            return cbegin();
+        }
+
+        /// Returns an iterator to the end of the map
+        const_iterator end()
+        {
+            return cend();
+        }
+
+        /// Returns an iterator over the read-only snapshot of the map taken by the call
+        const_iterator cbegin()
+        {
+            check_deadlock_policy::check();
+            return const_iterator( read_only_root());
+        }
+
+        /// Returns an iterator to the end of the map
+        const_iterator cend()
+        {
+            return const_iterator();
+        }
+        //@}
+
+    protected:
+        //@cond
+        CtrieMap( inode * pRoot, bool bReadOnly )
+            : m_pRoot( pRoot )
+            , m_bReadOnly( bReadOnly )
+        {}
+
+        template <typename K>
+        static hash_type hash_value( K const& key )
+        {
+            return hash()( key );
+        }
+
+        template <typename K>
+        static bool key_equal( snode const * pNode, K const& key, hash_type nHash )
+        {
+            return pNode->m_nHash == nHash && key_equal_to()( pNode->m_Value.first, key );
+        }
+
+        static unsigned level_index( hash_type nHash, unsigned nLevel )
+        {
+            hash_splitter splitter( nHash, nLevel );
+            return splitter.safe_cut( c_nLevelBits );
+        }
+
+        static size_t branch_pos( uint32_t nBitmap, uint32_t nFlag )
+        {
+            return static_cast<size_t>( cds::bitop::SBC( nBitmap & ( nFlag - 1 )));
+        }
+
+        static generation_type next_generation()
+        {
+            static atomics::atomic<generation_type> s_nGeneration( 0 );
+            return s_nGeneration.fetch_add( 1, atomics::memory_order_relaxed ) + 1;
+        }
+
+        static main_node * dead_node()
+        {
+            static main_node s_Dead( kind_dead );
+            return &s_Dead;
+        }
+
+        static bool try_acquire( node_base * p )
+        {
+            size_t nRef = p->m_nRefCount.load( memory_model::memory_order_relaxed );
+            while ( nRef != 0 ) {
+                if ( p->m_nRefCount.compare_exchange_weak( nRef, nRef + 1, memory_model::memory_order_acquire, atomics::memory_order_relaxed ))
+                    return true;
+            }
+            return false;
+        }
+
+        static void acquire( node_base * p )
+        {
+            p->m_nRefCount.fetch_add( 1, memory_model::memory_order_relaxed );
+        }
+
+        template <typename K, typename... Args>
+        static snode * alloc_snode( hash_type nHash, K&& key, Args&&... args )
+        {
+            snode * pNode = cxx_snode_allocator().MoveNew( std::forward<K>( key ), std::forward<Args>( args )... );
+            pNode->m_nHash = nHash;
+            return pNode;
+        }
+
+        static cnode * alloc_cnode( generation_type nGen, uint32_t nBitmap, size_t nSize )
+        {
+            return cxx_cnode_allocator().NewBlock( sizeof( cnode ) + sizeof( node_base * ) * ( nSize ? nSize - 1 : 0 ), nGen, nBitmap );
+        }
+
+        static lnode * alloc_lnode( size_t nSize )
+        {
+            return cxx_lnode_allocator().NewBlock( sizeof( lnode ) + sizeof( snode * ) * ( nSize - 1 ), nSize );
+        }
+
+        static inode * alloc_inode( main_node * pMain, generation_type nGen )
+        {
+            return cxx_inode_allocator().New( pMain, nGen );
+        }
+
+        static inode * alloc_root()
+        {
+            generation_type const nGen = next_generation();
+            return alloc_inode( alloc_cnode( nGen, 0, 0 ), nGen );
+        }
+
+        // Frees the node that has never been published, its referenced nodes are not released
+        static void free_shell( main_node * p )
+        {
+            if ( p->m_nKind == kind_cnode )
+                cxx_cnode_allocator().Delete( static_cast<cnode *>( p ));
+            else if ( p->m_nKind == kind_lnode )
+                cxx_lnode_allocator().Delete( static_cast<lnode *>( p ));
+            else {
+                assert( p->m_nKind == kind_tnode );
+                cxx_tnode_allocator().Delete( static_cast<tnode *>( p ));
+            }
+        }
+
+        static void free_node( void * pNode )
+        {
+            node_base * p = static_cast<node_base *>( pNode );
+            switch ( p->m_nKind ) {
+            case kind_inode:
+                cxx_inode_allocator().Delete( static_cast<inode *>( p ));
+                break;
+            case kind_snode:
+                cxx_snode_allocator().Delete( static_cast<snode *>( p ));
+                break;
+            case kind_failed:
+                cxx_failed_node_allocator().Delete( static_cast<failed_node *>( p ));
+                break;
+            case kind_rdcss:
+                cxx_rdcss_allocator().Delete( static_cast<rdcss_descriptor *>( p ));
+                break;
+            default:
+                free_shell( static_cast<main_node *>( p ));
+                break;
+            }
+        }
+
+        // Reads the committed main node of the inode of a read-only snapshot: the pending GCAS is always failed,
+        // the rollback is left to the writers. RCU should be locked
+        static main_node * gcas_read_ro( inode * in )
+        {
+            assert( gc::is_locked());
+
+            main_node * m = in->m_pMain.load( memory_model::memory_order_acquire );
+            main_node * pPrev = m->m_pPrev.load( memory_model::memory_order_acquire );
+            while ( pPrev ) {
+                if ( pPrev->m_nKind == kind_failed )
+                    return static_cast<failed_node *>( pPrev )->m_pOld;
+
+                failed_node * fn = cxx_failed_node_allocator().New( pPrev );
+                if ( m->m_pPrev.compare_exchange_strong( pPrev, fn, memory_model::memory_order_acq_rel, atomics::memory_order_acquire ))
+                    return fn->m_pOld;
+                cxx_failed_node_allocator().Delete( fn );
+            }
+            return m;
+        }
+
+        main_node * gcas_read( inode * in, rcu_disposer& disp )
+        {
+            if ( is_read_only())
+                return gcas_read_ro( in );
+
+            main_node * m = in->m_pMain.load( memory_model::memory_order_acquire );
+            if ( m->m_pPrev.load( memory_model::memory_order_acquire ) == nullptr )
+                return m;
+            return gcas_commit( in, m, disp );
+        }
+
+        // Completes the GCAS of main node m of inode in: the GCAS is committed if the generation of the root
+        // has not been changed, otherwise the previous main node is restored
+        main_node * gcas_commit( inode * in, main_node * m, rcu_disposer& disp )
+        {
+            assert( !is_read_only());
+
+            while ( true ) {
+                main_node * pPrev = m->m_pPrev.load( memory_model::memory_order_acquire );
+                if ( !pPrev )
+                    return m;
+
+                inode * pRoot = read_root( true, disp );
+                pPrev = m->m_pPrev.load( memory_model::memory_order_acquire );
+                if ( !pPrev )
+                    return m;
+
+                if ( pPrev->m_nKind == kind_failed ) {
+                    main_node * pOld = static_cast<failed_node *>( pPrev )->m_pOld;
+                    main_node * pExpected = m;
+                    if ( in->m_pMain.compare_exchange_strong( pExpected, pOld, memory_model::memory_order_acq_rel, atomics::memory_order_acquire )) {
+                        disp.release( m );
+                        return pOld;
+                    }
+                    m = pExpected;
+                    continue;
+                }
+
+                if ( pRoot->m_nGen == in->m_nGen ) {
+                    if ( m->m_pPrev.compare_exchange_strong( pPrev, nullptr, memory_model::memory_order_acq_rel, atomics::memory_order_acquire )) {
+                        // committed, pPrev is not referenced by the inode anymore
+                        disp.release( pPrev );
+                        return m;
+                    }
+                    continue;
+                }
+
+                // The snapshot has been taken
+                m_Stat.onGCASFailed();
+                failed_node * fn = cxx_failed_node_allocator().New( pPrev );
+                if ( !m->m_pPrev.compare_exchange_strong( pPrev, fn, memory_model::memory_order_acq_rel, atomics::memory_order_acquire ))
+                    cxx_failed_node_allocator().Delete( fn );
+                m = in->m_pMain.load( memory_model::memory_order_acquire );
+            }
+        }
+
+        // Replaces main node pOld of in with pNew. pNew is consumed
+        bool gcas( inode * in, main_node * pOld, main_node * pNew, rcu_disposer& disp )
+        {
+            pNew->m_pPrev.store( pOld, memory_model::memory_order_relaxed );
+            main_node * pExpected = pOld;
+            if ( in->m_pMain.compare_exchange_strong( pExpected, pNew, memory_model::memory_order_release, atomics::memory_order_relaxed )) {
+                gcas_commit( in, pNew, disp );
+                return pNew->m_pPrev.load( memory_model::memory_order_acquire ) == nullptr;
+            }
+            disp.release( pNew );
+            return false;
+        }
+
+        inode * read_root( bool bAbort, rcu_disposer& disp )
+        {
+            node_base * pRoot = m_pRoot.load( memory_model::memory_order_acquire );
+            if ( pRoot->m_nKind == kind_inode )
+                return static_cast<inode *>( pRoot );
+            return rdcss_complete( bAbort, disp );
+        }
+
+        inode * rdcss_complete( bool bAbort, rcu_disposer& disp )
+        {
+            while ( true ) {
+                node_base * pRoot = m_pRoot.load( memory_model::memory_order_acquire );
+                if ( pRoot->m_nKind == kind_inode )
+                    return static_cast<inode *>( pRoot );
+
+                rdcss_descriptor * desc = static_cast<rdcss_descriptor *>( pRoot );
+                int nState = desc->m_nState.load( memory_model::memory_order_acquire );
+                if ( nState == rdcss_undecided ) {
+                    int nDecision = rdcss_aborted;
+                    if ( !bAbort && gcas_read( desc->m_pOld, disp ) == desc->m_pExpected )
+                        nDecision = rdcss_committed;
+                    if ( desc->m_nState.compare_exchange_strong( nState, nDecision, memory_model::memory_order_acq_rel, atomics::memory_order_acquire ))
+                        nState = nDecision;
+                }
+
+                bool const bCommitted = nState == rdcss_committed;
+                node_base * pExpected = desc;
+                if ( m_pRoot.compare_exchange_strong( pExpected, bCommitted ? desc->m_pNew : desc->m_pOld, memory_model::memory_order_acq_rel, atomics::memory_order_acquire )) {
+                    disp.release( bCommitted ? desc->m_pOld : desc->m_pNew );
+                    disp.retire( desc );
+                    return bCommitted ? desc->m_pNew : desc->m_pOld;
+                }
+            }
+        }
+
+        // Replaces the root pOld with pNew if the main node of pOld is pExpected. pNew is consumed
+        bool rdcss_root( inode * pOld, main_node * pExpected, inode * pNew, rcu_disposer& disp )
+        {
+            rdcss_descriptor * desc = cxx_rdcss_allocator().New( pOld, pExpected, pNew );
+            node_base * pCur = pOld;
+            if ( m_pRoot.compare_exchange_strong( pCur, desc, memory_model::memory_order_acq_rel, atomics::memory_order_acquire )) {
+                rdcss_complete( false, disp );
+                // desc may be retired by other thread but it is alive while RCU is locked
+                return desc->m_nState.load( memory_model::memory_order_acquire ) == rdcss_committed;
+            }
+            cxx_rdcss_allocator().Delete( desc );
+            disp.release( pNew );
+            return false;
+        }
+
+        // Returns the root for a read-only snapshot, the caller owns the reference
+        inode * read_only_root()
+        {
+            rcu_disposer disp;
+            if ( is_read_only()) {
+                inode * pRoot = static_cast<inode *>( m_pRoot.load( memory_model::memory_order_acquire ));
+                acquire( pRoot );
+                return pRoot;
+            }
+
+            while ( true ) {
+                {
+                    rcu_lock l;
+                    inode * pRoot = read_root( false, disp );
+                    if ( try_acquire( pRoot )) {
+                        main_node * pMain = gcas_read( pRoot, disp );
+                        if ( pMain->m_nKind != kind_dead && try_acquire( pMain )) {
+                            if ( rdcss_root( pRoot, pMain, alloc_inode( pMain, next_generation()), disp )) {
+                                m_Stat.onReadOnlySnapshot();
+                                return pRoot;
+                            }
+                        }
+                        disp.release( pRoot );
+                    }
+                }
+                m_Stat.onSnapshotRetry();
+            }
+        }
+
+        // Copies the branches of cn into ncn except the branch nSkip that is owned already.
+        // On failure the references are released and ncn is freed
+        bool acquire_branches( cnode * ncn, size_t nSkip, rcu_disposer& disp )
+        {
+            size_t const nSize = ncn->size();
+            for ( size_t i = 0; i < nSize; ++i ) {
+                if ( i != nSkip && !try_acquire( ncn->m_arrBranch[i] )) {
+                    // cn has been released, it is stale
+                    for ( size_t k = 0; k < i; ++k )
+                        disp.release( ncn->m_arrBranch[k] );
+                    if ( nSkip > i && nSkip < nSize )
+                        disp.release( ncn->m_arrBranch[nSkip] );
+                    free_shell( ncn );
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // The copy of cn with inserted branch pNew. pNew is consumed
+        cnode * inserted_at( cnode * cn, size_t nPos, uint32_t nFlag, node_base * pNew, generation_type nGen, rcu_disposer& disp )
+        {
+            size_t const nSize = cn->size();
+            cnode * ncn = alloc_cnode( nGen, cn->m_nBitmap | nFlag, nSize + 1 );
+            std::copy( cn->m_arrBranch, cn->m_arrBranch + nPos, ncn->m_arrBranch );
+            ncn->m_arrBranch[nPos] = pNew;
+            std::copy( cn->m_arrBranch + nPos, cn->m_arrBranch + nSize, ncn->m_arrBranch + nPos + 1 );
+            return acquire_branches( ncn, nPos, disp ) ? ncn : nullptr;
+        }
+
+        // The copy of cn with branch nPos replaced with pNew. pNew is consumed
+        cnode * updated_at( cnode * cn, size_t nPos, node_base * pNew, generation_type nGen, rcu_disposer& disp )
+        {
+            cnode * ncn = alloc_cnode( nGen, cn->m_nBitmap, cn->size());
+            std::copy( cn->m_arrBranch, cn->m_arrBranch + cn->size(), ncn->m_arrBranch );
+            ncn->m_arrBranch[nPos] = pNew;
+            return acquire_branches( ncn, nPos, disp ) ? ncn : nullptr;
+        }
+
+        // The copy of cn without branch nPos
+        cnode * removed_at( cnode * cn, size_t nPos, uint32_t nFlag, generation_type nGen, rcu_disposer& disp )
+        {
+            size_t const nSize = cn->size();
+            cnode * ncn = alloc_cnode( nGen, cn->m_nBitmap ^ nFlag, nSize - 1 );
+            std::copy( cn->m_arrBranch, cn->m_arrBranch + nPos, ncn->m_arrBranch );
+            std::copy( cn->m_arrBranch + nPos + 1, cn->m_arrBranch + nSize, ncn->m_arrBranch + nPos );
+            return acquire_branches( ncn, static_cast<size_t>( 0 ) - 1, disp ) ? ncn : nullptr;
+        }
+
+        // The copy of cn with generation nGen; the inodes are copied to the new generation
+        cnode * renewed( cnode * cn, generation_type nGen, rcu_disposer& disp )
+        {
+            m_Stat.onRenew();
+
+            size_t const nSize = cn->size();
+            cnode * ncn = alloc_cnode( nGen, cn->m_nBitmap, nSize );
+            for ( size_t i = 0; i < nSize; ++i ) {
+                node_base * pBranch = cn->m_arrBranch[i];
+                if ( pBranch->m_nKind == kind_inode )
+                    pBranch = copy_to_gen( static_cast<inode *>( pBranch ), nGen, disp );
+                else if ( !try_acquire( pBranch ))
+                    pBranch = nullptr;
+
+                if ( !pBranch ) {
+                    for ( size_t k = 0; k < i; ++k )
+                        disp.release( ncn->m_arrBranch[k] );
+                    free_shell( ncn );
+                    return nullptr;
+                }
+                ncn->m_arrBranch[i] = pBranch;
+            }
+            return ncn;
+        }
+
+        inode * copy_to_gen( inode * in, generation_type nGen, rcu_disposer& disp )
+        {
+            main_node * m = gcas_read( in, disp );
+            if ( m->m_nKind == kind_dead || !try_acquire( m ))
+                return nullptr;
+            return alloc_inode( m, nGen );
+        }
+
+        // Replaces the inner node having one item with the tomb node. ncn is consumed
+        main_node * to_contracted( cnode * ncn, unsigned nLevel )
+        {
+            if ( nLevel > 0 && ncn->m_nBitmap != 0 && ncn->size() == 1 && ncn->m_arrBranch[0]->m_nKind == kind_snode ) {
+                tnode * tn = cxx_tnode_allocator().New( static_cast<snode *>( ncn->m_arrBranch[0] ));
+                free_shell( ncn );
+                return tn;
+            }
+            return ncn;
+        }
+
+        // The copy of cn where the tomb nodes of the branches are resurrected
+        main_node * to_compressed( cnode * cn, unsigned nLevel, generation_type nGen, rcu_disposer& disp )
+        {
+            size_t const nSize = cn->size();
+            cnode * ncn = alloc_cnode( nGen, cn->m_nBitmap, nSize );
+            for ( size_t i = 0; i < nSize; ++i ) {
+                node_base * pBranch = cn->m_arrBranch[i];
+                if ( pBranch->m_nKind == kind_inode ) {
+                    main_node * m = gcas_read( static_cast<inode *>( pBranch ), disp );
+                    if ( m->m_nKind == kind_tnode ) {
+                        pBranch = static_cast<tnode *>( m )->m_pSNode;
+                        m_Stat.onTombCompress();
+                    }
+                }
+
+                if ( !try_acquire( pBranch )) {
+                    for ( size_t k = 0; k < i; ++k )
+                        disp.release( ncn->m_arrBranch[k] );
+                    free_shell( ncn );
+                    return nullptr;
+                }
+                ncn->m_arrBranch[i] = pBranch;
+            }
+            return to_contracted( ncn, nLevel );
+        }
+
+        // The main node containing two items. x and y are consumed
+        main_node * dual( snode * x, snode * y, unsigned nLevel, generation_type nGen )
+        {
+            if ( nLevel < c_nHashBits ) {
+                unsigned const nIdxX = level_index( x->m_nHash, nLevel );
+                unsigned const nIdxY = level_index( y->m_nHash, nLevel );
+                uint32_t const nBitmap = ( uint32_t( 1 ) << nIdxX ) | ( uint32_t( 1 ) << nIdxY );
+                if ( nIdxX == nIdxY ) {
+                    cnode * cn = alloc_cnode( nGen, nBitmap, 1 );
+                    cn->m_arrBranch[0] = alloc_inode( dual( x, y, nLevel + c_nLevelBits, nGen ), nGen );
+                    return cn;
+                }
+
+                cnode * cn = alloc_cnode( nGen, nBitmap, 2 );
+                cn->m_arrBranch[0] = nIdxX < nIdxY ? x : y;
+                cn->m_arrBranch[1] = nIdxX < nIdxY ? y : x;
+                return cn;
+            }
+
+            // full hash collision
+            m_Stat.onCollision();
+            lnode * ln = alloc_lnode( 2 );
+            ln->m_arrItems[0] = x;
+            ln->m_arrItems[1] = y;
+            return ln;
+        }
+
+        // The copy of ln with item nIdx replaced with pNew, or with appended pNew if nIdx == ln->m_nSize. pNew is consumed
+        lnode * lnode_updated( lnode * ln, size_t nIdx, snode * pNew, rcu_disposer& disp )
+        {
+            size_t const nSize = nIdx < ln->m_nSize ? ln->m_nSize : ln->m_nSize + 1;
+            lnode * nln = alloc_lnode( nSize );
+            std::copy( ln->m_arrItems, ln->m_arrItems + ln->m_nSize, nln->m_arrItems );
+            nln->m_arrItems[nIdx] = pNew;
+            for ( size_t i = 0; i < nSize; ++i ) {
+                if ( i != nIdx && !try_acquire( nln->m_arrItems[i] )) {
+                    for ( size_t k = 0; k < i; ++k )
+                        disp.release( nln->m_arrItems[k] );
+                    if ( nIdx > i )
+                        disp.release( pNew );
+                    free_shell( nln );
+                    return nullptr;
+                }
+            }
+            return nln;
+        }
+
+        // The copy of ln without item nIdx; the tomb node if one item remains
+        main_node * lnode_removed( lnode * ln, size_t nIdx, rcu_disposer& disp )
+        {
+            size_t const nSize = ln->m_nSize - 1;
+            if ( nSize == 1 ) {
+                snode * pRest = ln->m_arrItems[nIdx == 0 ? 1 : 0];
+                if ( !try_acquire( pRest ))
+                    return nullptr;
+                return cxx_tnode_allocator().New( pRest );
+            }
+
+            lnode * nln = alloc_lnode( nSize );
+            std::copy( ln->m_arrItems, ln->m_arrItems + nIdx, nln->m_arrItems );
+            std::copy( ln->m_arrItems + nIdx + 1, ln->m_arrItems + ln->m_nSize, nln->m_arrItems + nIdx );
+            for ( size_t i = 0; i < nSize; ++i ) {
+                if ( !try_acquire( nln->m_arrItems[i] )) {
+                    for ( size_t k = 0; k < i; ++k )
+                        disp.release( nln->m_arrItems[k] );
+                    free_shell( nln );
+                    return nullptr;
+                }
+            }
+            return nln;
+        }
+
+        template <typename K>
+        static size_t lnode_find( lnode const * ln, K const& key, hash_type nHash )
+        {
+            for ( size_t i = 0; i < ln->m_nSize; ++i ) {
+                if ( key_equal( ln->m_arrItems[i], key, nHash ))
+                    return i;
+            }
+            return ln->m_nSize;
+        }
+
+        // Resurrects the tomb nodes of the branches of in
+        void clean( inode * in, unsigned nLevel, rcu_disposer& disp )
+        {
+            main_node * m = gcas_read( in, disp );
+            if ( m->m_nKind == kind_cnode ) {
+                main_node * pNew = to_compressed( static_cast<cnode *>( m ), nLevel, in->m_nGen, disp );
+                if ( pNew )
+                    gcas( in, m, pNew, disp );
+            }
+        }
+
+        // Replaces the branch in of pParent with the item of its tomb node
+        void clean_parent( inode * pParent, inode * in, tnode * tn, hash_type nHash, unsigned nParentLevel, generation_type nStartGen, rcu_disposer& disp )
+        {
+            while ( true ) {
+                main_node * pm = gcas_read( pParent, disp );
+                if ( pm->m_nKind != kind_cnode )
+                    return;
+
+                cnode * cn = static_cast<cnode *>( pm );
+                uint32_t const nFlag = uint32_t( 1 ) << level_index( nHash, nParentLevel );
+                if (( cn->m_nBitmap & nFlag ) == 0 )
+                    return;
+                size_t const nPos = branch_pos( cn->m_nBitmap, nFlag );
+                if ( cn->m_arrBranch[nPos] != in || !try_acquire( tn->m_pSNode ))
+                    return;
+
+                cnode * ncn = updated_at( cn, nPos, tn->m_pSNode, pParent->m_nGen, disp );
+                if ( !ncn )
+                    return;
+                if ( gcas( pParent, cn, to_contracted( ncn, nParentLevel ), disp )) {
+                    m_Stat.onTombCompress();
+                    return;
+                }
+                if ( read_root( false, disp )->m_nGen != nStartGen )
+                    return;
+            }
+        }
+
+        // Inserting policy: the item is inserted only if the key is not found
+        struct insert_op
+        {
+            snode * m_pNode;
+
+            explicit insert_op( snode * pNode )
+                : m_pNode( pNode )
+            {}
+
+            snode * new_node()
+            {
+                return m_pNode;
+            }
+
+            snode * replace( snode * /*pOld*/, rcu_disposer& /*disp*/ )
+            {
+                return nullptr;
+            }
+
+            void clean( rcu_disposer& disp )
+            {
+                disp.release( m_pNode );
+            }
+        };
+
+        // Inserting policy: the item is created by the first search that has not found the key
+        template <typename K, typename Func>
+        struct insert_with_op
+        {
+            K const&        m_Key;
+            hash_type const m_nHash;
+            Func&           m_Func;
+            snode *         m_pNode;
+
+            insert_with_op( K const& key, hash_type nHash, Func& func )
+                : m_Key( key )
+                , m_nHash( nHash )
+                , m_Func( func )
+                , m_pNode( nullptr )
+            {}
+
+            snode * new_node()
+            {
+                if ( !m_pNode ) {
+                    m_pNode = alloc_snode( m_nHash, m_Key );
+                    m_Func( m_pNode->m_Value );
+                }
+                return m_pNode;
+            }
+
+            snode * replace( snode * /*pOld*/, rcu_disposer& /*disp*/ )
+            {
+                return nullptr;
+            }
+
+            void clean( rcu_disposer& disp )
+            {
+                if ( m_pNode )
+                    disp.release( m_pNode );
+            }
+        };
+
+        // Updating policy: the item is inserted if the key is not found, or the existing item is replaced with its copy
+        template <typename K, typename Func>
+        struct update_op
+        {
+            K const&        m_Key;
+            hash_type const m_nHash;
+            Func&           m_Func;
+            bool const      m_bInsert;
+            snode *         m_pNode;
+
+            update_op( K const& key, hash_type nHash, Func& func, bool bInsert )
+                : m_Key( key )
+                , m_nHash( nHash )
+                , m_Func( func )
+                , m_bInsert( bInsert )
+                , m_pNode( nullptr )
+            {}
+
+            snode * new_node()
+            {
+                // The new item is created once when the key is not found for the first time
+                if ( !m_pNode && m_bInsert ) {
+                    m_pNode = alloc_snode( m_nHash, m_Key );
+                    m_Func( true, m_pNode->m_Value );
+                }
+                return m_pNode;
+            }
+
+            snode * replace( snode * pOld, rcu_disposer& /*disp*/ )
+            {
+                snode * pNew = alloc_snode( pOld->m_nHash, pOld->m_Value.first, pOld->m_Value.second );
+                m_Func( false, pNew->m_Value );
+                return pNew;
+            }
+
+            void clean( rcu_disposer& disp )
+            {
+                if ( m_pNode )
+                    disp.release( m_pNode );
+            }
+        };
+
+        template <typename K, typename Op>
+        update_result do_update( K const& key, hash_type nHash, Op& op )
+        {
+            check_deadlock_policy::check();
+
+            rcu_disposer disp;
+            update_result res;
+            while ( true ) {
+                {
+                    rcu_lock l;
+                    inode * pRoot = read_root( false, disp );
+                    res = rec_insert( pRoot, key, nHash, op, 0, nullptr, pRoot->m_nGen, disp );
+                }
+                if ( res != result_restart )
+                    break;
+                m_Stat.onRestart();
+            }
+            op.clean( disp );
+            return res;
+        }
+
+        template <typename K, typename Op>
+        update_result rec_insert( inode * in, K const& key, hash_type nHash, Op& op, unsigned nLevel, inode * pParent, generation_type nStartGen, rcu_disposer& disp )
+        {
+            while ( true ) {
+                main_node * m = gcas_read( in, disp );
+                switch ( m->m_nKind ) {
+                case kind_cnode:
+                    {
+                        cnode * cn = static_cast<cnode *>( m );
+                        uint32_t const nFlag = uint32_t( 1 ) << level_index( nHash, nLevel );
+                        size_t const nPos = branch_pos( cn->m_nBitmap, nFlag );
+
+                        if (( cn->m_nBitmap & nFlag ) == 0 ) {
+                            snode * pNew = op.new_node();
+                            if ( !pNew )
+                                return result_not_found;
+                            acquire( pNew );
+
+                            cnode * rn = cn;
+                            if ( cn->m_nGen != in->m_nGen ) {
+                                rn = renewed( cn, in->m_nGen, disp );
+                                if ( !rn ) {
+                                    disp.release( pNew );
+                                    return result_restart;
+                                }
+                            }
+                            cnode * ncn = inserted_at( rn, nPos, nFlag, pNew, in->m_nGen, disp );
+                            if ( rn != cn )
+                                disp.release( rn );
+                            return ncn && gcas( in, cn, ncn, disp ) ? result_inserted : result_restart;
+                        }
+
+                        node_base * pBranch = cn->m_arrBranch[nPos];
+                        if ( pBranch->m_nKind == kind_inode ) {
+                            inode * pSub = static_cast<inode *>( pBranch );
+                            if ( pSub->m_nGen == nStartGen )
+                                return rec_insert( pSub, key, nHash, op, nLevel + c_nLevelBits, in, nStartGen, disp );
+
+                            cnode * rn = renewed( cn, nStartGen, disp );
+                            if ( rn && gcas( in, cn, rn, disp ))
+                                continue;
+                            return result_restart;
+                        }
+
+                        snode * sn = static_cast<snode *>( pBranch );
+                        if ( key_equal( sn, key, nHash )) {
+                            snode * pNew = op.replace( sn, disp );
+                            if ( !pNew )
+                                return result_found;
+                            cnode * ncn = updated_at( cn, nPos, pNew, in->m_nGen, disp );
+                            return ncn && gcas( in, cn, ncn, disp ) ? result_updated : result_restart;
+                        }
+
+                        snode * pNew = op.new_node();
+                        if ( !pNew )
+                            return result_not_found;
+                        if ( !try_acquire( sn ))
+                            return result_restart;
+                        acquire( pNew );
+
+                        cnode * rn = cn;
+                        if ( cn->m_nGen != in->m_nGen ) {
+                            rn = renewed( cn, in->m_nGen, disp );
+                            if ( !rn ) {
+                                disp.release( sn );
+                                disp.release( pNew );
+                                return result_restart;
+                            }
+                        }
+                        inode * pSub = alloc_inode( dual( sn, pNew, nLevel + c_nLevelBits, in->m_nGen ), in->m_nGen );
+                        cnode * ncn = updated_at( rn, nPos, pSub, in->m_nGen, disp );
+                        if ( rn != cn )
+                            disp.release( rn );
+                        return ncn && gcas( in, cn, ncn, disp ) ? result_inserted : result_restart;
+                    }
+
+                case kind_tnode:
+                    if ( pParent )
+                        clean( pParent, nLevel - c_nLevelBits, disp );
+                    return result_restart;
+
+                case kind_lnode:
+                    {
+                        lnode * ln = static_cast<lnode *>( m );
+                        size_t const nIdx = lnode_find( ln, key, nHash );
+                        update_result res = result_inserted;
+                        snode * pNew;
+                        if ( nIdx < ln->m_nSize ) {
+                            pNew = op.replace( ln->m_arrItems[nIdx], disp );
+                            if ( !pNew )
+                                return result_found;
+                            res = result_updated;
+                        }
+                        else {
+                            pNew = op.new_node();
+                            if ( !pNew )
+                                return result_not_found;
+                            acquire( pNew );
+                        }
+
+                        lnode * nln = lnode_updated( ln, nIdx, pNew, disp );
+                        return nln && gcas( in, ln, nln, disp ) ? res : result_restart;
+                    }
+
+                default:
+                    // the inode is dead
+                    assert( m->m_nKind == kind_dead );
+                    return result_restart;
+                }
+            }
+        }
+
+        template <typename K, typename Func>
+        update_result rec_remove( inode * in, K const& key, hash_type nHash, Func& f, unsigned nLevel, inode * pParent, generation_type nStartGen, rcu_disposer& disp )
+        {
+            while ( true ) {
+                main_node * m = gcas_read( in, disp );
+                switch ( m->m_nKind ) {
+                case kind_cnode:
+                    {
+                        cnode * cn = static_cast<cnode *>( m );
+                        uint32_t const nFlag = uint32_t( 1 ) << level_index( nHash, nLevel );
+                        if (( cn->m_nBitmap & nFlag ) == 0 )
+                            return result_not_found;
+
+                        size_t const nPos = branch_pos( cn->m_nBitmap, nFlag );
+                        node_base * pBranch = cn->m_arrBranch[nPos];
+                        update_result res;
+                        if ( pBranch->m_nKind == kind_inode ) {
+                            inode * pSub = static_cast<inode *>( pBranch );
+                            if ( pSub->m_nGen != nStartGen ) {
+                                cnode * rn = renewed( cn, nStartGen, disp );
+                                if ( rn && gcas( in, cn, rn, disp ))
+                                    continue;
+                                return result_restart;
+                            }
+                            res = rec_remove( pSub, key, nHash, f, nLevel + c_nLevelBits, in, nStartGen, disp );
+                        }
+                        else {
+                            snode * sn = static_cast<snode *>( pBranch );
+                            if ( !key_equal( sn, key, nHash ))
+                                return result_not_found;
+
+                            cnode * ncn = removed_at( cn, nPos, nFlag, in->m_nGen, disp );
+                            if ( !ncn || !gcas( in, cn, to_contracted( ncn, nLevel ), disp ))
+                                return result_restart;
+                            f( sn->m_Value );
+                            res = result_erased;
+                        }
+
+                        if ( res == result_erased && pParent ) {
+                            // the tomb node is never at the root
+                            main_node * n = gcas_read( in, disp );
+                            if ( n->m_nKind == kind_tnode )
+                                clean_parent( pParent, in, static_cast<tnode *>( n ), nHash, nLevel - c_nLevelBits, nStartGen, disp );
+                        }
+                        return res;
+                    }
+
+                case kind_tnode:
+                    if ( pParent )
+                        clean( pParent, nLevel - c_nLevelBits, disp );
+                    return result_restart;
+
+                case kind_lnode:
+                    {
+                        lnode * ln = static_cast<lnode *>( m );
+                        size_t const nIdx = lnode_find( ln, key, nHash );
+                        if ( nIdx == ln->m_nSize )
+                            return result_not_found;
+
+                        snode * sn = ln->m_arrItems[nIdx];
+                        main_node * pNew = lnode_removed( ln, nIdx, disp );
+                        if ( !pNew || !gcas( in, ln, pNew, disp ))
+                            return result_restart;
+                        f( sn->m_Value );
+                        return result_erased;
+                    }
+
+                default:
+                    assert( m->m_nKind == kind_dead );
+                    return result_restart;
+                }
+            }
+        }
+
+        template <typename K, typename Func>
+        update_result lookup( K const& key, hash_type nHash, Func& f, rcu_disposer& disp )
+        {
+            inode * in = read_root( false, disp );
+            unsigned nLevel = 0;
+            while ( true ) {
+                main_node * m = gcas_read( in, disp );
+                snode * sn = nullptr;
+                switch ( m->m_nKind ) {
+                case kind_cnode:
+                    {
+                        cnode * cn = static_cast<cnode *>( m );
+                        uint32_t const nFlag = uint32_t( 1 ) << level_index( nHash, nLevel );
+                        if (( cn->m_nBitmap & nFlag ) == 0 )
+                            return result_not_found;
+
+                        node_base * pBranch = cn->m_arrBranch[branch_pos( cn->m_nBitmap, nFlag )];
+                        if ( pBranch->m_nKind == kind_inode ) {
+                            in = static_cast<inode *>( pBranch );
+                            nLevel += c_nLevelBits;
+                            continue;
+                        }
+                        sn = static_cast<snode *>( pBranch );
+                    }
+                    break;
+                case kind_tnode:
+                    // the item of the tomb node is alive until it is moved to the parent
+                    sn = static_cast<tnode *>( m )->m_pSNode;
+                    break;
+                case kind_lnode:
+                    {
+                        lnode * ln = static_cast<lnode *>( m );
+                        size_t const nIdx = lnode_find( ln, key, nHash );
+                        if ( nIdx == ln->m_nSize )
+                            return result_not_found;
+                        sn = ln->m_arrItems[nIdx];
+                    }
+                    break;
+                default:
+                    assert( m->m_nKind == kind_dead );
+                    return result_restart;
+                }
+
+                if ( !key_equal( sn, key, nHash ))
+                    return result_not_found;
+                f( sn->m_Value );
+                return result_found;
+            }
+        }
+
+        bool has_items( inode * in, rcu_disposer& disp )
+        {
+            main_node * m = gcas_read( in, disp );
+            switch ( m->m_nKind ) {
+            case kind_cnode:
+                {
+                    cnode * cn = static_cast<cnode *>( m );
+                    for ( size_t i = 0, nSize = cn->size(); i < nSize; ++i ) {
+                        node_base * pBranch = cn->m_arrBranch[i];
+                        if ( pBranch->m_nKind == kind_snode || has_items( static_cast<inode *>( pBranch ), disp ))
+                            return true;
+                    }
+                }
+                return false;
+            case kind_tnode:
+            case kind_lnode:
+                return true;
+            default:
+                return false;
+            }
+        }
+        //@endcond
+
+    private:
+        //@cond
+        atomics::atomic<node_base *>    m_pRoot;    // inode or RDCSS descriptor
+        bool const                      m_bReadOnly;
+        stat                            m_Stat;
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_CTRIE_MAP_RCU_H
@@ -0,0 +1,281 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_DETAILS_BULK_LOAD_H
+#define CDSLIB_CONTAINER_DETAILS_BULK_LOAD_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <exception>
+#include <limits>
+#include <cds/algo/atomic.h>
+#include <cds/threading/model.h>
+
+namespace cds { namespace container {
+
+    //@cond
+    namespace details {
+
+        /// Parallel loading of a range into a hash container
+        /**
+            The helper is used by \p bulk_load() functions of hash maps.
+
+            The input range is partitioned by the low bits of the hash value of the key.
+            In \p MichaelHashMap the keys of different partitions fall into different buckets,
+            in \p SplitListMap they fall into different segments of the split-ordered list,
+            so the worker threads insert into disjoint parts of the container and almost do not contend.
+
+            The loading has three phases, each of them is executed in \p nThreads threads:
+            - each thread hashes its chunk of the range and counts the items of each partition;
+            - each thread scatters the indices of its chunk by partition (counting sort);
+            - the threads take the partitions one by one and load them into the container.
+            Only the last phase works with the container, the threads are attached to the GC for that phase.
+
+            \p load() inserts the items of a partition one by one, \p load_partitions() passes
+            the whole partition to the container, so the container can link the items privately
+            and publish them by a few atomic operations.
+
+            An exception thrown by a functor in any thread is rethrown in the calling thread
+            when all threads of the phase have finished; the next phases are not executed.
+        */
+        class bulk_loader
+        {
+        public:
+            static constexpr size_t const c_nMinItemsPerThread = 1024;  ///< Minimal count of items per worker thread
+            static constexpr size_t const c_nPartitionsPerThread = 8;   ///< Count of partitions per thread, for load balancing
+
+            /// Loads the range [\p first, \p last) by <tt>insert_func( item, nHash )</tt> calls
+            /**
+                \p hash_func( item ) returns the hash value of the item's key,
+                \p insert_func( item, nHash ) inserts the item and returns \p true if the item has been inserted.
+                The function returns the count of inserted items.
+            */
+            template <typename RandomIt, typename HashFunc, typename InsertFunc>
+            static size_t load( RandomIt first, RandomIt last, size_t nThreads, HashFunc hash_func, InsertFunc insert_func )
+            {
+                nThreads = thread_count( static_cast<size_t>( last - first ), nThreads );
+                if ( nThreads < 2 ) {
+                    size_t nInserted = 0;
+                    for ( ; first != last; ++first ) {
+                        if ( insert_func( *first, hash_func( *first )))
+                            ++nInserted;
+                    }
+                    return nInserted;
+                }
+
+                partitioning parts( static_cast<size_t>( last - first ), nThreads, std::numeric_limits<size_t>::max());
+                parts.build( first, hash_func );
+
+                atomics::atomic<size_t> nNextPart( 0 );
+                atomics::atomic<size_t> nInserted( 0 );
+                run( nThreads, true, [&]( size_t /*nThread*/ ) {
+                    size_t nLocalInserted = 0;
+                    for ( size_t nPart = nNextPart.fetch_add( 1, atomics::memory_order_relaxed );
+                          nPart < parts.nPartCount;
+                          nPart = nNextPart.fetch_add( 1, atomics::memory_order_relaxed ))
+                    {
+                        for ( size_t k = parts.arrPartStart[nPart], nEnd = parts.arrPartStart[nPart + 1]; k < nEnd; ++k ) {
+                            size_t const i = parts.arrIndex[k];
+                            if ( insert_func( first[i], parts.arrHash[i] ))
+                                ++nLocalInserted;
+                        }
+                    }
+                    nInserted.fetch_add( nLocalInserted, atomics::memory_order_relaxed );
+                });
+
+                return nInserted.load( atomics::memory_order_relaxed );
+            }
+
+            /// Loads the range [\p first, \p last) partition by partition
+            /**
+                The count of partitions \p nPartCount is a power of 2 not greater than \p nMaxPartCount
+                (\p nMaxPartCount should be a power of 2 too), the partition of an item is <tt>nHash & (nPartCount - 1)</tt>.
+
+                \p hash_func( item ) returns the hash value of the item's key.
+                \p prepare_func( nPartCount ) is called in the current thread before loading.
+                \p part_func( nPart, nPartCount, pIdx, pEnd, pHash, nLoaded ) loads the items <tt>first[*p]</tt>, \p p in [\p pIdx, \p pEnd),
+                of partition \p nPart; <tt>pHash[i]</tt> is the hash value of <tt>first[i]</tt>. The functor may reorder
+                [\p pIdx, \p pEnd) and adds the count of the items inserted to \p nLoaded as soon as they are in the container.
+                Even the current thread only (\p nThreads <= 1) loads the range partition by partition.
+
+                The total count of the items inserted is added to \p counter once after loading, even if a functor throws.
+                The function returns the count of inserted items.
+            */
+            template <typename RandomIt, typename Counter, typename HashFunc, typename PrepareFunc, typename PartFunc>
+            static size_t load_partitions( RandomIt first, RandomIt last, size_t nThreads, size_t nMaxPartCount, Counter& counter,
+                HashFunc hash_func, PrepareFunc prepare_func, PartFunc part_func )
+            {
+                nThreads = thread_count( static_cast<size_t>( last - first ), nThreads );
+                if ( nThreads == 0 )
+                    nThreads = 1;
+
+                partitioning parts( static_cast<size_t>( last - first ), nThreads, nMaxPartCount );
+                parts.build( first, hash_func );
+
+                prepare_func( parts.nPartCount );
+
+                atomics::atomic<size_t> nNextPart( 0 );
+                atomics::atomic<size_t> nLoaded( 0 );
+                try {
+                    run( nThreads, true, [&]( size_t /*nThread*/ ) {
+                        size_t nLocalLoaded = 0;
+                        try {
+                            for ( size_t nPart = nNextPart.fetch_add( 1, atomics::memory_order_relaxed );
+                                  nPart < parts.nPartCount;
+                                  nPart = nNextPart.fetch_add( 1, atomics::memory_order_relaxed ))
+                            {
+                                part_func( nPart, parts.nPartCount,
+                                    parts.arrIndex.data() + parts.arrPartStart[nPart], parts.arrIndex.data() + parts.arrPartStart[nPart + 1],
+                                    parts.arrHash.data(), nLocalLoaded );
+                            }
+                        }
+                        catch ( ... ) {
+                            nLoaded.fetch_add( nLocalLoaded, atomics::memory_order_relaxed );
+                            throw;
+                        }
+                        nLoaded.fetch_add( nLocalLoaded, atomics::memory_order_relaxed );
+                    });
+                }
+                catch ( ... ) {
+                    counter += nLoaded.load( atomics::memory_order_relaxed );
+                    throw;
+                }
+
+                size_t const nTotal = nLoaded.load( atomics::memory_order_relaxed );
+                counter += nTotal;
+                return nTotal;
+            }
+
+        private:
+            // The count of loading threads: each thread takes at least c_nMinItemsPerThread items
+            static size_t thread_count( size_t nCount, size_t nThreads )
+            {
+                return nThreads > nCount / c_nMinItemsPerThread ? nCount / c_nMinItemsPerThread : nThreads;
+            }
+
+            // The indices of the range scattered by partition
+            struct partitioning
+            {
+                size_t const        nCount;
+                size_t const        nThreads;
+                size_t              nPartCount;
+                std::vector<size_t> arrHash;      // [item]
+                std::vector<size_t> arrIndex;     // the indices of the items of partition i are [arrPartStart[i], arrPartStart[i + 1])
+                std::vector<size_t> arrPartStart; // [partition]
+
+                partitioning( size_t nItemCount, size_t nThreadCount, size_t nMaxPartCount )
+                    : nCount( nItemCount )
+                    , nThreads( nThreadCount )
+                    , nPartCount( 1 )
+                {
+                    while ( nPartCount < nThreads * c_nPartitionsPerThread && nPartCount <= nMaxPartCount / 2 )
+                        nPartCount *= 2;
+                }
+
+                size_t chunk_begin( size_t nChunk ) const
+                {
+                    return nCount * nChunk / nThreads;
+                }
+
+                template <typename RandomIt, typename HashFunc>
+                void build( RandomIt first, HashFunc& hash_func )
+                {
+                    size_t const nPartMask = nPartCount - 1;
+
+                    arrHash.resize( nCount );
+                    std::vector<size_t> arrOffset( nThreads * nPartCount, 0 ); // [chunk][partition]
+
+                    // Phase 1: hashing and counting
+                    run( nThreads, false, [&]( size_t nChunk ) {
+                        size_t* pCounter = arrOffset.data() + nChunk * nPartCount;
+                        for ( size_t i = chunk_begin( nChunk ), nEnd = chunk_begin( nChunk + 1 ); i < nEnd; ++i ) {
+                            size_t const nHash = hash_func( first[i] );
+                            arrHash[i] = nHash;
+                            ++pCounter[nHash & nPartMask];
+                        }
+                    });
+
+                    // Prefix sum in [partition][chunk] order, so the items of each partition are adjacent
+                    arrPartStart.resize( nPartCount + 1 );
+                    size_t nPos = 0;
+                    for ( size_t nPart = 0; nPart < nPartCount; ++nPart ) {
+                        arrPartStart[nPart] = nPos;
+                        for ( size_t nChunk = 0; nChunk < nThreads; ++nChunk ) {
+                            size_t& nOffset = arrOffset[nChunk * nPartCount + nPart];
+                            size_t const nItems = nOffset;
+                            nOffset = nPos;
+                            nPos += nItems;
+                        }
+                    }
+                    arrPartStart[nPartCount] = nPos;
+
+                    // Phase 2: scattering the indices by partition
+                    arrIndex.resize( nCount );
+                    run( nThreads, false, [&]( size_t nChunk ) {
+                        size_t* pOffset = arrOffset.data() + nChunk * nPartCount;
+                        for ( size_t i = chunk_begin( nChunk ), nEnd = chunk_begin( nChunk + 1 ); i < nEnd; ++i )
+                            arrIndex[pOffset[arrHash[i] & nPartMask]++] = i;
+                    });
+                }
+            };
+
+            // Calls func( nThread ) in nThreads threads, the current thread is the thread 0.
+            // The first exception thrown is rethrown in the current thread after all threads are joined
+            template <typename Func>
+            static void run( size_t nThreads, bool bAttach, Func func )
+            {
+                std::exception_ptr pError;
+                std::mutex errorLock;
+                auto guarded_func = [&func, &pError, &errorLock]( size_t nThread ) {
+                    try {
+                        func( nThread );
+                    }
+                    catch ( ... ) {
+                        std::lock_guard<std::mutex> lock( errorLock );
+                        if ( !pError )
+                            pError = std::current_exception();
+                    }
+                };
+
+                std::vector<std::thread> threads;
+                bool bStarted = true;
+                try {
+                    threads.reserve( nThreads - 1 );
+                    for ( size_t nThread = 1; nThread < nThreads; ++nThread ) {
+                        threads.emplace_back( [&guarded_func, nThread, bAttach]() {
+                            if ( bAttach )
+                                cds::threading::Manager::attachThread();
+                            guarded_func( nThread );
+                            if ( bAttach )
+                                cds::threading::Manager::detachThread();
+                        });
+                    }
+                }
+                catch ( ... ) {
+                    // cannot start a thread; the threads started are joined below
+                    bStarted = false;
+                    std::lock_guard<std::mutex> lock( errorLock );
+                    if ( !pError )
+                        pError = std::current_exception();
+                }
+
+                if ( bStarted )
+                    guarded_func( 0 );
+
+                for ( auto& t : threads )
+                    t.join();
+
+                if ( pError )
+                    std::rethrow_exception( pError );
+            }
+        };
+
+    } // namespace details
+    //@endcond
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_DETAILS_BULK_LOAD_H
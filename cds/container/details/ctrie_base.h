@@ -0,0 +1,178 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_DETAILS_CTRIE_BASE_H
+#define CDSLIB_CONTAINER_DETAILS_CTRIE_BASE_H
+
+#include <cds/container/details/base.h>
+#include <cds/opt/compare.h>
+#include <cds/opt/hash.h>
+#include <cds/urcu/options.h>
+#include <cds/algo/atomic.h>
+
+namespace cds { namespace container {
+
+    /// \p CtrieMap related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace ctrie {
+
+        /// Ctrie internal statistics
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter counter_type;   ///< Counter type
+
+            counter_type m_nInsertSuccess;  ///< Count of success inserting
+            counter_type m_nInsertFailed;   ///< Count of failed inserting (the key already exists)
+            counter_type m_nUpdateNew;      ///< Count of new item inserted by \p update()
+            counter_type m_nUpdateExisting; ///< Count of existing item updated by \p update()
+            counter_type m_nUpdateFailed;   ///< Count of failed \p update() call (the key is not found and inserting is not allowed)
+            counter_type m_nEraseSuccess;   ///< Count of success erasing
+            counter_type m_nEraseFailed;    ///< Count of failed erasing (the key is not found)
+            counter_type m_nFindSuccess;    ///< Count of success finding
+            counter_type m_nFindFailed;     ///< Count of failed finding
+            counter_type m_nReadOnlyModify; ///< Count of modifying calls rejected since the map is a read-only snapshot
+
+            counter_type m_nRestart;        ///< Count of operations restarted from the root
+            counter_type m_nRenew;          ///< Count of inner nodes copied to the current generation (lazy copy-on-write after a snapshot)
+            counter_type m_nGCASFailed;     ///< Count of GCAS failed since the generation of the root has been changed
+            counter_type m_nTombCompress;   ///< Count of tomb nodes resurrected into the parent
+            counter_type m_nCollision;      ///< Count of list nodes created for full hash collisions
+            counter_type m_nSnapshot;       ///< Count of writable snapshots
+            counter_type m_nReadOnlySnapshot;   ///< Count of read-only snapshots
+            counter_type m_nSnapshotRetry;  ///< Count of snapshot retries since the root has been changed concurrently
+            counter_type m_nClear;          ///< Count of \p clear() calls
+
+            //@cond
+            void onInsertSuccess()      { ++m_nInsertSuccess;   }
+            void onInsertFailed()       { ++m_nInsertFailed;    }
+            void onUpdateNew()          { ++m_nUpdateNew;       }
+            void onUpdateExisting()     { ++m_nUpdateExisting;  }
+            void onUpdateFailed()       { ++m_nUpdateFailed;    }
+            void onEraseSuccess()       { ++m_nEraseSuccess;    }
+            void onEraseFailed()        { ++m_nEraseFailed;     }
+            void onFindSuccess()        { ++m_nFindSuccess;     }
+            void onFindFailed()         { ++m_nFindFailed;      }
+            void onReadOnlyModify()     { ++m_nReadOnlyModify;  }
+            void onRestart()            { ++m_nRestart;         }
+            void onRenew()              { ++m_nRenew;           }
+            void onGCASFailed()         { ++m_nGCASFailed;      }
+            void onTombCompress()       { ++m_nTombCompress;    }
+            void onCollision()          { ++m_nCollision;       }
+            void onSnapshot()           { ++m_nSnapshot;        }
+            void onReadOnlySnapshot()   { ++m_nReadOnlySnapshot; }
+            void onSnapshotRetry()      { ++m_nSnapshotRetry;   }
+            void onClear()              { ++m_nClear;           }
+            //@endcond
+        };
+
+        /// Ctrie dummy statistics, no overhead
+        struct empty_stat
+        {
+            //@cond
+            void onInsertSuccess()      const {}
+            void onInsertFailed()       const {}
+            void onUpdateNew()          const {}
+            void onUpdateExisting()     const {}
+            void onUpdateFailed()       const {}
+            void onEraseSuccess()       const {}
+            void onEraseFailed()        const {}
+            void onFindSuccess()        const {}
+            void onFindFailed()         const {}
+            void onReadOnlyModify()     const {}
+            void onRestart()            const {}
+            void onRenew()              const {}
+            void onGCASFailed()         const {}
+            void onTombCompress()       const {}
+            void onCollision()          const {}
+            void onSnapshot()           const {}
+            void onReadOnlySnapshot()   const {}
+            void onSnapshotRetry()      const {}
+            void onClear()              const {}
+            //@endcond
+        };
+
+        /// \p CtrieMap default traits
+        struct traits
+        {
+            /// Hash functor
+            /**
+                Default is \p std::hash<Key>. The trie consumes the hash value by 5 bits per level
+                starting from the least significant bits; the keys with equal hash values are kept in a list node.
+            */
+            typedef opt::none       hash;
+
+            /// Key equality functor
+            /**
+                Default is <tt>std::equal_to<Key></tt>
+            */
+            typedef opt::none       equal_to;
+
+            /// Key comparison functor
+            /**
+                No default functor is provided. If \p equal_to is not specified, \p compare is used for the key equality.
+            */
+            typedef opt::none       compare;
+
+            /// Specifies binary predicate used for key comparison.
+            /**
+                If neither \p equal_to nor \p compare is specified, \p less is used for the key equality.
+            */
+            typedef opt::none       less;
+
+            /// Allocator for the nodes of the trie
+            typedef CDS_DEFAULT_ALLOCATOR   allocator;
+
+            /// C++ memory ordering model
+            /**
+                List of available memory ordering see \p opt::memory_model
+            */
+            typedef cds::opt::v::relaxed_ordering   memory_model;
+
+            /// RCU deadlock checking policy
+            /**
+                List of available options see \p opt::rcu_check_deadlock
+            */
+            typedef cds::opt::v::rcu_throw_deadlock rcu_check_deadlock;
+
+            /// Internal statistics, possible types: \p ctrie::stat, \p ctrie::empty_stat (the default)
+            typedef empty_stat      stat;
+        };
+
+        /// Metafunction converting option list to \p ctrie::traits
+        /**
+            Supported \p Options are:
+            - \p opt::hash - hash functor. Default is \p std::hash<Key>.
+            - \p opt::equal_to - key equality functor. Default is \p std::equal_to<Key>.
+            - \p opt::compare - key comparison functor, used for the key equality if \p %opt::equal_to is not specified.
+            - \p opt::less - predicate used for the key equality if neither \p %opt::equal_to nor \p %opt::compare is specified.
+            - \p opt::allocator - allocator for the nodes. Default is \ref CDS_DEFAULT_ALLOCATOR
+            - \p opt::memory_model - C++ memory ordering model. Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
+                or \p opt::v::sequential_consistent (sequentially consisnent memory model).
+            - \p opt::rcu_check_deadlock - a deadlock checking policy. Default is \p opt::v::rcu_throw_deadlock
+            - \p opt::stat - internal statistics. Possible types: \p ctrie::stat, \p ctrie::empty_stat (the default)
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                , Options...
+            >::type type;
+#   endif
+        };
+
+    } // namespace ctrie
+
+    // Forward declaration
+    template < class GC, typename Key, typename T, class Traits = ctrie::traits >
+    class CtrieMap;
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_DETAILS_CTRIE_BASE_H
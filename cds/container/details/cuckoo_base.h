@@ -30,6 +30,14 @@ namespace cds { namespace container {
         using intrusive::cuckoo::refinable;
 #endif
 
+#ifdef CDS_DOXYGEN_INVOKED
+        /// Lock striping policy with optimistic lock-free reads. This is typedef for intrusive::cuckoo::optimistic_striping template
+        class optimistic_striping
+        {};
+#else
+        using intrusive::cuckoo::optimistic_striping;
+#endif
+
 #ifdef CDS_DOXYGEN_INVOKED
         /// Striping internal statistics. This is typedef for intrusive::cuckoo::striping_stat
         class striping_stat
@@ -115,6 +123,18 @@ namespace cds { namespace container {
         using intrusive::cuckoo::list;
         using intrusive::cuckoo::vector;
 
+#ifdef CDS_DOXYGEN_INVOKED
+        /// Incremental resizing option
+        /**
+            @copydetails cds::intrusive::cuckoo::incremental_resizing
+        */
+        template <size_t BucketsPerOp>
+        struct incremental_resizing
+        {};
+#else
+        using intrusive::cuckoo::incremental_resizing;
+#endif
+
         /// Type traits for CuckooSet and CuckooMap classes
         struct traits
         {
@@ -142,6 +162,7 @@ namespace cds { namespace container {
                 Available opt::mutex_policy types:
                 - cuckoo::striping - simple, but the lock array is not resizable
                 - cuckoo::refinable - resizable lock array, but more complex access to set data.
+                - cuckoo::optimistic_striping - lock striping with lock-free optimistic \p find()
 
                 Default is cuckoo::striping.
             */
@@ -195,6 +216,9 @@ namespace cds { namespace container {
 
             /// Internal statistics
             typedef empty_stat                  stat;
+
+            /// Count of old buckets moved by an operation while incremental resizing, see \p cuckoo::incremental_resizing
+            static size_t const incremental_resizing = 0;
         };
 
         /// Metafunction converting option list to CuckooSet/CuckooMap traits
@@ -205,7 +229,7 @@ namespace cds { namespace container {
                 The hash functors are passed as <tt> std::tuple< H1, H2, ... Hn > </tt>. The number of hash functors specifies
                 the number \p k - the count of hash tables in cuckoo hashing.
             - \p opt::mutex_policy - concurrent access policy.
-                Available policies: \p cuckoo::striping, \p cuckoo::refinable.
+                Available policies: \p cuckoo::striping, \p cuckoo::refinable, \p cuckoo::optimistic_striping.
                 Default is \p %cuckoo::striping.
             - \p opt::equal_to - key equality functor like \p std::equal_to.
                 If this functor is defined then the probe-set will be unordered.
@@ -230,6 +254,8 @@ namespace cds { namespace container {
                 Default is \p cuckoo::list.
             - \p opt::stat - internal statistics. Possibly types: \p cuckoo::stat, \p cuckoo::empty_stat.
                 Default is \p %cuckoo::empty_stat
+            - \p cuckoo::incremental_resizing - moves the items to the new bucket tables gradually instead of
+                stop-the-world resizing. Default is <tt>cuckoo::incremental_resizing<0></tt> - no incremental resizing.
         */
         template <typename... Options>
         struct make_traits {
@@ -43,6 +43,13 @@ namespace cds { namespace container {
         template <typename Splitter>
         using hash_splitter = cds::intrusive::feldman_hashset::hash_splitter< Splitter >;
 
+        /// Array node compaction option
+        /**
+            @copydetails cds::intrusive::feldman_hashset::traits::compaction
+        */
+        template <bool Enable>
+        using compaction = cds::intrusive::feldman_hashset::compaction< Enable >;
+
 
         /// \p FeldmanHashMap traits
         struct traits
@@ -140,6 +147,12 @@ namespace cds { namespace container {
             */
             typedef cds::opt::none hash_splitter;
 
+            /// Array node compaction
+            /**
+                @copydetails cds::intrusive::feldman_hashset::traits::compaction
+            */
+            static constexpr bool const compaction = false;
+
             /// Hash comparing functor
             /**
                 @copydetails cds::intrusive::feldman_hashset::traits::compare
@@ -199,6 +212,8 @@ namespace cds { namespace container {
                 @copydetails traits::hash
             - \p feldman_hashmap::hash_size - the size of hash value in bytes.
                 @copydetails traits::hash_size
+            - \p feldman_hashmap::compaction - array node compaction
+                @copydetails traits::compaction
             - \p opt::allocator - item allocator
                 @copydetails traits::allocator
             - \p opt::node_allocator - array node allocator.
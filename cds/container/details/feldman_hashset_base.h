@@ -35,6 +35,13 @@ namespace cds { namespace container {
         template <typename Splitter>
         using hash_splitter = cds::intrusive::feldman_hashset::hash_splitter< Splitter >;
 
+        /// Array node compaction option
+        /**
+            @copydetails cds::intrusive::feldman_hashset::traits::compaction
+        */
+        template <bool Enable>
+        using compaction = cds::intrusive::feldman_hashset::compaction< Enable >;
+
         /// \p FeldmanHashSet internal statistics, see cds::intrusive::feldman_hashset::stat
         template <typename EventCounter = cds::atomicity::event_counter>
         using stat = cds::intrusive::feldman_hashset::stat< EventCounter >;
@@ -70,6 +77,12 @@ namespace cds { namespace container {
             */
             typedef cds::opt::none hash_splitter;
 
+            /// Array node compaction
+            /**
+                @copydetails cds::intrusive::feldman_hashset::traits::compaction
+            */
+            static constexpr bool const compaction = false;
+
             /// Hash comparing functor
             /**
                 @copydetails cds::intrusive::feldman_hashset::traits::compare
@@ -131,6 +144,8 @@ namespace cds { namespace container {
                 @copydetails traits::hash_size
             - \p feldman_hashset::hash_splitter - a hash splitter algorithm
                 @copydetails traits::hash_splitter
+            - \p feldman_hashset::compaction - array node compaction
+                @copydetails traits::compaction
             - \p opt::allocator - item allocator
                 @copydetails traits::allocator
             - \p opt::node_allocator - array node allocator.
@@ -0,0 +1,221 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_DETAILS_FREEZABLE_HASH_BASE_H
+#define CDSLIB_CONTAINER_DETAILS_FREEZABLE_HASH_BASE_H
+
+#include <cds/container/details/base.h>
+#include <cds/opt/compare.h>
+#include <cds/opt/hash.h>
+#include <cds/algo/atomic.h>
+#include <cds/algo/backoff_strategy.h>
+#include <cds/algo/bitop.h>
+
+namespace cds { namespace container {
+
+    /// \p FreezableHashSet and \p FreezableHashMap related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace freezable_hash {
+
+        /// Freezable hash set/map internal statistics
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter counter_type;   ///< Counter type
+
+            counter_type m_nInsertSuccess;  ///< Count of success inserting
+            counter_type m_nInsertFailed;   ///< Count of failed inserting (the key already exists)
+            counter_type m_nUpdateNew;      ///< Count of new item inserted by \p update()
+            counter_type m_nUpdateExisting; ///< Count of existing item updated by \p update()
+            counter_type m_nUpdateFailed;   ///< Count of failed \p update() call (the key is not found and inserting is not allowed)
+            counter_type m_nEraseSuccess;   ///< Count of success erasing
+            counter_type m_nEraseFailed;    ///< Count of failed erasing (the key is not found)
+            counter_type m_nFindSuccess;    ///< Count of success finding
+            counter_type m_nFindFailed;     ///< Count of failed finding
+            counter_type m_nBucketRace;     ///< Count of bucket CAS failures due to concurrent modification of the bucket
+            counter_type m_nFrozenRetry;    ///< Count of retries when the bucket found has been frozen by the resizing
+            counter_type m_nFindRetry;      ///< Count of find retries when the bucket found has been changed while the item is being protected
+            counter_type m_nBucketInit;     ///< Count of buckets initialized by migration from the predecessor table
+            counter_type m_nResize;         ///< Count of bucket table growing
+
+            //@cond
+            void onInsertSuccess()      { ++m_nInsertSuccess;   }
+            void onInsertFailed()       { ++m_nInsertFailed;    }
+            void onUpdateNew()          { ++m_nUpdateNew;       }
+            void onUpdateExisting()     { ++m_nUpdateExisting;  }
+            void onUpdateFailed()       { ++m_nUpdateFailed;    }
+            void onEraseSuccess()       { ++m_nEraseSuccess;    }
+            void onEraseFailed()        { ++m_nEraseFailed;     }
+            void onFindSuccess()        { ++m_nFindSuccess;     }
+            void onFindFailed()         { ++m_nFindFailed;      }
+            void onBucketRace()         { ++m_nBucketRace;      }
+            void onFrozenRetry()        { ++m_nFrozenRetry;     }
+            void onFindRetry()          { ++m_nFindRetry;       }
+            void onBucketInit()         { ++m_nBucketInit;      }
+            void onResize()             { ++m_nResize;          }
+            //@endcond
+        };
+
+        /// Freezable hash set/map dummy statistics, no overhead
+        struct empty_stat
+        {
+            //@cond
+            void onInsertSuccess()      const {}
+            void onInsertFailed()       const {}
+            void onUpdateNew()          const {}
+            void onUpdateExisting()     const {}
+            void onUpdateFailed()       const {}
+            void onEraseSuccess()       const {}
+            void onEraseFailed()        const {}
+            void onFindSuccess()        const {}
+            void onFindFailed()         const {}
+            void onBucketRace()         const {}
+            void onFrozenRetry()        const {}
+            void onFindRetry()          const {}
+            void onBucketInit()         const {}
+            void onResize()             const {}
+            //@endcond
+        };
+
+        /// Freezable hash set/map default traits
+        struct traits
+        {
+            /// Hash function
+            /**
+                Hash function converts the key fields of struct \p T stored in the set
+                into value of type \p size_t called hash value that is an index of hash table.
+                No default functor is provided, you should provide your own one.
+            */
+            typedef opt::none       hash;
+
+            /// Key comparison functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+            */
+            typedef opt::none       compare;
+
+            /// Specifies binary predicate used for key compare.
+            /**
+                Default is \p std::less<T>.
+            */
+            typedef opt::none       less;
+
+            /// Allocator for the items, the buckets and the bucket tables
+            typedef CDS_DEFAULT_ALLOCATOR   allocator;
+
+            /// Item counter
+            /**
+                The item counting is mandatory: the bucket table grows when the item count
+                exceeds <tt>bucket_count() * load_factor</tt>. Use \p cds::atomicity::item_counter (the default)
+                or \p cds::atomicity::cache_friendly_item_counter.
+            */
+            typedef cds::atomicity::item_counter    item_counter;
+
+            /// Back-off strategy for the retries of bucket CAS
+            typedef cds::backoff::empty     back_off;
+
+            /// Internal statistics, possible types: \p freezable_hash::stat, \p freezable_hash::empty_stat (the default)
+            typedef empty_stat              stat;
+        };
+
+        /// Metafunction converting option list to \p freezable_hash::traits
+        /**
+            Supported \p Options are:
+            - \p opt::hash - hash functor. No default functor is provided, you should provide your own one.
+            - \p opt::compare - key comparison functor. No default functor is provided.
+                If the option is not specified, the \p opt::less is used.
+            - \p opt::less - specifies binary predicate used for key comparison. Default is \p std::less<T>.
+            - \p opt::allocator - allocator for the items, the buckets and the bucket tables. Default is \ref CDS_DEFAULT_ALLOCATOR
+            - \p opt::item_counter - the type of item counting feature. Default is \p cds::atomicity::item_counter.
+                \p cds::atomicity::empty_item_counter is not allowed since the resizing depends on the item count.
+            - \p opt::back_off - back-off strategy for the retries. Default is \p cds::backoff::empty
+            - \p opt::stat - internal statistics. Possible types: \p freezable_hash::stat, \p freezable_hash::empty_stat (the default)
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                , Options...
+            >::type type;
+#   endif
+        };
+
+        //@cond
+        namespace details {
+
+            // Initial bucket count: nMaxItemCount / nLoadFactor rounded up to power of 2
+            static inline size_t initial_bucket_count( size_t nMaxItemCount, size_t nLoadFactor )
+            {
+                if ( nLoadFactor == 0 )
+                    nLoadFactor = 1;
+                size_t nBucketCount = nMaxItemCount / nLoadFactor;
+                if ( nBucketCount < 4 )
+                    nBucketCount = 4;
+                return size_t( 1 ) << cds::bitop::MSBnz( nBucketCount * 2 - 1 );
+            }
+
+            // Map traits: hash and comparator apply to pair::first
+            template <typename Key, typename Value, typename Traits>
+            struct make_map_traits
+            {
+                typedef std::pair< Key const, Value > value_type;
+                typedef typename cds::opt::v::hash_selector< typename Traits::hash >::type key_hash;
+                typedef typename cds::opt::details::make_comparator< Key, Traits >::type key_comparator;
+
+                struct hash_adapter: public key_hash
+                {
+                    size_t operator()( value_type const& v ) const
+                    {
+                        return key_hash::operator()( v.first );
+                    }
+
+                    template <typename Q>
+                    size_t operator()( Q const& k ) const
+                    {
+                        return key_hash::operator()( k );
+                    }
+                };
+
+                struct comparator_adapter
+                {
+                    int operator()( value_type const& v1, value_type const& v2 ) const
+                    {
+                        return key_comparator()( v1.first, v2.first );
+                    }
+
+                    template <typename Q>
+                    int operator()( value_type const& v, Q const& k ) const
+                    {
+                        return key_comparator()( v.first, k );
+                    }
+                };
+
+                struct type: public Traits
+                {
+                    typedef hash_adapter        hash;
+                    typedef comparator_adapter  compare;
+                    typedef opt::none           less;
+                };
+            };
+
+        } // namespace details
+        //@endcond
+
+    } // namespace freezable_hash
+
+    // Forward declarations
+    template <class GC, typename T, class Traits = freezable_hash::traits>
+    class FreezableHashSet;
+
+    template <class GC, typename Key, typename Value, class Traits = freezable_hash::traits>
+    class FreezableHashMap;
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_DETAILS_FREEZABLE_HASH_BASE_H
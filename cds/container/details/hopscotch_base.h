@@ -0,0 +1,275 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_DETAILS_HOPSCOTCH_BASE_H
+#define CDSLIB_CONTAINER_DETAILS_HOPSCOTCH_BASE_H
+
+#include <mutex>
+#include <cds/container/details/base.h>
+#include <cds/opt/compare.h>
+#include <cds/opt/hash.h>
+#include <cds/algo/atomic.h>
+#include <cds/algo/backoff_strategy.h>
+
+namespace cds { namespace container {
+
+    /// \p HopscotchSet and \p HopscotchMap related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace hopscotch {
+
+        /// Hopscotch set/map internal statistics
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter counter_type;   ///< Counter type
+
+            counter_type m_nInsertSuccess;  ///< Count of success inserting
+            counter_type m_nInsertFailed;   ///< Count of failed inserting (the key already exists)
+            counter_type m_nUpdateNew;      ///< Count of new item inserted by \p update()
+            counter_type m_nUpdateExisting; ///< Count of existing item updated by \p update()
+            counter_type m_nUpdateFailed;   ///< Count of failed \p update() call (the key is not found and inserting is not allowed)
+            counter_type m_nEraseSuccess;   ///< Count of success erasing
+            counter_type m_nEraseFailed;    ///< Count of failed erasing (the key is not found)
+            counter_type m_nFindSuccess;    ///< Count of success finding
+            counter_type m_nFindFailed;     ///< Count of failed finding
+            counter_type m_nFindRetry;      ///< Count of lock-free \p find() retries since the segment has been changed while searching
+            counter_type m_nFindFallback;   ///< Count of \p find() that has fallen back to the locked search
+
+            counter_type m_nDisplacement;       ///< Count of inserting that has displaced other items to free a slot in the neighbourhood
+            counter_type m_nDisplacementMove;   ///< Total count of items moved by the displacement
+            counter_type m_nDisplacement1;      ///< Count of displacements by one move
+            counter_type m_nDisplacement2;      ///< Count of displacements by two moves
+            counter_type m_nDisplacement3_4;    ///< Count of displacements by 3 or 4 moves
+            counter_type m_nDisplacement5_8;    ///< Count of displacements by 5..8 moves
+            counter_type m_nDisplacementLong;   ///< Count of displacements by more than 8 moves
+            counter_type m_nDisplacementFailed; ///< Count of failed displacements: no item can be moved closer to the home bucket
+            counter_type m_nDisplacementLockFailed; ///< Count of items not moved since the lock of their segment is busy
+            counter_type m_nInsertRetry;    ///< Count of inserting retries after a displacement failed due to busy segment locks
+            counter_type m_nNoFreeSlot;     ///< Count of inserting that has not found a free bucket in the probe range
+            counter_type m_nResize;         ///< Count of the bucket table resizing
+            counter_type m_nReclaimBatch;   ///< Count of batches of erased items freed after waiting for the lock-free readers
+
+            //@cond
+            void onInsertSuccess()      { ++m_nInsertSuccess;   }
+            void onInsertFailed()       { ++m_nInsertFailed;    }
+            void onUpdateNew()          { ++m_nUpdateNew;       }
+            void onUpdateExisting()     { ++m_nUpdateExisting;  }
+            void onUpdateFailed()       { ++m_nUpdateFailed;    }
+            void onEraseSuccess()       { ++m_nEraseSuccess;    }
+            void onEraseFailed()        { ++m_nEraseFailed;     }
+            void onFindSuccess()        { ++m_nFindSuccess;     }
+            void onFindFailed()         { ++m_nFindFailed;      }
+            void onFindRetry()          { ++m_nFindRetry;       }
+            void onFindFallback()       { ++m_nFindFallback;    }
+
+            void onDisplacement( unsigned int nMoves )
+            {
+                if ( nMoves == 0 )
+                    return;
+                ++m_nDisplacement;
+                m_nDisplacementMove += nMoves;
+                if ( nMoves == 1 )
+                    ++m_nDisplacement1;
+                else if ( nMoves == 2 )
+                    ++m_nDisplacement2;
+                else if ( nMoves <= 4 )
+                    ++m_nDisplacement3_4;
+                else if ( nMoves <= 8 )
+                    ++m_nDisplacement5_8;
+                else
+                    ++m_nDisplacementLong;
+            }
+            void onDisplacementFailed()     { ++m_nDisplacementFailed;      }
+            void onDisplacementLockFailed() { ++m_nDisplacementLockFailed;  }
+            void onInsertRetry()        { ++m_nInsertRetry;     }
+            void onNoFreeSlot()         { ++m_nNoFreeSlot;      }
+            void onResize()             { ++m_nResize;          }
+            void onReclaimBatch()       { ++m_nReclaimBatch;    }
+            //@endcond
+        };
+
+        /// Hopscotch set/map dummy statistics, no overhead
+        struct empty_stat
+        {
+            //@cond
+            void onInsertSuccess()      const {}
+            void onInsertFailed()       const {}
+            void onUpdateNew()          const {}
+            void onUpdateExisting()     const {}
+            void onUpdateFailed()       const {}
+            void onEraseSuccess()       const {}
+            void onEraseFailed()        const {}
+            void onFindSuccess()        const {}
+            void onFindFailed()         const {}
+            void onFindRetry()          const {}
+            void onFindFallback()       const {}
+            void onDisplacement( unsigned int ) const {}
+            void onDisplacementFailed()     const {}
+            void onDisplacementLockFailed() const {}
+            void onInsertRetry()        const {}
+            void onNoFreeSlot()         const {}
+            void onResize()             const {}
+            void onReclaimBatch()       const {}
+            //@endcond
+        };
+
+        /// Option specifying the neighbourhood size \p H
+        /**
+            An item is always stored in one of \p H buckets starting from its home bucket.
+            The neighbourhood of a bucket is described by \p H -bit bitmap, so \p H may be from 4 to 64.
+            Default is 32.
+        */
+        template <unsigned int H>
+        struct neighbourhood
+        {
+            //@cond
+            template <typename Base>
+            struct pack: public Base {
+                static constexpr const unsigned int neighbourhood_size = H;
+            };
+            //@endcond
+        };
+
+        /// Hopscotch set/map default traits
+        struct traits
+        {
+            /// Hash functor
+            /**
+                No default functor is provided, you should provide your own one.
+                The home bucket is selected by the low bits of the hash value.
+            */
+            typedef opt::none       hash;
+
+            /// Key equality functor
+            /**
+                Default is <tt>std::equal_to<T></tt>
+            */
+            typedef opt::none       equal_to;
+
+            /// Key comparison functor
+            /**
+                No default functor is provided. If \p equal_to is not specified, \p compare is used for the key equality.
+            */
+            typedef opt::none       compare;
+
+            /// Specifies binary predicate used for key comparison.
+            /**
+                If neither \p equal_to nor \p compare is specified, \p less is used for the key equality.
+            */
+            typedef opt::none       less;
+
+            /// Lock type of a segment
+            /**
+                The bucket table is split into the segments of adjacent buckets, each segment is protected by
+                a lock of \p cds::sync::lock_array. The lock is never acquired recursively.
+                Default is \p std::mutex.
+            */
+            typedef std::mutex      lock_type;
+
+            /// Allocator for the bucket tables and the lock array
+            typedef CDS_DEFAULT_ALLOCATOR   allocator;
+
+            /// Node allocator type
+            /**
+                If this type is not set explicitly, the \ref allocator type is used.
+            */
+            typedef opt::none       node_allocator;
+
+            /// Item counter
+            /**
+                Default is \p cds::atomicity::item_counter
+            */
+            typedef cds::atomicity::item_counter    item_counter;
+
+            /// Back-off strategy for the retries of lock-free \p find() and of inserting
+            typedef cds::backoff::Default   back_off;
+
+            /// Neighbourhood size \p H, see \p hopscotch::neighbourhood option
+            static constexpr const unsigned int neighbourhood_size = 32;
+
+            /// Internal statistics, possible types: \p hopscotch::stat, \p hopscotch::empty_stat (the default)
+            typedef empty_stat      stat;
+        };
+
+        /// Metafunction converting option list to \p hopscotch::traits
+        /**
+            Supported \p Options are:
+            - \p opt::hash - hash functor. No default functor is provided, you should provide your own one.
+            - \p opt::equal_to - key equality functor. Default is \p std::equal_to<T>.
+            - \p opt::compare - key comparison functor, used for the key equality if \p %opt::equal_to is not specified.
+            - \p opt::less - predicate used for the key equality if neither \p %opt::equal_to nor \p %opt::compare is specified.
+            - \p opt::lock_type - lock type of a segment. Default is \p std::mutex.
+            - \p opt::allocator - allocator for the bucket tables and the lock array. Default is \ref CDS_DEFAULT_ALLOCATOR
+            - \p opt::node_allocator - allocator for the items. If this option is not specified, \p %opt::allocator is used.
+            - \p opt::item_counter - the type of item counting feature. Default is \p cds::atomicity::item_counter.
+            - \p opt::back_off - back-off strategy for the retries. Default is \p cds::backoff::Default
+            - \p hopscotch::neighbourhood - neighbourhood size \p H. Default is 32.
+            - \p opt::stat - internal statistics. Possible types: \p hopscotch::stat, \p hopscotch::empty_stat (the default)
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                , Options...
+            >::type type;
+#   endif
+        };
+
+        //@cond
+        namespace details {
+
+            // Hash functor of HopscotchMap: the hash of a pair is the hash of its key
+            template <typename Pair, typename Hash>
+            struct map_hash: public Hash
+            {
+                map_hash()
+                {}
+
+                map_hash( Hash const& h )
+                    : Hash( h )
+                {}
+
+                template <typename Q>
+                size_t operator()( Q const& key ) const
+                {
+                    return Hash::operator()( key );
+                }
+
+                size_t operator()( Pair const& v ) const
+                {
+                    return Hash::operator()( v.first );
+                }
+            };
+
+            // Predicate of HopscotchMap: compares the key of a pair with the key
+            template <typename Pair, typename EqualTo>
+            struct map_key_equal_to
+            {
+                template <typename Q>
+                bool operator()( Pair const& v, Q const& key ) const
+                {
+                    return EqualTo()( v.first, key );
+                }
+            };
+
+        } // namespace details
+        //@endcond
+
+    } // namespace hopscotch
+
+    // Forward declarations
+    template <typename T, class Traits = hopscotch::traits>
+    class HopscotchSet;
+
+    template <typename Key, typename Value, class Traits = hopscotch::traits>
+    class HopscotchMap;
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_DETAILS_HOPSCOTCH_BASE_H
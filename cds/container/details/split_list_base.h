@@ -28,12 +28,17 @@ namespace cds { namespace container {
         template <bool Value>
         using dynamic_bucket_table = cds::intrusive::split_list::dynamic_bucket_table<Value>;
 
+        /// Bucket table shrink factor = typedef for \p intrusive::split_list::shrink_factor
+        template <size_t Value>
+        using shrink_factor = cds::intrusive::split_list::shrink_factor<Value>;
+
         /// @copydoc cds::intrusive::split_list::bit_reversal
         template <typename Type>
         using bit_reversal = cds::intrusive::split_list::bit_reversal<Type>;
 
         using cds::intrusive::split_list::static_bucket_table;
         using cds::intrusive::split_list::expandable_bucket_table;
+        using cds::intrusive::split_list::shrinkable_bucket_table;
 
         //@cond
         namespace details {
@@ -0,0 +1,225 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_DETAILS_SPRAY_LIST_BASE_H
+#define CDSLIB_CONTAINER_DETAILS_SPRAY_LIST_BASE_H
+
+#include <cds/container/details/skip_list_base.h>
+#include <cds/container/details/make_skip_list_set.h>
+
+namespace cds { namespace container {
+
+    /// SprayList related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace spray_list {
+
+        /// SprayList internal statistics
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter counter_type;   ///< Event counter type
+
+            counter_type    m_nPush;            ///< Count of push operations
+            counter_type    m_nPop;             ///< Count of success pop operations
+            counter_type    m_nPopEmpty;        ///< Count of pop operations from empty queue
+            counter_type    m_nSprayPop;        ///< Count of items popped by the spray walk (relaxed mode)
+            counter_type    m_nSprayFailed;     ///< Count of spray walks landed on the head or on a deleted node
+            counter_type    m_nPrefixUnlink;    ///< Count of physical deletions of the logically deleted prefix
+            counter_type    m_nPrefixUnlinkNode;///< Count of nodes unlinked by the prefix deletions
+
+            //@cond
+            void onPush()           { ++m_nPush; }
+            void onPop()            { ++m_nPop; }
+            void onPopEmpty()       { ++m_nPopEmpty; }
+            void onSprayPop()       { ++m_nSprayPop; }
+            void onSprayFailed()    { ++m_nSprayFailed; }
+            void onPrefixUnlink( size_t nCount )
+            {
+                ++m_nPrefixUnlink;
+                m_nPrefixUnlinkNode += nCount;
+            }
+            //@endcond
+        };
+
+        /// SprayList dummy statistics, no overhead
+        struct empty_stat
+        {
+            //@cond
+            void onPush()           const {}
+            void onPop()            const {}
+            void onPopEmpty()       const {}
+            void onSprayPop()       const {}
+            void onSprayFailed()    const {}
+            void onPrefixUnlink( size_t ) const {}
+            //@endcond
+        };
+
+        /// Option setter: enables relaxed SprayList mode of \p pop()
+        template <bool Enable>
+        struct relaxed {
+            //@cond
+            template <class Base> struct pack: public Base
+            {
+                static constexpr const bool relaxed = Enable;
+            };
+            //@endcond
+        };
+
+        /// Option setter: the length of the logically deleted prefix that triggers its physical deletion
+        template <size_t Offset>
+        struct bound_offset {
+            //@cond
+            template <class Base> struct pack: public Base
+            {
+                static constexpr const size_t bound_offset = Offset;
+            };
+            //@endcond
+        };
+
+        /// SprayList traits
+        struct traits
+        {
+            /// Priority compare functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+            */
+            typedef opt::none                       compare;
+
+            /// Specifies binary predicate used for priority comparing.
+            /**
+                Default is \p std::less<T>.
+            */
+            typedef opt::none                       less;
+
+            /// Relaxed mode of \p pop()
+            /**
+                If \p false (the default), \p pop() removes the item with the highest priority (Lindén-Jonsson algorithm).
+                If \p true, \p pop() removes a random item among <tt>O( P * log^3 P )</tt> first items (SprayList algorithm).
+            */
+            static constexpr const bool relaxed = false;
+
+            /// The length of the logically deleted prefix of the list that triggers its physical deletion
+            static constexpr const size_t bound_offset = 32;
+
+            /// C++ memory ordering model
+            /**
+                List of available memory ordering see \p opt::memory_model
+            */
+            typedef opt::v::relaxed_ordering        memory_model;
+
+            /// Random level generator of the underlying skip-list, see \p skip_list::random_level_generator
+            typedef skip_list::turbo32              random_level_generator;
+
+            /// Copy policy
+            /**
+                The copy policy used in \p SprayList::pop() function to copy item's value.
+                The item cannot be moved since other threads can read it while searching the skip-list.
+                Default is \p opt::v::assignment_copy_policy.
+            */
+            typedef cds::opt::v::assignment_copy_policy copy_policy;
+
+            /// Allocator for skip-list nodes, \p std::allocator interface
+            typedef CDS_DEFAULT_ALLOCATOR           allocator;
+
+            /// back-off strategy, default is \p cds::backoff::Default
+            typedef cds::backoff::Default           back_off;
+
+            /// Internal statistics, by default disabled. To enable, use \p spray_list::stat
+            typedef empty_stat                      stat;
+
+            /// RCU deadlock checking policy (for RCU-based SprayList)
+            /**
+                List of available options see opt::rcu_check_deadlock
+            */
+            typedef opt::v::rcu_throw_deadlock      rcu_check_deadlock;
+        };
+
+        /// Metafunction converting option list to SprayList traits
+        /**
+            \p Options are:
+            - \p opt::compare - priority compare functor. No default functor is provided.
+                If the option is not specified, the \p opt::less is used.
+            - \p opt::less - specifies binary predicate used for priority compare. Default is \p std::less<T>.
+            - \p spray_list::relaxed - enables relaxed SprayList mode of \p pop(). Default is \p false.
+            - \p spray_list::bound_offset - the length of the logically deleted prefix that triggers its physical deletion.
+                Default is 32.
+            - \p opt::memory_model - C++ memory ordering model. Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
+                or \p opt::v::sequential_consistent (sequentially consisnent memory model).
+            - \p skip_list::random_level_generator - random level generator. Default is \p %skip_list::turbo32.
+            - \p opt::copy_policy - the policy used in \p SprayList::pop() to copy item's value. Default is \p opt::v::assignment_copy_policy.
+            - \p opt::allocator - allocator for skip-list node. Default is \ref CDS_DEFAULT_ALLOCATOR.
+            - \p opt::back_off - back-off strategy used. If the option is not specified, the \p cds::backoff::Default is used.
+            - \p opt::stat - internal statistics. Available types: \p spray_list::stat, \p spray_list::empty_stat (the default)
+            - \p opt::rcu_check_deadlock - a deadlock checking policy for RCU-based SprayList.
+                Default is \p opt::v::rcu_throw_deadlock
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+    } // namespace spray_list
+
+    //@cond
+    namespace details {
+
+        template <typename GC, typename T, typename Traits>
+        struct make_spray_list
+        {
+            typedef GC      gc;
+            typedef T       value_type;
+            typedef Traits  traits;
+
+            typedef make_skip_list_set< gc, value_type, traits > set_maker;
+
+            typedef typename set_maker::node_type           node_type;
+            typedef typename set_maker::node_allocator      node_allocator;
+            typedef typename set_maker::node_deallocator    node_deallocator;
+            typedef typename set_maker::key_comparator      key_comparator;
+
+            // The skip-list is sorted in descending order of priority, so the item with the highest priority is the first one.
+            // Equal priorities are ordered by node address, so the underlying set can contain equal items
+            struct node_compare
+            {
+                int operator()( node_type const& n1, node_type const& n2 ) const
+                {
+                    int nCmp = key_comparator()( n2.m_Value, n1.m_Value );
+                    if ( nCmp != 0 )
+                        return nCmp;
+                    return std::less<node_type const*>()( &n1, &n2 ) ? -1 : std::less<node_type const*>()( &n2, &n1 ) ? 1 : 0;
+                }
+            };
+
+            class intrusive_traits: public cds::intrusive::skip_list::make_traits<
+                cds::intrusive::opt::hook< intrusive::skip_list::base_hook< cds::opt::gc< gc > > >
+                ,cds::intrusive::opt::disposer< node_deallocator >
+                ,cds::intrusive::skip_list::internal_node_builder< typename set_maker::dummy_node_builder >
+                ,cds::opt::compare< node_compare >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cds::opt::memory_model< typename traits::memory_model >
+                ,cds::opt::back_off< typename traits::back_off >
+                ,cds::opt::allocator< typename traits::allocator >
+                ,cds::intrusive::skip_list::random_level_generator< typename traits::random_level_generator >
+                ,cds::opt::rcu_check_deadlock< typename traits::rcu_check_deadlock >
+            >::type
+            {};
+
+            typedef cds::intrusive::SkipListSet< gc, node_type, intrusive_traits > type;
+        };
+
+    } // namespace details
+    //@endcond
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_DETAILS_SPRAY_LIST_BASE_H
@@ -0,0 +1,334 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_DETAILS_SWISS_HASH_BASE_H
+#define CDSLIB_CONTAINER_DETAILS_SWISS_HASH_BASE_H
+
+#include <cds/container/details/base.h>
+#include <cds/opt/compare.h>
+#include <cds/opt/hash.h>
+#include <cds/algo/atomic.h>
+#include <cds/algo/backoff_strategy.h>
+#include <cds/algo/bitop.h>
+#include <cds/sync/spinlock.h>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#   define CDS_SWISS_HASH_SSE2
+#   include <emmintrin.h>
+#endif
+
+namespace cds { namespace container {
+
+    /// \p SwissHashMap related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace swiss_hash {
+
+        /// Swiss hash map internal statistics
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter counter_type;   ///< Counter type
+
+            counter_type m_nInsertSuccess;  ///< Count of success inserting
+            counter_type m_nInsertFailed;   ///< Count of failed inserting (the key already exists)
+            counter_type m_nUpdateNew;      ///< Count of new item inserted by \p update()
+            counter_type m_nUpdateExisting; ///< Count of existing item updated by \p update()
+            counter_type m_nUpdateFailed;   ///< Count of failed \p update() call (the key is not found and inserting is not allowed)
+            counter_type m_nEraseSuccess;   ///< Count of success erasing
+            counter_type m_nEraseFailed;    ///< Count of failed erasing (the key is not found)
+            counter_type m_nFindSuccess;    ///< Count of success finding
+            counter_type m_nFindFailed;     ///< Count of failed finding
+            counter_type m_nFindRetry;      ///< Count of find retries since the table has been replaced while searching
+            counter_type m_nSlotRace;       ///< Count of failed slot reservations due to concurrent inserting
+            counter_type m_nSealedRetry;    ///< Count of insert retries since the group found has been sealed by the migration
+            counter_type m_nMigrateWait;    ///< Count of migration waits for the slot being published by an inserter
+            counter_type m_nBudgetExhausted; ///< Count of inserts that have finished the migration first since the new table has no more slots for new items
+            counter_type m_nItemMoved;      ///< Count of items moved from the predecessor table
+            counter_type m_nGroupMigrated;  ///< Count of groups migrated from the predecessor table
+            counter_type m_nGrow;           ///< Count of table growing (the table size is doubled)
+            counter_type m_nRehash;         ///< Count of same-size rehashing that drops the tombstones
+
+            //@cond
+            void onInsertSuccess()      { ++m_nInsertSuccess;   }
+            void onInsertFailed()       { ++m_nInsertFailed;    }
+            void onUpdateNew()          { ++m_nUpdateNew;       }
+            void onUpdateExisting()     { ++m_nUpdateExisting;  }
+            void onUpdateFailed()       { ++m_nUpdateFailed;    }
+            void onEraseSuccess()       { ++m_nEraseSuccess;    }
+            void onEraseFailed()        { ++m_nEraseFailed;     }
+            void onFindSuccess()        { ++m_nFindSuccess;     }
+            void onFindFailed()         { ++m_nFindFailed;      }
+            void onFindRetry()          { ++m_nFindRetry;       }
+            void onSlotRace()           { ++m_nSlotRace;        }
+            void onSealedRetry()        { ++m_nSealedRetry;     }
+            void onMigrateWait()        { ++m_nMigrateWait;     }
+            void onBudgetExhausted()    { ++m_nBudgetExhausted; }
+            void onItemMoved()          { ++m_nItemMoved;       }
+            void onGroupMigrated()      { ++m_nGroupMigrated;   }
+            void onGrow()               { ++m_nGrow;            }
+            void onRehash()             { ++m_nRehash;          }
+            //@endcond
+        };
+
+        /// Swiss hash map dummy statistics, no overhead
+        struct empty_stat
+        {
+            //@cond
+            void onInsertSuccess()      const {}
+            void onInsertFailed()       const {}
+            void onUpdateNew()          const {}
+            void onUpdateExisting()     const {}
+            void onUpdateFailed()       const {}
+            void onEraseSuccess()       const {}
+            void onEraseFailed()        const {}
+            void onFindSuccess()        const {}
+            void onFindFailed()         const {}
+            void onFindRetry()          const {}
+            void onSlotRace()           const {}
+            void onSealedRetry()        const {}
+            void onMigrateWait()        const {}
+            void onBudgetExhausted()    const {}
+            void onItemMoved()          const {}
+            void onGroupMigrated()      const {}
+            void onGrow()               const {}
+            void onRehash()             const {}
+            //@endcond
+        };
+
+        /// Swiss hash map default traits
+        struct traits
+        {
+            /// Hash function
+            /**
+                Hash function converts the key into value of type \p size_t.
+                No default functor is provided, you should provide your own one.
+                The map mixes the hash value, so an identity hash like \p std::hash<size_t> is acceptable.
+            */
+            typedef opt::none       hash;
+
+            /// Key comparison functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+            */
+            typedef opt::none       compare;
+
+            /// Specifies binary predicate used for key compare.
+            /**
+                Default is \p std::less<Key>.
+            */
+            typedef opt::none       less;
+
+            /// Allocator for the items and the tables
+            typedef CDS_DEFAULT_ALLOCATOR   allocator;
+
+            /// Item counter
+            /**
+                The item counting is mandatory: the table grows depending on the item count.
+                Use \p cds::atomicity::item_counter (the default) or \p cds::atomicity::cache_friendly_item_counter.
+            */
+            typedef cds::atomicity::item_counter    item_counter;
+
+            /// Back-off strategy for the slot reservation retries
+            typedef cds::backoff::empty     back_off;
+
+            /// Lock type for the writer lock striping
+            /**
+                The writers of the same key are serialized by the lock of the stripe selected by the key hash.
+                The readers never lock. Default is \p cds::sync::spin.
+            */
+            typedef cds::sync::spin         lock_type;
+
+            /// Use SSE2 instructions to match the control bytes of a group
+            /**
+                If \p true (the default) and SSE2 is available for the target, 16 control bytes of a group
+                are matched by one SSE2 compare. Otherwise, the portable SWAR matching on 64-bit words is used.
+            */
+            static constexpr const bool simd = true;
+
+            /// Internal statistics, possible types: \p swiss_hash::stat, \p swiss_hash::empty_stat (the default)
+            typedef empty_stat              stat;
+        };
+
+        /// Metafunction converting option list to \p swiss_hash::traits
+        /**
+            Supported \p Options are:
+            - \p opt::hash - hash functor. No default functor is provided, you should provide your own one.
+            - \p opt::compare - key comparison functor. No default functor is provided.
+                If the option is not specified, the \p opt::less is used.
+            - \p opt::less - specifies binary predicate used for key comparison. Default is \p std::less<Key>.
+            - \p opt::allocator - allocator for the items and the tables. Default is \ref CDS_DEFAULT_ALLOCATOR
+            - \p opt::item_counter - the type of item counting feature. Default is \p cds::atomicity::item_counter.
+                \p cds::atomicity::empty_item_counter is not allowed since the resizing depends on the item count.
+            - \p opt::back_off - back-off strategy for the retries. Default is \p cds::backoff::empty
+            - \p opt::lock_type - lock type for the writer lock striping. Default is \p cds::sync::spin
+            - \p opt::stat - internal statistics. Possible types: \p swiss_hash::stat, \p swiss_hash::empty_stat (the default)
+
+            To switch the SSE2 matching off, derive your traits from the result and set \p simd to \p false.
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                , Options...
+            >::type type;
+#   endif
+        };
+
+        //@cond
+        namespace details {
+
+            // Control byte states. The high bit is zero for a full slot: its control byte is 7 bits of the hash (H2)
+            enum ctrl_byte: uint8_t {
+                ctrl_empty   = 0x80,    // never used; stops the probing
+                ctrl_sealed  = 0x81,    // empty slot sealed by the migration; stops the probing
+                ctrl_busy    = 0xFD,    // reserved by an inserter, the item is being published
+                ctrl_deleted = 0xFE,    // tombstone
+                ctrl_moved   = 0xFF     // the item has been moved to the successor table
+            };
+
+            static constexpr const unsigned c_nGroupWidth = 16;
+
+            static constexpr uint64_t const c_nLsb = 0x0101010101010101ULL;
+            static constexpr uint64_t const c_nLow7 = 0x7F7F7F7F7F7F7F7FULL;
+
+            // Bit i of the result is set if byte i of w is equal to b
+            static inline unsigned swar_match( uint64_t w, uint8_t b )
+            {
+                uint64_t const x = w ^ ( c_nLsb * b );
+                uint64_t const t = ~((( x & c_nLow7 ) + c_nLow7 ) | x | c_nLow7 );
+                return static_cast<unsigned>((( t >> 7 ) * 0x0102040810204080ULL ) >> 56 );
+            }
+
+            // 16 control bytes of a group stored in two words, so the bytes are changed by word CAS
+            struct group_ctrl
+            {
+                atomics::atomic<uint64_t> m_Word[2];
+
+                group_ctrl()
+                {
+                    m_Word[0].store( c_nLsb * ctrl_empty, atomics::memory_order_relaxed );
+                    m_Word[1].store( c_nLsb * ctrl_empty, atomics::memory_order_relaxed );
+                }
+
+                uint8_t get( unsigned i ) const
+                {
+                    return static_cast<uint8_t>( m_Word[i >> 3].load( atomics::memory_order_acquire ) >> (( i & 7 ) * 8 ));
+                }
+
+                bool cas( unsigned i, uint8_t expected, uint8_t desired )
+                {
+                    atomics::atomic<uint64_t>& w = m_Word[i >> 3];
+                    unsigned const nShift = ( i & 7 ) * 8;
+                    uint64_t cur = w.load( atomics::memory_order_relaxed );
+                    while ( static_cast<uint8_t>( cur >> nShift ) == expected ) {
+                        uint64_t const nNew = ( cur & ~( uint64_t( 0xFF ) << nShift )) | ( uint64_t( desired ) << nShift );
+                        if ( w.compare_exchange_weak( cur, nNew, atomics::memory_order_acq_rel, atomics::memory_order_relaxed ))
+                            return true;
+                    }
+                    return false;
+                }
+            };
+
+            // Snapshot of the control bytes of a group
+            template <bool SIMD>
+            struct group_snapshot
+            {
+                uint64_t m_nLo;
+                uint64_t m_nHi;
+
+                explicit group_snapshot( group_ctrl const& g )
+                    : m_nLo( g.m_Word[0].load( atomics::memory_order_acquire ))
+                    , m_nHi( g.m_Word[1].load( atomics::memory_order_acquire ))
+                {}
+
+                unsigned match( uint8_t b ) const
+                {
+                    return swar_match( m_nLo, b ) | ( swar_match( m_nHi, b ) << 8 );
+                }
+            };
+
+#ifdef CDS_SWISS_HASH_SSE2
+            template <>
+            struct group_snapshot<true>
+            {
+                __m128i m_Ctrl;
+
+                explicit group_snapshot( group_ctrl const& g )
+                    : m_Ctrl( _mm_set_epi64x(
+                        static_cast<long long>( g.m_Word[1].load( atomics::memory_order_acquire )),
+                        static_cast<long long>( g.m_Word[0].load( atomics::memory_order_acquire ))))
+                {}
+
+                unsigned match( uint8_t b ) const
+                {
+                    return static_cast<unsigned>( _mm_movemask_epi8( _mm_cmpeq_epi8( m_Ctrl, _mm_set1_epi8( static_cast<char>( b )))));
+                }
+            };
+#endif
+
+            template <bool SIMD>
+            struct group_matcher: public group_snapshot<SIMD>
+            {
+                explicit group_matcher( group_ctrl const& g )
+                    : group_snapshot<SIMD>( g )
+                {}
+
+                // Slots that stop the probing
+                unsigned match_stop() const
+                {
+                    return this->match( ctrl_empty ) | this->match( ctrl_sealed );
+                }
+
+                // Slots available for inserting
+                unsigned match_free() const
+                {
+                    return this->match( ctrl_empty ) | this->match( ctrl_deleted );
+                }
+            };
+
+            // Scrambles the user hash: H1 (group index) is taken from the high bits, H2 from the low 7 bits
+            static inline size_t mix_hash( size_t h )
+            {
+#if CDS_BUILD_BITS == 64
+                h ^= h >> 33;
+                h *= 0xff51afd7ed558ccdULL;
+                h ^= h >> 33;
+                h *= 0xc4ceb9fe1a85ec53ULL;
+                h ^= h >> 33;
+#else
+                h ^= h >> 16;
+                h *= 0x85ebca6b;
+                h ^= h >> 13;
+                h *= 0xc2b2ae35;
+                h ^= h >> 16;
+#endif
+                return h;
+            }
+
+            // Group count for nCapacity items: the table is at most 7/8 full
+            static inline size_t initial_group_count( size_t nCapacity )
+            {
+                size_t nGroupCount = ( nCapacity * 8 / 7 + c_nGroupWidth - 1 ) / c_nGroupWidth;
+                if ( nGroupCount < 2 )
+                    nGroupCount = 2;
+                return size_t( 1 ) << cds::bitop::MSBnz( nGroupCount * 2 - 1 );
+            }
+
+        } // namespace details
+        //@endcond
+
+    } // namespace swiss_hash
+
+    // Forward declarations
+    template <class GC, typename Key, typename Value, class Traits = swiss_hash::traits>
+    class SwissHashMap;
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_DETAILS_SWISS_HASH_BASE_H
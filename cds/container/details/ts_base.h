@@ -0,0 +1,243 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_DETAILS_TS_BASE_H
+#define CDSLIB_CONTAINER_DETAILS_TS_BASE_H
+
+#include <chrono>
+#include <cds/container/details/base.h>
+#include <cds/algo/atomic.h>
+#include <cds/algo/backoff_strategy.h>
+#include <cds/algo/thread_index.h>
+
+#if CDS_COMPILER == CDS_COMPILER_MSVC && ( CDS_PROCESSOR_ARCH == CDS_PROCESSOR_X86 || CDS_PROCESSOR_ARCH == CDS_PROCESSOR_AMD64 )
+#   include <intrin.h>  // __rdtsc
+#endif
+
+namespace cds { namespace container {
+
+    /// Timestamped containers (\p TSStack, \p TSQueue) related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace ts {
+
+        /// Timestamp of an item
+        /**
+            The timestamp is an interval <tt>[nStart, nEnd]</tt>. The item \p a is older than the item \p b
+            if <tt>a.nEnd < b.nStart</tt>. The items with overlapping intervals are unordered:
+            they have been inserted concurrently, so any of them may be removed first.
+        */
+        struct stamp
+        {
+            uint64_t    nStart; ///< Start of timestamp interval
+            uint64_t    nEnd;   ///< End of timestamp interval
+        };
+
+        /// Checks if the timestamp \p s1 precedes the timestamp \p s2
+        static inline bool is_before( stamp const& s1, stamp const& s2 )
+        {
+            return s1.nEnd < s2.nStart;
+        }
+
+        /// Reads hardware time-stamp counter
+        /**
+            On x86 and amd64 the function returns \p rdtsc value, otherwise it falls back to
+            \p std::chrono::steady_clock.
+        */
+        static inline uint64_t hardware_clock()
+        {
+#if ( CDS_COMPILER == CDS_COMPILER_GCC || CDS_COMPILER == CDS_COMPILER_CLANG ) && ( CDS_PROCESSOR_ARCH == CDS_PROCESSOR_X86 || CDS_PROCESSOR_ARCH == CDS_PROCESSOR_AMD64 )
+            return __builtin_ia32_rdtsc();
+#elif CDS_COMPILER == CDS_COMPILER_MSVC && ( CDS_PROCESSOR_ARCH == CDS_PROCESSOR_X86 || CDS_PROCESSOR_ARCH == CDS_PROCESSOR_AMD64 )
+            return __rdtsc();
+#else
+            return static_cast<uint64_t>( std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+        }
+
+        /// Timestamping algorithm based on shared atomic counter
+        /**
+            Each item gets unique timestamp from the shared counter incremented by atomic \p fetch_add.
+            The order of the items is strict, but the counter is a point of contention
+            for the inserting threads.
+        */
+        class atomic_counter
+        {
+        public:
+            //@cond
+            atomic_counter()
+                : m_nCounter( 0 )
+            {}
+
+            stamp get()
+            {
+                uint64_t const n = m_nCounter.fetch_add( 1, atomics::memory_order_relaxed ) + 1;
+                return stamp{ n, n };
+            }
+
+            uint64_t now() const
+            {
+                return m_nCounter.load( atomics::memory_order_relaxed );
+            }
+            //@endcond
+
+        private:
+            atomics::atomic<uint64_t> m_nCounter;
+        };
+
+        /// Timestamping algorithm based on hardware time-stamp counter
+        /**
+            The timestamp of an item is the value of \p hardware_clock(), no shared data is modified.
+            The algorithm requires the time-stamp counter to be synchronized between the processor cores
+            (invariant TSC on modern x86).
+        */
+        class hardware_counter
+        {
+        public:
+            //@cond
+            stamp get() const
+            {
+                uint64_t const n = hardware_clock();
+                return stamp{ n, n };
+            }
+
+            uint64_t now() const
+            {
+                return hardware_clock();
+            }
+            //@endcond
+        };
+
+        /// Timestamping algorithm based on intervals of hardware time-stamp counter
+        /**
+            The timestamp of an item is the interval between two reads of \p hardware_clock()
+            separated by \p Delay pauses. The items with overlapping intervals are unordered,
+            so the wider interval is, the more freedom the remover has: the concurrent removers
+            select different items more often. The interval also covers out-of-order execution of \p rdtsc.
+
+            This is the timestamping algorithm recommended by the authors of timestamped containers.
+        */
+        template <unsigned Delay = 0>
+        class hardware_interval
+        {
+        public:
+            //@cond
+            stamp get() const
+            {
+                stamp s;
+                s.nStart = hardware_clock();
+                for ( unsigned i = 0; i < Delay; ++i )
+                    cds::backoff::pause()();
+                s.nEnd = hardware_clock();
+                return s;
+            }
+
+            uint64_t now() const
+            {
+                return hardware_clock();
+            }
+            //@endcond
+        };
+
+        /// Timestamped container internal statistics
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter counter_type;   ///< Counter type
+
+            counter_type m_nPush;       ///< Count of push operations
+            counter_type m_nPushRace;   ///< Count of push retries due to concurrent modification of the thread's buffer
+            counter_type m_nPop;        ///< Count of successful pop operations
+            counter_type m_nPopEmpty;   ///< Count of pop operations when the container is empty
+            counter_type m_nPopRetry;   ///< Count of pop retries when the item chosen is removed by another thread
+            counter_type m_nEliminated; ///< Count of items popped by elimination: the item is inserted after the pop has been started (\p TSStack only)
+
+            //@cond
+            void onPush()       { ++m_nPush; }
+            void onPushRace()   { ++m_nPushRace; }
+            void onPop()        { ++m_nPop; }
+            void onPopEmpty()   { ++m_nPopEmpty; }
+            void onPopRetry()   { ++m_nPopRetry; }
+            void onEliminate()  { ++m_nEliminated; }
+            //@endcond
+        };
+
+        /// Timestamped container dummy statistics, no overhead
+        struct empty_stat
+        {
+            //@cond
+            void onPush()       const {}
+            void onPushRace()   const {}
+            void onPop()        const {}
+            void onPopEmpty()   const {}
+            void onPopRetry()   const {}
+            void onEliminate()  const {}
+            //@endcond
+        };
+
+        /// Timestamped container default traits
+        struct traits
+        {
+            /// Node allocator
+            typedef CDS_DEFAULT_ALLOCATOR       allocator;
+
+            /// Back-off strategy for the retries
+            typedef cds::backoff::empty         back_off;
+
+            /// Timestamping algorithm: \p ts::atomic_counter, \p ts::hardware_counter, \p ts::hardware_interval (the default)
+            typedef hardware_interval<>         timestamp;
+
+            /// Item counting feature; by default, disabled. Use \p cds::atomicity::item_counter to enable item counting
+            typedef cds::atomicity::empty_item_counter item_counter;
+
+            /// Internal statistics, possible types: \p ts::stat, \p ts::empty_stat (the default)
+            typedef empty_stat                  stat;
+
+            /// Padding of the thread buffers. Default is \p opt::cache_line_padding
+            enum { padding = opt::cache_line_padding };
+        };
+
+        /// [type-option] Timestamping algorithm
+        /**
+            Possible \p Type are \p ts::atomic_counter, \p ts::hardware_counter, \p ts::hardware_interval
+            or any class with the same interface.
+        */
+        template <typename Type>
+        struct timestamp {
+            //@cond
+            template <class Base> struct pack: public Base
+            {
+                typedef Type timestamp;
+            };
+            //@endcond
+        };
+
+        /// Metafunction converting option list to \p ts::traits
+        /**
+            Supported \p Options are:
+            - \p opt::allocator - allocator used for the nodes. Default is \ref CDS_DEFAULT_ALLOCATOR
+            - \p opt::back_off - back-off strategy for the retries. Default is \p cds::backoff::empty
+            - \p ts::timestamp - timestamping algorithm. Default is \p ts::hardware_interval<>
+            - \p opt::item_counter - the type of item counting feature. Default is \p cds::atomicity::empty_item_counter
+            - \p opt::stat - internal statistics. Possible types: \p ts::stat, \p ts::empty_stat (the default)
+            - \p opt::padding - padding of the thread buffers. Default is \p opt::cache_line_padding
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                , Options...
+            >::type type;
+#   endif
+        };
+
+    } // namespace ts
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_DETAILS_TS_BASE_H
@@ -0,0 +1,308 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_FREEZABLE_HASH_MAP_H
+#define CDSLIB_CONTAINER_FREEZABLE_HASH_MAP_H
+
+#include <cds/container/freezable_hash_set.h>
+
+namespace cds { namespace container {
+
+    /// Lock-free resizable hash map based on freezable buckets
+    /** @ingroup cds_nonintrusive_map
+        @anchor cds_nonintrusive_FreezableHashMap_hp
+
+        Source:
+            - [2014] Yujie Liu, Kunlong Zhang, Michael Spear "Dynamic-Sized Nonblocking Hash Tables"
+
+        The map is a key-value adapter of \p FreezableHashSet; see \p FreezableHashSet for the description
+        of the algorithm. Unlike \p MichaelHashMap, the bucket table of the map grows online and lock-free,
+        so the initial item count given in the constructor is just a hint.
+
+        Template arguments:
+        - \p GC - Garbage collector: \p gc::HP or \p gc::DHP.
+            The map requires \p c_nHazardPtrCount hazard pointers per thread.
+        - \p Key - key type
+        - \p Value - mapped type
+        - \p Traits - map traits, default is \p freezable_hash::traits.
+            Instead of defining \p Traits struct directly you may use option-based syntax with
+            \p freezable_hash::make_traits metafunction.
+            The \p opt::hash, \p opt::compare and \p opt::less options are applied to the key.
+
+        Many of the class function take a key argument of type \p K that in general is not \p key_type.
+        \p key_type and an argument of template type \p K must meet the following requirements:
+        - \p key_type should be constructible from value of type \p K;
+        - the hash functor should be able to calculate correct hash value from argument \p key of type \p K:
+            <tt> hash( key_type(key)) == hash( key ) </tt>
+        - values of type \p key_type and \p K should be comparable
+    */
+    template <
+        class GC,
+        typename Key,
+        typename Value,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = freezable_hash::traits
+#else
+        class Traits
+#endif
+    >
+    class FreezableHashMap
+#ifdef CDS_DOXYGEN_INVOKED
+        : protected FreezableHashSet< GC, std::pair<Key const, Value>, Traits >
+#else
+        : protected FreezableHashSet< GC, std::pair<Key const, Value>, typename freezable_hash::details::make_map_traits< Key, Value, Traits >::type >
+#endif
+    {
+        //@cond
+        typedef FreezableHashSet< GC, std::pair<Key const, Value>, typename freezable_hash::details::make_map_traits< Key, Value, Traits >::type > base_class;
+        //@endcond
+
+    public:
+        typedef GC      gc;             ///< Garbage collector
+        typedef Key     key_type;       ///< Key type
+        typedef Value   mapped_type;    ///< Mapped type
+        typedef Traits  traits;         ///< Map traits
+        typedef std::pair< key_type const, mapped_type > value_type; ///< Key-value pair stored in the map
+
+        typedef typename cds::opt::v::hash_selector< typename traits::hash >::type hash; ///< Hash functor
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator; ///< key comparison functor based on \p opt::compare and \p opt::less option setter.
+#   else
+        typedef typename cds::opt::details::make_comparator< key_type, traits >::type key_comparator;
+#   endif
+        typedef typename traits::allocator      allocator;      ///< Allocator
+        typedef typename traits::item_counter   item_counter;   ///< Item counter type
+        typedef typename traits::back_off       back_off;       ///< Back-off strategy
+        typedef typename traits::stat           stat;           ///< Internal statistics
+
+        static constexpr const size_t c_nHazardPtrCount = base_class::c_nHazardPtrCount; ///< Count of hazard pointer required for the algorithm
+
+    public:
+        /// Initializes the map
+        /**
+            The initial bucket count is <tt>nInitialItemCount / nLoadFactor</tt> rounded up to the nearest power of two.
+            The bucket table doubles when the item count exceeds <tt>bucket_count() * nLoadFactor</tt>.
+        */
+        FreezableHashMap(
+            size_t nInitialItemCount = 1024,    ///< estimation of initial item count in the hash map
+            size_t nLoadFactor = 1              ///< load factor: estimation of max number of items in the bucket
+        ) : base_class( nInitialItemCount, nLoadFactor )
+        {}
+
+        /// Clears the map and destroys it
+        ~FreezableHashMap()
+        {}
+
+        /// Inserts new node with key and default value
+        /**
+            The function creates a node with \p key and default value, and then inserts the node created into the map.
+
+            Preconditions:
+            - The \p key_type should be constructible from value of type \p K.
+            - The \p mapped_type should be default-constructible.
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K>
+        bool insert( K const& key )
+        {
+            return base_class::insert_node( base_class::alloc_item( key_type( key ), mapped_type()), []( value_type& ) {} );
+        }
+
+        /// Inserts new node
+        /**
+            The function creates a node with copy of \p val value
+            and then inserts the node created into the map.
+
+            Preconditions:
+            - The \p key_type should be constructible from \p key of type \p K.
+            - The \p mapped_type should be constructible from \p val of type \p V.
+
+            Returns \p true if \p val is inserted into the map, \p false otherwise.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val )
+        {
+            return base_class::insert_node( base_class::alloc_item( key_type( key ), mapped_type( val )), []( value_type& ) {} );
+        }
+
+        /// Inserts new node and initialize it by a functor
+        /**
+            This function inserts new node with key \p key and if inserting is successful then it calls
+            \p func functor with signature
+            \code
+                struct functor {
+                    void operator()( value_type& item );
+                };
+            \endcode
+
+            The argument \p item of user-defined functor \p func is the reference
+            to the map's item inserted:
+                - <tt>item.first</tt> is a const reference to item's key that cannot be changed.
+                - <tt>item.second</tt> is a reference to item's value that may be changed.
+
+            The user-defined functor is called only if inserting is successful.
+
+            @warning The new item is already visible for other threads when \p func is called,
+            so \p func should take into account the concurrent access to the item.
+        */
+        template <typename K, typename Func>
+        bool insert_with( K const& key, Func func )
+        {
+            return base_class::insert_node( base_class::alloc_item( key_type( key ), mapped_type()), func );
+        }
+
+        /// For key \p key inserts data of type \p mapped_type created from \p args
+        /**
+            \p key_type should be constructible from type \p K
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K, typename... Args>
+        bool emplace( K&& key, Args&&... args )
+        {
+            return base_class::insert_node( base_class::alloc_item( key_type( std::forward<K>( key )), mapped_type( std::forward<Args>( args )... )), []( value_type& ) {} );
+        }
+
+        /// Updates data by \p key
+        /**
+            The operation performs inserting or replacing the element with lock-free manner.
+
+            If the \p key not found in the map, then the new item created from \p key
+            will be inserted into the map iff \p bAllowInsert is \p true.
+            (note that in this case the \ref key_type should be constructible from type \p K).
+            Otherwise, if \p key is found, the functor \p func is called with item found.
+
+            The functor \p func signature is:
+            \code
+                struct my_functor {
+                    void operator()( bool bNew, value_type& item );
+                };
+            \endcode
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - the item found or inserted
+
+            The functor may change any fields of the \p item.second that is \ref mapped_type;
+            however, \p func must guarantee that during changing no any other modifications
+            could be made on this item by concurrent threads.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is true if operation is successful,
+            \p second is true if new item has been added or \p false if the item with \p key
+            already exists.
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> update( K const& key, Func func, bool bAllowInsert = true )
+        {
+            return base_class::update_at( key, base_class::hash_value( key ),
+                [&key]() { return base_class::alloc_item( key_type( key ), mapped_type()); },
+                func, bAllowInsert );
+        }
+
+        /// Deletes \p key from the map
+        /**
+            Return \p true if \p key is found and deleted, \p false otherwise
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            return base_class::erase( key );
+        }
+
+        /// Deletes \p key from the map
+        /**
+            The function searches an item with key \p key, calls \p f functor
+            and deletes the item. If \p key is not found, the functor is not called.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()( value_type& item ) { ... }
+            };
+            \endcode
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename K, typename Func>
+        bool erase( K const& key, Func f )
+        {
+            return base_class::erase( key, f );
+        }
+
+        /// Finds the key \p key
+        /**
+            The function searches the item with key equal to \p key and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            where \p item is the item found.
+
+            The functor may change \p item.second. Note that the functor is only guarantee
+            that \p item cannot be disposed during functor is executing.
+            The functor does not serialize simultaneous access to the map's \p item. If such access is
+            possible you must provide your own synchronization schema on item level to exclude unsafe item modifications.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f )
+        {
+            return base_class::find_at( key, base_class::hash_value( key ), f );
+        }
+
+        /// Checks whether the map contains \p key
+        /**
+            The function searches the item with key equal to \p key
+            and returns \p true if it is found, and \p false otherwise.
+        */
+        template <typename K>
+        bool contains( K const& key )
+        {
+            return base_class::contains( key );
+        }
+
+        /// Clears the map (not atomic)
+        void clear()
+        {
+            base_class::clear();
+        }
+
+        /// Checks if the map is empty
+        bool empty() const
+        {
+            return base_class::empty();
+        }
+
+        /// Returns item count in the map
+        size_t size() const
+        {
+            return base_class::size();
+        }
+
+        /// Returns the size of current bucket table
+        size_t bucket_count() const
+        {
+            return base_class::bucket_count();
+        }
+
+        /// Returns the load factor
+        size_t load_factor() const
+        {
+            return base_class::load_factor();
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return base_class::statistics();
+        }
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_FREEZABLE_HASH_MAP_H
@@ -0,0 +1,888 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_FREEZABLE_HASH_SET_H
+#define CDSLIB_CONTAINER_FREEZABLE_HASH_SET_H
+
+#include <utility>  // std::pair
+#include <cds/container/details/freezable_hash_base.h>
+#include <cds/details/allocator.h>
+#include <cds/details/marked_ptr.h>
+
+namespace cds { namespace container {
+
+    /// Lock-free resizable hash set based on freezable buckets
+    /** @ingroup cds_nonintrusive_set
+        @anchor cds_nonintrusive_FreezableHashSet_hp
+
+        Source:
+            - [2014] Yujie Liu, Kunlong Zhang, Michael Spear "Dynamic-Sized Nonblocking Hash Tables"
+
+        \p MichaelHashSet has a fixed-size bucket table: the bucket count is defined in the constructor
+        and never changes, so the lookup cost grows linearly when the set holds many more items than expected.
+        \p %FreezableHashSet grows its bucket table online and lock-free: no operation waits for the resizing,
+        and the readers never block.
+
+        A bucket is an immutable array of pointers to the items. The bucket is replaced by copy-on-write:
+        \p insert() and \p erase() build new bucket array and CAS it into the bucket slot.
+        When the item count exceeds <tt>bucket_count() * load_factor</tt>, a new bucket table of double size
+        is installed; the old table becomes the predecessor of the new one. The buckets of the new table
+        are uninitialized at the beginning; each bucket is initialized on first access: the source bucket
+        of the predecessor table is frozen, that is, marked as read-only for the writers,
+        and its items are split into the new bucket. So the items are migrated incrementally by the operations
+        on the set; the next resizing completes the migration and frees the predecessor table.
+        The readers look for the item in the predecessor table if the bucket of the current table
+        has not been initialized yet.
+
+        The bucket table never shrinks.
+
+        The set does not support iterators.
+
+        Template arguments:
+        - \p GC - Garbage collector: \p gc::HP or \p gc::DHP.
+            The set requires \p c_nHazardPtrCount hazard pointers per thread.
+        - \p T - type to be stored in the set
+        - \p Traits - set traits, default is \p freezable_hash::traits.
+            Instead of defining \p Traits struct directly you may use option-based syntax with
+            \p freezable_hash::make_traits metafunction:
+            \code
+            typedef cds::container::FreezableHashSet< cds::gc::HP, Foo,
+                typename cds::container::freezable_hash::make_traits<
+                    cds::opt::hash< foo_hash >
+                    ,cds::opt::less< foo_less >
+                    ,cds::opt::stat< cds::container::freezable_hash::stat<> >
+                >::type
+            > myset;
+            \endcode
+
+        The hash functor is mandatory; the \p opt::compare or \p opt::less functor should accept
+        any key type \p Q used for searching: <tt>compare( T const&, Q const& )</tt>.
+    */
+    template <
+        class GC,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = freezable_hash::traits
+#else
+        class Traits
+#endif
+    >
+    class FreezableHashSet
+    {
+    public:
+        typedef GC      gc;             ///< Garbage collector
+        typedef T       value_type;     ///< Type of value to be stored in the set
+        typedef Traits  traits;         ///< Set traits
+
+        typedef typename cds::opt::v::hash_selector< typename traits::hash >::type hash; ///< Hash functor
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator; ///< key comparison functor based on \p opt::compare and \p opt::less option setter.
+#   else
+        typedef typename cds::opt::details::make_comparator< value_type, traits >::type key_comparator;
+#   endif
+        typedef typename traits::allocator      allocator;      ///< Allocator
+        typedef typename traits::item_counter   item_counter;   ///< Item counter type
+        typedef typename traits::back_off       back_off;       ///< Back-off strategy
+        typedef typename traits::stat           stat;           ///< Internal statistics
+
+        static constexpr const size_t c_nHazardPtrCount = 4; ///< Count of hazard pointer required for the algorithm
+
+        static_assert( !std::is_same< item_counter, cds::atomicity::empty_item_counter >::value,
+            "FreezableHashSet requires real item counter since the resizing depends on the item count" );
+
+    protected:
+        //@cond
+        struct item_node
+        {
+            size_t      nHash;
+            value_type  m_Value;
+
+            template <typename... Args>
+            item_node( Args&&... args )
+                : nHash( 0 )
+                , m_Value( std::forward<Args>( args )... )
+            {}
+        };
+
+        struct bucket_cell
+        {
+            size_t      nHash;
+            item_node * pItem;
+        };
+
+        // Immutable array of the items. The hash values are kept in the cells, so scanning the bucket
+        // does not touch the items of other keys that may be already freed
+        struct bucket_node
+        {
+            size_t const    nSize;
+            bucket_cell     cells[1];   // actual size is nSize
+
+            explicit bucket_node( size_t n )
+                : nSize( n )
+            {}
+        };
+
+        // Bucket slot bits
+        enum : int {
+            bucket_initialized = 1,  // the bucket slot is initialized; the empty bucket is nullptr | bucket_initialized
+            bucket_frozen = 2        // the bucket slot is read-only, its items are being migrated to the successor table
+        };
+
+        typedef cds::details::marked_ptr< bucket_node, 3 > marked_bucket;
+        typedef atomics::atomic< marked_bucket > atomic_bucket;
+
+        struct table
+        {
+            size_t const            nSize;      // power of 2
+            atomics::atomic<table *> pPred;     // predecessor table whose buckets are being migrated
+            atomic_bucket           buckets[1]; // actual size is nSize
+
+            table( size_t n, table * pPredecessor )
+                : nSize( n )
+                , pPred( pPredecessor )
+            {}
+        };
+
+        typedef typename std::allocator_traits< allocator >::template rebind_alloc< item_node > item_allocator_type;
+        typedef cds::details::Allocator< item_node, item_allocator_type > cxx_item_allocator;
+        typedef typename std::allocator_traits< allocator >::template rebind_alloc< bucket_node > bucket_allocator_type;
+        typedef cds::details::Allocator< bucket_node, bucket_allocator_type > cxx_bucket_allocator;
+        typedef typename std::allocator_traits< allocator >::template rebind_alloc< table > table_allocator_type;
+        typedef cds::details::Allocator< table, table_allocator_type > cxx_table_allocator;
+
+        struct item_disposer
+        {
+            void operator()( item_node * p ) const
+            {
+                free_item( p );
+            }
+        };
+
+        struct bucket_disposer
+        {
+            void operator()( bucket_node * p ) const
+            {
+                free_bucket( p );
+            }
+        };
+
+        // The items are not freed, they belong to the successor table
+        struct table_disposer
+        {
+            void operator()( table * t ) const
+            {
+                free_table( t );
+            }
+        };
+
+        enum {
+            guard_table,    // current table
+            guard_pred,     // predecessor table
+            guard_bucket,   // bucket array
+            guard_item,     // item
+            guard_count
+        };
+        typedef typename gc::template GuardArray< guard_count > guard_array;
+        //@endcond
+
+    protected:
+        //@cond
+        atomics::atomic<table *>    m_pHead;        // current table
+        size_t const                m_nLoadFactor;
+        item_counter                m_ItemCounter;
+        atomics::atomic<bool>       m_bResizing;
+        mutable stat                m_Stat;
+        //@endcond
+
+    public:
+        /// Initializes the set
+        /**
+            The initial bucket count is <tt>nInitialItemCount / nLoadFactor</tt> rounded up to the nearest power of two.
+            The bucket table doubles when the item count exceeds <tt>bucket_count() * nLoadFactor</tt>.
+        */
+        FreezableHashSet(
+            size_t nInitialItemCount = 1024,    ///< estimation of initial item count in the hash set
+            size_t nLoadFactor = 1              ///< load factor: estimation of max number of items in the bucket
+        ) : m_nLoadFactor( nLoadFactor ? nLoadFactor : 1 )
+          , m_bResizing( false )
+        {
+            table * t = alloc_table( freezable_hash::details::initial_bucket_count( nInitialItemCount, m_nLoadFactor ), nullptr );
+
+            // The buckets of the initial table are empty and initialized
+            for ( size_t i = 0; i < t->nSize; ++i )
+                t->buckets[i].store( marked_bucket( nullptr, bucket_initialized ), atomics::memory_order_relaxed );
+            m_pHead.store( t, atomics::memory_order_release );
+        }
+
+        /// Clears hash set and destroys it
+        ~FreezableHashSet()
+        {
+            table * t = m_pHead.load( atomics::memory_order_relaxed );
+            table * pPred = t->pPred.load( atomics::memory_order_relaxed );
+            if ( pPred ) {
+                // Free the items of not migrated buckets
+                for ( size_t i = 0; i < pPred->nSize; ++i ) {
+                    bucket_node * pBucket = pPred->buckets[i].load( atomics::memory_order_relaxed ).ptr();
+                    if ( pBucket ) {
+                        for ( size_t k = 0; k < pBucket->nSize; ++k ) {
+                            if ( !( bucket_of( t, pBucket->cells[k].nHash ).load( atomics::memory_order_relaxed ).bits() & bucket_initialized ))
+                                free_item( pBucket->cells[k].pItem );
+                        }
+                    }
+                }
+                free_table( pPred );
+            }
+
+            for ( size_t i = 0; i < t->nSize; ++i ) {
+                bucket_node * pBucket = t->buckets[i].load( atomics::memory_order_relaxed ).ptr();
+                if ( pBucket ) {
+                    for ( size_t k = 0; k < pBucket->nSize; ++k )
+                        free_item( pBucket->cells[k].pItem );
+                }
+            }
+            free_table( t );
+        }
+
+        /// Inserts new node
+        /**
+            The function creates a node with copy of \p val value
+            and then inserts the node created into the set.
+
+            The type \p Q should contain as minimum the complete key for the node.
+            The object of \ref value_type should be constructible from a value of type \p Q.
+            In trivial case, \p Q is equal to \ref value_type.
+
+            Returns \p true if \p val is inserted into the set, \p false otherwise.
+        */
+        template <typename Q>
+        bool insert( Q const& val )
+        {
+            return insert_node( alloc_item( val ), []( value_type& ) {} );
+        }
+
+        /// Inserts new node
+        /**
+            The function allows to split creating of new item into two part:
+            - create item with key only
+            - insert new item into the set
+            - if inserting is success, calls  \p f functor to initialize value-fields of \p val.
+
+            The functor signature is:
+            \code
+                void func( value_type& val );
+            \endcode
+            where \p val is the item inserted.
+            The user-defined functor is called only if the inserting is success.
+
+            @warning The new item is already visible for other threads when \p f is called,
+            so \p f should take into account the concurrent access to the item.
+        */
+        template <typename Q, typename Func>
+        bool insert( Q const& val, Func f )
+        {
+            return insert_node( alloc_item( val ), f );
+        }
+
+        /// Inserts data of type \p value_type constructed from \p args
+        /**
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename... Args>
+        bool emplace( Args&&... args )
+        {
+            return insert_node( alloc_item( std::forward<Args>( args )... ), []( value_type& ) {} );
+        }
+
+        /// Updates the element
+        /**
+            The operation performs inserting or changing data with lock-free manner.
+
+            If the item \p val is not found in the set, then \p val is inserted iff \p bAllowInsert is \p true.
+            Otherwise, the functor \p func is called with item found.
+
+            The functor signature is:
+            \code
+                struct my_functor {
+                    void operator()( bool bNew, value_type& item, Q const& val );
+                };
+            \endcode
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - item of the set
+            - \p val - argument \p val passed into the \p %update() function
+
+            The functor may change non-key fields of the \p item; however, \p func must guarantee
+            that during changing no any other modifications could be made on this item by concurrent threads.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is true if operation is successful,
+            \p second is true if new item has been added or \p false if the item with \p key
+            already exists.
+        */
+        template <typename Q, typename Func>
+        std::pair<bool, bool> update( Q const& val, Func func, bool bAllowInsert = true )
+        {
+            return update_at( val, hash_value( val ),
+                [&val]() { return alloc_item( val ); },
+                [&func, &val]( bool bNew, value_type& item ) { func( bNew, item, val ); },
+                bAllowInsert );
+        }
+
+        /// Deletes \p key from the set
+        /**
+            Since the key of \p value_type is not explicitly specified,
+            template parameter \p Q defines the key type searching in the list.
+            The set item comparator should be able to compare the values of type \p value_type
+            and the type \p Q.
+
+            Return \p true if key is found and deleted, \p false otherwise.
+        */
+        template <typename Q>
+        bool erase( Q const& key )
+        {
+            return erase_at( key, hash_value( key ), []( value_type const& ) {} );
+        }
+
+        /// Deletes \p key from the set
+        /**
+            The function searches an item with key \p key, calls \p f functor
+            and deletes the item. If \p key is not found, the functor is not called.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()(value_type& item);
+            };
+            \endcode
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename Q, typename Func>
+        bool erase( Q const& key, Func f )
+        {
+            return erase_at( key, hash_value( key ), f );
+        }
+
+        /// Finds the key \p key
+        /**
+            The function searches the item with key equal to \p key and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item, Q& key );
+            };
+            \endcode
+            where \p item is the item found, \p key is the <tt>find</tt> function argument.
+
+            The functor may change non-key fields of \p item. Note that the functor is only guarantee
+            that \p item cannot be disposed during functor is executing.
+            The functor does not serialize simultaneous access to the set's \p item. If such access is
+            possible you must provide your own synchronization schema on item level to exclude unsafe item modifications.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename Q, typename Func>
+        bool find( Q& key, Func f )
+        {
+            return find_at( key, hash_value( key ), [&f, &key]( value_type& item ) { f( item, key ); } );
+        }
+        //@cond
+        template <typename Q, typename Func>
+        bool find( Q const& key, Func f )
+        {
+            return find_at( key, hash_value( key ), [&f, &key]( value_type& item ) { f( item, key ); } );
+        }
+        //@endcond
+
+        /// Checks whether the set contains \p key
+        /**
+            The function searches the item with key equal to \p key
+            and returns \p true if it is found, and \p false otherwise.
+        */
+        template <typename Q>
+        bool contains( Q const& key )
+        {
+            return find_at( key, hash_value( key ), []( value_type& ) {} );
+        }
+
+        /// Clears the set (not atomic)
+        /**
+            The function unlinks the buckets of the current bucket table one by one.
+            The items inserted concurrently may stay in the set.
+        */
+        void clear()
+        {
+            guard_array guards;
+            table * t = guards.protect( guard_table, m_pHead );
+            for ( size_t i = 0; i < t->nSize; ) {
+                atomic_bucket& b = t->buckets[i];
+                marked_bucket cur = guards.protect( guard_bucket, b, []( marked_bucket p ) { return p.ptr(); } );
+                if ( !( cur.bits() & bucket_initialized )) {
+                    init_bucket( t, i, guards );
+                    continue;
+                }
+                if ( cur.bits() & bucket_frozen ) {
+                    // The table has been grown, start from the new one
+                    t = guards.protect( guard_table, m_pHead );
+                    i = 0;
+                    continue;
+                }
+
+                bucket_node * pBucket = cur.ptr();
+                if ( pBucket ) {
+                    if ( !b.compare_exchange_strong( cur, marked_bucket( nullptr, bucket_initialized ), atomics::memory_order_acq_rel, atomics::memory_order_relaxed ))
+                        continue;
+
+                    m_ItemCounter -= pBucket->nSize;
+                    for ( size_t k = 0; k < pBucket->nSize; ++k )
+                        gc::template retire<item_disposer>( pBucket->cells[k].pItem );
+                    gc::template retire<bucket_disposer>( pBucket );
+                }
+                ++i;
+            }
+        }
+
+        /// Checks if the set is empty
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /// Returns item count in the set
+        size_t size() const
+        {
+            return m_ItemCounter.value();
+        }
+
+        /// Returns the size of current bucket table
+        /**
+            The value grows as the set grows.
+        */
+        size_t bucket_count() const
+        {
+            typename gc::Guard g;
+            return g.protect( m_pHead )->nSize;
+        }
+
+        /// Returns the load factor
+        size_t load_factor() const
+        {
+            return m_nLoadFactor;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        template <typename Q>
+        static size_t hash_value( Q const& key )
+        {
+            return hash()( key );
+        }
+
+        template <typename... Args>
+        static item_node * alloc_item( Args&&... args )
+        {
+            item_node * p = cxx_item_allocator().MoveNew( std::forward<Args>( args )... );
+            p->nHash = hash_value( p->m_Value );
+            return p;
+        }
+
+        static void free_item( item_node * p )
+        {
+            cxx_item_allocator().Delete( p );
+        }
+
+        static bucket_node * alloc_bucket( size_t nSize )
+        {
+            assert( nSize > 0 );
+            return cxx_bucket_allocator().NewBlock( sizeof( bucket_node ) + sizeof( bucket_cell ) * ( nSize - 1 ), nSize );
+        }
+
+        static void free_bucket( bucket_node * p )
+        {
+            if ( p )
+                cxx_bucket_allocator().Delete( p );
+        }
+
+        static void retire_bucket( bucket_node * p )
+        {
+            if ( p )
+                gc::template retire<bucket_disposer>( p );
+        }
+
+        static table * alloc_table( size_t nSize, table * pPred )
+        {
+            table * t = cxx_table_allocator().NewBlock( sizeof( table ) + sizeof( atomic_bucket ) * ( nSize - 1 ), nSize, pPred );
+            for ( size_t i = 0; i < nSize; ++i )
+                new ( &t->buckets[i] ) atomic_bucket( marked_bucket());
+            return t;
+        }
+
+        static void free_table( table * t )
+        {
+            for ( size_t i = 0; i < t->nSize; ++i )
+                free_bucket( t->buckets[i].load( atomics::memory_order_relaxed ).ptr());
+            cxx_table_allocator().Delete( t );
+        }
+
+        static atomic_bucket& bucket_of( table * t, size_t nHash )
+        {
+            return t->buckets[ nHash & ( t->nSize - 1 ) ];
+        }
+
+        enum search_result {
+            search_found,
+            search_not_found,
+            search_retry        // the bucket has been changed while the item is being protected
+        };
+
+        // Looks for key in pBucket. The item with equal hash may be removed and freed concurrently,
+        // so it is protected by guard_item and validate() checks that it is still in the set
+        template <typename Q, typename Validator>
+        static search_result search( bucket_node const * pBucket, size_t nHash, Q const& key, size_t& idx, guard_array& guards, Validator validate )
+        {
+            if ( pBucket ) {
+                key_comparator cmp;
+                for ( size_t i = 0; i < pBucket->nSize; ++i ) {
+                    if ( pBucket->cells[i].nHash == nHash ) {
+                        item_node * p = guards.assign( guard_item, pBucket->cells[i].pItem );
+                        if ( !validate())
+                            return search_retry;
+                        if ( cmp( p->m_Value, key ) == 0 ) {
+                            idx = i;
+                            return search_found;
+                        }
+                    }
+                }
+            }
+            return search_not_found;
+        }
+
+        // Copy of pBucket with pItem appended
+        static bucket_node * bucket_with( bucket_node const * pBucket, item_node * pItem )
+        {
+            size_t const nSize = pBucket ? pBucket->nSize : 0;
+            bucket_node * pNew = alloc_bucket( nSize + 1 );
+            for ( size_t i = 0; i < nSize; ++i )
+                pNew->cells[i] = pBucket->cells[i];
+            pNew->cells[nSize].nHash = pItem->nHash;
+            pNew->cells[nSize].pItem = pItem;
+            return pNew;
+        }
+
+        // Copy of pBucket without the item idx; nullptr if the new bucket is empty
+        static bucket_node * bucket_without( bucket_node const * pBucket, size_t idx )
+        {
+            if ( pBucket->nSize == 1 )
+                return nullptr;
+
+            bucket_node * pNew = alloc_bucket( pBucket->nSize - 1 );
+            for ( size_t i = 0, k = 0; i < pBucket->nSize; ++i ) {
+                if ( i != idx )
+                    pNew->cells[k++] = pBucket->cells[i];
+            }
+            return pNew;
+        }
+
+        // The items of pBucket that fall into the bucket idx of the table of size nMask + 1
+        static bucket_node * bucket_split( bucket_node const * pBucket, size_t idx, size_t nMask )
+        {
+            if ( !pBucket )
+                return nullptr;
+
+            size_t nSize = 0;
+            for ( size_t i = 0; i < pBucket->nSize; ++i ) {
+                if (( pBucket->cells[i].nHash & nMask ) == idx )
+                    ++nSize;
+            }
+            if ( nSize == 0 )
+                return nullptr;
+
+            bucket_node * pNew = alloc_bucket( nSize );
+            for ( size_t i = 0, k = 0; i < pBucket->nSize; ++i ) {
+                if (( pBucket->cells[i].nHash & nMask ) == idx )
+                    pNew->cells[k++] = pBucket->cells[i];
+            }
+            return pNew;
+        }
+
+        // Migrates the bucket idx of table t from the predecessor table
+        void init_bucket( table * t, size_t idx, guard_array& guards )
+        {
+            table * pPred = guards.protect( guard_pred, t->pPred );
+            if ( !pPred ) {
+                // The migration is completed, the bucket has been initialized
+                return;
+            }
+
+            // Freeze the source bucket: the writers cannot change it anymore
+            atomic_bucket& src = bucket_of( pPred, idx );
+            marked_bucket cur = src.load( atomics::memory_order_acquire );
+            while ( !( cur.bits() & bucket_frozen )) {
+                // The buckets of the predecessor table have been initialized before the table was grown
+                assert( cur.bits() & bucket_initialized );
+                if ( src.compare_exchange_weak( cur, cur | bucket_frozen, atomics::memory_order_acq_rel, atomics::memory_order_acquire )) {
+                    cur |= bucket_frozen;
+                    break;
+                }
+            }
+
+            // The frozen bucket is immutable and it lives as long as the predecessor table
+            bucket_node * pNew = bucket_split( cur.ptr(), idx, t->nSize - 1 );
+            marked_bucket expected;
+            if ( t->buckets[idx].compare_exchange_strong( expected, marked_bucket( pNew, bucket_initialized ), atomics::memory_order_acq_rel, atomics::memory_order_relaxed ))
+                m_Stat.onBucketInit();
+            else
+                free_bucket( pNew );
+        }
+
+        // Finds the bucket for writing: initialized and not frozen
+        // guard_table protects the table, guard_bucket protects the bucket array
+        atomic_bucket& locate( size_t nHash, guard_array& guards, marked_bucket& cur )
+        {
+            while ( true ) {
+                table * t = guards.protect( guard_table, m_pHead );
+                size_t const idx = nHash & ( t->nSize - 1 );
+                atomic_bucket& b = t->buckets[idx];
+                cur = guards.protect( guard_bucket, b, []( marked_bucket p ) { return p.ptr(); } );
+
+                if ( !( cur.bits() & bucket_initialized ))
+                    init_bucket( t, idx, guards );
+                else if ( cur.bits() & bucket_frozen ) {
+                    // The table has been grown
+                    m_Stat.onFrozenRetry();
+                }
+                else
+                    return b;
+            }
+        }
+
+        template <typename Func>
+        bool insert_node( item_node * pItem, Func f )
+        {
+            guard_array guards;
+            back_off bkoff;
+
+            while ( true ) {
+                marked_bucket cur;
+                atomic_bucket& b = locate( pItem->nHash, guards, cur );
+
+                size_t idx;
+                search_result const res = search( cur.ptr(), pItem->nHash, pItem->m_Value, idx, guards,
+                    [&b, &cur]() { return b.load( atomics::memory_order_acquire ) == cur; } );
+                if ( res == search_retry ) {
+                    m_Stat.onBucketRace();
+                    continue;
+                }
+                if ( res == search_found ) {
+                    free_item( pItem );
+                    m_Stat.onInsertFailed();
+                    return false;
+                }
+
+                // The new item may be removed by another thread just after linking
+                guards.assign( guard_item, pItem );
+                bucket_node * pNew = bucket_with( cur.ptr(), pItem );
+                if ( b.compare_exchange_strong( cur, marked_bucket( pNew, bucket_initialized ), atomics::memory_order_acq_rel, atomics::memory_order_relaxed )) {
+                    retire_bucket( cur.ptr());
+                    ++m_ItemCounter;
+                    m_Stat.onInsertSuccess();
+                    f( pItem->m_Value );
+                    check_grow( guards );
+                    return true;
+                }
+
+                free_bucket( pNew );
+                m_Stat.onBucketRace();
+                bkoff();
+            }
+        }
+
+        template <typename Q, typename Alloc, typename Func>
+        std::pair<bool, bool> update_at( Q const& key, size_t nHash, Alloc alloc, Func func, bool bAllowInsert )
+        {
+            guard_array guards;
+            item_node * pNewItem = nullptr;
+            back_off bkoff;
+
+            while ( true ) {
+                marked_bucket cur;
+                atomic_bucket& b = locate( nHash, guards, cur );
+
+                size_t idx;
+                search_result const res = search( cur.ptr(), nHash, key, idx, guards,
+                    [&b, &cur]() { return b.load( atomics::memory_order_acquire ) == cur; } );
+                if ( res == search_retry ) {
+                    m_Stat.onBucketRace();
+                    continue;
+                }
+                if ( res == search_found ) {
+                    if ( pNewItem )
+                        free_item( pNewItem );
+                    func( false, cur.ptr()->cells[idx].pItem->m_Value );
+                    m_Stat.onUpdateExisting();
+                    return std::make_pair( true, false );
+                }
+
+                if ( !bAllowInsert ) {
+                    m_Stat.onUpdateFailed();
+                    return std::make_pair( false, false );
+                }
+
+                if ( !pNewItem )
+                    pNewItem = alloc();
+                guards.assign( guard_item, pNewItem );
+
+                bucket_node * pNew = bucket_with( cur.ptr(), pNewItem );
+                if ( b.compare_exchange_strong( cur, marked_bucket( pNew, bucket_initialized ), atomics::memory_order_acq_rel, atomics::memory_order_relaxed )) {
+                    retire_bucket( cur.ptr());
+                    ++m_ItemCounter;
+                    m_Stat.onUpdateNew();
+                    func( true, pNewItem->m_Value );
+                    check_grow( guards );
+                    return std::make_pair( true, true );
+                }
+
+                free_bucket( pNew );
+                m_Stat.onBucketRace();
+                bkoff();
+            }
+        }
+
+        template <typename Q, typename Func>
+        bool erase_at( Q const& key, size_t nHash, Func f )
+        {
+            guard_array guards;
+            back_off bkoff;
+
+            while ( true ) {
+                marked_bucket cur;
+                atomic_bucket& b = locate( nHash, guards, cur );
+
+                size_t idx;
+                search_result const res = search( cur.ptr(), nHash, key, idx, guards,
+                    [&b, &cur]() { return b.load( atomics::memory_order_acquire ) == cur; } );
+                if ( res == search_retry ) {
+                    m_Stat.onBucketRace();
+                    continue;
+                }
+                if ( res == search_not_found ) {
+                    m_Stat.onEraseFailed();
+                    return false;
+                }
+
+                item_node * pItem = cur.ptr()->cells[idx].pItem;
+                bucket_node * pNew = bucket_without( cur.ptr(), idx );
+                if ( b.compare_exchange_strong( cur, marked_bucket( pNew, bucket_initialized ), atomics::memory_order_acq_rel, atomics::memory_order_relaxed )) {
+                    // Only this thread has removed pItem, so pItem cannot be disposed yet
+                    retire_bucket( cur.ptr());
+                    --m_ItemCounter;
+                    m_Stat.onEraseSuccess();
+                    f( pItem->m_Value );
+                    gc::template retire<item_disposer>( pItem );
+                    return true;
+                }
+
+                free_bucket( pNew );
+                m_Stat.onBucketRace();
+                bkoff();
+            }
+        }
+
+        template <typename Q, typename Func>
+        bool find_at( Q const& key, size_t nHash, Func f )
+        {
+            guard_array guards;
+
+            while ( true ) {
+                table * t = guards.protect( guard_table, m_pHead );
+                atomic_bucket& b = bucket_of( t, nHash );
+                marked_bucket cur = guards.protect( guard_bucket, b, []( marked_bucket p ) { return p.ptr(); } );
+                if ( cur.bits() & bucket_frozen ) {
+                    // The table has been grown
+                    m_Stat.onFrozenRetry();
+                    continue;
+                }
+
+                size_t idx;
+                search_result res;
+                if ( cur.bits() & bucket_initialized ) {
+                    res = search( cur.ptr(), nHash, key, idx, guards,
+                        [&b, &cur]() { return b.load( atomics::memory_order_acquire ) == cur; } );
+                }
+                else {
+                    // The bucket is not migrated yet, look for the key in the predecessor table
+                    table * pPred = guards.protect( guard_pred, t->pPred );
+                    if ( !pPred )
+                        continue;
+                    atomic_bucket& src = bucket_of( pPred, nHash );
+                    cur = guards.protect( guard_bucket, src, []( marked_bucket p ) { return p.ptr(); } );
+
+                    // The item is in the set while the source bucket is not changed (it may be frozen)
+                    // and the bucket of the current table is not initialized
+                    res = search( cur.ptr(), nHash, key, idx, guards,
+                        [&src, &b, &cur]() {
+                            return src.load( atomics::memory_order_acquire ).ptr() == cur.ptr()
+                                && !( b.load( atomics::memory_order_acquire ).bits() & bucket_initialized );
+                        } );
+                }
+
+                if ( res == search_retry ) {
+                    m_Stat.onFindRetry();
+                    continue;
+                }
+                if ( res == search_not_found ) {
+                    m_Stat.onFindFailed();
+                    return false;
+                }
+
+                f( cur.ptr()->cells[idx].pItem->m_Value );
+                m_Stat.onFindSuccess();
+                return true;
+            }
+        }
+
+        void check_grow( guard_array& guards )
+        {
+            table * t = guards.protect( guard_table, m_pHead );
+            if ( m_ItemCounter.value() > t->nSize * m_nLoadFactor )
+                grow( t, guards );
+        }
+
+        // Doubles the bucket table; other threads never wait for the resizing
+        void grow( table * t, guard_array& guards )
+        {
+            if ( m_bResizing.load( atomics::memory_order_relaxed ) || m_bResizing.exchange( true, atomics::memory_order_acquire ))
+                return;
+
+            if ( m_pHead.load( atomics::memory_order_acquire ) == t ) {
+                table * pPred = t->pPred.load( atomics::memory_order_acquire );
+                if ( pPred ) {
+                    // Complete the migration before the next growing
+                    for ( size_t i = 0; i < t->nSize; ++i ) {
+                        if ( !( t->buckets[i].load( atomics::memory_order_acquire ).bits() & bucket_initialized ))
+                            init_bucket( t, i, guards );
+                    }
+                    t->pPred.store( nullptr, atomics::memory_order_release );
+                    guards.clear( guard_pred );
+                    gc::template retire<table_disposer>( pPred );
+                }
+
+                m_pHead.store( alloc_table( t->nSize * 2, t ), atomics::memory_order_release );
+                m_Stat.onResize();
+            }
+
+            m_bResizing.store( false, atomics::memory_order_release );
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_FREEZABLE_HASH_SET_H
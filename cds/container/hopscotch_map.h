@@ -0,0 +1,433 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_HOPSCOTCH_MAP_H
+#define CDSLIB_CONTAINER_HOPSCOTCH_MAP_H
+
+#include <cds/container/hopscotch_set.h>
+
+namespace cds { namespace container {
+
+    //@cond
+    namespace hopscotch { namespace details {
+
+        template <typename Key, typename Value, typename Traits>
+        struct make_hopscotch_map
+        {
+            typedef Key     key_type;
+            typedef Value   mapped_type;
+            typedef Traits  original_traits;
+            typedef std::pair< key_type const, mapped_type > value_type;
+
+            typedef typename cds::opt::v::hash_selector< typename original_traits::hash >::type key_hash;
+            typedef typename cds::opt::details::make_equal_to< key_type, original_traits >::type key_equal_to;
+
+            struct set_traits: public original_traits
+            {
+                typedef map_hash< value_type, key_hash >                hash;
+                typedef map_key_equal_to< value_type, key_equal_to >    equal_to;
+                typedef opt::none   compare;
+                typedef opt::none   less;
+            };
+
+            typedef HopscotchSet< value_type, set_traits > type;
+        };
+
+    }} // namespace hopscotch::details
+    //@endcond
+
+    /// Concurrent hopscotch hash map
+    /** @ingroup cds_nonintrusive_map
+        @anchor cds_nonintrusive_HopscotchMap
+
+        The map is based on \p HopscotchSet, see \ref cds_nonintrusive_HopscotchSet "HopscotchSet" for the algorithm.
+        The map stores <tt>std::pair<Key const, Value></tt> items; \p find() does not lock,
+        the writers lock the segment of the home bucket of the key.
+
+        The map does not support iterators.
+
+        Template arguments:
+        - \p Key - key type
+        - \p Value - mapped type
+        - \p Traits - map traits, default is \p hopscotch::traits.
+            Instead of defining \p Traits struct directly you may use option-based syntax with
+            \p hopscotch::make_traits metafunction. The hash and the equality functors are applied to the key.
+
+        Many of the class function take a key argument of type \p K that in general is not \p key_type.
+        \p key_type and an argument of template type \p K must meet the following requirements:
+        - \p key_type should be constructible from value of type \p K;
+        - the hash functor should be able to calculate correct hash value from argument \p key of type \p K:
+            <tt> hash( key_type(key)) == hash( key ) </tt>
+        - values of type \p key_type and \p K should be comparable by the equality functor
+    */
+    template <typename Key, typename Value,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = hopscotch::traits
+#else
+        class Traits
+#endif
+    >
+    class HopscotchMap:
+#ifdef CDS_DOXYGEN_INVOKED
+        protected HopscotchSet< std::pair< Key const, Value>, Traits >
+#else
+        protected hopscotch::details::make_hopscotch_map< Key, Value, Traits >::type
+#endif
+    {
+        //@cond
+        typedef hopscotch::details::make_hopscotch_map< Key, Value, Traits > maker;
+        typedef typename maker::type base_class;
+        typedef typename base_class::node_type       node_type;
+        typedef typename base_class::scoped_node_ptr scoped_node_ptr;
+        //@endcond
+    public:
+        typedef Key     key_type;       ///< key type
+        typedef Value   mapped_type;    ///< value type stored in the container
+        typedef std::pair< key_type const, mapped_type > value_type;   ///< Key-value pair type
+        typedef Traits  traits;         ///< Map traits
+
+        typedef typename maker::key_hash        hash;           ///< Hash functor
+        typedef typename maker::key_equal_to    key_equal_to;   ///< Key equality functor
+        typedef typename base_class::lock_type  lock_type;      ///< Segment lock type
+        typedef typename base_class::allocator  allocator;      ///< Allocator for the bucket tables and the lock array
+        typedef typename base_class::item_counter item_counter; ///< Item counter type
+        typedef typename base_class::stat       stat;           ///< Internal statistics
+
+        static constexpr const bool c_isSorted = false;    ///< The map is unordered
+        static constexpr const unsigned int c_nNeighbourhood = base_class::c_nNeighbourhood; ///< Neighbourhood size \p H
+        static constexpr const size_t c_nDefaultInitialSize = base_class::c_nDefaultInitialSize; ///< Default initial capacity
+        static constexpr const size_t c_nDefaultLockCount = base_class::c_nDefaultLockCount;     ///< Default size of the lock array
+
+    protected:
+        //@cond
+        typedef typename maker::set_traits::equal_to pair_equal_to;
+
+        template <typename Predicate>
+        using pair_predicate = hopscotch::details::map_key_equal_to< value_type, Predicate >;
+        //@endcond
+
+    public:
+        /// Constructs the map
+        HopscotchMap(
+            size_t nInitialSize = c_nDefaultInitialSize,    ///< Initial capacity, the table grows on demand
+            size_t nLockCount = c_nDefaultLockCount,        ///< Size of the segment lock array, rounded up to power of 2
+            hash const& h = hash()                          ///< Hash functor
+        )
+            : base_class( nInitialSize, nLockCount, typename base_class::hash( h ))
+        {}
+
+        /// Destructs the map and frees all its items
+        ~HopscotchMap()
+        {}
+
+        /// Inserts new node with key and default value
+        /**
+            The function creates a node with \p key and default value, and then inserts the node created into the map.
+
+            Preconditions:
+            - The \p key_type should be constructible from value of type \p K.
+            - The \p mapped_type should be default-constructible.
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K>
+        bool insert( K const& key )
+        {
+            return insert_with( key, []( value_type& ) {} );
+        }
+
+        /// Inserts new node
+        /**
+            The function creates a node with copy of \p val value
+            and then inserts the node created into the map.
+
+            Preconditions:
+            - The \p key_type should be constructible from \p key of type \p K.
+            - The \p mapped_type should be constructible from \p val of type \p V.
+
+            Returns \p true if \p val is inserted into the map, \p false otherwise.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val )
+        {
+            return insert_at( key, [&key, &val]() { return base_class::alloc_node( key_type( key ), mapped_type( val )); },
+                []( value_type& ) {} );
+        }
+
+        /// Inserts new node and initialize it by a functor
+        /**
+            This function inserts new node with key \p key and if inserting is successful then it calls
+            \p func functor with signature
+            \code
+                struct functor {
+                    void operator()( value_type& item );
+                };
+            \endcode
+
+            The argument \p item of user-defined functor \p func is the reference
+            to the map's item inserted:
+                - <tt>item.first</tt> is a const reference to item's key that cannot be changed.
+                - <tt>item.second</tt> is a reference to item's value that may be changed.
+
+            The functor is called under the segment lock before the item becomes visible to the lock-free readers.
+
+            The key_type should be constructible from value of type \p K.
+        */
+        template <typename K, typename Func>
+        bool insert_with( K const& key, Func func )
+        {
+            return insert_at( key, [&key]() { return base_class::alloc_node( key_type( key ), mapped_type()); }, func );
+        }
+
+        /// For key \p key inserts data of type \p mapped_type created in-place from \p args
+        /**
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K, typename... Args>
+        bool emplace( K&& key, Args&&... args )
+        {
+            scoped_node_ptr pNode( base_class::alloc_node( std::piecewise_construct,
+                std::forward_as_tuple( std::forward<K>( key )),
+                std::forward_as_tuple( std::forward<Args>( args )... )));
+            key_type const& k = pNode->m_Value.first;
+
+            std::pair<bool, bool> res = base_class::update_at( k, base_class::m_Hash( k ), pair_equal_to(), pNode,
+                []() -> node_type* { assert( false ); return nullptr; },
+                []( bool, node_type& ) {}, true );
+
+            if ( res.second )
+                base_class::m_Stat.onInsertSuccess();
+            else
+                base_class::m_Stat.onInsertFailed();
+            return res.second;
+        }
+
+        /// Updates the node
+        /**
+            The operation performs inserting or changing data with lock-free manner.
+
+            If \p key is not found in the map, then \p key is inserted iff \p bAllowInsert is \p true.
+            Otherwise, the functor \p func is called with item found.
+            The functor \p func signature is:
+            \code
+                struct my_functor {
+                    void operator()( bool bNew, value_type& item );
+                };
+            \endcode
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - item of the map
+
+            The functor is called under the segment lock; for new item, before the item becomes visible.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is \p true if operation is successful,
+            \p second is \p true if new item has been added or \p false if the item with \p key
+            already is in the map.
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> update( K const& key, Func func, bool bAllowInsert = true )
+        {
+            scoped_node_ptr pNode;
+            std::pair<bool, bool> res = base_class::update_at( key, base_class::m_Hash( key ), pair_equal_to(), pNode,
+                [&key]() { return base_class::alloc_node( key_type( key ), mapped_type()); },
+                [&func]( bool bNew, node_type& node ) {
+                    func( bNew, node.m_Value );
+                }, bAllowInsert );
+
+            if ( res.second )
+                base_class::m_Stat.onUpdateNew();
+            else if ( res.first )
+                base_class::m_Stat.onUpdateExisting();
+            else
+                base_class::m_Stat.onUpdateFailed();
+            return res;
+        }
+
+        /// Delete \p key from the map
+        /** \anchor cds_nonintrusive_HopscotchMap_erase_val
+
+            Return \p true if \p key is found and deleted, \p false otherwise
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            return base_class::erase_at( key, pair_equal_to(), []( value_type& ) {} );
+        }
+
+        /// Deletes the item from the map using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_HopscotchMap_erase_val "erase(K const&)"
+            but \p pred is used for key comparing.
+            \p Predicate is the key equality functor: <tt> pred( key_type const&, K const& ) </tt>.
+        */
+        template <typename K, typename Predicate>
+        bool erase_with( K const& key, Predicate pred )
+        {
+            CDS_UNUSED( pred );
+            return base_class::erase_at( key, pair_predicate< Predicate >(), []( value_type& ) {} );
+        }
+
+        /// Delete \p key from the map
+        /** \anchor cds_nonintrusive_HopscotchMap_erase_func
+
+            The function searches an item with key \p key, calls \p f functor
+            and deletes the item. If \p key is not found, the functor is not called.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()(value_type& item) { ... }
+            };
+            \endcode
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename K, typename Func>
+        bool erase( K const& key, Func f )
+        {
+            return base_class::erase_at( key, pair_equal_to(), [&f]( value_type& item ) { f( item ); } );
+        }
+
+        /// Deletes the item from the map using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_HopscotchMap_erase_func "erase(K const&, Func)"
+            but \p pred is used for key comparing.
+            \p Predicate is the key equality functor: <tt> pred( key_type const&, K const& ) </tt>.
+        */
+        template <typename K, typename Predicate, typename Func>
+        bool erase_with( K const& key, Predicate pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return base_class::erase_at( key, pair_predicate< Predicate >(), [&f]( value_type& item ) { f( item ); } );
+        }
+
+        /// Find the key \p key
+        /** \anchor cds_nonintrusive_HopscotchMap_find_func
+
+            The function searches the item with key equal to \p key and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            where \p item is the item found.
+
+            The functor is called without any lock. The item cannot be freed while the functor is running,
+            but the functor may run concurrently with \p update() of the item.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f )
+        {
+            return base_class::find_at( key, pair_equal_to(), [&f]( value_type& item, K const& ) { f( item ); } );
+        }
+
+        /// Find the key \p val using \p pred predicate for comparing
+        /**
+            The function is an analog of \ref cds_nonintrusive_HopscotchMap_find_func "find(K const&, Func)"
+            but \p pred is used for key comparison.
+            \p Predicate is the key equality functor: <tt> pred( key_type const&, K const& ) </tt>.
+        */
+        template <typename K, typename Predicate, typename Func>
+        bool find_with( K const& key, Predicate pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return base_class::find_at( key, pair_predicate< Predicate >(), [&f]( value_type& item, K const& ) { f( item ); } );
+        }
+
+        /// Checks whether the map contains \p key
+        /**
+            The function searches the item with key equal to \p key
+            and returns \p true if it is found, and \p false otherwise.
+        */
+        template <typename K>
+        bool contains( K const& key )
+        {
+            return base_class::find_at( key, pair_equal_to(), []( value_type&, K const& ) {} );
+        }
+
+        /// Checks whether the map contains \p key using \p pred predicate for searching
+        /**
+            The function is similar to <tt>contains( key )</tt> but \p pred is used for key comparing.
+            \p Predicate is the key equality functor: <tt> pred( key_type const&, K const& ) </tt>.
+        */
+        template <typename K, typename Predicate>
+        bool contains( K const& key, Predicate pred )
+        {
+            CDS_UNUSED( pred );
+            return base_class::find_at( key, pair_predicate< Predicate >(), []( value_type&, K const& ) {} );
+        }
+
+        /// Clears the map
+        void clear()
+        {
+            base_class::clear();
+        }
+
+        /// Checks if the map is empty
+        /**
+            Emptiness is checked by item counting: if item count is zero then the map is empty.
+        */
+        bool empty() const
+        {
+            return base_class::empty();
+        }
+
+        /// Returns item count in the map
+        size_t size() const
+        {
+            return base_class::size();
+        }
+
+        /// Returns the count of home buckets of the current bucket table
+        size_t bucket_count() const
+        {
+            return base_class::bucket_count();
+        }
+
+        /// Returns the size of the segment lock array
+        size_t lock_count() const
+        {
+            return base_class::lock_count();
+        }
+
+        /// Returns the neighbourhood size \p H
+        static constexpr unsigned int neighbourhood_size()
+        {
+            return c_nNeighbourhood;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return base_class::statistics();
+        }
+
+    protected:
+        //@cond
+        template <typename K, typename Alloc, typename Func>
+        bool insert_at( K const& key, Alloc alloc, Func func )
+        {
+            scoped_node_ptr pNode;
+            std::pair<bool, bool> res = base_class::update_at( key, base_class::m_Hash( key ), pair_equal_to(), pNode, alloc,
+                [&func]( bool bNew, node_type& node ) {
+                    if ( bNew )
+                        func( node.m_Value );
+                }, true );
+
+            if ( res.second )
+                base_class::m_Stat.onInsertSuccess();
+            else
+                base_class::m_Stat.onInsertFailed();
+            return res.second;
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_HOPSCOTCH_MAP_H
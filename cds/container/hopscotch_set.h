@@ -0,0 +1,1040 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_HOPSCOTCH_SET_H
+#define CDSLIB_CONTAINER_HOPSCOTCH_SET_H
+
+#include <memory>
+#include <vector>
+#include <algorithm>    // std::min
+#include <cds/container/details/hopscotch_base.h>
+#include <cds/sync/lock_array.h>
+#include <cds/sync/versioned_lock.h>
+#include <cds/sync/reader_registry.h>
+#include <cds/details/allocator.h>
+#include <cds/algo/int_algo.h>
+#include <cds/algo/bitop.h>
+
+namespace cds { namespace container {
+
+    //@cond
+    namespace hopscotch { namespace details {
+
+        template <typename T, typename Traits>
+        struct make_hopscotch_set
+        {
+            typedef T       value_type;
+            typedef Traits  original_traits;
+
+            typedef typename cds::opt::v::hash_selector< typename original_traits::hash >::type hash;
+            typedef typename cds::opt::details::make_equal_to< value_type, original_traits >::type key_equal_to;
+
+            typedef typename original_traits::allocator allocator;
+            typedef typename std::conditional<
+                std::is_same< typename original_traits::node_allocator, opt::none >::value
+                , allocator
+                , typename original_traits::node_allocator
+            >::type node_allocator;
+
+            static constexpr const unsigned int c_nNeighbourhood = original_traits::neighbourhood_size;
+            static_assert( c_nNeighbourhood >= 4 && c_nNeighbourhood <= 64, "The neighbourhood size must be from 4 to 64" );
+
+            typedef typename std::conditional< ( c_nNeighbourhood > 32 ), uint64_t, uint32_t >::type hop_type;
+        };
+
+    }} // namespace hopscotch::details
+    //@endcond
+
+    /// Concurrent hopscotch hash set
+    /** @ingroup cds_nonintrusive_set
+        @anchor cds_nonintrusive_HopscotchSet
+
+        Source:
+            - [2008] Maurice Herlihy, Nir Shavit, Moran Tzafrir "Hopscotch Hashing"
+
+        Hopscotch hashing is an open-addressing scheme where an item is always stored in one of \p H
+        buckets starting from its home bucket (the neighbourhood of the home bucket).
+        Each bucket has \p H -bit bitmap (hop-info) that marks the buckets of its neighbourhood holding
+        the items of this home bucket, so a lookup reads the hop-info and checks only the marked buckets.
+        Since the neighbourhood is \p H adjacent buckets, a lookup touches one or two cache lines of the bucket table.
+
+        An item is inserted into the closest free bucket after its home one.
+        If the free bucket is too far, the items between are displaced: an item whose neighbourhood contains
+        the free bucket is moved to it, that frees a bucket closer to the home bucket; it repeats until
+        the free bucket is in the neighbourhood of the new item. If no item can be displaced, or there is no free
+        bucket in the probe range, the bucket table is doubled.
+
+        The concurrent version follows the paper. The bucket table is split into the segments of adjacent buckets.
+        Each segment is protected by a lock of \p cds::sync::lock_array; the lock of the home bucket segment
+        serializes all changes of the items of that home bucket: inserting, erasing, and displacing.
+        The displacement of an item of another segment acquires its segment lock by \p try_lock()
+        only, so the writers never deadlock. The free buckets are reserved by CAS since a free bucket
+        may be claimed by the writers of different segments.
+
+        \p find() and \p contains() never lock. Each segment lock has a version counter that is changed on
+        each lock and unlock. The reader checks the marked buckets of the home bucket; a found item is the result.
+        If the key is not found, the reader checks that the version of the home segment and the bucket table
+        are unchanged, otherwise the search is repeated; after a few attempts the reader falls back to
+        the locked search. The erased items and the old bucket tables are freed only when all lock-free readers
+        started before the item has been unlinked are done, so \p find() functor may safely access the item
+        found. Note that the \p find() functor is called without any lock, it may run concurrently with
+        \p update() of the same item.
+
+        The lock array is not resizable: after the bucket table is doubled, each segment covers twice more buckets.
+
+        The hash functor must be good enough: no more than \p H items may have the same home bucket
+        whatever the table size is. Thus, more than \p H items with equal hash values cannot be stored in the set.
+
+        The set does not support iterators.
+
+        Template arguments:
+        - \p T - the type stored in the set.
+        - \p Traits - set traits, default is \p hopscotch::traits.
+            Instead of defining \p Traits struct directly you may use option-based syntax with
+            \p hopscotch::make_traits metafunction.
+
+        Many of the class function take a key argument of type \p Q that in general is not \p value_type.
+        The hash functor should be able to calculate correct hash value from an argument of type \p Q
+        (<tt> hash( value_type(q)) == hash( q ) </tt>), and the equality functor should compare \p value_type and \p Q.
+
+        Example:
+        \code
+        #include <cds/container/hopscotch_set.h>
+
+        struct foo {
+            int     nKey;
+            int     nData;
+        };
+
+        struct foo_hash {
+            size_t operator()( int k ) const { return std::hash<int>()( k ); }
+            size_t operator()( foo const& v ) const { return (*this)( v.nKey ); }
+        };
+
+        struct foo_equal_to {
+            bool operator()( foo const& v, int k ) const { return v.nKey == k; }
+            bool operator()( foo const& v1, foo const& v2 ) const { return v1.nKey == v2.nKey; }
+        };
+
+        typedef cds::container::HopscotchSet< foo,
+            cds::container::hopscotch::make_traits<
+                cds::opt::hash< foo_hash >
+                ,cds::opt::equal_to< foo_equal_to >
+                ,cds::opt::stat< cds::container::hopscotch::stat<>>
+            >::type
+        > foo_set;
+        \endcode
+    */
+    template <typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = hopscotch::traits
+#else
+        class Traits
+#endif
+    >
+    class HopscotchSet
+    {
+        //@cond
+        typedef hopscotch::details::make_hopscotch_set< T, Traits > maker;
+        //@endcond
+    public:
+        typedef T       value_type;     ///< value type stored in the set
+        typedef Traits  traits;         ///< Set traits
+
+        typedef typename maker::hash            hash;           ///< Hash functor
+        typedef typename maker::key_equal_to    key_equal_to;   ///< Key equality functor based on \p opt::equal_to, \p opt::compare or \p opt::less
+        typedef typename traits::lock_type      lock_type;      ///< Segment lock type
+        typedef typename maker::allocator       allocator;      ///< Allocator for the bucket tables and the lock array
+        typedef typename maker::node_allocator  node_allocator; ///< Node allocator
+        typedef typename traits::item_counter   item_counter;   ///< Item counter type
+        typedef typename traits::back_off       back_off;       ///< Back-off strategy
+        typedef typename traits::stat           stat;           ///< Internal statistics
+
+        static constexpr const bool c_isSorted = false;    ///< The set is unordered
+        static constexpr const unsigned int c_nNeighbourhood = maker::c_nNeighbourhood; ///< Neighbourhood size \p H
+        static constexpr const size_t c_nDefaultInitialSize = 1024; ///< Default initial capacity
+        static constexpr const size_t c_nDefaultLockCount = 256;    ///< Default size of the lock array
+
+    protected:
+        //@cond
+        typedef typename maker::hop_type hop_type;
+        typedef cds::sync::versioned_lock< lock_type > segment_lock;
+        typedef cds::sync::lock_array< segment_lock, cds::sync::pow2_select_policy, allocator > lock_array_type;
+        typedef cds::sync::reader_registry reader_registry;
+
+        // The range of buckets after the home bucket that is probed for a free bucket
+        static constexpr const size_t c_nAddRange = c_nNeighbourhood * 16;
+
+        // Count of lock-free attempts of find() before falling back to the locked search
+        static constexpr const unsigned int c_nFindAttempts = 8;
+
+        // Count of inserting retries after a displacement failed due to busy locks
+        static constexpr const unsigned int c_nInsertRetries = 16;
+
+        // Erased items are freed by batches of this size
+        static constexpr const size_t c_nReclaimBatchSize = 64;
+
+        struct node_type
+        {
+            size_t      m_nHash;
+            value_type  m_Value;
+
+            template <typename... Args>
+            node_type( Args&&... args )
+                : m_nHash( 0 )
+                , m_Value( std::forward<Args>( args )... )
+            {}
+        };
+
+        typedef cds::details::Allocator< node_type, node_allocator > cxx_node_allocator;
+
+        struct node_disposer {
+            void operator()( node_type * pNode )
+            {
+                cxx_node_allocator().Delete( pNode );
+            }
+        };
+        typedef std::unique_ptr< node_type, node_disposer > scoped_node_ptr;
+
+        struct bucket
+        {
+            atomics::atomic<hop_type>       m_nHopInfo; // items of this home bucket in the neighbourhood
+            atomics::atomic<node_type *>    m_pNode;
+
+            bucket()
+                : m_nHopInfo( 0 )
+                , m_pNode( nullptr )
+            {}
+        };
+        typedef cds::details::Allocator< bucket, allocator > bucket_allocator;
+
+        struct bucket_table
+        {
+            size_t const    nCapacity;      // count of home buckets, power of 2
+            size_t const    nMask;
+            size_t const    nSegmentShift;  // home bucket -> segment lock
+            bucket * const  pBuckets;       // nCapacity + c_nNeighbourhood - 1 buckets
+
+            bucket_table( size_t nCap, size_t nLockCount )
+                : nCapacity( nCap )
+                , nMask( nCap - 1 )
+                , nSegmentShift( nCap > nLockCount ? cds::beans::log2( nCap ) - cds::beans::log2( nLockCount ) : 0 )
+                , pBuckets( bucket_allocator().NewArray( nCap + c_nNeighbourhood - 1 ))
+            {}
+
+            ~bucket_table()
+            {
+                bucket_allocator().Delete( pBuckets, bucket_count());
+            }
+
+            size_t bucket_count() const
+            {
+                return nCapacity + c_nNeighbourhood - 1;
+            }
+
+            size_t home( size_t nHash ) const
+            {
+                return nHash & nMask;
+            }
+
+            size_t segment( size_t nHome ) const
+            {
+                return nHome >> nSegmentShift;
+            }
+        };
+        typedef cds::details::Allocator< bucket_table, allocator > table_allocator;
+
+        enum class place_result {
+            inserted,
+            retry,      // displacement failed due to busy segment locks
+            resize      // no free bucket or nothing to displace
+        };
+
+        // Locks the segment of the home bucket of a hash value in the current bucket table
+        class segment_guard
+        {
+            HopscotchSet&   m_Set;
+            bucket_table *  m_pTable;
+            size_t          m_nHome;
+            size_t          m_nCell;
+
+        public:
+            segment_guard( HopscotchSet& s, size_t nHash )
+                : m_Set( s )
+            {
+                while ( true ) {
+                    m_pTable = s.m_pTable.load( atomics::memory_order_acquire );
+                    m_nHome = m_pTable->home( nHash );
+                    m_nCell = s.m_Locks.lock( m_pTable->segment( m_nHome ));
+
+                    // the resizing holds all segment locks
+                    if ( s.m_pTable.load( atomics::memory_order_acquire ) == m_pTable )
+                        break;
+                    s.m_Locks.unlock( m_nCell );
+                }
+            }
+
+            ~segment_guard()
+            {
+                m_Set.m_Locks.unlock( m_nCell );
+            }
+
+            bucket_table& table() const
+            {
+                return *m_pTable;
+            }
+
+            size_t home() const
+            {
+                return m_nHome;
+            }
+
+            size_t cell() const
+            {
+                return m_nCell;
+            }
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        hash                            m_Hash;
+        atomics::atomic<bucket_table *> m_pTable;
+        lock_array_type                 m_Locks;
+        item_counter                    m_ItemCounter;
+        stat                            m_Stat;
+        reader_registry                 m_Readers;
+
+        std::mutex                      m_RetireLock;
+        std::vector<node_type *>        m_Retired;
+        //@endcond
+
+    public:
+        /// Constructs the set
+        HopscotchSet(
+            size_t nInitialSize = c_nDefaultInitialSize,    ///< Initial capacity, the table grows on demand
+            size_t nLockCount = c_nDefaultLockCount,        ///< Size of the segment lock array, rounded up to power of 2
+            hash const& h = hash()                          ///< Hash functor
+        )
+            : m_Hash( h )
+            , m_pTable( nullptr )
+            , m_Locks( cds::beans::ceil2( nLockCount ? nLockCount : 1 ), cds::sync::pow2_select_policy( cds::beans::ceil2( nLockCount ? nLockCount : 1 )))
+        {
+            m_pTable.store( alloc_table( initial_capacity( nInitialSize )), atomics::memory_order_release );
+            m_Retired.reserve( c_nReclaimBatchSize );
+        }
+
+        /// Destructs the set and frees all its items
+        ~HopscotchSet()
+        {
+            bucket_table * pTable = m_pTable.load( atomics::memory_order_relaxed );
+            free_nodes( *pTable );
+            free_table( pTable );
+            for ( node_type * p : m_Retired )
+                free_node( p );
+        }
+
+        /// Inserts new node
+        /**
+            The function creates a node with copy of \p val value
+            and then inserts the node created into the set.
+
+            The type \p Q should contain as minimum the complete key for the node.
+            The object of \p value_type should be constructible from a value of type \p Q.
+
+            Returns \p true if \p val is inserted into the set, \p false otherwise.
+        */
+        template <typename Q>
+        bool insert( Q const& val )
+        {
+            return insert( val, []( value_type& ) {} );
+        }
+
+        /// Inserts new node
+        /**
+            The function allows to split creating of new item into two part:
+            - create item with key only
+            - insert new item into the set
+            - if inserting is success, calls \p f functor to initialize value-field of new item .
+
+            The functor signature is:
+            \code
+                void func( value_type& item );
+            \endcode
+            where \p item is the item inserted.
+            The functor is called under the segment lock before the item becomes visible to the lock-free readers.
+        */
+        template <typename Q, typename Func>
+        bool insert( Q const& val, Func f )
+        {
+            scoped_node_ptr pNode;
+            std::pair<bool, bool> res = update_at( val, m_Hash( val ), key_equal_to(), pNode,
+                [&val]() { return alloc_node( val ); },
+                [&f]( bool bNew, node_type& node ) {
+                    if ( bNew )
+                        f( node.m_Value );
+                }, true );
+
+            if ( res.second )
+                m_Stat.onInsertSuccess();
+            else
+                m_Stat.onInsertFailed();
+            return res.second;
+        }
+
+        /// Inserts data of type \p value_type constructed with <tt>std::forward<Args>(args)...</tt>
+        /**
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename... Args>
+        bool emplace( Args&&... args )
+        {
+            scoped_node_ptr pNode( alloc_node( std::forward<Args>( args )... ));
+            value_type const& val = pNode->m_Value;
+            std::pair<bool, bool> res = update_at( val, m_Hash( val ), key_equal_to(), pNode,
+                []() -> node_type* { assert( false ); return nullptr; },
+                []( bool, node_type& ) {}, true );
+
+            if ( res.second )
+                m_Stat.onInsertSuccess();
+            else
+                m_Stat.onInsertFailed();
+            return res.second;
+        }
+
+        /// Updates the node
+        /**
+            The operation performs inserting or changing data with lock-free manner.
+
+            If the item \p val is not found in the set, then \p val is inserted into the set
+            iff \p bAllowInsert is \p true.
+            Otherwise, the functor \p func is called with item found.
+            The functor signature is:
+            \code
+                void func( bool bNew, value_type& item, const Q& val );
+            \endcode
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - item of the set
+            - \p val - argument \p val passed into the \p %update() function
+
+            The functor is called under the segment lock.
+            The functor may change non-key fields of the \p item.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is \p true if operation is successful,
+            i.e. the node has been inserted or updated,
+            \p second is \p true if new item has been added or \p false if the item with \p key
+            already exists.
+        */
+        template <typename Q, typename Func>
+        std::pair<bool, bool> update( Q const& val, Func func, bool bAllowInsert = true )
+        {
+            scoped_node_ptr pNode;
+            std::pair<bool, bool> res = update_at( val, m_Hash( val ), key_equal_to(), pNode,
+                [&val]() { return alloc_node( val ); },
+                [&func, &val]( bool bNew, node_type& node ) {
+                    func( bNew, node.m_Value, val );
+                }, bAllowInsert );
+
+            if ( res.second )
+                m_Stat.onUpdateNew();
+            else if ( res.first )
+                m_Stat.onUpdateExisting();
+            else
+                m_Stat.onUpdateFailed();
+            return res;
+        }
+
+        /// Delete \p key from the set
+        /**
+            Since the key of set's item type \p value_type is not explicitly specified,
+            template parameter \p Q defines the key type searching in the list.
+            The set item comparator should be able to compare the type \p value_type
+            and the type \p Q.
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename Q>
+        bool erase( Q const& key )
+        {
+            return erase_at( key, key_equal_to(), []( value_type const& ) {} );
+        }
+
+        /// Deletes the item from the set using \p pred predicate for searching
+        /**
+            The function is an analog of \p erase(Q const&) but \p pred is used for key comparing.
+            \p Predicate is the equality functor: <tt> pred( value_type const&, Q const& ) </tt>.
+        */
+        template <typename Q, typename Predicate>
+        bool erase_with( Q const& key, Predicate pred )
+        {
+            CDS_UNUSED( pred );
+            return erase_at( key, Predicate(), []( value_type const& ) {} );
+        }
+
+        /// Delete \p key from the set
+        /**
+            The function searches an item with key \p key, calls \p f functor
+            and deletes the item. If \p key is not found, the functor is not called.
+
+            The functor \p Func interface is:
+            \code
+            struct functor {
+                void operator()(value_type const& val);
+            };
+            \endcode
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename Q, typename Func>
+        bool erase( Q const& key, Func f )
+        {
+            return erase_at( key, key_equal_to(), f );
+        }
+
+        /// Deletes the item from the set using \p pred predicate for searching
+        /**
+            The function is an analog of \p erase(Q const&, Func) but \p pred is used for key comparing.
+            \p Predicate is the equality functor: <tt> pred( value_type const&, Q const& ) </tt>.
+        */
+        template <typename Q, typename Predicate, typename Func>
+        bool erase_with( Q const& key, Predicate pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return erase_at( key, Predicate(), f );
+        }
+
+        /// Find the key \p val
+        /**
+            The function searches the item with key equal to \p key and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item, Q& key );
+            };
+            \endcode
+            where \p item is the item found, \p key is the <tt>find</tt> function argument.
+
+            The functor is called without any lock. The item cannot be freed while the functor is running,
+            but the functor may run concurrently with \p update() of the item.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename Q, typename Func>
+        bool find( Q& key, Func f )
+        {
+            return find_at( key, key_equal_to(), [&f]( value_type& item, Q& k ) { f( item, k ); } );
+        }
+        //@cond
+        template <typename Q, typename Func>
+        bool find( Q const& key, Func f )
+        {
+            return find_at( key, key_equal_to(), [&f]( value_type& item, Q const& k ) { f( item, k ); } );
+        }
+        //@endcond
+
+        /// Find the key \p key using \p pred predicate for comparing
+        /**
+            The function is an analog of \p find(Q&, Func) but \p pred is used for key comparison.
+            \p Predicate is the equality functor: <tt> pred( value_type const&, Q const& ) </tt>.
+        */
+        template <typename Q, typename Predicate, typename Func>
+        bool find_with( Q& key, Predicate pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return find_at( key, Predicate(), [&f]( value_type& item, Q& k ) { f( item, k ); } );
+        }
+        //@cond
+        template <typename Q, typename Predicate, typename Func>
+        bool find_with( Q const& key, Predicate pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return find_at( key, Predicate(), [&f]( value_type& item, Q const& k ) { f( item, k ); } );
+        }
+        //@endcond
+
+        /// Checks whether the set contains \p key
+        /**
+            The function searches the item with key equal to \p key
+            and returns \p true if it is found, and \p false otherwise.
+        */
+        template <typename Q>
+        bool contains( Q const& key )
+        {
+            return find_at( key, key_equal_to(), []( value_type&, Q const& ) {} );
+        }
+
+        /// Checks whether the set contains \p key using \p pred predicate for searching
+        /**
+            The function is similar to <tt>contains( key )</tt> but \p pred is used for key comparing.
+            \p Predicate is the equality functor: <tt> pred( value_type const&, Q const& ) </tt>.
+        */
+        template <typename Q, typename Predicate>
+        bool contains( Q const& key, Predicate pred )
+        {
+            CDS_UNUSED( pred );
+            return find_at( key, Predicate(), []( value_type&, Q const& ) {} );
+        }
+
+        /// Clears the set
+        /**
+            The function replaces the bucket table by an empty one of the same size
+            and frees all items after the lock-free readers are done.
+        */
+        void clear()
+        {
+            bucket_table * pOld;
+            {
+                std::unique_lock< lock_array_type > al( m_Locks );
+                pOld = m_pTable.load( atomics::memory_order_relaxed );
+                m_pTable.store( alloc_table( pOld->nCapacity ), atomics::memory_order_release );
+                m_ItemCounter.reset();
+            }
+
+            m_Readers.synchronize();
+            free_nodes( *pOld );
+            free_table( pOld );
+        }
+
+        /// Checks if the set is empty
+        /**
+            Emptiness is checked by item counting: if item count is zero then the set is empty.
+        */
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /// Returns item count in the set
+        size_t size() const
+        {
+            return m_ItemCounter;
+        }
+
+        /// Returns the count of home buckets of the current bucket table
+        size_t bucket_count() const
+        {
+            return m_pTable.load( atomics::memory_order_acquire )->nCapacity;
+        }
+
+        /// Returns the size of the segment lock array
+        /**
+            The lock array size is constant for the set lifetime.
+        */
+        size_t lock_count() const
+        {
+            return m_Locks.size();
+        }
+
+        /// Returns the neighbourhood size \p H
+        static constexpr unsigned int neighbourhood_size()
+        {
+            return c_nNeighbourhood;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        template <typename... Args>
+        static node_type * alloc_node( Args&&... args )
+        {
+            return cxx_node_allocator().MoveNew( std::forward<Args>( args )... );
+        }
+
+        static void free_node( node_type * pNode )
+        {
+            cxx_node_allocator().Delete( pNode );
+        }
+
+        static node_type * busy_node()
+        {
+            // marks a free bucket reserved by an inserter
+            return reinterpret_cast<node_type *>( static_cast<uintptr_t>( 1 ));
+        }
+
+        static bool is_item( node_type * p )
+        {
+            return p != nullptr && p != busy_node();
+        }
+
+        static hop_type hop_bit( size_t nOffset )
+        {
+            return static_cast<hop_type>( 1 ) << nOffset;
+        }
+
+        static size_t initial_capacity( size_t nInitialSize )
+        {
+            // keep the initial load factor below 7/8
+            size_t const nSize = nInitialSize + nInitialSize / 8;
+            return cds::beans::ceil2( nSize < c_nNeighbourhood ? c_nNeighbourhood : nSize );
+        }
+
+        bucket_table * alloc_table( size_t nCapacity ) const
+        {
+            return table_allocator().New( nCapacity, m_Locks.size());
+        }
+
+        static void free_table( bucket_table * pTable )
+        {
+            table_allocator().Delete( pTable );
+        }
+
+        static void free_nodes( bucket_table& t )
+        {
+            for ( size_t i = 0, nCount = t.bucket_count(); i < nCount; ++i ) {
+                node_type * p = t.pBuckets[i].m_pNode.load( atomics::memory_order_relaxed );
+                if ( is_item( p ))
+                    free_node( p );
+            }
+        }
+
+        // Search under the home segment lock; returns the node and its bucket index
+        template <typename Q, typename Predicate>
+        static std::pair<node_type *, size_t> locked_find( bucket_table& t, size_t nHome, size_t nHash, Q const& key, Predicate pred )
+        {
+            hop_type nHop = t.pBuckets[nHome].m_nHopInfo.load( atomics::memory_order_relaxed );
+            while ( nHop ) {
+                size_t const nIdx = nHome + cds::bitop::LSBnz( nHop );
+                nHop &= nHop - 1;
+
+                node_type * p = t.pBuckets[nIdx].m_pNode.load( atomics::memory_order_relaxed );
+                assert( is_item( p ));
+                if ( p->m_nHash == nHash && pred( p->m_Value, key ))
+                    return std::make_pair( p, nIdx );
+            }
+            return std::make_pair( nullptr, size_t( 0 ));
+        }
+
+        // Racy search of lock-free readers, the result should be validated if the key is not found
+        template <typename Q, typename Predicate>
+        static node_type * optimistic_find( bucket_table& t, size_t nHome, size_t nHash, Q const& key, Predicate pred )
+        {
+            hop_type nHop = t.pBuckets[nHome].m_nHopInfo.load( atomics::memory_order_acquire );
+            while ( nHop ) {
+                size_t const nIdx = nHome + cds::bitop::LSBnz( nHop );
+                nHop &= nHop - 1;
+
+                node_type * p = t.pBuckets[nIdx].m_pNode.load( atomics::memory_order_acquire );
+                if ( is_item( p ) && p->m_nHash == nHash && pred( p->m_Value, key ))
+                    return p;
+            }
+            return nullptr;
+        }
+
+        template <typename Q, typename Predicate, typename Func>
+        bool find_at( Q& key, Predicate pred, Func f )
+        {
+            size_t const nHash = m_Hash( key );
+
+            back_off bkoff;
+            for ( unsigned int nAttempt = 0; nAttempt < c_nFindAttempts; ++nAttempt ) {
+                {
+                    typename reader_registry::read_guard rg( m_Readers );
+
+                    bucket_table * pTable = m_pTable.load( atomics::memory_order_acquire );
+                    size_t const nHome = pTable->home( nHash );
+                    segment_lock const& lock = m_Locks.at( pTable->segment( nHome ) & ( m_Locks.size() - 1 ));
+
+                    size_t const nVersion = lock.version();
+                    if ( ( nVersion & 1 ) == 0 ) {
+                        node_type * p = optimistic_find( *pTable, nHome, nHash, key, pred );
+                        if ( p ) {
+                            f( p->m_Value, key );
+                            m_Stat.onFindSuccess();
+                            return true;
+                        }
+
+                        atomics::atomic_thread_fence( atomics::memory_order_acquire );
+                        if ( lock.version() == nVersion && m_pTable.load( atomics::memory_order_acquire ) == pTable ) {
+                            m_Stat.onFindFailed();
+                            return false;
+                        }
+                    }
+                }
+                m_Stat.onFindRetry();
+                bkoff();
+            }
+
+            // Too many changes of the segment, search under the lock
+            m_Stat.onFindFallback();
+            segment_guard sg( *this, nHash );
+            node_type * p = locked_find( sg.table(), sg.home(), nHash, key, pred ).first;
+            if ( p ) {
+                f( p->m_Value, key );
+                m_Stat.onFindSuccess();
+                return true;
+            }
+            m_Stat.onFindFailed();
+            return false;
+        }
+
+        // Searches the key and inserts pNode (or the node created by alloc()) if the key is not found.
+        // func( bNew, node ) is called under the segment lock; for new node, before the node becomes visible.
+        // pNode is released if it has been inserted
+        template <typename Q, typename Predicate, typename Alloc, typename Func>
+        std::pair<bool, bool> update_at( Q const& key, size_t nHash, Predicate pred, scoped_node_ptr& pNode, Alloc alloc, Func func, bool bAllowInsert )
+        {
+            back_off bkoff;
+            unsigned int nRetry = 0;
+            while ( true ) {
+                bucket_table * pResizeFrom;
+                {
+                    segment_guard sg( *this, nHash );
+                    node_type * pFound = locked_find( sg.table(), sg.home(), nHash, key, pred ).first;
+                    if ( pFound ) {
+                        func( false, *pFound );
+                        return std::make_pair( true, false );
+                    }
+                    if ( !bAllowInsert )
+                        return std::make_pair( false, false );
+
+                    if ( !pNode )
+                        pNode.reset( alloc());
+                    pNode->m_nHash = nHash;
+
+                    place_result res = place( sg, pNode.get(), [&func]( node_type& node ) { func( true, node ); } );
+                    if ( res == place_result::inserted ) {
+                        pNode.release();
+                        return std::make_pair( true, true );
+                    }
+
+                    if ( res == place_result::retry && ++nRetry < c_nInsertRetries ) {
+                        m_Stat.onInsertRetry();
+                        pResizeFrom = nullptr;
+                    }
+                    else {
+                        nRetry = 0;
+                        pResizeFrom = &sg.table();
+                    }
+                }
+
+                if ( pResizeFrom )
+                    resize( pResizeFrom );
+                else
+                    bkoff();
+            }
+        }
+
+        // Places pNode into the neighbourhood of its home bucket. The home segment is locked
+        template <typename Func>
+        place_result place( segment_guard& sg, node_type * pNode, Func func )
+        {
+            bucket_table& t = sg.table();
+            size_t const nHome = sg.home();
+
+            // Reserve the closest free bucket
+            size_t const nEnd = std::min( nHome + c_nAddRange, t.bucket_count());
+            size_t nFree = nHome;
+            for ( ; nFree < nEnd; ++nFree ) {
+                atomics::atomic<node_type *>& slot = t.pBuckets[nFree].m_pNode;
+                node_type * pExpected = nullptr;
+                if ( slot.load( atomics::memory_order_relaxed ) == nullptr
+                    && slot.compare_exchange_strong( pExpected, busy_node(), atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                {
+                    break;
+                }
+            }
+            if ( nFree == nEnd ) {
+                m_Stat.onNoFreeSlot();
+                return place_result::resize;
+            }
+
+            // Move the free bucket to the neighbourhood
+            unsigned int nMoves = 0;
+            if ( nFree - nHome >= c_nNeighbourhood ) {
+                // the items of other segments are accessed without their locks
+                typename reader_registry::read_guard rg( m_Readers );
+
+                bool bLockFailed = false;
+                do {
+                    size_t const nClosest = displace( t, sg.cell(), nFree, bLockFailed );
+                    if ( nClosest == nFree ) {
+                        t.pBuckets[nFree].m_pNode.store( nullptr, atomics::memory_order_release );
+                        m_Stat.onDisplacementFailed();
+                        return bLockFailed ? place_result::retry : place_result::resize;
+                    }
+                    nFree = nClosest;
+                    ++nMoves;
+                } while ( nFree - nHome >= c_nNeighbourhood );
+            }
+            m_Stat.onDisplacement( nMoves );
+
+            func( *pNode );
+
+            bucket& home = t.pBuckets[nHome];
+            t.pBuckets[nFree].m_pNode.store( pNode, atomics::memory_order_release );
+            home.m_nHopInfo.store( home.m_nHopInfo.load( atomics::memory_order_relaxed ) | hop_bit( nFree - nHome ), atomics::memory_order_release );
+            ++m_ItemCounter;
+            return place_result::inserted;
+        }
+
+        // Moves an item to the reserved bucket nFree from a bucket closer to the home bucket of the item.
+        // Returns the bucket released (it is reserved for the caller) or nFree if no item can be moved
+        size_t displace( bucket_table& t, size_t nOwnCell, size_t nFree, bool& bLockFailed )
+        {
+            for ( size_t nIdx = nFree - ( c_nNeighbourhood - 1 ); nIdx < nFree; ++nIdx ) {
+                bucket& b = t.pBuckets[nIdx];
+                node_type * p = b.m_pNode.load( atomics::memory_order_acquire );
+                if ( !is_item( p ))
+                    continue;
+
+                size_t const nItemHome = t.home( p->m_nHash );
+                if ( nItemHome > nIdx || nFree - nItemHome >= c_nNeighbourhood )
+                    continue;
+
+                size_t const nSegment = t.segment( nItemHome );
+                bool const bForeign = nSegment != nOwnCell;
+                if ( bForeign && m_Locks.try_lock( nSegment ) == lock_array_type::c_nUnspecifiedCell ) {
+                    bLockFailed = true;
+                    m_Stat.onDisplacementLockFailed();
+                    continue;
+                }
+
+                bool bMoved = false;
+                if ( b.m_pNode.load( atomics::memory_order_relaxed ) == p ) {
+                    bucket& home = t.pBuckets[nItemHome];
+                    t.pBuckets[nFree].m_pNode.store( p, atomics::memory_order_release );
+                    home.m_nHopInfo.store(
+                        ( home.m_nHopInfo.load( atomics::memory_order_relaxed ) | hop_bit( nFree - nItemHome )) & ~hop_bit( nIdx - nItemHome ),
+                        atomics::memory_order_release );
+                    b.m_pNode.store( busy_node(), atomics::memory_order_release );
+                    bMoved = true;
+                }
+
+                if ( bForeign )
+                    m_Locks.unlock( nSegment );
+                if ( bMoved )
+                    return nIdx;
+            }
+            return nFree;
+        }
+
+        // Places pNode into the table that is not visible for other threads
+        static bool place_exclusive( bucket_table& t, node_type * pNode )
+        {
+            size_t const nHome = t.home( pNode->m_nHash );
+            size_t const nEnd = std::min( nHome + c_nAddRange, t.bucket_count());
+            size_t nFree = nHome;
+            while ( nFree < nEnd && t.pBuckets[nFree].m_pNode.load( atomics::memory_order_relaxed ) != nullptr )
+                ++nFree;
+            if ( nFree == nEnd )
+                return false;
+
+            while ( nFree - nHome >= c_nNeighbourhood ) {
+                size_t nIdx = nFree - ( c_nNeighbourhood - 1 );
+                for ( ; nIdx < nFree; ++nIdx ) {
+                    node_type * p = t.pBuckets[nIdx].m_pNode.load( atomics::memory_order_relaxed );
+                    size_t const nItemHome = t.home( p->m_nHash );
+                    if ( nFree - nItemHome < c_nNeighbourhood ) {
+                        bucket& home = t.pBuckets[nItemHome];
+                        t.pBuckets[nFree].m_pNode.store( p, atomics::memory_order_relaxed );
+                        t.pBuckets[nIdx].m_pNode.store( nullptr, atomics::memory_order_relaxed );
+                        home.m_nHopInfo.store(
+                            ( home.m_nHopInfo.load( atomics::memory_order_relaxed ) | hop_bit( nFree - nItemHome )) & ~hop_bit( nIdx - nItemHome ),
+                            atomics::memory_order_relaxed );
+                        break;
+                    }
+                }
+                if ( nIdx == nFree )
+                    return false;
+                nFree = nIdx;
+            }
+
+            bucket& home = t.pBuckets[nHome];
+            t.pBuckets[nFree].m_pNode.store( pNode, atomics::memory_order_relaxed );
+            home.m_nHopInfo.store( home.m_nHopInfo.load( atomics::memory_order_relaxed ) | hop_bit( nFree - nHome ), atomics::memory_order_relaxed );
+            return true;
+        }
+
+        // Doubles the bucket table if it is still pOld
+        void resize( bucket_table * pOld )
+        {
+            {
+                std::unique_lock< lock_array_type > al( m_Locks );
+                if ( m_pTable.load( atomics::memory_order_relaxed ) != pOld )
+                    return;
+
+                size_t nCapacity = pOld->nCapacity;
+                bucket_table * pNew;
+                do {
+                    nCapacity *= 2;
+                    pNew = alloc_table( nCapacity );
+                    for ( size_t i = 0, nCount = pOld->bucket_count(); i < nCount; ++i ) {
+                        node_type * p = pOld->pBuckets[i].m_pNode.load( atomics::memory_order_relaxed );
+                        assert( p != busy_node());
+                        if ( p && !place_exclusive( *pNew, p )) {
+                            free_table( pNew );
+                            pNew = nullptr;
+                            break;
+                        }
+                    }
+                } while ( !pNew );
+
+                m_pTable.store( pNew, atomics::memory_order_release );
+                m_Stat.onResize();
+            }
+
+            // the items are moved to new table, the old one can be freed when the readers are done
+            m_Readers.synchronize();
+            free_table( pOld );
+        }
+
+        template <typename Q, typename Predicate, typename Func>
+        bool erase_at( Q const& key, Predicate pred, Func f )
+        {
+            size_t const nHash = m_Hash( key );
+            node_type * pNode;
+            {
+                segment_guard sg( *this, nHash );
+                bucket_table& t = sg.table();
+                std::pair<node_type *, size_t> pos = locked_find( t, sg.home(), nHash, key, pred );
+                pNode = pos.first;
+                if ( !pNode ) {
+                    m_Stat.onEraseFailed();
+                    return false;
+                }
+
+                bucket& home = t.pBuckets[sg.home()];
+                home.m_nHopInfo.store( home.m_nHopInfo.load( atomics::memory_order_relaxed ) & ~hop_bit( pos.second - sg.home()), atomics::memory_order_release );
+                t.pBuckets[pos.second].m_pNode.store( nullptr, atomics::memory_order_release );
+                --m_ItemCounter;
+
+                f( pNode->m_Value );
+            }
+
+            m_Stat.onEraseSuccess();
+            retire( pNode );
+            return true;
+        }
+
+        // Frees the erased node when the lock-free readers are done. Must be called without any segment lock
+        void retire( node_type * pNode )
+        {
+            std::vector<node_type *> batch;
+            {
+                std::unique_lock< std::mutex > l( m_RetireLock );
+                m_Retired.push_back( pNode );
+                if ( m_Retired.size() < c_nReclaimBatchSize )
+                    return;
+                batch.swap( m_Retired );
+                m_Retired.reserve( c_nReclaimBatchSize );
+            }
+
+            m_Readers.synchronize();
+            m_Stat.onReclaimBatch();
+            for ( node_type * p : batch )
+                free_node( p );
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_HOPSCOTCH_SET_H
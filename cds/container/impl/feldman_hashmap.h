@@ -133,6 +133,8 @@ namespace cds { namespace container {
         /// The size of \p hash_type in bytes, see \p feldman_hashmap::traits::hash_size for explanation
         static constexpr size_t const c_hash_size = base_class::c_hash_size;
 
+        static constexpr size_t const c_nFindBatchSize = 16; ///< Count of keys \p find_batch() prefetches at once
+
         /// Level statistics
         typedef feldman_hashmap::level_statistics level_statistics;
 
@@ -326,6 +328,15 @@ namespace cds { namespace container {
     protected:
         //@cond
         hasher  m_Hasher;
+
+        template <typename K>
+        void check_hash( K const& key, hash_type const& hash )
+        {
+            // hash passed to %_with_hash function must be the hash value of key_type( key )
+            assert( hash_comparator()( m_Hasher( key_type( key )), hash ) == 0 );
+            CDS_UNUSED( key );
+            CDS_UNUSED( hash );
+        }
         //@endcond
 
     public:
@@ -517,6 +528,34 @@ namespace cds { namespace container {
             return base_class::erase( m_Hasher( key_type( key )), [&f]( node_type& node) { f( node.m_Value ); } );
         }
 
+        /// Deletes \p key from the map using precomputed hash value
+        /** \anchor cds_container_FeldmanHashMap_hp_erase_with_hash
+            The function is an analog of \p erase( K const& ) but \p hash is used as the hash value of \p key
+            instead of calling the hash functor for <tt>key_type( key )</tt>.
+            It is useful when the key is hashed once and then looked up in several maps.
+
+            \p hash must be equal to <tt>hash( key_type( key ))</tt>; in debug mode it is checked by an assertion.
+            The same requirement is for all \p %_with_hash functions.
+        */
+        template <typename K>
+        bool erase_with_hash( K const& key, hash_type const& hash )
+        {
+            check_hash( key, hash );
+            return base_class::erase( hash );
+        }
+
+        /// Deletes \p key from the map using precomputed hash value
+        /**
+            The function is an analog of \p erase( K const&, Func ) but \p hash is used as the hash value of \p key,
+            see \ref cds_container_FeldmanHashMap_hp_erase_with_hash "erase_with_hash()".
+        */
+        template <typename K, typename Func>
+        bool erase_with_hash( K const& key, hash_type const& hash, Func f )
+        {
+            check_hash( key, hash );
+            return base_class::erase( hash, [&f]( node_type& node) { f( node.m_Value ); } );
+        }
+
         /// Deletes the element pointed by iterator \p iter
         /**
             Returns \p true if the operation is successful, \p false otherwise.
@@ -584,6 +623,18 @@ namespace cds { namespace container {
             return base_class::contains( m_Hasher( key_type( key )));
         }
 
+        /// Checks whether the map contains \p key using precomputed hash value
+        /**
+            The function is an analog of \p contains( K const& ) but \p hash is used as the hash value of \p key,
+            see \ref cds_container_FeldmanHashMap_hp_erase_with_hash "erase_with_hash()".
+        */
+        template <typename K>
+        bool contains_with_hash( K const& key, hash_type const& hash )
+        {
+            check_hash( key, hash );
+            return base_class::contains( hash );
+        }
+
         /// Find the key \p key
         /**
 
@@ -607,6 +658,72 @@ namespace cds { namespace container {
             return base_class::find( m_Hasher( key_type( key )), [&f]( node_type& node ) { f( node.m_Value );});
         }
 
+        /// Finds \p key using precomputed hash value
+        /**
+            The function is an analog of \p find( K const&, Func ) but \p hash is used as the hash value of \p key,
+            see \ref cds_container_FeldmanHashMap_hp_erase_with_hash "erase_with_hash()".
+        */
+        template <typename K, typename Func>
+        bool find_with_hash( K const& key, hash_type const& hash, Func f )
+        {
+            check_hash( key, hash );
+            return base_class::find( hash, [&f]( node_type& node ) { f( node.m_Value );});
+        }
+
+        /// Finds a batch of keys
+        /**
+            The function searches \p nCount keys of \p keys array by their hashes <tt>hash( key_type( key ))</tt>
+            and calls the functor \p f for each item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( size_t nIndex, value_type& item );
+            };
+            \endcode
+            where \p nIndex is the index of the key in \p keys array, \p item is the item found.
+
+            The keys are processed by groups of \p c_nFindBatchSize keys in stages, each stage is done
+            for all keys of the group before the next one: the function hashes the keys and prefetches
+            their slots of the head array node, then prefetches the nodes these slots refer to,
+            then makes the first step down the trie and prefetches the targets of the slots of the next level,
+            and at last searches the keys one by one. Thus the cache misses of the first levels of the trie
+            are overlapped instead of being paid for each key in turn.
+            The result is the same as a loop of \p find() calls.
+
+            The function returns the number of keys found.
+        */
+        template <typename K, typename Func>
+        size_t find_batch( K const* keys, size_t nCount, Func f )
+        {
+            static_assert( std::is_trivially_destructible<hash_type>::value, "hash_type must be trivially destructible" );
+            // hash_type may have no default constructor
+            typename std::aligned_storage< sizeof( hash_type ), alignof( hash_type )>::type arrHashStorage[c_nFindBatchSize];
+            hash_type * arrHash = reinterpret_cast<hash_type *>( arrHashStorage );
+            size_t nFound = 0;
+
+            for ( size_t nFirst = 0; nFirst < nCount; nFirst += c_nFindBatchSize ) {
+                size_t const nGroupSize = nCount - nFirst < c_nFindBatchSize ? nCount - nFirst : c_nFindBatchSize;
+
+                for ( size_t i = 0; i < nGroupSize; ++i ) {
+                    new( arrHash + i ) hash_type( m_Hasher( key_type( keys[nFirst + i] )));
+                    base_class::prefetch_head_slot( arrHash[i] );
+                }
+
+                for ( size_t i = 0; i < nGroupSize; ++i )
+                    base_class::prefetch_head_child( arrHash[i] );
+
+                for ( size_t i = 0; i < nGroupSize; ++i )
+                    base_class::prefetch_first_step( arrHash[i] );
+
+                for ( size_t i = 0; i < nGroupSize; ++i ) {
+                    size_t const nIndex = nFirst + i;
+                    if ( base_class::find( arrHash[i], [&f, nIndex]( node_type& node ) { f( nIndex, node.m_Value ); } ))
+                        ++nFound;
+                }
+            }
+            return nFound;
+        }
+
         /// Finds the key \p key and return the item found
         /**
             The function searches the item with a hash equal to <tt>hash( key_type( key ))</tt>
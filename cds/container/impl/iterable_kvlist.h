@@ -7,6 +7,8 @@
 #define CDSLIB_CONTAINER_IMPL_ITERABLE_KVLIST_H
 
 #include <memory>
+#include <vector>
+#include <algorithm>
 #include <cds/container/details/guarded_ptr_cast.h>
 
 namespace cds { namespace container {
@@ -649,6 +651,44 @@ namespace cds { namespace container {
             return base_class::statistics();
         }
 
+        //@cond
+        // find_batch() support
+        void prefetch_first() const
+        {
+            base_class::prefetch_first();
+        }
+
+        void prefetch_second() const
+        {
+            base_class::prefetch_second();
+        }
+        //@endcond
+
+        //@cond
+        // bulk_load() support: inserts the items first[*p] for p in [pIdx, pEnd).
+        // The new items are sorted and merged into the list, so an empty list takes all of them at once.
+        // Returns the count of inserted items; if a key is repeated, its first occurrence is inserted
+        template <typename RandomIt>
+        size_t bulk_insert( RandomIt first, size_t const* pIdx, size_t const* pEnd )
+        {
+            std::vector<value_type *> arrData;
+            arrData.reserve( static_cast<size_t>( pEnd - pIdx ));
+            try {
+                for ( ; pIdx != pEnd; ++pIdx )
+                    arrData.push_back( base_class::alloc_data( value_type( key_type( first[*pIdx].first ), mapped_type( first[*pIdx].second ))));
+            }
+            catch ( ... ) {
+                for ( value_type * pData : arrData )
+                    base_class::free_data( pData );
+                throw;
+            }
+
+            key_comparator cmp;
+            std::stable_sort( arrData.begin(), arrData.end(), [&cmp]( value_type const* p1, value_type const* p2 ) { return cmp( p1->first, p2->first ) < 0; } );
+            return base_class::merge_at( base_class::head(), arrData.data(), arrData.data() + arrData.size(), []( value_type& val ) { base_class::free_data( &val ); } );
+        }
+        //@endcond
+
     protected:
         //@cond
         // Split-list support
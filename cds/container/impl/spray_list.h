@@ -0,0 +1,253 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_IMPL_SPRAY_LIST_H
+#define CDSLIB_CONTAINER_IMPL_SPRAY_LIST_H
+
+#include <thread>       // std::thread::hardware_concurrency
+#include <cds/algo/int_algo.h>
+#include <cds/algo/xorshift.h>
+
+namespace cds { namespace container {
+
+    /// Skip-list based lock-free priority queue
+    /** @ingroup cds_nonintrusive_priority_queue
+        Source:
+            - [2015] J.Lindén, B.Jonsson "A Skiplist-Based Concurrent Priority Queue with Minimal Memory Contention"
+            - [2015] D.Alistarh, J.Kopinsky, J.Li, N.Shavit "The SprayList: A Scalable Relaxed Priority Queue"
+
+        The priority queue is an adapter over \p cds::intrusive::SkipListSet. The items are sorted in descending order
+        of priority, so the item with the highest priority (the greatest one by \p compare / \p less, like in \p MSPriorityQueue)
+        is the first item of the skip-list. The items with equal priority are allowed.
+
+        \p pop() can work in two modes specified by \p spray_list::traits::relaxed:
+        - strict mode (the default) is Lindén-Jonsson algorithm: \p pop() logically deletes the first live item
+          of the skip-list but does not unlink it. So, the logically deleted items form a prefix of the skip-list.
+          When a thread passes more than \p spray_list::traits::bound_offset deleted items, it unlinks
+          the whole prefix by one CAS per level. Thus, the contention on the head of the list is reduced.
+        - relaxed mode is SprayList algorithm: \p pop() makes a random walk ("spray") from the head of the skip-list.
+          The walk starts at level <tt>log P + 1</tt> where \p P is the number of threads, makes a random number
+          of forward steps in range <tt>[0, log^3 P]</tt> on each level and then descends to the next level.
+          The item the walk lands on is removed. Thus, \p pop() returns one of <tt>O( P * log^3 P )</tt> first items,
+          and the concurrent \p pop() calls remove different items with high probability.
+          If the walk fails, \p pop() falls back to the strict mode.
+
+        The underlying skip-list still helps to unlink deleted nodes met in \p push(),
+        so the prefix is deleted in batch mostly when \p pop() prevails.
+
+        Template parameters:
+        - \p GC - Garbage collector used: \p cds::gc::HP, \p cds::gc::DHP or \ref cds_urcu_gc "RCU" type
+        - \p T - type to be stored in the queue. The priority is a part of \p T type.
+        - \p Traits - the traits. See \p spray_list::traits for explanation.
+             It is possible to declare option-based queue with \p spray_list::make_traits
+             metafunction instead of \p Traits template argument.
+
+        @note You should include the header for the GC used: <tt><cds/container/spray_list_hp.h></tt>,
+        <tt><cds/container/spray_list_dhp.h></tt> or <tt><cds/container/spray_list_rcu.h></tt>.
+        For RCU, all member functions should be called outside of RCU critical section.
+    */
+    template <
+        typename GC,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        typename Traits = spray_list::traits
+#else
+        typename Traits
+#endif
+    >
+    class SprayList:
+#ifdef CDS_DOXYGEN_INVOKED
+        protected intrusive::SkipListSet< GC, T, Traits >
+#else
+        protected details::make_spray_list< GC, T, Traits >::type
+#endif
+    {
+        //@cond
+        typedef details::make_spray_list< GC, T, Traits > maker;
+        typedef typename maker::type base_class;
+        //@endcond
+
+    public:
+        typedef GC          gc;         ///< Garbage collector
+        typedef T           value_type; ///< Value type stored in the queue
+        typedef Traits      traits;     ///< Traits template parameter
+
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator  ;    ///< priority comparing functor based on opt::compare and opt::less option setter.
+#   else
+        typedef typename maker::key_comparator key_comparator;
+#   endif
+
+        typedef typename traits::stat   stat;   ///< internal statistics type
+        typedef typename traits::copy_policy copy_policy; ///< Copy policy used in \p pop()
+
+        static constexpr const bool   c_bRelaxed = traits::relaxed;          ///< Relaxed mode of \p pop()
+        static constexpr const size_t c_nBoundOffset = traits::bound_offset; ///< Deleted prefix length that triggers the prefix unlinking
+
+    protected:
+        //@cond
+        typedef typename maker::node_type       node_type;
+        typedef typename maker::node_allocator  node_allocator;
+        typedef std::unique_ptr< node_type, typename maker::node_deallocator > scoped_node_ptr;
+        //@endcond
+
+    protected:
+        //@cond
+        unsigned int const  m_nSprayHeight;
+        unsigned int const  m_nSprayJump;
+        mutable stat        m_Stat;
+        //@endcond
+
+    public:
+        /// Constructs empty priority queue for \p std::thread::hardware_concurrency() threads
+        SprayList()
+            : SprayList( std::thread::hardware_concurrency())
+        {}
+
+        /// Constructs empty priority queue
+        /**
+            \p nThreadCount is the number of threads working with the queue, it defines the parameters
+            of the spray walk in relaxed mode. If \p nThreadCount is less than 2, the relaxed mode is the same as strict one.
+        */
+        explicit SprayList( unsigned int nThreadCount )
+            : m_nSprayHeight( nThreadCount < 2 ? 0 : static_cast<unsigned int>( cds::beans::log2floor( nThreadCount )) + 1 )
+            , m_nSprayJump( m_nSprayHeight ? ( m_nSprayHeight - 1 ) * ( m_nSprayHeight - 1 ) * ( m_nSprayHeight - 1 ) : 0 )
+        {}
+
+        /// Inserts the copy of \p val into the queue
+        /**
+            The function returns \p true if success, \p false otherwise.
+        */
+        bool push( value_type const& val )
+        {
+            scoped_node_ptr sp( node_allocator().New( base_class::random_level(), val ));
+            return insert_node( sp );
+        }
+
+        /// Inserts \p val into the queue (move semantics)
+        bool push( value_type&& val )
+        {
+            scoped_node_ptr sp( node_allocator().New( base_class::random_level(), std::move( val )));
+            return insert_node( sp );
+        }
+
+        /// Inserts a new item created from \p args arguments into the queue
+        template <typename... Args>
+        bool emplace( Args&&... args )
+        {
+            scoped_node_ptr sp( node_allocator().New( base_class::random_level(), std::forward<Args>( args )... ));
+            return insert_node( sp );
+        }
+
+        /// Extracts an item with high priority
+        /**
+            If the priority queue is empty, the function returns \p false.
+            Otherwise, it returns \p true and \p dest contains the copy of the item extracted.
+            The item is copied by \p copy_policy.
+
+            In relaxed mode the item extracted may be not the item with the highest priority in the queue.
+        */
+        bool pop( value_type& dest )
+        {
+            return pop_with( [&dest]( value_type const& src ) { copy_policy()( dest, src ); } );
+        }
+
+        /// Extracts an item with high priority
+        /**
+            If the priority queue is empty, the function returns \p false.
+            Otherwise, it calls \p f functor with the item extracted and returns \p true.
+
+            The functor takes one argument - a const reference to the item being removed:
+            \code
+            cds:container::SprayList< cds::gc::HP, Foo > myQueue;
+            Bar bar;
+            myQueue.pop_with( [&bar]( Foo const& src ) { bar = src;});
+            \endcode
+            The item cannot be moved from since other threads can read it while searching the skip-list.
+        */
+        template <typename Func>
+        bool pop_with( Func f )
+        {
+            auto fn = [&f]( node_type const& node ) { f( node.m_Value ); };
+
+            if ( c_bRelaxed && m_nSprayHeight ) {
+                uint32_t (*rnd)() = &cds::algo::xorshift32;
+                if ( base_class::spray_delete( m_nSprayHeight, m_nSprayJump, rnd, fn )) {
+                    m_Stat.onSprayPop();
+                    m_Stat.onPop();
+                    return true;
+                }
+                m_Stat.onSprayFailed();
+            }
+
+            size_t nPrefixLen;
+            bool const bRet = base_class::delete_min_lazy( fn, nPrefixLen );
+            if ( nPrefixLen >= c_nBoundOffset )
+                m_Stat.onPrefixUnlink( base_class::unlink_deleted_prefix());
+
+            if ( bRet )
+                m_Stat.onPop();
+            else
+                m_Stat.onPopEmpty();
+            return bRet;
+        }
+
+        /// Clears the queue (not atomic)
+        /**
+            The function is not atomic, but thread-safe.
+            For RCU, the function should be called outside of RCU critical section.
+        */
+        void clear()
+        {
+            base_class::clear();
+        }
+
+        /// Checks is the priority queue is empty
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /// Returns current size of priority queue
+        size_t size() const
+        {
+            return base_class::size();
+        }
+
+        /// Returns the start level of the spray walk, 0 means the spray walk is disabled
+        unsigned int spray_height() const
+        {
+            return m_nSprayHeight;
+        }
+
+        /// Returns max length of the spray walk at each level
+        unsigned int spray_jump() const
+        {
+            return m_nSprayJump;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        bool insert_node( scoped_node_ptr& sp )
+        {
+            if ( base_class::insert( *sp )) {
+                sp.release();
+                m_Stat.onPush();
+                return true;
+            }
+            return false;
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_IMPL_SPRAY_LIST_H
@@ -7,6 +7,8 @@
 #define CDSLIB_CONTAINER_MICHAEL_KVLIST_RCU_H
 
 #include <memory>
+#include <vector>
+#include <algorithm>
 #include <functional>   // ref
 #include <cds/container/details/michael_list_base.h>
 #include <cds/intrusive/michael_list_rcu.h>
@@ -787,6 +789,44 @@ namespace cds { namespace container {
             return base_class::statistics();
         }
 
+        //@cond
+        // find_batch() support
+        void prefetch_first() const
+        {
+            base_class::prefetch_first();
+        }
+
+        void prefetch_second() const
+        {
+            base_class::prefetch_second();
+        }
+        //@endcond
+
+        //@cond
+        // bulk_load() support: inserts the items first[*p] for p in [pIdx, pEnd).
+        // The new nodes are sorted and merged into the list, so an empty list takes all of them at once.
+        // Returns the count of inserted items; if a key is repeated, its first occurrence is inserted
+        template <typename RandomIt>
+        size_t bulk_insert( RandomIt first, size_t const* pIdx, size_t const* pEnd )
+        {
+            std::vector<node_type *> arrNode;
+            arrNode.reserve( static_cast<size_t>( pEnd - pIdx ));
+            try {
+                for ( ; pIdx != pEnd; ++pIdx )
+                    arrNode.push_back( alloc_node( first[*pIdx].first, first[*pIdx].second ));
+            }
+            catch ( ... ) {
+                for ( node_type * pNode : arrNode )
+                    free_node( pNode );
+                throw;
+            }
+
+            intrusive_key_comparator cmp;
+            std::stable_sort( arrNode.begin(), arrNode.end(), [&cmp]( node_type const* p1, node_type const* p2 ) { return cmp( *p1, *p2 ) < 0; } );
+            return base_class::merge_at( head(), arrNode.data(), arrNode.data() + arrNode.size(), []( node_type& node ) { free_node( &node ); } );
+        }
+        //@endcond
+
         /// Clears the list
         /**
             Post-condition: the list is empty
@@ -9,6 +9,8 @@
 #include <cds/container/details/michael_map_base.h>
 #include <cds/container/details/iterable_list_base.h>
 #include <cds/details/allocator.h>
+#include <cds/container/details/bulk_load.h>
+#include <algorithm>
 
 namespace cds { namespace container {
 
@@ -147,6 +149,7 @@ namespace cds { namespace container {
         static_assert( std::is_same<gc, typename ordered_list::gc>::value, "GC and OrderedList::gc must be the same");
 
         static constexpr const size_t c_nHazardPtrCount = ordered_list::c_nHazardPtrCount; ///< Count of hazard pointer required
+        static constexpr const size_t c_nFindBatchSize = 16; ///< Count of keys \p find_batch() prefetches at once
 
         //@cond
         typedef typename ordered_list::template select_stat_wrapper< typename ordered_list::stat > bucket_stat;
@@ -412,6 +415,24 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Inserts new node with precomputed hash value
+        /** \anchor cds_nonintrusive_MichaelHashMap_hp_insert_with_hash
+            The function is an analog of \p insert( K&& ) but \p nHash is used as the hash value of \p key
+            instead of calling the hash functor. It is useful when the key is hashed once and then looked up in several containers.
+
+            \p nHash must be equal to the value of the hash functor for \p key; in debug mode it is checked by an assertion.
+            The same requirement is for all \p %_with_hash functions.
+        */
+        template <typename K>
+        bool insert_with_hash( K&& key, size_t nHash )
+        {
+            check_hash( key, nHash );
+            const bool bRet = bucket_by_hash( nHash ).insert( std::forward<K>( key ));
+            if ( bRet )
+                ++m_ItemCounter;
+            return bRet;
+        }
+
         /// Inserts new node
         /**
             The function creates a node with copy of \p val value
@@ -432,6 +453,21 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Inserts new node with precomputed hash value
+        /**
+            The function is an analog of \p insert( K&&, V&& ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashMap_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K, typename V>
+        bool insert_with_hash( K&& key, size_t nHash, V&& val )
+        {
+            check_hash( key, nHash );
+            const bool bRet = bucket_by_hash( nHash ).insert( std::forward<K>( key ), std::forward<V>( val ));
+            if ( bRet )
+                ++m_ItemCounter;
+            return bRet;
+        }
+
         /// Inserts new node and initialize it by a functor
         /**
             This function inserts new node with key \p key and if inserting is successful then it calls
@@ -535,6 +571,21 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Updates data by \p key using precomputed hash value
+        /**
+            The function is an analog of \p update() but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashMap_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K, typename Func >
+        std::pair<bool, bool> update_with_hash( K&& key, size_t nHash, Func func, bool bAllowInsert = true )
+        {
+            check_hash( key, nHash );
+            std::pair<bool, bool> bRet = bucket_by_hash( nHash ).update( std::forward<K>( key ), func, bAllowInsert );
+            if ( bRet.first && bRet.second )
+                ++m_ItemCounter;
+            return bRet;
+        }
+
         /// Inserts or updates the node (only for \p IterableKVList)
         /**
             The operation performs inserting or changing data with lock-free manner.
@@ -578,6 +629,75 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Inserts the items of the range [\p first, \p last) using \p nThreads threads
+        /** \anchor cds_nonintrusive_MichaelHashMap_hp_bulk_load
+            The function is intended for fast initial population of the map.
+            \p Iterator is a random-access iterator; its value type has \p first and \p second fields like \p std::pair,
+            \p key_type should be constructible from \p first and \p mapped_type from \p second.
+
+            The keys of the range are hashed once and partitioned by the hash value, so the keys of different partitions
+            fall into different buckets. Then \p nThreads threads (the current one and <tt>nThreads - 1</tt> new threads)
+            load the partitions straight into their buckets.
+            For small ranges fewer threads are used; \p nThreads <= 1 means loading in the current thread only.
+
+            If the map is empty when the function is called, the nodes of each bucket are sorted and linked privately,
+            then the chain is published in the bucket by one CAS (by one store under the locks of the neighbour nodes
+            for \p LazyKVList). The item counter is increased by the total count of inserted items once after loading,
+            so \p size() does not count the items loaded until the function returns.
+            If the map is not empty, the items are inserted one by one like \p insert() does, each insertion updates the item counter.
+            Note that with \p atomicity::empty_item_counter the map is always considered empty.
+
+            Concurrency guarantees: the map may be used by other threads during the loading.
+            A chain is published only if the neighbour nodes are still adjacent, otherwise it is merged with the nodes
+            inserted by other threads, so no item is lost. The items loaded into a bucket appear in the map at once
+            for an empty map or one by one otherwise.
+            If a key is already in the map the item is not inserted; if a key is repeated in the range, its first occurrence is inserted.
+            The new threads are attached to the GC by \p cds::threading::Manager::attachThread() for the loading time,
+            so the GC must allow <tt>nThreads - 1</tt> additional threads.
+
+            If an insertion throws (for example, \p std::bad_alloc), the exception is rethrown in the calling thread
+            after all loading threads have finished; the items inserted before stay in the map and are counted by \p size().
+
+            Returns the count of inserted items.
+        */
+        template <typename Iterator>
+        size_t bulk_load( Iterator first, Iterator last, size_t nThreads = 1 )
+        {
+            typedef typename std::iterator_traits<Iterator>::value_type item_type;
+            auto hash_func = [this]( item_type const& item ) { return m_HashFunctor( item.first ); };
+
+            if ( !empty()) {
+                return cds::container::details::bulk_loader::load( first, last, nThreads, hash_func,
+                    [this]( item_type const& item, size_t nHash ) {
+                        if ( bucket_by_hash( nHash ).insert( item.first, item.second )) {
+                            ++m_ItemCounter;
+                            return true;
+                        }
+                        return false;
+                    });
+            }
+
+            // A partition consists of whole buckets since the bucket count is a power of 2
+            return cds::container::details::bulk_loader::load_partitions( first, last, nThreads, bucket_count(), m_ItemCounter, hash_func,
+                []( size_t /*nPartCount*/ ) {},
+                [this, first]( size_t /*nPart*/, size_t /*nPartCount*/, size_t* pIdx, size_t* pEnd, size_t const* pHash, size_t& nLoaded ) {
+                    // Groups the items by bucket keeping the order of the range in a bucket
+                    size_t const nMask = m_nHashBitmask;
+                    std::sort( pIdx, pEnd, [pHash, nMask]( size_t i, size_t j ) {
+                        return ( pHash[i] & nMask ) < ( pHash[j] & nMask ) || (( pHash[i] & nMask ) == ( pHash[j] & nMask ) && i < j );
+                    });
+
+                    while ( pIdx != pEnd ) {
+                        size_t const nBucket = pHash[*pIdx] & nMask;
+                        size_t* pBucketEnd = pIdx + 1;
+                        while ( pBucketEnd != pEnd && ( pHash[*pBucketEnd] & nMask ) == nBucket )
+                            ++pBucketEnd;
+                        nLoaded += m_Buckets[nBucket].bulk_insert( first, pIdx, pBucketEnd );
+                        pIdx = pBucketEnd;
+                    }
+                });
+        }
+
         /// Deletes \p key from the map
         /** \anchor cds_nonintrusive_MichaelMap_erase_val
 
@@ -592,6 +712,21 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Deletes \p key from the map using precomputed hash value
+        /**
+            The function is an analog of \p erase( K const& ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashMap_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K>
+        bool erase_with_hash( K const& key, size_t nHash )
+        {
+            check_hash( key, nHash );
+            const bool bRet = bucket_by_hash( nHash ).erase( key );
+            if ( bRet )
+                --m_ItemCounter;
+            return bRet;
+        }
+
         /// Deletes the item from the map using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_nonintrusive_MichaelMap_erase_val "erase(K const&)"
@@ -632,6 +767,21 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Deletes \p key from the map using precomputed hash value
+        /**
+            The function is an analog of \p erase( K const&, Func ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashMap_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K, typename Func>
+        bool erase_with_hash( K const& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            const bool bRet = bucket_by_hash( nHash ).erase( key, f );
+            if ( bRet )
+                --m_ItemCounter;
+            return bRet;
+        }
+
         /// Deletes the item from the map using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_nonintrusive_MichaelMap_erase_func "erase(K const&, Func)"
@@ -754,6 +904,18 @@ namespace cds { namespace container {
             return bucket( key ).find( key, f );
         }
 
+        /// Finds \p key using precomputed hash value
+        /**
+            The function is an analog of \p find( K const&, Func ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashMap_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K, typename Func>
+        bool find_with_hash( K const& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            return bucket_by_hash( nHash ).find( key, f );
+        }
+
         /// Finds \p key and returns iterator pointed to the item found (only for \p IterableList)
         /**
             If \p key is not found the function returns \p end().
@@ -814,6 +976,58 @@ namespace cds { namespace container {
             return iterator( it, &b, bucket_end());
         }
 
+        /// Finds a batch of keys
+        /** \anchor cds_nonintrusive_MichaelMap_find_batch
+
+            The function searches \p nCount keys of \p keys array and calls the functor \p f for each item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( size_t nIndex, value_type& item );
+            };
+            \endcode
+            where \p nIndex is the index of the key in \p keys array, \p item is the item found.
+
+            The keys are processed by groups of \p c_nFindBatchSize keys in stages, each stage is done
+            for all keys of the group before the next one: the function hashes the keys and prefetches their buckets,
+            then prefetches the first nodes of the bucket lists, then makes the first step of the list search
+            and prefetches the nodes next to the first ones, and at last searches the keys one by one.
+            Thus the cache misses on the bucket table and on the heads of the bucket lists are overlapped
+            instead of being paid for each key in turn.
+            The result is the same as a loop of \ref cds_nonintrusive_MichaelMap_find_cfunc "find(K const&, Func)" calls
+            including the guarantees for the functor \p f.
+
+            The function returns the number of keys found.
+        */
+        template <typename K, typename Func>
+        size_t find_batch( K const* keys, size_t nCount, Func f )
+        {
+            internal_bucket_type* arrBucket[c_nFindBatchSize];
+            size_t nFound = 0;
+
+            for ( size_t nFirst = 0; nFirst < nCount; nFirst += c_nFindBatchSize ) {
+                size_t const nGroupSize = nCount - nFirst < c_nFindBatchSize ? nCount - nFirst : c_nFindBatchSize;
+
+                for ( size_t i = 0; i < nGroupSize; ++i ) {
+                    arrBucket[i] = &bucket( keys[nFirst + i] );
+                    cds_prefetch( arrBucket[i] );
+                }
+
+                for ( size_t i = 0; i < nGroupSize; ++i )
+                    arrBucket[i]->prefetch_first();
+
+                for ( size_t i = 0; i < nGroupSize; ++i )
+                    arrBucket[i]->prefetch_second();
+
+                for ( size_t i = 0; i < nGroupSize; ++i ) {
+                    size_t const nIndex = nFirst + i;
+                    if ( arrBucket[i]->find( keys[nIndex], [&f, nIndex]( value_type& item ) { f( nIndex, item ); } ))
+                        ++nFound;
+                }
+            }
+            return nFound;
+        }
+
         /// Checks whether the map contains \p key
         /**
             The function searches the item with key equal to \p key
@@ -825,6 +1039,18 @@ namespace cds { namespace container {
             return bucket( key ).contains( key );
         }
 
+        /// Checks whether the map contains \p key using precomputed hash value
+        /**
+            The function is an analog of <tt>contains( key )</tt> but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashMap_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K>
+        bool contains_with_hash( K const& key, size_t nHash )
+        {
+            check_hash( key, nHash );
+            return bucket_by_hash( nHash ).contains( key );
+        }
+
         /// Checks whether the map contains \p key using \p pred predicate for searching
         /**
             The function is an analog of <tt>contains( key )</tt> but \p pred is used for key comparing.
@@ -944,6 +1170,21 @@ namespace cds { namespace container {
         {
             return m_Buckets[hash_value( key )];
         }
+
+        /// Returns the bucket (ordered list) for precomputed hash value \p nHash
+        internal_bucket_type& bucket_by_hash( size_t nHash )
+        {
+            return m_Buckets[nHash & m_nHashBitmask];
+        }
+
+        /// Checks (in debug mode only) that \p nHash passed to \p %_with_hash function is the hash value of \p key
+        template <typename Q>
+        void check_hash( Q const& key, size_t nHash ) const
+        {
+            assert( m_HashFunctor( key ) == nHash );
+            CDS_UNUSED( key );
+            CDS_UNUSED( nHash );
+        }
         //@endcond
 
     private:
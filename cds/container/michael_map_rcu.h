@@ -8,6 +8,8 @@
 
 #include <cds/container/details/michael_map_base.h>
 #include <cds/details/allocator.h>
+#include <cds/container/details/bulk_load.h>
+#include <algorithm>
 
 namespace cds { namespace container {
 
@@ -81,6 +83,8 @@ namespace cds { namespace container {
         /// Group of \p extract_xxx functions require external locking if underlying ordered list requires that
         static constexpr const bool c_bExtractLockExternal = ordered_list::c_bExtractLockExternal;
 
+        static constexpr const size_t c_nFindBatchSize = 16; ///< Count of keys \p find_batch() prefetches at once
+
         // GC and OrderedList::gc must be the same
         static_assert(std::is_same<gc, typename ordered_list::gc>::value, "GC and OrderedList::gc must be the same");
 
@@ -347,6 +351,24 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Inserts new node with precomputed hash value
+        /** \anchor cds_nonintrusive_MichaelHashMap_rcu_insert_with_hash
+            The function is an analog of \p insert( K const& ) but \p nHash is used as the hash value of \p key
+            instead of calling the hash functor. It is useful when the key is hashed once and then looked up in several containers.
+
+            \p nHash must be equal to the value of the hash functor for \p key; in debug mode it is checked by an assertion.
+            The same requirement is for all \p %_with_hash functions.
+        */
+        template <typename K>
+        bool insert_with_hash( const K& key, size_t nHash )
+        {
+            check_hash( key, nHash );
+            const bool bRet = bucket_by_hash( nHash ).insert( key );
+            if ( bRet )
+                ++m_ItemCounter;
+            return bRet;
+        }
+
         /// Inserts new node
         /**
             The function creates a node with copy of \p val value
@@ -369,6 +391,21 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Inserts new node with precomputed hash value
+        /**
+            The function is an analog of \p insert( K const&, V const& ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashMap_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K, typename V>
+        bool insert_with_hash( K const& key, size_t nHash, V const& val )
+        {
+            check_hash( key, nHash );
+            const bool bRet = bucket_by_hash( nHash ).insert( key, val );
+            if ( bRet )
+                ++m_ItemCounter;
+            return bRet;
+        }
+
         /// Inserts new node and initialize it by a functor
         /**
             This function inserts new node with key \p key and if inserting is successful then it calls
@@ -459,6 +496,21 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Updates data by \p key using precomputed hash value
+        /**
+            The function is an analog of \p update() but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashMap_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> update_with_hash( K const& key, size_t nHash, Func func, bool bAllowInsert = true )
+        {
+            check_hash( key, nHash );
+            std::pair<bool, bool> bRet = bucket_by_hash( nHash ).update( key, func, bAllowInsert );
+            if ( bRet.second )
+                ++m_ItemCounter;
+            return bRet;
+        }
+
         /// For key \p key inserts data of type \p mapped_type created from \p args
         /**
             \p key_type should be constructible from type \p K
@@ -474,6 +526,76 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Inserts the items of the range [\p first, \p last) using \p nThreads threads
+        /** \anchor cds_nonintrusive_MichaelHashMap_rcu_bulk_load
+            The function is intended for fast initial population of the map.
+            \p Iterator is a random-access iterator; its value type has \p first and \p second fields like \p std::pair,
+            \p key_type should be constructible from \p first and \p mapped_type from \p second.
+
+            The keys of the range are hashed once and partitioned by the hash value, so the keys of different partitions
+            fall into different buckets. Then \p nThreads threads (the current one and <tt>nThreads - 1</tt> new threads)
+            load the partitions straight into their buckets.
+            For small ranges fewer threads are used; \p nThreads <= 1 means loading in the current thread only.
+
+            If the map is empty when the function is called, the nodes of each bucket are sorted and linked privately,
+            then the chain is published in the bucket by one CAS (by one store under the locks of the neighbour nodes
+            for \p LazyKVList). The item counter is increased by the total count of inserted items once after loading,
+            so \p size() does not count the items loaded until the function returns.
+            If the map is not empty, the items are inserted one by one like \p insert() does, each insertion updates the item counter.
+            Note that with \p atomicity::empty_item_counter the map is always considered empty.
+
+            Concurrency guarantees: the map may be used by other threads during the loading.
+            A chain is published only if the neighbour nodes are still adjacent, otherwise it is merged with the nodes
+            inserted by other threads, so no item is lost. The items loaded into a bucket appear in the map at once
+            for an empty map or one by one otherwise.
+            If a key is already in the map the item is not inserted; if a key is repeated in the range, its first occurrence is inserted.
+            The function applies RCU lock internally, it must not be called under RCU lock.
+            The new threads are attached to the GC by \p cds::threading::Manager::attachThread() for the loading time,
+            so the GC must allow <tt>nThreads - 1</tt> additional threads.
+
+            If an insertion throws (for example, \p std::bad_alloc), the exception is rethrown in the calling thread
+            after all loading threads have finished; the items inserted before stay in the map and are counted by \p size().
+
+            Returns the count of inserted items.
+        */
+        template <typename Iterator>
+        size_t bulk_load( Iterator first, Iterator last, size_t nThreads = 1 )
+        {
+            typedef typename std::iterator_traits<Iterator>::value_type item_type;
+            auto hash_func = [this]( item_type const& item ) { return m_HashFunctor( item.first ); };
+
+            if ( !empty()) {
+                return cds::container::details::bulk_loader::load( first, last, nThreads, hash_func,
+                    [this]( item_type const& item, size_t nHash ) {
+                        if ( bucket_by_hash( nHash ).insert( item.first, item.second )) {
+                            ++m_ItemCounter;
+                            return true;
+                        }
+                        return false;
+                    });
+            }
+
+            // A partition consists of whole buckets since the bucket count is a power of 2
+            return cds::container::details::bulk_loader::load_partitions( first, last, nThreads, bucket_count(), m_ItemCounter, hash_func,
+                []( size_t /*nPartCount*/ ) {},
+                [this, first]( size_t /*nPart*/, size_t /*nPartCount*/, size_t* pIdx, size_t* pEnd, size_t const* pHash, size_t& nLoaded ) {
+                    // Groups the items by bucket keeping the order of the range in a bucket
+                    size_t const nMask = m_nHashBitmask;
+                    std::sort( pIdx, pEnd, [pHash, nMask]( size_t i, size_t j ) {
+                        return ( pHash[i] & nMask ) < ( pHash[j] & nMask ) || (( pHash[i] & nMask ) == ( pHash[j] & nMask ) && i < j );
+                    });
+
+                    while ( pIdx != pEnd ) {
+                        size_t const nBucket = pHash[*pIdx] & nMask;
+                        size_t* pBucketEnd = pIdx + 1;
+                        while ( pBucketEnd != pEnd && ( pHash[*pBucketEnd] & nMask ) == nBucket )
+                            ++pBucketEnd;
+                        nLoaded += m_Buckets[nBucket].bulk_insert( first, pIdx, pBucketEnd );
+                        pIdx = pBucketEnd;
+                    }
+                });
+        }
+
         /// Deletes \p key from the map
         /** \anchor cds_nonintrusive_MichaelMap_rcu_erase_val
 
@@ -490,6 +612,21 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Deletes \p key from the map using precomputed hash value
+        /**
+            The function is an analog of \p erase( K const& ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashMap_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K>
+        bool erase_with_hash( const K& key, size_t nHash )
+        {
+            check_hash( key, nHash );
+            const bool bRet = bucket_by_hash( nHash ).erase( key );
+            if ( bRet )
+                --m_ItemCounter;
+            return bRet;
+        }
+
         /// Deletes the item from the map using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_nonintrusive_MichaelMap_rcu_erase_val "erase(K const&)"
@@ -532,6 +669,21 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Deletes \p key from the map using precomputed hash value
+        /**
+            The function is an analog of \p erase( K const&, Func ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashMap_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K, typename Func>
+        bool erase_with_hash( const K& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            const bool bRet = bucket_by_hash( nHash ).erase( key, f );
+            if ( bRet )
+                --m_ItemCounter;
+            return bRet;
+        }
+
         /// Deletes the item from the map using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_nonintrusive_MichaelMap_rcu_erase_func "erase(K const&, Func)"
@@ -639,6 +791,18 @@ namespace cds { namespace container {
             return bucket( key ).find( key, f );
         }
 
+        /// Finds \p key using precomputed hash value
+        /**
+            The function is an analog of \p find( K const&, Func ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashMap_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K, typename Func>
+        bool find_with_hash( K const& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            return bucket_by_hash( nHash ).find( key, f );
+        }
+
         /// Finds the key \p val using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_nonintrusive_MichaelMap_rcu_find_cfunc "find(K const&, Func)"
@@ -652,6 +816,62 @@ namespace cds { namespace container {
             return bucket( key ).find_with( key, pred, f );
         }
 
+        /// Finds a batch of keys
+        /** \anchor cds_nonintrusive_MichaelMap_rcu_find_batch
+
+            The function searches \p nCount keys of \p keys array and calls the functor \p f for each item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( size_t nIndex, value_type& item );
+            };
+            \endcode
+            where \p nIndex is the index of the key in \p keys array, \p item is the item found.
+
+            The keys are processed by groups of \p c_nFindBatchSize keys in stages, each stage is done
+            for all keys of the group before the next one: the function hashes the keys and prefetches their buckets,
+            then prefetches the first nodes of the bucket lists, then makes the first step of the list search
+            and prefetches the nodes next to the first ones, and at last searches the keys one by one.
+            Thus the cache misses on the bucket table and on the heads of the bucket lists are overlapped
+            instead of being paid for each key in turn.
+            The result is the same as a loop of \ref cds_nonintrusive_MichaelMap_rcu_find_cfunc "find(K const&, Func)" calls
+            including the guarantees for the functor \p f.
+
+            The function locks RCU once for the whole batch.
+
+            The function returns the number of keys found.
+        */
+        template <typename K, typename Func>
+        size_t find_batch( K const* keys, size_t nCount, Func f )
+        {
+            internal_bucket_type* arrBucket[c_nFindBatchSize];
+            size_t nFound = 0;
+
+            rcu_lock l;
+
+            for ( size_t nFirst = 0; nFirst < nCount; nFirst += c_nFindBatchSize ) {
+                size_t const nGroupSize = nCount - nFirst < c_nFindBatchSize ? nCount - nFirst : c_nFindBatchSize;
+
+                for ( size_t i = 0; i < nGroupSize; ++i ) {
+                    arrBucket[i] = &bucket( keys[nFirst + i] );
+                    cds_prefetch( arrBucket[i] );
+                }
+
+                for ( size_t i = 0; i < nGroupSize; ++i )
+                    arrBucket[i]->prefetch_first();
+
+                for ( size_t i = 0; i < nGroupSize; ++i )
+                    arrBucket[i]->prefetch_second();
+
+                for ( size_t i = 0; i < nGroupSize; ++i ) {
+                    size_t const nIndex = nFirst + i;
+                    if ( arrBucket[i]->find( keys[nIndex], [&f, nIndex]( value_type& item ) { f( nIndex, item ); } ))
+                        ++nFound;
+                }
+            }
+            return nFound;
+        }
+
         /// Checks whether the map contains \p key
         /**
             The function searches the item with key equal to \p key
@@ -673,6 +893,18 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Checks whether the map contains \p key using precomputed hash value
+        /**
+            The function is an analog of <tt>contains( key )</tt> but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashMap_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K>
+        bool contains_with_hash( K const& key, size_t nHash )
+        {
+            check_hash( key, nHash );
+            return bucket_by_hash( nHash ).contains( key );
+        }
+
         /// Checks whether the map contains \p key using \p pred predicate for searching
         /**
             The function is an analog of <tt>contains( key )</tt> but \p pred is used for key comparing.
@@ -819,6 +1051,21 @@ namespace cds { namespace container {
         {
             return m_Buckets[hash_value( key )];
         }
+
+        /// Returns the bucket (ordered list) for precomputed hash value \p nHash
+        internal_bucket_type& bucket_by_hash( size_t nHash )
+        {
+            return m_Buckets[nHash & m_nHashBitmask];
+        }
+
+        /// Checks (in debug mode only) that \p nHash passed to \p %_with_hash function is the hash value of \p key
+        template <typename Q>
+        void check_hash( Q const& key, size_t nHash ) const
+        {
+            assert( m_HashFunctor( key ) == nHash );
+            CDS_UNUSED( key );
+            CDS_UNUSED( nHash );
+        }
         //@endcond
     private:
         //@cond
@@ -339,6 +339,24 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Inserts new node with precomputed hash value
+        /** \anchor cds_nonintrusive_MichaelHashSet_hp_insert_with_hash
+            The function is an analog of \p insert( Q&& ) but \p nHash is used as the hash value of \p val
+            instead of calling the hash functor. It is useful when the key is hashed once and then looked up in several containers.
+
+            \p nHash must be equal to the value of the hash functor for \p val; in debug mode it is checked by an assertion.
+            The same requirement is for all \p %_with_hash functions.
+        */
+        template <typename Q>
+        bool insert_with_hash( Q&& val, size_t nHash )
+        {
+            check_hash( val, nHash );
+            const bool bRet = bucket_by_hash( nHash ).insert( std::forward<Q>( val ));
+            if ( bRet )
+                ++m_ItemCounter;
+            return bRet;
+        }
+
         /// Inserts new node
         /**
             The function allows to split creating of new item into two part:
@@ -367,6 +385,21 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Inserts new node with precomputed hash value
+        /**
+            The function is an analog of \p insert( Q&&, Func ) but \p nHash is used as the hash value of \p val,
+            see \ref cds_nonintrusive_MichaelHashSet_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        bool insert_with_hash( Q&& val, size_t nHash, Func f )
+        {
+            check_hash( val, nHash );
+            const bool bRet = bucket_by_hash( nHash ).insert( std::forward<Q>( val ), f );
+            if ( bRet )
+                ++m_ItemCounter;
+            return bRet;
+        }
+
         /// Updates the element
         /**
             The operation performs inserting or changing data with lock-free manner.
@@ -423,6 +456,21 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Updates the element with precomputed hash value
+        /**
+            The function is an analog of \p update() but \p nHash is used as the hash value of \p val,
+            see \ref cds_nonintrusive_MichaelHashSet_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        std::pair<bool, bool> update_with_hash( Q&& val, size_t nHash, Func func, bool bAllowUpdate = true )
+        {
+            check_hash( val, nHash );
+            std::pair<bool, bool> bRet = bucket_by_hash( nHash ).update( std::forward<Q>( val ), func, bAllowUpdate );
+            if ( bRet.second )
+                ++m_ItemCounter;
+            return bRet;
+        }
+
         /// Inserts or updates the node (only for \p IterableList)
         /**
             The operation performs inserting or changing data with lock-free manner.
@@ -482,6 +530,21 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Deletes \p key from the set using precomputed hash value
+        /**
+            The function is an analog of \p erase( Q const& ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashSet_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q>
+        bool erase_with_hash( Q const& key, size_t nHash )
+        {
+            check_hash( key, nHash );
+            const bool bRet = bucket_by_hash( nHash ).erase( key );
+            if ( bRet )
+                --m_ItemCounter;
+            return bRet;
+        }
+
         /// Deletes the item from the set using \p pred predicate for searching
         /**
             The function is an analog of \p erase(Q const&) but \p pred is used for key comparing.
@@ -526,6 +589,21 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Deletes \p key from the set using precomputed hash value
+        /**
+            The function is an analog of \p erase( Q const&, Func ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashSet_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        bool erase_with_hash( Q const& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            const bool bRet = bucket_by_hash( nHash ).erase( key, f );
+            if ( bRet )
+                --m_ItemCounter;
+            return bRet;
+        }
+
         /// Deletes the item from the set using \p pred predicate for searching
         /**
             The function is an analog of \p erase(Q const&, Func) but \p pred is used for key comparing.
@@ -659,6 +737,26 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Finds the key \p key using precomputed hash value
+        /**
+            The function is an analog of \p find( Q&, Func ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashSet_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        bool find_with_hash( Q& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            return bucket_by_hash( nHash ).find( key, f );
+        }
+        //@cond
+        template <typename Q, typename Func>
+        bool find_with_hash( Q const& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            return bucket_by_hash( nHash ).find( key, f );
+        }
+        //@endcond
+
         /// Finds \p key and returns iterator pointed to the item found (only for \p IterableList)
         /**
             If \p key is not found the function returns \p end().
@@ -762,6 +860,18 @@ namespace cds { namespace container {
             return bucket( key ).contains( key );
         }
 
+        /// Checks whether the set contains \p key using precomputed hash value
+        /**
+            The function is an analog of <tt>contains( key )</tt> but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashSet_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q>
+        bool contains_with_hash( Q const& key, size_t nHash )
+        {
+            check_hash( key, nHash );
+            return bucket_by_hash( nHash ).contains( key );
+        }
+
         /// Checks whether the set contains \p key using \p pred predicate for searching
         /**
             The function is an analog of <tt>contains( key )</tt> but \p pred is used for key comparing.
@@ -894,6 +1004,21 @@ namespace cds { namespace container {
         {
             return m_Buckets[hash_value( key )];
         }
+
+        /// Returns the bucket (ordered list) for precomputed hash value \p nHash
+        internal_bucket_type& bucket_by_hash( size_t nHash )
+        {
+            return m_Buckets[nHash & m_nHashBitmask];
+        }
+
+        /// Checks (in debug mode only) that \p nHash passed to \p %_with_hash function is the hash value of \p key
+        template <typename Q>
+        void check_hash( Q const& key, size_t nHash ) const
+        {
+            assert( m_HashFunctor( key ) == nHash );
+            CDS_UNUSED( key );
+            CDS_UNUSED( nHash );
+        }
         //@endcond
 
     private:
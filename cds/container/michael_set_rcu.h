@@ -313,6 +313,24 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Inserts new node with precomputed hash value
+        /** \anchor cds_nonintrusive_MichaelHashSet_rcu_insert_with_hash
+            The function is an analog of \p insert( Q&& ) but \p nHash is used as the hash value of \p val
+            instead of calling the hash functor. It is useful when the key is hashed once and then looked up in several containers.
+
+            \p nHash must be equal to the value of the hash functor for \p val; in debug mode it is checked by an assertion.
+            The same requirement is for all \p %_with_hash functions.
+        */
+        template <typename Q>
+        bool insert_with_hash( Q&& val, size_t nHash )
+        {
+            check_hash( val, nHash );
+            const bool bRet = bucket_by_hash( nHash ).insert( std::forward<Q>( val ));
+            if ( bRet )
+                ++m_ItemCounter;
+            return bRet;
+        }
+
         /// Inserts new node
         /**
             The function allows to split creating of new item into two part:
@@ -342,6 +360,21 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Inserts new node with precomputed hash value
+        /**
+            The function is an analog of \p insert( Q&&, Func ) but \p nHash is used as the hash value of \p val,
+            see \ref cds_nonintrusive_MichaelHashSet_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        bool insert_with_hash( Q&& val, size_t nHash, Func f )
+        {
+            check_hash( val, nHash );
+            const bool bRet = bucket_by_hash( nHash ).insert( std::forward<Q>( val ), f );
+            if ( bRet )
+                ++m_ItemCounter;
+            return bRet;
+        }
+
         /// Updates the element
         /**
             The operation performs inserting or changing data with lock-free manner.
@@ -387,6 +420,21 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Updates the element with precomputed hash value
+        /**
+            The function is an analog of \p update() but \p nHash is used as the hash value of \p val,
+            see \ref cds_nonintrusive_MichaelHashSet_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        std::pair<bool, bool> update_with_hash( Q const& val, size_t nHash, Func func, bool bAllowInsert = true )
+        {
+            check_hash( val, nHash );
+            std::pair<bool, bool> bRet = bucket_by_hash( nHash ).update( val, func, bAllowInsert );
+            if ( bRet.second )
+                ++m_ItemCounter;
+            return bRet;
+        }
+
         /// Inserts data of type \p value_type created from \p args
         /**
             Returns \p true if inserting successful, \p false otherwise.
@@ -424,6 +472,21 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Deletes \p key from the set using precomputed hash value
+        /**
+            The function is an analog of \p erase( Q const& ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashSet_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q>
+        bool erase_with_hash( Q const& key, size_t nHash )
+        {
+            check_hash( key, nHash );
+            const bool bRet = bucket_by_hash( nHash ).erase( key );
+            if ( bRet )
+                --m_ItemCounter;
+            return bRet;
+        }
+
         /// Deletes the item from the set using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_nonintrusive_MichealSet_rcu_erase_val "erase(Q const&)"
@@ -471,6 +534,21 @@ namespace cds { namespace container {
             return bRet;
         }
 
+        /// Deletes \p key from the set using precomputed hash value
+        /**
+            The function is an analog of \p erase( Q const&, Func ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashSet_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        bool erase_with_hash( Q const& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            const bool bRet = bucket_by_hash( nHash ).erase( key, f );
+            if ( bRet )
+                --m_ItemCounter;
+            return bRet;
+        }
+
         /// Deletes the item from the set using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_nonintrusive_MichealSet_rcu_erase_func "erase(Q const&, Func)"
@@ -591,6 +669,26 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Finds the key \p key using precomputed hash value
+        /**
+            The function is an analog of \p find( Q&, Func ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashSet_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        bool find_with_hash( Q& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            return bucket_by_hash( nHash ).find( key, f );
+        }
+        //@cond
+        template <typename Q, typename Func>
+        bool find_with_hash( Q const& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            return bucket_by_hash( nHash ).find( key, f );
+        }
+        //@endcond
+
         /// Finds the key \p key using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_nonintrusive_MichealSet_rcu_find_func "find(Q&, Func)"
@@ -634,6 +732,18 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Checks whether the set contains \p key using precomputed hash value
+        /**
+            The function is an analog of <tt>contains( key )</tt> but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_MichaelHashSet_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q>
+        bool contains_with_hash( Q const& key, size_t nHash )
+        {
+            check_hash( key, nHash );
+            return bucket_by_hash( nHash ).contains( key );
+        }
+
         /// Checks whether the set contains \p key using \p pred predicate for searching
         /**
             The function is an analog of <tt>contains( key )</tt> but \p pred is used for key comparing.
@@ -771,6 +881,21 @@ namespace cds { namespace container {
             return m_Buckets[hash_value( key )];
         }
 
+        /// Returns the bucket (ordered list) for precomputed hash value \p nHash
+        internal_bucket_type& bucket_by_hash( size_t nHash )
+        {
+            return m_Buckets[nHash & m_nHashBitmask];
+        }
+
+        /// Checks (in debug mode only) that \p nHash passed to \p %_with_hash function is the hash value of \p key
+        template <typename Q>
+        void check_hash( Q const& key, size_t nHash ) const
+        {
+            assert( m_HashFunctor( key ) == nHash );
+            CDS_UNUSED( key );
+            CDS_UNUSED( nHash );
+        }
+
         template <typename Stat>
         typename std::enable_if< Stat::empty >::type construct_bucket( internal_bucket_type* bkt )
         {
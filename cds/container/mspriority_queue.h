@@ -23,9 +23,19 @@ namespace cds { namespace container {
 
         /// Synonym for \p cds::intrusive::mspriority_queue::empty_stat
         typedef cds::intrusive::mspriority_queue::empty_stat empty_stat;
+
+        /// Synonym for \p cds::intrusive::mspriority_queue::arity
+        template <unsigned int Arity>
+        using arity = cds::intrusive::mspriority_queue::arity< Arity >;
+
+        /// Synonym for \p cds::intrusive::mspriority_queue::growable_buffer
+        template <typename T, class Alloc = CDS_DEFAULT_ALIGNED_ALLOCATOR>
+        using growable_buffer = cds::intrusive::mspriority_queue::growable_buffer< T, Alloc >;
 #else
         using cds::intrusive::mspriority_queue::stat;
         using cds::intrusive::mspriority_queue::empty_stat;
+        using cds::intrusive::mspriority_queue::arity;
+        using cds::intrusive::mspriority_queue::growable_buffer;
 #endif
 
         /// MSPriorityQueue traits
@@ -50,10 +60,11 @@ namespace cds { namespace container {
         /// Metafunction converting option list to traits
         /**
             \p Options are:
-            - \p opt::buffer - the buffer type for heap array. Possible type are: \p opt::v::initiaized_static_buffer, \p opt::v::initialized_dynamic_buffer.
-                Default is \p %opt::v::initialized_dynamic_buffer.
+            - \p opt::buffer - the buffer type for heap array. Possible type are: \p opt::v::initiaized_static_buffer, \p opt::v::initialized_dynamic_buffer,
+                \p mspriority_queue::growable_buffer. Default is \p %opt::v::initialized_dynamic_buffer.
                 You may specify any type of values for the buffer since at instantiation time
                 the \p buffer::rebind member metafunction is called to change the type of values stored in the buffer.
+            - \p mspriority_queue::arity - the arity of the heap. Default is 2.
             - \p opt::compare - priority compare functor. No default functor is provided.
                 If the option is not specified, the \p opt::less is used.
             - \p opt::less - specifies binary predicate used for priority compare. Default is \p std::less<T>.
@@ -99,6 +110,9 @@ namespace cds { namespace container {
         workloads. For small heaps it still performs well, but not as well as
         single-lock algorithm.
 
+        The queue is bounded unless \p mspriority_queue::growable_buffer is used as \p opt::buffer.
+        The heap may be d-ary, see \p mspriority_queue::arity.
+
         Template parameters:
         - \p T - type to be stored in the list. The priority is a part of \p T type.
         - \p Traits - the traits. See \p mspriority_queue::traits for explanation.
@@ -154,7 +168,7 @@ namespace cds { namespace container {
         /// Inserts an item into priority queue
         /**
             If the priority queue is full, the function returns \p false,
-            no item has been added.
+            no item has been added. The queue with \p mspriority_queue::growable_buffer is never full.
             Otherwise, the function inserts the copy of \p val into the heap
             and returns \p true.
 
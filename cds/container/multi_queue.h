@@ -0,0 +1,510 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_MULTI_QUEUE_H
+#define CDSLIB_CONTAINER_MULTI_QUEUE_H
+
+#include <vector>
+#include <algorithm>    // std::push_heap, std::pop_heap
+#include <thread>       // std::thread::hardware_concurrency
+#include <mutex>        // std::unique_lock
+#include <cds/container/details/base.h>
+#include <cds/opt/compare.h>
+#include <cds/sync/spinlock.h>
+#include <cds/algo/atomic.h>
+#include <cds/algo/backoff_strategy.h>
+#include <cds/details/allocator.h>
+#include <cds/algo/xorshift.h>
+
+namespace cds { namespace container {
+
+    /// MultiQueue related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace multi_queue {
+
+        /// MultiQueue internal statistics
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat
+        {
+            typedef Counter counter_type;   ///< Event counter type
+
+            counter_type    m_nPush;            ///< Count of push operations
+            counter_type    m_nPushCollision;   ///< Count of push attempts failed because the heap chosen is locked by another thread
+            counter_type    m_nPop;             ///< Count of success pop operations
+            counter_type    m_nPopEmpty;        ///< Count of pop operations from empty queue
+            counter_type    m_nPopCollision;    ///< Count of pop attempts failed because the heap chosen is locked by another thread
+            counter_type    m_nPopTwoChoice;    ///< Count of pops when the top is chosen as the best of two heaps
+            counter_type    m_nPopOneChoice;    ///< Count of pops when the second heap is busy or empty, so the top of single heap is popped
+            counter_type    m_nPopEmptyHeap;    ///< Count of pop attempts when both chosen heaps are empty
+            counter_type    m_nPopFullScan;     ///< Count of full scans of all heaps
+
+            counter_type    m_nRankSample;      ///< Count of pops sampled for rank error estimation
+            counter_type    m_nRankExact;       ///< Count of sampled pops that return the item with the highest priority (rank error is 0)
+            counter_type    m_nRankErrorSum;    ///< Sum of rank errors of sampled pops
+            atomics::atomic<size_t> m_nMaxRankError; ///< Max rank error of sampled pops (gauge)
+
+            /// Sampling rate of rank error estimation: one pop of \p c_nRankSampleRate is sampled on average
+            static constexpr const uint32_t c_nRankSampleRate = 64;
+
+            //@cond
+            stat()
+                : m_nMaxRankError( 0 )
+            {}
+
+            bool need_rank_sample() const
+            {
+                return ( cds::algo::xorshift32() & ( c_nRankSampleRate - 1 )) == 0;
+            }
+
+            void onRankError( size_t nRank )
+            {
+                ++m_nRankSample;
+                if ( nRank == 0 )
+                    ++m_nRankExact;
+                else
+                    m_nRankErrorSum += nRank;
+                if ( nRank > m_nMaxRankError.load( atomics::memory_order_relaxed ))
+                    m_nMaxRankError.store( nRank, atomics::memory_order_relaxed );
+            }
+
+            void onPush()           { ++m_nPush; }
+            void onPushCollision()  { ++m_nPushCollision; }
+            void onPop()            { ++m_nPop; }
+            void onPopEmpty()       { ++m_nPopEmpty; }
+            void onPopCollision()   { ++m_nPopCollision; }
+            void onPopTwoChoice()   { ++m_nPopTwoChoice; }
+            void onPopOneChoice()   { ++m_nPopOneChoice; }
+            void onPopEmptyHeap()   { ++m_nPopEmptyHeap; }
+            void onPopFullScan()    { ++m_nPopFullScan; }
+            //@endcond
+        };
+
+        /// MultiQueue dummy statistics, no overhead
+        struct empty_stat
+        {
+            //@cond
+            void onPush()           const {}
+            void onPushCollision()  const {}
+            void onPop()            const {}
+            void onPopEmpty()       const {}
+            void onPopCollision()   const {}
+            void onPopTwoChoice()   const {}
+            void onPopOneChoice()   const {}
+            void onPopEmptyHeap()   const {}
+            void onPopFullScan()    const {}
+            bool need_rank_sample() const { return false; }
+            void onRankError( size_t ) const {}
+            //@endcond
+        };
+
+        /// MultiQueue traits
+        struct traits
+        {
+            /// Priority compare functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+            */
+            typedef opt::none       compare;
+
+            /// Specifies binary predicate used for priority comparing.
+            /**
+                Default is \p std::less<T>.
+            */
+            typedef opt::none       less;
+
+            /// Type of mutual-exclusion lock of a heap. The lock should support \p try_lock()
+            typedef cds::sync::spin lock_type;
+
+            /// Back-off strategy applied when all probed heaps are locked
+            typedef cds::backoff::yield back_off;
+
+            /// Allocator for heaps and values
+            typedef CDS_DEFAULT_ALLOCATOR allocator;
+
+            /// Padding of heap data, default is cache line padding
+            /**
+                Each sequential heap is accessed by a lot of threads,
+                the padding eliminates false sharing between the heaps.
+            */
+            enum { padding = opt::cache_line_padding };
+
+            /// Internal statistics
+            /**
+                Possible types: \p multi_queue::empty_stat (the default, no overhead), \p multi_queue::stat
+                or any other with interface like \p %multi_queue::stat
+            */
+            typedef empty_stat      stat;
+        };
+
+        /// Metafunction converting option list to traits
+        /**
+            \p Options are:
+            - \p opt::compare - priority compare functor. No default functor is provided.
+                If the option is not specified, the \p opt::less is used.
+            - \p opt::less - specifies binary predicate used for priority compare. Default is \p std::less<T>.
+            - \p opt::lock_type - lock type of a heap. Default is \p cds::sync::spin.
+            - \p opt::back_off - back-off strategy. Default is \p cds::backoff::yield
+            - \p opt::allocator - allocator for the heaps and for the values. Default is \ref CDS_DEFAULT_ALLOCATOR
+            - \p opt::padding - padding of heap data. Default is \p opt::cache_line_padding
+            - \p opt::stat - internal statistics. Available types: \p multi_queue::stat, \p multi_queue::empty_stat (the default, no overhead)
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+    } // namespace multi_queue
+
+    /// MultiQueue - relaxed concurrent priority queue
+    /** @ingroup cds_nonintrusive_priority_queue
+        Source:
+            - [2015] H.Rihani, P.Sanders, R.Dementiev "MultiQueues: Simple Relaxed Concurrent Priority Queues"
+
+        The queue consists of <tt>c * P</tt> sequential binary heaps where \p P is the number of threads
+        and \p c is a small tuning factor (usually, 2). Each heap is protected by a lock; \p push() and \p pop()
+        take the lock by \p try_lock() only, so the threads never wait for each other while another heap is available.
+
+        \p push() inserts the item into a random heap. \p pop() takes two random heaps and removes
+        the top of the heap that has the higher priority top. The queue is <i>relaxed</i>: \p pop() does not
+        return the item with the highest priority in the whole queue, but the expected rank of the item returned
+        is <tt>O( c * P )</tt>, and the item with the highest priority is returned in expected <tt>O( c * P )</tt> pops.
+        The two-choice rule is essential for the quality of the queue: \p multi_queue::stat reports how many pops
+        are made from the best of two heaps (\p m_nPopTwoChoice) and how many pops degrade to one random heap
+        because the second one is busy or empty (\p m_nPopOneChoice). Also \p %multi_queue::stat estimates the rank error
+        on sampled pops: the number of items in the other heaps having higher priority than the item popped
+        (\p m_nRankSample, \p m_nRankExact, \p m_nRankErrorSum, \p m_nMaxRankError).
+
+        The queue is unbounded, the heaps are grown by the allocator specified in \p Traits.
+
+        Template parameters:
+        - \p T - type to be stored in the queue. The priority is a part of \p T type.
+        - \p Traits - the traits. See \p multi_queue::traits for explanation.
+             It is possible to declare option-based queue with \p multi_queue::make_traits
+             metafunction instead of \p Traits template argument.
+    */
+    template <typename T, class Traits = multi_queue::traits >
+    class MultiQueue
+    {
+    public:
+        typedef T           value_type  ;   ///< Value type stored in the queue
+        typedef Traits      traits      ;   ///< Traits template parameter
+
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator  ;    ///< priority comparing functor based on opt::compare and opt::less option setter.
+#   else
+        typedef typename opt::details::make_comparator< value_type, traits >::type key_comparator;
+#   endif
+
+        typedef typename traits::lock_type  lock_type;  ///< heap's lock type
+        typedef typename traits::back_off   back_off;   ///< Back-off strategy
+        typedef typename traits::stat       stat;       ///< internal statistics type
+        typedef typename std::allocator_traits<typename traits::allocator>::template rebind_alloc<value_type> allocator_type; ///< Value allocator
+
+        static constexpr const size_t c_nDefaultHeapFactor = 2; ///< Default number of heaps per thread
+
+    protected:
+        //@cond
+        struct heap_less
+        {
+            bool operator()( value_type const& v1, value_type const& v2 ) const
+            {
+                return key_comparator()( v1, v2 ) < 0;
+            }
+        };
+
+        struct heap
+        {
+            lock_type                               lock;
+            std::vector< value_type, allocator_type > items;
+        };
+
+        typedef typename cds::opt::details::apply_padding< heap, traits::padding >::type padded_heap;
+        typedef typename std::allocator_traits<typename traits::allocator>::template rebind_alloc<padded_heap> heap_allocator_type;
+        typedef cds::details::Allocator< padded_heap, heap_allocator_type > heap_allocator;
+        typedef std::unique_lock< lock_type > scoped_lock;
+        //@endcond
+
+    protected:
+        //@cond
+        padded_heap *           m_arrHeap;
+        size_t const            m_nHeapCount;
+        cds::atomicity::item_counter m_ItemCounter;
+        mutable stat            m_Stat;
+        //@endcond
+
+    public:
+        /// Constructs empty priority queue of <tt>c_nDefaultHeapFactor * std::thread::hardware_concurrency()</tt> heaps
+        MultiQueue()
+            : MultiQueue( c_nDefaultHeapFactor * std::thread::hardware_concurrency())
+        {}
+
+        /// Constructs empty priority queue of \p nHeapCount heaps
+        /**
+            \p nHeapCount should be about <tt>c * P</tt> where \p P is the number of threads working with the queue
+            and \p c is a small factor. The greater \p nHeapCount, the lower contention and the lower quality of the queue.
+            The minimum is 2.
+        */
+        explicit MultiQueue( size_t nHeapCount )
+            : m_nHeapCount( nHeapCount < 2 ? 2 : nHeapCount )
+        {
+            m_arrHeap = heap_allocator().NewArray( m_nHeapCount );
+        }
+
+        /// Clears priority queue and destructs the object
+        ~MultiQueue()
+        {
+            heap_allocator().Delete( m_arrHeap, m_nHeapCount );
+        }
+
+        /// Inserts the copy of \p val into the queue
+        /**
+            The function always returns \p true.
+        */
+        bool push( value_type const& val )
+        {
+            heap& h = lock_random_heap();
+            scoped_lock l( h.lock, std::adopt_lock );
+            h.items.push_back( val );
+            std::push_heap( h.items.begin(), h.items.end(), heap_less());
+            ++m_ItemCounter;
+            m_Stat.onPush();
+            return true;
+        }
+
+        /// Inserts \p val into the queue (move semantics)
+        /**
+            The function always returns \p true.
+        */
+        bool push( value_type&& val )
+        {
+            return emplace( std::move( val ));
+        }
+
+        /// Inserts a new item created from \p args arguments into the queue
+        /**
+            The function always returns \p true.
+        */
+        template <typename... Args>
+        bool emplace( Args&&... args )
+        {
+            heap& h = lock_random_heap();
+            scoped_lock l( h.lock, std::adopt_lock );
+            h.items.emplace_back( std::forward<Args>( args )... );
+            std::push_heap( h.items.begin(), h.items.end(), heap_less());
+            ++m_ItemCounter;
+            m_Stat.onPush();
+            return true;
+        }
+
+        /// Extracts an item with high priority
+        /**
+            If the priority queue is empty, the function returns \p false.
+            Otherwise, it returns \p true and \p dest contains the extracted item moved from the heap.
+
+            The item extracted is the top of the best of two random heaps, so, it may be not the item
+            with the highest priority in the queue.
+        */
+        bool pop( value_type& dest )
+        {
+            return pop_with( [&dest]( value_type& src ) { dest = std::move( src ); } );
+        }
+
+        /// Extracts an item with high priority
+        /**
+            If the priority queue is empty, the function returns \p false.
+            Otherwise, it calls \p f functor with the extracted item and returns \p true.
+
+            The functor takes one argument - a reference to the item being removed:
+            \code
+            cds:container::MultiQueue< Foo > myQueue;
+            Bar bar;
+            myQueue.pop_with( [&bar]( Foo& src ) { bar = std::move( src );});
+            \endcode
+            The functor is called under heap's lock.
+        */
+        template <typename Func>
+        bool pop_with( Func f )
+        {
+            back_off bkoff;
+            size_t nAttempt = 0;
+            while ( m_ItemCounter.value() != 0 ) {
+                // two different random heaps
+                size_t const nFirst = cds::algo::xorshift32() % m_nHeapCount;
+                size_t nSecond = cds::algo::xorshift32() % ( m_nHeapCount - 1 );
+                if ( nSecond >= nFirst )
+                    ++nSecond;
+
+                heap& first = m_arrHeap[nFirst].data;
+                heap& second = m_arrHeap[nSecond].data;
+
+                scoped_lock l1( first.lock, std::try_to_lock );
+                if ( !l1.owns_lock()) {
+                    m_Stat.onPopCollision();
+                    bkoff();
+                    continue;
+                }
+
+                heap* pHeap = &first;
+                scoped_lock l2( second.lock, std::try_to_lock );
+                if ( l2.owns_lock()) {
+                    if ( !second.items.empty() && ( first.items.empty() || heap_less()( first.items.front(), second.items.front())))
+                        pHeap = &second;
+
+                    if ( !first.items.empty() && !second.items.empty())
+                        m_Stat.onPopTwoChoice();
+                    else if ( !pHeap->items.empty())
+                        m_Stat.onPopOneChoice();
+                }
+                else {
+                    m_Stat.onPopCollision();
+                    if ( !first.items.empty())
+                        m_Stat.onPopOneChoice();
+                }
+
+                if ( !pHeap->items.empty()) {
+                    if ( m_Stat.need_rank_sample())
+                        m_Stat.onRankError( rank_error( *pHeap, pHeap == &first ? ( l2.owns_lock() ? &second : nullptr ) : &first ));
+                    pop_top( *pHeap, f );
+                    return true;
+                }
+
+                m_Stat.onPopEmptyHeap();
+                if ( ++nAttempt >= m_nHeapCount ) {
+                    // The queue seems to be almost empty, scan all heaps
+                    l2 = scoped_lock();
+                    l1 = scoped_lock();
+                    if ( pop_scan( f ))
+                        return true;
+                    nAttempt = 0;
+                }
+            }
+
+            m_Stat.onPopEmpty();
+            return false;
+        }
+
+        /// Clears the queue (not atomic)
+        /**
+            This function is not atomic, but thread-safe
+        */
+        void clear()
+        {
+            for ( size_t i = 0; i < m_nHeapCount; ++i ) {
+                heap& h = m_arrHeap[i].data;
+                scoped_lock l( h.lock );
+                m_ItemCounter.dec( h.items.size());
+                h.items.clear();
+            }
+        }
+
+        /// Checks is the priority queue is empty
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /// Returns current size of priority queue
+        size_t size() const
+        {
+            return m_ItemCounter.value();
+        }
+
+        /// Returns the number of sequential heaps
+        size_t heap_count() const
+        {
+            return m_nHeapCount;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        heap& lock_random_heap()
+        {
+            // Returns locked heap
+            back_off bkoff;
+            while ( true ) {
+                for ( size_t nAttempt = 0; nAttempt < m_nHeapCount; ++nAttempt ) {
+                    heap& h = m_arrHeap[ cds::algo::xorshift32() % m_nHeapCount ].data;
+                    if ( h.lock.try_lock())
+                        return h;
+                    m_Stat.onPushCollision();
+                }
+                bkoff();
+            }
+        }
+
+        template <typename Func>
+        void pop_top( heap& h, Func& f )
+        {
+            std::pop_heap( h.items.begin(), h.items.end(), heap_less());
+            f( h.items.back());
+            h.items.pop_back();
+            --m_ItemCounter;
+            m_Stat.onPop();
+        }
+
+        size_t rank_error( heap const& h, heap const* pLocked )
+        {
+            // Returns the count of items having higher priority than the top of h.
+            // h and pLocked are locked by the caller, other heaps are probed by try_lock()
+            // and the heaps locked by other threads are skipped, so the result is a lower bound.
+            value_type const& top = h.items.front();
+            size_t nRank = 0;
+            for ( size_t i = 0; i < m_nHeapCount; ++i ) {
+                heap& other = m_arrHeap[i].data;
+                if ( &other == &h )
+                    continue;
+                if ( &other == pLocked )
+                    nRank += count_higher( other, 0, top );
+                else if ( other.lock.try_lock()) {
+                    nRank += count_higher( other, 0, top );
+                    other.lock.unlock();
+                }
+            }
+            return nRank;
+        }
+
+        static size_t count_higher( heap const& h, size_t nIdx, value_type const& v )
+        {
+            // The items of a binary heap having higher priority than v form a subtree at the root,
+            // so the walk visits only them and their direct children
+            if ( nIdx >= h.items.size() || !heap_less()( v, h.items[nIdx] ))
+                return 0;
+            return 1 + count_higher( h, nIdx * 2 + 1, v ) + count_higher( h, nIdx * 2 + 2, v );
+        }
+
+        template <typename Func>
+        bool pop_scan( Func& f )
+        {
+            m_Stat.onPopFullScan();
+            for ( size_t i = 0; i < m_nHeapCount; ++i ) {
+                heap& h = m_arrHeap[i].data;
+                scoped_lock l( h.lock );
+                if ( !h.items.empty()) {
+                    pop_top( h, f );
+                    return true;
+                }
+            }
+            return false;
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_MULTI_QUEUE_H
@@ -0,0 +1,227 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_PROCESS_SHARED_RING_H
+#define CDSLIB_CONTAINER_PROCESS_SHARED_RING_H
+
+#include <cds/container/details/base.h>
+#include <cds/opt/buffer.h>
+#include <cds/algo/atomic.h>
+
+namespace cds { namespace container {
+
+    /// Process-shared ring buffers
+    /** @ingroup cds_nonintrusive_helper
+
+        The ring-based containers \p WeakRingBuffer and \p VyukovMPMCCycleQueue declared with
+        \p cds::opt::v::uninitialized_external_buffer do not contain any raw pointer:
+        the internal array is addressed by the offset relative to the container object.
+        If the container object and its array reside in one memory region, for example, in
+        \p mmap'd file or in POSIX \p shm_open shared memory, the container can be used by
+        any process that maps the region, even if the region is mapped at different addresses.
+
+        \p ring_segment is a helper that lays out the ring in such region and supports attach/detach semantics.
+    */
+    namespace process_shared {
+
+        /// Header of the shared memory region
+        struct segment_header
+        {
+            //@cond
+            enum state_type: uint32_t {
+                empty = 0,
+                initializing,
+                ready
+            };
+
+            uint64_t                    magic;      ///< Segment signature
+            uint64_t                    ring_size;  ///< \p sizeof(Ring), checked in \p attach() to detect layout mismatch
+            uint64_t                    capacity;   ///< Ring capacity
+            uint64_t                    region_size;///< Size of the region used
+            atomics::atomic<uint32_t>   state;      ///< Segment state, one of \p state_type
+            atomics::atomic<uint32_t>   ref_count;  ///< Number of attached processes/threads
+
+            static constexpr uint64_t const c_nMagic = 0x6c6962636473524eULL; // "libcdsRN"
+            //@endcond
+        };
+
+        /// Ring segment layout in caller-supplied memory region
+        /**
+            The region consists of the \p segment_header, the ring object and the ring's internal array;
+            each part is aligned on cache line boundary.
+
+            Template parameters:
+            - \p Ring - ring-based container, \p WeakRingBuffer or \p VyukovMPMCCycleQueue, declared
+                with \p cds::opt::v::uninitialized_external_buffer as \p opt::buffer option.
+                The ring element type must be address-free (trivially copyable without pointers)
+                since it is visible in different address spaces. All atomic types used by the ring
+                must be lock-free.
+
+            Example:
+            \code
+            #include <cds/container/weak_ringbuffer.h>
+            #include <cds/container/process_shared_ring.h>
+            #include <sys/mman.h>
+
+            struct ring_traits: public cds::container::weak_ringbuffer::traits
+            {
+                typedef cds::opt::v::uninitialized_external_buffer< void* > buffer;
+            };
+            typedef cds::container::WeakRingBuffer< quote, ring_traits > ring_type;
+            typedef cds::container::process_shared::ring_segment< ring_type > segment;
+
+            // Process A: creates the ring
+            int fd = shm_open( "/quotes", O_CREAT | O_RDWR, 0600 );
+            size_t const region_size = segment::size( 1024 * 1024 );
+            ftruncate( fd, region_size );
+            void* region = mmap( nullptr, region_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+            ring_type* ring = segment::create( region, region_size, 1024 * 1024 );
+            // ... produce
+            segment::detach( region );
+
+            // Process B: attaches to the ring
+            int fd = shm_open( "/quotes", O_RDWR, 0600 );
+            void* region = mmap( nullptr, region_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+            ring_type* ring = segment::attach( region, region_size );
+            if ( ring ) {
+                // ... consume
+                segment::detach( region );
+            }
+            \endcode
+        */
+        template <typename Ring>
+        class ring_segment
+        {
+        public:
+            typedef Ring ring_type; ///< Ring type
+
+            static constexpr size_t const c_nAlignment = cds::c_nCacheLineSize; ///< Alignment of each part of the segment
+
+        private:
+            //@cond
+            static constexpr size_t align( size_t n )
+            {
+                return ( n + c_nAlignment - 1 ) & ~( c_nAlignment - 1 );
+            }
+
+            static constexpr size_t ring_offset()
+            {
+                return align( sizeof( segment_header ));
+            }
+
+            static constexpr size_t storage_offset()
+            {
+                return ring_offset() + align( sizeof( ring_type ));
+            }
+
+            static segment_header* header( void* pRegion )
+            {
+                return reinterpret_cast<segment_header*>( pRegion );
+            }
+
+            static ring_type* ring( void* pRegion )
+            {
+                return reinterpret_cast<ring_type*>( reinterpret_cast<uint8_t*>( pRegion ) + ring_offset());
+            }
+            //@endcond
+
+        public:
+            /// Returns the size in bytes of the region required for the ring of \p nCapacity
+            static constexpr size_t size( size_t nCapacity )
+            {
+                return storage_offset() + align( ring_type::storage_size( nCapacity ));
+            }
+
+            /// Creates the ring of \p nCapacity in the region \p pRegion of \p nRegionSize bytes
+            /**
+                \p pRegion should be aligned on \p c_nAlignment boundary (page-aligned \p mmap result is suitable).
+                The region must not be used by other processes while the ring is being created.
+
+                On success, the caller is attached to the segment and the function returns the pointer to the ring.
+                If \p nRegionSize is less than <tt>size( nCapacity )</tt> the function returns \p nullptr.
+            */
+            static ring_type* create( void* pRegion, size_t nRegionSize, size_t nCapacity )
+            {
+                assert( pRegion != nullptr );
+                assert( ( reinterpret_cast<uintptr_t>( pRegion ) & ( c_nAlignment - 1 )) == 0 );
+
+                if ( nRegionSize < size( nCapacity ))
+                    return nullptr;
+
+                segment_header* h = new( pRegion ) segment_header;
+                h->state.store( segment_header::initializing, atomics::memory_order_relaxed );
+                h->ref_count.store( 1, atomics::memory_order_relaxed );
+                h->magic = segment_header::c_nMagic;
+                h->ring_size = sizeof( ring_type );
+                h->capacity = nCapacity;
+                h->region_size = size( nCapacity );
+
+                ring_type* r = new( ring( pRegion )) ring_type( reinterpret_cast<uint8_t*>( pRegion ) + storage_offset(), nCapacity );
+
+                h->state.store( segment_header::ready, atomics::memory_order_release );
+                return r;
+            }
+
+            /// Attaches to the ring created by \p create() in the region \p pRegion of \p nRegionSize bytes
+            /**
+                The region may be mapped at any address, not necessarily the address used in \p create().
+
+                Returns \p nullptr if the region does not contain a ready ring of type \p ring_type
+                (for example, the ring is not created yet or all users have been detached).
+            */
+            static ring_type* attach( void* pRegion, size_t nRegionSize )
+            {
+                assert( pRegion != nullptr );
+
+                if ( nRegionSize < sizeof( segment_header ))
+                    return nullptr;
+
+                segment_header* h = header( pRegion );
+                if ( h->state.load( atomics::memory_order_acquire ) != segment_header::ready )
+                    return nullptr;
+                if ( h->magic != segment_header::c_nMagic || h->ring_size != sizeof( ring_type ) || h->region_size > nRegionSize )
+                    return nullptr;
+
+                uint32_t cnt = h->ref_count.load( atomics::memory_order_relaxed );
+                do {
+                    if ( cnt == 0 ) {
+                        // the ring is being destroyed
+                        return nullptr;
+                    }
+                } while ( !h->ref_count.compare_exchange_weak( cnt, cnt + 1, atomics::memory_order_acquire, atomics::memory_order_relaxed ));
+
+                return ring( pRegion );
+            }
+
+            /// Detaches from the ring
+            /**
+                The last detached user destroys the ring; in this case the function returns \p true.
+                The memory region itself is not unmapped.
+            */
+            static bool detach( void* pRegion )
+            {
+                segment_header* h = header( pRegion );
+                assert( h->state.load( atomics::memory_order_relaxed ) == segment_header::ready );
+                assert( h->ref_count.load( atomics::memory_order_relaxed ) > 0 );
+
+                if ( h->ref_count.fetch_sub( 1, atomics::memory_order_acq_rel ) == 1 ) {
+                    ring( pRegion )->~ring_type();
+                    h->state.store( segment_header::empty, atomics::memory_order_release );
+                    return true;
+                }
+                return false;
+            }
+
+            /// Returns the number of users attached to the ring in \p pRegion
+            static size_t attached( void* pRegion )
+            {
+                return header( pRegion )->ref_count.load( atomics::memory_order_relaxed );
+            }
+        };
+
+    } // namespace process_shared
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_PROCESS_SHARED_RING_H
@@ -172,6 +172,10 @@ namespace cds { namespace container {
         The segmented queue is an <i>unfair</i> queue since it violates the strong FIFO order but no more than
         quasi factor. It means that the consumer dequeues any item from the current first segment.
 
+        The queue supports relaxed k-FIFO mode with thread-affine cell probing
+        (\p cds::opt::v::thread_affine_permutation) and adaptive segment size,
+        see \p cds::intrusive::SegmentedQueue for details.
+
         Template parameters:
         - \p GC - a garbage collector, possible types are cds::gc::HP, cds::gc::DHP
         - \p T - the type of values stored in the queue
@@ -235,6 +239,18 @@ namespace cds { namespace container {
             : base_class( nQuasiFactor )
         {}
 
+        /// Initializes the empty queue with adaptive segment size
+        /**
+            The size of new segment varies in range <tt>[nMinQuasiFactor, nMaxQuasiFactor]</tt> depending on contention,
+            see \p cds::intrusive::SegmentedQueue.
+        */
+        SegmentedQueue(
+            size_t nMinQuasiFactor, ///< Minimal quasi factor, minimum is 2.
+            size_t nMaxQuasiFactor  ///< Maximal quasi factor
+            )
+            : base_class( nMinQuasiFactor, nMaxQuasiFactor )
+        {}
+
         /// Clears the queue and deletes all internal data
         ~SegmentedQueue()
         {}
@@ -405,10 +421,25 @@ namespace cds { namespace container {
         }
 
         /// Returns quasi factor, a power-of-two number
+        /**
+            For adaptive queue the function returns the size of the segment to be allocated next.
+        */
         size_t quasi_factor() const
         {
             return base_class::quasi_factor();
         }
+
+        /// Returns minimal quasi factor
+        size_t min_quasi_factor() const
+        {
+            return base_class::min_quasi_factor();
+        }
+
+        /// Returns maximal quasi factor, the queue violates FIFO order no more than <tt>max_quasi_factor() - 1</tt> positions
+        size_t max_quasi_factor() const
+        {
+            return base_class::max_quasi_factor();
+        }
     };
 
 }} // namespace cds::container
@@ -8,6 +8,7 @@
 
 #include <cds/container/split_list_set_rcu.h>
 #include <cds/details/binary_functor_wrapper.h>
+#include <cds/container/details/bulk_load.h>
 
 namespace cds { namespace container {
 
@@ -183,6 +184,8 @@ namespace cds { namespace container {
         static constexpr const bool c_bExtractLockExternal = base_class::c_bExtractLockExternal;
         typedef typename base_class::raw_ptr        raw_ptr;    ///< type of \p get() return value
 
+        static constexpr const size_t c_nFindBatchSize = base_class::c_nFindBatchSize; ///< Count of keys \p find_batch() prefetches at once
+
     protected:
         //@cond
         typedef typename base_class::maker::traits::key_accessor key_accessor;
@@ -297,6 +300,33 @@ namespace cds { namespace container {
             return base_class::emplace( key_type( key ), mapped_type( val ));
         }
 
+        /// Inserts new node with key and default value using precomputed hash value of the key
+        /** \anchor cds_nonintrusive_SplitListMap_rcu_insert_with_hash
+            The function is an analog of \p insert( K const& ) but \p nHash is used as the hash value of \p key
+            instead of calling the hash functor. It is useful when the key is hashed once and then looked up in several maps.
+
+            \p nHash must be equal to the value of the map's hash functor for \p key; in debug mode it is checked by an assertion.
+            The same requirement is for all \p %_with_hash functions.
+
+            The function applies RCU lock internally.
+        */
+        template <typename K>
+        bool insert_with_hash( K const& key, size_t nHash )
+        {
+            return base_class::insert_node_with_hash( base_class::alloc_node( key_type( key ), mapped_type()), nHash );
+        }
+
+        /// Inserts new node using precomputed hash value of the key
+        /**
+            The function is an analog of \p insert( K const&, V const& ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_SplitListMap_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K, typename V>
+        bool insert_with_hash( K const& key, size_t nHash, V const& val )
+        {
+            return base_class::insert_node_with_hash( base_class::alloc_node( key_type( key ), mapped_type( val )), nHash );
+        }
+
         /// Inserts new node and initialize it by a functor
         /**
             This function inserts new node with key \p key and if inserting is successful then it calls
@@ -349,6 +379,64 @@ namespace cds { namespace container {
             return base_class::emplace( key_type( std::forward<K>( key )), mapped_type( std::forward<Args>(args)... ));
         }
 
+        /// Inserts the items of the range [\p first, \p last) using \p nThreads threads
+        /** \anchor cds_nonintrusive_SplitListMap_rcu_bulk_load
+            The function is intended for fast initial population of the map.
+            \p Iterator is a random-access iterator; its value type has \p first and \p second fields like \p std::pair,
+            \p key_type should be constructible from \p first and \p mapped_type from \p second.
+
+            The keys of the range are hashed once and partitioned by the low bits of the hash value; each partition
+            is a contiguous segment of the split-ordered list. Then \p nThreads threads (the current one and <tt>nThreads - 1</tt>
+            new threads) load the partitions with precomputed hash values, so the threads work in different parts of the list.
+            For small ranges fewer threads are used; \p nThreads <= 1 means loading in the current thread only.
+
+            If the map is empty when the function is called, the bucket table is grown at once for the size of the range
+            and the buckets of each partition are initialized in bucket order before loading. Then the nodes
+            of each bucket are sorted in split-list order and linked privately, and the chain is published after the bucket head
+            by one CAS (by one store under the locks of the neighbour nodes for \p LazyKVList).
+            The item counter is increased by the total count of inserted items once after loading,
+            so \p size() does not count the items loaded until the function returns.
+            If the map is not empty, the items are inserted one by one like \p insert() does,
+            each insertion updates the item counter that drives the growth of the bucket table.
+
+            Concurrency guarantees: the map may be used by other threads during the loading.
+            A chain is published only if the neighbour nodes are still adjacent, otherwise it is merged with the nodes
+            inserted by other threads, so no item is lost. The items loaded into a bucket appear in the map at once
+            for an empty map or one by one otherwise.
+            If a key is already in the map the item is not inserted; if a key is repeated in the range, its first occurrence is inserted.
+            The function applies RCU lock internally, it must not be called under RCU lock.
+            The new threads are attached to the GC by \p cds::threading::Manager::attachThread() for the loading time,
+            so the GC must allow <tt>nThreads - 1</tt> additional threads.
+
+            If an insertion throws (for example, \p std::bad_alloc), the exception is rethrown in the calling thread
+            after all loading threads have finished; the items inserted before stay in the map and are counted by \p size().
+
+            Returns the count of inserted items.
+        */
+        template <typename Iterator>
+        size_t bulk_load( Iterator first, Iterator last, size_t nThreads = 1 )
+        {
+            typedef typename std::iterator_traits<Iterator>::value_type item_type;
+            auto hash_func = [this]( item_type const& item ) { return base_class::hash_value( item.first ); };
+
+            if ( !base_class::empty()) {
+                return cds::container::details::bulk_loader::load( first, last, nThreads, hash_func,
+                    [this]( item_type const& item, size_t nHash ) { return insert_with_hash( item.first, nHash, item.second ); } );
+            }
+
+            // A partition consists of the buckets nPart, nPart + nPartCount, ... since the bucket count is a power of 2.
+            // The parent of such a bucket is in the same partition or below nPartCount, so the root buckets are initialized first
+            size_t const nBucketCount = base_class::grow_bucket_table_( static_cast<size_t>( last - first ));
+            return cds::container::details::bulk_loader::load_partitions( first, last, nThreads, nBucketCount, base_class::m_ItemCounter, hash_func,
+                [this]( size_t nPartCount ) { base_class::init_buckets_( 0, 1, nPartCount ); },
+                [this, first]( size_t nPart, size_t nPartCount, size_t* pIdx, size_t* pEnd, size_t const* pHash, size_t& nLoaded ) {
+                    base_class::init_buckets_( nPart + nPartCount, nPartCount, std::numeric_limits<size_t>::max());
+                    nLoaded += base_class::bulk_insert_( first, pIdx, pEnd, pHash, []( item_type const& item ) {
+                        return base_class::alloc_node( key_type( item.first ), mapped_type( item.second ));
+                    });
+                });
+        }
+
         /// Updates data by \p key
         /**
             The operation performs inserting or replacing the element with lock-free manner.
@@ -392,6 +480,23 @@ namespace cds { namespace container {
                 },
                 bAllowInsert );
         }
+
+        /// Updates data by \p key using precomputed hash value of the key
+        /**
+            The function is an analog of \p update() but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_SplitListMap_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> update_with_hash( K const& key, size_t nHash, Func func, bool bAllowInsert = true )
+        {
+            typedef decltype( std::make_pair( key_type( key ), mapped_type())) arg_pair_type;
+
+            return base_class::update_with_hash( std::make_pair( key_type( key ), mapped_type()), nHash,
+                [&func]( bool bNew, value_type& item, arg_pair_type const& /*val*/ ) {
+                    func( bNew, item );
+                },
+                bAllowInsert );
+        }
         //@cond
         template <typename K, typename Func>
         CDS_DEPRECATED("ensure() is deprecated, use update()")
@@ -414,6 +519,18 @@ namespace cds { namespace container {
             return base_class::erase( key );
         }
 
+        /// Deletes \p key from the map using precomputed hash value
+        /**
+            The function is an analog of \ref cds_nonintrusive_SplitListMap_rcu_erase_val "erase(K const&)"
+            but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_SplitListMap_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K>
+        bool erase_with_hash( K const& key, size_t nHash )
+        {
+            return base_class::erase_with_hash( key, nHash );
+        }
+
         /// Deletes the item from the map using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_nonintrusive_SplitListMap_rcu_erase_val "erase(K const&)"
@@ -451,6 +568,17 @@ namespace cds { namespace container {
             return base_class::erase( key, f );
         }
 
+        /// Deletes \p key from the map using precomputed hash value
+        /**
+            The function is an analog of \ref cds_nonintrusive_SplitListMap_rcu_erase_func "erase(K const&, Func)"
+            but \p nHash is used as the hash value of \p key.
+        */
+        template <typename K, typename Func>
+        bool erase_with_hash( K const& key, size_t nHash, Func f )
+        {
+            return base_class::erase_with_hash( key, nHash, f );
+        }
+
         /// Deletes the item from the map using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_nonintrusive_SplitListMap_rcu_erase_func "erase(K const&, Func)"
@@ -547,6 +675,49 @@ namespace cds { namespace container {
             return base_class::find( key, [&f](value_type& pair, K const&){ f( pair ); } );
         }
 
+        /// Finds the key \p key using precomputed hash value
+        /**
+            The function is an analog of \ref cds_nonintrusive_SplitListMap_rcu_find_cfunc "find(K const&, Func)"
+            but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_SplitListMap_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K, typename Func>
+        bool find_with_hash( K const& key, size_t nHash, Func f )
+        {
+            return base_class::find_with_hash( key, nHash, [&f](value_type& pair, K const&){ f( pair ); } );
+        }
+
+        /// Finds a batch of keys
+        /** \anchor cds_nonintrusive_SplitListMap_rcu_find_batch
+
+            The function searches \p nCount keys of \p keys array and calls the functor \p f for each item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( size_t nIndex, value_type& item );
+            };
+            \endcode
+            where \p nIndex is the index of the key in \p keys array, \p item is the item found.
+
+            The keys are processed by groups of \p c_nFindBatchSize keys in stages, each stage is done
+            for all keys of the group before the next one: the function hashes the keys and prefetches their entries
+            of the bucket table, then prefetches the bucket head nodes loaded from the table, then makes the first step
+            of the list search and prefetches the first item nodes of the buckets, and at last searches the keys one by one.
+            Thus the cache misses on the bucket table and on the heads of the buckets are overlapped
+            instead of being paid for each key in turn.
+            The result is the same as a loop of \ref cds_nonintrusive_SplitListMap_rcu_find_cfunc "find(K const&, Func)" calls
+            including the guarantees for the functor \p f.
+
+            The function locks RCU once for the whole batch.
+
+            The function returns the number of keys found.
+        */
+        template <typename K, typename Func>
+        size_t find_batch( K const* keys, size_t nCount, Func f )
+        {
+            return base_class::find_batch_( keys, nCount, f );
+        }
+
         /// Finds the key \p key using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_nonintrusive_SplitListMap_rcu_find_cfunc "find(K const&, Func)"
@@ -575,6 +746,17 @@ namespace cds { namespace container {
         {
             return base_class::contains( key );
         }
+
+        /// Checks whether the map contains \p key using precomputed hash value
+        /**
+            The function is an analog of <tt>contains( key )</tt> but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_SplitListMap_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K>
+        bool contains_with_hash( K const& key, size_t nHash )
+        {
+            return base_class::contains_with_hash( key, nHash );
+        }
         //@cond
         template <typename K>
         CDS_DEPRECATED("deprecated, use contains()")
@@ -6,6 +6,7 @@
 #ifndef CDSLIB_CONTAINER_SPLIT_LIST_SET_RCU_H
 #define CDSLIB_CONTAINER_SPLIT_LIST_SET_RCU_H
 
+#include <vector>
 #include <cds/intrusive/split_list_rcu.h>
 #include <cds/container/details/make_split_list_set.h>
 #include <cds/urcu/exempt_ptr.h>
@@ -287,12 +288,24 @@ namespace cds { namespace container {
 
     protected:
         //@cond
+        template <typename Q, typename Func>
+        size_t find_batch_( Q const* keys, size_t nCount, Func f )
+        {
+            return base_class::find_batch_( keys, nCount, key_comparator(), [&f]( size_t nIndex, node_type& item ) { f( nIndex, item.m_Value ); } );
+        }
+
         template <typename Q, typename Func>
         bool find_( Q& val, Func f )
         {
             return base_class::find( val, [&f]( node_type& item, Q& v ) { f(item.m_Value, v) ; } );
         }
 
+        template <typename Q, typename Func>
+        bool find_with_hash_( Q& val, size_t nHash, Func f )
+        {
+            return base_class::find_with_hash( val, nHash, [&f]( node_type& item, Q& v ) { f(item.m_Value, v) ; } );
+        }
+
         template <typename Q, typename Less, typename Func>
         bool find_with_( Q& val, Less pred, Func f )
         {
@@ -338,6 +351,44 @@ namespace cds { namespace container {
 
             return false;
         }
+
+        bool insert_node_with_hash( node_type * pNode, size_t nHash )
+        {
+            assert( pNode != nullptr );
+            scoped_node_ptr p(pNode);
+
+            if ( base_class::insert_with_hash( *pNode, nHash )) {
+                p.release();
+                return true;
+            }
+
+            return false;
+        }
+
+        // bulk_load() support: inserts the nodes alloc_func( first[*p] ) for p in [pIdx, pEnd),
+        // pHash[i] is the hash value of first[i]. Returns the count of inserted items, the item counter is not changed
+        template <typename RandomIt, typename Func>
+        size_t bulk_insert_( RandomIt first, size_t const* pIdx, size_t const* pEnd, size_t const* pHash, Func alloc_func )
+        {
+            std::vector<node_type *> arrNode;
+            std::vector<size_t> arrHash;
+            arrNode.reserve( static_cast<size_t>( pEnd - pIdx ));
+            arrHash.reserve( static_cast<size_t>( pEnd - pIdx ));
+            try {
+                for ( ; pIdx != pEnd; ++pIdx ) {
+                    arrNode.push_back( alloc_func( first[*pIdx] ));
+                    arrHash.push_back( pHash[*pIdx] );
+                }
+            }
+            catch ( ... ) {
+                for ( node_type * pNode : arrNode )
+                    free_node( pNode );
+                throw;
+            }
+
+            return base_class::bulk_insert_( arrNode.data(), arrNode.data() + arrNode.size(), arrHash.data(),
+                []( node_type& node ) { free_node( &node ); } );
+        }
         //@endcond
 
     protected:
@@ -568,6 +619,39 @@ namespace cds { namespace container {
             return false;
         }
 
+        /// Inserts new node with precomputed hash value
+        /** \anchor cds_nonintrusive_SplitListSet_rcu_insert_with_hash
+            The function is an analog of \p insert( Q const& ) but \p nHash is used as the hash value of \p val
+            instead of calling the hash functor. It is useful when the key is hashed once and then looked up in several sets.
+
+            \p nHash must be equal to the value of the set's hash functor for \p val; in debug mode it is checked by an assertion.
+            The same requirement is for all \p %_with_hash functions.
+
+            The function applies RCU lock internally.
+        */
+        template <typename Q>
+        bool insert_with_hash( Q const& val, size_t nHash )
+        {
+            return insert_node_with_hash( alloc_node( val ), nHash );
+        }
+
+        /// Inserts new node with precomputed hash value
+        /**
+            The function is an analog of \p insert( Q const&, Func ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_SplitListSet_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        bool insert_with_hash( Q const& key, size_t nHash, Func f )
+        {
+            scoped_node_ptr pNode( alloc_node( key ));
+
+            if ( base_class::insert_with_hash( *pNode, nHash, [&f](node_type& node) { f( node.m_Value ) ; } )) {
+                pNode.release();
+                return true;
+            }
+            return false;
+        }
+
         /// Inserts data of type \p value_type created from \p args
         /**
             Returns \p true if inserting successful, \p false otherwise.
@@ -651,6 +735,25 @@ namespace cds { namespace container {
                 pNode.release();
             return bRet;
         }
+
+        /// Updates the node with precomputed hash value
+        /**
+            The function is an analog of \p update() but \p nHash is used as the hash value of \p val,
+            see \ref cds_nonintrusive_SplitListSet_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        std::pair<bool, bool> update_with_hash( Q const& val, size_t nHash, Func func, bool bAllowInsert = true )
+        {
+            scoped_node_ptr pNode( alloc_node( val ));
+
+            std::pair<bool, bool> bRet = base_class::update_with_hash( *pNode, nHash,
+                [&func, &val]( bool bNew, node_type& item,  node_type const& /*val*/ ) {
+                    func( bNew, item.m_Value, val );
+                }, bAllowInsert );
+            if ( bRet.first && bRet.second )
+                pNode.release();
+            return bRet;
+        }
         //@cond
         // Dprecated, use update()
         template <typename Q, typename Func>
@@ -677,6 +780,18 @@ namespace cds { namespace container {
             return base_class::erase( key );
         }
 
+        /// Deletes \p key from the set using precomputed hash value
+        /**
+            The function is an analog of \ref cds_nonintrusive_SplitListSet_rcu_erase_val "erase(Q const&)"
+            but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_SplitListSet_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q>
+        bool erase_with_hash( Q const& key, size_t nHash )
+        {
+            return base_class::erase_with_hash( key, nHash );
+        }
+
         /// Deletes the item from the set using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_nonintrusive_SplitListSet_rcu_erase_val "erase(Q const&)"
@@ -718,6 +833,17 @@ namespace cds { namespace container {
             return base_class::erase( key, [&f](node_type& node) { f( node.m_Value ); } );
         }
 
+        /// Deletes \p key from the set using precomputed hash value
+        /**
+            The function is an analog of \ref cds_nonintrusive_SplitListSet_rcu_erase_func "erase(Q const&, Func)"
+            but \p nHash is used as the hash value of \p key.
+        */
+        template <typename Q, typename Func>
+        bool erase_with_hash( Q const& key, size_t nHash, Func f )
+        {
+            return base_class::erase_with_hash( key, nHash, [&f](node_type& node) { f( node.m_Value ); } );
+        }
+
         /// Deletes the item from the set using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_nonintrusive_SplitListSet_rcu_erase_func "erase(Q const&, Func)"
@@ -825,6 +951,25 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Finds the key \p key using precomputed hash value
+        /**
+            The function is an analog of \ref cds_nonintrusive_SplitListSet_rcu_find_func "find(Q&, Func)"
+            but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_SplitListSet_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        bool find_with_hash( Q& key, size_t nHash, Func f )
+        {
+            return find_with_hash_( key, nHash, f );
+        }
+        //@cond
+        template <typename Q, typename Func>
+        bool find_with_hash( Q const& key, size_t nHash, Func f )
+        {
+            return find_with_hash_( key, nHash, f );
+        }
+        //@endcond
+
         /// Finds the key \p key using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_nonintrusive_SplitListSet_rcu_find_func "find(Q&, Func)"
@@ -861,6 +1006,17 @@ namespace cds { namespace container {
         {
             return base_class::contains( key );
         }
+
+        /// Checks whether the set contains \p key using precomputed hash value
+        /**
+            The function is an analog of <tt>contains( key )</tt> but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_SplitListSet_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q>
+        bool contains_with_hash( Q const& key, size_t nHash )
+        {
+            return base_class::contains_with_hash( key, nHash );
+        }
         //@cond
         template <typename Q>
         CDS_DEPRECATED("deprecated, use contains()")
@@ -0,0 +1,13 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_SPRAY_LIST_RCU_H
+#define CDSLIB_CONTAINER_SPRAY_LIST_RCU_H
+
+#include <cds/intrusive/skip_list_rcu.h>
+#include <cds/container/details/spray_list_base.h>
+#include <cds/container/impl/spray_list.h>
+
+#endif  // #ifndef CDSLIB_CONTAINER_SPRAY_LIST_RCU_H
@@ -72,7 +72,7 @@ namespace cds { namespace container {
 
         The \p Options are:
             - \p cds::opt::mutex_policy - concurrent access policy.
-                Available policies: \p striped_set::striping, \p striped_set::refinable.
+                Available policies: \p striped_set::striping, \p striped_set::rw_striping, \p striped_set::refinable.
                 Default is \p %striped_set::striping.
             - \p cds::opt::hash - hash functor. Default option value see <tt>opt::v::hash_selector<opt::none> </tt>
                 which selects default hash functor for your compiler.
@@ -93,6 +93,9 @@ namespace cds { namespace container {
                 significantly improve performance.
                 For other, non-sequential types of \p Container (like a \p std::map)
                 the resizing policy is not so important.
+            - \p striped_set::incremental_resizing - moves the items to the new bucket table gradually instead of
+                stop-the-world rehashing; requires \p striped_set::striping or \p striped_set::rw_striping mutex policy.
+                Default is <tt>striped_set::incremental_resizing<0></tt> - no incremental resizing.
             - \p cds::opt::copy_policy - the copy policy which is used to copy items from the old map to the new one when resizing.
                 The policy can be optionally used in adapted bucket container for performance reasons of resizing.
                 The detail of copy algorithm depends on type of bucket container and explains below.
@@ -499,6 +502,26 @@ template <class Container, typename... Options>
         typedef typename base_class::scoped_cell_lock   scoped_cell_lock;
         typedef typename base_class::scoped_full_lock   scoped_full_lock;
         typedef typename base_class::scoped_resize_lock scoped_resize_lock;
+
+        template <typename K, typename Func>
+        std::pair<bool, bool> update_( K const& key, size_t nHash, Func func, bool bAllowInsert )
+        {
+            std::pair<bool, bool> result;
+            bool bResize;
+            bucket_type * pBucket;
+            {
+                scoped_cell_lock sl( base_class::m_MutexPolicy, nHash );
+                pBucket = base_class::locked_bucket( nHash );
+
+                result = pBucket->update( key, func, bAllowInsert );
+                bResize = result.first && result.second && base_class::m_ResizingPolicy( ++base_class::m_ItemCounter, *this, *pBucket );
+            }
+
+            if ( bResize )
+                base_class::resize();
+            base_class::resize_step();
+            return result;
+        }
         //@endcond
 
     private:
@@ -583,6 +606,31 @@ template <class Container, typename... Options>
             return insert_with( key, [&val](value_type& item) { item.second = val ; } );
         }
 
+        /// Inserts new node with precomputed hash value
+        /** \anchor cds_nonintrusive_StripedMap_insert_with_hash
+            The function is an analog of \p insert( K const& ) but \p nHash is used as the hash value of \p key
+            instead of calling the hash functor. It is useful when the key is hashed once and then looked up in several maps.
+
+            \p nHash must be equal to the value of the map's hash functor for \p key; in debug mode it is checked by an assertion.
+            The same requirement is for all \p %_with_hash functions.
+        */
+        template <typename K>
+        bool insert_with_hash( K const& key, size_t nHash )
+        {
+            return base_class::insert_with_hash( key, nHash, [](value_type&){} );
+        }
+
+        /// Inserts new node with precomputed hash value
+        /**
+            The function is an analog of \p insert( K const&, V const& ) but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_StripedMap_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K, typename V>
+        bool insert_with_hash( K const& key, size_t nHash, V const& val )
+        {
+            return base_class::insert_with_hash( key, nHash, [&val](value_type& item) { item.second = val ; } );
+        }
+
         /// Inserts new node and initialize it by a functor
         /**
             This function inserts new node with key \p key and if inserting is successful then it calls
@@ -627,7 +675,7 @@ template <class Container, typename... Options>
             bucket_type * pBucket;
             {
                 scoped_cell_lock sl( base_class::m_MutexPolicy, nHash );
-                pBucket = base_class::bucket( nHash );
+                pBucket = base_class::locked_bucket( nHash );
 
                 bOk = pBucket->emplace( std::forward<K>(key), std::forward<Args>(args)...);
                 bResize = bOk && base_class::m_ResizingPolicy( ++base_class::m_ItemCounter, *this, *pBucket );
@@ -635,7 +683,7 @@ template <class Container, typename... Options>
 
             if ( bResize )
                 base_class::resize();
-
+            base_class::resize_step();
             return bOk;
         }
 
@@ -663,21 +711,7 @@ template <class Container, typename... Options>
         template <typename K, typename Func>
         std::pair<bool, bool> update( K const& key, Func func, bool bAllowInsert = true )
         {
-            std::pair<bool, bool> result;
-            bool bResize;
-            size_t nHash = base_class::hashing( key );
-            bucket_type * pBucket;
-            {
-                scoped_cell_lock sl( base_class::m_MutexPolicy, nHash );
-                pBucket = base_class::bucket( nHash );
-
-                result = pBucket->update( key, func, bAllowInsert );
-                bResize = result.first && result.second && base_class::m_ResizingPolicy( ++base_class::m_ItemCounter, *this, *pBucket );
-            }
-
-            if ( bResize )
-                base_class::resize();
-            return result;
+            return update_( key, base_class::hashing( key ), func, bAllowInsert );
         }
         //@cond
         template <typename K, typename Func>
@@ -688,6 +722,18 @@ template <class Container, typename... Options>
         }
         //@endcond
 
+        /// Updates the node with precomputed hash value
+        /**
+            The function is an analog of \p update() but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_StripedMap_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> update_with_hash( K const& key, size_t nHash, Func func, bool bAllowInsert = true )
+        {
+            base_class::check_hash( key, nHash );
+            return update_( key, nHash, func, bAllowInsert );
+        }
+
         /// Delete \p key from the map
         /** \anchor cds_nonintrusive_StripedMap_erase
 
@@ -738,6 +784,29 @@ template <class Container, typename... Options>
             return base_class::erase( key, f );
         }
 
+        /// Deletes \p key from the map using precomputed hash value
+        /**
+            The function is an analog of \ref cds_nonintrusive_StripedMap_erase "erase(K const&)"
+            but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_StripedMap_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K>
+        bool erase_with_hash( K const& key, size_t nHash )
+        {
+            return base_class::erase_with_hash( key, nHash );
+        }
+
+        /// Deletes \p key from the map using precomputed hash value
+        /**
+            The function is an analog of \ref cds_nonintrusive_StripedMap_erase_func "erase(K const&, Func)"
+            but \p nHash is used as the hash value of \p key.
+        */
+        template <typename K, typename Func>
+        bool erase_with_hash( K const& key, size_t nHash, Func f )
+        {
+            return base_class::erase_with_hash( key, nHash, f );
+        }
+
         /// Deletes the item from the map using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_nonintrusive_StripedMap_erase_func "erase(K const&, Func)"
@@ -779,6 +848,18 @@ template <class Container, typename... Options>
             return base_class::find( key, [&f]( value_type& pair, K const& ) mutable { f(pair); } );
         }
 
+        /// Finds \p key using precomputed hash value
+        /**
+            The function is an analog of \ref cds_nonintrusive_StripedMap_find_func "find(K const&, Func)"
+            but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_StripedMap_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K, typename Func>
+        bool find_with_hash( K const& key, size_t nHash, Func f )
+        {
+            return base_class::find_with_hash( key, nHash, [&f]( value_type& pair, K const& ) mutable { f(pair); } );
+        }
+
         /// Find the key \p val using \p pred predicate
         /**
             The function is an analog of \ref cds_nonintrusive_StripedMap_find_func "find(K const&, Func)"
@@ -818,6 +899,17 @@ template <class Container, typename... Options>
         }
         //@endcond
 
+        /// Checks whether the map contains \p key using precomputed hash value
+        /**
+            The function is an analog of <tt>contains( key )</tt> but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_StripedMap_insert_with_hash "insert_with_hash()".
+        */
+        template <typename K>
+        bool contains_with_hash( K const& key, size_t nHash )
+        {
+            return base_class::contains_with_hash( key, nHash );
+        }
+
         /// Checks whether the set contains \p key using \p pred predicate for searching
         /**
             The function is similar to <tt>contains( key )</tt> but \p pred is used for key comparing.
@@ -37,7 +37,8 @@ namespace cds { namespace container {
 
         The \p Options are:
             - \p opt::mutex_policy - concurrent access policy.
-                Available policies: \p intrusive::striped_set::striping, \p intrusive::striped_set::refinable.
+                Available policies: \p intrusive::striped_set::striping, \p intrusive::striped_set::rw_striping,
+                \p intrusive::striped_set::refinable.
                 Default is \p %striped_set::striping.
             - \p opt::hash - hash functor. Default option value see <tt>opt::v::hash_selector<opt::none> </tt>
                 which selects default hash functor for your compiler.
@@ -57,6 +58,9 @@ namespace cds { namespace container {
                 for sequential containers like \p std::list, \p std::vector and so on, right choosing of the policy can
                 significantly improve performance.
                 For other, non-sequential types of \p Container (like a \p std::set) the resizing policy is not so important.
+            - \p striped_set::incremental_resizing - moves the items to the new bucket table gradually instead of
+                stop-the-world rehashing; requires \p striped_set::striping or \p striped_set::rw_striping mutex policy.
+                Default is <tt>striped_set::incremental_resizing<0></tt> - no incremental resizing.
             - \p opt::copy_policy - the copy policy which is used to copy items from the old set to the new one when resizing.
                 The policy can be optionally used in adapted bucket container for performance reasons of resizing.
                 The detail of copy algorithm depends on type of bucket container and explains below.
@@ -490,6 +494,63 @@ namespace cds { namespace container {
         typedef typename base_class::scoped_cell_lock   scoped_cell_lock;
         typedef typename base_class::scoped_full_lock   scoped_full_lock;
         typedef typename base_class::scoped_resize_lock scoped_resize_lock;
+
+        template <typename Q, typename Func>
+        bool insert_( Q const& val, size_t nHash, Func f )
+        {
+            bool bOk;
+            bool bResize;
+            bucket_type * pBucket;
+            {
+                scoped_cell_lock sl( base_class::m_MutexPolicy, nHash );
+                pBucket = base_class::locked_bucket( nHash );
+                bOk = pBucket->insert( val, f );
+                bResize = bOk && base_class::m_ResizingPolicy( ++base_class::m_ItemCounter, *this, *pBucket );
+            }
+
+            if ( bResize )
+                base_class::resize();
+            base_class::resize_step();
+            return bOk;
+        }
+
+        template <typename Q, typename Func>
+        std::pair<bool, bool> update_( Q const& val, size_t nHash, Func func, bool bAllowInsert )
+        {
+            std::pair<bool, bool> result;
+            bool bResize = false;
+            bucket_type * pBucket;
+            {
+                scoped_cell_lock sl( base_class::m_MutexPolicy, nHash );
+                pBucket = base_class::locked_bucket( nHash );
+
+                result = pBucket->update( val, func, bAllowInsert );
+                if ( result.first && result.second )
+                    bResize = base_class::m_ResizingPolicy( ++base_class::m_ItemCounter, *this, *pBucket );
+            }
+
+            if ( bResize )
+                base_class::resize();
+            base_class::resize_step();
+            return result;
+        }
+
+        template <typename Q, typename Func>
+        bool erase_( Q const& key, size_t nHash, Func f )
+        {
+            bool bOk;
+            {
+                scoped_cell_lock sl( base_class::m_MutexPolicy, nHash );
+                bucket_type * pBucket = base_class::locked_bucket( nHash );
+
+                bOk = pBucket->erase( key, f );
+            }
+
+            if ( bOk )
+                --base_class::m_ItemCounter;
+            base_class::resize_step();
+            return bOk;
+        }
         //@endcond
 
     public:
@@ -574,20 +635,33 @@ namespace cds { namespace container {
         template <typename Q, typename Func>
         bool insert( Q const& val, Func f )
         {
-            bool bOk;
-            bool bResize;
-            size_t nHash = base_class::hashing( val );
-            bucket_type * pBucket;
-            {
-                scoped_cell_lock sl( base_class::m_MutexPolicy, nHash );
-                pBucket = base_class::bucket( nHash );
-                bOk = pBucket->insert( val, f );
-                bResize = bOk && base_class::m_ResizingPolicy( ++base_class::m_ItemCounter, *this, *pBucket );
-            }
+            return insert_( val, base_class::hashing( val ), f );
+        }
 
-            if ( bResize )
-                base_class::resize();
-            return bOk;
+        /// Inserts new node with precomputed hash value
+        /** \anchor cds_nonintrusive_StripedSet_insert_with_hash
+            The function is an analog of \p insert( Q const& ) but \p nHash is used as the hash value of \p val
+            instead of calling the hash functor. It is useful when the key is hashed once and then looked up in several sets.
+
+            \p nHash must be equal to the value of the set's hash functor for \p val; in debug mode it is checked by an assertion.
+            The same requirement is for all \p %_with_hash functions.
+        */
+        template <typename Q>
+        bool insert_with_hash( Q const& val, size_t nHash )
+        {
+            return insert_with_hash( val, nHash, []( value_type& ) {} );
+        }
+
+        /// Inserts new node with precomputed hash value
+        /**
+            The function is an analog of \p insert( Q const&, Func ) but \p nHash is used as the hash value of \p val,
+            see \ref cds_nonintrusive_StripedSet_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        bool insert_with_hash( Q const& val, size_t nHash, Func f )
+        {
+            base_class::check_hash( val, nHash );
+            return insert_( val, nHash, f );
         }
 
         /// Inserts data of type \p %value_type constructed with <tt>std::forward<Args>(args)...</tt>
@@ -604,7 +678,7 @@ namespace cds { namespace container {
             bucket_type * pBucket;
             {
                 scoped_cell_lock sl( base_class::m_MutexPolicy, nHash );
-                pBucket = base_class::bucket( nHash );
+                pBucket = base_class::locked_bucket( nHash );
 
                 bOk = pBucket->emplace( std::move( val ));
                 bResize = bOk && base_class::m_ResizingPolicy( ++base_class::m_ItemCounter, *this, *pBucket );
@@ -612,6 +686,7 @@ namespace cds { namespace container {
 
             if ( bResize )
                 base_class::resize();
+            base_class::resize_step();
             return bOk;
         }
 
@@ -642,22 +717,7 @@ namespace cds { namespace container {
         template <typename Q, typename Func>
         std::pair<bool, bool> update( Q const& val, Func func, bool bAllowInsert = true )
         {
-            std::pair<bool, bool> result;
-            bool bResize = false;
-            size_t nHash = base_class::hashing( val );
-            bucket_type * pBucket;
-            {
-                scoped_cell_lock sl( base_class::m_MutexPolicy, nHash );
-                pBucket = base_class::bucket( nHash );
-
-                result = pBucket->update( val, func, bAllowInsert );
-                if ( result.first && result.second )
-                    bResize = base_class::m_ResizingPolicy( ++base_class::m_ItemCounter, *this, *pBucket );
-            }
-
-            if ( bResize )
-                base_class::resize();
-            return result;
+            return update_( val, base_class::hashing( val ), func, bAllowInsert );
         }
         //@cond
         template <typename Q, typename Func>
@@ -668,6 +728,18 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Updates the node with precomputed hash value
+        /**
+            The function is an analog of \p update() but \p nHash is used as the hash value of \p val,
+            see \ref cds_nonintrusive_StripedSet_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        std::pair<bool, bool> update_with_hash( Q const& val, size_t nHash, Func func, bool bAllowInsert = true )
+        {
+            base_class::check_hash( val, nHash );
+            return update_( val, nHash, func, bAllowInsert );
+        }
+
         /// Delete \p key from the set
         /** \anchor cds_nonintrusive_StripedSet_erase
 
@@ -716,18 +788,7 @@ namespace cds { namespace container {
         template <typename Q, typename Func>
         bool erase( Q const& key, Func f )
         {
-            bool bOk;
-            size_t nHash = base_class::hashing( key );
-            {
-                scoped_cell_lock sl( base_class::m_MutexPolicy, nHash );
-                bucket_type * pBucket = base_class::bucket( nHash );
-
-                bOk = pBucket->erase( key, f );
-            }
-
-            if ( bOk )
-                --base_class::m_ItemCounter;
-            return bOk;
+            return erase_( key, base_class::hashing( key ), f );
         }
 
         /// Deletes the item from the set using \p pred predicate for searching
@@ -749,16 +810,41 @@ namespace cds { namespace container {
             size_t nHash = base_class::hashing( key );
             {
                 scoped_cell_lock sl( base_class::m_MutexPolicy, nHash );
-                bucket_type * pBucket = base_class::bucket( nHash );
+                bucket_type * pBucket = base_class::locked_bucket( nHash );
 
                 bOk = pBucket->erase( key, pred, f );
             }
 
             if ( bOk )
                 --base_class::m_ItemCounter;
+            base_class::resize_step();
             return bOk;
         }
 
+        /// Deletes \p key from the set using precomputed hash value
+        /**
+            The function is an analog of \ref cds_nonintrusive_StripedSet_erase "erase(Q const&)"
+            but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_StripedSet_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q>
+        bool erase_with_hash( Q const& key, size_t nHash )
+        {
+            return erase_with_hash( key, nHash, [](value_type const&) {} );
+        }
+
+        /// Deletes \p key from the set using precomputed hash value
+        /**
+            The function is an analog of \ref cds_nonintrusive_StripedSet_erase_func "erase(Q const&, Func)"
+            but \p nHash is used as the hash value of \p key.
+        */
+        template <typename Q, typename Func>
+        bool erase_with_hash( Q const& key, size_t nHash, Func f )
+        {
+            base_class::check_hash( key, nHash );
+            return erase_( key, nHash, f );
+        }
+
         /// Find the key \p val
         /** \anchor cds_nonintrusive_StripedSet_find_func
 
@@ -829,6 +915,25 @@ namespace cds { namespace container {
             return base_class::find( val, f );
         }
 
+        /// Finds the key \p val using precomputed hash value
+        /**
+            The function is an analog of \ref cds_nonintrusive_StripedSet_find_func "find(Q&, Func)"
+            but \p nHash is used as the hash value of \p val,
+            see \ref cds_nonintrusive_StripedSet_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        bool find_with_hash( Q& val, size_t nHash, Func f )
+        {
+            return base_class::find_with_hash( val, nHash, f );
+        }
+        //@cond
+        template <typename Q, typename Func>
+        bool find_with_hash( Q const& val, size_t nHash, Func f )
+        {
+            return base_class::find_with_hash( val, nHash, f );
+        }
+        //@endcond
+
         /// Find the key \p val using \p pred predicate
         /**
             The function is an analog of \ref cds_nonintrusive_StripedSet_find_cfunc "find(Q const&, Func)"
@@ -870,6 +975,17 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Checks whether the set contains \p key using precomputed hash value
+        /**
+            The function is an analog of <tt>contains( key )</tt> but \p nHash is used as the hash value of \p key,
+            see \ref cds_nonintrusive_StripedSet_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q>
+        bool contains_with_hash( Q const& key, size_t nHash )
+        {
+            return base_class::contains_with_hash( key, nHash );
+        }
+
         /// Checks whether the map contains \p key using \p pred predicate for searching
         /**
             The function is similar to <tt>contains( key )</tt> but \p pred is used for key comparing.
@@ -197,10 +197,18 @@ namespace cds { namespace container {
         ///@copydoc cds::intrusive::striped_set::no_resizing
         typedef cds::intrusive::striped_set::no_resizing no_resizing;
 
+        ///@copydoc cds::intrusive::striped_set::incremental_resizing
+        template <size_t BucketsPerOp>
+        using incremental_resizing = cds::intrusive::striped_set::incremental_resizing<BucketsPerOp>;
+
         ///@copydoc cds::intrusive::striped_set::striping
         template <class Lock = std::mutex, class Alloc = CDS_DEFAULT_ALLOCATOR >
         using striping = cds::intrusive::striped_set::striping<Lock, Alloc>;
 
+        ///@copydoc cds::intrusive::striped_set::rw_striping
+        template <class SharedLock = cds::sync::shared_spin, class Alloc = CDS_DEFAULT_ALLOCATOR >
+        using rw_striping = cds::intrusive::striped_set::rw_striping<SharedLock, Alloc>;
+
         ///@copydoc cds::intrusive::striped_set::refinable
         template <
             class RecursiveLock = std::recursive_mutex,
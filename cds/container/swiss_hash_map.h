@@ -0,0 +1,1000 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_SWISS_HASH_MAP_H
+#define CDSLIB_CONTAINER_SWISS_HASH_MAP_H
+
+#include <utility>  // std::pair
+#include <mutex>    // std::unique_lock
+#include <cds/container/details/swiss_hash_base.h>
+#include <cds/details/allocator.h>
+#include <cds/opt/options.h>
+
+namespace cds { namespace container {
+
+    /// Concurrent open-addressing hash map with SIMD-probed control bytes
+    /** @ingroup cds_nonintrusive_map
+        @anchor cds_nonintrusive_SwissHashMap_hp
+
+        Source:
+            - [2017] Matt Kulukundis "Designing a Fast, Efficient, Cache-friendly Hash Table, Step by Step" (CppCon 2017)
+            - Abseil \p flat_hash_map (SwissTable) design notes
+
+        The node-based hash maps of the library (\p MichaelHashMap, \p SplitListMap, \p FeldmanHashMap)
+        chase at least two pointers on each lookup: the bucket and the list node.
+        \p %SwissHashMap is an open-addressing table: the slots are grouped by 16, each group has 16 control bytes.
+        A control byte of a full slot holds 7 bits of the key hash (H2), other values mark empty, deleted
+        and service states. The lookup computes the group index from the remaining hash bits (H1),
+        matches H2 against 16 control bytes of the group at once (by one SSE2 compare, or by SWAR bit tricks
+        on 64-bit words if SSE2 is not available) and compares the keys only for matched slots.
+        If the group has an empty slot the probing stops, otherwise the next group is probed (triangular probing).
+        So, a successful lookup usually touches one control word and one item.
+
+        The slot holds a pointer to the item (<tt>std::pair<Key const, Value></tt>), the items are reclaimed through the
+        garbage collector \p GC, so the readers never lock and never wait. The control bytes are changed by CAS;
+        a new item is published by reserving an empty slot, storing the item pointer and then writing H2
+        into the control byte.
+        The writers of the same key (\p insert(), \p update(), \p erase()) are serialized by a lock of the
+        stripe selected by the key hash, that excludes the duplicates when the same key is inserted concurrently;
+        the writers of different keys are not blocked by each other.
+
+        When the table is 7/8 full (the deleted slots are counted as full), a new table is installed:
+        doubled, or of the same size if most of used slots are tombstones. The items are migrated
+        incrementally: each writer moves a couple of groups of the predecessor table; the readers look into
+        the predecessor first and then into the new table. Next growing is possible only when the migration is done.
+        While the migration is in progress the writers may insert into the new table only as many items as
+        the new table has slots above the capacity of the predecessor (none for the same-size table),
+        so the items being migrated always have room; after that the writers finish the migration first.
+        The table never shrinks.
+
+        The map does not support iterators.
+
+        Template arguments:
+        - \p GC - Garbage collector: \p gc::HP or \p gc::DHP.
+            The map requires \p c_nHazardPtrCount hazard pointers per thread.
+        - \p Key - key type
+        - \p Value - mapped type
+        - \p Traits - map traits, default is \p swiss_hash::traits.
+            Instead of defining \p Traits struct directly you may use option-based syntax with
+            \p swiss_hash::make_traits metafunction.
+
+        Many of the class function take a key argument of type \p K that in general is not \p key_type.
+        \p key_type and an argument of template type \p K must meet the following requirements:
+        - \p key_type should be constructible from value of type \p K;
+        - the hash functor should be able to calculate correct hash value from argument \p key of type \p K:
+            <tt> hash( key_type(key)) == hash( key ) </tt>
+        - values of type \p key_type and \p K should be comparable
+    */
+    template <
+        class GC,
+        typename Key,
+        typename Value,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = swiss_hash::traits
+#else
+        class Traits
+#endif
+    >
+    class SwissHashMap
+    {
+    public:
+        typedef GC      gc;             ///< Garbage collector
+        typedef Key     key_type;       ///< Key type
+        typedef Value   mapped_type;    ///< Mapped type
+        typedef Traits  traits;         ///< Map traits
+        typedef std::pair< key_type const, mapped_type > value_type; ///< Key-value pair stored in the map
+
+        typedef typename cds::opt::v::hash_selector< typename traits::hash >::type hash; ///< Hash functor
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator; ///< key comparison functor based on \p opt::compare and \p opt::less option setter.
+#   else
+        typedef typename cds::opt::details::make_comparator< key_type, traits >::type key_comparator;
+#   endif
+        typedef typename traits::allocator      allocator;      ///< Allocator
+        typedef typename traits::item_counter   item_counter;   ///< Item counter type
+        typedef typename traits::back_off       back_off;       ///< Back-off strategy
+        typedef typename traits::lock_type      lock_type;      ///< Writer lock type
+        typedef typename traits::stat           stat;           ///< Internal statistics
+
+        static constexpr const size_t c_nHazardPtrCount = 4; ///< Count of hazard pointer required for the algorithm
+        static constexpr const size_t c_nGroupWidth = swiss_hash::details::c_nGroupWidth; ///< Count of slots in a group
+
+        static_assert( !std::is_same< item_counter, cds::atomicity::empty_item_counter >::value,
+            "SwissHashMap requires real item counter since the resizing depends on the item count" );
+
+    protected:
+        //@cond
+        typedef swiss_hash::details::group_ctrl group_ctrl;
+
+#   ifdef CDS_SWISS_HASH_SSE2
+        typedef swiss_hash::details::group_matcher< traits::simd > group_matcher;
+#   else
+        typedef swiss_hash::details::group_matcher< false > group_matcher;
+#   endif
+
+        struct node
+        {
+            size_t      nHash;      // mixed hash
+            value_type  m_Value;
+
+            template <typename K, typename... Args>
+            node( size_t h, K&& key, Args&&... args )
+                : nHash( h )
+                , m_Value( std::piecewise_construct, std::forward_as_tuple( std::forward<K>( key )), std::forward_as_tuple( std::forward<Args>( args )... ))
+            {}
+        };
+
+        struct group
+        {
+            group_ctrl                  ctrl;
+            atomics::atomic<node *>     slots[c_nGroupWidth];
+
+            group()
+            {
+                for ( auto& s : slots )
+                    s.store( nullptr, atomics::memory_order_relaxed );
+            }
+        };
+
+        struct table
+        {
+            size_t const                nGroupCount;    // power of 2
+            atomics::atomic<table *>    pPred;          // predecessor table being migrated into this one
+            atomics::atomic<size_t>     nMigrateCursor; // next group of the predecessor to migrate
+            atomics::atomic<size_t>     nMigrated;      // count of migrated groups of the predecessor
+            atomics::atomic<size_t>     nUsed;          // count of slots that are not empty (full, deleted or busy)
+            atomics::atomic<size_t>     nBudget;        // count of new items the writers may insert while the predecessor is migrated
+            group                       groups[1];      // actual size is nGroupCount
+
+            // The slots of the predecessor capacity are kept for the items being migrated,
+            // so the migration never finds the table full
+            table( size_t n, table * pPredecessor )
+                : nGroupCount( n )
+                , pPred( pPredecessor )
+                , nMigrateCursor( 0 )
+                , nMigrated( 0 )
+                , nUsed( 0 )
+                , nBudget( pPredecessor ? capacity() - pPredecessor->capacity() : 0 )
+            {}
+
+            size_t capacity() const
+            {
+                return nGroupCount * c_nGroupWidth;
+            }
+
+            size_t max_used() const
+            {
+                return capacity() - capacity() / 8;
+            }
+        };
+
+        typedef typename std::allocator_traits< allocator >::template rebind_alloc< node > node_allocator_type;
+        typedef cds::details::Allocator< node, node_allocator_type > cxx_node_allocator;
+        typedef typename std::allocator_traits< allocator >::template rebind_alloc< table > table_allocator_type;
+        typedef cds::details::Allocator< table, table_allocator_type > cxx_table_allocator;
+
+        struct node_disposer
+        {
+            void operator()( node * p ) const
+            {
+                free_node( p );
+            }
+        };
+
+        // The items are not freed, they belong to the successor table
+        struct table_disposer
+        {
+            void operator()( table * t ) const
+            {
+                free_table( t );
+            }
+        };
+
+        enum {
+            guard_table,    // current table
+            guard_pred,     // predecessor table
+            guard_item,     // item found
+            guard_migrate,  // item being migrated
+            guard_count
+        };
+        typedef typename gc::template GuardArray< guard_count > guard_array;
+
+        typedef typename cds::opt::details::apply_padding< lock_type, cds::opt::cache_line_padding >::type padded_lock;
+        static constexpr const size_t c_nLockCount = 256;       // count of writer stripes
+        static constexpr const size_t c_nMigrateStep = 2;       // count of groups migrated by one writer operation
+
+        // Slot position in a table
+        struct position
+        {
+            group *     pGroup;
+            unsigned    nSlot;
+        };
+
+        enum reserve_result {
+            reserve_ok,
+            reserve_sealed,     // the table is being migrated, new items go to the successor table
+            reserve_full        // no free slot
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        atomics::atomic<table *>    m_pHead;        // current table
+        item_counter                m_ItemCounter;
+        atomics::atomic<bool>       m_bResizing;
+        padded_lock                 m_arrLocks[c_nLockCount];
+        mutable stat                m_Stat;
+        //@endcond
+
+    public:
+        /// Initializes the map
+        /**
+            The initial table is sized so that \p nInitialItemCount items fill it for at most 7/8.
+        */
+        SwissHashMap(
+            size_t nInitialItemCount = 1024     ///< estimation of initial item count in the hash map
+        ) : m_bResizing( false )
+        {
+            m_pHead.store( alloc_table( swiss_hash::details::initial_group_count( nInitialItemCount ), nullptr ), atomics::memory_order_release );
+        }
+
+        /// Clears the map and destroys it
+        ~SwissHashMap()
+        {
+            table * t = m_pHead.load( atomics::memory_order_relaxed );
+            table * pPred = t->pPred.load( atomics::memory_order_relaxed );
+            if ( pPred ) {
+                // The moved slots are cleared, so all items left belong to the predecessor
+                free_items( pPred );
+                free_table( pPred );
+            }
+            free_items( t );
+            free_table( t );
+        }
+
+        /// Inserts new node with key and default value
+        /**
+            The function creates a node with \p key and default value, and then inserts the node created into the map.
+
+            Preconditions:
+            - The \p key_type should be constructible from value of type \p K.
+            - The \p mapped_type should be default-constructible.
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K>
+        bool insert( K const& key )
+        {
+            return insert_node( alloc_node( hash_value( key ), key_type( key )), []( value_type& ) {} );
+        }
+
+        /// Inserts new node
+        /**
+            The function creates a node with copy of \p val value
+            and then inserts the node created into the map.
+
+            Preconditions:
+            - The \p key_type should be constructible from \p key of type \p K.
+            - The \p mapped_type should be constructible from \p val of type \p V.
+
+            Returns \p true if \p val is inserted into the map, \p false otherwise.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val )
+        {
+            return insert_node( alloc_node( hash_value( key ), key_type( key ), val ), []( value_type& ) {} );
+        }
+
+        /// Inserts new node and initialize it by a functor
+        /**
+            This function inserts new node with key \p key and if inserting is successful then it calls
+            \p func functor with signature
+            \code
+                struct functor {
+                    void operator()( value_type& item );
+                };
+            \endcode
+
+            The argument \p item of user-defined functor \p func is the reference
+            to the map's item inserted:
+                - <tt>item.first</tt> is a const reference to item's key that cannot be changed.
+                - <tt>item.second</tt> is a reference to item's value that may be changed.
+
+            The user-defined functor is called only if inserting is successful.
+
+            @warning The new item is already visible for other threads when \p func is called,
+            so \p func should take into account the concurrent access to the item.
+        */
+        template <typename K, typename Func>
+        bool insert_with( K const& key, Func func )
+        {
+            return insert_node( alloc_node( hash_value( key ), key_type( key )), func );
+        }
+
+        /// For key \p key inserts data of type \p mapped_type created from \p args
+        /**
+            \p key_type should be constructible from type \p K
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K, typename... Args>
+        bool emplace( K&& key, Args&&... args )
+        {
+            size_t const nHash = hash_value( key );
+            return insert_node( alloc_node( nHash, key_type( std::forward<K>( key )), std::forward<Args>( args )... ), []( value_type& ) {} );
+        }
+
+        /// Updates data by \p key
+        /**
+            If the \p key not found in the map, then the new item created from \p key
+            will be inserted into the map iff \p bAllowInsert is \p true.
+            (note that in this case the \ref key_type should be constructible from type \p K).
+            Otherwise, if \p key is found, the functor \p func is called with item found.
+
+            The functor \p func signature is:
+            \code
+                struct my_functor {
+                    void operator()( bool bNew, value_type& item );
+                };
+            \endcode
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - the item found or inserted
+
+            The functor is called under the writer lock of the key, so \p func does not race
+            with other \p update() calls for the same key; however, the readers may access the item concurrently.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is true if operation is successful,
+            \p second is true if new item has been added or \p false if the item with \p key
+            already exists.
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> update( K const& key, Func func, bool bAllowInsert = true )
+        {
+            return update_at( key, hash_value( key ), func, bAllowInsert );
+        }
+
+        /// Deletes \p key from the map
+        /**
+            Return \p true if \p key is found and deleted, \p false otherwise
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            return erase_at( key, hash_value( key ), []( value_type& ) {} );
+        }
+
+        /// Deletes \p key from the map
+        /**
+            The function searches an item with key \p key, calls \p f functor
+            and deletes the item. If \p key is not found, the functor is not called.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()( value_type& item ) { ... }
+            };
+            \endcode
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename K, typename Func>
+        bool erase( K const& key, Func f )
+        {
+            return erase_at( key, hash_value( key ), f );
+        }
+
+        /// Finds the key \p key
+        /**
+            The function searches the item with key equal to \p key and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            where \p item is the item found.
+
+            The functor may change \p item.second. Note that the functor is only guarantee
+            that \p item cannot be disposed during functor is executing.
+            The functor does not serialize simultaneous access to the map's \p item. If such access is
+            possible you must provide your own synchronization schema on item level to exclude unsafe item modifications.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f )
+        {
+            guard_array guards;
+            node * p = find_at( key, hash_value( key ), guards );
+            if ( p ) {
+                f( p->m_Value );
+                return true;
+            }
+            return false;
+        }
+
+        /// Checks whether the map contains \p key
+        /**
+            The function searches the item with key equal to \p key
+            and returns \p true if it is found, and \p false otherwise.
+        */
+        template <typename K>
+        bool contains( K const& key )
+        {
+            guard_array guards;
+            return find_at( key, hash_value( key ), guards ) != nullptr;
+        }
+
+        /// Clears the map (not atomic)
+        /**
+            The function erases the items one by one.
+            The items inserted concurrently may stay in the map.
+        */
+        void clear()
+        {
+            guard_array guards;
+            table * t = guards.protect( guard_table, m_pHead );
+            table * pPred = guards.protect( guard_pred, t->pPred );
+            if ( pPred )
+                clear_table( pPred, guards );
+            clear_table( t, guards );
+        }
+
+        /// Checks if the map is empty
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /// Returns item count in the map
+        size_t size() const
+        {
+            return m_ItemCounter.value();
+        }
+
+        /// Returns the slot count of current table
+        /**
+            The value grows as the map grows.
+        */
+        size_t capacity() const
+        {
+            typename gc::Guard g;
+            return g.protect( m_pHead )->capacity();
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        template <typename K>
+        static size_t hash_value( K const& key )
+        {
+            return swiss_hash::details::mix_hash( hash()( key ));
+        }
+
+        static uint8_t h2( size_t nHash )
+        {
+            return static_cast<uint8_t>( nHash & 0x7F );
+        }
+
+        template <typename... Args>
+        static node * alloc_node( size_t nHash, Args&&... args )
+        {
+            return cxx_node_allocator().MoveNew( nHash, std::forward<Args>( args )... );
+        }
+
+        static void free_node( node * p )
+        {
+            cxx_node_allocator().Delete( p );
+        }
+
+        static table * alloc_table( size_t nGroupCount, table * pPred )
+        {
+            table * t = cxx_table_allocator().NewBlock( sizeof( table ) + sizeof( group ) * ( nGroupCount - 1 ), nGroupCount, pPred );
+            for ( size_t i = 1; i < nGroupCount; ++i )
+                new ( &t->groups[i] ) group;
+            return t;
+        }
+
+        static void free_table( table * t )
+        {
+            cxx_table_allocator().Delete( t );
+        }
+
+        static void free_items( table * t )
+        {
+            for ( size_t i = 0; i < t->nGroupCount; ++i ) {
+                for ( auto& s : t->groups[i].slots ) {
+                    node * p = s.load( atomics::memory_order_relaxed );
+                    if ( p )
+                        free_node( p );
+                }
+            }
+        }
+
+        lock_type& lock_of( size_t nHash )
+        {
+            // H1 selects the group, so the stripe is taken from the high bits too
+            return m_arrLocks[( nHash >> 7 ) & ( c_nLockCount - 1 )].data;
+        }
+
+        // Calls f( group& ) for groups of the probe sequence of nHash until f returns true
+        template <typename Func>
+        static bool probe( table * t, size_t nHash, Func f )
+        {
+            size_t const nMask = t->nGroupCount - 1;
+            size_t idx = ( nHash >> 7 ) & nMask;
+            for ( size_t i = 1; i <= t->nGroupCount; ++i ) {
+                if ( f( t->groups[idx] ))
+                    return true;
+                idx = ( idx + i ) & nMask;
+            }
+            return false;
+        }
+
+        // Lock-free search in t. The item found is protected by guard nGuard
+        template <typename K>
+        node * search( table * t, K const& key, size_t nHash, guard_array& guards, size_t nGuard = guard_item, position * pPos = nullptr )
+        {
+            node * pFound = nullptr;
+            uint8_t const nH2 = h2( nHash );
+            probe( t, nHash, [&]( group& g ) -> bool {
+                group_matcher const m( g.ctrl );
+                for ( unsigned nMatch = m.match( nH2 ); nMatch; nMatch &= nMatch - 1 ) {
+                    unsigned const nSlot = cds::bitop::LSBnz( nMatch );
+                    node * p = guards.protect( nGuard, g.slots[nSlot] );
+                    if ( p && p->nHash == nHash && key_comparator()( p->m_Value.first, key ) == 0 ) {
+                        pFound = p;
+                        if ( pPos ) {
+                            pPos->pGroup = &g;
+                            pPos->nSlot = nSlot;
+                        }
+                        return true;
+                    }
+                }
+                return m.match_stop() != 0;
+            });
+            return pFound;
+        }
+
+        // Reserves a free slot in the probe sequence of nHash; the control byte of the slot reserved is ctrl_busy
+        reserve_result reserve( table * t, size_t nHash, position& pos )
+        {
+            reserve_result res = reserve_full;
+            back_off bkoff;
+            probe( t, nHash, [&]( group& g ) -> bool {
+                while ( true ) {
+                    group_matcher const m( g.ctrl );
+                    if ( m.match( swiss_hash::details::ctrl_sealed )) {
+                        res = reserve_sealed;
+                        return true;
+                    }
+
+                    unsigned const nEmpty = m.match( swiss_hash::details::ctrl_empty );
+                    for ( unsigned nFree = m.match_free(); nFree; nFree &= nFree - 1 ) {
+                        unsigned const nSlot = cds::bitop::LSBnz( nFree );
+                        uint8_t const nCtrl = ( nEmpty & ( 1u << nSlot )) ? swiss_hash::details::ctrl_empty : swiss_hash::details::ctrl_deleted;
+                        if ( g.ctrl.cas( nSlot, nCtrl, swiss_hash::details::ctrl_busy )) {
+                            if ( nCtrl == swiss_hash::details::ctrl_empty )
+                                t->nUsed.fetch_add( 1, atomics::memory_order_relaxed );
+                            pos.pGroup = &g;
+                            pos.nSlot = nSlot;
+                            res = reserve_ok;
+                            return true;
+                        }
+                        m_Stat.onSlotRace();
+                    }
+
+                    // The probing cannot pass the group that has an empty slot
+                    if ( !nEmpty )
+                        return false;
+                    bkoff();
+                }
+            });
+            return res;
+        }
+
+        static void publish( position const& pos, node * p )
+        {
+            pos.pGroup->slots[pos.nSlot].store( p, atomics::memory_order_release );
+            bool const bOk = pos.pGroup->ctrl.cas( pos.nSlot, swiss_hash::details::ctrl_busy, h2( p->nHash ));
+            CDS_UNUSED( bOk );
+            assert( bOk );
+        }
+
+        // Unlinks the item at pos; the caller owns the key lock
+        void unlink( position const& pos, node * p )
+        {
+            // The control byte is changed first: the readers do not match the slot anymore
+            bool const bOk = pos.pGroup->ctrl.cas( pos.nSlot, h2( p->nHash ), swiss_hash::details::ctrl_deleted );
+            CDS_UNUSED( bOk );
+            assert( bOk );
+            pos.pGroup->slots[pos.nSlot].store( nullptr, atomics::memory_order_release );
+            --m_ItemCounter;
+        }
+
+        // Searches the key under the key lock: in the predecessor table, then in the current one
+        template <typename K>
+        node * locked_search( K const& key, size_t nHash, guard_array& guards, table *& t, position& pos )
+        {
+            t = guards.protect( guard_table, m_pHead );
+            table * pPred = guards.protect( guard_pred, t->pPred );
+            if ( pPred ) {
+                node * p = search( pPred, key, nHash, guards, guard_item, &pos );
+                if ( p )
+                    return p;
+            }
+            return search( t, key, nHash, guards, guard_item, &pos );
+        }
+
+        template <typename Func>
+        bool insert_node( node * pNode, Func f )
+        {
+            guard_array guards;
+            bool bFull = false;
+            bool bNoBudget = false;
+
+            while ( true ) {
+                help_migrate( guards );
+                if ( bNoBudget ) {
+                    finish_migrate( guards );
+                    bNoBudget = false;
+                }
+                if ( bFull ) {
+                    grow( guards );
+                    bFull = false;
+                }
+
+                {
+                    std::unique_lock< lock_type > sl( lock_of( pNode->nHash ));
+                    while ( true ) {
+                        table * t;
+                        position pos;
+                        if ( locked_search( pNode->m_Value.first, pNode->nHash, guards, t, pos )) {
+                            sl.unlock();
+                            free_node( pNode );
+                            m_Stat.onInsertFailed();
+                            return false;
+                        }
+
+                        if ( !claim_budget( t )) {
+                            bNoBudget = true;
+                            break;
+                        }
+
+                        reserve_result const res = reserve( t, pNode->nHash, pos );
+                        if ( res == reserve_sealed ) {
+                            // The table is being migrated, try the successor
+                            m_Stat.onSealedRetry();
+                            continue;
+                        }
+                        if ( res == reserve_full ) {
+                            bFull = true;
+                            break;
+                        }
+
+                        publish( pos, pNode );
+                        ++m_ItemCounter;
+                        m_Stat.onInsertSuccess();
+                        f( pNode->m_Value );
+                        break;
+                    }
+                }
+
+                if ( !bFull && !bNoBudget ) {
+                    check_grow( guards );
+                    return true;
+                }
+            }
+        }
+
+        template <typename K, typename Func>
+        std::pair<bool, bool> update_at( K const& key, size_t nHash, Func func, bool bAllowInsert )
+        {
+            guard_array guards;
+            node * pNode = nullptr;
+            bool bFull = false;
+            bool bNoBudget = false;
+
+            while ( true ) {
+                help_migrate( guards );
+                if ( bNoBudget ) {
+                    finish_migrate( guards );
+                    bNoBudget = false;
+                }
+                if ( bFull ) {
+                    grow( guards );
+                    bFull = false;
+                }
+
+                {
+                    std::unique_lock< lock_type > sl( lock_of( nHash ));
+                    while ( true ) {
+                        table * t;
+                        position pos;
+                        node * p = locked_search( key, nHash, guards, t, pos );
+                        if ( p ) {
+                            func( false, p->m_Value );
+                            sl.unlock();
+                            if ( pNode )
+                                free_node( pNode );
+                            m_Stat.onUpdateExisting();
+                            return std::make_pair( true, false );
+                        }
+
+                        if ( !bAllowInsert ) {
+                            sl.unlock();
+                            if ( pNode )
+                                free_node( pNode );
+                            m_Stat.onUpdateFailed();
+                            return std::make_pair( false, false );
+                        }
+
+                        // The node is allocated before reserving: the slot reserved must be published
+                        if ( !pNode )
+                            pNode = alloc_node( nHash, key_type( key ));
+
+                        if ( !claim_budget( t )) {
+                            bNoBudget = true;
+                            break;
+                        }
+
+                        reserve_result const res = reserve( t, nHash, pos );
+                        if ( res == reserve_sealed ) {
+                            m_Stat.onSealedRetry();
+                            continue;
+                        }
+                        if ( res == reserve_full ) {
+                            bFull = true;
+                            break;
+                        }
+
+                        publish( pos, pNode );
+                        ++m_ItemCounter;
+                        m_Stat.onUpdateNew();
+                        func( true, pNode->m_Value );
+                        break;
+                    }
+                }
+
+                if ( !bFull && !bNoBudget ) {
+                    check_grow( guards );
+                    return std::make_pair( true, true );
+                }
+            }
+        }
+
+        template <typename K, typename Func>
+        bool erase_at( K const& key, size_t nHash, Func f )
+        {
+            guard_array guards;
+            help_migrate( guards );
+
+            node * p;
+            {
+                std::unique_lock< lock_type > sl( lock_of( nHash ));
+                table * t;
+                position pos;
+                p = locked_search( key, nHash, guards, t, pos );
+                if ( !p ) {
+                    m_Stat.onEraseFailed();
+                    return false;
+                }
+                unlink( pos, p );
+                f( p->m_Value );
+            }
+
+            m_Stat.onEraseSuccess();
+            guards.clear( guard_item );
+            gc::template retire<node_disposer>( p );
+            return true;
+        }
+
+        template <typename K>
+        node * find_at( K const& key, size_t nHash, guard_array& guards )
+        {
+            while ( true ) {
+                table * t = guards.protect( guard_table, m_pHead );
+                table * pPred = guards.protect( guard_pred, t->pPred );
+
+                // An item is moved to the successor before its slot in the predecessor is cleared,
+                // so the predecessor is searched first
+                node * p = pPred ? search( pPred, key, nHash, guards ) : nullptr;
+                if ( !p )
+                    p = search( t, key, nHash, guards );
+                if ( p ) {
+                    m_Stat.onFindSuccess();
+                    return p;
+                }
+
+                // If t has been replaced while searching, the key may have been moved to the successor
+                if ( m_pHead.load( atomics::memory_order_acquire ) == t ) {
+                    m_Stat.onFindFailed();
+                    return nullptr;
+                }
+                m_Stat.onFindRetry();
+            }
+        }
+
+        void clear_table( table * t, guard_array& guards )
+        {
+            for ( size_t i = 0; i < t->nGroupCount; ++i ) {
+                group& g = t->groups[i];
+                for ( unsigned nSlot = 0; nSlot < c_nGroupWidth; ++nSlot ) {
+                    node * p = guards.protect( guard_item, g.slots[nSlot] );
+                    if ( !p )
+                        continue;
+
+                    {
+                        std::unique_lock< lock_type > sl( lock_of( p->nHash ));
+                        if ( g.slots[nSlot].load( atomics::memory_order_acquire ) != p || g.ctrl.get( nSlot ) != h2( p->nHash ))
+                            continue;
+                        position pos = { &g, nSlot };
+                        unlink( pos, p );
+                    }
+                    guards.clear( guard_item );
+                    gc::template retire<node_disposer>( p );
+                }
+            }
+        }
+
+        // Moves the items of the group idx of pPred to t and seals the group
+        void migrate_group( table * t, table * pPred, size_t idx, guard_array& guards )
+        {
+            using namespace swiss_hash::details;
+
+            group& g = pPred->groups[idx];
+            for ( unsigned nSlot = 0; nSlot < c_nGroupWidth; ) {
+                uint8_t const nCtrl = g.ctrl.get( nSlot );
+                switch ( nCtrl ) {
+                case ctrl_sealed:
+                case ctrl_moved:
+                    ++nSlot;
+                    continue;
+                case ctrl_empty:
+                    if ( g.ctrl.cas( nSlot, ctrl_empty, ctrl_sealed ))
+                        ++nSlot;
+                    continue;
+                case ctrl_deleted:
+                    if ( g.ctrl.cas( nSlot, ctrl_deleted, ctrl_moved ))
+                        ++nSlot;
+                    continue;
+                case ctrl_busy:
+                    // An inserter is publishing the item, it does not wait for anything
+                    m_Stat.onMigrateWait();
+                    cds::backoff::yield()();
+                    continue;
+                default:
+                    break;
+                }
+
+                // The slot is full. The item cannot be changed by the writers while its key lock is held
+                node * p = guards.protect( guard_migrate, g.slots[nSlot] );
+                if ( !p )
+                    continue;   // the item is being erased
+
+                std::unique_lock< lock_type > sl( lock_of( p->nHash ));
+                if ( g.ctrl.get( nSlot ) != nCtrl || g.slots[nSlot].load( atomics::memory_order_acquire ) != p )
+                    continue;
+
+                // The writers take at most t->nBudget slots of t while the migration is in progress,
+                // the rest of t is enough for all items of the predecessor; t cannot be sealed
+                // until the migration is done
+                position pos;
+                reserve_result const res = reserve( t, p->nHash, pos );
+                CDS_UNUSED( res );
+                assert( res == reserve_ok );
+                publish( pos, p );
+
+                g.ctrl.cas( nSlot, nCtrl, ctrl_moved );
+                g.slots[nSlot].store( nullptr, atomics::memory_order_release );
+                m_Stat.onItemMoved();
+                ++nSlot;
+            }
+            guards.clear( guard_migrate );
+            m_Stat.onGroupMigrated();
+        }
+
+        // Migrates next c_nMigrateStep groups of the predecessor table if any.
+        // Must be called without the key lock held
+        void help_migrate( guard_array& guards )
+        {
+            table * t = guards.protect( guard_table, m_pHead );
+            table * pPred = guards.protect( guard_pred, t->pPred );
+            if ( !pPred )
+                return;
+
+            for ( size_t nStep = 0; nStep < c_nMigrateStep; ++nStep ) {
+                if ( t->nMigrateCursor.load( atomics::memory_order_relaxed ) >= pPred->nGroupCount )
+                    return;
+                size_t const idx = t->nMigrateCursor.fetch_add( 1, atomics::memory_order_acq_rel );
+                if ( idx >= pPred->nGroupCount )
+                    return;
+
+                migrate_group( t, pPred, idx, guards );
+
+                if ( t->nMigrated.fetch_add( 1, atomics::memory_order_acq_rel ) + 1 == pPred->nGroupCount ) {
+                    // All groups are sealed, the predecessor is not needed anymore
+                    t->pPred.store( nullptr, atomics::memory_order_release );
+                    guards.clear( guard_pred );
+                    gc::template retire<table_disposer>( pPred );
+                    return;
+                }
+            }
+        }
+
+        // Helps to migrate the predecessor table until all its groups are migrated.
+        // Must be called without the key lock held
+        void finish_migrate( guard_array& guards )
+        {
+            table * t = guards.protect( guard_table, m_pHead );
+            while ( t->pPred.load( atomics::memory_order_acquire )) {
+                help_migrate( guards );
+                cds::backoff::yield()();
+            }
+        }
+
+        // Takes a slot of the budget of t for a new item if t is being migrated into.
+        // If the budget is exhausted the writer should finish the migration first
+        bool claim_budget( table * t )
+        {
+            if ( !t->pPred.load( atomics::memory_order_acquire ))
+                return true;
+
+            size_t nBudget = t->nBudget.load( atomics::memory_order_relaxed );
+            do {
+                if ( nBudget == 0 ) {
+                    m_Stat.onBudgetExhausted();
+                    return false;
+                }
+            } while ( !t->nBudget.compare_exchange_weak( nBudget, nBudget - 1, atomics::memory_order_relaxed, atomics::memory_order_relaxed ));
+            return true;
+        }
+
+        void check_grow( guard_array& guards )
+        {
+            table * t = guards.protect( guard_table, m_pHead );
+            if ( t->nUsed.load( atomics::memory_order_relaxed ) > t->max_used() && !t->pPred.load( atomics::memory_order_relaxed ))
+                grow( guards );
+        }
+
+        // Installs new table; the items are migrated by the writers later.
+        // Must be called without the key lock held
+        void grow( guard_array& guards )
+        {
+            if ( m_bResizing.load( atomics::memory_order_relaxed ) || m_bResizing.exchange( true, atomics::memory_order_acquire ))
+                return;
+
+            table * t = guards.protect( guard_table, m_pHead );
+
+            // Next growing is possible only when the previous migration is done
+            finish_migrate( guards );
+
+            if ( t->nUsed.load( atomics::memory_order_relaxed ) > t->max_used()) {
+                // If most of used slots are tombstones, the same-size table is enough
+                size_t nGroupCount = t->nGroupCount;
+                if ( size() * 2 > t->capacity())
+                    nGroupCount *= 2;
+
+                m_pHead.store( alloc_table( nGroupCount, t ), atomics::memory_order_release );
+                if ( nGroupCount == t->nGroupCount )
+                    m_Stat.onRehash();
+                else
+                    m_Stat.onGrow();
+            }
+
+            m_bResizing.store( false, atomics::memory_order_release );
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_SWISS_HASH_MAP_H
@@ -78,9 +78,16 @@ namespace cds { namespace container {
             /// Lock type used in elimination, default is cds::sync::spin
             typedef cds::sync::spin lock_type;
 
+            /// Adaptive elimination, default is \p false. See \p treiber_stack::adaptive_elimination
+            static constexpr const bool adaptive_elimination = false;
+
             ///@}
         };
 
+        /// [type-option] Enables adaptive elimination back-off, see \p cds::intrusive::treiber_stack::adaptive_elimination
+        template <bool Enable>
+        using adaptive_elimination = cds::intrusive::treiber_stack::adaptive_elimination< Enable >;
+
         /// Metafunction converting option list to \p TreiberStack traits
         /**
             Supported \p Options are:
@@ -105,6 +112,7 @@ namespace cds { namespace container {
             - \p opt::elimination_storage - a storage class for elmination records. Default is \p cds::algo::elimination::storage.
             - \p opt::elimination_backoff - back-off strategy to wait for elimination, default is \p cds::backoff::delay<>
             - \p opt::lock_type - a lock type used in elimination back-off, default is \p cds::sync::spin.
+            - \p treiber_stack::adaptive_elimination - adapt elimination array width and collision wait at runtime, default is \p false.
 
             Example: declare %TreiberStack with item counting and internal statistics using \p %make_traits
             \code
@@ -351,6 +359,71 @@ namespace cds { namespace container {
             return true;
         }
 
+        /// Pushes copies of the values of the range <tt>[itFirst, itLast)</tt> on the stack by one CAS
+        /**
+            The nodes for all values are allocated and linked into a chain locally,
+            then the chain is spliced onto the stack top by one CAS.
+            The last value of the range becomes the top of the stack, as if the values were pushed one by one.
+            \p Iterator should be an input iterator with <tt>*it</tt> convertible to \p value_type.
+
+            The chain does not take part in elimination back-off.
+            The function returns \p false if the range is empty, \p true otherwise.
+            If an allocation throws an exception, the stack is not changed.
+        */
+        template <typename Iterator>
+        bool push_chain( Iterator itFirst, Iterator itLast )
+        {
+            if ( itFirst == itLast )
+                return false;
+
+            // The chain is freed if an allocation throws
+            struct chain_holder {
+                node_type * pTop = nullptr;
+
+                ~chain_holder()
+                {
+                    while ( pTop ) {
+                        node_type * p = pTop;
+                        pTop = static_cast<node_type *>( p->m_pNext.load( memory_model::memory_order_relaxed ));
+                        free_node( p );
+                    }
+                }
+            } chain;
+
+            node_type * pBottom = alloc_node( *itFirst );
+            chain.pTop = pBottom;
+            size_t nCount = 1;
+            for ( ++itFirst; itFirst != itLast; ++itFirst ) {
+                node_type * pNode = alloc_node( *itFirst );
+                pNode->m_pNext.store( chain.pTop, memory_model::memory_order_relaxed );
+                chain.pTop = pNode;
+                ++nCount;
+            }
+
+            node_type * pTop = chain.pTop;
+            chain.pTop = nullptr;
+            base_class::link_chain( pTop, pBottom, nCount );
+            return true;
+        }
+
+        /// Pops all items from the stack by one atomic operation
+        /**
+            The function detaches the whole stack by one atomic exchange and calls \p f
+            for each value from the top to the bottom:
+            \code
+            void f( value_type& src );
+            \endcode
+            \p f can copy or move \p src. The function returns the number of items popped.
+        */
+        template <typename Func>
+        size_t pop_all( Func f )
+        {
+            return base_class::pop_all( [&f]( node_type& node ) {
+                f( node.m_value );
+                retire_node( &node );
+            });
+        }
+
         /// Check if stack is empty
         bool empty() const
         {
@@ -0,0 +1,385 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_TS_QUEUE_H
+#define CDSLIB_CONTAINER_TS_QUEUE_H
+
+#include <thread>       // std::thread::hardware_concurrency
+#include <cds/container/details/ts_base.h>
+#include <cds/details/allocator.h>
+
+namespace cds { namespace container {
+
+    /// Timestamped queue
+    /** @ingroup cds_nonintrusive_queue
+        Source:
+            - [2015] M.Dodds, A.Haas, C.M.Kirsch "A Scalable, Correct Time-Stamped Stack"
+                (the queue is the FIFO variant of the timestamped container family)
+
+        The queue has an array of buffers; each thread enqueues into its own buffer only,
+        tagging the item with a timestamp (see \p ts::timestamp option). \p pop() scans the heads of all buffers
+        and removes the oldest one. The items with overlapping timestamps have been enqueued concurrently,
+        so \p pop() may remove any of them; it just takes the first found.
+
+        A buffer is a FIFO lock-free list with a dummy head node like \p MSQueue.
+        The buffer owner links the new item at the tail that is usually in the owner's cache,
+        so the enqueuing threads do not contend on the same memory.
+
+        The thread is mapped to the buffer <tt>thread_index % buffer_count()</tt>, where \p thread_index is
+        the sequential number of the thread in the process. If there are more threads than buffers,
+        several threads share a buffer. The queue stays correct in that case, however, the order
+        of the items enqueued concurrently into the same buffer may differ from their timestamps.
+
+        Template arguments:
+        - \p GC - garbage collector type: \p gc::HP, \p gc::DHP
+        - \p T - type stored in the queue. It should be default-constructible for the dummy nodes.
+        - \p Traits - queue traits, default is \p ts::traits. You can use \p ts::make_traits
+            metafunction to make your traits or just derive your traits from \p %ts::traits.
+    */
+    template <typename GC, typename T, typename Traits = ts::traits >
+    class TSQueue
+    {
+    public:
+        typedef GC      gc;             ///< Garbage collector
+        typedef T       value_type;     ///< Type of value to be stored in the queue
+        typedef Traits  traits;         ///< Queue traits
+
+        typedef typename traits::back_off       back_off;       ///< Back-off strategy
+        typedef typename traits::timestamp      timestamp;      ///< Timestamping algorithm
+        typedef typename traits::item_counter   item_counter;   ///< Item counter type
+        typedef typename traits::stat           stat;           ///< Internal statistics
+
+        static constexpr const size_t c_nHazardPtrCount = 4; ///< Count of hazard pointer required for the algorithm
+
+        /// Rebind template arguments
+        template <typename GC2, typename T2, typename Traits2>
+        struct rebind {
+            typedef TSQueue< GC2, T2, Traits2 > other;   ///< Rebinding result
+        };
+
+    protected:
+        //@cond
+        struct node_type
+        {
+            atomics::atomic<node_type *> m_pNext;
+            ts::stamp                    m_Stamp;
+            value_type                   m_Value;
+
+            template <typename... Args>
+            node_type( Args&&... args )
+                : m_pNext( nullptr )
+                , m_Value( std::forward<Args>( args )... )
+            {}
+        };
+
+        typedef typename std::allocator_traits<typename traits::allocator>::template rebind_alloc< node_type > node_allocator_type;
+        typedef cds::details::Allocator< node_type, node_allocator_type > cxx_node_allocator;
+
+        struct node_disposer
+        {
+            void operator()( node_type * p ) const
+            {
+                cxx_node_allocator().Delete( p );
+            }
+        };
+
+        struct buffer
+        {
+            atomics::atomic<node_type *> pHead;
+            atomics::atomic<node_type *> pTail;
+
+            buffer()
+            {
+                node_type * pDummy = cxx_node_allocator().New();
+                pHead.store( pDummy, atomics::memory_order_relaxed );
+                pTail.store( pDummy, atomics::memory_order_relaxed );
+            }
+
+            ~buffer()
+            {
+                node_type * p = pHead.load( atomics::memory_order_relaxed );
+                while ( p ) {
+                    node_type * pNext = p->m_pNext.load( atomics::memory_order_relaxed );
+                    cxx_node_allocator().Delete( p );
+                    p = pNext;
+                }
+            }
+        };
+
+        typedef typename cds::opt::details::apply_padding< buffer, traits::padding >::type padded_buffer;
+        typedef typename std::allocator_traits<typename traits::allocator>::template rebind_alloc< padded_buffer > buffer_allocator_type;
+        typedef cds::details::Allocator< padded_buffer, buffer_allocator_type > cxx_buffer_allocator;
+
+        // guards: 0, 1 - head and its next of the best buffer found; 2, 3 - the same for the current buffer
+        typedef typename gc::template GuardArray<4> guard_array;
+        //@endcond
+
+    protected:
+        //@cond
+        padded_buffer *     m_arrBuffer;
+        size_t const        m_nBufferCount;
+        timestamp           m_Timestamp;
+        item_counter        m_ItemCounter;
+        mutable stat        m_Stat;
+        //@endcond
+
+    public:
+        /// Constructs empty queue with <tt>std::thread::hardware_concurrency()</tt> buffers
+        TSQueue()
+            : TSQueue( std::thread::hardware_concurrency())
+        {}
+
+        /// Constructs empty queue with \p nBufferCount buffers
+        /**
+            \p nBufferCount should be not less than the number of threads working with the queue,
+            otherwise some threads share the buffer. The cost of \p pop() is proportional to \p nBufferCount.
+        */
+        explicit TSQueue( size_t nBufferCount )
+            : m_nBufferCount( nBufferCount ? nBufferCount : 1 )
+        {
+            m_arrBuffer = cxx_buffer_allocator().NewArray( m_nBufferCount );
+        }
+
+        /// Clears the queue and destroys the object
+        ~TSQueue()
+        {
+            clear();
+            cxx_buffer_allocator().Delete( m_arrBuffer, m_nBufferCount );
+        }
+
+        /// Enqueues a copy of \p val
+        /**
+            The function always returns \p true.
+        */
+        bool enqueue( value_type const& val )
+        {
+            return emplace( val );
+        }
+
+        /// Enqueues \p val (move semantics)
+        bool enqueue( value_type&& val )
+        {
+            return emplace( std::move( val ));
+        }
+
+        /// Enqueues data of type \ref value_type constructed by \p f functor
+        /**
+            The functor takes one argument - a reference to the default-constructed value of the new item:
+            \code
+            cds::container::TSQueue< cds::gc::HP, Foo > myQueue;
+            Bar bar;
+            myQueue.enqueue_with( [&bar]( Foo& dest ) { dest = bar; } );
+            \endcode
+        */
+        template <typename Func>
+        bool enqueue_with( Func f )
+        {
+            node_type * pNew = cxx_node_allocator().New();
+            f( pNew->m_Value );
+            enqueue_node( pNew );
+            return true;
+        }
+
+        /// Enqueues an item constructed from \p args
+        template <typename... Args>
+        bool emplace( Args&&... args )
+        {
+            enqueue_node( cxx_node_allocator().MoveNew( std::forward<Args>( args )... ));
+            return true;
+        }
+
+        /// Synonym for \p enqueue( value_type const& )
+        bool push( value_type const& val )
+        {
+            return enqueue( val );
+        }
+
+        /// Synonym for \p enqueue( value_type&& )
+        bool push( value_type&& val )
+        {
+            return enqueue( std::move( val ));
+        }
+
+        /// Synonym for \p enqueue_with()
+        template <typename Func>
+        bool push_with( Func f )
+        {
+            return enqueue_with( f );
+        }
+
+        /// Dequeues the oldest item
+        /**
+            If the queue is empty, the function returns \p false.
+            Otherwise, it returns \p true and \p dest contains the item moved from the queue.
+        */
+        bool dequeue( value_type& dest )
+        {
+            return dequeue_with( [&dest]( value_type& src ) { dest = std::move( src ); } );
+        }
+
+        /// Dequeues the oldest item and calls \p f for it
+        /**
+            The functor takes one argument - a reference to the value being removed.
+            The functor is called when the item is already unlinked from the queue.
+
+            The function returns \p false if each buffer has been found empty while scanning.
+        */
+        template <typename Func>
+        bool dequeue_with( Func f )
+        {
+            guard_array guards;
+            back_off bkoff;
+            size_t const nStart = cds::algo::thread_index();
+
+            while ( true ) {
+                buffer * pBest = nullptr;
+                node_type * pBestHead = nullptr;
+                node_type * pBestNode = nullptr;
+
+                for ( size_t i = 0; i < m_nBufferCount; ++i ) {
+                    buffer& b = m_arrBuffer[ ( nStart + i ) % m_nBufferCount ].data;
+
+                    node_type * pHead;
+                    node_type * pNode;
+                    do {
+                        pHead = guards.protect( 2, b.pHead );
+                        pNode = guards.protect( 3, pHead->m_pNext );
+                    } while ( pHead != b.pHead.load( atomics::memory_order_acquire ));
+
+                    if ( !pNode )
+                        continue;
+
+                    if ( !pBestNode || ts::is_before( pNode->m_Stamp, pBestNode->m_Stamp )) {
+                        pBest = &b;
+                        pBestHead = pHead;
+                        pBestNode = pNode;
+                        guards.copy( 0, 2 );
+                        guards.copy( 1, 3 );
+                    }
+                }
+
+                if ( !pBestNode ) {
+                    m_Stat.onPopEmpty();
+                    return false;
+                }
+
+                if ( unlink( *pBest, pBestHead, pBestNode )) {
+                    --m_ItemCounter;
+                    m_Stat.onPop();
+                    // pBestNode becomes the dummy node of the buffer
+                    f( pBestNode->m_Value );
+                    gc::template retire<node_disposer>( pBestHead );
+                    return true;
+                }
+
+                m_Stat.onPopRetry();
+                bkoff();
+            }
+        }
+
+        /// Synonym for \p dequeue()
+        bool pop( value_type& dest )
+        {
+            return dequeue( dest );
+        }
+
+        /// Synonym for \p dequeue_with()
+        template <typename Func>
+        bool pop_with( Func f )
+        {
+            return dequeue_with( f );
+        }
+
+        /// Checks if the queue is empty
+        /**
+            The function scans all buffers.
+        */
+        bool empty() const
+        {
+            typename gc::Guard guard;
+            for ( size_t i = 0; i < m_nBufferCount; ++i ) {
+                node_type * pHead = guard.protect( m_arrBuffer[i].data.pHead );
+                if ( pHead->m_pNext.load( atomics::memory_order_relaxed ))
+                    return false;
+            }
+            return true;
+        }
+
+        /// Clears the queue (not atomic)
+        void clear()
+        {
+            while ( dequeue_with( []( value_type& ) {} ));
+        }
+
+        /// Returns queue's item count
+        /**
+            The value returned depends on \p ts::traits::item_counter option.
+            For \p atomicity::empty_item_counter, this function always returns 0.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter.value();
+        }
+
+        /// Returns the number of buffers
+        size_t buffer_count() const
+        {
+            return m_nBufferCount;
+        }
+
+        /// Returns reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        void enqueue_node( node_type * pNew )
+        {
+            pNew->m_Stamp = m_Timestamp.get();
+
+            buffer& b = m_arrBuffer[ cds::algo::thread_index() % m_nBufferCount ].data;
+            typename gc::Guard guard;
+            back_off bkoff;
+            while ( true ) {
+                node_type * pTail = guard.protect( b.pTail );
+                node_type * pNext = pTail->m_pNext.load( atomics::memory_order_acquire );
+                if ( pNext ) {
+                    // Tail is behind: another thread shares the buffer
+                    b.pTail.compare_exchange_weak( pTail, pNext, atomics::memory_order_release, atomics::memory_order_relaxed );
+                    m_Stat.onPushRace();
+                    continue;
+                }
+
+                node_type * pNull = nullptr;
+                if ( pTail->m_pNext.compare_exchange_strong( pNull, pNew, atomics::memory_order_release, atomics::memory_order_relaxed )) {
+                    b.pTail.compare_exchange_strong( pTail, pNew, atomics::memory_order_release, atomics::memory_order_relaxed );
+                    break;
+                }
+                m_Stat.onPushRace();
+                bkoff();
+            }
+
+            ++m_ItemCounter;
+            m_Stat.onPush();
+        }
+
+        static bool unlink( buffer& b, node_type * pHead, node_type * pNext )
+        {
+            // The head must not pass the tail: help the enqueuer to advance the tail
+            node_type * pTail = b.pTail.load( atomics::memory_order_acquire );
+            if ( pTail == pHead )
+                b.pTail.compare_exchange_strong( pTail, pNext, atomics::memory_order_release, atomics::memory_order_relaxed );
+
+            // pHead is guarded, so ABA is impossible
+            return b.pHead.compare_exchange_strong( pHead, pNext, atomics::memory_order_acquire, atomics::memory_order_relaxed );
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_TS_QUEUE_H
@@ -0,0 +1,326 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_TS_STACK_H
+#define CDSLIB_CONTAINER_TS_STACK_H
+
+#include <thread>       // std::thread::hardware_concurrency
+#include <cds/container/details/ts_base.h>
+#include <cds/details/allocator.h>
+
+namespace cds { namespace container {
+
+    /// Timestamped stack
+    /** @ingroup cds_nonintrusive_stack
+        Source:
+            - [2015] M.Dodds, A.Haas, C.M.Kirsch "A Scalable, Correct Time-Stamped Stack"
+
+        A classic lock-free stack like \p TreiberStack linearizes each operation on the stack top,
+        so the stack does not scale when many threads push concurrently.
+        The timestamped stack has an array of buffers; each thread pushes into its own buffer only,
+        tagging the item with a timestamp (see \p ts::timestamp option). \p pop() scans the tops of all buffers
+        and removes the youngest one. The items with overlapping timestamps have been pushed concurrently,
+        so \p pop() may remove any of them; it just takes the first found. If \p pop() finds an item pushed after
+        \p pop() has been started, it removes the item immediately without completing the scan (elimination).
+
+        A buffer is a lock-free list of items ordered from the youngest to the oldest.
+        The buffer owner pushes by CAS on the buffer top that is usually in the owner's cache,
+        the removers remove the buffer top by CAS.
+
+        The thread is mapped to the buffer <tt>thread_index % buffer_count()</tt>, where \p thread_index is
+        the sequential number of the thread in the process. If there are more threads than buffers,
+        several threads share a buffer. The stack stays correct in that case, however, the order
+        of the items pushed concurrently into the same buffer may differ from their timestamps.
+
+        Template arguments:
+        - \p GC - garbage collector type: \p gc::HP, \p gc::DHP
+        - \p T - type stored in the stack
+        - \p Traits - stack traits, default is \p ts::traits. You can use \p ts::make_traits
+            metafunction to make your traits or just derive your traits from \p %ts::traits:
+            \code
+            struct myTraits: public cds::container::ts::traits {
+                typedef cds::container::ts::stat<> stat;
+            };
+            typedef cds::container::TSStack< cds::gc::HP, Foo, myTraits > myStack;
+
+            // Equivalent make_traits example:
+            typedef cds::container::TSStack< cds::gc::HP, Foo,
+                typename cds::container::ts::make_traits<
+                    cds::opt::stat< cds::container::ts::stat<> >
+                >::type
+            > myStack;
+            \endcode
+    */
+    template <typename GC, typename T, typename Traits = ts::traits >
+    class TSStack
+    {
+    public:
+        typedef GC      gc;             ///< Garbage collector
+        typedef T       value_type;     ///< Type of value to be stored in the stack
+        typedef Traits  traits;         ///< Stack traits
+
+        typedef typename traits::back_off       back_off;       ///< Back-off strategy
+        typedef typename traits::timestamp      timestamp;      ///< Timestamping algorithm
+        typedef typename traits::item_counter   item_counter;   ///< Item counter type
+        typedef typename traits::stat           stat;           ///< Internal statistics
+
+        static constexpr const size_t c_nHazardPtrCount = 2; ///< Count of hazard pointer required for the algorithm
+
+        /// Rebind template arguments
+        template <typename GC2, typename T2, typename Traits2>
+        struct rebind {
+            typedef TSStack< GC2, T2, Traits2 > other;   ///< Rebinding result
+        };
+
+    protected:
+        //@cond
+        struct node_type
+        {
+            atomics::atomic<node_type *> m_pNext;
+            ts::stamp                    m_Stamp;
+            value_type                   m_Value;
+
+            template <typename... Args>
+            node_type( Args&&... args )
+                : m_pNext( nullptr )
+                , m_Value( std::forward<Args>( args )... )
+            {}
+        };
+
+        typedef typename std::allocator_traits<typename traits::allocator>::template rebind_alloc< node_type > node_allocator_type;
+        typedef cds::details::Allocator< node_type, node_allocator_type > cxx_node_allocator;
+
+        struct node_disposer
+        {
+            void operator()( node_type * p ) const
+            {
+                cxx_node_allocator().Delete( p );
+            }
+        };
+
+        struct buffer
+        {
+            atomics::atomic<node_type *> pTop;
+
+            buffer()
+                : pTop( nullptr )
+            {}
+        };
+
+        typedef typename cds::opt::details::apply_padding< buffer, traits::padding >::type padded_buffer;
+        typedef typename std::allocator_traits<typename traits::allocator>::template rebind_alloc< padded_buffer > buffer_allocator_type;
+        typedef cds::details::Allocator< padded_buffer, buffer_allocator_type > cxx_buffer_allocator;
+
+        typedef typename gc::template GuardArray<2> guard_array;
+        //@endcond
+
+    protected:
+        //@cond
+        padded_buffer *     m_arrBuffer;
+        size_t const        m_nBufferCount;
+        timestamp           m_Timestamp;
+        item_counter        m_ItemCounter;
+        mutable stat        m_Stat;
+        //@endcond
+
+    public:
+        /// Constructs empty stack with <tt>std::thread::hardware_concurrency()</tt> buffers
+        TSStack()
+            : TSStack( std::thread::hardware_concurrency())
+        {}
+
+        /// Constructs empty stack with \p nBufferCount buffers
+        /**
+            \p nBufferCount should be not less than the number of threads working with the stack,
+            otherwise some threads share the buffer. The cost of \p pop() is proportional to \p nBufferCount.
+        */
+        explicit TSStack( size_t nBufferCount )
+            : m_nBufferCount( nBufferCount ? nBufferCount : 1 )
+        {
+            m_arrBuffer = cxx_buffer_allocator().NewArray( m_nBufferCount );
+        }
+
+        /// Clears the stack and destroys the object
+        ~TSStack()
+        {
+            clear();
+            cxx_buffer_allocator().Delete( m_arrBuffer, m_nBufferCount );
+        }
+
+        /// Pushes copy of \p val on the stack
+        /**
+            The function always returns \p true.
+        */
+        bool push( value_type const& val )
+        {
+            return emplace( val );
+        }
+
+        /// Pushes \p val on the stack (move semantics)
+        bool push( value_type&& val )
+        {
+            return emplace( std::move( val ));
+        }
+
+        /// Pushes an item constructed from \p args on the stack
+        template <typename... Args>
+        bool emplace( Args&&... args )
+        {
+            node_type * pNew = cxx_node_allocator().MoveNew( std::forward<Args>( args )... );
+            pNew->m_Stamp = m_Timestamp.get();
+
+            buffer& b = m_arrBuffer[ cds::algo::thread_index() % m_nBufferCount ].data;
+            node_type * pTop = b.pTop.load( atomics::memory_order_relaxed );
+            back_off bkoff;
+            while ( true ) {
+                pNew->m_pNext.store( pTop, atomics::memory_order_relaxed );
+                if ( b.pTop.compare_exchange_weak( pTop, pNew, atomics::memory_order_release, atomics::memory_order_relaxed ))
+                    break;
+                m_Stat.onPushRace();
+                bkoff();
+            }
+
+            ++m_ItemCounter;
+            m_Stat.onPush();
+            return true;
+        }
+
+        /// Pops the youngest item from the stack
+        /**
+            If the stack is empty, the function returns \p false.
+            Otherwise, it returns \p true and \p dest contains the item moved from the stack.
+        */
+        bool pop( value_type& dest )
+        {
+            return pop_with( [&dest]( value_type& src ) { dest = std::move( src ); } );
+        }
+
+        /// Pops the youngest item from the stack and calls \p f for it
+        /**
+            The functor takes one argument - a reference to the value being removed:
+            \code
+            cds:container::TSStack< cds::gc::HP, Foo > myStack;
+            Bar bar;
+            myStack.pop_with( [&bar]( Foo& src ) { bar = std::move( src );});
+            \endcode
+            The functor is called when the item is already unlinked from the stack.
+
+            The function returns \p false if each buffer has been found empty while scanning.
+        */
+        template <typename Func>
+        bool pop_with( Func f )
+        {
+            guard_array guards;
+            back_off bkoff;
+            size_t const nStart = cds::algo::thread_index();
+
+            while ( true ) {
+                uint64_t const nPopStart = m_Timestamp.now();
+                buffer * pBest = nullptr;
+                node_type * pBestNode = nullptr;
+
+                for ( size_t i = 0; i < m_nBufferCount; ++i ) {
+                    buffer& b = m_arrBuffer[ ( nStart + i ) % m_nBufferCount ].data;
+                    node_type * pNode = guards.protect( 1, b.pTop );
+                    if ( !pNode )
+                        continue;
+
+                    if ( pNode->m_Stamp.nStart > nPopStart ) {
+                        // The item is pushed after the pop has been started, so it can be popped immediately
+                        if ( unlink( b, pNode )) {
+                            m_Stat.onEliminate();
+                            dispose( pNode, f );
+                            return true;
+                        }
+                        continue;
+                    }
+
+                    if ( !pBestNode || ts::is_before( pBestNode->m_Stamp, pNode->m_Stamp )) {
+                        pBest = &b;
+                        pBestNode = pNode;
+                        guards.copy( 0, 1 );
+                    }
+                }
+
+                if ( !pBestNode ) {
+                    m_Stat.onPopEmpty();
+                    return false;
+                }
+
+                if ( unlink( *pBest, pBestNode )) {
+                    dispose( pBestNode, f );
+                    return true;
+                }
+
+                m_Stat.onPopRetry();
+                bkoff();
+            }
+        }
+
+        /// Checks if the stack is empty
+        /**
+            The function scans all buffers.
+        */
+        bool empty() const
+        {
+            for ( size_t i = 0; i < m_nBufferCount; ++i ) {
+                if ( m_arrBuffer[i].data.pTop.load( atomics::memory_order_relaxed ))
+                    return false;
+            }
+            return true;
+        }
+
+        /// Clears the stack (not atomic)
+        void clear()
+        {
+            while ( pop_with( []( value_type& ) {} ));
+        }
+
+        /// Returns stack's item count
+        /**
+            The value returned depends on \p ts::traits::item_counter option.
+            For \p atomicity::empty_item_counter, this function always returns 0.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter.value();
+        }
+
+        /// Returns the number of buffers
+        size_t buffer_count() const
+        {
+            return m_nBufferCount;
+        }
+
+        /// Returns reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        static bool unlink( buffer& b, node_type * pNode )
+        {
+            // pNode is guarded, so ABA is impossible
+            node_type * pExpected = pNode;
+            return b.pTop.compare_exchange_strong( pExpected, pNode->m_pNext.load( atomics::memory_order_relaxed ),
+                atomics::memory_order_acquire, atomics::memory_order_relaxed );
+        }
+
+        template <typename Func>
+        void dispose( node_type * pNode, Func& f )
+        {
+            --m_ItemCounter;
+            m_Stat.onPop();
+            f( pNode->m_Value );
+            gc::template retire<node_disposer>( pNode );
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_TS_STACK_H
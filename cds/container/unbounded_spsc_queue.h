@@ -0,0 +1,501 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_UNBOUNDED_SPSC_QUEUE_H
+#define CDSLIB_CONTAINER_UNBOUNDED_SPSC_QUEUE_H
+
+#include <type_traits>
+#include <cds/container/details/base.h>
+#include <cds/container/weak_ringbuffer.h>
+#include <cds/opt/buffer.h>
+#include <cds/opt/value_cleaner.h>
+#include <cds/algo/atomic.h>
+#include <cds/algo/int_algo.h>
+#include <cds/details/allocator.h>
+
+namespace cds { namespace container {
+
+    /// \p UnboundedSPSCQueue related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace unbounded_spsc_queue {
+
+        /// \p UnboundedSPSCQueue internal statistics
+        template <typename Counter = cds::atomicity::event_counter>
+        struct stat {
+            typedef Counter counter_type;   ///< Counter type
+
+            counter_type m_nChunkAlloc;     ///< Count of chunks allocated from the heap
+            counter_type m_nChunkReuse;     ///< Count of chunks taken from the chunk cache
+            counter_type m_nChunkFree;      ///< Count of chunks freed since the chunk cache is full
+
+            //@cond
+            void onChunkAlloc() { ++m_nChunkAlloc; }
+            void onChunkReuse() { ++m_nChunkReuse; }
+            void onChunkFree()  { ++m_nChunkFree; }
+            //@endcond
+        };
+
+        /// \p UnboundedSPSCQueue empty internal statistics
+        struct empty_stat {
+            //@cond
+            void onChunkAlloc() const {}
+            void onChunkReuse() const {}
+            void onChunkFree()  const {}
+            //@endcond
+        };
+
+        /// \p UnboundedSPSCQueue default traits
+        struct traits
+        {
+            /// Allocator for the chunks and the chunk cache
+            typedef CDS_DEFAULT_ALLOCATOR allocator;
+
+            /// A functor to clean item dequeued.
+            /**
+                The functor calls the destructor for queue item.
+                Default value is \ref opt::v::auto_cleaner that calls destructor only if it is not trivial.
+            */
+            typedef cds::opt::v::auto_cleaner value_cleaner;
+
+            /// Item counting feature; by default, disabled. Use \p cds::atomicity::item_counter to enable item counting
+            typedef cds::atomicity::empty_item_counter item_counter;
+
+            /// Internal statistics, possible types: \p unbounded_spsc_queue::stat, \p unbounded_spsc_queue::empty_stat (the default)
+            typedef empty_stat stat;
+
+            /// C++ memory ordering model
+            /**
+                Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
+                or \p opt::v::sequential_consistent (sequentially consistent memory model).
+            */
+            typedef opt::v::relaxed_ordering memory_model;
+
+            /// Padding for producer and consumer data. Default is \p opt::cache_line_padding
+            enum { padding = opt::cache_line_padding };
+        };
+
+        /// Metafunction converting option list to \p unbounded_spsc_queue::traits
+        /**
+            Supported \p Options are:
+            - \p opt::allocator - allocator for the chunks and the chunk cache. Default is \ref CDS_DEFAULT_ALLOCATOR
+            - \p opt::value_cleaner - a functor to clean items dequeued. Default is \ref opt::v::auto_cleaner
+            - \p opt::item_counter - the type of item counting feature. Default is \p cds::atomicity::empty_item_counter (item counting disabled)
+                To enable item counting use \p cds::atomicity::item_counter
+            - \p opt::stat - internal statistics. Possible types: \p unbounded_spsc_queue::stat, \p unbounded_spsc_queue::empty_stat (the default)
+            - \p opt::memory_model - C++ memory ordering model. Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
+                or \p opt::v::sequential_consistent (sequentially consistent memory model).
+            - \p opt::padding - padding for producer and consumer data. Default is \p opt::cache_line_padding
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                , Options...
+            >::type type;
+#   endif
+        };
+
+    } // namespace unbounded_spsc_queue
+
+    /// Unbounded single-producer single-consumer queue
+    /** @ingroup cds_nonintrusive_queue
+
+        Source:
+            - [2012] Massimo Torquati, Marco Aldinucci, Marco Danelutto et al.
+                An Efficient Unbounded Lock-Free Queue for Multi-core Systems. Euro-Par 2012 (uSPSC queue)
+
+        The queue is a linked list of fixed-size chunks. The producer fills the tail chunk
+        and links a new chunk when the tail is full; the consumer reads the head chunk and
+        moves to the next chunk when the head is exhausted. \p push() never fails (except
+        for out-of-memory), \p pop() returns \p false only if the queue is empty.
+
+        Exhausted chunks are returned by the consumer to a small chunk cache and are reused by the producer,
+        so in the steady state the queue does not allocate memory. The chunk cache is
+        a \p WeakRingBuffer of chunk pointers where the consumer and the producer play the inverse roles.
+        If the cache is full, the chunk is freed.
+
+        The producer and the consumer data is placed in different cache lines. The only shared data in a chunk
+        is the producer's write position that the consumer caches locally: the consumer reads it
+        only when it has consumed all items seen before. The producer does not read any consumer data
+        except the chunk cache.
+
+        Only one thread may call \p enqueue() functions and only one thread may call \p dequeue() functions at a time.
+
+        Template parameters:
+        - \p T - value type
+        - \p Traits - queue traits, default is \p unbounded_spsc_queue::traits.
+            Use \p unbounded_spsc_queue::make_traits metafunction to make your traits
+            or just derive your traits from \p %unbounded_spsc_queue::traits.
+
+        Example:
+        \code
+        #include <cds/container/unbounded_spsc_queue.h>
+
+        // pipeline stage link: chunks of 1024 items, up to 8 cached chunks
+        cds::container::UnboundedSPSCQueue< message > link( 1024, 8 );
+        \endcode
+    */
+    template <typename T, typename Traits = unbounded_spsc_queue::traits>
+    class UnboundedSPSCQueue
+    {
+    public:
+        typedef T value_type;   ///< Value type stored in the queue
+        typedef Traits traits;  ///< Queue traits
+        typedef typename traits::value_cleaner value_cleaner; ///< Value cleaner, see \p unbounded_spsc_queue::traits::value_cleaner
+        typedef typename traits::item_counter  item_counter;  ///< Item counter type
+        typedef typename traits::stat          stat;          ///< Internal statistics type
+        typedef typename traits::memory_model  memory_model;  ///< Memory ordering. See \p cds::opt::memory_model option
+
+        /// Rebind template arguments
+        template <typename T2, typename Traits2>
+        struct rebind {
+            typedef UnboundedSPSCQueue< T2, Traits2 > other;   ///< Rebinding result
+        };
+
+    protected:
+        //@cond
+        typedef typename std::aligned_storage< sizeof( value_type ), alignof( value_type )>::type cell_type;
+
+        struct chunk
+        {
+            atomics::atomic<size_t> back;   // producer's write position in the chunk
+            atomics::atomic<chunk*> next;
+            cell_type* const        cells;
+
+            explicit chunk( cell_type* pCells )
+                : back( 0 )
+                , next( nullptr )
+                , cells( pCells )
+            {}
+
+            value_type* at( size_t i )
+            {
+                return reinterpret_cast<value_type*>( cells + i );
+            }
+        };
+
+        typedef typename std::allocator_traits<typename traits::allocator>::template rebind_alloc< chunk >     chunk_allocator_type;
+        typedef typename std::allocator_traits<typename traits::allocator>::template rebind_alloc< cell_type > cell_allocator_type;
+        typedef cds::details::Allocator< chunk, chunk_allocator_type > cxx_chunk_allocator;
+
+        typedef typename traits::allocator queue_allocator;
+        struct chunk_cache_traits: public weak_ringbuffer::traits
+        {
+            typedef cds::opt::v::uninitialized_dynamic_buffer< void*, queue_allocator > buffer;
+            typedef opt::v::empty_cleaner value_cleaner;
+            typedef typename UnboundedSPSCQueue::memory_model memory_model;
+        };
+        typedef WeakRingBuffer< chunk*, chunk_cache_traits > chunk_cache;
+        //@endcond
+
+    public:
+        /// Creates the queue
+        /**
+            \p nChunkSize - the number of items in the chunk, rounded up to the nearest power of two.
+            \p nCacheSize - the maximum number of free chunks kept for reuse, rounded up to the nearest power of two.
+        */
+        explicit UnboundedSPSCQueue( size_t nChunkSize = 256, size_t nCacheSize = 4 )
+            : m_nChunkSize( beans::ceil2( nChunkSize < 2 ? 2 : nChunkSize ))
+            , m_ChunkCache( beans::ceil2( nCacheSize < 2 ? 2 : nCacheSize ))
+        {
+            chunk* c = alloc_chunk();
+            m_Producer.tail = c;
+            m_Producer.back = 0;
+            m_Consumer.head = c;
+            m_Consumer.front = 0;
+            m_Consumer.cached_back = 0;
+        }
+
+        /// Destroys the queue; the items remaining in the queue are destroyed by \p value_cleaner
+        ~UnboundedSPSCQueue()
+        {
+            clear();
+
+            free_chunk( m_Consumer.head );
+
+            chunk* c;
+            while ( m_ChunkCache.pop( c ))
+                free_chunk( c );
+        }
+
+        /// Enqueues data to the queue using a functor
+        /**
+            \p Func is a functor called to create a value in the queue cell.
+            The functor \p f takes one argument - a reference to a raw uninitialized cell of type \ref value_type :
+            \code
+            cds::container::UnboundedSPSCQueue< Foo > myQueue;
+            Bar bar;
+            myQueue.enqueue_with( [&bar]( Foo& dest ) { new ( &dest ) Foo( std::move( bar )); } );
+            \endcode
+
+            The function must be called from the producer thread only. It always returns \p true.
+        */
+        template <typename Func>
+        bool enqueue_with( Func f )
+        {
+            chunk* c = m_Producer.tail;
+            size_t back = m_Producer.back;
+
+            if ( back == m_nChunkSize ) {
+                chunk* pNew = get_chunk();
+                c->next.store( pNew, memory_model::memory_order_release );
+                m_Producer.tail = c = pNew;
+                back = 0;
+            }
+
+            f( *c->at( back ));
+
+            m_Producer.back = ++back;
+            c->back.store( back, memory_model::memory_order_release );
+            ++m_ItemCounter;
+            return true;
+        }
+
+        /// Enqueues \p val value into the queue
+        bool enqueue( value_type const& val )
+        {
+            return enqueue_with( [&val]( value_type& dest ){ new ( &dest ) value_type( val ); });
+        }
+
+        /// Enqueues \p val value into the queue, move semantics
+        bool enqueue( value_type&& val )
+        {
+            return enqueue_with( [&val]( value_type& dest ) { new ( &dest ) value_type( std::move( val )); });
+        }
+
+        /// Synonym for \p enqueue( value_type const& )
+        bool push( value_type const& val )
+        {
+            return enqueue( val );
+        }
+
+        /// Synonym for \p enqueue( value_type&& )
+        bool push( value_type&& val )
+        {
+            return enqueue( std::move( val ));
+        }
+
+        /// Synonym for \p enqueue_with()
+        template <typename Func>
+        bool push_with( Func f )
+        {
+            return enqueue_with( f );
+        }
+
+        /// Enqueues data of type \ref value_type constructed with <tt>std::forward<Args>(args)...</tt>
+        template <typename... Args>
+        bool emplace( Args&&... args )
+        {
+#if (CDS_COMPILER == CDS_COMPILER_GCC) && (CDS_COMPILER_VERSION < 40900)
+            //work around unsupported feature in g++ 4.8 for forwarding parameter packs to lambda.
+            value_type val( std::forward<Args>(args)... );
+            return enqueue_with( [&val]( value_type& dest ){ new ( &dest ) value_type( std::move( val )); });
+#else
+            return enqueue_with( [&args ...]( value_type& dest ){ new ( &dest ) value_type( std::forward<Args>( args )... ); });
+#endif
+        }
+
+        /// Dequeues a value using a functor
+        /**
+            \p Func is a functor called to copy dequeued value.
+            The functor takes one argument - a reference to the item:
+            \code
+            cds:container::UnboundedSPSCQueue< Foo > myQueue;
+            Bar bar;
+            myQueue.dequeue_with( [&bar]( Foo& src ) { bar = std::move( src );});
+            \endcode
+            The functor is called only if the queue is not empty.
+
+            The function must be called from the consumer thread only.
+        */
+        template <typename Func>
+        bool dequeue_with( Func f )
+        {
+            if ( !ensure_front())
+                return false;
+
+            value_type* p = m_Consumer.head->at( m_Consumer.front++ );
+            f( *p );
+            value_cleaner()( *p );
+            --m_ItemCounter;
+            return true;
+        }
+
+        /// Dequeues a value from the queue
+        /**
+            If queue is not empty, the function returns \p true, \p dest contains a copy of
+            dequeued value. The assignment operator for type \ref value_type is invoked.
+            If queue is empty, the function returns \p false, \p dest is unchanged.
+        */
+        bool dequeue( value_type& dest )
+        {
+            return dequeue_with( [&dest]( value_type& src ){ dest = std::move( src );});
+        }
+
+        /// Synonym for \p dequeue()
+        bool pop( value_type& dest )
+        {
+            return dequeue( dest );
+        }
+
+        /// Synonym for \p dequeue_with()
+        template <typename Func>
+        bool pop_with( Func f )
+        {
+            return dequeue_with( f );
+        }
+
+        /// Returns a pointer to the front item without removing it
+        /**
+            The function must be called from the consumer thread only.
+            If the queue is empty, returns \p nullptr.
+        */
+        value_type* front()
+        {
+            if ( !ensure_front())
+                return nullptr;
+            return m_Consumer.head->at( m_Consumer.front );
+        }
+
+        /// Checks if the queue is empty
+        /**
+            The function must be called from the consumer thread only.
+        */
+        bool empty()
+        {
+            return !ensure_front();
+        }
+
+        /// Clears the queue
+        /**
+            The function must be called from the consumer thread only.
+        */
+        void clear()
+        {
+            while ( dequeue_with( []( value_type& ) {} ));
+        }
+
+        /// Returns queue's item count
+        /**
+            The value returned depends on \p unbounded_spsc_queue::traits::item_counter.
+            For \p atomicity::empty_item_counter, the function always returns 0.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter.value();
+        }
+
+        /// Returns the chunk size
+        size_t chunk_size() const
+        {
+            return m_nChunkSize;
+        }
+
+        /// Returns internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        // Consumer: makes sure m_Consumer.front points to a published item
+        bool ensure_front()
+        {
+            if ( m_Consumer.front != m_Consumer.cached_back )
+                return true;
+
+            chunk* c = m_Consumer.head;
+            m_Consumer.cached_back = c->back.load( memory_model::memory_order_acquire );
+            if ( m_Consumer.front != m_Consumer.cached_back )
+                return true;
+
+            if ( m_Consumer.front < m_nChunkSize )
+                return false;
+
+            // The head chunk is exhausted
+            chunk* pNext = c->next.load( memory_model::memory_order_acquire );
+            if ( !pNext )
+                return false;
+
+            m_Consumer.head = pNext;
+            m_Consumer.front = 0;
+            m_Consumer.cached_back = pNext->back.load( memory_model::memory_order_acquire );
+            put_chunk( c );
+
+            return m_Consumer.cached_back != 0;
+        }
+
+        chunk* alloc_chunk()
+        {
+            m_Stat.onChunkAlloc();
+            cell_type* cells = cell_allocator_type().allocate( m_nChunkSize );
+            return cxx_chunk_allocator().New( cells );
+        }
+
+        void free_chunk( chunk* c )
+        {
+            cell_allocator_type().deallocate( c->cells, m_nChunkSize );
+            cxx_chunk_allocator().Delete( c );
+        }
+
+        // Producer: takes a chunk from the cache or allocates new one
+        chunk* get_chunk()
+        {
+            chunk* c;
+            if ( m_ChunkCache.pop( c )) {
+                m_Stat.onChunkReuse();
+                c->back.store( 0, memory_model::memory_order_relaxed );
+                c->next.store( nullptr, memory_model::memory_order_relaxed );
+                return c;
+            }
+            return alloc_chunk();
+        }
+
+        // Consumer: returns the exhausted chunk to the cache
+        void put_chunk( chunk* c )
+        {
+            if ( !m_ChunkCache.push( c )) {
+                m_Stat.onChunkFree();
+                free_chunk( c );
+            }
+        }
+        //@endcond
+
+    protected:
+        //@cond
+        struct producer_data {
+            chunk*  tail;
+            size_t  back;   // local copy of tail->back
+        };
+
+        struct consumer_data {
+            chunk*  head;
+            size_t  front;
+            size_t  cached_back; // cached value of head->back
+        };
+
+        size_t const m_nChunkSize;
+        typename opt::details::apply_padding< size_t, traits::padding >::padding_type pad0_;
+
+        producer_data m_Producer;
+        typename opt::details::apply_padding< producer_data, traits::padding >::padding_type pad1_;
+
+        consumer_data m_Consumer;
+        typename opt::details::apply_padding< consumer_data, traits::padding >::padding_type pad2_;
+
+        chunk_cache   m_ChunkCache;
+        item_counter  m_ItemCounter;
+        stat          m_Stat;
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_UNBOUNDED_SPSC_QUEUE_H
@@ -222,6 +222,32 @@ namespace cds { namespace container {
             m_posDequeue.store(0, memory_model::memory_order_relaxed);
         }
 
+        /// Constructs the queue of capacity \p nCapacity placed in caller-supplied \p pStorage
+        /**
+            The constructor is intended for \p cds::opt::v::uninitialized_external_buffer only.
+            \p pStorage should be at least \p storage_size( nCapacity ) bytes.
+
+            If the queue object and \p pStorage are placed in one shared memory region,
+            the queue can be used by the processes mapping that region, see \p cds::container::process_shared::ring_segment.
+
+            The buffer capacity must be the power of two.
+        */
+        VyukovMPMCCycleQueue( void* pStorage, size_t nCapacity )
+            : m_buffer( pStorage, nCapacity )
+            , m_nBufferMask( m_buffer.capacity() - 1 )
+        {
+            nCapacity = m_buffer.capacity();
+
+            // Buffer capacity must be power of 2
+            assert( nCapacity >= 2 && (nCapacity & (nCapacity - 1)) == 0 );
+
+            for (size_t i = 0; i != nCapacity; ++i )
+                new( &m_buffer[i].sequence ) sequence_type( i );
+
+            m_posEnqueue.store(0, memory_model::memory_order_relaxed);
+            m_posDequeue.store(0, memory_model::memory_order_relaxed);
+        }
+
         ~VyukovMPMCCycleQueue()
         {
             clear();
@@ -476,6 +502,15 @@ namespace cds { namespace container {
         {
             return m_buffer.capacity();
         }
+
+        /// Returns the size in bytes of the external storage required for the queue of \p nCapacity elements
+        /**
+            The function is intended for \p cds::opt::v::uninitialized_external_buffer only.
+        */
+        static constexpr size_t storage_size( size_t nCapacity )
+        {
+            return buffer::storage_size( nCapacity );
+        }
     };
 
     //@cond
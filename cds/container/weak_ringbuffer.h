@@ -11,6 +11,7 @@
 #include <cds/opt/value_cleaner.h>
 #include <cds/algo/atomic.h>
 #include <cds/details/bounded_container.h>
+#include <limits>
 
 namespace cds { namespace container {
 
@@ -153,6 +154,23 @@ namespace cds { namespace container {
             back_.store( 0, memory_model::memory_order_release );
         }
 
+        /// Creates the ring buffer of \p capacity elements placed in caller-supplied \p storage
+        /**
+            The constructor is intended for \p cds::opt::v::uninitialized_external_buffer only.
+            \p storage should be at least \p storage_size( capacity ) bytes.
+
+            If the ring object and \p storage are placed in one shared memory region,
+            the ring can be used by the processes mapping that region, see \p cds::container::process_shared::ring_segment.
+        */
+        WeakRingBuffer( void* storage, size_t capacity )
+            : front_( 0 )
+            , pfront_( 0 )
+            , cback_( 0 )
+            , buffer_( storage, capacity )
+        {
+            back_.store( 0, memory_model::memory_order_release );
+        }
+
         /// Destroys the ring buffer
         ~WeakRingBuffer()
         {
@@ -531,6 +549,15 @@ namespace cds { namespace container {
             return buffer_.capacity();
         }
 
+        /// Returns the size in bytes of the external storage required for the ring of \p capacity elements
+        /**
+            The function is intended for \p cds::opt::v::uninitialized_external_buffer only.
+        */
+        static constexpr size_t storage_size( size_t capacity )
+        {
+            return buffer::storage_size( capacity );
+        }
+
     private:
         //@cond
         atomics::atomic<counter_type>   front_;
@@ -635,12 +662,31 @@ namespace cds { namespace container {
         WeakRingBuffer( size_t capacity = 0 )
             : front_( 0 )
             , pfront_( 0 )
+            , pback_( 0 )
             , cback_( 0 )
             , buffer_( capacity )
         {
             back_.store( 0, memory_model::memory_order_release );
         }
 
+        /// Creates the ring buffer of \p capacity bytes placed in caller-supplied \p storage
+        /**
+            The constructor is intended for \p cds::opt::v::uninitialized_external_buffer only.
+            \p storage should be at least \p storage_size( capacity ) bytes.
+
+            If the ring object and \p storage are placed in one shared memory region,
+            the ring can be used by the processes mapping that region, see \p cds::container::process_shared::ring_segment.
+        */
+        WeakRingBuffer( void* storage, size_t capacity )
+            : front_( 0 )
+            , pfront_( 0 )
+            , pback_( 0 )
+            , cback_( 0 )
+            , buffer_( storage, capacity )
+        {
+            back_.store( 0, memory_model::memory_order_release );
+        }
+
         /// [producer] Reserve \p size bytes
         /**
             The function returns a pointer to reserved buffer of \p size bytes.
@@ -690,6 +736,9 @@ namespace cds { namespace container {
             assert( real_size < capacity());
             counter_type back = back_.load( memory_model::memory_order_relaxed );
 
+            // back()/push_back() cannot be mixed with uncommitted reserve()
+            assert( pback_ == back );
+
             assert( static_cast<size_t>( back - pfront_ ) <= capacity());
 
             if ( static_cast<size_t>( pfront_ + capacity() - back ) < real_size ) {
@@ -726,6 +775,7 @@ namespace cds { namespace container {
                 }
 
                 back_.store( back, memory_model::memory_order_release );
+                pback_ = back;
                 reserved = buffer_.buffer();
             }
 
@@ -779,7 +829,8 @@ namespace cds { namespace container {
             size_t real_size = calc_real_size( *reinterpret_cast<size_t*>( reserved ));
             assert( real_size < capacity());
 
-            back_.store( back + real_size, memory_model::memory_order_release );
+            pback_ = back + real_size;
+            back_.store( pback_, memory_model::memory_order_release );
         }
 
         /// [producer] Push \p data of \p size bytes into ring
@@ -798,6 +849,112 @@ namespace cds { namespace container {
             return false;
         }
 
+        /// [producer] Reserves \p size bytes for a record of the batch
+        /**
+            Unlike \p back(), the function may be called several times in a row: each call reserves
+            the next record after the records reserved earlier. Reserved records are invisible for the consumer
+            until \p commit() is called; \p commit() publishes all of them at once with one atomic store.
+
+            Returns a pointer to the record's buffer, or \p nullptr if there is no enough space in the ring;
+            the records reserved before stay reserved.
+
+            Batch producer loop:
+            \code
+            WeakRingBuffer<void>    theRing( 1024 * 1024 );
+
+            void producer_thread()
+            {
+                while ( true ) {
+                    // Fill up to 32 records
+                    for ( int i = 0; i < 32 && has_data(); ++i ) {
+                        size_t size = next_size();
+                        void* buf = theRing.reserve( size );
+                        if ( !buf )
+                            break;
+                        fill_data( buf, size );
+                    }
+
+                    // Publish all of them
+                    theRing.commit();
+                }
+            }
+            \endcode
+
+            Do not mix \p reserve() with \p back()/\p push_back(): call \p commit() or \p rollback() before \p back().
+        */
+        void* reserve( size_t size )
+        {
+            assert( size > 0 );
+
+            size_t real_size = calc_real_size( size );
+            assert( real_size < capacity());
+
+            counter_type back = pback_;
+            uint8_t* reserved = reserve_contiguous( back, real_size );
+            if ( !reserved )
+                return nullptr;
+
+            *reinterpret_cast<size_t*>( reserved ) = size;
+            pback_ = back + real_size;
+            return reinterpret_cast<void*>( reserved + sizeof( size_t ));
+        }
+
+        /// [producer] Reserves \p count records in one contiguous area
+        /**
+            The function reserves \p count records, <tt>sizes[i]</tt> bytes each, all-or-nothing.
+            The records are placed one after another without wrapping around the end of the ring:
+            if the batch does not fit in the tail of the ring, the tail is skipped and the batch
+            is placed at the beginning of the ring. So, the batch is one contiguous memory area
+            that can be filled, for example, by one \p read() or DMA transfer.
+
+            On success, <tt>records[i]</tt> contains the pointer to the buffer of i-th record.
+            The records become visible for the consumer after \p commit().
+
+            Returns \p false if there is no enough space in the ring; in this case nothing is reserved.
+        */
+        bool reserve( size_t const* sizes, size_t count, void** records )
+        {
+            assert( count > 0 );
+
+            size_t total_size = 0;
+            for ( size_t i = 0; i < count; ++i ) {
+                assert( sizes[i] > 0 );
+                total_size += calc_real_size( sizes[i] );
+            }
+            assert( total_size < capacity());
+
+            counter_type back = pback_;
+            uint8_t* reserved = reserve_contiguous( back, total_size );
+            if ( !reserved )
+                return false;
+
+            for ( size_t i = 0; i < count; ++i ) {
+                *reinterpret_cast<size_t*>( reserved ) = sizes[i];
+                records[i] = reinterpret_cast<void*>( reserved + sizeof( size_t ));
+                reserved += calc_real_size( sizes[i] );
+            }
+
+            pback_ = back + total_size;
+            return true;
+        }
+
+        /// [producer] Publishes all records reserved by \p reserve()
+        /**
+            Returns the number of bytes published including internal headers and skipped tails.
+        */
+        size_t commit()
+        {
+            counter_type back = back_.load( memory_model::memory_order_relaxed );
+            back_.store( pback_, memory_model::memory_order_release );
+            return static_cast<size_t>( pback_ - back );
+        }
+
+        /// [producer] Cancels all records reserved by \p reserve() and not committed yet
+        void rollback()
+        {
+            pback_ = back_.load( memory_model::memory_order_relaxed );
+        }
+
         /// [consumer] Get top data from the ring
         /**
             If the ring is empty, the function returns \p nullptr in \p std:pair::first.
@@ -905,6 +1062,66 @@ namespace cds { namespace container {
             return true;
         }
 
+        /// [consumer] Peeks up to \p count records from the front of the ring
+        /**
+            The function fills \p records array with the pointers to data and sizes of the first records
+            of the ring, like \p front() does for one record. The records are not removed from the ring;
+            call \p pop_front( size_t ) to remove them.
+
+            Returns the number of records found, 0 if the ring is empty.
+        */
+        size_t front( std::pair<void*, size_t>* records, size_t count )
+        {
+            size_t n = 0;
+            scan_front( count, [records, &n]( void* data, size_t size ) { records[n++] = std::make_pair( data, size ); } );
+            return n;
+        }
+
+        /// [consumer] Pops \p count records from the front of the ring
+        /**
+            Usually, \p count is the value returned by \p front( records, count ).
+            All records are freed with one atomic store.
+
+            If the ring contains less than \p count records, the function does nothing and returns \p false.
+        */
+        bool pop_front( size_t count )
+        {
+            counter_type front;
+            if ( scan_front( count, []( void*, size_t ) {}, front ) != count )
+                return false;
+
+            front_.store( front, memory_model::memory_order_release );
+            return true;
+        }
+
+        /// [consumer] Processes up to \p count records and pops them
+        /**
+            The function calls \p f( void* data, size_t size ) for each of first records of the ring,
+            then frees all processed records with one atomic store. The data is not copied:
+            \p f accesses the records in-place.
+            \code
+            WeakRingBuffer<void>    theRing( 1024 * 1024 );
+
+            void consumer_thread()
+            {
+                while ( true ) {
+                    theRing.consume( []( void* data, size_t size ) { process_data( data, size ); }, 64 );
+                }
+            }
+            \endcode
+
+            Returns the number of records processed, 0 if the ring is empty.
+        */
+        template <typename Func>
+        size_t consume( Func f, size_t count = std::numeric_limits<size_t>::max())
+        {
+            counter_type front;
+            size_t n = scan_front( count, f, front );
+            if ( n )
+                front_.store( front, memory_model::memory_order_release );
+            return n;
+        }
+
         /// [consumer] Clears the ring buffer
         void clear()
         {
@@ -936,8 +1153,92 @@ namespace cds { namespace container {
             return buffer_.capacity();
         }
 
+        /// Returns the size in bytes of the external storage required for the ring of \p capacity bytes
+        /**
+            The function is intended for \p cds::opt::v::uninitialized_external_buffer only.
+        */
+        static constexpr size_t storage_size( size_t capacity )
+        {
+            return buffer::storage_size( capacity );
+        }
+
     private:
         //@cond
+        // Reserves real_size contiguous bytes at back, skipping the tail of the buffer if needed.
+        // On success, back points to reserved area
+        uint8_t* reserve_contiguous( counter_type& back, size_t real_size )
+        {
+            assert( static_cast<size_t>( back - pfront_ ) <= capacity());
+
+            size_t tail_size = capacity() - static_cast<size_t>( buffer_.mod( back ));
+            size_t need_size = tail_size < real_size ? tail_size + real_size : real_size;
+
+            if ( static_cast<size_t>( pfront_ + capacity() - back ) < need_size ) {
+                pfront_ = front_.load( memory_model::memory_order_acquire );
+
+                if ( static_cast<size_t>( pfront_ + capacity() - back ) < need_size ) {
+                    // not enough space
+                    return nullptr;
+                }
+            }
+
+            if ( tail_size < real_size ) {
+                // make unused tail
+                assert( tail_size >= sizeof( size_t ));
+                *reinterpret_cast<size_t*>( buffer_.buffer() + buffer_.mod( back )) = make_tail( tail_size - sizeof( size_t ));
+                back += tail_size;
+
+                // We must be in beginning of buffer
+                assert( buffer_.mod( back ) == 0 );
+            }
+
+            return buffer_.buffer() + buffer_.mod( back );
+        }
+
+        // Calls f( data, size ) for up to count first records; front is set to the position after the last record found
+        template <typename Func>
+        size_t scan_front( size_t count, Func f, counter_type& front )
+        {
+            front = front_.load( memory_model::memory_order_relaxed );
+            assert( static_cast<size_t>( cback_ - front ) <= capacity());
+
+            bool reloaded = false;
+            size_t n = 0;
+            counter_type pos = front;
+            while ( n < count ) {
+                if ( cback_ - pos < sizeof( size_t )) {
+                    if ( reloaded )
+                        break;
+                    cback_ = back_.load( memory_model::memory_order_acquire );
+                    reloaded = true;
+                    continue;
+                }
+
+                uint8_t * buf = buffer_.buffer() + buffer_.mod( pos );
+
+                // check alignment
+                assert( ( reinterpret_cast<uintptr_t>( buf ) & ( sizeof( uintptr_t ) - 1 )) == 0 );
+
+                size_t size = *reinterpret_cast<size_t*>( buf );
+                pos += calc_real_size( untail( size ));
+                assert( static_cast<size_t>( cback_ - front ) >= static_cast<size_t>( pos - front ));
+
+                if ( !is_tail( size )) {
+                    f( reinterpret_cast<void*>( buf + sizeof( size_t )), size );
+                    ++n;
+                    front = pos;
+                }
+            }
+            return n;
+        }
+
+        template <typename Func>
+        size_t scan_front( size_t count, Func f )
+        {
+            counter_type front;
+            return scan_front( count, f, front );
+        }
+
         static size_t calc_real_size( size_t size )
         {
             size_t real_size =  (( size + sizeof( uintptr_t ) - 1 ) & ~( sizeof( uintptr_t ) - 1 )) + sizeof( size_t );
@@ -971,6 +1272,7 @@ namespace cds { namespace container {
         atomics::atomic<counter_type>     back_;
         typename opt::details::apply_padding< atomics::atomic<counter_type>, traits::padding >::padding_type pad2_;
         counter_type                      pfront_;
+        counter_type                      pback_;
         typename opt::details::apply_padding< counter_type, traits::padding >::padding_type pad3_;
         counter_type                      cback_;
         typename opt::details::apply_padding< counter_type, traits::padding >::padding_type pad4_;
@@ -0,0 +1,410 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_WORK_STEALING_DEQUE_H
+#define CDSLIB_CONTAINER_WORK_STEALING_DEQUE_H
+
+#include <type_traits>
+#include <cds/container/details/base.h>
+#include <cds/algo/atomic.h>
+#include <cds/algo/backoff_strategy.h>
+#include <cds/algo/int_algo.h>
+#include <cds/details/allocator.h>
+
+namespace cds { namespace container {
+
+    /// \p WorkStealingDeque related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace work_stealing_deque {
+
+        /// \p WorkStealingDeque internal statistics
+        template <typename Counter = cds::atomicity::event_counter>
+        struct stat {
+            typedef Counter counter_type;   ///< Counter type
+
+            counter_type m_nPush;       ///< Count of \p push() calls
+            counter_type m_nPop;        ///< Count of successful \p pop() calls
+            counter_type m_nPopEmpty;   ///< Count of \p pop() calls for empty deque
+            counter_type m_nPopRace;    ///< Count of \p pop() that lost the last item to a thief
+            counter_type m_nSteal;      ///< Count of successful \p steal() calls
+            counter_type m_nStealEmpty; ///< Count of \p steal() calls for empty deque
+            counter_type m_nStealRace;  ///< Count of \p steal() retries due to contention
+            counter_type m_nGrow;       ///< Count of array growing
+
+            //@cond
+            void onPush()       { ++m_nPush; }
+            void onPop()        { ++m_nPop; }
+            void onPopEmpty()   { ++m_nPopEmpty; }
+            void onPopRace()    { ++m_nPopRace; }
+            void onSteal()      { ++m_nSteal; }
+            void onStealEmpty() { ++m_nStealEmpty; }
+            void onStealRace()  { ++m_nStealRace; }
+            void onGrow()       { ++m_nGrow; }
+            //@endcond
+        };
+
+        /// \p WorkStealingDeque empty internal statistics
+        struct empty_stat {
+            //@cond
+            void onPush()       const {}
+            void onPop()        const {}
+            void onPopEmpty()   const {}
+            void onPopRace()    const {}
+            void onSteal()      const {}
+            void onStealEmpty() const {}
+            void onStealRace()  const {}
+            void onGrow()       const {}
+            //@endcond
+        };
+
+        /// \p WorkStealingDeque default traits
+        struct traits
+        {
+            /// Allocator for the circular arrays
+            typedef CDS_DEFAULT_ALLOCATOR   allocator;
+
+            /// Back-off strategy for \p steal() retries
+            typedef cds::backoff::empty     back_off;
+
+            /// Internal statistics, possible types: \p work_stealing_deque::stat, \p work_stealing_deque::empty_stat (the default)
+            typedef empty_stat              stat;
+
+            /// Padding for \p top and \p bottom indices. Default is \p opt::cache_line_padding
+            enum { padding = opt::cache_line_padding };
+        };
+
+        /// Metafunction converting option list to \p work_stealing_deque::traits
+        /**
+            Supported \p Options are:
+            - \p opt::allocator - allocator for the circular arrays. Default is \ref CDS_DEFAULT_ALLOCATOR
+            - \p opt::back_off - back-off strategy for \p steal() retries. Default is \p cds::backoff::empty
+            - \p opt::stat - internal statistics. Possible types: \p work_stealing_deque::stat, \p work_stealing_deque::empty_stat (the default)
+            - \p opt::padding - padding for \p top and \p bottom indices. Default is \p opt::cache_line_padding
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                , Options...
+            >::type type;
+#   endif
+        };
+
+        //@cond
+        namespace details {
+
+            // Protects the circular array against reclamation; the default is for HP-like GC
+            template <typename GC>
+            class array_guard
+            {
+            public:
+                template <typename Array>
+                Array* protect( atomics::atomic<Array*> const& a )
+                {
+                    return guard_.protect( a );
+                }
+
+                template <typename Disposer, typename Array>
+                static void retire( Array* p )
+                {
+                    GC::template retire<Disposer>( p );
+                }
+
+            private:
+                typename GC::Guard guard_;
+            };
+
+        } // namespace details
+        //@endcond
+
+    } // namespace work_stealing_deque
+
+    /// Chase-Lev work-stealing deque
+    /** @ingroup cds_nonintrusive_deque
+
+        Source:
+            - [2005] David Chase, Yossi Lev. Dynamic Circular Work-Stealing Deque. SPAA 2005
+            - [2013] Nhat Minh Le, Antoniu Pop, Albert Cohen, Francesco Zappa Nardelli.
+                Correct and Efficient Work-Stealing for Weak Memory Models. PPoPP 2013
+
+        The deque has one owner thread and any number of thief threads.
+        The owner pushes and pops items at the bottom end in LIFO order (\p push(), \p pop()),
+        the thieves take items from the top end in FIFO order (\p steal()).
+        The owner operations do not use atomic RMW instructions except when the deque contains the last item;
+        \p steal() costs one CAS.
+
+        The items are stored in a growable circular array. When the array is full, \p push() allocates
+        the array twice as large and copies the items. The old array may be in use by concurrent thieves,
+        so it is reclaimed through the garbage collector \p GC.
+
+        Template arguments:
+        - \p GC - garbage collector: \p gc::HP, \p gc::DHP.
+            For RCU include <tt><cds/container/work_stealing_deque_rcu.h></tt>
+        - \p T - value type. Since a thief can read a cell that is being overwritten by the owner,
+            \p T must be trivially copyable; usually \p T is a pointer to a task or an integer task identifier.
+        - \p Traits - deque traits, default is \p work_stealing_deque::traits.
+            Use \p work_stealing_deque::make_traits metafunction to make your traits
+            or just derive your traits from \p %work_stealing_deque::traits.
+
+        Example:
+        \code
+        #include <cds/gc/hp.h>
+        #include <cds/container/work_stealing_deque.h>
+
+        typedef cds::container::WorkStealingDeque< cds::gc::HP, task* > task_deque;
+
+        // Worker thread
+        task_deque& my_deque = deques[ my_index ];
+        task* t;
+        while ( running ) {
+            if ( my_deque.pop( t ) || deques[ random_victim() ].steal( t ))
+                t->run( my_deque );     // the task can push subtasks into my_deque
+        }
+        \endcode
+    */
+    template <typename GC, typename T, typename Traits = work_stealing_deque::traits>
+    class WorkStealingDeque
+    {
+    public:
+        typedef GC      gc;         ///< Garbage collector
+        typedef T       value_type; ///< Value type
+        typedef Traits  traits;     ///< Deque traits
+
+        typedef typename traits::back_off back_off; ///< Back-off strategy
+        typedef typename traits::stat     stat;     ///< Internal statistics type
+
+        static constexpr const size_t c_nHazardPtrCount = 1; ///< Count of hazard pointer required for the algorithm
+
+        static_assert( std::is_trivially_copyable<value_type>::value, "WorkStealingDeque: value_type must be trivially copyable" );
+
+        /// Rebind template arguments
+        template <typename GC2, typename T2, typename Traits2>
+        struct rebind {
+            typedef WorkStealingDeque< GC2, T2, Traits2 > other;   ///< Rebinding result
+        };
+
+    protected:
+        //@cond
+        typedef ptrdiff_t index_type;
+        typedef atomics::atomic<value_type> cell_type;
+
+        struct array_type
+        {
+            size_t const      capacity; // power of two
+            cell_type * const cells;
+
+            array_type( size_t nCapacity, cell_type* pCells )
+                : capacity( nCapacity )
+                , cells( pCells )
+            {}
+
+            value_type get( index_type i ) const
+            {
+                return cells[ static_cast<size_t>( i ) & ( capacity - 1 ) ].load( atomics::memory_order_relaxed );
+            }
+
+            void put( index_type i, value_type v )
+            {
+                cells[ static_cast<size_t>( i ) & ( capacity - 1 ) ].store( v, atomics::memory_order_relaxed );
+            }
+        };
+
+        typedef typename std::allocator_traits<typename traits::allocator>::template rebind_alloc< array_type > array_allocator_type;
+        typedef typename std::allocator_traits<typename traits::allocator>::template rebind_alloc< cell_type >  cell_allocator_type;
+        typedef cds::details::Allocator< array_type, array_allocator_type > cxx_array_allocator;
+        typedef cds::details::Allocator< cell_type, cell_allocator_type >   cxx_cell_allocator;
+
+        static array_type* alloc_array( size_t nCapacity )
+        {
+            cell_type* cells = cxx_cell_allocator().NewArray( nCapacity );
+            return cxx_array_allocator().New( nCapacity, cells );
+        }
+
+        struct array_disposer
+        {
+            void operator()( array_type* p ) const
+            {
+                cxx_cell_allocator().Delete( p->cells, p->capacity );
+                cxx_array_allocator().Delete( p );
+            }
+        };
+
+        typedef work_stealing_deque::details::array_guard< gc > array_guard;
+        //@endcond
+
+    public:
+        /// Creates the deque with initial capacity \p nCapacity
+        /**
+            The capacity is rounded up to the nearest power of two.
+        */
+        explicit WorkStealingDeque( size_t nCapacity = 64 )
+            : m_Top( 0 )
+            , m_Bottom( 0 )
+            , m_Array( alloc_array( beans::ceil2( nCapacity < 2 ? 2 : nCapacity )))
+        {}
+
+        /// Destroys the deque
+        /**
+            Only the current array is freed; the old arrays have been passed to the garbage collector.
+        */
+        ~WorkStealingDeque()
+        {
+            array_disposer()( m_Array.load( atomics::memory_order_relaxed ));
+        }
+
+        /// [owner] Pushes \p val at the bottom of the deque
+        /**
+            If the array is full, it is doubled. Returns \p true.
+        */
+        bool push( value_type const& val )
+        {
+            index_type b = m_Bottom.load( atomics::memory_order_relaxed );
+            index_type t = m_Top.load( atomics::memory_order_acquire );
+            array_type* a = m_Array.load( atomics::memory_order_relaxed );
+
+            if ( b - t > static_cast<index_type>( a->capacity ) - 1 )
+                a = grow( a, t, b );
+
+            a->put( b, val );
+            atomics::atomic_thread_fence( atomics::memory_order_release );
+            m_Bottom.store( b + 1, atomics::memory_order_relaxed );
+
+            m_Stat.onPush();
+            return true;
+        }
+
+        /// [owner] Pops an item from the bottom of the deque (LIFO order)
+        /**
+            Returns \p false if the deque is empty.
+        */
+        bool pop( value_type& val )
+        {
+            index_type b = m_Bottom.load( atomics::memory_order_relaxed ) - 1;
+            array_type* a = m_Array.load( atomics::memory_order_relaxed );
+            m_Bottom.store( b, atomics::memory_order_relaxed );
+            atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+            index_type t = m_Top.load( atomics::memory_order_relaxed );
+
+            if ( t <= b ) {
+                // non-empty
+                val = a->get( b );
+                if ( t == b ) {
+                    // the last item: compete with thieves
+                    bool bSuccess = m_Top.compare_exchange_strong( t, t + 1, atomics::memory_order_seq_cst, atomics::memory_order_relaxed );
+                    m_Bottom.store( b + 1, atomics::memory_order_relaxed );
+                    if ( !bSuccess ) {
+                        m_Stat.onPopRace();
+                        return false;
+                    }
+                }
+                m_Stat.onPop();
+                return true;
+            }
+
+            // empty
+            m_Bottom.store( b + 1, atomics::memory_order_relaxed );
+            m_Stat.onPopEmpty();
+            return false;
+        }
+
+        /// [thief] Steals an item from the top of the deque (FIFO order)
+        /**
+            Can be called by any thread, including the owner.
+            If a concurrent \p steal() or \p pop() takes the top item, the function retries
+            using \p back_off strategy. Returns \p false if the deque is empty.
+        */
+        bool steal( value_type& val )
+        {
+            back_off bkoff;
+            array_guard guard;
+
+            while ( true ) {
+                index_type t = m_Top.load( atomics::memory_order_acquire );
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                index_type b = m_Bottom.load( atomics::memory_order_acquire );
+
+                if ( t >= b ) {
+                    m_Stat.onStealEmpty();
+                    return false;
+                }
+
+                array_type* a = guard.protect( m_Array );
+                value_type v = a->get( t );
+                if ( m_Top.compare_exchange_strong( t, t + 1, atomics::memory_order_seq_cst, atomics::memory_order_relaxed )) {
+                    val = v;
+                    m_Stat.onSteal();
+                    return true;
+                }
+
+                m_Stat.onStealRace();
+                bkoff();
+            }
+        }
+
+        /// Checks if the deque is empty
+        /**
+            The result is approximate if the deque is being changed concurrently.
+        */
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /// Returns the approximate count of items in the deque
+        size_t size() const
+        {
+            index_type b = m_Bottom.load( atomics::memory_order_relaxed );
+            index_type t = m_Top.load( atomics::memory_order_relaxed );
+            return b > t ? static_cast<size_t>( b - t ) : 0;
+        }
+
+        /// Returns current capacity of the circular array
+        size_t capacity() const
+        {
+            return m_Array.load( atomics::memory_order_relaxed )->capacity;
+        }
+
+        /// Returns internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        array_type* grow( array_type* a, index_type t, index_type b )
+        {
+            array_type* pNew = alloc_array( a->capacity * 2 );
+            for ( index_type i = t; i < b; ++i )
+                pNew->put( i, a->get( i ));
+
+            m_Array.store( pNew, atomics::memory_order_release );
+
+            // concurrent thieves may still read the old array
+            array_guard::template retire<array_disposer>( a );
+
+            m_Stat.onGrow();
+            return pNew;
+        }
+        //@endcond
+
+    protected:
+        //@cond
+        atomics::atomic<index_type>     m_Top;
+        typename opt::details::apply_padding< atomics::atomic<index_type>, traits::padding >::padding_type pad1_;
+        atomics::atomic<index_type>     m_Bottom;
+        typename opt::details::apply_padding< atomics::atomic<index_type>, traits::padding >::padding_type pad2_;
+        atomics::atomic<array_type*>    m_Array;
+        stat                            m_Stat;
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_WORK_STEALING_DEQUE_H
@@ -0,0 +1,44 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_CONTAINER_WORK_STEALING_DEQUE_RCU_H
+#define CDSLIB_CONTAINER_WORK_STEALING_DEQUE_RCU_H
+
+#include <cds/urcu/details/base.h>
+#include <cds/container/work_stealing_deque.h>
+
+namespace cds { namespace container { namespace work_stealing_deque { namespace details {
+
+    //@cond
+    // RCU specialization: steal() reads the array inside RCU critical section,
+    // the old array is retired by the owner outside of any critical section
+    template <typename RCU>
+    class array_guard< cds::urcu::gc< RCU >>
+    {
+        typedef cds::urcu::gc< RCU > gc;
+
+    public:
+        template <typename Array>
+        Array* protect( atomics::atomic<Array*> const& a )
+        {
+            assert( gc::is_locked());
+            return a.load( atomics::memory_order_acquire );
+        }
+
+        template <typename Disposer, typename Array>
+        static void retire( Array* p )
+        {
+            assert( !gc::is_locked());
+            gc::template retire_ptr<Disposer>( p );
+        }
+
+    private:
+        typename gc::scoped_lock lock_;
+    };
+    //@endcond
+
+}}}} // namespace cds::container::work_stealing_deque::details
+
+#endif // #ifndef CDSLIB_CONTAINER_WORK_STEALING_DEQUE_RCU_H
@@ -10,12 +10,15 @@
 #include <type_traits>
 #include <mutex>
 #include <functional>   // ref
+#include <cstring>      // memcpy
 #include <cds/intrusive/details/base.h>
 #include <cds/opt/compare.h>
 #include <cds/opt/hash.h>
 #include <cds/sync/lock_array.h>
 #include <cds/os/thread.h>
 #include <cds/sync/spinlock.h>
+#include <cds/sync/versioned_lock.h>
+#include <cds/sync/reader_registry.h>
 
 
 namespace cds { namespace intrusive {
@@ -70,6 +73,39 @@ namespace cds { namespace intrusive {
             //@endcond
         };
 
+        /// Option enabling incremental resizing
+        /**
+            By default (<tt>BucketsPerOp = 0</tt>) \p CuckooSet resizes in one go: the resizing thread locks
+            the entire lock array and moves all items to the bucket tables of double capacity,
+            so any other operation waits until the resizing is done.
+
+            If \p BucketsPerOp is positive, the resizing only allocates the new bucket tables and the items are moved gradually.
+            Both old and new tables coexist until the migration is completed:
+            - an operation moves the old buckets of its key to the new tables after locking the stripes;
+            - after releasing its locks, each operation moves up to \p BucketsPerOp next old buckets of each table;
+            - lock-free \p find() of \p cuckoo::optimistic_striping probes the old tables too.
+
+            The old bucket \p j of a table is split into the buckets \p j and <tt>j + n</tt> of the same table,
+            where \p n is the old capacity, so the moving never needs relocation.
+            The operation that moves the last old bucket frees the old tables.
+            If there is no room for a new item while the previous incremental resizing is in progress,
+            the rest of the old buckets is moved at once before next resizing.
+
+            The incremental resizing requires the mutex policy with constant lock count:
+            \p cuckoo::striping or \p cuckoo::optimistic_striping. The lock \p i of such policy
+            protects the old bucket \p j, <tt> i = j mod L </tt>, and both of its new buckets.
+        */
+        template <size_t BucketsPerOp>
+        struct incremental_resizing
+        {
+            //@cond
+            template <typename Base>
+            struct pack: public Base {
+                static size_t const incremental_resizing = BucketsPerOp;
+            };
+            //@endcond
+        };
+
 
         //@cond
         // Probeset type placeholders
@@ -120,7 +156,7 @@ namespace cds { namespace intrusive {
             static unsigned int const hash_array_size = 0;
             static unsigned int const probeset_size = 0;
 
-            node *  m_pNext;
+            atomics::atomic<node *> m_pNext;    // atomic since cuckoo::optimistic_striping traverses the list without locking
 
             constexpr node() noexcept
                 : m_pNext( nullptr )
@@ -138,7 +174,7 @@ namespace cds { namespace intrusive {
 
             void clear()
             {
-                m_pNext = nullptr;
+                m_pNext.store( nullptr, atomics::memory_order_relaxed );
             }
         };
 
@@ -151,8 +187,8 @@ namespace cds { namespace intrusive {
             static unsigned int const hash_array_size = StoreHashCount;
             static unsigned int const probeset_size = 0;
 
-            node *  m_pNext;
-            size_t  m_arrHash[ hash_array_size ];
+            atomics::atomic<node *> m_pNext;    // atomic since cuckoo::optimistic_striping traverses the list without locking
+            size_t                  m_arrHash[ hash_array_size ];
 
             node() noexcept
                 : m_pNext( nullptr )
@@ -172,7 +208,7 @@ namespace cds { namespace intrusive {
 
             void clear()
             {
-                m_pNext = nullptr;
+                m_pNext.store( nullptr, atomics::memory_order_relaxed );
             }
         };
 
@@ -369,6 +405,8 @@ namespace cds { namespace intrusive {
             typedef Alloc           allocator_type  ;   ///< allocator type
             static unsigned int const c_nArity = Arity ;    ///< the arity
             typedef Stat            statistics_type ;   ///< Internal statistics type (\ref striping_stat or \ref empty_striping_stat)
+            static bool const c_bOptimisticRead = false;    ///< The policy does not support optimistic reads, \p find() locks the buckets
+            static bool const c_bFixedLockCount = true;     ///< The lock array is not resized, see \p cuckoo::incremental_resizing
 
             //@cond
             typedef striping_stat       real_stat;
@@ -534,6 +572,127 @@ namespace cds { namespace intrusive {
             }
         };
 
+        /// Lock striping policy with optimistic lock-free reads
+        /**
+            This is one of available \p opt::mutex_policy option type for \p CuckooSet
+
+            The policy is a \p cuckoo::striping with versioned locks (MemC3/libcuckoo approach).
+            Each lock of the lock array has a version counter that is incremented when a writer
+            acquires the lock and when it releases the lock, so the version is odd while the stripe is being changed.
+            \p CuckooSet::find() does not acquire any lock: it reads the versions of the stripes of all
+            candidate buckets, probes the buckets and then checks that the versions are unchanged.
+            If a writer has changed one of the stripes meantime, the search is repeated;
+            after a few unsuccessful attempts \p find() falls back to the locked search.
+
+            Since the readers do not block the writers, an item unlinked from the set (and the bucket table replaced by
+            the resizing) cannot be freed while an optimistic reader can access it. The policy tracks the active readers
+            by the per-thread-group counters, and \p CuckooSet waits for the readers started before
+            unlinking in \p erase(), \p unlink() and \p clear(), and before freeing old bucket tables in \p resize().
+            So, the item returned by \p erase() can be freed immediately as with other policies.
+            The concurrent erasers share the waiting: one grace period serves all erasers queued while
+            the previous one is in progress.
+            Note that the \p find() functor is called without any lock; it is only guaranteed that the item
+            cannot be unlinked-and-disposed while the functor is executing. For that reason the functor
+            must not call \p erase(), \p unlink(), \p clear() or a resizing insertion of the same set:
+            such a call would wait for the reader that is calling it (debug builds assert on that).
+
+            Also, the policy switches the displacement algorithm of \p CuckooSet to the breadth-first search
+            of a shortest cuckoo path: the path is looked for without locking, and then the items are moved
+            one by one starting from the end of the path, each move locks the stripes of the moved item only.
+
+            Template arguments are the same as for \p cuckoo::striping:
+            - \p RecursiveLock - the type of recursive mutex. The default is \p std::recursive_mutex.
+            - \p Arity - unsigned int constant that specifies an arity. Default value is 2.
+            - \p Alloc - allocator type used for lock array memory allocation. Default is \p CDS_DEFAULT_ALLOCATOR.
+            - \p Stat - internal statistics type. Note that this template argument is automatically selected by \ref CuckooSet
+                class according to its \p opt::stat option.
+        */
+        template <
+            class RecursiveLock = std::recursive_mutex,
+            unsigned int Arity = 2,
+            class Alloc = CDS_DEFAULT_ALLOCATOR,
+            class Stat = empty_striping_stat
+        >
+        class optimistic_striping: public striping< cds::sync::versioned_lock< RecursiveLock >, Arity, Alloc, Stat >
+        {
+            //@cond
+            typedef striping< cds::sync::versioned_lock< RecursiveLock >, Arity, Alloc, Stat > base_class;
+            //@endcond
+        public:
+            typedef RecursiveLock   mutex_type      ;   ///< Recursive mutex type
+            static unsigned int const c_nArity = Arity ;    ///< the arity
+            static bool const c_bOptimisticRead = true;     ///< The policy supports optimistic reads
+
+            //@cond
+            template <typename Stat2>
+            struct rebind_statistics {
+                typedef optimistic_striping<mutex_type, c_nArity, typename base_class::allocator_type, Stat2> other;
+            };
+            //@endcond
+
+        protected:
+            //@cond
+            cds::sync::reader_registry  m_Readers;
+
+            size_t cell_version( unsigned int nTable, size_t nHash ) const
+            {
+                typename base_class::lock_array_type const& arr = base_class::m_Locks[nTable];
+                return arr.at( nHash & ( arr.size() - 1 )).version();
+            }
+            //@endcond
+
+        public:
+            //@cond
+            // Registers the current thread as optimistic reader.
+            // The reader should never wait for a lock of the policy while it is registered
+            class read_guard: public cds::sync::reader_registry::read_guard
+            {
+            public:
+                explicit read_guard( optimistic_striping& policy )
+                    : cds::sync::reader_registry::read_guard( policy.m_Readers )
+                {}
+            };
+            //@endcond
+
+        public:
+            /// Constructor
+            optimistic_striping(
+                size_t nLockCount          ///< The size of lock array. Must be power of two.
+            )
+                : base_class( nLockCount )
+            {}
+
+            //@cond
+            // Reads the versions of the stripes for arrHash; returns false if a stripe is being changed
+            bool read_begin( size_t const* arrHash, size_t * arrVersion ) const
+            {
+                for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                    arrVersion[i] = cell_version( i, arrHash[i] );
+                    if ( arrVersion[i] & 1 )
+                        return false;
+                }
+                return true;
+            }
+
+            // Checks that the stripes for arrHash have not been changed since read_begin()
+            bool read_validate( size_t const* arrHash, size_t const* arrVersion ) const
+            {
+                atomics::atomic_thread_fence( atomics::memory_order_acquire );
+                for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                    if ( cell_version( i, arrHash[i] ) != arrVersion[i] )
+                        return false;
+                }
+                return true;
+            }
+
+            // Waits while all readers registered before the call are done
+            void synchronize()
+            {
+                m_Readers.synchronize();
+            }
+            //@endcond
+        };
+
         /// Internal statistics for \ref refinable mutex policy
         struct refinable_stat {
             typedef cds::atomicity::event_counter   counter_type    ;   ///< Counter type
@@ -621,6 +780,8 @@ namespace cds { namespace intrusive {
             typedef BackOff         back_off        ;   ///< back-off strategy
             typedef Stat            statistics_type ;   ///< internal statistics type
             static unsigned int const c_nArity = Arity; ///< the arity
+            static bool const c_bOptimisticRead = false;    ///< The policy does not support optimistic reads, \p find() locks the buckets
+            static bool const c_bFixedLockCount = false;    ///< The lock array is resized with the bucket tables
 
             //@cond
             typedef refinable_stat          real_stat;
@@ -1002,6 +1163,12 @@ namespace cds { namespace intrusive {
             counter_type    m_nFindWithSuccess         ;   ///< Count of success \p find_with() function call
             counter_type    m_nFindWithFailed          ;   ///< Count of failed \p find_with() function call
 
+            counter_type    m_nOptimisticFindRetry     ;   ///< Count of optimistic \p find() retries since the buckets have been changed while probing (\p cuckoo::optimistic_striping only)
+            counter_type    m_nOptimisticFindFallback  ;   ///< Count of optimistic \p find() that has fallen back to the locked search (\p cuckoo::optimistic_striping only)
+            counter_type    m_nRelocatePathFound       ;   ///< Count of cuckoo path found by BFS relocating (\p cuckoo::optimistic_striping only)
+            counter_type    m_nRelocatePathStale       ;   ///< Count of cuckoo path that has been changed before moving the items (\p cuckoo::optimistic_striping only)
+            counter_type    m_nRelocatePathLength      ;   ///< Total length of cuckoo paths found; <tt>m_nRelocatePathLength / m_nRelocatePathFound</tt> is the average path length
+
             //@cond
             void    onRelocateCall()        { ++m_nRelocateCallCount; }
             void    onRelocateRound()       { ++m_nRelocateRoundCount; }
@@ -1038,6 +1205,15 @@ namespace cds { namespace intrusive {
 
             void    onFindWithSuccess()     { ++m_nFindWithSuccess; }
             void    onFindWithFailed()      { ++m_nFindWithFailed; }
+
+            void    onOptimisticFindRetry()     { ++m_nOptimisticFindRetry; }
+            void    onOptimisticFindFallback()  { ++m_nOptimisticFindFallback; }
+            void    onRelocatePathFound( size_t nLength )
+            {
+                ++m_nRelocatePathFound;
+                m_nRelocatePathLength += nLength;
+            }
+            void    onRelocatePathStale()       { ++m_nRelocatePathStale; }
             //@endcond
         };
 
@@ -1079,6 +1255,11 @@ namespace cds { namespace intrusive {
 
             void    onFindWithSuccess()     const {}
             void    onFindWithFailed()      const {}
+
+            void    onOptimisticFindRetry()     const {}
+            void    onOptimisticFindFallback()  const {}
+            void    onRelocatePathFound( size_t ) const {}
+            void    onRelocatePathStale()       const {}
             //@endcond
         };
 
@@ -1115,6 +1296,7 @@ namespace cds { namespace intrusive {
                 Available opt::mutex_policy types:
                 - \p cuckoo::striping - simple, but the lock array is not resizable
                 - \p cuckoo::refinable - resizable lock array, but more complex access to set data.
+                - \p cuckoo::optimistic_striping - lock striping with lock-free optimistic \p find()
 
                 Default is \p cuckoo::striping.
             */
@@ -1162,6 +1344,12 @@ namespace cds { namespace intrusive {
 
             /// Internal statistics. Available statistics: \p cuckoo::stat, \p cuckoo::empty_stat
             typedef empty_stat                  stat;
+
+            /// Count of old buckets moved by an operation while incremental resizing, see \p cuckoo::incremental_resizing
+            /**
+                Default is 0 - the bucket tables are resized in one go.
+            */
+            static size_t const incremental_resizing = 0;
         };
 
         /// Metafunction converting option list to \p CuckooSet traits
@@ -1175,7 +1363,7 @@ namespace cds { namespace intrusive {
                 The hash functors are passed as <tt> std::tuple< H1, H2, ... Hn > </tt>. The number of hash functors specifies
                 the number \p k - the count of hash tables in cuckoo hashing.
             - \p opt::mutex_policy - concurrent access policy.
-                Available policies: \p cuckoo::striping, \p cuckoo::refinable.
+                Available policies: \p cuckoo::striping, \p cuckoo::refinable, \p cuckoo::optimistic_striping.
                 Default is \p %cuckoo::striping.
             - \p opt::equal_to - key equality functor like \p std::equal_to.
                 If this functor is defined then the probe-set will be unordered.
@@ -1194,6 +1382,8 @@ namespace cds { namespace intrusive {
                 freeing nodes. Default is \p intrusive::opt::v::empty_disposer
             - \p opt::stat - internal statistics. Possibly types: \p cuckoo::stat, \p cuckoo::empty_stat.
                 Default is \p %cuckoo::empty_stat
+            - \p cuckoo::incremental_resizing - moves the items to the new bucket tables gradually instead of
+                stop-the-world resizing. Default is <tt>cuckoo::incremental_resizing<0></tt> - no incremental resizing.
 
             The probe set traits \p cuckoo::probeset_type and \p cuckoo::store_hash are taken from \p node type
             specified by \p opt::hook option.
@@ -1220,8 +1410,10 @@ namespace cds { namespace intrusive {
                 typedef cuckoo::list                probeset_type;
 
             protected:
-                node_type *     pHead;
-                unsigned int    nSize;
+                // The links are changed under the bucket lock but can be read by optimistic readers without locking,
+                // so a node is published by release store after its hash values and key are set
+                atomics::atomic<node_type *>    pHead;
+                atomics::atomic<unsigned int>   nSize;
 
             public:
                 class iterator
@@ -1266,7 +1458,7 @@ namespace cds { namespace intrusive {
                     iterator& operator ++()
                     {
                         if ( pNode )
-                            pNode = pNode->m_pNext;
+                            pNode = pNode->m_pNext.load( atomics::memory_order_relaxed );
                         return *this;
                     }
 
@@ -1290,7 +1482,7 @@ namespace cds { namespace intrusive {
 
                 iterator begin()
                 {
-                    return iterator(pHead);
+                    return iterator( pHead.load( atomics::memory_order_relaxed ));
                 }
                 iterator end()
                 {
@@ -1301,62 +1493,75 @@ namespace cds { namespace intrusive {
                 {
                     node_type * pPrev = it.pNode;
                     if ( pPrev ) {
-                        p->m_pNext = pPrev->m_pNext;
-                        pPrev->m_pNext = p;
+                        p->m_pNext.store( pPrev->m_pNext.load( atomics::memory_order_relaxed ), atomics::memory_order_relaxed );
+                        pPrev->m_pNext.store( p, atomics::memory_order_release );
                     }
                     else {
                         // insert as head
-                        p->m_pNext = pHead;
-                        pHead = p;
+                        p->m_pNext.store( pHead.load( atomics::memory_order_relaxed ), atomics::memory_order_relaxed );
+                        pHead.store( p, atomics::memory_order_release );
                     }
-                    ++nSize;
+                    nSize.store( nSize.load( atomics::memory_order_relaxed ) + 1, atomics::memory_order_relaxed );
                 }
 
                 void remove( iterator itPrev, iterator itWhat )
                 {
                     node_type * pPrev = itPrev.pNode;
                     node_type * pWhat = itWhat.pNode;
-                    assert( (!pPrev && pWhat == pHead) || (pPrev && pPrev->m_pNext == pWhat));
+                    assert( (!pPrev && pWhat == pHead.load( atomics::memory_order_relaxed ))
+                         || (pPrev && pPrev->m_pNext.load( atomics::memory_order_relaxed ) == pWhat ));
 
+                    node_type * pNext = pWhat->m_pNext.load( atomics::memory_order_relaxed );
                     if ( pPrev )
-                        pPrev->m_pNext = pWhat->m_pNext;
-                    else {
-                        assert( pWhat == pHead );
-                        pHead = pHead->m_pNext;
-                    }
+                        pPrev->m_pNext.store( pNext, atomics::memory_order_release );
+                    else
+                        pHead.store( pNext, atomics::memory_order_release );
                     pWhat->clear();
-                    --nSize;
+                    nSize.store( nSize.load( atomics::memory_order_relaxed ) - 1, atomics::memory_order_relaxed );
                 }
 
                 void clear()
                 {
                     node_type * pNext;
-                    for ( node_type * pNode = pHead; pNode; pNode = pNext ) {
-                        pNext = pNode->m_pNext;
+                    for ( node_type * pNode = pHead.load( atomics::memory_order_relaxed ); pNode; pNode = pNext ) {
+                        pNext = pNode->m_pNext.load( atomics::memory_order_relaxed );
                         pNode->clear();
                     }
 
-                    nSize = 0;
-                    pHead = nullptr;
+                    nSize.store( 0, atomics::memory_order_relaxed );
+                    pHead.store( nullptr, atomics::memory_order_release );
                 }
 
                 template <typename Disposer>
                 void clear( Disposer disp )
                 {
                     node_type * pNext;
-                    for ( node_type * pNode = pHead; pNode; pNode = pNext ) {
-                        pNext = pNode->m_pNext;
+                    for ( node_type * pNode = pHead.load( atomics::memory_order_relaxed ); pNode; pNode = pNext ) {
+                        pNext = pNode->m_pNext.load( atomics::memory_order_relaxed );
                         pNode->clear();
                         disp( pNode );
                     }
 
-                    nSize = 0;
-                    pHead = nullptr;
+                    nSize.store( 0, atomics::memory_order_relaxed );
+                    pHead.store( nullptr, atomics::memory_order_release );
                 }
 
                 unsigned int size() const
                 {
-                    return nSize;
+                    return nSize.load( atomics::memory_order_relaxed );
+                }
+
+                // Racy search for optimistic readers: visits at most nLimit nodes
+                template <typename Predicate>
+                node_type * optimistic_find( unsigned int nLimit, Predicate pred ) const
+                {
+                    node_type * pNode = pHead.load( atomics::memory_order_acquire );
+                    for ( unsigned int i = 0; pNode && i < nLimit; ++i ) {
+                        if ( pred( *pNode ))
+                            return pNode;
+                        pNode = pNode->m_pNext.load( atomics::memory_order_acquire );
+                    }
+                    return nullptr;
                 }
             };
 
@@ -1371,33 +1576,40 @@ namespace cds { namespace intrusive {
                 static unsigned int const c_nCapacity = probeset_type::c_nCapacity;
 
             protected:
-                node_type *     m_arrNode[c_nCapacity];
-                unsigned int    m_nSize;
+                // The slots are changed under the bucket lock but can be read by optimistic readers without locking,
+                // so a node is published by release store after its hash values and key are set
+                typedef atomics::atomic<node_type *> slot_type;
+
+                slot_type                       m_arrNode[c_nCapacity];
+                atomics::atomic<unsigned int>   m_nSize;
 
                 void shift_up( unsigned int nFrom )
                 {
-                    assert( m_nSize < c_nCapacity );
+                    unsigned int const nSize = size();
+                    assert( nSize < c_nCapacity );
 
-                    if ( nFrom < m_nSize )
-                        std::copy_backward( m_arrNode + nFrom, m_arrNode + m_nSize, m_arrNode + m_nSize + 1 );
+                    for ( unsigned int i = nSize; i > nFrom; --i )
+                        m_arrNode[i].store( m_arrNode[i - 1].load( atomics::memory_order_relaxed ), atomics::memory_order_release );
                 }
 
-                void shift_down( node_type ** pFrom )
+                void shift_down( slot_type * pFrom )
                 {
-                    assert( m_arrNode <= pFrom && pFrom < m_arrNode + m_nSize);
-                    std::copy( pFrom + 1, m_arrNode + m_nSize, pFrom );
+                    slot_type * pEnd = m_arrNode + size();
+                    assert( m_arrNode <= pFrom && pFrom < pEnd );
+                    for ( ; pFrom + 1 < pEnd; ++pFrom )
+                        pFrom->store( pFrom[1].load( atomics::memory_order_relaxed ), atomics::memory_order_release );
                 }
             public:
                 class iterator
                 {
-                    node_type **    pArr;
+                    slot_type *     pArr;
                     friend class bucket_entry;
 
                 public:
                     iterator()
                         : pArr( nullptr )
                     {}
-                    iterator( node_type ** p )
+                    iterator( slot_type * p )
                         : pArr(p)
                     {}
                     iterator( iterator const& it)
@@ -1413,13 +1625,14 @@ namespace cds { namespace intrusive {
                     node_type * operator->()
                     {
                         assert( pArr != nullptr );
-                        return *pArr;
+                        return pArr->load( atomics::memory_order_relaxed );
                     }
                     node_type& operator*()
                     {
                         assert( pArr != nullptr );
-                        assert( *pArr != nullptr );
-                        return *(*pArr);
+                        node_type * pNode = pArr->load( atomics::memory_order_relaxed );
+                        assert( pNode != nullptr );
+                        return *pNode;
                     }
 
                     // preinc
@@ -1443,7 +1656,8 @@ namespace cds { namespace intrusive {
                 bucket_entry()
                     : m_nSize(0)
                 {
-                    memset( m_arrNode, 0, sizeof(m_arrNode));
+                    for ( slot_type& slot : m_arrNode )
+                        slot.store( nullptr, atomics::memory_order_relaxed );
                     static_assert(( std::is_same<typename node_type::probeset_type, probeset_type>::value ), "Incompatible node type" );
                 }
 
@@ -1458,44 +1672,66 @@ namespace cds { namespace intrusive {
 
                 void insert_after( iterator it, node_type * p )
                 {
-                    assert( m_nSize < c_nCapacity );
-                    assert( !it.pArr || (m_arrNode <= it.pArr && it.pArr <= m_arrNode + m_nSize));
+                    assert( size() < c_nCapacity );
+                    assert( !it.pArr || (m_arrNode <= it.pArr && it.pArr <= m_arrNode + size()));
 
                     if ( it.pArr ) {
                         shift_up( static_cast<unsigned int>(it.pArr - m_arrNode) + 1 );
-                        it.pArr[1] = p;
+                        it.pArr[1].store( p, atomics::memory_order_release );
                     }
                     else {
                         shift_up(0);
-                        m_arrNode[0] = p;
+                        m_arrNode[0].store( p, atomics::memory_order_release );
                     }
-                    ++m_nSize;
+                    m_nSize.store( size() + 1, atomics::memory_order_relaxed );
                 }
 
                 void remove( iterator /*itPrev*/, iterator itWhat )
                 {
                     itWhat->clear();
                     shift_down( itWhat.pArr );
-                    --m_nSize;
+
+                    // no stale pointer for optimistic readers
+                    unsigned int const nSize = size() - 1;
+                    m_arrNode[nSize].store( nullptr, atomics::memory_order_release );
+                    m_nSize.store( nSize, atomics::memory_order_relaxed );
                 }
 
                 void clear()
                 {
-                    m_nSize = 0;
+                    for ( unsigned int i = 0, nSize = size(); i < nSize; ++i )
+                        m_arrNode[i].store( nullptr, atomics::memory_order_release );
+                    m_nSize.store( 0, atomics::memory_order_relaxed );
                 }
 
                 template <typename Disposer>
                 void clear( Disposer disp )
                 {
-                    for ( unsigned int i = 0; i < m_nSize; ++i ) {
-                        disp( m_arrNode[i] );
+                    for ( unsigned int i = 0, nSize = size(); i < nSize; ++i ) {
+                        disp( m_arrNode[i].load( atomics::memory_order_relaxed ));
+                        m_arrNode[i].store( nullptr, atomics::memory_order_release );
                     }
-                    m_nSize = 0;
+                    m_nSize.store( 0, atomics::memory_order_relaxed );
                 }
 
                 unsigned int size() const
                 {
-                    return m_nSize;
+                    return m_nSize.load( atomics::memory_order_relaxed );
+                }
+
+                // Racy search for optimistic readers
+                template <typename Predicate>
+                node_type * optimistic_find( unsigned int /*nLimit*/, Predicate pred ) const
+                {
+                    unsigned int nSize = size();
+                    if ( nSize > c_nCapacity )
+                        nSize = c_nCapacity;
+                    for ( unsigned int i = 0; i < nSize; ++i ) {
+                        node_type * pNode = m_arrNode[i].load( atomics::memory_order_acquire );
+                        if ( pNode && pred( *pNode ))
+                            return pNode;
+                    }
+                    return nullptr;
                 }
             };
 
@@ -1550,6 +1786,15 @@ namespace cds { namespace intrusive {
                     pos.itFound = probeset.end();
                     return false;
                 }
+
+                template <typename BucketEntry, typename Q, typename Compare>
+                static typename BucketEntry::node_type * optimistic_find( BucketEntry const& probeset, unsigned int nLimit, unsigned int /*nTable*/, size_t /*nHash*/, Q const& val, Compare cmp )
+                {
+                    typedef typename BucketEntry::node_type node_type;
+                    return probeset.optimistic_find( nLimit, [&val, &cmp]( node_type& node ) {
+                        return cmp( *NodeTraits::to_value_ptr( node ), val ) == 0;
+                    });
+                }
             };
 
             template <typename NodeTraits>
@@ -1577,6 +1822,15 @@ namespace cds { namespace intrusive {
                     pos.itFound = probeset.end();
                     return false;
                 }
+
+                template <typename BucketEntry, typename Q, typename EqualTo>
+                static typename BucketEntry::node_type * optimistic_find( BucketEntry const& probeset, unsigned int nLimit, unsigned int nTable, size_t nHash, Q const& val, EqualTo eq )
+                {
+                    typedef typename BucketEntry::node_type node_type;
+                    return probeset.optimistic_find( nLimit, [&val, &eq, nTable, nHash]( node_type& node ) {
+                        return hash_ops<node_type, node_type::hash_array_size>::equal_to( node, nTable, nHash ) && eq( *NodeTraits::to_value_ptr( node ), val );
+                    });
+                }
             };
 
         }   // namespace details
@@ -1906,8 +2160,23 @@ namespace cds { namespace intrusive {
         using predicate_wrapper = typename std::conditional< c_isSorted, cds::opt::details::make_comparator_from_less<Predicate>, Predicate>::type;
 
         typedef typename std::conditional< c_isSorted, key_comparator, key_equal_to >::type key_predicate;
+
+        static bool const c_bOptimisticRead = mutex_policy::c_bOptimisticRead;
+        typedef std::integral_constant< bool, c_bOptimisticRead > optimistic_read;
+
+        static unsigned int const c_nOptimisticFindAttempts = 4;  // count of optimistic find attempts before falling back to the locked search
+        static unsigned int const c_nRelocatePathCapacity = 64;   // max count of buckets visited by BFS relocating
+
+        static unsigned int const c_nCursorIndexBits = 40;
+        static uint64_t const c_nCursorIndexMask = ( uint64_t( 1 ) << c_nCursorIndexBits ) - 1;
         //@endcond
 
+    public:
+        static size_t const c_nResizeStep = traits::incremental_resizing; ///< Count of old buckets moved by an operation while incremental resizing, 0 - no incremental resizing
+
+        static_assert( c_nResizeStep == 0 || mutex_policy::c_bFixedLockCount,
+            "Incremental resizing requires a mutex policy with constant lock count" );
+
     public:
         static unsigned int const   c_nDefaultProbesetSize = 4;   ///< default probeset size
         static size_t const         c_nDefaultInitialSize = 16;   ///< default initial size
@@ -1925,6 +2194,13 @@ namespace cds { namespace intrusive {
         item_counter    m_ItemCounter       ;   ///< item counter
         mutable stat    m_Stat              ;   ///< internal statistics
 
+        // Incremental resizing state; m_OldBucketTable and m_nResizeGeneration are changed under resize lock only
+        bucket_entry *              m_OldBucketTable[ c_nArity ]; ///< Old bucket tables being migrated
+        atomics::atomic<size_t>     m_nOldCapacity      ;   ///< Old bucket table size while migrating, 0 otherwise
+        size_t                      m_nResizeGeneration ;   ///< Incremental resizing generation
+        atomics::atomic<uint64_t>   m_nResizeCursor     ;   ///< Generation (high bits) and index (low bits) of next old bucket to migrate
+        atomics::atomic<size_t>     m_nMigrated         ;   ///< Count of migrated old buckets
+
     protected:
         //@cond
         static void check_common_constraints()
@@ -1974,10 +2250,12 @@ namespace cds { namespace intrusive {
         {
             assert( cds::beans::is_power2( nSize ));
 
-            m_nBucketMask.store( nSize - 1, atomics::memory_order_release );
+            // The mask is stored after the tables: an optimistic reader that has read the new mask
+            // sees the new tables
             bucket_table_allocator alloc;
             for ( unsigned int i = 0; i < c_nArity; ++i )
                 m_BucketTable[i] = alloc.NewArray( nSize );
+            m_nBucketMask.store( nSize - 1, atomics::memory_order_release );
         }
 
         static void free_bucket_tables( bucket_entry ** pTable, size_t nCapacity )
@@ -1993,6 +2271,126 @@ namespace cds { namespace intrusive {
             free_bucket_tables( m_BucketTable, m_nBucketMask.load( atomics::memory_order_relaxed ) + 1 );
         }
 
+        void migrate_buckets( size_t const* arrHash )
+        {
+            // The cells of arrHash must be locked.
+            // While incremental resizing, the old buckets of arrHash are moved to the new tables first
+            if ( c_nResizeStep != 0 ) {
+                size_t const nOldCapacity = m_nOldCapacity.load( atomics::memory_order_relaxed );
+                if ( nOldCapacity != 0 ) {
+                    for ( unsigned int i = 0; i < c_nArity; ++i )
+                        move_bucket( i, m_OldBucketTable[i][ arrHash[i] & ( nOldCapacity - 1 ) ] );
+                }
+            }
+        }
+
+        void move_bucket( unsigned int nTable, bucket_entry& src )
+        {
+            // The old bucket j is split into the buckets j and j + old capacity of the same table.
+            // Nothing is inserted into them before the old bucket is moved, so they have enough room
+            hash_array arrHash;
+            while ( src.size() != 0 ) {
+                node_type * pNode = &*src.begin();
+                src.remove( bucket_iterator(), src.begin());
+
+                value_type& val = *node_traits::to_value_ptr( pNode );
+                copy_hash( arrHash, val );
+
+                bucket_entry& dst = bucket( nTable, arrHash[nTable] );
+                position pos;
+                contains_action::find( dst, pos, nTable, arrHash[nTable], val, key_predicate()); // must return false!
+                dst.insert_after( pos.itPrev, pNode );
+                m_Stat.onResizeSuccessMove();
+            }
+        }
+
+        uint64_t cursor_generation() const
+        {
+            // Generation bits of m_nResizeCursor for current resizing; the resize lock or a cell lock must be held
+            return uint64_t( m_nResizeGeneration ) << c_nCursorIndexBits;
+        }
+
+        size_t detach_old_tables( bucket_entry ** pOldTable )
+        {
+            // The resize lock must be held.
+            // Returns the capacity of the old tables copied to pOldTable or 0 if no incremental resizing is in progress.
+            // The old tables are freed by the caller when the optimistic readers are done
+            size_t const nOldCapacity = m_nOldCapacity.load( atomics::memory_order_relaxed );
+            if ( nOldCapacity != 0 ) {
+                memcpy( pOldTable, m_OldBucketTable, sizeof( m_OldBucketTable ));
+                m_nOldCapacity.store( 0, atomics::memory_order_release );
+                ++m_nResizeGeneration;
+            }
+            return nOldCapacity;
+        }
+
+        void resize_step()
+        {
+            // Moves c_nResizeStep next old buckets of each table to the new tables. No lock should be held by the caller
+            if ( c_nResizeStep == 0 || m_nOldCapacity.load( atomics::memory_order_relaxed ) == 0 )
+                return;
+
+            for ( size_t nStep = 0; nStep < c_nResizeStep; ++nStep ) {
+                // Claim the next old bucket. The cursor contains the generation of the resizing,
+                // so the claim of a completed resizing cannot be confused with the claim of the next one
+                uint64_t nCursor = m_nResizeCursor.load( atomics::memory_order_relaxed );
+                do {
+                    if ( ( nCursor & c_nCursorIndexMask ) >= m_nOldCapacity.load( atomics::memory_order_relaxed ))
+                        return;
+                } while ( !m_nResizeCursor.compare_exchange_weak( nCursor, nCursor + 1, atomics::memory_order_relaxed, atomics::memory_order_relaxed ));
+
+                size_t const nIndex = static_cast<size_t>( nCursor & c_nCursorIndexMask );
+                uint64_t const nGeneration = nCursor & ~c_nCursorIndexMask;
+                bool bLast;
+                {
+                    // the cell of old bucket nIndex protects both of its new buckets since the lock count is constant
+                    hash_array arrHash;
+                    std::fill( arrHash, arrHash + c_nArity, nIndex );
+                    scoped_cell_lock guard( m_MutexPolicy, arrHash );
+
+                    size_t const nOldCapacity = m_nOldCapacity.load( atomics::memory_order_relaxed );
+                    if ( nIndex >= nOldCapacity || nGeneration != cursor_generation()) {
+                        // the resizing has been completed already
+                        return;
+                    }
+
+                    for ( unsigned int i = 0; i < c_nArity; ++i )
+                        move_bucket( i, m_OldBucketTable[i][nIndex] );
+                    bLast = m_nMigrated.fetch_add( 1, atomics::memory_order_relaxed ) + 1 == nOldCapacity;
+                }
+
+                if ( bLast ) {
+                    bucket_entry * pOldTable[ c_nArity ];
+                    size_t nOldCapacity;
+                    {
+                        scoped_resize_lock guard( m_MutexPolicy );
+                        if ( nGeneration != cursor_generation())
+                            return;
+                        nOldCapacity = detach_old_tables( pOldTable );
+                    }
+
+                    synchronize_readers( optimistic_read());
+                    free_bucket_tables( pOldTable, nOldCapacity );
+                    return;
+                }
+            }
+        }
+
+        // Calls resize_step() when the operation is done, that is, after its cells are unlocked
+        class resize_step_guard
+        {
+            CuckooSet& m_Set;
+        public:
+            explicit resize_step_guard( CuckooSet& s )
+                : m_Set( s )
+            {}
+
+            ~resize_step_guard()
+            {
+                m_Set.resize_step();
+            }
+        };
+
         static constexpr unsigned int const c_nUndefTable = (unsigned int) -1;
         template <typename Q, typename Predicate >
         unsigned int contains( position * arrPos, size_t * arrHash, Q const& val, Predicate pred )
@@ -2013,9 +2411,12 @@ namespace cds { namespace intrusive {
             hash_array arrHash;
             hashing( arrHash, val );
             position arrPos[ c_nArity ];
+            value_type * pVal = nullptr;
+            resize_step_guard rsg( *this );
 
             {
                 scoped_cell_lock guard( m_MutexPolicy, arrHash );
+                migrate_buckets( arrHash );
 
                 unsigned int nTable = contains( arrPos, arrHash, val, pred );
                 if ( nTable != c_nUndefTable ) {
@@ -2024,10 +2425,16 @@ namespace cds { namespace intrusive {
                     bucket( nTable, arrHash[nTable]).remove( arrPos[nTable].itPrev, arrPos[nTable].itFound );
                     --m_ItemCounter;
                     m_Stat.onEraseSuccess();
-                    return node_traits::to_value_ptr( node );
+                    pVal = node_traits::to_value_ptr( node );
                 }
             }
 
+            if ( pVal ) {
+                // the caller may free the item just after return
+                synchronize_readers( optimistic_read());
+                return pVal;
+            }
+
             m_Stat.onEraseFailed();
             return nullptr;
         }
@@ -2036,9 +2443,17 @@ namespace cds { namespace intrusive {
         bool find_( Q& val, Predicate pred, Func f )
         {
             hash_array arrHash;
-            position arrPos[ c_nArity ];
             hashing( arrHash, val );
+            resize_step_guard rsg( *this );
+            return find_( val, arrHash, pred, f, optimistic_read());
+        }
+
+        template <typename Q, typename Predicate, typename Func>
+        bool find_( Q& val, size_t * arrHash, Predicate pred, Func& f, std::false_type )
+        {
+            position arrPos[ c_nArity ];
             scoped_cell_lock sl( m_MutexPolicy, arrHash );
+            migrate_buckets( arrHash );
 
             unsigned int nTable = contains( arrPos, arrHash, val, pred );
             if ( nTable != c_nUndefTable ) {
@@ -2051,7 +2466,208 @@ namespace cds { namespace intrusive {
             return false;
         }
 
+        template <typename Q, typename Predicate, typename Func>
+        bool find_( Q& val, size_t * arrHash, Predicate pred, Func& f, std::true_type )
+        {
+            // Optimistic search: no lock, the stripe versions are validated after probing
+            for ( unsigned int nAttempt = 0; nAttempt < c_nOptimisticFindAttempts; ++nAttempt ) {
+                typename mutex_policy::read_guard rg( m_MutexPolicy );
+
+                hash_array arrVersion;
+                if ( m_MutexPolicy.read_begin( arrHash, arrVersion )) {
+                    node_type * pNode = optimistic_contains( arrHash, val, pred );
+                    if ( m_MutexPolicy.read_validate( arrHash, arrVersion )) {
+                        if ( pNode ) {
+                            f( *node_traits::to_value_ptr( *pNode ), val );
+                            m_Stat.onFindSuccess();
+                            return true;
+                        }
+                        m_Stat.onFindFailed();
+                        return false;
+                    }
+                }
+                m_Stat.onOptimisticFindRetry();
+            }
+
+            m_Stat.onOptimisticFindFallback();
+            return find_( val, arrHash, pred, f, std::false_type());
+        }
+
+        template <typename Q, typename Predicate>
+        node_type * optimistic_contains( size_t const* arrHash, Q const& val, Predicate pred ) const
+        {
+            // The buckets are not locked, the result should be validated by the caller
+            node_type * pNode = nullptr;
+
+            CDS_TSAN_ANNOTATE_IGNORE_READS_BEGIN;
+            size_t const nMask = m_nBucketMask.load( atomics::memory_order_acquire );
+            for ( unsigned int i = 0; i < c_nArity && !pNode; ++i )
+                pNode = contains_action::optimistic_find( m_BucketTable[i][arrHash[i] & nMask], m_nProbesetSize, i, arrHash[i], val, pred );
+
+            // While incremental resizing the item may be still in the old tables.
+            // The old table pointers are stored before the old capacity and are not cleared when the resizing is done
+            size_t const nOldCapacity = c_nResizeStep != 0 ? m_nOldCapacity.load( atomics::memory_order_acquire ) : 0;
+            for ( unsigned int i = 0; i < c_nArity && !pNode && nOldCapacity != 0; ++i )
+                pNode = contains_action::optimistic_find( m_OldBucketTable[i][arrHash[i] & ( nOldCapacity - 1 )], m_nProbesetSize, i, arrHash[i], val, pred );
+            CDS_TSAN_ANNOTATE_IGNORE_READS_END;
+
+            return pNode;
+        }
+
+        void synchronize_readers( std::true_type )
+        {
+            m_MutexPolicy.synchronize();
+        }
+
+        void synchronize_readers( std::false_type )
+        {}
+
         bool relocate( unsigned int nTable, size_t * arrGoalHash )
+        {
+            return relocate( nTable, arrGoalHash, optimistic_read());
+        }
+
+        // BFS relocating: an entry of the cuckoo path
+        struct path_entry {
+            unsigned int    nTable;     // table of the bucket
+            unsigned int    nParent;    // index of the parent entry: the item pNode is moved from the parent bucket to this one
+            node_type *     pNode;      // item to move
+            hash_array      arrHash;    // hashes of pNode
+        };
+
+        bool relocate( unsigned int nTable, size_t * arrGoalHash, std::true_type )
+        {
+            // BFS relocating (libcuckoo approach):
+            // the shortest path from the goal bucket to a bucket below the threshold is searched without locking,
+            // then the items are moved starting from the end of the path. Each move locks the stripes
+            // of the moved item and checks that the path has not been changed.
+
+            m_Stat.onRelocateCall();
+
+            path_entry arrPath[ c_nRelocatePathCapacity ];
+            for ( unsigned int nRound = 0; nRound < c_nRelocateLimit; ++nRound ) {
+                m_Stat.onRelocateRound();
+
+                {
+                    scoped_cell_lock guard( m_MutexPolicy, arrGoalHash );
+                    migrate_buckets( arrGoalHash );
+                    if ( bucket( nTable, arrGoalHash[nTable] ).size() < m_nProbesetThreshold ) {
+                        // probeset is not above the threshold
+                        m_Stat.onFalseRelocateRound();
+                        return true;
+                    }
+                }
+
+                unsigned int nPathEnd = find_relocate_path( arrPath, nTable, arrGoalHash );
+                if ( nPathEnd == 0 ) {
+                    // all probesets on the paths are full, relocating fault
+                    m_Stat.onFailedRelocate();
+                    return false;
+                }
+
+                unsigned int nLength = 0;
+                for ( unsigned int i = nPathEnd; i != 0; i = arrPath[i].nParent )
+                    ++nLength;
+                m_Stat.onRelocatePathFound( nLength );
+
+                if ( move_along_path( arrPath, nPathEnd )) {
+                    m_Stat.onSuccessRelocateRound();
+                    return true;
+                }
+                m_Stat.onRelocatePathStale();
+            }
+            return false;
+        }
+
+        unsigned int find_relocate_path( path_entry * arrPath, unsigned int nTable, size_t const* arrGoalHash )
+        {
+            // Returns the index of the last entry of the path found or 0 if no path is found.
+            // The buckets are not locked; the optimistic reader registration protects the items and the tables
+            typename mutex_policy::read_guard rg( m_MutexPolicy );
+
+            arrPath[0].nTable = nTable;
+            arrPath[0].nParent = 0;
+            arrPath[0].pNode = nullptr;
+            memcpy( arrPath[0].arrHash, arrGoalHash, sizeof( arrPath[0].arrHash ));
+
+            unsigned int nFound = 0;
+
+            CDS_TSAN_ANNOTATE_IGNORE_READS_BEGIN;
+            size_t const nMask = m_nBucketMask.load( atomics::memory_order_acquire );
+            unsigned int nCount = 1;
+            for ( unsigned int nHead = 0; nHead < nCount && !nFound; ++nHead ) {
+                path_entry const& parent = arrPath[nHead];
+                bucket_entry const& bkt = m_BucketTable[parent.nTable][parent.arrHash[parent.nTable] & nMask];
+
+                bkt.optimistic_find( m_nProbesetSize, [&]( node_type& node ) -> bool {
+                    hash_array arrHash;
+                    copy_hash( arrHash, *node_traits::to_value_ptr( node ));
+
+                    for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                        if ( i == parent.nTable )
+                            continue;
+                        if ( nCount == c_nRelocatePathCapacity )
+                            return true;
+
+                        path_entry& child = arrPath[nCount];
+                        child.nTable = i;
+                        child.nParent = nHead;
+                        child.pNode = &node;
+                        memcpy( child.arrHash, arrHash, sizeof( arrHash ));
+
+                        if ( m_BucketTable[i][arrHash[i] & nMask].size() < m_nProbesetThreshold ) {
+                            nFound = nCount;
+                            return true;
+                        }
+                        ++nCount;
+                    }
+                    return false;
+                });
+            }
+            CDS_TSAN_ANNOTATE_IGNORE_READS_END;
+
+            return nFound;
+        }
+
+        bool move_along_path( path_entry const* arrPath, unsigned int nPathEnd )
+        {
+            // Moves the items from the end of the path; the goal bucket arrPath[0] is freed last
+            for ( unsigned int i = nPathEnd; i != 0; i = arrPath[i].nParent ) {
+                path_entry const& entry = arrPath[i];
+                path_entry const& parent = arrPath[entry.nParent];
+
+                // both source and destination buckets belong to the moved item, so its stripes are locked
+                scoped_cell_lock guard( m_MutexPolicy, entry.arrHash );
+                migrate_buckets( entry.arrHash );
+
+                bucket_entry& src = bucket( parent.nTable, entry.arrHash[parent.nTable] );
+                bucket_entry& dst = bucket( entry.nTable, entry.arrHash[entry.nTable] );
+                if ( dst.size() >= ( i == nPathEnd ? m_nProbesetThreshold : m_nProbesetSize ))
+                    return false;
+
+                bucket_iterator itPrev;
+                bucket_iterator it = src.begin();
+                for ( bucket_iterator itEnd = src.end(); it != itEnd && &*it != entry.pNode; ++it )
+                    itPrev = it;
+                if ( it == src.end())
+                    return false;
+
+                // the item may be freed and reused after the path has been found
+                hash_array arrHash;
+                value_type& val = *node_traits::to_value_ptr( *it );
+                copy_hash( arrHash, val );
+                if ( memcmp( arrHash, entry.arrHash, sizeof( arrHash )) != 0 )
+                    return false;
+
+                src.remove( itPrev, it );
+                position pos;
+                contains_action::find( dst, pos, entry.nTable, arrHash[entry.nTable], val, key_predicate()); // must return false!
+                dst.insert_after( pos.itPrev, node_traits::to_node_ptr( val ));
+            }
+            return true;
+        }
+
+        bool relocate( unsigned int nTable, size_t * arrGoalHash, std::false_type )
         {
             // arrGoalHash contains hash values for relocating element
             // Relocating element is first one from bucket( nTable, arrGoalHash[nTable] ) probeset
@@ -2065,6 +2681,7 @@ namespace cds { namespace intrusive {
 
                 while ( true ) {
                     scoped_cell_lock guard( m_MutexPolicy, arrGoalHash );
+                    migrate_buckets( arrGoalHash );
 
                     bucket_entry& refBucket = bucket( nTable, arrGoalHash[nTable] );
                     if ( refBucket.size() < m_nProbesetThreshold ) {
@@ -2079,6 +2696,7 @@ namespace cds { namespace intrusive {
                     scoped_cell_trylock guard2( m_MutexPolicy, arrHash );
                     if ( !guard2.locked())
                         continue ;  // try one more time
+                    migrate_buckets( arrHash );
 
                     refBucket.remove( typename bucket_entry::iterator(), refBucket.begin());
 
@@ -2129,6 +2747,11 @@ namespace cds { namespace intrusive {
             m_Stat.onResizeCall();
 
             size_t nOldCapacity = bucket_count( atomics::memory_order_acquire );
+            if ( c_nResizeStep != 0 ) {
+                start_incremental_resize( nOldCapacity );
+                return;
+            }
+
             bucket_entry* pOldTable[ c_nArity ];
             {
                 scoped_resize_lock guard( m_MutexPolicy );
@@ -2184,9 +2807,111 @@ namespace cds { namespace intrusive {
                     }
                 }
             }
+
+            // optimistic readers may still probe the old tables
+            synchronize_readers( optimistic_read());
             free_bucket_tables( pOldTable, nOldCapacity );
         }
 
+        void start_incremental_resize( size_t nOldCapacity )
+        {
+            // The new tables are allocated, the items are moved by migrate_buckets() and resize_step()
+            bucket_entry * pDoneTable[ c_nArity ];
+            size_t nDoneCapacity;
+            {
+                scoped_resize_lock guard( m_MutexPolicy );
+
+                if ( nOldCapacity != bucket_count()) {
+                    m_Stat.onFalseResizeCall();
+                    return;
+                }
+
+                // The previous resizing is not completed: the rest of its old buckets is moved at once
+                nDoneCapacity = m_nOldCapacity.load( atomics::memory_order_relaxed );
+                for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                    for ( size_t k = 0; k < nDoneCapacity; ++k )
+                        move_bucket( i, m_OldBucketTable[i][k] );
+                }
+                nDoneCapacity = detach_old_tables( pDoneTable );
+
+                size_t const nCapacity = nOldCapacity * 2;
+                m_MutexPolicy.resize( nCapacity );
+                memcpy( m_OldBucketTable, m_BucketTable, sizeof( m_OldBucketTable ));
+                allocate_bucket_tables( nCapacity );
+
+                ++m_nResizeGeneration;
+                m_nMigrated.store( 0, atomics::memory_order_relaxed );
+                m_nResizeCursor.store( cursor_generation(), atomics::memory_order_relaxed );
+                m_nOldCapacity.store( nOldCapacity, atomics::memory_order_release );
+            }
+
+            if ( nDoneCapacity != 0 ) {
+                synchronize_readers( optimistic_read());
+                free_bucket_tables( pDoneTable, nDoneCapacity );
+            }
+        }
+
+        template <typename Disposer>
+        void clear_( Disposer& oDisposer, std::false_type )
+        {
+            // locks entire array
+            scoped_full_lock sl( m_MutexPolicy );
+
+            for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                bucket_entry * pEntry = m_BucketTable[i];
+                bucket_entry * pEnd = pEntry + m_nBucketMask.load( atomics::memory_order_relaxed ) + 1;
+                for ( ; pEntry != pEnd ; ++pEntry ) {
+                    pEntry->clear( [&oDisposer]( node_type * pNode ){ oDisposer( node_traits::to_value_ptr( pNode )) ; } );
+                }
+            }
+
+            bucket_entry * pOldTable[ c_nArity ];
+            size_t const nOldCapacity = detach_old_tables( pOldTable );
+            if ( nOldCapacity != 0 ) {
+                for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                    for ( bucket_entry * pEntry = pOldTable[i], * pEnd = pOldTable[i] + nOldCapacity; pEntry != pEnd; ++pEntry )
+                        pEntry->clear( [&oDisposer]( node_type * pNode ){ oDisposer( node_traits::to_value_ptr( pNode )) ; } );
+                }
+                free_bucket_tables( pOldTable, nOldCapacity );
+            }
+            m_ItemCounter.reset();
+        }
+
+        template <typename Disposer>
+        void clear_( Disposer& oDisposer, std::true_type )
+        {
+            // The tables are replaced with empty ones, the items of old tables are disposed
+            // when the optimistic readers that may access them are done
+            bucket_entry * pOldTable[ c_nArity ];
+            bucket_entry * pMigratedTable[ c_nArity ];
+            size_t nCapacity;
+            size_t nMigratedCapacity;
+            {
+                // locks entire array
+                scoped_full_lock sl( m_MutexPolicy );
+
+                nCapacity = bucket_count();
+                memcpy( pOldTable, m_BucketTable, sizeof( pOldTable ));
+                allocate_bucket_tables( nCapacity );
+                nMigratedCapacity = detach_old_tables( pMigratedTable );
+                m_ItemCounter.reset();
+            }
+
+            synchronize_readers( std::true_type());
+
+            for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                for ( bucket_entry * pEntry = pOldTable[i], * pEnd = pOldTable[i] + nCapacity; pEntry != pEnd; ++pEntry )
+                    pEntry->clear( [&oDisposer]( node_type * pNode ){ oDisposer( node_traits::to_value_ptr( pNode )) ; } );
+                if ( nMigratedCapacity != 0 ) {
+                    for ( bucket_entry * pEntry = pMigratedTable[i], * pEnd = pMigratedTable[i] + nMigratedCapacity; pEntry != pEnd; ++pEntry )
+                        pEntry->clear( [&oDisposer]( node_type * pNode ){ oDisposer( node_traits::to_value_ptr( pNode )) ; } );
+                }
+            }
+            free_bucket_tables( pOldTable, nCapacity );
+            if ( nMigratedCapacity != 0 )
+                free_bucket_tables( pMigratedTable, nMigratedCapacity );
+        }
+
         constexpr static unsigned int calc_probeset_size( unsigned int nProbesetSize ) noexcept
         {
             return std::is_same< probeset_class, cuckoo::vector_probeset_class >::value
@@ -2212,6 +2937,11 @@ namespace cds { namespace intrusive {
             : m_nProbesetSize( calc_probeset_size(0))
             , m_nProbesetThreshold( m_nProbesetSize - 1 )
             , m_MutexPolicy( c_nDefaultInitialSize )
+            , m_OldBucketTable()
+            , m_nOldCapacity( 0 )
+            , m_nResizeGeneration( 0 )
+            , m_nResizeCursor( 0 )
+            , m_nMigrated( 0 )
         {
             check_common_constraints();
             check_probeset_properties();
@@ -2232,6 +2962,11 @@ namespace cds { namespace intrusive {
             : m_nProbesetSize( calc_probeset_size(nProbesetSize))
             , m_nProbesetThreshold( nProbesetThreshold ? nProbesetThreshold : m_nProbesetSize - 1 )
             , m_MutexPolicy( cds::beans::ceil2(nInitialSize ? nInitialSize : c_nDefaultInitialSize ))
+            , m_OldBucketTable()
+            , m_nOldCapacity( 0 )
+            , m_nResizeGeneration( 0 )
+            , m_nResizeCursor( 0 )
+            , m_nMigrated( 0 )
         {
             check_common_constraints();
             check_probeset_properties();
@@ -2250,6 +2985,11 @@ namespace cds { namespace intrusive {
             , m_nProbesetThreshold( m_nProbesetSize -1 )
             , m_Hash( h )
             , m_MutexPolicy( c_nDefaultInitialSize )
+            , m_OldBucketTable()
+            , m_nOldCapacity( 0 )
+            , m_nResizeGeneration( 0 )
+            , m_nResizeCursor( 0 )
+            , m_nMigrated( 0 )
         {
             check_common_constraints();
             check_probeset_properties();
@@ -2272,6 +3012,11 @@ namespace cds { namespace intrusive {
             , m_nProbesetThreshold( nProbesetThreshold ? nProbesetThreshold : m_nProbesetSize - 1)
             , m_Hash( h )
             , m_MutexPolicy( cds::beans::ceil2(nInitialSize ? nInitialSize : c_nDefaultInitialSize ))
+            , m_OldBucketTable()
+            , m_nOldCapacity( 0 )
+            , m_nResizeGeneration( 0 )
+            , m_nResizeCursor( 0 )
+            , m_nMigrated( 0 )
         {
             check_common_constraints();
             check_probeset_properties();
@@ -2290,6 +3035,11 @@ namespace cds { namespace intrusive {
             , m_nProbesetThreshold( m_nProbesetSize / 2 )
             , m_Hash( std::forward<hash_tuple_type>(h))
             , m_MutexPolicy( c_nDefaultInitialSize )
+            , m_OldBucketTable()
+            , m_nOldCapacity( 0 )
+            , m_nResizeGeneration( 0 )
+            , m_nResizeCursor( 0 )
+            , m_nMigrated( 0 )
         {
             check_common_constraints();
             check_probeset_properties();
@@ -2312,6 +3062,11 @@ namespace cds { namespace intrusive {
             , m_nProbesetThreshold( nProbesetThreshold ? nProbesetThreshold : m_nProbesetSize - 1)
             , m_Hash( std::forward<hash_tuple_type>(h))
             , m_MutexPolicy( cds::beans::ceil2(nInitialSize ? nInitialSize : c_nDefaultInitialSize ))
+            , m_OldBucketTable()
+            , m_nOldCapacity( 0 )
+            , m_nResizeGeneration( 0 )
+            , m_nResizeCursor( 0 )
+            , m_nMigrated( 0 )
         {
             check_common_constraints();
             check_probeset_properties();
@@ -2323,6 +3078,10 @@ namespace cds { namespace intrusive {
         ~CuckooSet()
         {
             free_bucket_tables();
+
+            size_t const nOldCapacity = m_nOldCapacity.load( atomics::memory_order_relaxed );
+            if ( nOldCapacity != 0 )
+                free_bucket_tables( m_OldBucketTable, nOldCapacity );
         }
 
     public:
@@ -2363,9 +3122,11 @@ namespace cds { namespace intrusive {
             node_type * pNode = node_traits::to_node_ptr( val );
             store_hash( pNode, arrHash );
 
+            resize_step_guard rsg( *this );
             while (true) {
                 {
                     scoped_cell_lock guard( m_MutexPolicy, arrHash );
+                    migrate_buckets( arrHash );
 
                     if ( contains( arrPos, arrHash, val, key_predicate()) != c_nUndefTable ) {
                         m_Stat.onInsertFailed();
@@ -2449,9 +3210,11 @@ namespace cds { namespace intrusive {
             node_type * pNode = node_traits::to_node_ptr( val );
             store_hash( pNode, arrHash );
 
+            resize_step_guard rsg( *this );
             while (true) {
                 {
                     scoped_cell_lock guard( m_MutexPolicy, arrHash );
+                    migrate_buckets( arrHash );
 
                     unsigned int nTable = contains( arrPos, arrHash, val, key_predicate());
                     if ( nTable != c_nUndefTable ) {
@@ -2529,19 +3292,27 @@ namespace cds { namespace intrusive {
             hash_array arrHash;
             hashing( arrHash, val );
             position arrPos[ c_nArity ];
+            bool bUnlinked = false;
+            resize_step_guard rsg( *this );
 
             {
                 scoped_cell_lock guard( m_MutexPolicy, arrHash );
+                migrate_buckets( arrHash );
 
                 unsigned int nTable = contains( arrPos, arrHash, val, key_predicate());
                 if ( nTable != c_nUndefTable && node_traits::to_value_ptr(*arrPos[nTable].itFound) == &val ) {
                     bucket( nTable, arrHash[nTable]).remove( arrPos[nTable].itPrev, arrPos[nTable].itFound );
                     --m_ItemCounter;
                     m_Stat.onUnlinkSuccess();
-                    return true;
+                    bUnlinked = true;
                 }
             }
 
+            if ( bUnlinked ) {
+                synchronize_readers( optimistic_read());
+                return true;
+            }
+
             m_Stat.onUnlinkFailed();
             return false;
         }
@@ -2625,6 +3396,8 @@ namespace cds { namespace intrusive {
             where \p item is the item found, \p val is the <tt>find</tt> function argument.
 
             The functor may change non-key fields of \p item.
+            With \p cuckoo::optimistic_striping mutex policy the functor must not erase the items of the set,
+            see \p cuckoo::optimistic_striping.
 
             The \p val argument is non-const since it can be used as \p f functor destination i.e., the functor
             may modify both arguments.
@@ -2736,17 +3509,7 @@ namespace cds { namespace intrusive {
         template <typename Disposer>
         void clear_and_dispose( Disposer oDisposer )
         {
-            // locks entire array
-            scoped_full_lock sl( m_MutexPolicy );
-
-            for ( unsigned int i = 0; i < c_nArity; ++i ) {
-                bucket_entry * pEntry = m_BucketTable[i];
-                bucket_entry * pEnd = pEntry + m_nBucketMask.load( atomics::memory_order_relaxed ) + 1;
-                for ( ; pEntry != pEnd ; ++pEntry ) {
-                    pEntry->clear( [&oDisposer]( node_type * pNode ){ oDisposer( node_traits::to_value_ptr( pNode )) ; } );
-                }
-            }
-            m_ItemCounter.reset();
+            clear_( oDisposer, optimistic_read());
         }
 
         /// Checks if the set is empty
@@ -66,6 +66,19 @@ namespace cds { namespace intrusive {
             //@endcond
         };
 
+        /// Array node compaction option
+        /**
+            @copydetails traits::compaction
+        */
+        template <bool Enable>
+        struct compaction {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                static constexpr bool const compaction = Enable;
+            };
+            //@endcond
+        };
 
         /// \p FeldmanHashSet internal statistics
         template <typename EventCounter = cds::atomicity::event_counter>
@@ -89,8 +102,11 @@ namespace cds { namespace intrusive {
             event_counter   m_nExpandNodeFailed;  ///< Number of failed attempts converting data node to array node
             event_counter   m_nSlotChanged;     ///< Number of array node slot changing by other thread during an operation
             event_counter   m_nSlotConverting;  ///< Number of events when we encounter a slot while it is converting to array node
+            event_counter   m_nSlotFrozen;      ///< Number of events when we encounter a slot of an array node that is being compacted
+            event_counter   m_nCompactNodeSuccess; ///< Number of array nodes folded back into the parent slot
+            event_counter   m_nCompactNodeFailed;  ///< Number of failed attempts to fold an array node into the parent slot
 
-            event_counter   m_nArrayNodeCount;  ///< Number of array nodes
+            event_counter   m_nArrayNodeCount;  ///< Number of array nodes created
             event_counter   m_nHeight;          ///< Current height of the tree
 
             //@cond
@@ -111,6 +127,9 @@ namespace cds { namespace intrusive {
             void onExpandNodeFailed()           { ++m_nExpandNodeFailed;    }
             void onSlotChanged()                { ++m_nSlotChanged;         }
             void onSlotConverting()             { ++m_nSlotConverting;      }
+            void onSlotFrozen()                 { ++m_nSlotFrozen;          }
+            void onCompactNodeSuccess()         { ++m_nCompactNodeSuccess;  }
+            void onCompactNodeFailed()          { ++m_nCompactNodeFailed;   }
             void onArrayNodeCreated()           { ++m_nArrayNodeCount;      }
             void height( size_t h )             { if (m_nHeight < h ) m_nHeight = h; }
             //@endcond
@@ -136,6 +155,9 @@ namespace cds { namespace intrusive {
             void onExpandNodeFailed()           const {}
             void onSlotChanged()                const {}
             void onSlotConverting()             const {}
+            void onSlotFrozen()                 const {}
+            void onCompactNodeSuccess()         const {}
+            void onCompactNodeFailed()          const {}
             void onArrayNodeCreated()           const {}
             void height(size_t)                 const {}
             //@endcond
@@ -195,6 +217,21 @@ namespace cds { namespace intrusive {
             */
             typedef cds::opt::none hash_splitter;
 
+            /// Array node compaction
+            /**
+                If \p compaction is \p true, an array node that holds at most one data node after erasing
+                is folded back into the slot of its parent: the parent slot gets that data node
+                (or becomes empty), and the array node is retired through the garbage collector.
+                So, the tree height and the memory occupied by array nodes decrease
+                when the items are erased from the set.
+                The price is a scan of the array node after each successful erasing and,
+                for \p gc::HP and \p gc::DHP, two additional hazard pointers per operation
+                to protect array nodes on the path.
+
+                Default is \p false: array nodes are never freed until the set is destroyed.
+            */
+            static constexpr bool const compaction = false;
+
             /// Disposer for removing data nodes
             typedef cds::intrusive::opt::v::empty_disposer disposer;
 
@@ -262,6 +299,8 @@ namespace cds { namespace intrusive {
                 @copydetails traits::hash_size
             - \p feldman_hashset::hash_splitter - a hash splitter algorithm
                 @copydetails traits::hash_splitter
+            - \p feldman_hashset::compaction - array node compaction
+                @copydetails traits::compaction
             - \p opt::node_allocator - array node allocator.
                 @copydetails traits::node_allocator
             - \p opt::compare - hash comparison functor. No default functor is provided.
@@ -410,9 +449,13 @@ namespace cds { namespace intrusive {
                 typename traits::hash_splitter
             >::type hash_splitter;
 
+            /// Array node compaction, see \p feldman_hashset::traits::compaction
+            static constexpr bool const c_bCompaction = traits::compaction;
+
             enum node_flags {
                 flag_array_converting = 1,   ///< the cell is converting from data node to an array node
-                flag_array_node = 2          ///< the cell is a pointer to an array node
+                flag_array_node = 2,         ///< the cell is a pointer to an array node
+                flag_array_frozen = 3        ///< the cell belongs to an array node that is being folded into its parent slot
             };
 
         protected:
@@ -420,7 +463,32 @@ namespace cds { namespace intrusive {
             typedef cds::details::marked_ptr< value_type, 3 > node_ptr;
             typedef atomics::atomic< node_ptr > atomic_node_ptr;
 
-            struct array_node {
+            struct empty_node_path
+            {
+                void set_path( hash_type const&, size_t )
+                {}
+            };
+
+            // The path of an array node from the head: an unlinked node can be located again only by its path
+            struct node_path
+            {
+                size_t nHeight; ///< node height, the height of the head is 1
+                typename std::aligned_storage< sizeof( hash_type ), alignof( hash_type )>::type hash; ///< hash value of an item the node has been created for
+
+                void set_path( hash_type const& h, size_t height )
+                {
+                    memcpy( &hash, &h, sizeof( hash ));
+                    nHeight = height;
+                }
+
+                hash_type const& path_hash() const
+                {
+                    return *reinterpret_cast<hash_type const*>( &hash );
+                }
+            };
+
+            struct array_node: public std::conditional< c_bCompaction, node_path, empty_node_path >::type
+            {
                 array_node * const  pParent;    ///< parent array node
                 size_t const        idxParent;  ///< index in parent array node
                 atomic_node_ptr     nodes[1];   ///< node array
@@ -437,6 +505,24 @@ namespace cds { namespace intrusive {
 
             typedef cds::details::Allocator< array_node, node_allocator > cxx_array_node_allocator;
 
+            /// Disposer of array nodes retired by the compaction
+            struct array_node_disposer
+            {
+                void operator()( array_node * p ) const
+                {
+                    free_array_node( p, 0 );
+                }
+            };
+
+            /// Array node guard for traversing without compaction: array nodes are never reclaimed
+            struct empty_traverse_guard
+            {
+                bool protect( size_t /*nHeight*/, atomic_node_ptr const& /*slot*/, node_ptr /*cur*/ ) const
+                {
+                    return true;
+                }
+            };
+
             struct traverse_data {
                 hash_splitter splitter;
                 array_node * pArr;
@@ -480,6 +566,13 @@ namespace cds { namespace intrusive {
             }
 
             node_ptr traverse(traverse_data& pos)
+            {
+                empty_traverse_guard guard;
+                return traverse( pos, guard );
+            }
+
+            template <typename TraverseGuard>
+            node_ptr traverse( traverse_data& pos, TraverseGuard& guard )
             {
                 back_off bkoff;
                 while (true) {
@@ -488,6 +581,11 @@ namespace cds { namespace intrusive {
                         // array node, go down the tree
                         assert(slot.ptr() != nullptr);
                         assert( !pos.splitter.eos());
+                        if ( !guard.protect( pos.nHeight + 1, pos.pArr->nodes[pos.nSlot], slot )) {
+                            // the slot has been changed by another thread
+                            stats().onSlotChanged();
+                            continue;
+                        }
                         pos.nSlot = pos.splitter.cut( static_cast<unsigned>( metrics().array_node_size_log ));
                         assert( static_cast<size_t>( pos.nSlot ) < metrics().array_node_size );
                         pos.pArr = to_array(slot.ptr());
@@ -498,6 +596,12 @@ namespace cds { namespace intrusive {
                         bkoff();
                         stats().onSlotConverting();
                     }
+                    else if ( slot.bits() == flag_array_frozen ) {
+                        // the array node is being folded into its parent slot - restart from the head
+                        bkoff();
+                        stats().onSlotFrozen();
+                        pos.reset( *this );
+                    }
                     else {
                         // data node
                         assert(slot.bits() == 0);
@@ -528,6 +632,33 @@ namespace cds { namespace intrusive {
                 return m_Head;
             }
 
+            // Prefetches the head node slot for \p hash
+            void prefetch_head_slot( hash_type const& hash ) const
+            {
+                hash_splitter splitter( hash );
+                cds_prefetch( &m_Head->nodes[ splitter.cut( static_cast<unsigned>( metrics().head_node_size_log )) ] );
+            }
+
+            // Prefetches the target of the head node slot for \p hash
+            void prefetch_head_child( hash_type const& hash ) const
+            {
+                hash_splitter splitter( hash );
+                prefetch_child( m_Head->nodes[ splitter.cut( static_cast<unsigned>( metrics().head_node_size_log )) ], splitter );
+            }
+
+            // Prefetches the target of \p slot: the slot of the next level for an array node or the data node itself.
+            // The node containing \p slot must be protected, the target is only prefetched, not dereferenced
+            void prefetch_child( atomic_node_ptr const& slot, hash_splitter& splitter ) const
+            {
+                node_ptr cur = slot.load( memory_model::memory_order_relaxed );
+                if ( cur.bits() == flag_array_node ) {
+                    if ( !splitter.eos())
+                        cds_prefetch( &to_array( cur.ptr())->nodes[ splitter.cut( static_cast<unsigned>( metrics().array_node_size_log )) ] );
+                }
+                else if ( cur.bits() == 0 && cur.ptr())
+                    cds_prefetch( cur.ptr());
+            }
+
             stat& stats() const
             {
                 return m_Stat;
@@ -602,6 +733,16 @@ namespace cds { namespace intrusive {
             }
 
             void gather_level_statistics(std::vector<feldman_hashset::level_statistics>& stat, size_t nLevel, array_node * pArr, size_t nSize) const
+            {
+                gather_node_statistics( stat, nLevel, pArr, nSize );
+                for (atomic_node_ptr * p = pArr->nodes, *pLast = p + nSize; p != pLast; ++p) {
+                    node_ptr slot = p->load(memory_model::memory_order_relaxed);
+                    if (slot.bits() == flag_array_node)
+                        gather_level_statistics(stat, nLevel + 1, to_array(slot.ptr()), array_node_size());
+                }
+            }
+
+            void gather_node_statistics( std::vector<feldman_hashset::level_statistics>& stat, size_t nLevel, array_node * pArr, size_t nSize ) const
             {
                 if (stat.size() <= nLevel) {
                     stat.resize(nLevel + 1);
@@ -611,11 +752,8 @@ namespace cds { namespace intrusive {
                 ++stat[nLevel].array_node_count;
                 for (atomic_node_ptr * p = pArr->nodes, *pLast = p + nSize; p != pLast; ++p) {
                     node_ptr slot = p->load(memory_model::memory_order_relaxed);
-                    if (slot.bits()) {
+                    if (slot.bits())
                         ++stat[nLevel].array_cell_count;
-                        if (slot.bits() == flag_array_node)
-                            gather_level_statistics(stat, nLevel + 1, to_array(slot.ptr()), array_node_size());
-                    }
                     else if (slot.ptr())
                         ++stat[nLevel].data_cell_count;
                     else
@@ -626,16 +764,84 @@ namespace cds { namespace intrusive {
             bool expand_slot( traverse_data& pos, node_ptr current)
             {
                 assert( !pos.splitter.eos());
-                return expand_slot( pos.pArr, pos.nSlot, current, pos.splitter.bit_offset());
+                return expand_slot( pos.pArr, pos.nSlot, current, pos.splitter.bit_offset(), pos.nHeight );
+            }
+
+            // Tries to fold array node pArr into its parent slot
+            // The caller must guarantee that pArr and its parent are not reclaimed during the call.
+            // Returns true if pArr has been unlinked from the tree; the caller is responsible to retire it
+            bool compact_array_node( array_node * pArr )
+            {
+                assert( pArr->pParent != nullptr );
+
+                size_t const nSize = array_node_size();
+
+                // Quick check before locking the parent slot
+                {
+                    size_t nItemCount = 0;
+                    for ( atomic_node_ptr * p = pArr->nodes, *pLast = p + nSize; p != pLast; ++p ) {
+                        node_ptr slot = p->load( memory_model::memory_order_relaxed );
+                        if ( slot.bits() || ( slot.ptr() && ++nItemCount > 1 ))
+                            return false;
+                    }
+                }
+
+                // Lock the parent slot: other threads will wait until the compaction is done
+                atomic_node_ptr& parentSlot = pArr->pParent->nodes[pArr->idxParent];
+                node_ptr cur( to_node( pArr ), flag_array_node );
+                if ( !parentSlot.compare_exchange_strong( cur, node_ptr( to_node( pArr ), flag_array_converting ), memory_model::memory_order_acquire, atomics::memory_order_relaxed ))
+                    return false;
+
+                // Freeze all slots of pArr: the threads that are inside pArr will restart from the head
+                value_type * pItem = nullptr;
+                size_t nFrozen = 0;
+                bool bFold = true;
+                for ( ; nFrozen < nSize; ++nFrozen ) {
+                    atomic_node_ptr& slot = pArr->nodes[nFrozen];
+                    node_ptr val = slot.load( memory_model::memory_order_acquire );
+                    while ( val.bits() == 0 && !slot.compare_exchange_weak( val, val | flag_array_frozen, memory_model::memory_order_acq_rel, atomics::memory_order_acquire ));
+
+                    if ( val.bits() != 0 ) {
+                        // the slot refers to an array node or is converting
+                        bFold = false;
+                        break;
+                    }
+                    if ( val.ptr()) {
+                        if ( pItem ) {
+                            // pArr has got a new item
+                            ++nFrozen;
+                            bFold = false;
+                            break;
+                        }
+                        pItem = val.ptr();
+                    }
+                }
+
+                if ( !bFold ) {
+                    // Unfreeze the slots and unlock the parent slot
+                    for ( size_t i = 0; i < nFrozen; ++i ) {
+                        node_ptr val = pArr->nodes[i].load( memory_model::memory_order_relaxed );
+                        pArr->nodes[i].store( node_ptr( val.ptr()), memory_model::memory_order_release );
+                    }
+                    parentSlot.store( node_ptr( to_node( pArr ), flag_array_node ), memory_model::memory_order_release );
+                    stats().onCompactNodeFailed();
+                    return false;
+                }
+
+                // pItem is the only item of pArr, it is moved into the parent slot
+                parentSlot.store( node_ptr( pItem ), memory_model::memory_order_release );
+                stats().onCompactNodeSuccess();
+                return true;
             }
 
         private:
-            bool expand_slot(array_node * pParent, size_t idxParent, node_ptr current, size_t nOffset)
+            bool expand_slot(array_node * pParent, size_t idxParent, node_ptr current, size_t nOffset, size_t nHeight )
             {
                 assert(current.bits() == 0);
                 assert(current.ptr());
 
                 array_node * pArr = alloc_array_node(pParent, idxParent);
+                pArr->set_path( hash_accessor()( *current.ptr()), nHeight + 1 );
 
                 node_ptr cur(current.ptr());
                 atomic_node_ptr& slot = pParent->nodes[idxParent];
@@ -136,6 +136,9 @@ namespace cds { namespace intrusive {
             counter_type    m_nInitBucketContention; ///< Count of bucket init contention encountered
             counter_type    m_nBusyWaitBucketInit;   ///< Count of busy wait cycle while a bucket is initialized
             counter_type    m_nBucketsExhausted;     ///< Count of failed bucket allocation
+            counter_type    m_nBucketTableShrink;    ///< Count of bucket table shrinking, see \p split_list::traits::shrink_factor
+            counter_type    m_nAuxNodeRetired;       ///< Count of auxiliary nodes removed from the bucket table by shrinking
+            counter_type    m_nAuxNodeUnlinked;      ///< Count of removed auxiliary nodes unlinked from the split-list
 
             //@cond
             void onInsertSuccess()       { ++m_nInsertSuccess; }
@@ -163,6 +166,9 @@ namespace cds { namespace intrusive {
             void onBucketInitContenton() { ++m_nInitBucketContention; }
             void onBusyWaitBucketInit()  { ++m_nBusyWaitBucketInit; }
             void onBucketsExhausted()    { ++m_nBucketsExhausted; }
+            void onBucketTableShrink()   { ++m_nBucketTableShrink; }
+            void onAuxNodeRetired()      { ++m_nAuxNodeRetired; }
+            void onAuxNodeUnlinked()     { ++m_nAuxNodeUnlinked; }
             //@endcond
         };
 
@@ -187,6 +193,9 @@ namespace cds { namespace intrusive {
             void onBucketInitContenton() const {}
             void onBusyWaitBucketInit()  const {}
             void onBucketsExhausted()    const {}
+            void onBucketTableShrink()   const {}
+            void onAuxNodeRetired()      const {}
+            void onAuxNodeUnlinked()     const {}
             //@endcond
         };
 
@@ -271,6 +280,23 @@ namespace cds { namespace intrusive {
             */
             static const bool dynamic_bucket_table = true;
 
+            /// Bucket table shrink factor
+            /**
+                By default (0) the bucket table of \p SplitListSet can only grow: it doubles when the item count
+                exceeds <tt>bucket_count * load_factor</tt>, and it keeps its size when the items are erased.
+
+                If \p shrink_factor is not zero, the erasing functions halve the bucket table when the item count
+                becomes less than <tt>bucket_count * load_factor / shrink_factor</tt>. The gap between
+                the growing and the shrinking thresholds prevents the table from flapping, so \p shrink_factor
+                must be greater than 2; 4 is a good choice.
+                The auxiliary nodes of removed buckets are unlinked from the split-list and freed by the garbage collector.
+
+                Shrinking is supported only by \p SplitListSet for \p gc::HP and \p gc::DHP based on \p MichaelList
+                or \p LazyList with dynamic bucket table. In that case the bucket table is \p shrinkable_bucket_table
+                that allocates the auxiliary nodes from the heap one by one, \p free_list option is not used.
+            */
+            static const size_t shrink_factor = 0;
+
             /// Back-off strategy
             typedef cds::backoff::Default back_off;
 
@@ -310,6 +336,21 @@ namespace cds { namespace intrusive {
             //@endcond
         };
 
+        /// [value-option] Split-list bucket table shrink factor option
+        /**
+            Enables shrinking of the bucket table, see \p traits::shrink_factor for explanation.
+        */
+        template <size_t Value>
+        struct shrink_factor
+        {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { shrink_factor = Value };
+            };
+            //@endcond
+        };
+
         /// Metafunction converting option list to \p split_list::traits
         /**
             Available \p Options:
@@ -324,6 +365,8 @@ namespace cds { namespace intrusive {
             - \p opt::allocator - optional, bucket table allocator. Default is \ref CDS_DEFAULT_ALLOCATOR.
             - \p split_list::dynamic_bucket_table - use dynamic or static bucket table implementation.
                 Dynamic bucket table expands its size up to maximum bucket count when necessary
+            - \p split_list::shrink_factor - enables shrinking of dynamic bucket table, see \p traits::shrink_factor.
+                Default is 0 - the bucket table is never shrunk.
             - \p opt::back_off - back-off strategy used for spinning, default is \p cds::backoff::Default.
             - \p opt::stat - internal statistics, default is \p split_list::empty_stat (disabled).
                 To enable internal statistics use \p split_list::stat.
@@ -453,6 +496,13 @@ namespace cds { namespace intrusive {
                 return m_Table[ nBucket ].load(memory_model::memory_order_acquire);
             }
 
+            /// Prefetches the table entry of the bucket \p nBucket
+            void prefetch( size_t nBucket ) const
+            {
+                assert( nBucket < capacity());
+                cds_prefetch( &m_Table[ nBucket ] );
+            }
+
             /// Set \p pNode as a head of bucket \p nBucket
             void bucket( size_t nBucket, aux_node_type * pNode )
             {
@@ -656,6 +706,17 @@ namespace cds { namespace intrusive {
                 return pSegment[ nBucket & (m_metrics.nSegmentSize - 1) ].load(memory_model::memory_order_acquire);
             }
 
+            /// Prefetches the table entry of the bucket \p nBucket
+            void prefetch( size_t nBucket ) const
+            {
+                size_t nSegment = nBucket >> m_metrics.nSegmentSizeLog2;
+                assert( nSegment < m_metrics.nSegmentCount );
+
+                table_entry* pSegment = m_Segments[ nSegment ].load( memory_model::memory_order_relaxed );
+                if ( pSegment != nullptr )
+                    cds_prefetch( &pSegment[ nBucket & (m_metrics.nSegmentSize - 1) ] );
+            }
+
             /// Set \p pNode as a head of bucket \p nBucket
             void bucket( size_t nBucket, aux_node_type * pNode )
             {
@@ -818,6 +879,280 @@ namespace cds { namespace intrusive {
             //@endcond
         };
 
+        //@cond
+        namespace details {
+
+            // Auxiliary node of shrinkable_bucket_table
+            // State of the aux node of shrinkable bucket table.
+            // The split-list guards a bucket head by the address of this subobject, not by the address of the node,
+            // so the GC sees the node retired by shrinking and the node retired by the ordered list as different pointers
+            struct aux_node_head
+            {
+                enum state {
+                    live,       // the node is a bucket head
+                    retired,    // the node is removed from the bucket table and retired
+                    quiescent,  // the node is not used as a bucket head anymore
+                    dead        // the node is unlinked from the split-list
+                };
+
+                atomics::atomic<int>    m_nState;
+
+                aux_node_head()
+                {
+                    m_nState.store( live, atomics::memory_order_relaxed );
+                }
+            };
+
+            // The node removed from the bucket table by shrinking is disposed in two steps:
+            // the GC calls quiescent_disposer when no thread uses the node as a bucket head,
+            // after that the split-list unlinks the node and the ordered list disposer calls on_unlinked().
+            // Whichever of the two disposers is the last frees the node.
+            template <typename Node, typename Alloc>
+            struct shrinkable_aux_node: public Node, public aux_node_head
+            {
+                typedef cds::details::Allocator< shrinkable_aux_node, Alloc > cxx_allocator;
+
+                size_t                  m_nBucket;      // bucket number
+                shrinkable_aux_node *   m_pNextRetired; // next node in the list of retired nodes
+#           ifdef CDS_DEBUG
+                atomics::atomic<bool>   m_busy;
+#           endif
+
+                shrinkable_aux_node()
+                    : m_nBucket( 0 )
+                    , m_pNextRetired( nullptr )
+                {
+#           ifdef CDS_DEBUG
+                    m_busy.store( false, atomics::memory_order_release );
+#           endif
+                }
+
+                aux_node_head * head()
+                {
+                    return static_cast<aux_node_head *>( this );
+                }
+
+                struct quiescent_disposer
+                {
+                    void operator()( aux_node_head * p ) const
+                    {
+                        if ( p->m_nState.exchange( quiescent, atomics::memory_order_acq_rel ) == dead )
+                            cxx_allocator().Delete( static_cast<shrinkable_aux_node *>( p ));
+                    }
+                };
+
+                static void on_unlinked( shrinkable_aux_node * p )
+                {
+                    if ( p->m_nState.exchange( dead, atomics::memory_order_acq_rel ) != retired )
+                        cxx_allocator().Delete( p );
+                }
+            };
+        } // namespace details
+        //@endcond
+
+        /// Shrinkable bucket table
+        /**
+            The bucket table for \p SplitListSet with non-zero \p split_list::traits::shrink_factor.
+            Like \p expandable_bucket_table, it is an array of lazily allocated segments. Unlike \p %expandable_bucket_table,
+            each auxiliary node is allocated from the heap, since the node removed by shrinking
+            is freed by the garbage collector. The table does not own the auxiliary nodes:
+            all of them are disposed by \p SplitListSet.
+
+            Template parameter:
+            - \p GC - garbage collector
+            - \p Node - auxiliary node type, must be <tt>split_list::details::shrinkable_aux_node</tt>
+            - \p Options... - options
+
+            \p Options are:
+            - \p opt::allocator - allocator used to allocate bucket table. Default is \ref CDS_DEFAULT_ALLOCATOR
+            - \p opt::memory_model - memory model used. Possible types are \p opt::v::sequential_consistent, \p opt::v::relaxed_ordering
+        */
+        template <typename GC, typename Node, typename... Options>
+        class shrinkable_bucket_table
+        {
+            //@cond
+            struct default_options
+            {
+                typedef CDS_DEFAULT_ALLOCATOR       allocator;
+                typedef opt::v::relaxed_ordering    memory_model;
+            };
+            typedef typename opt::make_options< default_options, Options... >::type options;
+            //@endcond
+
+        public:
+            typedef GC       gc;                            ///< Garbage collector
+            typedef Node     node_type;                     ///< Bucket node type
+            typedef Node     aux_node_type;                 ///< Auxiliary node type
+            typedef typename options::allocator allocator;  ///< allocator
+
+            /// Memory model for atomic operations
+            typedef typename options::memory_model memory_model;
+
+        protected:
+            //@cond
+            typedef atomics::atomic<aux_node_type *> table_entry;    ///< Table entry type
+            typedef atomics::atomic<table_entry *>   segment_type;   ///< Bucket table segment type
+
+            /// Bucket table metrics
+            struct metrics {
+                size_t    nSegmentCount;    ///< max count of segments in bucket table
+                size_t    nSegmentSize;     ///< the segment's capacity. The capacity must be power of two.
+                size_t    nSegmentSizeLog2; ///< <tt> log2( m_nSegmentSize )</tt>
+                size_t    nLoadFactor;      ///< load factor
+                size_t    nCapacity;        ///< max capacity of bucket table
+            };
+
+            typedef cds::details::Allocator< segment_type, allocator > bucket_table_allocator;
+            typedef cds::details::Allocator< table_entry, allocator >  segment_allocator;
+            typedef typename aux_node_type::cxx_allocator              aux_node_allocator;
+            //@endcond
+
+        public:
+            /// Constructs bucket table for 512K buckets. Load factor is 1.
+            shrinkable_bucket_table()
+                : m_metrics( calc_metrics( 512 * 1024, 1 ))
+                , m_Segments( bucket_table_allocator().NewArray( m_metrics.nSegmentCount, nullptr ))
+            {}
+
+            /// Creates the table with specified capacity rounded up to nearest power-of-two
+            shrinkable_bucket_table(
+                size_t nItemCount,        ///< Max expected item count in split-ordered list
+                size_t nLoadFactor        ///< Load factor
+                )
+                : m_metrics( calc_metrics( nItemCount, nLoadFactor ))
+                , m_Segments( bucket_table_allocator().NewArray( m_metrics.nSegmentCount, nullptr ))
+            {}
+
+            /// Destroys bucket table
+            /**
+                The auxiliary nodes are not freed here: \p SplitListSet disposes them when the split-list is cleared.
+            */
+            ~shrinkable_bucket_table()
+            {
+                for ( size_t i = 0; i < m_metrics.nSegmentCount; ++i ) {
+                    table_entry* pEntry = m_Segments[i].load( memory_model::memory_order_relaxed );
+                    if ( pEntry != nullptr )
+                        segment_allocator().Delete( pEntry, m_metrics.nSegmentSize );
+                }
+                bucket_table_allocator().Delete( m_Segments, m_metrics.nSegmentCount );
+            }
+
+            /// Returns head node of the bucket \p nBucket
+            aux_node_type * bucket( size_t nBucket ) const
+            {
+                size_t nSegment = nBucket >> m_metrics.nSegmentSizeLog2;
+                assert( nSegment < m_metrics.nSegmentCount );
+
+                table_entry* pSegment = m_Segments[ nSegment ].load( memory_model::memory_order_acquire );
+                if ( pSegment == nullptr )
+                    return nullptr;    // uninitialized bucket
+                return pSegment[ nBucket & (m_metrics.nSegmentSize - 1) ].load( memory_model::memory_order_acquire );
+            }
+
+            /// Prefetches the table entry of the bucket \p nBucket
+            void prefetch( size_t nBucket ) const
+            {
+                size_t nSegment = nBucket >> m_metrics.nSegmentSizeLog2;
+                assert( nSegment < m_metrics.nSegmentCount );
+
+                table_entry* pSegment = m_Segments[ nSegment ].load( memory_model::memory_order_relaxed );
+                if ( pSegment != nullptr )
+                    cds_prefetch( &pSegment[ nBucket & (m_metrics.nSegmentSize - 1) ] );
+            }
+
+            /// Set \p pNode as a head of empty bucket \p nBucket
+            void bucket( size_t nBucket, aux_node_type * pNode )
+            {
+                CDS_VERIFY( cas_bucket( nBucket, nullptr, pNode ));
+            }
+
+            /// Changes the head of bucket \p nBucket from \p pExpected to \p pNew
+            /**
+                Returns \p false if the head of the bucket is not equal to \p pExpected.
+            */
+            bool cas_bucket( size_t nBucket, aux_node_type * pExpected, aux_node_type * pNew )
+            {
+                size_t nSegment = nBucket >> m_metrics.nSegmentSizeLog2;
+                assert( nSegment < m_metrics.nSegmentCount );
+
+                segment_type& segment = m_Segments[nSegment];
+                if ( segment.load( memory_model::memory_order_relaxed ) == nullptr ) {
+                    table_entry* pNewSegment = segment_allocator().NewArray( m_metrics.nSegmentSize, nullptr );
+                    table_entry * pNull = nullptr;
+                    if ( !segment.compare_exchange_strong( pNull, pNewSegment, memory_model::memory_order_release, atomics::memory_order_relaxed ))
+                        segment_allocator().Delete( pNewSegment, m_metrics.nSegmentSize );
+                }
+
+                return segment.load( memory_model::memory_order_acquire )[ nBucket & (m_metrics.nSegmentSize - 1) ]
+                    .compare_exchange_strong( pExpected, pNew, memory_model::memory_order_release, atomics::memory_order_relaxed );
+            }
+
+            /// Allocates auxiliary node from the heap
+            aux_node_type* alloc_aux_node()
+            {
+                return aux_node_allocator().New();
+            }
+
+            /// Frees auxiliary node that has never been linked into the split-list
+            void free_aux_node( aux_node_type* p )
+            {
+                aux_node_allocator().Delete( p );
+            }
+
+            /// Returns the capacity of the bucket table
+            size_t capacity() const
+            {
+                return m_metrics.nCapacity;
+            }
+
+            /// Returns the load factor, i.e. average count of items per bucket
+            size_t load_factor() const
+            {
+                return m_metrics.nLoadFactor;
+            }
+
+        protected:
+            //@cond
+            static metrics calc_metrics( size_t nItemCount, size_t nLoadFactor )
+            {
+                metrics m;
+
+                // The same layout as expandable_bucket_table has
+                m.nLoadFactor = nLoadFactor > 0 ? nLoadFactor : 1;
+
+                size_t nBucketCount = ( nItemCount + m.nLoadFactor - 1 ) / m.nLoadFactor;
+                if ( nBucketCount <= 2 ) {
+                    m.nSegmentCount = 1;
+                    m.nSegmentSize = 2;
+                }
+                else if ( nBucketCount <= 1024 ) {
+                    m.nSegmentCount = 1;
+                    m.nSegmentSize = ((size_t)1) << beans::log2ceil( nBucketCount );
+                }
+                else {
+                    nBucketCount = beans::log2ceil( nBucketCount );
+                    m.nSegmentCount =
+                        m.nSegmentSize = ((size_t)1) << (nBucketCount / 2);
+                    if ( nBucketCount & 1 )
+                        m.nSegmentSize *= 2;
+                    if ( m.nSegmentCount * m.nSegmentSize * m.nLoadFactor < nItemCount )
+                        m.nSegmentSize *= 2;
+                }
+                m.nCapacity = m.nSegmentCount * m.nSegmentSize;
+                m.nSegmentSizeLog2 = cds::beans::log2( m.nSegmentSize );
+                assert( cds::beans::is_power2( m.nSegmentSize ));
+                assert( cds::beans::is_power2( m.nSegmentCount ));
+                return m;
+            }
+            //@endcond
+
+        protected:
+            //@cond
+            metrics const       m_metrics;  ///< Bucket table metrics
+            segment_type*       m_Segments; ///< bucket table - array of segments
+            //@endcond
+        };
+
 
         //@cond
         namespace details {
@@ -866,6 +1201,12 @@ namespace cds { namespace intrusive {
 
                 typedef split_list::node<node_type>                     splitlist_node_type;
 
+                static constexpr const bool c_bShrinkable = traits::shrink_factor != 0;
+                typedef typename std::conditional< c_bShrinkable,
+                    shrinkable_aux_node< splitlist_node_type, typename traits::allocator >,
+                    splitlist_node_type
+                >::type aux_node_type;
+
                 struct key_compare {
                     int operator()( value_type const& v1, value_type const& v2 ) const
                     {
@@ -909,12 +1250,24 @@ namespace cds { namespace intrusive {
                         splitlist_node_type * p = static_cast<splitlist_node_type *>(native_node_traits::to_node_ptr( v ));
                         if ( !p->is_dummy())
                             native_disposer()(v);
+                        else
+                            dispose_aux_node( p, std::integral_constant<bool, c_bShrinkable>());
+                    }
+
+                    static void dispose_aux_node( splitlist_node_type * /*p*/, std::false_type )
+                    {
+                        // aux nodes are owned by the bucket table
+                    }
+
+                    static void dispose_aux_node( splitlist_node_type * p, std::true_type )
+                    {
+                        aux_node_type::on_unlinked( static_cast<aux_node_type *>( p ));
                     }
                 };
 
             public:
                 typedef node_type ordered_list_node_type;
-                typedef splitlist_node_type aux_node;
+                typedef aux_node_type aux_node;
 
                 struct node_traits: private native_node_traits
                 {
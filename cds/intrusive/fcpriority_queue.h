@@ -0,0 +1,532 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_INTRUSIVE_FCPRIORITY_QUEUE_H
+#define CDSLIB_INTRUSIVE_FCPRIORITY_QUEUE_H
+
+#include <vector>
+#include <type_traits>
+#include <cds/algo/flat_combining.h>
+#include <cds/intrusive/options.h>
+#include <cds/opt/compare.h>
+
+namespace cds { namespace intrusive {
+
+    //@cond
+    template <typename T, typename Traits> class FCPriorityQueue;
+    //@endcond
+
+    /// FCPriorityQueue related definitions
+    /** @ingroup cds_intrusive_helper
+    */
+    namespace fcpqueue {
+
+        /// Base class of the item of \p FCPriorityQueue
+        /**
+            The node keeps the position of the item in the heap, so the queue can find the item
+            for \p FCPriorityQueue::erase() and \p FCPriorityQueue::update() in <tt>O(1)</tt>.
+            An item can belong to one queue at a time.
+        */
+        class node
+        {
+            //@cond
+            template <typename T, typename Traits> friend class cds::intrusive::FCPriorityQueue;
+            //@endcond
+
+        public:
+            //@cond
+            static constexpr const size_t c_nNotQueued = ~size_t( 0 );
+            //@endcond
+
+        protected:
+            //@cond
+            size_t  m_nIndex;   // position in the heap, c_nNotQueued if the item is not in a queue
+            //@endcond
+
+        public:
+            /// Creates the node that is not in a queue
+            node()
+                : m_nIndex( c_nNotQueued )
+            {}
+
+            //@cond
+            // The position in the heap is not copied
+            node( node const& )
+                : m_nIndex( c_nNotQueued )
+            {}
+
+            node& operator=( node const& )
+            {
+                return *this;
+            }
+            //@endcond
+        };
+
+        /// FCPriorityQueue internal statistics
+        template <typename Counter = cds::atomicity::event_counter >
+        struct stat: public cds::algo::flat_combining::stat<Counter>
+        {
+            typedef cds::algo::flat_combining::stat<Counter>    flat_combining_stat; ///< Flat-combining statistics
+            typedef typename flat_combining_stat::counter_type  counter_type;        ///< Counter type
+
+            counter_type    m_nPush         ;  ///< Count of push operations
+            counter_type    m_nPop          ;  ///< Count of success pop operations
+            counter_type    m_nFailedPop    ;  ///< Count of failed pop operations (pop from empty queue)
+            counter_type    m_nErase        ;  ///< Count of success erase operations
+            counter_type    m_nFailedErase  ;  ///< Count of failed erase operations (the item is not in the queue)
+            counter_type    m_nUpdate       ;  ///< Count of success update operations
+            counter_type    m_nFailedUpdate ;  ///< Count of failed update operations (the item is not in the queue)
+
+            //@cond
+            void    onPush()                { ++m_nPush; }
+            void    onPop( bool bFailed )   { if ( bFailed ) ++m_nFailedPop; else ++m_nPop; }
+            void    onErase( bool bOk )     { if ( bOk ) ++m_nErase; else ++m_nFailedErase; }
+            void    onUpdate( bool bOk )    { if ( bOk ) ++m_nUpdate; else ++m_nFailedUpdate; }
+            //@endcond
+        };
+
+        /// FCPriorityQueue dummy statistics, no overhead
+        struct empty_stat: public cds::algo::flat_combining::empty_stat
+        {
+            //@cond
+            void    onPush()        {}
+            void    onPop( bool )   {}
+            void    onErase( bool ) {}
+            void    onUpdate( bool ){}
+            //@endcond
+        };
+
+        /// FCPriorityQueue type traits
+        struct traits: public cds::algo::flat_combining::traits
+        {
+            /// Priority compare functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+            */
+            typedef opt::none       compare;
+
+            /// Specifies binary predicate used for priority comparing.
+            /**
+                Default is \p std::less<T>.
+            */
+            typedef opt::none       less;
+
+            /// Disposer to erase removed elements. Used only in \p FCPriorityQueue::clear() function
+            typedef cds::intrusive::opt::v::empty_disposer  disposer;
+
+            typedef empty_stat      stat;   ///< Internal statistics
+        };
+
+        /// Metafunction converting option list to traits
+        /**
+            \p Options are:
+            - any \p cds::algo::flat_combining::make_traits options
+            - \p opt::compare - priority compare functor. No default functor is provided.
+                If the option is not specified, the \p opt::less is used.
+            - \p opt::less - specifies binary predicate used for priority compare. Default is \p std::less<T>.
+            - \p opt::disposer - the functor used for dispose removed items. Default is \p opt::intrusive::v::empty_disposer.
+                This option is used only in \p FCPriorityQueue::clear() function.
+            - \p opt::stat - internal statistics, possible type: \p fcpqueue::stat, \p fcpqueue::empty_stat (the default)
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+    } // namespace fcpqueue
+
+    /// Flat-combining intrusive addressable priority queue
+    /**
+        @ingroup cds_intrusive_priority_queue
+        @ingroup cds_flat_combining_intrusive
+
+        \ref cds_flat_combining_description "Flat combining" binary heap of pointers to the items.
+        Each item is derived from \p fcpqueue::node that keeps the position of the item in the heap.
+        So, the item itself is the handle of the queue element: besides \p push() and \p pop(),
+        the queue supports
+        - \p erase( item ) - removes the item from any position of the heap in <tt>O(log N)</tt>;
+        - \p update( item, f ) - changes the priority of the item in place and restores the heap
+          in <tt>O(log N)</tt> ("decrease-key" / "increase-key").
+
+        That is useful for timers and schedulers: a cancelled or rescheduled timer is removed or moved
+        in the queue immediately instead of lazy deletion and re-insertion of a copy.
+
+        Like \p MSPriorityQueue, \p pop() extracts the item with the highest priority,
+        i.e. the greatest one by \p compare or \p less. For min-first order (for example, the earliest deadline)
+        use the reversed \p less.
+
+        The queue does not own the items. The item can be pushed again after it is popped or erased.
+        \p erase() and \p update() for an item that is not in the queue return \p false,
+        so the owner of the item may cancel the timer concurrently with the thread that pops it.
+        The item must not be destroyed while it is in the queue.
+
+        Template parameters:
+        - \p T - a value type stored in the queue, it must be derived from \p fcpqueue::node
+        - \p Traits - type traits of flat combining, default is \p fcpqueue::traits.
+            \p fcpqueue::make_traits metafunction can be used to construct specialized \p %fcpqueue::traits
+    */
+    template <typename T, typename Traits = fcpqueue::traits >
+    class FCPriorityQueue
+#ifndef CDS_DOXYGEN_INVOKED
+        : public cds::algo::flat_combining::container
+#endif
+    {
+    public:
+        typedef T           value_type;     ///< Value type
+        typedef Traits      traits;         ///< Priority queue traits
+
+        typedef typename traits::disposer  disposer;   ///< The disposer functor. The disposer is used only in \ref clear() function
+        typedef typename traits::stat  stat;   ///< Internal statistics type
+
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator  ;    ///< priority comparing functor based on opt::compare and opt::less option setter.
+#   else
+        typedef typename opt::details::make_comparator< value_type, traits >::type key_comparator;
+#   endif
+
+        static_assert( std::is_base_of< fcpqueue::node, value_type >::value, "The item type must be derived from fcpqueue::node" );
+
+    protected:
+        //@cond
+        // Priority queue operation IDs
+        enum fc_operation {
+            op_push = cds::algo::flat_combining::req_Operation,
+            op_pop,
+            op_erase,
+            op_update,
+            op_clear,
+            op_clear_and_dispose
+        };
+
+        // Flat combining publication list record
+        struct fc_record: public cds::algo::flat_combining::publication_record
+        {
+            value_type *    pVal;       // Value to push, erase, update or pop
+            void (* pUpdate )( void * pFunc, value_type& val ); // update functor caller
+            void *          pFunc;      // update functor
+            bool            bResult;    // true if the operation is succeeded
+        };
+        //@endcond
+
+        /// Flat combining kernel
+        typedef cds::algo::flat_combining::kernel< fc_record, traits > fc_kernel;
+
+        //@cond
+        typedef typename std::allocator_traits< typename traits::allocator >::template rebind_alloc< value_type * > heap_allocator;
+        typedef std::vector< value_type *, heap_allocator > heap_type;
+        //@endcond
+
+    protected:
+        //@cond
+        mutable fc_kernel   m_FlatCombining;
+        heap_type           m_Heap;
+        //@endcond
+
+    public:
+        /// Initializes empty priority queue object
+        FCPriorityQueue()
+        {}
+
+        /// Initializes empty priority queue object and gives flat combining parameters
+        FCPriorityQueue(
+            unsigned int nCompactFactor     ///< Flat combining: publication list compacting factor
+            ,unsigned int nCombinePassCount ///< Flat combining: number of combining passes for combiner thread
+            )
+            : m_FlatCombining( nCompactFactor, nCombinePassCount )
+        {}
+
+        /// Inserts \p val into the priority queue
+        /**
+            \p val must not be in a queue. The function always returns \p true.
+        */
+        bool push( value_type& val )
+        {
+            assert( static_cast<fcpqueue::node&>( val ).m_nIndex == fcpqueue::node::c_nNotQueued );
+
+            auto pRec = m_FlatCombining.acquire_record();
+            pRec->pVal = &val;
+
+            m_FlatCombining.combine( op_push, pRec, *this );
+
+            assert( pRec->is_done());
+            m_FlatCombining.release_record( pRec );
+            m_FlatCombining.internal_statistics().onPush();
+            return true;
+        }
+
+        /// Extracts the item with the highest priority
+        /**
+            If the queue is empty, the function returns \p nullptr.
+        */
+        value_type * pop()
+        {
+            auto pRec = m_FlatCombining.acquire_record();
+            pRec->pVal = nullptr;
+
+            m_FlatCombining.combine( op_pop, pRec, *this );
+
+            assert( pRec->is_done());
+            m_FlatCombining.release_record( pRec );
+            m_FlatCombining.internal_statistics().onPop( pRec->pVal == nullptr );
+            return pRec->pVal;
+        }
+
+        /// Removes \p val from the queue
+        /**
+            The function returns \p true if \p val has been removed,
+            and \p false if \p val is not in the queue (for example, it has been popped by another thread).
+        */
+        bool erase( value_type& val )
+        {
+            auto pRec = m_FlatCombining.acquire_record();
+            pRec->pVal = &val;
+
+            m_FlatCombining.combine( op_erase, pRec, *this );
+
+            assert( pRec->is_done());
+            m_FlatCombining.release_record( pRec );
+            m_FlatCombining.internal_statistics().onErase( pRec->bResult );
+            return pRec->bResult;
+        }
+
+        /// Changes the priority of \p val that is in the queue
+        /**
+            If \p val is in the queue, the function calls \p f under the combiner and then moves \p val
+            upward or downward to restore the heap. So, \p f can increase or decrease the priority
+            of the item. \p Func signature is:
+            \code
+                void f( value_type& val );
+            \endcode
+            The functor should change only the fields that affect the priority.
+
+            The function returns \p true if \p val is in the queue, otherwise \p f is not called
+            and the function returns \p false.
+
+            For example, rescheduling the timer:
+            \code
+            struct timer: public cds::intrusive::fcpqueue::node {
+                uint64_t    nDeadline;
+            };
+            struct earliest_first {
+                bool operator()( timer const& t1, timer const& t2 ) const { return t2.nDeadline < t1.nDeadline; }
+            };
+            typedef cds::intrusive::FCPriorityQueue< timer,
+                cds::intrusive::fcpqueue::make_traits< cds::opt::less< earliest_first > >::type
+            > timer_queue;
+
+            timer_queue tq;
+            timer t;
+            // ...
+            if ( !tq.update( t, [nNewDeadline]( timer& tm ) { tm.nDeadline = nNewDeadline; } )) {
+                // t has been fired already
+            }
+            \endcode
+        */
+        template <typename Func>
+        bool update( value_type& val, Func f )
+        {
+            auto pRec = m_FlatCombining.acquire_record();
+            pRec->pVal = &val;
+            pRec->pFunc = reinterpret_cast<void *>( &f );
+            pRec->pUpdate = []( void * pFunc, value_type& v ) { ( *reinterpret_cast<Func *>( pFunc ))( v ); };
+
+            m_FlatCombining.combine( op_update, pRec, *this );
+
+            assert( pRec->is_done());
+            m_FlatCombining.release_record( pRec );
+            m_FlatCombining.internal_statistics().onUpdate( pRec->bResult );
+            return pRec->bResult;
+        }
+
+        /// Clears the priority queue
+        /**
+            If \p bDispose is \p true, the disposer provided in \p Traits class' template parameter
+            will be called for each removed element.
+        */
+        void clear( bool bDispose = false )
+        {
+            auto pRec = m_FlatCombining.acquire_record();
+
+            m_FlatCombining.combine( bDispose ? op_clear_and_dispose : op_clear, pRec, *this );
+
+            assert( pRec->is_done());
+            m_FlatCombining.release_record( pRec );
+        }
+
+        /// Returns the number of elements in the priority queue.
+        /**
+            Note that <tt>size() == 0</tt> does not mean that the queue is empty because
+            combining record can be in process.
+            To check emptiness use \ref empty function.
+        */
+        size_t size() const
+        {
+            return m_Heap.size();
+        }
+
+        /// Checks if the priority queue is empty
+        /**
+            If the combining is in process the function waits while combining done.
+        */
+        bool empty() const
+        {
+            bool bRet = false;
+            auto const& heap = m_Heap;
+            m_FlatCombining.invoke_exclusive( [&heap, &bRet]() { bRet = heap.empty(); } );
+            return bRet;
+        }
+
+        /// Internal statistics
+        stat const& statistics() const
+        {
+            return m_FlatCombining.statistics();
+        }
+
+    public: // flat combining cooperation, not for direct use!
+        //@cond
+        /*
+            The function is called by \ref cds::algo::flat_combining::kernel "flat combining kernel"
+            object if the current thread becomes a combiner. Invocation of the function means that
+            the priority queue should perform an action recorded in \p pRec.
+        */
+        void fc_apply( fc_record * pRec )
+        {
+            assert( pRec );
+
+            switch ( pRec->op()) {
+            case op_push:
+                assert( pRec->pVal );
+                push_heap( pRec->pVal );
+                break;
+            case op_pop:
+                pRec->pVal = nullptr;
+                if ( !m_Heap.empty()) {
+                    pRec->pVal = m_Heap.front();
+                    remove_at( 0 );
+                }
+                break;
+            case op_erase:
+                assert( pRec->pVal );
+                pRec->bResult = is_queued( *pRec->pVal );
+                if ( pRec->bResult )
+                    remove_at( index_of( *pRec->pVal ));
+                break;
+            case op_update:
+                assert( pRec->pVal );
+                pRec->bResult = is_queued( *pRec->pVal );
+                if ( pRec->bResult ) {
+                    pRec->pUpdate( pRec->pFunc, *pRec->pVal );
+                    restore_at( index_of( *pRec->pVal ));
+                }
+                break;
+            case op_clear:
+            case op_clear_and_dispose:
+                for ( value_type * p : m_Heap ) {
+                    set_index( *p, fcpqueue::node::c_nNotQueued );
+                    if ( pRec->op() == op_clear_and_dispose )
+                        disposer()( p );
+                }
+                m_Heap.clear();
+                break;
+            default:
+                assert(false);
+                break;
+            }
+        }
+        //@endcond
+
+    private:
+        //@cond
+        static size_t index_of( value_type const& val )
+        {
+            return static_cast<fcpqueue::node const&>( val ).m_nIndex;
+        }
+
+        static void set_index( value_type& val, size_t nIdx )
+        {
+            static_cast<fcpqueue::node&>( val ).m_nIndex = nIdx;
+        }
+
+        bool is_queued( value_type const& val ) const
+        {
+            size_t const nIdx = index_of( val );
+            return nIdx < m_Heap.size() && m_Heap[nIdx] == &val;
+        }
+
+        void place( size_t nIdx, value_type * pVal )
+        {
+            m_Heap[nIdx] = pVal;
+            set_index( *pVal, nIdx );
+        }
+
+        void push_heap( value_type * pVal )
+        {
+            m_Heap.push_back( pVal );
+            sift_up( m_Heap.size() - 1 );
+        }
+
+        void remove_at( size_t nIdx )
+        {
+            assert( nIdx < m_Heap.size());
+            set_index( *m_Heap[nIdx], fcpqueue::node::c_nNotQueued );
+
+            value_type * pLast = m_Heap.back();
+            m_Heap.pop_back();
+            if ( nIdx < m_Heap.size()) {
+                place( nIdx, pLast );
+                restore_at( nIdx );
+            }
+        }
+
+        void restore_at( size_t nIdx )
+        {
+            if ( nIdx > 0 && key_comparator()( *m_Heap[nIdx], *m_Heap[( nIdx - 1 ) / 2] ) > 0 )
+                sift_up( nIdx );
+            else
+                sift_down( nIdx );
+        }
+
+        void sift_up( size_t nIdx )
+        {
+            key_comparator cmp;
+            value_type * pVal = m_Heap[nIdx];
+            while ( nIdx > 0 ) {
+                size_t const nParent = ( nIdx - 1 ) / 2;
+                if ( cmp( *pVal, *m_Heap[nParent] ) <= 0 )
+                    break;
+                place( nIdx, m_Heap[nParent] );
+                nIdx = nParent;
+            }
+            place( nIdx, pVal );
+        }
+
+        void sift_down( size_t nIdx )
+        {
+            key_comparator cmp;
+            size_t const nSize = m_Heap.size();
+            value_type * pVal = m_Heap[nIdx];
+            for ( size_t nChild = nIdx * 2 + 1; nChild < nSize; nChild = nIdx * 2 + 1 ) {
+                if ( nChild + 1 < nSize && cmp( *m_Heap[nChild + 1], *m_Heap[nChild] ) > 0 )
+                    ++nChild;
+                if ( cmp( *m_Heap[nChild], *pVal ) <= 0 )
+                    break;
+                place( nIdx, m_Heap[nChild] );
+                nIdx = nChild;
+            }
+            place( nIdx, pVal );
+        }
+        //@endcond
+    };
+
+}} // namespace cds::intrusive
+
+#endif // #ifndef CDSLIB_INTRUSIVE_FCPRIORITY_QUEUE_H
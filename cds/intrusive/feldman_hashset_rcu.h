@@ -101,6 +101,7 @@ namespace cds { namespace intrusive {
         typedef typename base_class::atomic_node_ptr atomic_node_ptr;
         typedef typename base_class::array_node array_node;
         typedef typename base_class::traverse_data traverse_data;
+        typedef typename base_class::array_node_disposer array_node_disposer;
 
         using base_class::to_array;
         using base_class::to_node;
@@ -182,6 +183,9 @@ namespace cds { namespace intrusive {
             while (true) {
                 rcu_lock rcuLock;
 
+                // array nodes might be reclaimed while RCU was unlocked
+                if ( base_class::c_bCompaction )
+                    pos.reset( *this );
                 node_ptr slot = base_class::traverse( pos );
                 assert(slot.bits() == 0);
 
@@ -262,6 +266,8 @@ namespace cds { namespace intrusive {
             }
             if ( p ) {
                 gc::template retire_ptr<disposer>( p );
+                if ( base_class::c_bCompaction )
+                    compact_path( hash_accessor()( val ));
                 return true;
             }
             return false;
@@ -316,6 +322,8 @@ namespace cds { namespace intrusive {
             if ( p ) {
                 f( *p );
                 gc::template retire_ptr<disposer>(p);
+                if ( base_class::c_bCompaction )
+                    compact_path( hash );
                 return true;
             }
             return false;
@@ -356,6 +364,8 @@ namespace cds { namespace intrusive {
                 rcu_lock rcuLock;
                 p = do_erase( hash, []( value_type const&) -> bool {return true;} );
             }
+            if ( p && base_class::c_bCompaction )
+                compact_path( hash );
             return exempt_ptr( p );
         }
 
@@ -446,7 +456,25 @@ namespace cds { namespace intrusive {
         */
         void clear()
         {
-            clear_array( head(), head_size());
+            if ( base_class::c_bCompaction ) {
+                // array nodes may be reclaimed concurrently, so the tree is traversed under RCU lock
+                // and retiring is deferred until the lock is released
+                check_deadlock_policy::check();
+
+                std::vector< value_type * > removed;
+                std::vector< array_node * > unlinked;
+                {
+                    rcu_lock rcuLock;
+                    clear_array( head(), head_size(), [&removed]( value_type * p ) { removed.push_back( p ); } );
+                    compact_tree( head(), head_size(), unlinked );
+                }
+                for ( value_type * p : removed )
+                    gc::template retire_ptr<disposer>( p );
+                for ( array_node * p : unlinked )
+                    gc::template retire_ptr<array_node_disposer>( p );
+            }
+            else
+                clear_array( head(), head_size(), []( value_type * p ) { gc::template retire_ptr<disposer>( p ); } );
         }
 
         /// Checks if the set is empty
@@ -488,6 +516,7 @@ namespace cds { namespace intrusive {
         */
         void get_level_statistics(std::vector<feldman_hashset::level_statistics>& stat) const
         {
+            rcu_lock rcuLock;
             base_class::get_level_statistics(stat);
         }
 
@@ -571,6 +600,13 @@ namespace cds { namespace intrusive {
                 return m_pValue;
             }
 
+            static bool is_linked( array_node * pNode )
+            {
+                // without compaction an array node is never unlinked from its parent
+                return !base_class::c_bCompaction
+                    || pNode->pParent->nodes[pNode->idxParent].load( memory_model::memory_order_acquire ) == node_ptr( to_node( pNode ), base_class::flag_array_node );
+            }
+
             void forward()
             {
                 assert(m_set != nullptr);
@@ -592,7 +628,7 @@ namespace cds { namespace intrusive {
                             idx = 0;
                             nodeSize = arrayNodeSize;
                         }
-                        else if (slot.bits() == base_class::flag_array_converting ) {
+                        else if (slot.bits() == base_class::flag_array_converting || slot.bits() == base_class::flag_array_frozen ) {
                             // the slot is converting to array node right now - skip the node
                             ++idx;
                         }
@@ -610,7 +646,8 @@ namespace cds { namespace intrusive {
                     else {
                         // up to parent node
                         if (pNode->pParent) {
-                            idx = pNode->idxParent + 1;
+                            // if pNode has been compacted into its parent slot, the slot should be visited again
+                            idx = is_linked( pNode ) ? pNode->idxParent + 1 : pNode->idxParent;
                             pNode = pNode->pParent;
                             nodeSize = pNode->pParent ? arrayNodeSize : headSize;
                         }
@@ -650,7 +687,7 @@ namespace cds { namespace intrusive {
                             nodeSize = arrayNodeSize;
                             idx = nodeSize - 1;
                         }
-                        else if (slot.bits() == base_class::flag_array_converting ) {
+                        else if (slot.bits() == base_class::flag_array_converting || slot.bits() == base_class::flag_array_frozen ) {
                             // the slot is converting to array node right now - skip the node
                             --idx;
                         }
@@ -668,7 +705,7 @@ namespace cds { namespace intrusive {
                     else {
                         // up to parent node
                         if (pNode->pParent) {
-                            idx = pNode->idxParent - 1;
+                            idx = is_linked( pNode ) ? pNode->idxParent - 1 : pNode->idxParent;
                             pNode = pNode->pParent;
                             nodeSize = pNode->pParent ? arrayNodeSize : headSize;
                         }
@@ -1020,6 +1057,19 @@ namespace cds { namespace intrusive {
 
     protected:
         //@cond
+        // find_batch() support: the first step of the search for \p hash from the head node.
+        // Prefetches the target of the slot of the array node the head slot refers to
+        void prefetch_first_step( hash_type const& hash ) const
+        {
+            // RCU should be locked
+            assert( gc::is_locked());
+
+            typename base_class::hash_splitter splitter( hash );
+            node_ptr cur = head()->nodes[ splitter.cut( static_cast<unsigned>( metrics().head_node_size_log )) ].load( memory_model::memory_order_acquire );
+            if ( cur.bits() == base_class::flag_array_node && !splitter.eos())
+                base_class::prefetch_child( to_array( cur.ptr())->nodes[ splitter.cut( static_cast<unsigned>( metrics().array_node_size_log )) ], splitter );
+        }
+
         template <typename Func>
         std::pair<bool, bool> do_update(value_type& val, Func f, bool bInsert = true)
         {
@@ -1031,6 +1081,9 @@ namespace cds { namespace intrusive {
             while ( true ) {
                 rcu_lock rcuLock;
 
+                // array nodes might be reclaimed while RCU was unlocked
+                if ( base_class::c_bCompaction )
+                    pos.reset( *this );
                 node_ptr slot = base_class::traverse( pos );
                 assert(slot.bits() == 0);
 
@@ -1165,11 +1218,38 @@ namespace cds { namespace intrusive {
             }
         }
 
+        void compact_path( hash_type const& hash )
+        {
+            check_deadlock_policy::check();
+
+            // the chain of the array nodes unlinked: pLowest, pLowest->pParent, ...
+            array_node * pLowest = nullptr;
+            size_t nCount = 0;
+            {
+                rcu_lock rcuLock;
+                traverse_data pos( hash, *this );
+                base_class::traverse( pos );
+                for ( array_node * pArr = pos.pArr; pArr->pParent && base_class::compact_array_node( pArr ); pArr = pArr->pParent ) {
+                    if ( !pLowest )
+                        pLowest = pArr;
+                    ++nCount;
+                }
+            }
+
+            // retire_ptr must be called only outside of RCU lock
+            for ( ; nCount; --nCount ) {
+                array_node * pParent = pLowest->pParent;
+                gc::template retire_ptr<array_node_disposer>( pLowest );
+                pLowest = pParent;
+            }
+        }
+
         //@endcond
 
     private:
         //@cond
-        void clear_array(array_node * pArrNode, size_t nSize)
+        template <typename Func>
+        void clear_array(array_node * pArrNode, size_t nSize, Func onRemove )
         {
             back_off bkoff;
 
@@ -1180,27 +1260,27 @@ namespace cds { namespace intrusive {
                     if (slot.bits() == base_class::flag_array_node ) {
                         // array node, go down the tree
                         assert(slot.ptr() != nullptr);
-                        clear_array(to_array(slot.ptr()), array_node_size());
+                        clear_array(to_array(slot.ptr()), array_node_size(), onRemove );
                         break;
                     }
                     else if (slot.bits() == base_class::flag_array_converting ) {
                         // the slot is converting to array node right now
+                        // or the array node referenced by the slot is being compacted
                         while ((slot = pArr->load(memory_model::memory_order_acquire)).bits() == base_class::flag_array_converting ) {
                             bkoff();
                             stats().onSlotConverting();
                         }
                         bkoff.reset();
-
-                        assert(slot.ptr() != nullptr);
-                        assert(slot.bits() == base_class::flag_array_node );
-                        clear_array(to_array(slot.ptr()), array_node_size());
+                    }
+                    else if ( slot.bits() == base_class::flag_array_frozen ) {
+                        // pArrNode is being compacted by another thread, its items are moved up to the parent
                         break;
                     }
                     else {
                         // data node
                         if (pArr->compare_exchange_strong(slot, node_ptr(), memory_model::memory_order_acquire, atomics::memory_order_relaxed)) {
                             if (slot.ptr()) {
-                                gc::template retire_ptr<disposer>(slot.ptr());
+                                onRemove( slot.ptr());
                                 --m_ItemCounter;
                                 stats().onEraseSuccess();
                             }
@@ -1210,6 +1290,22 @@ namespace cds { namespace intrusive {
                 }
             }
         }
+
+        void compact_tree( array_node * pArrNode, size_t nSize, std::vector< array_node * >& unlinked )
+        {
+            assert( gc::is_locked());
+
+            // post-order: the children are compacted before their parent
+            for ( atomic_node_ptr * pArr = pArrNode->nodes, *pLast = pArr + nSize; pArr != pLast; ++pArr ) {
+                node_ptr slot = pArr->load( memory_model::memory_order_acquire );
+                if ( slot.bits() == base_class::flag_array_node ) {
+                    array_node * pChild = to_array( slot.ptr());
+                    compact_tree( pChild, array_node_size(), unlinked );
+                    if ( base_class::compact_array_node( pChild ))
+                        unlinked.push_back( pChild );
+                }
+            }
+        }
         //@endcond
     };
 
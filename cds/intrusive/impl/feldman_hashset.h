@@ -118,7 +118,11 @@ namespace cds { namespace intrusive {
         typedef typename gc::template guarded_ptr< value_type > guarded_ptr; ///< Guarded pointer
 
         /// Count of hazard pointers required
-        static constexpr size_t const c_nHazardPtrCount = 2;
+        /**
+            The array node compaction (see \p feldman_hashset::traits::compaction) requires two additional
+            hazard pointers to protect array nodes on the path.
+        */
+        static constexpr size_t const c_nHazardPtrCount = base_class::c_bCompaction ? 4 : 2;
 
         /// The size of hash_type in bytes, see \p feldman_hashset::traits::hash_size for explanation
         static constexpr size_t const c_hash_size = base_class::c_hash_size;
@@ -132,12 +136,45 @@ namespace cds { namespace intrusive {
         typedef typename base_class::atomic_node_ptr atomic_node_ptr;
         typedef typename base_class::array_node array_node;
         typedef typename base_class::traverse_data traverse_data;
+        typedef typename base_class::hash_splitter hash_splitter;
+        typedef typename base_class::array_node_disposer array_node_disposer;
 
         using base_class::to_array;
         using base_class::to_node;
         using base_class::stats;
         using base_class::head;
         using base_class::metrics;
+
+        // Array node guard when the compaction is disabled: array nodes are never reclaimed
+        struct empty_node_guard
+        {
+            void copy( empty_node_guard const& )
+            {}
+
+            void assign( array_node * )
+            {}
+        };
+
+        // Protects an array node while it is being iterated
+        typedef typename std::conditional< base_class::c_bCompaction, typename gc::Guard, empty_node_guard >::type node_guard;
+
+        // Protects array nodes on the path while traversing
+        class traverse_guard
+        {
+        public:
+            bool protect( size_t nHeight, atomic_node_ptr const& slot, node_ptr cur )
+            {
+                // A node of height h is protected by m_guards[h & 1],
+                // so the node found by traverse() and its parent are protected both
+                m_guards.assign( nHeight & 1, to_array( cur.ptr()));
+                return slot.load( memory_model::memory_order_acquire ) == cur;
+            }
+
+        private:
+            typename gc::template GuardArray<2> m_guards;
+        };
+
+        typedef typename std::conditional< base_class::c_bCompaction, traverse_guard, typename base_class::empty_traverse_guard >::type array_guard;
         //@endcond
 
     protected:
@@ -150,6 +187,7 @@ namespace cds { namespace intrusive {
             array_node *        m_pNode;    ///< current array node
             size_t              m_idx;      ///< current position in m_pNode
             typename gc::Guard  m_guard;    ///< HP guard
+            node_guard          m_nodeGuard; ///< guard of m_pNode (only for compaction)
             FeldmanHashSet const*  m_set;    ///< Hash set
 
         public:
@@ -165,6 +203,7 @@ namespace cds { namespace intrusive {
                 , m_set( rhs.m_set )
             {
                 m_guard.copy( rhs.m_guard );
+                m_nodeGuard.copy( rhs.m_nodeGuard );
             }
 
             iterator_base& operator=( iterator_base const& rhs ) noexcept
@@ -173,6 +212,7 @@ namespace cds { namespace intrusive {
                 m_idx = rhs.m_idx;
                 m_set = rhs.m_set;
                 m_guard.copy( rhs.m_guard );
+                m_nodeGuard.copy( rhs.m_nodeGuard );
                 return *this;
             }
 
@@ -240,12 +280,14 @@ namespace cds { namespace intrusive {
                         if ( slot.bits() == base_class::flag_array_node ) {
                             // array node, go down the tree
                             assert( slot.ptr() != nullptr );
+                            if ( !protect_child( m_nodeGuard, pNode->nodes[idx], slot ))
+                                continue;
                             pNode = to_array( slot.ptr());
                             idx = 0;
                             nodeSize = arrayNodeSize;
                         }
-                        else if ( slot.bits() == base_class::flag_array_converting ) {
-                            // the slot is converting to array node right now - skip the node
+                        else if ( slot.bits() == base_class::flag_array_converting || slot.bits() == base_class::flag_array_frozen ) {
+                            // the slot is converting to array node or the array node is being compacted right now - skip the node
                             ++idx;
                         }
                         else {
@@ -263,8 +305,11 @@ namespace cds { namespace intrusive {
                     else {
                         // up to parent node
                         if ( pNode->pParent ) {
-                            idx = pNode->idxParent + 1;
-                            pNode = pNode->pParent;
+                            bool bLinked;
+                            pNode = m_set->locate_parent( pNode, idx, bLinked, m_nodeGuard );
+                            // if the node has been folded into the parent slot, the slot should be visited again
+                            if ( bLinked )
+                                ++idx;
                             nodeSize = pNode->pParent ? arrayNodeSize : headSize;
                         }
                         else {
@@ -298,12 +343,14 @@ namespace cds { namespace intrusive {
                         if ( slot.bits() == base_class::flag_array_node ) {
                             // array node, go down the tree
                             assert( slot.ptr() != nullptr );
+                            if ( !protect_child( m_nodeGuard, pNode->nodes[idx], slot ))
+                                continue;
                             pNode = to_array( slot.ptr());
                             nodeSize = arrayNodeSize;
                             idx = nodeSize - 1;
                         }
-                        else if ( slot.bits() == base_class::flag_array_converting ) {
-                            // the slot is converting to array node right now - skip the node
+                        else if ( slot.bits() == base_class::flag_array_converting || slot.bits() == base_class::flag_array_frozen ) {
+                            // the slot is converting to array node or the array node is being compacted right now - skip the node
                             --idx;
                         }
                         else {
@@ -321,8 +368,11 @@ namespace cds { namespace intrusive {
                     else {
                         // up to parent node
                         if ( pNode->pParent ) {
-                            idx = pNode->idxParent - 1;
-                            pNode = pNode->pParent;
+                            bool bLinked;
+                            pNode = m_set->locate_parent( pNode, idx, bLinked, m_nodeGuard );
+                            // if the node has been folded into the parent slot, the slot should be visited again
+                            if ( bLinked )
+                                --idx;
                             nodeSize = pNode->pParent ? arrayNodeSize : headSize;
                         }
                         else {
@@ -595,12 +645,13 @@ namespace cds { namespace intrusive {
         {
             hash_type const& hash = hash_accessor()( val );
             traverse_data pos( hash, *this );
+            array_guard arrGuard;
             hash_comparator cmp;
             typename gc::template GuardArray<2> guards;
 
             guards.assign( 1, &val );
             while ( true ) {
-                node_ptr slot = base_class::traverse( pos );
+                node_ptr slot = base_class::traverse( pos, arrGuard );
                 assert( slot.bits() == 0 );
 
                 // protect data node by hazard pointer
@@ -853,7 +904,17 @@ namespace cds { namespace intrusive {
         */
         void clear()
         {
-            clear_array( head(), head_size());
+            if ( base_class::c_bCompaction ) {
+                // Array nodes can be reclaimed by the compaction, so the set is cleared by the iterator
+                // that protects the current array node
+                iterator_base it( *this, head(), size_t(0) - 1 );
+                while ( it.m_pNode != head() || it.m_idx < head_size()) {
+                    do_erase_at( it );
+                    ++it;
+                }
+            }
+            else
+                clear_array( head(), head_size());
         }
 
         /// Checks if the set is empty
@@ -895,7 +956,8 @@ namespace cds { namespace intrusive {
         */
         void get_level_statistics( std::vector< feldman_hashset::level_statistics>& stat ) const
         {
-            base_class::get_level_statistics( stat );
+            node_guard guard;
+            gather_level_statistics( stat, guard );
         }
 
     public:
@@ -1066,10 +1128,11 @@ namespace cds { namespace intrusive {
         value_type * search( hash_type const& hash, typename gc::Guard& guard )
         {
             traverse_data pos( hash, *this );
+            array_guard arrGuard;
             hash_comparator cmp;
 
             while ( true ) {
-                node_ptr slot = base_class::traverse( pos );
+                node_ptr slot = base_class::traverse( pos, arrGuard );
                 assert( slot.bits() == 0 );
 
                 // protect data node by hazard pointer
@@ -1092,9 +1155,10 @@ namespace cds { namespace intrusive {
         value_type * do_erase( hash_type const& hash, typename gc::Guard& guard, Predicate pred )
         {
             traverse_data pos( hash, *this );
+            array_guard arrGuard;
             hash_comparator cmp;
             while ( true ) {
-                node_ptr slot = base_class::traverse( pos );
+                node_ptr slot = base_class::traverse( pos, arrGuard );
                 assert( slot.bits() == 0 );
 
                 // protect data node by hazard pointer
@@ -1111,6 +1175,8 @@ namespace cds { namespace intrusive {
                             --m_ItemCounter;
                             stats().onEraseSuccess();
 
+                            if ( base_class::c_bCompaction )
+                                compact_path( pos, arrGuard );
                             return slot.ptr();
                         }
                         stats().onEraseRetry();
@@ -1146,25 +1212,173 @@ namespace cds { namespace intrusive {
                         gc::template retire<disposer>( slot.ptr());
                         --m_ItemCounter;
                         stats().onEraseSuccess();
+
+                        if ( base_class::c_bCompaction )
+                            compact_path( hash_accessor()( *slot.ptr()));
                         return true;
                     }
                 }
+                else if ( slot.bits() == base_class::flag_array_frozen && slot.ptr() == iter.pointer()) {
+                    // the array node is being folded into its parent slot, the item may be moved to the parent
+                    typename gc::Guard guard;
+                    value_type const* pVal = slot.ptr();
+                    auto pred = [pVal]( value_type const& item ) -> bool { return &item == pVal; };
+                    return do_erase( hash_accessor()( *pVal ), guard, std::ref( pred )) != nullptr;
+                }
                 else
                     return false;
             }
         }
 
+        void compact_path( hash_type const& hash )
+        {
+            traverse_data pos( hash, *this );
+            array_guard arrGuard;
+            base_class::traverse( pos, arrGuard );
+            compact_path( pos, arrGuard );
+        }
+
+        void compact_path( traverse_data& pos, array_guard& arrGuard )
+        {
+            // pos.pArr and its parent are protected by arrGuard
+            while ( pos.pArr->pParent && base_class::compact_array_node( pos.pArr )) {
+                gc::template retire<array_node_disposer>( pos.pArr );
+
+                // The parent can become a candidate for compaction too
+                pos.reset( *this );
+                base_class::traverse( pos, arrGuard );
+            }
+        }
+
+        static bool protect_child( typename gc::Guard& guard, atomic_node_ptr const& slot, node_ptr cur )
+        {
+            // guard protects the node containing the slot, so the child is protected by temporary guard first
+            typename gc::Guard child;
+            child.assign( to_array( cur.ptr()));
+            if ( slot.load( memory_model::memory_order_acquire ) != cur )
+                return false;
+            guard.copy( child );
+            return true;
+        }
+
+        static bool protect_child( empty_node_guard&, atomic_node_ptr const&, node_ptr )
+        {
+            return true;
+        }
+
+        // find_batch() support: the first step of the search for \p hash from the head node.
+        // Prefetches the target of the slot of the array node the head slot refers to
+        void prefetch_first_step( hash_type const& hash )
+        {
+            node_guard guard;
+            hash_splitter splitter( hash );
+            atomic_node_ptr const& slot = head()->nodes[ splitter.cut( static_cast<unsigned>( metrics().head_node_size_log )) ];
+            node_ptr cur = slot.load( memory_model::memory_order_acquire );
+            if ( cur.bits() == base_class::flag_array_node && !splitter.eos() && protect_child( guard, slot, cur ))
+                base_class::prefetch_child( to_array( cur.ptr())->nodes[ splitter.cut( static_cast<unsigned>( metrics().array_node_size_log )) ], splitter );
+        }
+
+        array_node * locate_parent( array_node * pNode, size_t& idx, bool& bLinked, empty_node_guard& ) const
+        {
+            idx = pNode->idxParent;
+            bLinked = true;
+            return pNode->pParent;
+        }
+
+        array_node * locate_parent( array_node * pNode, size_t& idx, bool& bLinked, typename gc::Guard& guard ) const
+        {
+            // pNode is protected by guard. The node may be already unlinked and its ancestors may be reclaimed,
+            // so the parent slot is found by descending from the head along the path of pNode
+            typename gc::template GuardArray<2> guards;
+            hash_splitter splitter( pNode->path_hash());
+            array_node * pArr = head();
+            size_t nHeight = 1;
+            size_t nSlot = static_cast<size_t>( splitter.cut( static_cast<unsigned>( metrics().head_node_size_log )));
+
+            for ( ;; ) {
+                node_ptr slot = pArr->nodes[nSlot].load( memory_model::memory_order_acquire );
+                if ( nHeight + 1 == pNode->nHeight || slot.bits() != base_class::flag_array_node ) {
+                    bLinked = slot == node_ptr( to_node( pNode ), base_class::flag_array_node );
+                    break;
+                }
+
+                guards.assign( ( nHeight + 1 ) & 1, to_array( slot.ptr()));
+                if ( pArr->nodes[nSlot].load( memory_model::memory_order_acquire ) != slot )
+                    continue;
+
+                pArr = to_array( slot.ptr());
+                ++nHeight;
+                nSlot = static_cast<size_t>( splitter.cut( static_cast<unsigned>( metrics().array_node_size_log )));
+            }
+
+            // pArr is protected by guards
+            guard.assign( pArr );
+            idx = nSlot;
+            return pArr;
+        }
+
+        void gather_level_statistics( std::vector< feldman_hashset::level_statistics>& stat, empty_node_guard& ) const
+        {
+            base_class::get_level_statistics( stat );
+        }
+
+        void gather_level_statistics( std::vector< feldman_hashset::level_statistics>& stat, typename gc::Guard& guard ) const
+        {
+            // Array nodes can be reclaimed concurrently, so the tree is walked iteratively
+            // and only the current array node is protected
+            stat.clear();
+
+            array_node * pNode = head();
+            size_t nLevel = 0;
+            size_t nodeSize = head_size();
+            size_t idx = 0;
+            base_class::gather_node_statistics( stat, nLevel, pNode, nodeSize );
+
+            for ( ;; ) {
+                if ( idx < nodeSize ) {
+                    node_ptr slot = pNode->nodes[idx].load( memory_model::memory_order_acquire );
+                    if ( slot.bits() == base_class::flag_array_node ) {
+                        if ( protect_child( guard, pNode->nodes[idx], slot )) {
+                            pNode = to_array( slot.ptr());
+                            nodeSize = array_node_size();
+                            idx = 0;
+                            base_class::gather_node_statistics( stat, ++nLevel, pNode, nodeSize );
+                        }
+                    }
+                    else
+                        ++idx;
+                }
+                else if ( pNode->pParent ) {
+                    // up to parent node
+                    bool bLinked;
+                    pNode = locate_parent( pNode, idx, bLinked, guard );
+                    ++idx;
+                    if ( pNode->pParent ) {
+                        nLevel = pNode->nHeight - 1;
+                        nodeSize = array_node_size();
+                    }
+                    else {
+                        nLevel = 0;
+                        nodeSize = head_size();
+                    }
+                }
+                else
+                    break;
+            }
+        }
+
         template <typename Func>
         std::pair<bool, bool> do_update( value_type& val, Func f, bool bInsert = true )
         {
             hash_type const& hash = hash_accessor()( val );
             traverse_data pos( hash, *this );
+            array_guard arrGuard;
             hash_comparator cmp;
             typename gc::template GuardArray<2> guards;
 
             guards.assign( 1, &val );
             while ( true ) {
-                node_ptr slot = base_class::traverse( pos );
+                node_ptr slot = base_class::traverse( pos, arrGuard );
                 assert( slot.bits() == 0 );
 
                 // protect data node by hazard pointer
@@ -865,6 +865,63 @@ namespace cds { namespace intrusive {
             }
         }
 
+        // find_batch() support: prefetches the node next to \p pNode.
+        // The nodes of the list are never freed while the list exists, only the data is protected
+        static void prefetch_next( node_type const* pNode )
+        {
+            cds_prefetch( pNode->next.load( memory_model::memory_order_relaxed ));
+        }
+
+        // find_batch() support: prefetches the first node of the list
+        void prefetch_first() const
+        {
+            prefetch_next( &m_Head );
+        }
+
+        // find_batch() support: the first step of the search,
+        // prefetches the data of the first node and the node next to it
+        void prefetch_second() const
+        {
+            node_type const* pCur = m_Head.next.load( memory_model::memory_order_acquire );
+            cds_prefetch( pCur->data.load( memory_model::memory_order_relaxed ).ptr());
+            prefetch_next( pCur );
+        }
+
+        // bulk_load() support: inserts the items of [pFirst, pLast) sorted by the key.
+        // The new nodes of the items falling between two adjacent nodes of the list are linked privately
+        // and published by one CAS, so an empty list takes all items at once. An empty node of the list
+        // takes one item as insert() does. The items whose key is already in the list
+        // or is equal to the key of the previous item are not inserted, they are passed to fReject
+        template <typename Func>
+        size_t merge_at( node_type* pHead, value_type* const* pFirst, value_type* const* pLast, Func fReject )
+        {
+            insert_position pos;
+            size_t nInserted = 0;
+
+            while ( pFirst != pLast ) {
+                if ( inserting_search( pHead, **pFirst, pos, key_comparator())) {
+                    m_Stat.onInsertFailed();
+                    fReject( **pFirst );
+                    ++pFirst;
+                    continue;
+                }
+
+                value_type* const* pEnd = ( pos.pPrev != pos.pHead && pos.pPrevVal == nullptr )
+                    ? pFirst + 1
+                    : chain_end( pFirst, pLast, pos.pFound );
+
+                if ( pEnd - pFirst == 1 ? link_data( *pFirst, pos, pHead ) : link_chain( pFirst, pEnd, pos, pHead )) {
+                    m_ItemCounter += static_cast<size_t>( pEnd - pFirst );
+                    nInserted += static_cast<size_t>( pEnd - pFirst );
+                    for ( ; pFirst != pEnd; ++pFirst )
+                        m_Stat.onInsertSuccess();
+                }
+                else
+                    m_Stat.onInsertRetry();
+            }
+            return nInserted;
+        }
+
         bool insert_at( node_type* pHead, value_type& val )
         {
             insert_position pos;
@@ -1336,6 +1393,89 @@ namespace cds { namespace intrusive {
             return false;
         }
 
+        // merge_at() support: the end of the items less than pNext without repeated keys
+        static value_type* const* chain_end( value_type* const* pFirst, value_type* const* pLast, value_type const* pNext )
+        {
+            key_comparator cmp;
+            value_type* const* pEnd = pFirst + 1;
+            while ( pEnd != pLast && cmp( *pEnd[-1], **pEnd ) != 0 && ( pNext == nullptr || cmp( **pEnd, *pNext ) < 0 ))
+                ++pEnd;
+            return pEnd;
+        }
+
+        // merge_at() support: links the new nodes of [pFirst, pLast) privately
+        // and publishes the chain between pos.pPrev and pos.pCur like link_data() does for one node
+        bool link_chain( value_type* const* pFirst, value_type* const* pLast, insert_position& pos, node_type* pHead )
+        {
+            assert( pos.pPrev != nullptr );
+            assert( pos.pCur != nullptr );
+
+            // The nodes are allocated before marking pos.pPrev and pos.pCur data since the allocation can throw
+            node_type * pChain = pos.pCur;
+            try {
+                for ( value_type* const* p = pLast; p != pFirst; ) {
+                    node_type * pNode = alloc_node( *--p );
+                    pNode->next.store( pChain, memory_model::memory_order_relaxed );
+                    pChain = pNode;
+                }
+            }
+            catch ( ... ) {
+                delete_chain( pChain, pos.pCur );
+                throw;
+            }
+
+            marked_data_ptr valCur( pos.pFound );
+            if ( !pos.pCur->data.compare_exchange_strong( valCur, valCur | 1, memory_model::memory_order_acquire, atomics::memory_order_relaxed )) {
+                m_Stat.onNodeMarkFailed();
+                delete_chain( pChain, pos.pCur );
+                return false;
+            }
+
+            marked_data_ptr valPrev( pos.pPrevVal );
+            if ( !pos.pPrev->data.compare_exchange_strong( valPrev, valPrev | 1, memory_model::memory_order_acquire, atomics::memory_order_relaxed )) {
+                pos.pCur->data.store( valCur, memory_model::memory_order_relaxed );
+                m_Stat.onNodeMarkFailed();
+                delete_chain( pChain, pos.pCur );
+                return false;
+            }
+
+            bool result = false;
+            if ( pos.pPrev->next.load( memory_model::memory_order_acquire ) != pos.pCur ) {
+                // sequence pPrev - pCur is broken
+                m_Stat.onNodeSeqBreak();
+            }
+            else if ( pos.pPrevVal == nullptr && find_prev( pHead, **pFirst ) != pos.pPrev ) {
+                // ABA-problem for prev, see link_data()
+                m_Stat.onNullPrevABA();
+            }
+            else {
+                node_type * pCur = pos.pCur;
+                result = pos.pPrev->next.compare_exchange_strong( pCur, pChain, memory_model::memory_order_release, atomics::memory_order_relaxed );
+            }
+
+            // Clears data marks
+            pos.pPrev->data.store( valPrev, memory_model::memory_order_relaxed );
+            pos.pCur->data.store( valCur, memory_model::memory_order_relaxed );
+
+            if ( result ) {
+                for ( ; pFirst != pLast; ++pFirst )
+                    m_Stat.onNewNodeCreated();
+                return true;
+            }
+
+            delete_chain( pChain, pos.pCur );
+            return false;
+        }
+
+        void delete_chain( node_type * pNode, node_type * pEnd )
+        {
+            while ( pNode != pEnd ) {
+                node_type * pNext = pNode->next.load( memory_model::memory_order_relaxed );
+                delete_node( pNode );
+                pNode = pNext;
+            }
+        }
+
         // split-list support
         bool link_aux_node( node_type * pNode, insert_position& pos, node_type* pHead )
         {
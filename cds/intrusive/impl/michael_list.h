@@ -938,6 +938,101 @@ namespace cds { namespace intrusive {
             return insert_at( refHead, *node_traits::to_value_ptr( pNode ));
         }
 
+        // split-list support
+        bool unlink_aux_node( atomic_node_ptr& refHead, node_type * pNode )
+        {
+            assert( pNode != nullptr );
+
+            // The same hack as in insert_aux_node()
+            return unlink_at( refHead, *node_traits::to_value_ptr( pNode ));
+        }
+
+        // find_batch() support: prefetches the node next to \p pNode.
+        // pNode must be protected by the caller, the next node is only prefetched, not dereferenced
+        static void prefetch_next( node_type const* pNode )
+        {
+            cds_prefetch( pNode->m_pNext.load( memory_model::memory_order_relaxed ).ptr());
+        }
+
+        // find_batch() support: prefetches the first node of the list
+        void prefetch_first() const
+        {
+            cds_prefetch( m_pHead.load( memory_model::memory_order_relaxed ).ptr());
+        }
+
+        // find_batch() support: the first step of the search, prefetches the node next to the first one
+        void prefetch_second() const
+        {
+            typename gc::Guard guard;
+            marked_node_ptr pCur = guard.protect( m_pHead, []( marked_node_ptr p ) -> value_type * { return node_traits::to_value_ptr( p.ptr()); });
+            if ( pCur.ptr())
+                prefetch_next( pCur.ptr());
+        }
+
+        // bulk_load() support: inserts the items of [pFirst, pLast) sorted by the key.
+        // The items falling between two adjacent nodes of the list are linked privately and published by one CAS,
+        // so an empty list takes all items by one CAS. The items whose key is already in the list
+        // or is equal to the key of the previous item are not inserted, they are passed to fReject
+        template <typename Func>
+        size_t merge_at( atomic_node_ptr& refHead, value_type* const* pFirst, value_type* const* pLast, Func fReject )
+        {
+            position pos;
+            size_t nInserted = 0;
+
+            while ( pFirst != pLast ) {
+                if ( search( refHead, **pFirst, pos, key_comparator())) {
+                    m_Stat.onInsertFailed();
+                    fReject( **pFirst );
+                    ++pFirst;
+                    continue;
+                }
+
+                value_type* const* pEnd = chain_end( pFirst, pLast, pos.pCur );
+                if ( link_chain( pFirst, pEnd, pos )) {
+                    m_ItemCounter += static_cast<size_t>( pEnd - pFirst );
+                    nInserted += static_cast<size_t>( pEnd - pFirst );
+                    for ( ; pFirst != pEnd; ++pFirst )
+                        m_Stat.onInsertSuccess();
+                }
+                else
+                    m_Stat.onInsertRetry();
+            }
+            return nInserted;
+        }
+
+        // merge_at() support: the end of the items less than pNext without repeated keys
+        static value_type* const* chain_end( value_type* const* pFirst, value_type* const* pLast, node_type const* pNext )
+        {
+            key_comparator cmp;
+            value_type* const* pEnd = pFirst + 1;
+            while ( pEnd != pLast && cmp( *pEnd[-1], **pEnd ) != 0
+                && ( pNext == nullptr || cmp( **pEnd, *node_traits::to_value_ptr( pNext )) < 0 ))
+            {
+                ++pEnd;
+            }
+            return pEnd;
+        }
+
+        // merge_at() support: links [pFirst, pLast) privately and publishes the chain between pos.pPrev and pos.pCur
+        static bool link_chain( value_type* const* pFirst, value_type* const* pLast, position& pos )
+        {
+            marked_node_ptr pNext( pos.pCur );
+            for ( value_type* const* p = pLast; p != pFirst; ) {
+                node_type * pNode = node_traits::to_node_ptr( **--p );
+                link_checker::is_empty( pNode );
+                pNode->m_pNext.store( pNext, memory_model::memory_order_relaxed );
+                pNext = marked_node_ptr( pNode );
+            }
+
+            marked_node_ptr cur( pos.pCur );
+            if ( cds_likely( pos.pPrev->compare_exchange_strong( cur, pNext, memory_model::memory_order_release, atomics::memory_order_relaxed )))
+                return true;
+
+            for ( ; pFirst != pLast; ++pFirst )
+                node_traits::to_node_ptr( **pFirst )->m_pNext.store( marked_node_ptr(), memory_model::memory_order_relaxed );
+            return false;
+        }
+
         bool insert_at( atomic_node_ptr& refHead, value_type& val )
         {
             node_type * pNode = node_traits::to_node_ptr( val );
@@ -1447,15 +1447,15 @@ namespace cds { namespace intrusive {
             return true;
         }
 
-        template <typename Func>
-        bool try_remove_at( node_type * pDel, position& pos, Func f )
+        // Logical deletion of pDel: marks pDel->next() from the top level down to level 0.
+        // Returns true if the current thread has marked level 0, i.e. the current thread owns pDel
+        bool mark_node( node_type * pDel )
         {
             assert( pDel != nullptr );
 
             marked_node_ptr pSucc;
             back_off bkoff;
 
-            // logical deletion (marking)
             for ( unsigned int nLevel = pDel->height() - 1; nLevel > 0; --nLevel ) {
                 pSucc = pDel->next( nLevel ).load( memory_model::memory_order_relaxed );
                 if ( pSucc.bits() == 0 ) {
@@ -1473,47 +1473,209 @@ namespace cds { namespace intrusive {
             marked_node_ptr p( pDel->next( 0 ).load( memory_model::memory_order_relaxed ).ptr());
             while ( true ) {
                 if ( pDel->next( 0 ).compare_exchange_strong( p, p | 1, memory_model::memory_order_release, atomics::memory_order_acquire ))
-                {
-                    f( *node_traits::to_value_ptr( pDel ));
+                    return true;
+                else if ( p.bits()) {
+                    // Another thread is deleting pDel right now
+                    m_Stat.onEraseContention();
+                    return false;
+                }
+                m_Stat.onEraseRetry();
+                bkoff();
+            }
+        }
+
+        template <typename Func>
+        bool try_remove_at( node_type * pDel, position& pos, Func f )
+        {
+            assert( pDel != nullptr );
 
-                    // Physical deletion
-                    // try fast erase
-                    p = pDel;
+            // logical deletion (marking)
+            if ( !mark_node( pDel ))
+                return false;
 
-                    for ( int nLevel = static_cast<int>( pDel->height() - 1 ); nLevel >= 0; --nLevel ) {
+            f( *node_traits::to_value_ptr( pDel ));
 
-                        pSucc = pDel->next( nLevel ).load( memory_model::memory_order_acquire );
-                        if ( pos.pPrev[nLevel]->next( nLevel ).compare_exchange_strong( p, marked_node_ptr( pSucc.ptr()),
-                            memory_model::memory_order_acq_rel, atomics::memory_order_relaxed ))
-                        {
-                            pDel->level_unlinked();
-                        }
-                        else {
-                            // Make slow erase
+            // Physical deletion
+            // try fast erase
+            marked_node_ptr p( pDel );
+            marked_node_ptr pSucc;
+
+            for ( int nLevel = static_cast<int>( pDel->height() - 1 ); nLevel >= 0; --nLevel ) {
+
+                pSucc = pDel->next( nLevel ).load( memory_model::memory_order_acquire );
+                if ( pos.pPrev[nLevel]->next( nLevel ).compare_exchange_strong( p, marked_node_ptr( pSucc.ptr()),
+                    memory_model::memory_order_acq_rel, atomics::memory_order_relaxed ))
+                {
+                    pDel->level_unlinked();
+                }
+                else {
+                    // Make slow erase
 #       ifdef CDS_DEBUG
-                            if ( find_position( *node_traits::to_value_ptr( pDel ), pos, key_comparator(), false ))
-                                assert( pDel != pos.pCur );
+                    if ( find_position( *node_traits::to_value_ptr( pDel ), pos, key_comparator(), false ))
+                        assert( pDel != pos.pCur );
 #       else
-                            find_position( *node_traits::to_value_ptr( pDel ), pos, key_comparator(), false );
+                    find_position( *node_traits::to_value_ptr( pDel ), pos, key_comparator(), false );
 #       endif
-                            m_Stat.onSlowErase();
-                            return true;
-                        }
+                    m_Stat.onSlowErase();
+                    return true;
+                }
+            }
+
+            // Fast erasing success
+            gc::retire( node_traits::to_value_ptr( pDel ), dispose_node );
+            m_Stat.onFastErase();
+            return true;
+        }
+
+        // Lindén-Jonsson delete-min: logically deletes the first live node of level 0.
+        // The node is not unlinked: the deleted nodes form a prefix of the list
+        // that is unlinked in one step by unlink_deleted_prefix().
+        // nPrefixLen returns the length of the deleted prefix that has been passed
+        template <typename Func>
+        bool delete_min_lazy( Func f, size_t& nPrefixLen )
+        {
+            // Hazard pointer array:
+            //  [0] - first node of level 0, [1], [2] - current node of the prefix
+            typename gc::template GuardArray<3> guards;
+            node_type * pHead = m_Head.head();
+
+        retry:
+            nPrefixLen = 0;
+            marked_node_ptr pFirst = guards.protect( 0, pHead->next( 0 ), gc_protect );
+
+            // head cannot be deleted
+            assert( pFirst.bits() == 0 );
+
+            node_type * pCur = pFirst.ptr();
+            unsigned int nGuard = 0;
+            while ( pCur ) {
+                marked_node_ptr pSucc = pCur->next( 0 ).load( memory_model::memory_order_acquire );
+                if ( pSucc.bits() == 0 ) {
+                    // pCur is the first live node
+                    if ( mark_node( pCur )) {
+                        f( *node_traits::to_value_ptr( pCur ));
+                        --m_ItemCounter;
+                        m_Stat.onRemoveNode( pCur->height());
+                        return true;
                     }
 
-                    // Fast erasing success
-                    gc::retire( node_traits::to_value_ptr( pDel ), dispose_node );
-                    m_Stat.onFastErase();
-                    return true;
+                    // pCur has been deleted by another thread
+                    continue;
                 }
-                else if ( p.bits()) {
-                    // Another thread is deleting pDel right now
-                    m_Stat.onEraseContention();
-                    return false;
+
+                // pCur is logically deleted so pCur->next(0) cannot be changed.
+                // pSucc is linked (thus, is not retired) while the head points to pFirst
+                if ( pSucc.ptr()) {
+                    nGuard = nGuard == 1 ? 2 : 1;
+                    guards.assign( nGuard, node_traits::to_value_ptr( pSucc.ptr()));
+                    if ( pHead->next( 0 ).load( memory_model::memory_order_acquire ).all() != pFirst.ptr())
+                        goto retry;
                 }
-                m_Stat.onEraseRetry();
-                bkoff();
+                pCur = pSucc.ptr();
+                ++nPrefixLen;
             }
+
+            // All items are logically deleted
+            return false;
+        }
+
+        // Unlinks the logically deleted prefix of the list with one CAS per level.
+        // Returns the number of nodes unlinked from level 0
+        size_t unlink_deleted_prefix()
+        {
+            // Hazard pointer array:
+            //  [0] - first node of the level, [1], [2] - current node of the prefix
+            typename gc::template GuardArray<3> guards;
+            node_type * pHead = m_Head.head();
+            size_t nUnlinked = 0;
+
+            // Top-down: a node is unlinked from level nLevel only if it is unlinked from all upper levels
+            for ( int nLevel = static_cast<int>( c_nMaxHeight - 1 ); nLevel >= 0; --nLevel ) {
+            retry:
+                marked_node_ptr pFirst = guards.protect( 0, pHead->next( nLevel ), gc_protect );
+                node_type * pLast = pFirst.ptr();
+                unsigned int nGuard = 0;
+
+                // pLast - the first node that cannot be unlinked from nLevel
+                while ( pLast ) {
+                    marked_node_ptr pSucc = pLast->next( nLevel ).load( memory_model::memory_order_acquire );
+                    if ( pSucc.bits() == 0 || !pLast->is_upper_level( nLevel ))
+                        break;
+
+                    if ( pSucc.ptr()) {
+                        nGuard = nGuard == 1 ? 2 : 1;
+                        guards.assign( nGuard, node_traits::to_value_ptr( pSucc.ptr()));
+                        if ( pHead->next( nLevel ).load( memory_model::memory_order_acquire ).all() != pFirst.ptr())
+                            goto retry;
+                    }
+                    pLast = pSucc.ptr();
+                }
+
+                if ( pLast == pFirst.ptr())
+                    continue;
+
+                marked_node_ptr p( pFirst.ptr());
+                if ( !pHead->next( nLevel ).compare_exchange_strong( p, marked_node_ptr( pLast ),
+                    memory_model::memory_order_acq_rel, atomics::memory_order_relaxed ))
+                {
+                    goto retry;
+                }
+
+                // The nodes of the prefix cannot be retired by other threads until we call level_unlinked()
+                for ( node_type * pNode = pFirst.ptr(); pNode != pLast; ) {
+                    node_type * pNext = pNode->next( nLevel ).load( memory_model::memory_order_relaxed ).ptr();
+                    if ( pNode->level_unlinked()) {
+                        gc::retire( node_traits::to_value_ptr( pNode ), dispose_node );
+                        ++nUnlinked;
+                    }
+                    pNode = pNext;
+                }
+            }
+            return nUnlinked;
+        }
+
+        // SprayList pop: a random walk starting from the head at level nHeight - 1.
+        // On each level the walk makes a random number [0 .. nJump] of forward steps and then descends.
+        // The live node of level 0 where the walk lands is removed.
+        // Returns false if the walk has landed on the head or on a deleted node
+        template <typename Random, typename Func>
+        bool spray_delete( unsigned int nHeight, unsigned int nJump, Random& rnd, Func f )
+        {
+            // Hazard pointer array:
+            //  [0], [1] - pPred, pCur
+            typename gc::template GuardArray<2> guards;
+            node_type * pPred = m_Head.head();
+            unsigned int nGuard = 0;
+
+            if ( nHeight > c_nMaxHeight )
+                nHeight = c_nMaxHeight;
+
+            for ( int nLevel = static_cast<int>( nHeight ) - 1; nLevel >= 0; --nLevel ) {
+                for ( unsigned int nStep = rnd() % ( nJump + 1 ); nStep > 0; --nStep ) {
+                    marked_node_ptr pCur = guards.protect( nGuard ^ 1, pPred->next( nLevel ), gc_protect );
+                    if ( pCur.bits()) {
+                        // pPred has been deleted
+                        return false;
+                    }
+                    if ( !pCur.ptr() || pCur->next( nLevel ).load( memory_model::memory_order_acquire ).bits())
+                        break;
+
+                    pPred = pCur.ptr();
+                    nGuard ^= 1;
+                }
+            }
+
+            if ( pPred == m_Head.head() || !mark_node( pPred ))
+                return false;
+
+            f( *node_traits::to_value_ptr( pPred ));
+            --m_ItemCounter;
+            m_Stat.onRemoveNode( pPred->height());
+
+            // Physical deletion
+            position pos;
+            find_position( *node_traits::to_value_ptr( pPred ), pos, key_comparator(), false );
+            return true;
         }
 
         enum finsd_fastpath_result {
@@ -871,6 +871,99 @@ namespace cds { namespace intrusive {
             return insert_at( pHead, *node_traits::to_value_ptr( pNode ));
         }
 
+        // find_batch() support: prefetches the node next to \p pNode.
+        // RCU should be locked, the next node is only prefetched, not dereferenced
+        static void prefetch_next( node_type const* pNode )
+        {
+            cds_prefetch( pNode->m_pNext.load( memory_model::memory_order_relaxed ).ptr());
+        }
+
+        // find_batch() support: prefetches the first node of the list
+        void prefetch_first() const
+        {
+            prefetch_next( &m_Head );
+        }
+
+        // find_batch() support: the first step of the search, prefetches the node next to the first one
+        void prefetch_second() const
+        {
+            // RCU should be locked
+            assert( gc::is_locked());
+
+            node_type const* pCur = m_Head.m_pNext.load( memory_model::memory_order_acquire ).ptr();
+            if ( pCur != &m_Tail )
+                prefetch_next( pCur );
+        }
+
+        // bulk_load() support: inserts the items of [pFirst, pLast) sorted by the key.
+        // The items falling between two adjacent nodes of the list are linked privately and published
+        // by one store under the locks of these nodes, so an empty list takes all items at once.
+        // The items whose key is already in the list or is equal to the key of the previous item
+        // are not inserted, they are passed to fReject
+        template <typename Func>
+        size_t merge_at( node_type * pHead, value_type* const* pFirst, value_type* const* pLast, Func fReject )
+        {
+            position pos;
+            key_comparator  cmp;
+            size_t nInserted = 0;
+
+            rcu_lock l;
+            while ( pFirst != pLast ) {
+                search( pHead, **pFirst, pos );
+                {
+                    scoped_position_lock sl( pos );
+                    if ( validate( pos.pPred, pos.pCur )) {
+                        if ( pos.pCur != &m_Tail && cmp( *node_traits::to_value_ptr( *pos.pCur ), **pFirst ) == 0 ) {
+                            // failed: key already in list
+                            m_Stat.onInsertFailed();
+                            fReject( **pFirst );
+                            ++pFirst;
+                            continue;
+                        }
+
+                        value_type* const* pEnd = chain_end( pFirst, pLast, pos.pCur );
+                        link_chain( pFirst, pEnd, pos.pPred, pos.pCur );
+                        m_ItemCounter += static_cast<size_t>( pEnd - pFirst );
+                        nInserted += static_cast<size_t>( pEnd - pFirst );
+                        for ( ; pFirst != pEnd; ++pFirst )
+                            m_Stat.onInsertSuccess();
+                        continue;
+                    }
+                }
+
+                m_Stat.onInsertRetry();
+            }
+            return nInserted;
+        }
+
+        // merge_at() support: the end of the items less than pNext without repeated keys
+        value_type* const* chain_end( value_type* const* pFirst, value_type* const* pLast, node_type const* pNext ) const
+        {
+            key_comparator cmp;
+            value_type* const* pEnd = pFirst + 1;
+            while ( pEnd != pLast && cmp( *pEnd[-1], **pEnd ) != 0
+                && ( pNext == &m_Tail || cmp( **pEnd, *node_traits::to_value_ptr( pNext )) < 0 ))
+            {
+                ++pEnd;
+            }
+            return pEnd;
+        }
+
+        // merge_at() support: links [pFirst, pLast) privately and publishes the chain between locked pPred and pCur
+        static void link_chain( value_type* const* pFirst, value_type* const* pLast, node_type * pPred, node_type * pCur )
+        {
+            assert( pPred->m_pNext.load( memory_model::memory_order_relaxed ).ptr() == pCur );
+
+            node_type * pNext = pCur;
+            for ( value_type* const* p = pLast; p != pFirst; ) {
+                node_type * pNode = node_traits::to_node_ptr( **--p );
+                link_checker::is_empty( pNode );
+                pNode->m_pNext.store( marked_node_ptr( pNext ), memory_model::memory_order_relaxed );
+                pNext = pNode;
+            }
+            pPred->m_pNext.store( marked_node_ptr( pNext ), memory_model::memory_order_release );
+        }
+
         bool insert_at( node_type * pHead, value_type& val )
         {
             rcu_lock l;
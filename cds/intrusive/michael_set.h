@@ -388,6 +388,23 @@ namespace cds { namespace intrusive {
             return bRet;
         }
 
+        /// Inserts new node with precomputed hash value
+        /** \anchor cds_intrusive_MichaelHashSet_hp_insert_with_hash
+            The function is an analog of \p insert( value_type& ) but \p nHash is used as the hash value of \p val
+            instead of calling the hash functor. It is useful when the key is hashed once and then looked up in several sets.
+
+            \p nHash must be equal to the value of the set's hash functor for \p val; in debug mode it is checked by an assertion.
+            The same requirement is for all \p %_with_hash functions.
+        */
+        bool insert_with_hash( value_type& val, size_t nHash )
+        {
+            check_hash( val, nHash );
+            bool bRet = bucket_by_hash( nHash ).insert( val );
+            if ( bRet )
+                ++m_ItemCounter;
+            return bRet;
+        }
+
         /// Inserts new node
         /**
             This function is intended for derived non-intrusive containers.
@@ -418,6 +435,21 @@ namespace cds { namespace intrusive {
             return bRet;
         }
 
+        /// Inserts new node with precomputed hash value
+        /**
+            The function is an analog of \p insert( value_type&, Func ) but \p nHash is used as the hash value of \p val,
+            see \ref cds_intrusive_MichaelHashSet_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Func>
+        bool insert_with_hash( value_type& val, size_t nHash, Func f )
+        {
+            check_hash( val, nHash );
+            bool bRet = bucket_by_hash( nHash ).insert( val, f );
+            if ( bRet )
+                ++m_ItemCounter;
+            return bRet;
+        }
+
         /// Updates the element
         /**
             The operation performs inserting or changing data with lock-free manner.
@@ -474,6 +506,21 @@ namespace cds { namespace intrusive {
         }
         //@endcond
 
+        /// Updates the element with precomputed hash value
+        /**
+            The function is an analog of \p update() but \p nHash is used as the hash value of \p val,
+            see \ref cds_intrusive_MichaelHashSet_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Func>
+        std::pair<bool, bool> update_with_hash( value_type& val, size_t nHash, Func func, bool bAllowInsert = true )
+        {
+            check_hash( val, nHash );
+            std::pair<bool, bool> bRet = bucket_by_hash( nHash ).update( val, func, bAllowInsert );
+            if ( bRet.second )
+                ++m_ItemCounter;
+            return bRet;
+        }
+
         /// Inserts or updates the node (only for \p IterableList)
         /**
             The operation performs inserting or changing data with lock-free manner.
@@ -536,6 +583,23 @@ namespace cds { namespace intrusive {
             return false;
         }
 
+        /// Deletes the item from the set using precomputed hash value of \p key
+        /**
+            The function is an analog of \ref cds_intrusive_MichaelHashSet_hp_erase "erase(Q const&)"
+            but \p nHash is used as the hash value of \p key,
+            see \ref cds_intrusive_MichaelHashSet_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q>
+        bool erase_with_hash( Q const& key, size_t nHash )
+        {
+            check_hash( key, nHash );
+            if ( bucket_by_hash( nHash ).erase( key )) {
+                --m_ItemCounter;
+                return true;
+            }
+            return false;
+        }
+
         /// Deletes the item from the set using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_intrusive_MichaelHashSet_hp_erase "erase(Q const&)"
@@ -581,6 +645,22 @@ namespace cds { namespace intrusive {
             return false;
         }
 
+        /// Deletes the item from the set using precomputed hash value of \p key
+        /**
+            The function is an analog of \ref cds_intrusive_MichaelHashSet_hp_erase_func "erase(Q const&, Func)"
+            but \p nHash is used as the hash value of \p key.
+        */
+        template <typename Q, typename Func>
+        bool erase_with_hash( Q const& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            if ( bucket_by_hash( nHash ).erase( key, f )) {
+                --m_ItemCounter;
+                return true;
+            }
+            return false;
+        }
+
         /// Deletes the item from the set using \p pred predicate for searching
         /**
             The function is an analog of \ref cds_intrusive_MichaelHashSet_hp_erase_func "erase(Q const&, Func)"
@@ -717,6 +797,27 @@ namespace cds { namespace intrusive {
         }
         //@endcond
 
+        /// Finds the key \p key using precomputed hash value
+        /**
+            The function is an analog of \ref cds_intrusive_MichaelHashSet_hp_find_func "find(Q&, Func)"
+            but \p nHash is used as the hash value of \p key,
+            see \ref cds_intrusive_MichaelHashSet_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        bool find_with_hash( Q& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            return bucket_by_hash( nHash ).find( key, f );
+        }
+        //@cond
+        template <typename Q, typename Func>
+        bool find_with_hash( Q const& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            return bucket_by_hash( nHash ).find( key, f );
+        }
+        //@endcond
+
         /// Finds \p key and returns iterator pointed to the item found (only for \p IterableList)
         /**
             If \p key is not found the function returns \p end().
@@ -823,6 +924,18 @@ namespace cds { namespace intrusive {
             return bucket( key ).contains( key );
         }
 
+        /// Checks whether the set contains \p key using precomputed hash value
+        /**
+            The function is an analog of <tt>contains( key )</tt> but \p nHash is used as the hash value of \p key,
+            see \ref cds_intrusive_MichaelHashSet_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q>
+        bool contains_with_hash( Q const& key, size_t nHash )
+        {
+            check_hash( key, nHash );
+            return bucket_by_hash( nHash ).contains( key );
+        }
+
         /// Checks whether the set contains \p key using \p pred predicate for searching
         /**
             The function is an analog of <tt>contains( key )</tt> but \p pred is used for key comparing.
@@ -976,12 +1089,27 @@ namespace cds { namespace intrusive {
             return m_HashFunctor( key ) & m_nHashBitmask;
         }
 
+        /// Checks (in debug mode only) that \p nHash passed to \p %_with_hash function is the hash value of \p key
+        template <typename Q>
+        void check_hash( Q const& key, size_t nHash ) const
+        {
+            assert( m_HashFunctor( key ) == nHash );
+            CDS_UNUSED( key );
+            CDS_UNUSED( nHash );
+        }
+
         /// Returns the bucket (ordered list) for \p key
         template <typename Q>
         internal_bucket_type& bucket( const Q& key )
         {
             return m_Buckets[hash_value( key )];
         }
+
+        /// Returns the bucket (ordered list) for precomputed hash value \p nHash
+        internal_bucket_type& bucket_by_hash( size_t nHash )
+        {
+            return m_Buckets[nHash & m_nHashBitmask];
+        }
         //@endcond
     };
 
@@ -7,6 +7,7 @@
 #define CDSLIB_INTRUSIVE_MSPRIORITY_QUEUE_H
 
 #include <mutex>  // std::unique_lock
+#include <type_traits>
 #include <cds/intrusive/details/base.h>
 #include <cds/sync/spinlock.h>
 #include <cds/os/thread.h>
@@ -15,6 +16,9 @@
 #include <cds/opt/buffer.h>
 #include <cds/opt/compare.h>
 #include <cds/details/bounded_container.h>
+#include <cds/details/aligned_allocator.h>
+#include <cds/os/alloc_aligned.h>
+#include <cds/algo/int_algo.h>
 
 namespace cds { namespace intrusive {
 
@@ -37,6 +41,7 @@ namespace cds { namespace intrusive {
             event_counter   m_nItemMovedTop;         ///< Count of events when \p push() encountered that inserted item was moved to top by a concurrent \p pop()
             event_counter   m_nItemMovedUp;          ///< Count of events when \p push() encountered that inserted item was moved upwards by a concurrent \p pop()
             event_counter   m_nPushEmptyPass;        ///< Count of empty pass during heapify via concurrent operations
+            event_counter   m_nHeapGrowCount;        ///< Count of heap array growing (for \p growable_buffer only)
 
             //@cond
             void onPushSuccess()            { ++m_nPushCount            ;}
@@ -49,6 +54,7 @@ namespace cds { namespace intrusive {
             void onItemMovedTop()           { ++m_nItemMovedTop         ;}
             void onItemMovedUp()            { ++m_nItemMovedUp          ;}
             void onPushEmptyPass()          { ++m_nPushEmptyPass        ;}
+            void onHeapGrow()               { ++m_nHeapGrowCount        ;}
             //@endcond
         };
 
@@ -65,9 +71,213 @@ namespace cds { namespace intrusive {
             void onItemMovedTop()           const {}
             void onItemMovedUp()            const {}
             void onPushEmptyPass()          const {}
+            void onHeapGrow()               const {}
             //@endcond
         };
 
+        /// Option setter: the arity of the heap
+        /**
+            \p Arity is the number of children of a heap node, it should be a power of two.
+            The binary heap (\p Arity = 2) is the default.
+
+            For \p Arity greater than 2 the heap node is padded to a power of two size,
+            and the children of a node are placed in a contiguous group aligned to \p Arity * <tt>sizeof( node )</tt>
+            in the heap array. So, if the heap array is aligned to the cache line (as \p growable_buffer does),
+            the group of siblings starts on cache line boundary and \p pop() reads it as a whole.
+            The 4-ary heap has half the depth of the binary heap, the 8-ary heap - one third.
+
+            The "bit-reversal" insertion order is applicable to the binary heap only,
+            the d-ary heap fills the bottom level sequentially.
+        */
+        template <unsigned int Arity>
+        struct arity {
+            //@cond
+            template <class Base> struct pack: public Base
+            {
+                static constexpr const unsigned int arity = Arity;
+            };
+            //@endcond
+        };
+
+        /// Growable buffer for the heap array
+        /**
+            One of available type for \p opt::buffer option of \p MSPriorityQueue.
+
+            The buffer is a list of segments: the first segment has \p nInitialCapacity items
+            (rounded up to a power of two), each next segment doubles the capacity of the buffer.
+            The segments are not moved or freed until the buffer is destroyed, so the references to the heap nodes
+            remain valid while the buffer grows. When the heap is full, \p MSPriorityQueue::push() appends
+            a new segment under the heap's size lock; the concurrent heapify passes are not blocked.
+            Thus, the queue with \p %growable_buffer is unbounded.
+
+            Each segment is aligned to the cache line.
+
+            Template parameters:
+            - \p T - item type; the queue rebinds it to the heap node type
+            - \p Alloc - aligned allocator. Default is \p CDS_DEFAULT_ALIGNED_ALLOCATOR
+        */
+        template <typename T, class Alloc = CDS_DEFAULT_ALIGNED_ALLOCATOR>
+        class growable_buffer
+        {
+        public:
+            typedef T     value_type;   ///< Value type
+            typedef Alloc allocator;    ///< Aligned allocator type
+
+            /// Rebind buffer for other template parameters
+            template <typename Q, typename Alloc2 = allocator>
+            struct rebind {
+                typedef growable_buffer<Q, Alloc2> other;   ///< Rebinding result type
+            };
+
+        private:
+            //@cond
+            typedef cds::details::AlignedAllocator< value_type, allocator > cxx_allocator;
+            static constexpr const size_t c_nMaxSegmentCount = sizeof( size_t ) * 8;
+
+            atomics::atomic<size_t>         m_nCapacity;
+            size_t const                    m_nFirstSegmentLog2;
+            size_t                          m_nSegmentCount;
+            atomics::atomic<value_type *>   m_arrSegment[c_nMaxSegmentCount];
+            //@endcond
+
+        public:
+            /// Allocates the first segment of \p nInitialCapacity items rounded up to a power of two
+            explicit growable_buffer( size_t nInitialCapacity )
+                : m_nCapacity( beans::ceil2( nInitialCapacity < 2 ? 2 : nInitialCapacity ))
+                , m_nFirstSegmentLog2( beans::log2floor( m_nCapacity.load( atomics::memory_order_relaxed )))
+                , m_nSegmentCount( 1 )
+            {
+                m_arrSegment[0].store( cxx_allocator().NewArray( c_nCacheLineSize, capacity()), atomics::memory_order_relaxed );
+                for ( size_t i = 1; i < c_nMaxSegmentCount; ++i )
+                    m_arrSegment[i].store( nullptr, atomics::memory_order_relaxed );
+            }
+
+            /// Destroys the buffer
+            ~growable_buffer()
+            {
+                for ( size_t i = 0; i < m_nSegmentCount; ++i )
+                    cxx_allocator().Delete( m_arrSegment[i].load( atomics::memory_order_relaxed ), segment_size( i ));
+            }
+
+            growable_buffer( const growable_buffer& ) = delete;
+            growable_buffer& operator =( const growable_buffer& ) = delete;
+
+            /// Get item \p i
+            value_type& operator []( size_t i )
+            {
+                return *item( i );
+            }
+
+            /// Get item \p i, const version
+            const value_type& operator []( size_t i ) const
+            {
+                return *item( i );
+            }
+
+            /// Returns current buffer capacity
+            size_t capacity() const noexcept
+            {
+                return m_nCapacity.load( atomics::memory_order_acquire );
+            }
+
+            /// Doubles the capacity of the buffer
+            /**
+                The function appends new segment to the buffer. It can be called concurrently with \p operator[],
+                but the calls of \p %grow() should be serialized by the caller.
+
+                Returns \p false if the buffer cannot grow anymore.
+            */
+            bool grow()
+            {
+                if ( m_nFirstSegmentLog2 + m_nSegmentCount >= c_nMaxSegmentCount )
+                    return false;
+
+                size_t const nSize = segment_size( m_nSegmentCount );
+                m_arrSegment[m_nSegmentCount].store( cxx_allocator().NewArray( c_nCacheLineSize, nSize ), atomics::memory_order_release );
+                ++m_nSegmentCount;
+                m_nCapacity.store( nSize * 2, atomics::memory_order_release );
+                return true;
+            }
+
+        private:
+            //@cond
+            size_t segment_size( size_t nSegment ) const
+            {
+                // segment 0 contains items [0, 2**m), segment k > 0 - items [2**(m+k-1), 2**(m+k))
+                return size_t( 1 ) << ( nSegment ? m_nFirstSegmentLog2 + nSegment - 1 : m_nFirstSegmentLog2 );
+            }
+
+            value_type * item( size_t i ) const
+            {
+                assert( i < capacity());
+                if ( i < ( size_t( 1 ) << m_nFirstSegmentLog2 ))
+                    return m_arrSegment[0].load( atomics::memory_order_relaxed ) + i;
+
+                size_t const nLog2 = beans::log2floor( i );
+                return m_arrSegment[nLog2 - m_nFirstSegmentLog2 + 1].load( atomics::memory_order_acquire ) + ( i - ( size_t( 1 ) << nLog2 ));
+            }
+            //@endcond
+        };
+
+        //@cond
+        namespace details {
+            // Sequential item counter for d-ary heap, the interface is the same as cds::bitop::bit_reverse_counter
+            template <typename Counter = size_t>
+            class sequential_counter
+            {
+            public:
+                typedef Counter counter_type;
+
+            private:
+                counter_type m_nCounter;
+
+            public:
+                sequential_counter()
+                    : m_nCounter( 0 )
+                {}
+
+                counter_type inc()
+                {
+                    return ++m_nCounter;
+                }
+
+                counter_type dec()
+                {
+                    return m_nCounter--;
+                }
+
+                counter_type value() const
+                {
+                    return m_nCounter;
+                }
+            };
+
+            template <typename Buffer>
+            struct is_growable_buffer
+            {
+                template <typename B> static std::true_type test( decltype( std::declval<B&>().grow()) * );
+                template <typename B> static std::false_type test( ... );
+
+                static constexpr const bool value = decltype( test<Buffer>( nullptr ))::value;
+            };
+
+            constexpr size_t ceil2_size( size_t n, size_t nPow2 = 1 )
+            {
+                return nPow2 >= n ? nPow2 : ceil2_size( n, nPow2 * 2 );
+            }
+
+            template <size_t PadSize>
+            struct node_padding
+            {
+                char pad_[PadSize];
+            };
+
+            template <>
+            struct node_padding<0>
+            {};
+        } // namespace details
+        //@endcond
+
         /// MSPriorityQueue traits
         struct traits {
             /// Storage type
@@ -104,15 +314,19 @@ namespace cds { namespace intrusive {
                 or any other with interface like \p %mspriority_queue::stat
             */
             typedef empty_stat      stat;
+
+            /// The arity of the heap, see \p mspriority_queue::arity option. Default is 2 (binary heap)
+            static constexpr const unsigned int arity = 2;
         };
 
         /// Metafunction converting option list to traits
         /**
             \p Options:
-            - \p opt::buffer - the buffer type for heap array. Possible type are: \p opt::v::initialized_static_buffer, \p opt::v::initialized_dynamic_buffer.
-                Default is \p %opt::v::initialized_dynamic_buffer.
+            - \p opt::buffer - the buffer type for heap array. Possible type are: \p opt::v::initialized_static_buffer, \p opt::v::initialized_dynamic_buffer,
+                \p mspriority_queue::growable_buffer. Default is \p %opt::v::initialized_dynamic_buffer.
                 You may specify any type of value for the buffer since at instantiation time
                 the \p buffer::rebind member metafunction is called to change the type of values stored in the buffer.
+            - \p mspriority_queue::arity - the arity of the heap. Default is 2.
             - \p opt::compare - priority compare functor. No default functor is provided.
                 If the option is not specified, the \p opt::less is used.
             - \p opt::less - specifies binary predicate used for priority compare. Default is \p std::less<T>.
@@ -154,6 +368,11 @@ namespace cds { namespace intrusive {
         workloads. For small heaps it still performs well, but not as well as
         single-lock algorithm.
 
+        The queue is bounded by the capacity of the heap array unless \p mspriority_queue::growable_buffer
+        is used as \p opt::buffer. With the growable buffer the heap array is extended by segments when it is full.
+
+        The heap may be d-ary instead of binary, see \p mspriority_queue::arity option.
+
         Template parameters:
         - \p T - type to be stored in the queue. The priority is a part of \p T type.
         - \p Traits - type traits. See \p mspriority_queue::traits for explanation.
@@ -176,7 +395,18 @@ namespace cds { namespace intrusive {
         typedef typename traits::lock_type      lock_type;   ///< heap's size lock type
         typedef typename traits::back_off       back_off;    ///< Back-off strategy
         typedef typename traits::stat           stat;        ///< internal statistics type, see \p mspriority_queue::traits::stat
-        typedef typename cds::bitop::bit_reverse_counter<> item_counter;///< Item counter type
+
+        static constexpr const unsigned int c_nArity = traits::arity;   ///< The arity of the heap
+        static_assert( c_nArity >= 2 && ( c_nArity & ( c_nArity - 1 )) == 0, "The arity of the heap must be a power of two" );
+
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined item_counter;    ///< Item counter type
+#   else
+        typedef typename std::conditional< c_nArity == 2,
+            cds::bitop::bit_reverse_counter<>,
+            mspriority_queue::details::sequential_counter<>
+        >::type item_counter;
+#   endif
 
     protected:
         //@cond
@@ -213,10 +443,21 @@ namespace cds { namespace intrusive {
                 m_Lock.unlock();
             }
         };
+
+        /// Heap item padded to a power of two size for d-ary heap
+        struct padded_node: public node, public mspriority_queue::details::node_padding< mspriority_queue::details::ceil2_size( sizeof( node )) - sizeof( node )>
+        {};
+
+        typedef typename std::conditional< c_nArity == 2, node, padded_node >::type heap_node;
+
+        // Position of the root in the heap array.
+        // The children of position p are [c_nArity * (p - c_nRoot + 1), c_nArity * (p - c_nRoot + 2)),
+        // so each group of siblings starts on c_nArity boundary
+        static constexpr const size_t c_nRoot = c_nArity - 1;
         //@endcond
 
     public:
-        typedef typename traits::buffer::template rebind<node>::other   buffer_type ;   ///< Heap array buffer type
+        typedef typename traits::buffer::template rebind<heap_node>::other   buffer_type ;   ///< Heap array buffer type
 
         //@cond
         typedef typename item_counter::counter_type    counter_type;
@@ -234,7 +475,7 @@ namespace cds { namespace intrusive {
             For \p cds::opt::v::initialized_static_buffer the \p nCapacity parameter is ignored.
         */
         MSPriorityQueue( size_t nCapacity )
-            : m_Heap( nCapacity )
+            : m_Heap( c_nArity > 2 && nCapacity < c_nArity * 2 ? c_nArity * 2 : nCapacity )
         {}
 
         /// Clears priority queue and destructs the object
@@ -246,7 +487,8 @@ namespace cds { namespace intrusive {
         /// Inserts a item into priority queue
         /**
             If the priority queue is full, the function returns \p false,
-            no item has been added.
+            no item has been added. If the heap array is \p mspriority_queue::growable_buffer,
+            the full heap is extended instead.
             Otherwise, the function inserts the pointer to \p val into the heap
             and returns \p true.
 
@@ -257,20 +499,20 @@ namespace cds { namespace intrusive {
             tag_type const curId = cds::OS::get_current_thread_id();
 
             // Insert new item at bottom of the heap
-            m_Lock.lock();
-            if ( m_ItemCounter.value() >= capacity()) {
+            std::unique_lock<lock_type> l( m_Lock );
+            if ( m_ItemCounter.value() >= capacity() && !grow()) {
                 // the heap is full
-                m_Lock.unlock();
+                l.unlock();
                 m_Stat.onPushFailed();
                 return false;
             }
 
-            counter_type i = m_ItemCounter.inc();
+            counter_type i = position( m_ItemCounter.inc());
             assert( i < m_Heap.capacity());
 
             node& refNode = m_Heap[i];
             refNode.lock();
-            m_Lock.unlock();
+            l.unlock();
             assert( refNode.m_nTag == tag_type( Empty ));
             assert( refNode.m_pVal == nullptr );
             refNode.m_pVal = &val;
@@ -291,7 +533,7 @@ namespace cds { namespace intrusive {
         */
         value_type * pop()
         {
-            node& refTop = m_Heap[1];
+            node& refTop = m_Heap[c_nRoot];
 
             m_Lock.lock();
             if ( m_ItemCounter.value() == 0 ) {
@@ -300,12 +542,12 @@ namespace cds { namespace intrusive {
                 m_Stat.onPopFailed();
                 return nullptr;
             }
-            counter_type nBottom = m_ItemCounter.dec();
+            counter_type nBottom = position( m_ItemCounter.dec());
             assert( nBottom < m_Heap.capacity());
-            assert( nBottom > 0 );
+            assert( nBottom >= c_nRoot );
 
             refTop.lock();
-            if ( nBottom == 1 ) {
+            if ( nBottom == c_nRoot ) {
                 refTop.m_nTag = tag_type( Empty );
                 value_type * pVal = refTop.m_pVal;
                 refTop.m_pVal = nullptr;
@@ -391,10 +633,13 @@ namespace cds { namespace intrusive {
         }
 
         /// Return capacity of the priority queue
+        /**
+            For \p mspriority_queue::growable_buffer it is the current capacity of the heap array.
+        */
         size_t capacity() const
         {
-            // m_Heap[0] is not used
-            return m_Heap.capacity() - 1;
+            // m_Heap[0 .. c_nRoot - 1] is not used
+            return m_Heap.capacity() - c_nRoot;
         }
 
         /// Returns const reference to internal statistics
@@ -405,6 +650,40 @@ namespace cds { namespace intrusive {
 
     protected:
         //@cond
+        // Converts 1-based item number to the position in the heap array
+        static counter_type position( counter_type nItem )
+        {
+            return nItem + c_nRoot - 1;
+        }
+
+        static counter_type parent( counter_type nPos )
+        {
+            return nPos / c_nArity + c_nRoot - 1;
+        }
+
+        static counter_type first_child( counter_type nPos )
+        {
+            return ( nPos - c_nRoot + 1 ) * c_nArity;
+        }
+
+        bool grow()
+        {
+            return grow( std::integral_constant< bool, mspriority_queue::details::is_growable_buffer< buffer_type >::value >());
+        }
+
+        bool grow( std::true_type )
+        {
+            if ( m_Heap.grow()) {
+                m_Stat.onHeapGrow();
+                return true;
+            }
+            return false;
+        }
+
+        bool grow( std::false_type )
+        {
+            return false;
+        }
 
         void heapify_after_push( counter_type i, tag_type curId )
         {
@@ -412,9 +691,9 @@ namespace cds { namespace intrusive {
             back_off        bkoff;
 
             // Move item towards top of the heap while it has higher priority than parent
-            while ( i > 1 ) {
+            while ( i > c_nRoot ) {
                 bool bProgress = true;
-                counter_type nParent = i / 2;
+                counter_type nParent = parent( i );
                 node& refParent = m_Heap[nParent];
                 refParent.lock();
                 node& refItem = m_Heap[i];
@@ -454,7 +733,7 @@ namespace cds { namespace intrusive {
                     bkoff.reset();
             }
 
-            if ( i == 1 ) {
+            if ( i == c_nRoot ) {
                 node& refItem = m_Heap[i];
                 refItem.lock();
                 if ( refItem.m_nTag == curId )
@@ -466,10 +745,8 @@ namespace cds { namespace intrusive {
         void heapify_after_pop( node * pParent )
         {
             key_comparator cmp;
-            counter_type const nCapacity = m_Heap.capacity();
 
-            counter_type nParent = 1;
-            for ( counter_type nChild = nParent * 2; nChild < nCapacity; nChild *= 2 ) {
+            for ( counter_type nChild = first_child( c_nRoot ); nChild < m_Heap.capacity(); nChild = first_child( nChild )) {
                 node* pChild = &m_Heap[ nChild ];
                 pChild->lock();
 
@@ -478,19 +755,19 @@ namespace cds { namespace intrusive {
                     break;
                 }
 
-                counter_type const nRight = nChild + 1;
-                if ( nRight < nCapacity ) {
-                    node& refRight = m_Heap[nRight];
-                    refRight.lock();
+                // Select the child with highest priority, the siblings are locked from left to right
+                counter_type const nLast = nChild + c_nArity;
+                for ( counter_type nSibling = nChild + 1; nSibling < nLast && nSibling < m_Heap.capacity(); ++nSibling ) {
+                    node& refSibling = m_Heap[nSibling];
+                    refSibling.lock();
 
-                    if ( refRight.m_nTag != tag_type( Empty ) && cmp( *refRight.m_pVal, *pChild->m_pVal ) > 0 ) {
-                        // get right child
+                    if ( refSibling.m_nTag != tag_type( Empty ) && cmp( *refSibling.m_pVal, *pChild->m_pVal ) > 0 ) {
                         pChild->unlock();
-                        nChild = nRight;
-                        pChild = &refRight;
+                        nChild = nSibling;
+                        pChild = &refSibling;
                     }
                     else
-                        refRight.unlock();
+                        refSibling.unlock();
                 }
 
                 // If child has higher priority than parent then swap
@@ -500,7 +777,6 @@ namespace cds { namespace intrusive {
                     std::swap( pParent->m_pVal, pChild->m_pVal );
                     pParent->unlock();
                     m_Stat.onPopHeapifySwap();
-                    nParent = nChild;
                     pParent = pChild;
                 }
                 else {
@@ -43,7 +43,17 @@ namespace cds { namespace intrusive {
             counter_type    m_nSegmentCreated;  ///< Number of created segments
             counter_type    m_nSegmentDeleted;  ///< Number of deleted segments
 
+            counter_type    m_nPushFirstProbe;  ///< Number of pushes succeeded at first probed cell (thread-affine hit)
+            counter_type    m_nPopFirstProbe;   ///< Number of pops succeeded at first probed cell (thread-affine hit)
+            counter_type    m_nSegmentGrow;     ///< Number of segment size increases (adaptive mode only)
+            counter_type    m_nSegmentShrink;   ///< Number of segment size decreases (adaptive mode only)
+            atomics::atomic<size_t> m_nMaxQuasiFactor;  ///< Max size of allocated segment (gauge). The queue violates FIFO order no more than <tt>m_nMaxQuasiFactor - 1</tt> positions
+
             //@cond
+            stat()
+                : m_nMaxQuasiFactor( 0 )
+            {}
+
             void onPush()               { ++m_nPush; }
             void onPushPopulated()      { ++m_nPushPopulated; }
             void onPushContended()      { ++m_nPushContended; }
@@ -54,6 +64,16 @@ namespace cds { namespace intrusive {
             void onDeleteSegmentReq()   { ++m_nDeleteSegmentReq; }
             void onSegmentCreated()     { ++m_nSegmentCreated; }
             void onSegmentDeleted()     { ++m_nSegmentDeleted; }
+            void onPushFirstProbe()     { ++m_nPushFirstProbe; }
+            void onPopFirstProbe()      { ++m_nPopFirstProbe; }
+            void onSegmentGrow()        { ++m_nSegmentGrow; }
+            void onSegmentShrink()      { ++m_nSegmentShrink; }
+            void onSegmentSize( size_t nSize )
+            {
+                // called under segment list lock
+                if ( nSize > m_nMaxQuasiFactor.load( atomics::memory_order_relaxed ))
+                    m_nMaxQuasiFactor.store( nSize, atomics::memory_order_relaxed );
+            }
             //@endcond
         };
 
@@ -70,6 +90,11 @@ namespace cds { namespace intrusive {
             void onDeleteSegmentReq() const {}
             void onSegmentCreated() const   {}
             void onSegmentDeleted() const   {}
+            void onPushFirstProbe() const   {}
+            void onPopFirstProbe() const    {}
+            void onSegmentGrow() const      {}
+            void onSegmentShrink() const    {}
+            void onSegmentSize( size_t ) const {}
             //@endcond
         };
 
@@ -111,6 +136,11 @@ namespace cds { namespace intrusive {
             typedef cds::sync::spin lock_type;
 
             /// Random \ref cds::opt::permutation_generator "permutation generator" for sequence [0, quasi_factor)
+            /**
+                \p cds::opt::v::thread_affine_permutation makes each thread to start probing the segment
+                from its own range of cells, that turns the queue to k-FIFO queue with low contention
+                on the cells.
+            */
             typedef cds::opt::v::random2_permutation<int>    permutation_generator;
         };
 
@@ -140,7 +170,8 @@ namespace cds { namespace intrusive {
             - \p opt::lock_type - a mutual exclusion lock type used to maintain internal list of allocated
                 segments. Default is \p cds::opt::Spin, \p std::mutex is also suitable.
             - \p opt::permutation_generator - a random permutation generator for sequence [0, quasi_factor),
-                default is \p cds::opt::v::random2_permutation<int>
+                default is \p cds::opt::v::random2_permutation<int>. \p cds::opt::v::thread_affine_permutation<int>
+                is the thread-affine alternative.
         */
         template <typename... Options>
         struct make_traits {
@@ -189,6 +220,22 @@ namespace cds { namespace intrusive {
         The segmented queue is an <i>unfair</i> queue since it violates the strong FIFO order but no more than
         quasi factor. This means that the consumer dequeues <i>any</i> item from the current first segment.
 
+        <b>Relaxed k-FIFO mode</b>
+
+        The queue can be tuned as k-FIFO queue, see
+        - [2013] Kirsch, Lippautz, Payer "Fast and Scalable, Lock-free k-FIFO Queues"
+
+        With \p cds::opt::v::thread_affine_permutation as \p opt::permutation_generator each thread
+        probes the segment starting from its own "home" cell, so the threads mostly do not compete for the same cells.
+        The rate of the operations succeeded at the first probe is reported by \p segmented_queue::stat
+        (\p m_nPushFirstProbe, \p m_nPopFirstProbe).
+
+        If the queue is constructed by <tt>SegmentedQueue( nMinQuasiFactor, nMaxQuasiFactor )</tt>, the segment
+        size is adaptive: when the tail segment is filled up, the number of failed CAS on the segment is checked.
+        High contention doubles the size of the next segment up to \p nMaxQuasiFactor; low contention on two successive
+        segments halves it down to \p nMinQuasiFactor. The FIFO order is violated no more than
+        <tt>max_quasi_factor() - 1</tt> positions; the actual bound is \p stat::m_nMaxQuasiFactor.
+
         Template parameters:
         - \p GC - a garbage collector, possible types are cds::gc::HP, cds::gc::DHP
         - \p T - the type of values stored in the queue
@@ -226,8 +273,10 @@ namespace cds { namespace intrusive {
         // Segment
         struct segment: public boost::intrusive::slist_base_hook<>
         {
-            cell * cells;    // Cell array of size \ref m_nQuasiFactor
+            cell * cells;    // Cell array of size \ref cell_count
             size_t version;  // version tag (ABA prevention tag)
+            size_t const cell_count;    // segment size, a power of 2
+            atomics::atomic<size_t> contention; // number of failed CAS on the segment cells
             // cell array is placed here in one continuous memory block
 
             // Initializes the segment
@@ -235,6 +284,8 @@ namespace cds { namespace intrusive {
                 // MSVC warning C4355: 'this': used in base member initializer list
                 : cells( reinterpret_cast< cell *>( this + 1 ))
                 , version( 0 )
+                , cell_count( nCellCount )
+                , contention( 0 )
             {
                 init( nCellCount );
             }
@@ -265,9 +316,21 @@ namespace cds { namespace intrusive {
 
             list_impl           m_List;
             mutable lock_type   m_Lock;
-            size_t const        m_nQuasiFactor;
+            atomics::atomic<size_t> m_nQuasiFactor;     // size of next segment
+            size_t const        m_nMinQuasiFactor;
+            size_t const        m_nMaxQuasiFactor;
+            unsigned            m_nLowContention;       // count of successive low-contended segments, guarded by m_Lock
             stat&               m_Stat;
 
+            // Adaptive segment size thresholds: the segment of size N is
+            // highly contended if it has more than N / c_nGrowRatio failed CAS,
+            // and low contended if it has less than N / c_nShrinkRatio failed CAS.
+            // The tests are written in multiplied form since N / c_nShrinkRatio is 0 for small segments
+            static constexpr size_t const c_nGrowRatio = 8;
+            static constexpr size_t const c_nShrinkRatio = 64;
+            // Hysteresis: number of successive low contended segments to shrink the segment size
+            static constexpr unsigned const c_nShrinkThreshold = 2;
+
         private:
             struct segment_disposer
             {
@@ -288,13 +351,18 @@ namespace cds { namespace intrusive {
             };
 
         public:
-            segment_list( size_t nQuasiFactor, stat& st )
+            segment_list( size_t nMinQuasiFactor, size_t nMaxQuasiFactor, stat& st )
                 : m_pHead( nullptr )
                 , m_pTail( nullptr )
-                , m_nQuasiFactor( nQuasiFactor )
+                , m_nQuasiFactor( nMinQuasiFactor )
+                , m_nMinQuasiFactor( nMinQuasiFactor )
+                , m_nMaxQuasiFactor( nMaxQuasiFactor )
+                , m_nLowContention( 0 )
                 , m_Stat( st )
             {
-                assert( cds::beans::is_power2( nQuasiFactor ));
+                assert( cds::beans::is_power2( nMinQuasiFactor ));
+                assert( cds::beans::is_power2( nMaxQuasiFactor ));
+                assert( nMinQuasiFactor <= nMaxQuasiFactor );
             }
 
             ~segment_list()
@@ -316,7 +384,7 @@ namespace cds { namespace intrusive {
             bool populated( segment const& s ) const
             {
                 // The lock should be held
-                cell const * pLastCell = s.cells + quasi_factor();
+                cell const * pLastCell = s.cells + s.cell_count;
                 for ( cell const * pCell = s.cells; pCell < pLastCell; ++pCell ) {
                     if ( !pCell->data.load( memory_model::memory_order_relaxed ).all())
                         return false;
@@ -326,7 +394,7 @@ namespace cds { namespace intrusive {
             bool exhausted( segment const& s ) const
             {
                 // The lock should be held
-                cell const * pLastCell = s.cells + quasi_factor();
+                cell const * pLastCell = s.cells + s.cell_count;
                 for ( cell const * pCell = s.cells; pCell < pLastCell; ++pCell ) {
                     if ( !pCell->data.load( memory_model::memory_order_relaxed ).bits())
                         return false;
@@ -353,7 +421,10 @@ namespace cds { namespace intrusive {
                 assert( m_List.empty() || populated( m_List.back()));
 #           endif
 
-                segment * pNew = allocate_segment();
+                if ( !m_List.empty())
+                    adapt( m_List.back());
+
+                segment * pNew = allocate_segment( m_nQuasiFactor.load( atomics::memory_order_relaxed ));
                 m_Stat.onSegmentCreated();
 
                 if ( m_List.empty())
@@ -405,10 +476,47 @@ namespace cds { namespace intrusive {
 
             size_t quasi_factor() const
             {
-                return m_nQuasiFactor;
+                return m_nQuasiFactor.load( atomics::memory_order_relaxed );
+            }
+
+            size_t min_quasi_factor() const
+            {
+                return m_nMinQuasiFactor;
+            }
+
+            size_t max_quasi_factor() const
+            {
+                return m_nMaxQuasiFactor;
             }
 
         private:
+            void adapt( segment const& tail )
+            {
+                // The lock should be held
+                if ( m_nMinQuasiFactor == m_nMaxQuasiFactor )
+                    return;
+
+                size_t const nContention = tail.contention.load( atomics::memory_order_relaxed );
+                size_t nQuasiFactor = m_nQuasiFactor.load( atomics::memory_order_relaxed );
+
+                if ( nContention * c_nGrowRatio > tail.cell_count ) {
+                    m_nLowContention = 0;
+                    if ( nQuasiFactor < m_nMaxQuasiFactor ) {
+                        m_nQuasiFactor.store( nQuasiFactor * 2, atomics::memory_order_relaxed );
+                        m_Stat.onSegmentGrow();
+                    }
+                }
+                else if ( nContention * c_nShrinkRatio < tail.cell_count ) {
+                    if ( ++m_nLowContention >= c_nShrinkThreshold && nQuasiFactor > m_nMinQuasiFactor ) {
+                        m_nLowContention = 0;
+                        m_nQuasiFactor.store( nQuasiFactor / 2, atomics::memory_order_relaxed );
+                        m_Stat.onSegmentShrink();
+                    }
+                }
+                else
+                    m_nLowContention = 0;
+            }
+
             typedef cds::details::Allocator< segment, allocator >   segment_allocator;
 
             static size_t get_version( segment * pSegment )
@@ -416,9 +524,10 @@ namespace cds { namespace intrusive {
                 return pSegment ? pSegment->version : 0;
             }
 
-            segment * allocate_segment()
+            segment * allocate_segment( size_t nCellCount )
             {
-                return segment_allocator().NewBlock( sizeof(segment) + sizeof(cell) * m_nQuasiFactor, quasi_factor());
+                m_Stat.onSegmentSize( nCellCount );
+                return segment_allocator().NewBlock( sizeof(segment) + sizeof(cell) * nCellCount, nCellCount );
             }
 
             static void free_segment( segment * pSegment )
@@ -444,7 +553,28 @@ namespace cds { namespace intrusive {
         SegmentedQueue(
             size_t nQuasiFactor     ///< Quasi factor. If it is not a power of 2 it is rounded up to nearest power of 2. Minimum is 2.
             )
-            : m_SegmentList( cds::beans::ceil2(nQuasiFactor), m_Stat )
+            : m_SegmentList( cds::beans::ceil2(nQuasiFactor), cds::beans::ceil2(nQuasiFactor), m_Stat )
+        {
+            static_assert( (!std::is_same< item_counter, cds::atomicity::empty_item_counter >::value),
+                "cds::atomicity::empty_item_counter is not supported for SegmentedQueue"
+                );
+            assert( m_SegmentList.quasi_factor() > 1 );
+        }
+
+        /// Initializes the empty queue with adaptive segment size
+        /**
+            The size of new segment varies in range <tt>[nMinQuasiFactor, nMaxQuasiFactor]</tt>
+            depending on contention, see the class description.
+            Both quasi factors are rounded up to nearest power of 2; \p nMaxQuasiFactor is set to \p nMinQuasiFactor
+            if it is less than \p nMinQuasiFactor.
+        */
+        SegmentedQueue(
+            size_t nMinQuasiFactor, ///< Minimal quasi factor, minimum is 2.
+            size_t nMaxQuasiFactor  ///< Maximal quasi factor
+            )
+            : m_SegmentList( cds::beans::ceil2( nMinQuasiFactor ),
+                             cds::beans::ceil2( nMaxQuasiFactor < nMinQuasiFactor ? nMinQuasiFactor : nMaxQuasiFactor ),
+                             m_Stat )
         {
             static_assert( (!std::is_same< item_counter, cds::atomicity::empty_item_counter >::value),
                 "cds::atomicity::empty_item_counter is not supported for SegmentedQueue"
@@ -472,15 +602,15 @@ namespace cds { namespace intrusive {
                 assert( pTailSegment );
             }
 
-            permutation_generator gen( quasi_factor());
-
             // First, increment item counter.
             // We sure that the item will be enqueued
             // but if we increment the counter after inserting we can get a negative counter value
             // if dequeuing occurs before incrementing (enqueue/dequeue race)
             ++m_ItemCounter;
 
+            bool bFirstProbe = true;
             while ( true ) {
+                permutation_generator gen( pTailSegment->cell_count );
                 CDS_DEBUG_ONLY( size_t nLoopCount = 0);
                 do {
                     typename permutation_generator::integer_type i = gen;
@@ -497,20 +627,22 @@ namespace cds { namespace intrusive {
                         {
                             // Ok to push item
                             m_Stat.onPush();
+                            if ( bFirstProbe )
+                                m_Stat.onPushFirstProbe();
                             return true;
                         }
                         assert( nullCell.ptr());
                         m_Stat.onPushContended();
+                        pTailSegment->contention.fetch_add( 1, atomics::memory_order_relaxed );
                     }
+                    bFirstProbe = false;
                 } while ( gen.next());
 
-                assert( nLoopCount == quasi_factor());
+                assert( nLoopCount == pTailSegment->cell_count );
 
                 // No available position, create a new segment
+                // The permutation is recreated for the new segment since its size may differ
                 pTailSegment = m_SegmentList.create_tail( pTailSegment, segmentGuard );
-
-                // Get new permutation
-                gen.reset();
             }
         }
 
@@ -618,11 +750,30 @@ namespace cds { namespace intrusive {
         }
 
         /// Returns quasi factor, a power-of-two number
+        /**
+            For adaptive queue the function returns the size of the segment to be allocated next.
+        */
         size_t quasi_factor() const
         {
             return m_SegmentList.quasi_factor();
         }
 
+        /// Returns minimal quasi factor
+        size_t min_quasi_factor() const
+        {
+            return m_SegmentList.min_quasi_factor();
+        }
+
+        /// Returns maximal quasi factor
+        /**
+            The queue violates strong FIFO order no more than <tt>max_quasi_factor() - 1</tt> positions.
+            For non-adaptive queue the result is equal to \p quasi_factor().
+        */
+        size_t max_quasi_factor() const
+        {
+            return m_SegmentList.max_quasi_factor();
+        }
+
     protected:
         //@cond
         bool do_dequeue( typename gc::Guard& itemGuard )
@@ -630,7 +781,7 @@ namespace cds { namespace intrusive {
             typename gc::Guard segmentGuard;
             segment * pHeadSegment = m_SegmentList.head( segmentGuard );
 
-            permutation_generator gen( quasi_factor());
+            bool bFirstProbe = true;
             while ( true ) {
                 if ( !pHeadSegment ) {
                     // Queue is empty
@@ -638,6 +789,7 @@ namespace cds { namespace intrusive {
                     return false;
                 }
 
+                permutation_generator gen( pHeadSegment->cell_count );
                 bool bHadNullValue = false;
                 regular_cell item;
                 CDS_DEBUG_ONLY( size_t nLoopCount = 0 );
@@ -664,16 +816,20 @@ namespace cds { namespace intrusive {
                             {
                                 --m_ItemCounter;
                                 m_Stat.onPop();
+                                if ( bFirstProbe )
+                                    m_Stat.onPopFirstProbe();
 
                                 return true;
                             }
                             assert( item.bits());
                             m_Stat.onPopContended();
+                            pHeadSegment->contention.fetch_add( 1, atomics::memory_order_relaxed );
                         }
                     }
+                    bFirstProbe = false;
                 } while ( gen.next());
 
-                assert( nLoopCount == quasi_factor());
+                assert( nLoopCount == pHeadSegment->cell_count );
 
                 // scanning the entire segment without finding a candidate to dequeue
                 // If there was an empty cell, the queue is considered empty
@@ -684,9 +840,6 @@ namespace cds { namespace intrusive {
 
                 // All nodes have been dequeued, we can safely remove the first segment
                 pHeadSegment = m_SegmentList.remove_head( pHeadSegment, segmentGuard );
-
-                // Get new permutation
-                gen.reset();
             }
         }
         //@endcond
@@ -1674,8 +1674,9 @@ namespace cds { namespace intrusive {
             return true;
         }
 
-        template <typename Func>
-        bool try_remove_at( node_type * pDel, position& pos, Func f, bool bExtract )
+        // Logical deletion of pDel: marks pDel->next() from the top level down to level 0 with nMask.
+        // Returns true if the current thread has marked level 0, i.e. the current thread owns pDel
+        bool mark_node( node_type * pDel, unsigned int nMask )
         {
             assert( pDel != nullptr );
             assert( gc::is_locked());
@@ -1683,9 +1684,6 @@ namespace cds { namespace intrusive {
             marked_node_ptr pSucc;
             back_off bkoff;
 
-            unsigned const nMask = bExtract ? 3u : 1u;
-
-            // logical deletion (marking)
             for ( unsigned int nLevel = pDel->height() - 1; nLevel > 0; --nLevel ) {
                 pSucc = pDel->next( nLevel ).load( memory_model::memory_order_relaxed );
                 if ( pSucc.bits() == 0 ) {
@@ -1706,57 +1704,202 @@ namespace cds { namespace intrusive {
             marked_node_ptr p( pDel->next( 0 ).load( memory_model::memory_order_relaxed ).ptr());
             while ( true ) {
                 if ( pDel->next( 0 ).compare_exchange_strong( p, p | nMask, memory_model::memory_order_release, atomics::memory_order_acquire ))
+                    return true;
+                else if ( p.bits()) {
+                    // Another thread is deleting pDel right now
+                    m_Stat.onEraseContention();
+                    return false;
+                }
+
+                m_Stat.onEraseRetry();
+                bkoff();
+            }
+        }
+
+        template <typename Func>
+        bool try_remove_at( node_type * pDel, position& pos, Func f, bool bExtract )
+        {
+            assert( pDel != nullptr );
+            assert( gc::is_locked());
+
+            // logical deletion (marking)
+            if ( !mark_node( pDel, bExtract ? 3u : 1u ))
+                return false;
+
+            f( *node_traits::to_value_ptr( pDel ));
+
+            // physical deletion
+            // try fast erase
+            marked_node_ptr p( pDel );
+            marked_node_ptr pSucc;
+            for ( int nLevel = static_cast<int>( pDel->height() - 1 ); nLevel >= 0; --nLevel ) {
+
+                pSucc = pDel->next( nLevel ).load( memory_model::memory_order_acquire );
+                if ( pos.pPrev[nLevel]->next( nLevel ).compare_exchange_strong( p, marked_node_ptr( pSucc.ptr()),
+                    memory_model::memory_order_acq_rel, atomics::memory_order_relaxed ))
                 {
-                    f( *node_traits::to_value_ptr( pDel ));
-
-                    // physical deletion
-                    // try fast erase
-                    p = pDel;
-                    for ( int nLevel = static_cast<int>( pDel->height() - 1 ); nLevel >= 0; --nLevel ) {
-
-                        pSucc = pDel->next( nLevel ).load( memory_model::memory_order_acquire );
-                        if ( pos.pPrev[nLevel]->next( nLevel ).compare_exchange_strong( p, marked_node_ptr( pSucc.ptr()),
-                            memory_model::memory_order_acq_rel, atomics::memory_order_relaxed ))
-                        {
-                            pDel->level_unlinked();
-                        }
-                        else {
-                            // Make slow erase
+                    pDel->level_unlinked();
+                }
+                else {
+                    // Make slow erase
 #       ifdef CDS_DEBUG
-                            if ( find_position( *node_traits::to_value_ptr( pDel ), pos, key_comparator(), false ))
-                                assert( pDel != pos.pCur );
+                    if ( find_position( *node_traits::to_value_ptr( pDel ), pos, key_comparator(), false ))
+                        assert( pDel != pos.pCur );
 #       else
-                            find_position( *node_traits::to_value_ptr( pDel ), pos, key_comparator(), false );
+                    find_position( *node_traits::to_value_ptr( pDel ), pos, key_comparator(), false );
 #       endif
-                            if ( bExtract )
-                                m_Stat.onSlowExtract();
-                            else
-                                m_Stat.onSlowErase();
+                    if ( bExtract )
+                        m_Stat.onSlowExtract();
+                    else
+                        m_Stat.onSlowErase();
 
-                            return true;
-                        }
-                    }
+                    return true;
+                }
+            }
 
-                    // Fast erasing success
-                    if ( !bExtract ) {
-                        // We cannot free the node at this moment since RCU is locked
-                        // Link deleted nodes to a chain to free later
-                        pos.dispose( pDel );
-                        m_Stat.onFastErase();
+            // Fast erasing success
+            if ( !bExtract ) {
+                // We cannot free the node at this moment since RCU is locked
+                // Link deleted nodes to a chain to free later
+                pos.dispose( pDel );
+                m_Stat.onFastErase();
+            }
+            else
+                m_Stat.onFastExtract();
+            return true;
+        }
+
+        // Lindén-Jonsson delete-min: logically deletes the first live node of level 0.
+        // The node is not unlinked: the deleted nodes form a prefix of the list
+        // that is unlinked in one step by unlink_deleted_prefix().
+        // nPrefixLen returns the length of the deleted prefix that has been passed.
+        // RCU should not be locked
+        template <typename Func>
+        bool delete_min_lazy( Func f, size_t& nPrefixLen )
+        {
+            check_deadlock_policy::check();
+
+            rcu_lock l;
+            node_type * pCur = m_Head.head()->next( 0 ).load( memory_model::memory_order_acquire ).ptr();
+
+            nPrefixLen = 0;
+            while ( pCur ) {
+                marked_node_ptr pSucc = pCur->next( 0 ).load( memory_model::memory_order_acquire );
+                if ( pSucc.bits() == 0 ) {
+                    // pCur is the first live node
+                    if ( mark_node( pCur, 1 )) {
+                        f( *node_traits::to_value_ptr( pCur ));
+                        --m_ItemCounter;
+                        m_Stat.onRemoveNode( pCur->height());
+                        return true;
                     }
-                    else
-                        m_Stat.onFastExtract();
-                    return true;
+
+                    // pCur has been deleted by another thread
+                    continue;
                 }
-                else if ( p.bits()) {
-                    // Another thread is deleting pDel right now
-                    m_Stat.onEraseContention();
-                    return false;
+
+                pCur = pSucc.ptr();
+                ++nPrefixLen;
+            }
+
+            // All items are logically deleted
+            return false;
+        }
+
+        // Unlinks the logically deleted prefix of the list with one CAS per level.
+        // Returns the number of nodes unlinked from level 0.
+        // RCU should not be locked
+        size_t unlink_deleted_prefix()
+        {
+            check_deadlock_policy::check();
+
+            position pos;
+            size_t nUnlinked = 0;
+
+            rcu_lock l;
+            node_type * pHead = m_Head.head();
+
+            // Top-down: a node is unlinked from level nLevel only if it is unlinked from all upper levels
+            for ( int nLevel = static_cast<int>( c_nMaxHeight - 1 ); nLevel >= 0; --nLevel ) {
+                while ( true ) {
+                    node_type * pFirst = pHead->next( nLevel ).load( memory_model::memory_order_acquire ).ptr();
+                    node_type * pLast = pFirst;
+
+                    // pLast - the first node that cannot be unlinked from nLevel
+                    while ( pLast ) {
+                        marked_node_ptr pSucc = pLast->next( nLevel ).load( memory_model::memory_order_acquire );
+                        if ( pSucc.bits() == 0 || !pLast->is_upper_level( nLevel ))
+                            break;
+                        pLast = pSucc.ptr();
+                    }
+
+                    if ( pLast == pFirst )
+                        break;
+
+                    marked_node_ptr p( pFirst );
+                    if ( pHead->next( nLevel ).compare_exchange_strong( p, marked_node_ptr( pLast ),
+                        memory_model::memory_order_acq_rel, atomics::memory_order_relaxed ))
+                    {
+                        for ( node_type * pNode = pFirst; pNode != pLast; ) {
+                            marked_node_ptr pNext = pNode->next( nLevel ).load( memory_model::memory_order_relaxed );
+                            if ( pNode->level_unlinked()) {
+                                if ( !is_extracted( pNext ))
+                                    pos.dispose( pNode );
+                                ++nUnlinked;
+                            }
+                            pNode = pNext.ptr();
+                        }
+                        break;
+                    }
                 }
+            }
 
-                m_Stat.onEraseRetry();
-                bkoff();
+            // pos destructor disposes unlinked nodes after RCU unlocking
+            return nUnlinked;
+        }
+
+        // SprayList pop: a random walk starting from the head at level nHeight - 1.
+        // On each level the walk makes a random number [0 .. nJump] of forward steps and then descends.
+        // The live node of level 0 where the walk lands is removed.
+        // Returns false if the walk has landed on the head or on a deleted node.
+        // RCU should not be locked
+        template <typename Random, typename Func>
+        bool spray_delete( unsigned int nHeight, unsigned int nJump, Random& rnd, Func f )
+        {
+            check_deadlock_policy::check();
+
+            position pos;
+
+            rcu_lock l;
+            node_type * pPred = m_Head.head();
+
+            if ( nHeight > c_nMaxHeight )
+                nHeight = c_nMaxHeight;
+
+            for ( int nLevel = static_cast<int>( nHeight ) - 1; nLevel >= 0; --nLevel ) {
+                for ( unsigned int nStep = rnd() % ( nJump + 1 ); nStep > 0; --nStep ) {
+                    marked_node_ptr pCur = pPred->next( nLevel ).load( memory_model::memory_order_acquire );
+                    if ( pCur.bits()) {
+                        // pPred has been deleted
+                        return false;
+                    }
+                    if ( !pCur.ptr() || pCur->next( nLevel ).load( memory_model::memory_order_acquire ).bits())
+                        break;
+
+                    pPred = pCur.ptr();
+                }
             }
+
+            if ( pPred == m_Head.head() || !mark_node( pPred, 1 ))
+                return false;
+
+            f( *node_traits::to_value_ptr( pPred ));
+            --m_ItemCounter;
+            m_Stat.onRemoveNode( pPred->height());
+
+            // Physical deletion
+            find_position( *node_traits::to_value_ptr( pPred ), pos, key_comparator(), false );
+            return true;
         }
 
         enum finsd_fastpath_result {
@@ -7,6 +7,7 @@
 #define CDSLIB_INTRUSIVE_SPLIT_LIST_H
 
 #include <limits>
+#include <algorithm>
 #include <cds/intrusive/details/split_list_base.h>
 #include <cds/details/type_padding.h>
 
@@ -256,24 +257,41 @@ namespace cds { namespace intrusive {
         typedef typename ordered_list::guarded_ptr guarded_ptr;  ///< Guarded pointer
 
         /// Count of hazard pointer required
-        static constexpr const size_t c_nHazardPtrCount = ordered_list::c_nHazardPtrCount + 4; // +4 - for iterators
+        // +4 - for iterators, +1 - for bucket head if the bucket table is shrinkable
+        static constexpr const size_t c_nHazardPtrCount = ordered_list::c_nHazardPtrCount + 4 + ( traits::shrink_factor != 0 ? 1 : 0 );
+
+        static constexpr const size_t c_nFindBatchSize = 16; ///< Count of keys \p find_batch_() prefetches at once
 
     protected:
         //@cond
         typedef split_list::node<typename ordered_list_adapter::ordered_list_node_type> node_type; ///< split-list node type
         typedef typename ordered_list_adapter::node_traits node_traits;
 
+        static constexpr const bool c_bShrinkable = traits::shrink_factor != 0;
+
         /// Bucket table implementation
-        typedef typename split_list::details::bucket_table_selector<
-            traits::dynamic_bucket_table
-            , gc
-            , typename ordered_list_adapter::aux_node
-            , opt::allocator< typename traits::allocator >
-            , opt::memory_model< memory_model >
-            , opt::free_list< typename traits::free_list >
+        typedef typename std::conditional< c_bShrinkable,
+            split_list::shrinkable_bucket_table<
+                gc
+                , typename ordered_list_adapter::aux_node
+                , opt::allocator< typename traits::allocator >
+                , opt::memory_model< memory_model >
+            >,
+            typename split_list::details::bucket_table_selector<
+                traits::dynamic_bucket_table
+                , gc
+                , typename ordered_list_adapter::aux_node
+                , opt::allocator< typename traits::allocator >
+                , opt::memory_model< memory_model >
+                , opt::free_list< typename traits::free_list >
+            >::type
         >::type bucket_table;
 
         typedef typename bucket_table::aux_node_type aux_node_type;   ///< auxiliary node type
+
+        // The bucket head should be guarded only if the bucket table is shrinkable
+        struct empty_bucket_guard {};
+        typedef typename std::conditional< c_bShrinkable, typename gc::Guard, empty_bucket_guard >::type bucket_guard;
         //@endcond
 
     protected:
@@ -300,6 +318,14 @@ namespace cds { namespace intrusive {
                 return base_class::insert_at( h, val, f );
             }
 
+            template <typename Func>
+            size_t merge_at( aux_node_type * pHead, value_type* const* pFirst, value_type* const* pLast, Func fReject )
+            {
+                assert( pHead != nullptr );
+                bucket_head_type h(pHead);
+                return base_class::merge_at( h, pFirst, pLast, fReject );
+            }
+
             template <typename Func>
             std::pair<bool, bool> update_at( aux_node_type * pHead, value_type& val, Func func, bool bAllowInsert )
             {
@@ -397,6 +423,11 @@ namespace cds { namespace intrusive {
                 return base_class::get_at( h, val, cmp );
             }
 
+            void prefetch_next( aux_node_type const* pHead ) const
+            {
+                base_class::prefetch_next( pHead );
+            }
+
             bool insert_aux_node( aux_node_type * pNode )
             {
                 return base_class::insert_aux_node( pNode );
@@ -407,6 +438,12 @@ namespace cds { namespace intrusive {
                 return base_class::insert_aux_node( h, pNode );
             }
 
+            bool unlink_aux_node( aux_node_type * pHead, aux_node_type * pNode )
+            {
+                bucket_head_type h(pHead);
+                return base_class::unlink_aux_node( h, pNode );
+            }
+
             template <typename Predicate>
             void destroy( Predicate pred )
             {
@@ -522,6 +559,8 @@ namespace cds { namespace intrusive {
         SplitListSet()
             : m_nBucketCountLog2(1)
             , m_nMaxItemCount( max_item_count(2, m_Buckets.load_factor()))
+            , m_bShrinking( false )
+            , m_pRetiredAux( nullptr )
         {
             init();
         }
@@ -534,6 +573,8 @@ namespace cds { namespace intrusive {
             : m_Buckets( nItemCount, nLoadFactor )
             , m_nBucketCountLog2(1)
             , m_nMaxItemCount( max_item_count(2, m_Buckets.load_factor()))
+            , m_bShrinking( false )
+            , m_pRetiredAux( nullptr )
         {
             init();
         }
@@ -543,6 +584,7 @@ namespace cds { namespace intrusive {
         {
             // list contains aux node that cannot be retired
             // all aux nodes will be destroyed by bucket table dtor
+            // (if the bucket table is shrinkable, the aux nodes are retired with the items)
             m_List.destroy(
                 []( node_type * pNode ) -> bool {
                     return !pNode->is_dummy();
@@ -561,19 +603,21 @@ namespace cds { namespace intrusive {
         */
         bool insert( value_type& val )
         {
-            size_t nHash = hash_value( val );
-            aux_node_type * pHead = get_bucket( nHash );
-            assert( pHead != nullptr );
+            return insert_with_hash_( val, hash_value( val ));
+        }
 
-            node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
+        /// Inserts new node with precomputed hash value
+        /** \anchor cds_intrusive_SplitListSet_hp_insert_with_hash
+            The function is an analog of \p insert( value_type& ) but \p nHash is used as the hash value of \p val
+            instead of calling the hash functor. It is useful when the key is hashed once and then looked up in several sets.
 
-            if ( m_List.insert_at( pHead, val )) {
-                inc_item_count();
-                m_Stat.onInsertSuccess();
-                return true;
-            }
-            m_Stat.onInsertFailed();
-            return false;
+            \p nHash must be equal to the value of the set's hash functor for \p val; in debug mode it is checked by an assertion.
+            The same requirement is for all \p %_with_hash functions.
+        */
+        bool insert_with_hash( value_type& val, size_t nHash )
+        {
+            check_hash( val, nHash );
+            return insert_with_hash_( val, nHash );
         }
 
         /// Inserts new node
@@ -599,19 +643,19 @@ namespace cds { namespace intrusive {
         template <typename Func>
         bool insert( value_type& val, Func f )
         {
-            size_t nHash = hash_value( val );
-            aux_node_type * pHead = get_bucket( nHash );
-            assert( pHead != nullptr );
-
-            node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
+            return insert_with_hash_( val, hash_value( val ), f );
+        }
 
-            if ( m_List.insert_at( pHead, val, f )) {
-                inc_item_count();
-                m_Stat.onInsertSuccess();
-                return true;
-            }
-            m_Stat.onInsertFailed();
-            return false;
+        /// Inserts new node with precomputed hash value
+        /**
+            The function is an analog of \p insert( value_type&, Func ) but \p nHash is used as the hash value of \p val,
+            see \ref cds_intrusive_SplitListSet_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Func>
+        bool insert_with_hash( value_type& val, size_t nHash, Func f )
+        {
+            check_hash( val, nHash );
+            return insert_with_hash_( val, nHash, f );
         }
 
         /// Updates the node
@@ -657,20 +701,19 @@ namespace cds { namespace intrusive {
         template <typename Func>
         std::pair<bool, bool> update( value_type& val, Func func, bool bAllowInsert = true )
         {
-            size_t nHash = hash_value( val );
-            aux_node_type * pHead = get_bucket( nHash );
-            assert( pHead != nullptr );
-
-            node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
+            return update_with_hash_( val, hash_value( val ), func, bAllowInsert );
+        }
 
-            std::pair<bool, bool> bRet = m_List.update_at( pHead, val, func, bAllowInsert );
-            if ( bRet.first && bRet.second ) {
-                inc_item_count();
-                m_Stat.onUpdateNew();
-            }
-            else
-                m_Stat.onUpdateExist();
-            return bRet;
+        /// Updates the node with precomputed hash value
+        /**
+            The function is an analog of \p update() but \p nHash is used as the hash value of \p val,
+            see \ref cds_intrusive_SplitListSet_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Func>
+        std::pair<bool, bool> update_with_hash( value_type& val, size_t nHash, Func func, bool bAllowInsert = true )
+        {
+            check_hash( val, nHash );
+            return update_with_hash_( val, nHash, func, bAllowInsert );
         }
         //@cond
         template <typename Func>
@@ -705,7 +748,8 @@ namespace cds { namespace intrusive {
 #endif
         {
             size_t nHash = hash_value( val );
-            aux_node_type * pHead = get_bucket( nHash );
+            bucket_guard guard;
+            aux_node_type * pHead = get_bucket( nHash, guard );
             assert( pHead != nullptr );
 
             node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
@@ -735,11 +779,12 @@ namespace cds { namespace intrusive {
         bool unlink( value_type& val )
         {
             size_t nHash = hash_value( val );
-            aux_node_type * pHead = get_bucket( nHash );
+            bucket_guard guard;
+            aux_node_type * pHead = get_bucket( nHash, guard );
             assert( pHead != nullptr );
 
             if ( m_List.unlink_at( pHead, val )) {
-                --m_ItemCounter;
+                dec_item_count();
                 m_Stat.onEraseSuccess();
                 return true;
             }
@@ -766,6 +811,19 @@ namespace cds { namespace intrusive {
             return erase_( key, key_comparator());
         }
 
+        /// Deletes the item from the set using precomputed hash value of \p key
+        /**
+            The function is an analog of \ref cds_intrusive_SplitListSet_hp_erase "erase(Q const&)"
+            but \p nHash is used as the hash value of \p key,
+            see \ref cds_intrusive_SplitListSet_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q>
+        bool erase_with_hash( Q const& key, size_t nHash )
+        {
+            check_hash( key, nHash );
+            return erase_with_hash_( key, nHash, key_comparator());
+        }
+
         /// Deletes the item from the set with comparing functor \p pred
         /**
 
@@ -805,6 +863,18 @@ namespace cds { namespace intrusive {
             return erase_( key, key_comparator(), f );
         }
 
+        /// Deletes the item from the set using precomputed hash value of \p key
+        /**
+            The function is an analog of \ref cds_intrusive_SplitListSet_hp_erase_func "erase(Q const&, Func)"
+            but \p nHash is used as the hash value of \p key.
+        */
+        template <typename Q, typename Func>
+        bool erase_with_hash( Q const& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            return erase_with_hash_( key, nHash, key_comparator(), f );
+        }
+
         /// Deletes the item from the set with comparing functor \p pred
         /**
             The function is an analog of \ref cds_intrusive_SplitListSet_hp_erase_func "erase(Q const&, Func)"
@@ -840,7 +910,7 @@ namespace cds { namespace intrusive {
             assert( iter != end());
 
             if ( m_List.erase_at( iter.underlying_iterator())) {
-                --m_ItemCounter;
+                dec_item_count();
                 m_Stat.onEraseSuccess();
                 return true;
             }
@@ -929,6 +999,27 @@ namespace cds { namespace intrusive {
         }
         //@endcond
 
+        /// Finds the key \p key using precomputed hash value
+        /**
+            The function is an analog of \ref cds_intrusive_SplitListSet_hp_find_func "find(Q&, Func)"
+            but \p nHash is used as the hash value of \p key,
+            see \ref cds_intrusive_SplitListSet_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        bool find_with_hash( Q& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            return find_with_hash_( key, nHash, key_comparator(), f );
+        }
+        //@cond
+        template <typename Q, typename Func>
+        bool find_with_hash( Q const& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            return find_with_hash_( key, nHash, key_comparator(), f );
+        }
+        //@endcond
+
         /// Finds \p key and returns iterator pointed to the item found (only for \p IterableList)
         /**
             If \p key is not found the function returns \p end().
@@ -1024,6 +1115,18 @@ namespace cds { namespace intrusive {
             return find_( key, key_comparator());
         }
 
+        /// Checks whether the set contains \p key using precomputed hash value
+        /**
+            The function is an analog of <tt>contains( key )</tt> but \p nHash is used as the hash value of \p key,
+            see \ref cds_intrusive_SplitListSet_hp_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q>
+        bool contains_with_hash( Q const& key, size_t nHash )
+        {
+            check_hash( key, nHash );
+            return contains_with_hash_( key, nHash, key_comparator());
+        }
+
         /// Checks whether the set contains \p key using \p pred predicate for searching
         /**
             The function is an analog of <tt>contains( key )</tt> but \p pred is used for key comparing.
@@ -1121,6 +1224,35 @@ namespace cds { namespace intrusive {
             }
         }
 
+        /// Returns current bucket count
+        size_t bucket_count() const
+        {
+            return static_cast<size_t>( 1 ) << m_nBucketCountLog2.load( memory_model::memory_order_relaxed );
+        }
+
+        /// Shrinks the bucket table (only if \p split_list::traits::shrink_factor is not zero)
+        /**
+            The erasing functions shrink the bucket table automatically. This function is intended for
+            an idle set, for example, after mass erasing: it halves the bucket table while the set is underloaded,
+            and unlinks from the split-list the auxiliary nodes of the removed buckets that are not used
+            by other threads anymore. The auxiliary nodes unlinked are freed by the garbage collector.
+
+            If another thread is shrinking the table, the function does nothing.
+        */
+        void shrink()
+        {
+            static_assert( c_bShrinkable, "shrink() requires non-zero split_list::shrink_factor" );
+
+            size_t sz = m_nBucketCountLog2.load( memory_model::memory_order_relaxed );
+            for ( ;; ) {
+                shrink_bucket_table();
+                size_t const szNew = m_nBucketCountLog2.load( memory_model::memory_order_relaxed );
+                if ( szNew >= sz )
+                    break;
+                sz = szNew;
+            }
+        }
+
         /// Returns internal statistics
         stat const& statistics() const
         {
@@ -1170,6 +1302,15 @@ namespace cds { namespace intrusive {
             return m_HashFunctor( key );
         }
 
+        /// Checks (in debug mode only) that \p nHash passed to \p %_with_hash function is the hash value of \p key
+        template <typename Q>
+        void check_hash( Q const& key, size_t nHash ) const
+        {
+            assert( hash_value( key ) == nHash );
+            CDS_UNUSED( key );
+            CDS_UNUSED( nHash );
+        }
+
         size_t bucket_no( size_t nHash ) const
         {
             return nHash & ((1 << m_nBucketCountLog2.load( memory_model::memory_order_relaxed )) - 1);
@@ -1181,6 +1322,11 @@ namespace cds { namespace intrusive {
             return nBucket & ~(1 << bitop::MSBnz( nBucket ));
         }
 
+        aux_node_type * init_bucket( size_t const nBucket, bucket_guard&, std::false_type )
+        {
+            return init_bucket( nBucket );
+        }
+
         aux_node_type * init_bucket( size_t const nBucket )
         {
             assert( nBucket > 0 );
@@ -1231,13 +1377,89 @@ namespace cds { namespace intrusive {
             return pBucket;
         }
 
-        aux_node_type * get_bucket( size_t nHash )
+        aux_node_type * init_bucket( size_t const nBucket, bucket_guard& guard, std::true_type )
         {
-            size_t nBucket = bucket_no( nHash );
+            // The buckets can be removed by shrinking at any time, so the bucket head is used only if it is guarded.
+            // The function returns guarded head of nBucket or, if the bucket cannot be initialized now,
+            // guarded head of its nearest initialized parent bucket. Both are suitable for searching in nBucket.
+            assert( nBucket > 0 );
+
+        retry:
+            // Find nearest initialized parent bucket
+            size_t arrChain[ sizeof( size_t ) * 8 ];
+            size_t nChainLen = 0;
+            size_t nCur = nBucket;
+            aux_node_type * pHead;
+            do {
+                arrChain[ nChainLen++ ] = nCur;
+                nCur = parent_bucket( nCur );
+                pHead = protect_bucket( nCur, guard );
+            } while ( pHead == nullptr );
+
+            // Initialize the buckets top-down
+            while ( nChainLen > 0 ) {
+                nCur = arrChain[ --nChainLen ];
+                if ( nChainLen > 0 )
+                    m_Stat.onRecursiveInitBucket();
+
+                aux_node_type * pBucket = alloc_aux_node( split_list::dummy_hash<bit_reversal>( nCur ));
+                assert( pBucket != nullptr );
+                pBucket->m_nBucket = nCur;
+
+                if ( m_List.insert_aux_node( pHead, pBucket )) {
+                    // pBucket should be guarded before publishing since it can be removed by shrinking just after that
+                    guard.assign( pBucket->head());
+                    if ( m_Buckets.cas_bucket( nCur, nullptr, pBucket ))
+                        m_Stat.onNewBucket();
+                    pHead = pBucket;
+                    continue;
+                }
 
+                // Another thread has initialized the bucket,
+                // or the bucket removed by shrinking is not yet unlinked from the list
+                free_aux_node( pBucket );
+                m_Stat.onBucketInitContenton();
+
+                if ( m_Buckets.bucket( nCur ) != nullptr ) {
+                    pHead = protect_bucket( nCur, guard );
+                    if ( pHead == nullptr )
+                        goto retry; // the bucket has been removed by shrinking, the parent is not guarded anymore
+                }
+                else {
+                    // pHead is still guarded parent bucket.
+                    // The aux node of removed bucket prevents the bucket initialization, try to unlink it
+                    try_reclaim_aux_nodes();
+                }
+            }
+
+            return pHead;
+        }
+
+        aux_node_type * protect_bucket( size_t nBucket, typename gc::Guard& guard ) const
+        {
             aux_node_type * pHead = m_Buckets.bucket( nBucket );
+            while ( pHead ) {
+                guard.assign( pHead->head());
+                aux_node_type * p = m_Buckets.bucket( nBucket );
+                if ( p == pHead )
+                    break;
+                pHead = p;
+            }
+            return pHead;
+        }
+
+        aux_node_type * protect_bucket( size_t nBucket, empty_bucket_guard& ) const
+        {
+            return m_Buckets.bucket( nBucket );
+        }
+
+        aux_node_type * get_bucket( size_t nHash, bucket_guard& guard )
+        {
+            size_t nBucket = bucket_no( nHash );
+
+            aux_node_type * pHead = protect_bucket( nBucket, guard );
             if ( pHead == nullptr )
-                pHead = init_bucket( nBucket );
+                pHead = init_bucket( nBucket, guard, std::integral_constant<bool, c_bShrinkable>());
 
             assert( pHead->is_dummy());
 
@@ -1253,6 +1475,10 @@ namespace cds { namespace intrusive {
             static_assert(!std::is_same<item_counter, cds::atomicity::empty_item_counter>::value,
                 "cds::atomicity::empty_item_counter is not allowed as a item counter");
 
+            static_assert( !c_bShrinkable || traits::shrink_factor > 2, "split_list::shrink_factor must be greater than 2" );
+            static_assert( !c_bShrinkable || ( traits::dynamic_bucket_table && !is_iterable_list< ordered_list >::value ),
+                "split_list::shrink_factor is supported only for dynamic bucket table and MichaelList or LazyList" );
+
             // Initialize bucket 0
             aux_node_type * pNode = alloc_aux_node( 0 /*split_list::dummy_hash<bit_reversal>(0)*/ );
             assert( pNode != nullptr );
@@ -1279,8 +1505,15 @@ namespace cds { namespace intrusive {
             if ( nBucketCount < m_Buckets.capacity()) {
                 // we may grow the bucket table
                 const size_t nLoadFactor = m_Buckets.load_factor();
-                if ( nMaxCount < max_item_count( nBucketCount, nLoadFactor ))
-                    return; // someone already have updated m_nBucketCountLog2, so stop here
+                if ( nMaxCount < max_item_count( nBucketCount, nLoadFactor )) {
+                    // someone already have updated m_nBucketCountLog2, so stop here
+                    if ( c_bShrinkable ) {
+                        // m_nMaxItemCount may lag behind m_nBucketCountLog2 after concurrent shrinking, fix it
+                        m_nMaxItemCount.compare_exchange_strong( nMaxCount, max_item_count( nBucketCount, nLoadFactor ),
+                            memory_model::memory_order_relaxed, atomics::memory_order_relaxed );
+                    }
+                    return;
+                }
 
                 m_nMaxItemCount.compare_exchange_strong( nMaxCount, max_item_count( nBucketCount << 1, nLoadFactor ),
                     memory_model::memory_order_relaxed, atomics::memory_order_relaxed );
@@ -1290,12 +1523,301 @@ namespace cds { namespace intrusive {
                 m_nMaxItemCount.store( std::numeric_limits<size_t>::max(), memory_model::memory_order_relaxed );
         }
 
+        void dec_item_count()
+        {
+            --m_ItemCounter;
+            check_shrink( std::integral_constant<bool, c_bShrinkable>());
+        }
+
+        void check_shrink( std::false_type )
+        {}
+
+        void check_shrink( std::true_type )
+        {
+            size_t const nCount = m_ItemCounter.value();
+            size_t const sz = m_nBucketCountLog2.load( memory_model::memory_order_relaxed );
+            if ( sz > 1 && nCount * traits::shrink_factor < max_item_count( static_cast<size_t>( 1 ) << sz, m_Buckets.load_factor()))
+                shrink_bucket_table();
+            else if ( ( nCount & c_nReclaimMask ) == 0 )
+                try_reclaim_aux_nodes();
+        }
+
+        void shrink_bucket_table()
+        {
+            if ( m_bShrinking.exchange( true, atomics::memory_order_acquire ))
+                return; // another thread is shrinking the table
+
+            size_t sz = m_nBucketCountLog2.load( memory_model::memory_order_relaxed );
+            size_t const nBucketCount = static_cast<size_t>( 1 ) << sz;
+            size_t const nLoadFactor = m_Buckets.load_factor();
+            if ( sz > 1 && m_ItemCounter.value() * traits::shrink_factor < max_item_count( nBucketCount, nLoadFactor )
+                && m_nBucketCountLog2.compare_exchange_strong( sz, sz - 1, memory_model::memory_order_relaxed, atomics::memory_order_relaxed ))
+            {
+                m_nMaxItemCount.store( max_item_count( nBucketCount >> 1, nLoadFactor ), memory_model::memory_order_relaxed );
+                m_Stat.onBucketTableShrink();
+
+                // Remove the upper half of buckets from the table.
+                // The aux nodes of removed buckets stay in the list until no thread uses them as a bucket head
+                for ( size_t nBucket = nBucketCount >> 1; nBucket < nBucketCount; ++nBucket ) {
+                    aux_node_type * pBucket = m_Buckets.bucket( nBucket );
+                    if ( pBucket && m_Buckets.cas_bucket( nBucket, pBucket, nullptr ))
+                        retire_aux_node( pBucket );
+                }
+
+                // Most of the aux nodes retired are not used as a bucket head,
+                // the GC cycle detects them, so they can be unlinked just now
+                gc::scan();
+            }
+
+            reclaim_aux_nodes();
+            m_bShrinking.store( false, atomics::memory_order_release );
+        }
+
+        void try_reclaim_aux_nodes()
+        {
+            if ( m_pRetiredAux.load( atomics::memory_order_relaxed ) != nullptr
+                && !m_bShrinking.exchange( true, atomics::memory_order_acquire ))
+            {
+                reclaim_aux_nodes();
+                m_bShrinking.store( false, atomics::memory_order_release );
+            }
+        }
+
+        void retire_aux_node( aux_node_type * pNode )
+        {
+            // Called only by the thread that is shrinking the table
+            pNode->m_nState.store( aux_node_type::retired, atomics::memory_order_release );
+            pNode->m_pNextRetired = m_pRetiredAux.load( atomics::memory_order_relaxed );
+            m_pRetiredAux.store( pNode, atomics::memory_order_relaxed );
+            m_Stat.onAuxNodeRetired();
+
+            gc::template retire<typename aux_node_type::quiescent_disposer>( pNode->head());
+        }
+
+        void reclaim_aux_nodes()
+        {
+            // Called only by the thread that is shrinking the table
+            typename gc::Guard guard;
+            aux_node_type * pPrev = nullptr;
+            aux_node_type * pNode = m_pRetiredAux.load( atomics::memory_order_relaxed );
+
+            while ( pNode ) {
+                aux_node_type * pNext = pNode->m_pNextRetired;
+                if ( pNode->m_nState.load( atomics::memory_order_acquire ) == aux_node_type::quiescent ) {
+                    // No thread uses pNode as a bucket head, so pNode can be unlinked from the list.
+                    // After unlinking, the list disposer and the GC free pNode
+                    if ( pPrev )
+                        pPrev->m_pNextRetired = pNext;
+                    else
+                        m_pRetiredAux.store( pNext, atomics::memory_order_relaxed );
+
+                    // Nearest live parent bucket is the head to search pNode from
+                    aux_node_type * pHead;
+                    size_t nParent = pNode->m_nBucket;
+                    do {
+                        nParent = parent_bucket( nParent );
+                        pHead = protect_bucket( nParent, guard );
+                    } while ( pHead == nullptr );
+
+                    CDS_VERIFY( m_List.unlink_aux_node( pHead, pNode ));
+                    m_Stat.onAuxNodeUnlinked();
+                }
+                else
+                    pPrev = pNode;
+                pNode = pNext;
+            }
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        size_t find_batch_( Q const* keys, size_t nCount, Compare cmp, Func f )
+        {
+            size_t arrHash[c_nFindBatchSize];
+            size_t nFound = 0;
+
+            for ( size_t nFirst = 0; nFirst < nCount; nFirst += c_nFindBatchSize ) {
+                size_t const nGroupSize = nCount - nFirst < c_nFindBatchSize ? nCount - nFirst : c_nFindBatchSize;
+
+                // Hash the keys of the group and prefetch their entries of the bucket table
+                for ( size_t i = 0; i < nGroupSize; ++i ) {
+                    arrHash[i] = hash_value( keys[nFirst + i] );
+                    m_Buckets.prefetch( bucket_no( arrHash[i] ));
+                }
+
+                // Prefetch the bucket heads loaded from the table
+                for ( size_t i = 0; i < nGroupSize; ++i )
+                    prefetch_bucket( arrHash[i] );
+
+                // The first step of the list search: prefetch the first item node of each bucket.
+                // The bucket heads are guarded one at a time, so they are got again by the search below
+                for ( size_t i = 0; i < nGroupSize; ++i ) {
+                    bucket_guard guard;
+                    aux_node_type * pHead = get_bucket( arrHash[i], guard );
+                    assert( pHead != nullptr );
+                    m_List.prefetch_next( pHead );
+                }
+
+                for ( size_t i = 0; i < nGroupSize; ++i ) {
+                    size_t const nIndex = nFirst + i;
+                    split_list::details::search_value_type<Q const> sv( keys[nIndex], split_list::regular_hash<bit_reversal>( arrHash[i] ));
+                    bucket_guard guard;
+                    aux_node_type * pHead = get_bucket( arrHash[i], guard );
+                    assert( pHead != nullptr );
+
+                    if ( m_Stat.onFind( m_List.find_at( pHead, sv, cmp,
+                            [&f, nIndex]( value_type& item, split_list::details::search_value_type<Q const>& ) { f( nIndex, item ); } )))
+                    {
+                        ++nFound;
+                    }
+                }
+            }
+            return nFound;
+        }
+
+        void prefetch_bucket( size_t nHash ) const
+        {
+            // The bucket head is not protected: it is only prefetched, not dereferenced
+            aux_node_type * pHead = m_Buckets.bucket( bucket_no( nHash ));
+            if ( pHead )
+                cds_prefetch( pHead );
+        }
+
+        // bulk_load() support: grows the bucket table at once for nItemCount items, returns the bucket count
+        size_t grow_bucket_table_( size_t nItemCount )
+        {
+            size_t const nLoadFactor = m_Buckets.load_factor();
+            size_t szNew = m_nBucketCountLog2.load( memory_model::memory_order_relaxed );
+            while ( ( static_cast<size_t>( 1 ) << szNew ) < m_Buckets.capacity()
+                && max_item_count( static_cast<size_t>( 1 ) << szNew, nLoadFactor ) < nItemCount )
+            {
+                ++szNew;
+            }
+
+            size_t sz = m_nBucketCountLog2.load( memory_model::memory_order_relaxed );
+            while ( sz < szNew ) {
+                if ( m_nBucketCountLog2.compare_exchange_weak( sz, szNew, memory_model::memory_order_relaxed, atomics::memory_order_relaxed )) {
+                    m_nMaxItemCount.store( max_item_count( static_cast<size_t>( 1 ) << szNew, nLoadFactor ), memory_model::memory_order_relaxed );
+                    break;
+                }
+            }
+            return static_cast<size_t>( 1 ) << m_nBucketCountLog2.load( memory_model::memory_order_relaxed );
+        }
+
+        // bulk_load() support: initializes the buckets nFirst, nFirst + nStep, ... below nLast.
+        // Each bucket is initialized after its parent one, so its aux node is linked next to the parent's
+        void init_buckets_( size_t nFirst, size_t nStep, size_t nLast )
+        {
+            nLast = std::min( nLast, bucket_count());
+            for ( size_t nBucket = nFirst; nBucket < nLast; nBucket += nStep ) {
+                bucket_guard guard;
+                CDS_VERIFY( get_bucket( nBucket, guard ) != nullptr );
+            }
+        }
+
+        // bulk_load() support: inserts the items [pFirst, pLast), pHash[i] is the hash value of pFirst[i].
+        // The items are sorted in split-list order and merged into the list bucket by bucket,
+        // so the items of a bucket are published at once. The items not inserted are passed to fReject.
+        // The item counter is not changed, the caller adds the result to it
+        template <typename Func>
+        size_t bulk_insert_( value_type** pFirst, value_type** pLast, size_t const* pHash, Func fReject )
+        {
+            for ( value_type** p = pFirst; p != pLast; ++p )
+                node_traits::to_node_ptr( **p )->m_nHash = split_list::regular_hash<bit_reversal>( *pHash++ );
+
+            key_comparator cmp;
+            std::stable_sort( pFirst, pLast, [&cmp]( value_type const* p1, value_type const* p2 ) { return cmp( *p1, *p2 ) < 0; } );
+
+            auto bucket_of = [this]( value_type const* p ) {
+                return bucket_no( static_cast<size_t>( bit_reversal()( cds::details::size_t_cast( node_traits::to_node_ptr( *p )->m_nHash ))));
+            };
+
+            size_t nInserted = 0;
+            while ( pFirst != pLast ) {
+                size_t const nBucket = bucket_of( *pFirst );
+                value_type** pBucketEnd = pFirst + 1;
+                while ( pBucketEnd != pLast && bucket_of( *pBucketEnd ) == nBucket )
+                    ++pBucketEnd;
+
+                bucket_guard guard;
+                aux_node_type * pHead = get_bucket( nBucket, guard );
+                assert( pHead != nullptr );
+
+                size_t const n = m_List.merge_at( pHead, pFirst, pBucketEnd, fReject );
+                nInserted += n;
+                for ( size_t i = 0; i < n; ++i )
+                    m_Stat.onInsertSuccess();
+                for ( size_t i = n, nCount = static_cast<size_t>( pBucketEnd - pFirst ); i < nCount; ++i )
+                    m_Stat.onInsertFailed();
+                pFirst = pBucketEnd;
+            }
+            return nInserted;
+        }
+
+        bool insert_with_hash_( value_type& val, size_t nHash )
+        {
+            bucket_guard guard;
+            aux_node_type * pHead = get_bucket( nHash, guard );
+            assert( pHead != nullptr );
+
+            node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
+
+            if ( m_List.insert_at( pHead, val )) {
+                inc_item_count();
+                m_Stat.onInsertSuccess();
+                return true;
+            }
+            m_Stat.onInsertFailed();
+            return false;
+        }
+
+        template <typename Func>
+        bool insert_with_hash_( value_type& val, size_t nHash, Func f )
+        {
+            bucket_guard guard;
+            aux_node_type * pHead = get_bucket( nHash, guard );
+            assert( pHead != nullptr );
+
+            node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
+
+            if ( m_List.insert_at( pHead, val, f )) {
+                inc_item_count();
+                m_Stat.onInsertSuccess();
+                return true;
+            }
+            m_Stat.onInsertFailed();
+            return false;
+        }
+
+        template <typename Func>
+        std::pair<bool, bool> update_with_hash_( value_type& val, size_t nHash, Func func, bool bAllowInsert )
+        {
+            bucket_guard guard;
+            aux_node_type * pHead = get_bucket( nHash, guard );
+            assert( pHead != nullptr );
+
+            node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
+
+            std::pair<bool, bool> bRet = m_List.update_at( pHead, val, func, bAllowInsert );
+            if ( bRet.first && bRet.second ) {
+                inc_item_count();
+                m_Stat.onUpdateNew();
+            }
+            else
+                m_Stat.onUpdateExist();
+            return bRet;
+        }
+
         template <typename Q, typename Compare, typename Func>
         bool find_( Q& val, Compare cmp, Func f )
         {
-            size_t nHash = hash_value( val );
+            return find_with_hash_( val, hash_value( val ), cmp, f );
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        bool find_with_hash_( Q& val, size_t nHash, Compare cmp, Func f )
+        {
             split_list::details::search_value_type<Q>  sv( val, split_list::regular_hash<bit_reversal>( nHash ));
-            aux_node_type * pHead = get_bucket( nHash );
+            bucket_guard guard;
+            aux_node_type * pHead = get_bucket( nHash, guard );
             assert( pHead != nullptr );
 
             return m_Stat.onFind(
@@ -1307,9 +1829,15 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Compare>
         bool find_( Q const& val, Compare cmp )
         {
-            size_t nHash = hash_value( val );
+            return contains_with_hash_( val, hash_value( val ), cmp );
+        }
+
+        template <typename Q, typename Compare>
+        bool contains_with_hash_( Q const& val, size_t nHash, Compare cmp )
+        {
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash<bit_reversal>( nHash ));
-            aux_node_type * pHead = get_bucket( nHash );
+            bucket_guard guard;
+            aux_node_type * pHead = get_bucket( nHash, guard );
             assert( pHead != nullptr );
 
             return m_Stat.onFind( m_List.find_at( pHead, sv, cmp ));
@@ -1320,7 +1848,8 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hash_value( val );
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash<bit_reversal>( nHash ));
-            aux_node_type * pHead = get_bucket( nHash );
+            bucket_guard guard;
+            aux_node_type * pHead = get_bucket( nHash, guard );
             assert( pHead != nullptr );
 
             return iterator( m_List.find_iterator_at( pHead, sv, cmp ), m_List.end());
@@ -1331,7 +1860,8 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hash_value( val );
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash<bit_reversal>( nHash ));
-            aux_node_type * pHead = get_bucket( nHash );
+            bucket_guard guard;
+            aux_node_type * pHead = get_bucket( nHash, guard );
             assert( pHead != nullptr );
 
             guarded_ptr gp = m_List.get_at( pHead, sv, cmp );
@@ -1354,13 +1884,19 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Compare, typename Func>
         bool erase_( Q const& val, Compare cmp, Func f )
         {
-            size_t nHash = hash_value( val );
+            return erase_with_hash_( val, hash_value( val ), cmp, f );
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        bool erase_with_hash_( Q const& val, size_t nHash, Compare cmp, Func f )
+        {
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash<bit_reversal>( nHash ));
-            aux_node_type * pHead = get_bucket( nHash );
+            bucket_guard guard;
+            aux_node_type * pHead = get_bucket( nHash, guard );
             assert( pHead != nullptr );
 
             if ( m_List.erase_at( pHead, sv, cmp, f )) {
-                --m_ItemCounter;
+                dec_item_count();
                 m_Stat.onEraseSuccess();
                 return true;
             }
@@ -1371,13 +1907,19 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Compare>
         bool erase_( Q const& val, Compare cmp )
         {
-            size_t nHash = hash_value( val );
+            return erase_with_hash_( val, hash_value( val ), cmp );
+        }
+
+        template <typename Q, typename Compare>
+        bool erase_with_hash_( Q const& val, size_t nHash, Compare cmp )
+        {
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash<bit_reversal>( nHash ));
-            aux_node_type * pHead = get_bucket( nHash );
+            bucket_guard guard;
+            aux_node_type * pHead = get_bucket( nHash, guard );
             assert( pHead != nullptr );
 
             if ( m_List.erase_at( pHead, sv, cmp )) {
-                --m_ItemCounter;
+                dec_item_count();
                 m_Stat.onEraseSuccess();
                 return true;
             }
@@ -1390,12 +1932,13 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hash_value( val );
             split_list::details::search_value_type<Q const> sv( val, split_list::regular_hash<bit_reversal>( nHash ));
-            aux_node_type * pHead = get_bucket( nHash );
+            bucket_guard guard;
+            aux_node_type * pHead = get_bucket( nHash, guard );
             assert( pHead != nullptr );
 
             guarded_ptr gp = m_List.extract_at( pHead, sv, cmp );
             if ( gp ) {
-                --m_ItemCounter;
+                dec_item_count();
                 m_Stat.onExtractSuccess();
             }
             else
@@ -1431,6 +1974,11 @@ namespace cds { namespace intrusive {
         hash                    m_HashFunctor;      ///< Hash functor
         item_counter            m_ItemCounter;      ///< Item counter
         stat                    m_Stat;             ///< Internal statistics
+
+        atomics::atomic<bool>            m_bShrinking;  ///< \p true if a thread is shrinking the bucket table
+        atomics::atomic<aux_node_type *> m_pRetiredAux; ///< List of aux nodes removed by shrinking but not yet unlinked
+
+        static size_t const c_nReclaimMask = 1024 - 1; ///< Retired aux nodes are also reclaimed when the item count after erasing is a multiple of 1024
         //@endcond
     };
 
@@ -71,6 +71,9 @@ namespace cds { namespace intrusive {
         static_assert(!std::is_same<item_counter, cds::atomicity::empty_item_counter>::value,
             "cds::atomicity::empty_item_counter is not allowed as a item counter");
 
+        // Shrinking of the bucket table is supported only for gc::HP and gc::DHP
+        static_assert( traits::shrink_factor == 0, "split_list::shrink_factor is not supported for this GC" );
+
     protected:
         //@cond
         typedef typename ordered_list::node_type  list_node_type;  ///< Node type as declared in ordered list
@@ -7,6 +7,7 @@
 #define CDSLIB_INTRUSIVE_SPLIT_LIST_RCU_H
 
 #include <limits>
+#include <algorithm>
 
 #include <cds/intrusive/details/split_list_base.h>
 #include <cds/details/binary_functor_wrapper.h>
@@ -94,6 +95,8 @@ namespace cds { namespace intrusive {
         /// Group of \p extract_xxx functions require external locking if underlying ordered list requires that
         static constexpr const bool c_bExtractLockExternal = ordered_list::c_bExtractLockExternal;
 
+        static constexpr const size_t c_nFindBatchSize = 16; ///< Count of keys \p find_batch_() prefetches at once
+
         typedef typename traits::bit_reversal bit_reversal; ///< Bit reversal algorithm, see \p split_list::traits::bit_reversal
         typedef typename traits::item_counter item_counter; ///< Item counter type
         typedef typename traits::back_off     back_off;     ///< back-off strategy for spinning
@@ -107,6 +110,9 @@ namespace cds { namespace intrusive {
         static_assert( !std::is_same<item_counter, cds::atomicity::empty_item_counter>::value,
                         "cds::atomicity::empty_item_counter is not allowed as a item counter");
 
+        // Shrinking of the bucket table is supported only for gc::HP and gc::DHP
+        static_assert( traits::shrink_factor == 0, "split_list::shrink_factor is not supported for this GC" );
+
     protected:
         //@cond
         typedef typename ordered_list::node_type    list_node_type;  ///< Node type as declared in ordered list
@@ -157,6 +163,14 @@ namespace cds { namespace intrusive {
                 return base_class::insert_at( h, val, f );
             }
 
+            template <typename Func>
+            size_t merge_at( aux_node_type * pHead, value_type* const* pFirst, value_type* const* pLast, Func fReject )
+            {
+                assert( pHead != nullptr );
+                bucket_head_type h(pHead);
+                return base_class::merge_at( h, pFirst, pLast, fReject );
+            }
+
             template <typename Func>
             std::pair<bool, bool> update_at( aux_node_type * pHead, value_type& val, Func func, bool bAllowInsert )
             {
@@ -220,6 +234,11 @@ namespace cds { namespace intrusive {
                 return base_class::get_at( h, val, cmp );
             }
 
+            void prefetch_next( aux_node_type const* pHead ) const
+            {
+                base_class::prefetch_next( pHead );
+            }
+
             bool insert_aux_node( aux_node_type * pNode )
             {
                 return base_class::insert_aux_node( pNode );
@@ -295,19 +314,21 @@ namespace cds { namespace intrusive {
         */
         bool insert( value_type& val )
         {
-            size_t nHash = hash_value( val );
-            aux_node_type * pHead = get_bucket( nHash );
-            assert( pHead != nullptr );
+            return insert_with_hash_( val, hash_value( val ));
+        }
 
-            node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
+        /// Inserts new node with precomputed hash value
+        /** \anchor cds_intrusive_SplitListSet_rcu_insert_with_hash
+            The function is an analog of \p insert( value_type& ) but \p nHash is used as the hash value of \p val
+            instead of calling the hash functor. It is useful when the key is hashed once and then looked up in several sets.
 
-            if ( m_List.insert_at( pHead, val )) {
-                inc_item_count();
-                m_Stat.onInsertSuccess();
-                return true;
-            }
-            m_Stat.onInsertFailed();
-            return false;
+            \p nHash must be equal to the value of the set's hash functor for \p val; in debug mode it is checked by an assertion.
+            The same requirement is for all \p %_with_hash functions.
+        */
+        bool insert_with_hash( value_type& val, size_t nHash )
+        {
+            check_hash( val, nHash );
+            return insert_with_hash_( val, nHash );
         }
 
         /// Inserts new node
@@ -334,19 +355,19 @@ namespace cds { namespace intrusive {
         template <typename Func>
         bool insert( value_type& val, Func f )
         {
-            size_t nHash = hash_value( val );
-            aux_node_type * pHead = get_bucket( nHash );
-            assert( pHead != nullptr );
-
-            node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
+            return insert_with_hash_( val, hash_value( val ), f );
+        }
 
-            if ( m_List.insert_at( pHead, val, f )) {
-                inc_item_count();
-                m_Stat.onInsertSuccess();
-                return true;
-            }
-            m_Stat.onInsertFailed();
-            return false;
+        /// Inserts new node with precomputed hash value
+        /**
+            The function is an analog of \p insert( value_type&, Func ) but \p nHash is used as the hash value of \p val,
+            see \ref cds_intrusive_SplitListSet_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Func>
+        bool insert_with_hash( value_type& val, size_t nHash, Func f )
+        {
+            check_hash( val, nHash );
+            return insert_with_hash_( val, nHash, f );
         }
 
         /// Updates the node
@@ -382,20 +403,19 @@ namespace cds { namespace intrusive {
         template <typename Func>
         std::pair<bool, bool> update( value_type& val, Func func, bool bAllowInsert = true )
         {
-            size_t nHash = hash_value( val );
-            aux_node_type * pHead = get_bucket( nHash );
-            assert( pHead != nullptr );
-
-            node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
+            return update_with_hash_( val, hash_value( val ), func, bAllowInsert );
+        }
 
-            std::pair<bool, bool> bRet = m_List.update_at( pHead, val, func, bAllowInsert );
-            if ( bRet.first && bRet.second ) {
-                inc_item_count();
-                m_Stat.onUpdateNew();
-            }
-            else
-                m_Stat.onUpdateExist();
-            return bRet;
+        /// Updates the node with precomputed hash value
+        /**
+            The function is an analog of \p update() but \p nHash is used as the hash value of \p val,
+            see \ref cds_intrusive_SplitListSet_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Func>
+        std::pair<bool, bool> update_with_hash( value_type& val, size_t nHash, Func func, bool bAllowInsert = true )
+        {
+            check_hash( val, nHash );
+            return update_with_hash_( val, nHash, func, bAllowInsert );
         }
         //@cond
         template <typename Func>
@@ -456,6 +476,19 @@ namespace cds { namespace intrusive {
             return erase_( key, key_comparator());
         }
 
+        /// Deletes the item from the set using precomputed hash value of \p key
+        /**
+            The function is an analog of \ref cds_intrusive_SplitListSet_rcu_erase "erase(Q const&)"
+            but \p nHash is used as the hash value of \p key,
+            see \ref cds_intrusive_SplitListSet_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q>
+        bool erase_with_hash( Q const& key, size_t nHash )
+        {
+            check_hash( key, nHash );
+            return erase_with_hash_( key, nHash, key_comparator());
+        }
+
         /// Deletes the item from the set using \p pred for searching
         /**
             The function is an analog of \ref cds_intrusive_SplitListSet_rcu_erase "erase(Q const&)"
@@ -496,6 +529,18 @@ namespace cds { namespace intrusive {
             return erase_( key, key_comparator(), f );
         }
 
+        /// Deletes the item from the set using precomputed hash value of \p key
+        /**
+            The function is an analog of \ref cds_intrusive_SplitListSet_rcu_erase_func "erase(Q const&, Func)"
+            but \p nHash is used as the hash value of \p key.
+        */
+        template <typename Q, typename Func>
+        bool erase_with_hash( Q const& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            return erase_with_hash_( key, nHash, key_comparator(), f );
+        }
+
         /// Deletes the item from the set using \p pred for searching
         /**
             The function is an analog of \ref cds_intrusive_SplitListSet_rcu_erase_func "erase(Q const&, Func)"
@@ -604,6 +649,27 @@ namespace cds { namespace intrusive {
         }
         //@endcond
 
+        /// Finds the key \p key using precomputed hash value
+        /**
+            The function is an analog of \ref cds_intrusive_SplitListSet_rcu_find_func "find(Q&, Func)"
+            but \p nHash is used as the hash value of \p key,
+            see \ref cds_intrusive_SplitListSet_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        bool find_with_hash( Q& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            return find_with_hash_( key, nHash, key_comparator(), f );
+        }
+        //@cond
+        template <typename Q, typename Func>
+        bool find_with_hash( Q const& key, size_t nHash, Func f )
+        {
+            check_hash( key, nHash );
+            return find_with_hash_( key, nHash, key_comparator(), f );
+        }
+        //@endcond
+
         /// Finds the key \p key with \p pred predicate for comparing
         /**
             The function is an analog of \ref cds_intrusive_SplitListSet_rcu_find_func "find(Q&, Func)"
@@ -640,6 +706,18 @@ namespace cds { namespace intrusive {
         {
             return find_value( key, key_comparator());
         }
+
+        /// Checks whether the set contains \p key using precomputed hash value
+        /**
+            The function is an analog of <tt>contains( key )</tt> but \p nHash is used as the hash value of \p key,
+            see \ref cds_intrusive_SplitListSet_rcu_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q>
+        bool contains_with_hash( Q const& key, size_t nHash )
+        {
+            check_hash( key, nHash );
+            return find_value_with_hash( key, nHash, key_comparator());
+        }
         //@cond
         template <typename Q>
         CDS_DEPRECATED("deprecated, use contains()")
@@ -873,6 +951,15 @@ namespace cds { namespace intrusive {
             return m_HashFunctor( key );
         }
 
+        /// Checks (in debug mode only) that \p nHash passed to \p %_with_hash function is the hash value of \p key
+        template <typename Q>
+        void check_hash( Q const& key, size_t nHash ) const
+        {
+            assert( hash_value( key ) == nHash );
+            CDS_UNUSED( key );
+            CDS_UNUSED( nHash );
+        }
+
         size_t bucket_no( size_t nHash ) const
         {
             return nHash & ( (1 << m_nBucketCountLog2.load(memory_model::memory_order_relaxed)) - 1 );
@@ -985,10 +1072,184 @@ namespace cds { namespace intrusive {
                 m_nMaxItemCount.store( std::numeric_limits<size_t>::max(), memory_model::memory_order_relaxed );
         }
 
+        template <typename Q, typename Compare, typename Func>
+        size_t find_batch_( Q const* keys, size_t nCount, Compare cmp, Func f )
+        {
+            size_t arrHash[c_nFindBatchSize];
+            aux_node_type * arrHead[c_nFindBatchSize];
+            size_t nFound = 0;
+
+            rcu_lock l;
+            for ( size_t nFirst = 0; nFirst < nCount; nFirst += c_nFindBatchSize ) {
+                size_t const nGroupSize = nCount - nFirst < c_nFindBatchSize ? nCount - nFirst : c_nFindBatchSize;
+
+                // Hash the keys of the group and prefetch their entries of the bucket table
+                for ( size_t i = 0; i < nGroupSize; ++i ) {
+                    arrHash[i] = hash_value( keys[nFirst + i] );
+                    m_Buckets.prefetch( bucket_no( arrHash[i] ));
+                }
+
+                // Prefetch the bucket heads loaded from the table
+                for ( size_t i = 0; i < nGroupSize; ++i )
+                    prefetch_bucket( arrHash[i] );
+
+                // The first step of the list search: prefetch the first item node of each bucket
+                for ( size_t i = 0; i < nGroupSize; ++i ) {
+                    arrHead[i] = get_bucket( arrHash[i] );
+                    assert( arrHead[i] != nullptr );
+                    m_List.prefetch_next( arrHead[i] );
+                }
+
+                for ( size_t i = 0; i < nGroupSize; ++i ) {
+                    size_t const nIndex = nFirst + i;
+                    split_list::details::search_value_type<Q const> sv( keys[nIndex], split_list::regular_hash<bit_reversal>( arrHash[i] ));
+                    if ( m_Stat.onFind( m_List.find_at( arrHead[i], sv, cmp,
+                            [&f, nIndex]( value_type& item, split_list::details::search_value_type<Q const>& ) { f( nIndex, item ); } )))
+                    {
+                        ++nFound;
+                    }
+                }
+            }
+            return nFound;
+        }
+
+        void prefetch_bucket( size_t nHash ) const
+        {
+            // The bucket head is not protected: it is only prefetched, not dereferenced
+            aux_node_type * pHead = m_Buckets.bucket( bucket_no( nHash ));
+            if ( pHead )
+                cds_prefetch( pHead );
+        }
+
+        // bulk_load() support: grows the bucket table at once for nItemCount items, returns the bucket count
+        size_t grow_bucket_table_( size_t nItemCount )
+        {
+            size_t const nLoadFactor = m_Buckets.load_factor();
+            size_t szNew = m_nBucketCountLog2.load( memory_model::memory_order_relaxed );
+            while ( ( static_cast<size_t>( 1 ) << szNew ) < m_Buckets.capacity()
+                && max_item_count( static_cast<size_t>( 1 ) << szNew, nLoadFactor ) < nItemCount )
+            {
+                ++szNew;
+            }
+
+            size_t sz = m_nBucketCountLog2.load( memory_model::memory_order_relaxed );
+            while ( sz < szNew ) {
+                if ( m_nBucketCountLog2.compare_exchange_weak( sz, szNew, memory_model::memory_order_relaxed, atomics::memory_order_relaxed )) {
+                    m_nMaxItemCount.store( max_item_count( static_cast<size_t>( 1 ) << szNew, nLoadFactor ), memory_model::memory_order_relaxed );
+                    break;
+                }
+            }
+            return static_cast<size_t>( 1 ) << m_nBucketCountLog2.load( memory_model::memory_order_relaxed );
+        }
+
+        // bulk_load() support: initializes the buckets nFirst, nFirst + nStep, ... below nLast.
+        // Each bucket is initialized after its parent one, so its aux node is linked next to the parent's
+        void init_buckets_( size_t nFirst, size_t nStep, size_t nLast )
+        {
+            nLast = std::min( nLast, static_cast<size_t>( 1 ) << m_nBucketCountLog2.load( memory_model::memory_order_relaxed ));
+            for ( size_t nBucket = nFirst; nBucket < nLast; nBucket += nStep ) {
+                CDS_VERIFY( get_bucket( nBucket ) != nullptr );
+            }
+        }
+
+        // bulk_load() support: inserts the items [pFirst, pLast), pHash[i] is the hash value of pFirst[i].
+        // The items are sorted in split-list order and merged into the list bucket by bucket,
+        // so the items of a bucket are published at once. The items not inserted are passed to fReject.
+        // The item counter is not changed, the caller adds the result to it
+        template <typename Func>
+        size_t bulk_insert_( value_type** pFirst, value_type** pLast, size_t const* pHash, Func fReject )
+        {
+            for ( value_type** p = pFirst; p != pLast; ++p )
+                node_traits::to_node_ptr( **p )->m_nHash = split_list::regular_hash<bit_reversal>( *pHash++ );
+
+            key_comparator cmp;
+            std::stable_sort( pFirst, pLast, [&cmp]( value_type const* p1, value_type const* p2 ) { return cmp( *p1, *p2 ) < 0; } );
+
+            auto bucket_of = [this]( value_type const* p ) {
+                return bucket_no( static_cast<size_t>( bit_reversal()( cds::details::size_t_cast( node_traits::to_node_ptr( *p )->m_nHash ))));
+            };
+
+            size_t nInserted = 0;
+            while ( pFirst != pLast ) {
+                size_t const nBucket = bucket_of( *pFirst );
+                value_type** pBucketEnd = pFirst + 1;
+                while ( pBucketEnd != pLast && bucket_of( *pBucketEnd ) == nBucket )
+                    ++pBucketEnd;
+
+                aux_node_type * pHead = get_bucket( nBucket );
+                assert( pHead != nullptr );
+
+                size_t const n = m_List.merge_at( pHead, pFirst, pBucketEnd, fReject );
+                nInserted += n;
+                for ( size_t i = 0; i < n; ++i )
+                    m_Stat.onInsertSuccess();
+                for ( size_t i = n, nCount = static_cast<size_t>( pBucketEnd - pFirst ); i < nCount; ++i )
+                    m_Stat.onInsertFailed();
+                pFirst = pBucketEnd;
+            }
+            return nInserted;
+        }
+
+        bool insert_with_hash_( value_type& val, size_t nHash )
+        {
+            aux_node_type * pHead = get_bucket( nHash );
+            assert( pHead != nullptr );
+
+            node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
+
+            if ( m_List.insert_at( pHead, val )) {
+                inc_item_count();
+                m_Stat.onInsertSuccess();
+                return true;
+            }
+            m_Stat.onInsertFailed();
+            return false;
+        }
+
+        template <typename Func>
+        bool insert_with_hash_( value_type& val, size_t nHash, Func f )
+        {
+            aux_node_type * pHead = get_bucket( nHash );
+            assert( pHead != nullptr );
+
+            node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
+
+            if ( m_List.insert_at( pHead, val, f )) {
+                inc_item_count();
+                m_Stat.onInsertSuccess();
+                return true;
+            }
+            m_Stat.onInsertFailed();
+            return false;
+        }
+
+        template <typename Func>
+        std::pair<bool, bool> update_with_hash_( value_type& val, size_t nHash, Func func, bool bAllowInsert )
+        {
+            aux_node_type * pHead = get_bucket( nHash );
+            assert( pHead != nullptr );
+
+            node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash<bit_reversal>( nHash );
+
+            std::pair<bool, bool> bRet = m_List.update_at( pHead, val, func, bAllowInsert );
+            if ( bRet.first && bRet.second ) {
+                inc_item_count();
+                m_Stat.onUpdateNew();
+            }
+            else
+                m_Stat.onUpdateExist();
+            return bRet;
+        }
+
         template <typename Q, typename Compare, typename Func>
         bool find_( Q& val, Compare cmp, Func f )
         {
-            size_t nHash = hash_value( val );
+            return find_with_hash_( val, hash_value( val ), cmp, f );
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        bool find_with_hash_( Q& val, size_t nHash, Compare cmp, Func f )
+        {
             split_list::details::search_value_type<Q>  sv( val, split_list::regular_hash<bit_reversal>( nHash ));
             aux_node_type * pHead = get_bucket( nHash );
             assert( pHead != nullptr );
@@ -1000,7 +1261,12 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Compare>
         bool find_value( Q const& val, Compare cmp )
         {
-            size_t nHash = hash_value( val );
+            return find_value_with_hash( val, hash_value( val ), cmp );
+        }
+
+        template <typename Q, typename Compare>
+        bool find_value_with_hash( Q const& val, size_t nHash, Compare cmp )
+        {
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash<bit_reversal>( nHash ));
             aux_node_type * pHead = get_bucket( nHash );
             assert( pHead != nullptr );
@@ -1049,7 +1315,12 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Compare>
         bool erase_( const Q& val, Compare cmp )
         {
-            size_t nHash = hash_value( val );
+            return erase_with_hash_( val, hash_value( val ), cmp );
+        }
+
+        template <typename Q, typename Compare>
+        bool erase_with_hash_( const Q& val, size_t nHash, Compare cmp )
+        {
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash<bit_reversal>( nHash ));
             aux_node_type * pHead = get_bucket( nHash );
             assert( pHead != nullptr );
@@ -1066,7 +1337,12 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Compare, typename Func>
         bool erase_( Q const& val, Compare cmp, Func f )
         {
-            size_t nHash = hash_value( val );
+            return erase_with_hash_( val, hash_value( val ), cmp, f );
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        bool erase_with_hash_( Q const& val, size_t nHash, Compare cmp, Func f )
+        {
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash<bit_reversal>( nHash ));
             aux_node_type * pHead = get_bucket( nHash );
             assert( pHead != nullptr );
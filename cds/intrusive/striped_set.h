@@ -19,6 +19,29 @@ namespace cds { namespace intrusive {
             Resizing policy for \p intrusive::StripedSet, \p container::StripedSet and \p container::StripedMap.
         */
 
+        //@cond
+        namespace details {
+            // The lock for find(): scoped_cell_shared_lock if the mutex policy declares it
+            // and the lookup does not change the bucket, scoped_cell_lock otherwise
+            template <typename MutexPolicy, typename Bucket>
+            struct select_find_lock
+            {
+            private:
+                template <typename P>
+                static typename P::scoped_cell_shared_lock * test( typename P::scoped_cell_shared_lock * );
+                template <typename P>
+                static typename P::scoped_cell_lock * test( ... );
+
+            public:
+                typedef typename std::conditional<
+                    is_find_mutating< Bucket >::value,
+                    typename MutexPolicy::scoped_cell_lock,
+                    typename std::remove_pointer< decltype( test<MutexPolicy>( nullptr )) >::type
+                >::type type;
+            };
+        } // namespace details
+        //@endcond
+
     }   // namespace striped_set
 
     /// Striped hash set
@@ -48,7 +71,7 @@ namespace cds { namespace intrusive {
 
         The \p Options are:
         - \p opt::mutex_policy - concurrent access policy.
-            Available policies: \p striped_set::striping, \p striped_set::refinable.
+            Available policies: \p striped_set::striping, \p striped_set::rw_striping, \p striped_set::refinable.
             Default is \p %striped_set::striping.
         - \p cds::opt::hash - hash functor. Default option value see <tt>opt::v::hash_selector <opt::none></tt>
             which selects default hash functor for your compiler.
@@ -67,6 +90,8 @@ namespace cds { namespace intrusive {
             Note that the choose of resizing policy depends of \p Container type:
             for sequential containers like \p boost::intrusive::list the right policy can significantly improve performance.
             For other, non-sequential types of \p Container (like a \p boost::intrusive::set) the resizing policy is not so important.
+        - \p striped_set::incremental_resizing - moves the items to the new bucket table gradually instead of
+            stop-the-world rehashing. Default is <tt>striped_set::incremental_resizing<0></tt> - no incremental resizing.
         - \p cds::opt::buffer - an initialized buffer type used only for \p boost::intrusive::unordered_set.
             Default is <tt>cds::opt::v::initialized_static_buffer< cds::any_type, 256 > </tt>.
 
@@ -277,6 +302,7 @@ namespace cds { namespace intrusive {
             typedef cds::opt::none                  resizing_policy;
             typedef cds::opt::none                  compare;
             typedef cds::opt::none                  less;
+            static constexpr size_t const incremental_resizing = 0;
         };
 
         typedef typename cds::opt::make_options<
@@ -300,6 +326,11 @@ namespace cds { namespace intrusive {
 
         typedef cds::details::Allocator< bucket_type, allocator_type > bucket_allocator;  ///< bucket allocator type based on allocator_type
 
+        static size_t const c_nResizeStep = options::incremental_resizing; ///< Count of old buckets moved by an operation while incremental resizing, 0 - no incremental resizing
+
+        static_assert( c_nResizeStep == 0 || striped_set::is_lock_count_fixed< mutex_policy >::value,
+            "Incremental resizing requires a mutex policy with constant lock count" );
+
     protected:
         bucket_type *           m_Buckets;      ///< Bucket table
         atomics::atomic<size_t> m_nBucketMask;  ///< Bucket table size - 1. m_nBucketMask + 1 should be power of two.
@@ -309,6 +340,14 @@ namespace cds { namespace intrusive {
         mutex_policy    m_MutexPolicy   ;   ///< Mutex policy
         resizing_policy m_ResizingPolicy;   ///< Resizing policy
 
+        // Incremental resizing state; m_OldBuckets, m_nOldBucketMask and m_nResizeGeneration are changed under full lock only
+        bucket_type *               m_OldBuckets;       ///< Old bucket table being migrated, \p nullptr if no incremental resizing is in progress
+        size_t                      m_nOldBucketMask;   ///< Old bucket table size - 1
+        size_t                      m_nResizeGeneration;///< Incremental resizing generation
+        atomics::atomic<uint64_t>   m_nResizeCursor;    ///< Generation (high bits) and index (low bits) of next old bucket to migrate
+        atomics::atomic<size_t>     m_nResizeLimit;     ///< Old bucket table size while migrating, 0 otherwise
+        atomics::atomic<size_t>     m_nMigrated;        ///< Count of migrated old buckets
+
         static const size_t c_nMinimalCapacity = 16 ;   ///< Minimal capacity
 
     protected:
@@ -316,6 +355,10 @@ namespace cds { namespace intrusive {
         typedef typename mutex_policy::scoped_cell_lock     scoped_cell_lock;
         typedef typename mutex_policy::scoped_full_lock     scoped_full_lock;
         typedef typename mutex_policy::scoped_resize_lock   scoped_resize_lock;
+        typedef typename striped_set::details::select_find_lock< mutex_policy, bucket_type >::type scoped_find_lock;
+
+        static unsigned int const c_nCursorIndexBits = 40;
+        static uint64_t const c_nCursorIndexMask = ( uint64_t( 1 ) << c_nCursorIndexBits ) - 1;
         //@endcond
 
     protected:
@@ -344,26 +387,134 @@ namespace cds { namespace intrusive {
             return m_Hash( v );
         }
 
+        template <typename Q>
+        void check_hash( Q const& v, size_t nHash ) const
+        {
+            // nHash passed to %_with_hash function must be the hash value of v
+            assert( hashing( v ) == nHash );
+            CDS_UNUSED( v );
+            CDS_UNUSED( nHash );
+        }
+
         bucket_type * bucket( size_t nHash ) const noexcept
         {
             return m_Buckets + (nHash & m_nBucketMask.load( atomics::memory_order_relaxed ));
         }
 
-        template <typename Q, typename Func>
-        bool find_( Q& val, Func f )
+        bucket_type * old_bucket( size_t nHash ) const noexcept
         {
-            size_t nHash = hashing( val );
+            // The cell of nHash must be locked
+            return m_OldBuckets ? m_OldBuckets + ( nHash & m_nOldBucketMask ) : nullptr;
+        }
+
+        bucket_type * locked_bucket( size_t nHash )
+        {
+            // The cell of nHash must be locked exclusively.
+            // While incremental resizing, the old bucket of nHash is moved to the new table first
+            bucket_type * pOld = old_bucket( nHash );
+            if ( pOld )
+                move_bucket( pOld );
+            return bucket( nHash );
+        }
 
-            scoped_cell_lock sl( m_MutexPolicy, nHash );
-            return bucket( nHash )->find( val, f );
+        void move_bucket( bucket_type * pOld )
+        {
+            typedef typename bucket_type::iterator bucket_iterator;
+            bucket_iterator itEnd = pOld->end();
+            bucket_iterator itNext;
+            for ( bucket_iterator it = pOld->begin(); it != itEnd; it = itNext ) {
+                itNext = it;
+                ++itNext;
+                bucket( m_Hash( *it ))->move_item( *pOld, it );
+            }
+            pOld->clear();
+        }
+
+        template <typename Q, typename Func>
+        bool find_( Q& val, size_t nHash, Func f )
+        {
+            bool bFound;
+            {
+                scoped_find_lock sl( m_MutexPolicy, nHash );
+                bFound = bucket( nHash )->find( val, f );
+                if ( !bFound ) {
+                    bucket_type * pOld = old_bucket( nHash );
+                    bFound = pOld && pOld->find( val, f );
+                }
+            }
+            resize_step();
+            return bFound;
         }
 
         template <typename Q, typename Less, typename Func>
         bool find_with_( Q& val, Less pred, Func f )
         {
             size_t nHash = hashing( val );
-            scoped_cell_lock sl( m_MutexPolicy, nHash );
-            return bucket( nHash )->find( val, pred, f );
+            bool bFound;
+            {
+                scoped_find_lock sl( m_MutexPolicy, nHash );
+                bFound = bucket( nHash )->find( val, pred, f );
+                if ( !bFound ) {
+                    bucket_type * pOld = old_bucket( nHash );
+                    bFound = pOld && pOld->find( val, pred, f );
+                }
+            }
+            resize_step();
+            return bFound;
+        }
+
+        template <typename Func>
+        bool insert_( value_type& val, size_t nHash, Func f )
+        {
+            bool bOk;
+            bool bResize;
+            bucket_type * pBucket;
+            {
+                scoped_cell_lock sl( m_MutexPolicy, nHash );
+                pBucket = locked_bucket( nHash );
+                bOk = pBucket->insert( val, f );
+                bResize = bOk && m_ResizingPolicy( ++m_ItemCounter, *this, *pBucket );
+            }
+
+            if ( bResize )
+                resize();
+            resize_step();
+            return bOk;
+        }
+
+        template <typename Func>
+        std::pair<bool, bool> update_( value_type& val, size_t nHash, Func func, bool bAllowInsert )
+        {
+            std::pair<bool, bool> result;
+            bool bResize;
+            bucket_type * pBucket;
+            {
+                scoped_cell_lock sl( m_MutexPolicy, nHash );
+                pBucket = locked_bucket( nHash );
+
+                result = pBucket->update( val, func, bAllowInsert );
+                bResize = result.first && result.second && m_ResizingPolicy( ++m_ItemCounter, *this, *pBucket );
+            }
+
+            if ( bResize )
+                resize();
+            resize_step();
+            return result;
+        }
+
+        template <typename Q, typename Func>
+        value_type * erase_( Q const& val, size_t nHash, Func f )
+        {
+            value_type * pVal;
+            {
+                scoped_cell_lock sl( m_MutexPolicy, nHash );
+                pVal = locked_bucket( nHash )->erase( val, f );
+            }
+
+            if ( pVal )
+                --m_ItemCounter;
+            resize_step();
+            return pVal;
         }
 
         void internal_resize( size_t nNewCapacity )
@@ -376,28 +527,58 @@ namespace cds { namespace intrusive {
 
             alloc_bucket_table( nNewCapacity );
 
-            typedef typename bucket_type::iterator bucket_iterator;
             bucket_type * pEnd = pOldBuckets + nOldCapacity;
-            for ( bucket_type * pCur = pOldBuckets; pCur != pEnd; ++pCur ) {
-                bucket_iterator itEnd = pCur->end();
-                bucket_iterator itNext;
-                for ( bucket_iterator it = pCur->begin(); it != itEnd; it = itNext ) {
-                    itNext = it;
-                    ++itNext;
-                    bucket( m_Hash( *it ))->move_item( *pCur, it );
-                }
-                pCur->clear();
-            }
+            for ( bucket_type * pCur = pOldBuckets; pCur != pEnd; ++pCur )
+                move_bucket( pCur );
 
             free_bucket_table( pOldBuckets, nOldCapacity );
 
             m_ResizingPolicy.reset();
         }
 
+        void start_incremental_resize( size_t nNewCapacity )
+        {
+            // All locks are already locked!
+            // The old table is kept, its buckets are moved by resize_step() and locked_bucket()
+            m_MutexPolicy.resize( nNewCapacity );
+
+            size_t const nOldCapacity = bucket_count();
+            m_OldBuckets = m_Buckets;
+            m_nOldBucketMask = nOldCapacity - 1;
+            alloc_bucket_table( nNewCapacity );
+
+            ++m_nResizeGeneration;
+            m_nMigrated.store( 0, atomics::memory_order_relaxed );
+            m_nResizeCursor.store( cursor_generation(), atomics::memory_order_relaxed );
+            m_nResizeLimit.store( nOldCapacity, atomics::memory_order_release );
+
+            m_ResizingPolicy.reset();
+        }
+
+        uint64_t cursor_generation() const
+        {
+            // Generation bits of m_nResizeCursor for current resizing; the full lock or a cell lock must be held
+            return uint64_t( m_nResizeGeneration ) << c_nCursorIndexBits;
+        }
+
+        void drop_old_buckets()
+        {
+            // All locks are already locked! The old buckets must be empty
+            free_bucket_table( m_OldBuckets, m_nOldBucketMask + 1 );
+            m_OldBuckets = nullptr;
+            ++m_nResizeGeneration;
+            m_nResizeLimit.store( 0, atomics::memory_order_relaxed );
+        }
+
         void resize()
         {
             size_t nOldCapacity = bucket_count( atomics::memory_order_acquire );
 
+            if ( c_nResizeStep != 0 && m_nResizeLimit.load( atomics::memory_order_acquire ) != 0 ) {
+                // the previous incremental resizing is in progress
+                return;
+            }
+
             scoped_resize_lock al( m_MutexPolicy );
             if ( al.success()) {
                 if ( nOldCapacity != bucket_count( atomics::memory_order_acquire )) {
@@ -405,7 +586,49 @@ namespace cds { namespace intrusive {
                     return;
                 }
 
-                internal_resize( nOldCapacity * 2 );
+                if ( c_nResizeStep == 0 )
+                    internal_resize( nOldCapacity * 2 );
+                else if ( !m_OldBuckets )
+                    start_incremental_resize( nOldCapacity * 2 );
+            }
+        }
+
+        void resize_step()
+        {
+            // Moves up to c_nResizeStep old buckets to the new table. No lock should be held by the caller
+            if ( c_nResizeStep == 0 || m_nResizeLimit.load( atomics::memory_order_relaxed ) == 0 )
+                return;
+
+            for ( size_t nStep = 0; nStep < c_nResizeStep; ++nStep ) {
+                // Claim the next old bucket. The cursor contains the generation of the resizing,
+                // so the claim of a completed resizing cannot be confused with the claim of the next one
+                uint64_t nCursor = m_nResizeCursor.load( atomics::memory_order_relaxed );
+                do {
+                    if ( ( nCursor & c_nCursorIndexMask ) >= m_nResizeLimit.load( atomics::memory_order_relaxed ))
+                        return;
+                } while ( !m_nResizeCursor.compare_exchange_weak( nCursor, nCursor + 1, atomics::memory_order_relaxed, atomics::memory_order_relaxed ));
+
+                size_t const nIndex = static_cast<size_t>( nCursor & c_nCursorIndexMask );
+                uint64_t const nGeneration = nCursor & ~c_nCursorIndexMask;
+                bool bLast;
+                {
+                    // the cell of old bucket nIndex protects both of its new buckets since the lock count is constant
+                    scoped_cell_lock sl( m_MutexPolicy, nIndex );
+                    if ( !m_OldBuckets || nIndex > m_nOldBucketMask || nGeneration != cursor_generation()) {
+                        // the resizing has been completed already
+                        return;
+                    }
+
+                    move_bucket( m_OldBuckets + nIndex );
+                    bLast = m_nMigrated.fetch_add( 1, atomics::memory_order_relaxed ) == m_nOldBucketMask;
+                }
+
+                if ( bLast ) {
+                    scoped_full_lock sl( m_MutexPolicy );
+                    if ( m_OldBuckets && nGeneration == cursor_generation())
+                        drop_old_buckets();
+                    return;
+                }
             }
         }
 
@@ -417,6 +640,12 @@ namespace cds { namespace intrusive {
             : m_Buckets( nullptr )
             , m_nBucketMask( c_nMinimalCapacity - 1 )
             , m_MutexPolicy( c_nMinimalCapacity )
+            , m_OldBuckets( nullptr )
+            , m_nOldBucketMask( 0 )
+            , m_nResizeGeneration( 0 )
+            , m_nResizeCursor( 0 )
+            , m_nResizeLimit( 0 )
+            , m_nMigrated( 0 )
         {
             alloc_bucket_table( bucket_count());
         }
@@ -428,6 +657,12 @@ namespace cds { namespace intrusive {
             : m_Buckets( nullptr )
             , m_nBucketMask( calc_init_capacity(nCapacity) - 1 )
             , m_MutexPolicy( bucket_count())
+            , m_OldBuckets( nullptr )
+            , m_nOldBucketMask( 0 )
+            , m_nResizeGeneration( 0 )
+            , m_nResizeCursor( 0 )
+            , m_nResizeLimit( 0 )
+            , m_nMigrated( 0 )
         {
             alloc_bucket_table( bucket_count());
         }
@@ -444,6 +679,12 @@ namespace cds { namespace intrusive {
         , m_nBucketMask( ( nCapacity ? calc_init_capacity(nCapacity) : c_nMinimalCapacity ) - 1 )
         , m_MutexPolicy( bucket_count())
         , m_ResizingPolicy( resizingPolicy )
+        , m_OldBuckets( nullptr )
+        , m_nOldBucketMask( 0 )
+        , m_nResizeGeneration( 0 )
+        , m_nResizeCursor( 0 )
+        , m_nResizeLimit( 0 )
+        , m_nMigrated( 0 )
         {
             alloc_bucket_table( bucket_count());
         }
@@ -461,6 +702,12 @@ namespace cds { namespace intrusive {
         , m_nBucketMask( ( nCapacity ? calc_init_capacity(nCapacity) : c_nMinimalCapacity ) - 1 )
         , m_MutexPolicy( bucket_count())
         , m_ResizingPolicy( std::forward<resizing_policy>( resizingPolicy ))
+        , m_OldBuckets( nullptr )
+        , m_nOldBucketMask( 0 )
+        , m_nResizeGeneration( 0 )
+        , m_nResizeCursor( 0 )
+        , m_nResizeLimit( 0 )
+        , m_nMigrated( 0 )
         {
             alloc_bucket_table( bucket_count());
         }
@@ -469,6 +716,8 @@ namespace cds { namespace intrusive {
         ~StripedSet()
         {
             free_bucket_table( m_Buckets, bucket_count());
+            if ( m_OldBuckets )
+                free_bucket_table( m_OldBuckets, m_nOldBucketMask + 1 );
         }
 
     public:
@@ -500,20 +749,33 @@ namespace cds { namespace intrusive {
         template <typename Func>
         bool insert( value_type& val, Func f )
         {
-            bool bOk;
-            bool bResize;
-            size_t nHash = hashing( val );
-            bucket_type * pBucket;
-            {
-                scoped_cell_lock sl( m_MutexPolicy, nHash );
-                pBucket = bucket( nHash );
-                bOk = pBucket->insert( val, f );
-                bResize = bOk && m_ResizingPolicy( ++m_ItemCounter, *this, *pBucket );
-            }
+            return insert_( val, hashing( val ), f );
+        }
 
-            if ( bResize )
-                resize();
-            return bOk;
+        /// Inserts new node with precomputed hash value
+        /** \anchor cds_intrusive_StripedSet_insert_with_hash
+            The function is an analog of \p insert( value_type& ) but \p nHash is used as the hash value of \p val
+            instead of calling the hash functor. It is useful when the key is hashed once and then looked up in several sets.
+
+            \p nHash must be equal to the value of the set's hash functor for \p val; in debug mode it is checked by an assertion.
+            The same requirement is for all \p %_with_hash functions.
+        */
+        bool insert_with_hash( value_type& val, size_t nHash )
+        {
+            check_hash( val, nHash );
+            return insert_( val, nHash, []( value_type& ) {} );
+        }
+
+        /// Inserts new node with precomputed hash value
+        /**
+            The function is an analog of \p insert( value_type&, Func ) but \p nHash is used as the hash value of \p val,
+            see \ref cds_intrusive_StripedSet_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Func>
+        bool insert_with_hash( value_type& val, size_t nHash, Func f )
+        {
+            check_hash( val, nHash );
+            return insert_( val, nHash, f );
         }
 
         /// Updates the node
@@ -543,21 +805,7 @@ namespace cds { namespace intrusive {
         template <typename Func>
         std::pair<bool, bool> update( value_type& val, Func func, bool bAllowInsert = true )
         {
-            std::pair<bool, bool> result;
-            bool bResize;
-            size_t nHash = hashing( val );
-            bucket_type * pBucket;
-            {
-                scoped_cell_lock sl( m_MutexPolicy, nHash );
-                pBucket = bucket( nHash );
-
-                result = pBucket->update( val, func, bAllowInsert );
-                bResize = result.first && result.second && m_ResizingPolicy( ++m_ItemCounter, *this, *pBucket );
-            }
-
-            if ( bResize )
-                resize();
-            return result;
+            return update_( val, hashing( val ), func, bAllowInsert );
         }
         //@cond
         template <typename Func>
@@ -567,6 +815,18 @@ namespace cds { namespace intrusive {
         }
         //@endcond
 
+        /// Updates the node with precomputed hash value
+        /**
+            The function is an analog of \p update() but \p nHash is used as the hash value of \p val,
+            see \ref cds_intrusive_StripedSet_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Func>
+        std::pair<bool, bool> update_with_hash( value_type& val, size_t nHash, Func func, bool bAllowInsert = true )
+        {
+            check_hash( val, nHash );
+            return update_( val, nHash, func, bAllowInsert );
+        }
+
         /// Unlink the item \p val from the set
         /**
             The function searches the item \p val in the set and unlink it
@@ -582,11 +842,12 @@ namespace cds { namespace intrusive {
             size_t nHash = hashing( val );
             {
                 scoped_cell_lock sl( m_MutexPolicy, nHash );
-                bOk = bucket( nHash )->unlink( val );
+                bOk = locked_bucket( nHash )->unlink( val );
             }
 
             if ( bOk )
                 --m_ItemCounter;
+            resize_step();
             return bOk;
         }
 
@@ -638,16 +899,7 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Func>
         value_type * erase( Q const& val, Func f )
         {
-            size_t nHash = hashing( val );
-            value_type * pVal;
-            {
-                scoped_cell_lock sl( m_MutexPolicy, nHash );
-                pVal = bucket( nHash )->erase( val, f );
-            }
-
-            if ( pVal )
-                --m_ItemCounter;
-            return pVal;
+            return erase_( val, hashing( val ), f );
         }
 
         /// Deletes the item from the set using \p pred predicate for searching
@@ -664,14 +916,40 @@ namespace cds { namespace intrusive {
             value_type * pVal;
             {
                 scoped_cell_lock sl( m_MutexPolicy, nHash );
-                pVal = bucket( nHash )->erase( val, pred, f );
+                pVal = locked_bucket( nHash )->erase( val, pred, f );
             }
 
             if ( pVal )
                 --m_ItemCounter;
+            resize_step();
             return pVal;
         }
 
+        /// Deletes the item from the set using precomputed hash value of \p val
+        /**
+            The function is an analog of \ref cds_intrusive_StripedSet_erase "erase(Q const&)"
+            but \p nHash is used as the hash value of \p val,
+            see \ref cds_intrusive_StripedSet_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q>
+        value_type * erase_with_hash( Q const& val, size_t nHash )
+        {
+            check_hash( val, nHash );
+            return erase_( val, nHash, [](value_type const&) {} );
+        }
+
+        /// Deletes the item from the set using precomputed hash value of \p val
+        /**
+            The function is an analog of \ref cds_intrusive_StripedSet_erase_func "erase(Q const&, Func)"
+            but \p nHash is used as the hash value of \p val.
+        */
+        template <typename Q, typename Func>
+        value_type * erase_with_hash( Q const& val, size_t nHash, Func f )
+        {
+            check_hash( val, nHash );
+            return erase_( val, nHash, f );
+        }
+
         /// Find the key \p val
         /** \anchor cds_intrusive_StripedSet_find_func
             The function searches the item with key equal to \p val and calls the functor \p f for item found.
@@ -696,7 +974,7 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Func>
         bool find( Q& val, Func f )
         {
-            return find_( val, f );
+            return find_( val, hashing( val ), f );
         }
 
         /// Find the key \p val using \p pred predicate
@@ -733,8 +1011,29 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Func>
         bool find( Q const& val, Func f )
         {
-            return find_( val, f );
+            return find_( val, hashing( val ), f );
+        }
+
+        /// Finds the key \p val using precomputed hash value
+        /**
+            The function is an analog of \ref cds_intrusive_StripedSet_find_func "find(Q&, Func)"
+            but \p nHash is used as the hash value of \p val,
+            see \ref cds_intrusive_StripedSet_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q, typename Func>
+        bool find_with_hash( Q& val, size_t nHash, Func f )
+        {
+            check_hash( val, nHash );
+            return find_( val, nHash, f );
+        }
+        //@cond
+        template <typename Q, typename Func>
+        bool find_with_hash( Q const& val, size_t nHash, Func f )
+        {
+            check_hash( val, nHash );
+            return find_( val, nHash, f );
         }
+        //@endcond
 
         /// Find the key \p val using \p pred predicate
         /**
@@ -772,6 +1071,17 @@ namespace cds { namespace intrusive {
         }
         //@endcond
 
+        /// Checks whether the set contains \p key using precomputed hash value
+        /**
+            The function is an analog of <tt>contains( key )</tt> but \p nHash is used as the hash value of \p key,
+            see \ref cds_intrusive_StripedSet_insert_with_hash "insert_with_hash()".
+        */
+        template <typename Q>
+        bool contains_with_hash( Q const& key, size_t nHash )
+        {
+            return find_with_hash( key, nHash, [](value_type&, Q const& ) {} );
+        }
+
         /// Checks whether the set contains \p key using \p pred predicate for searching
         /**
             The function is an analog of <tt>contains( key )</tt> but \p pred is used for key comparing.
@@ -805,6 +1115,13 @@ namespace cds { namespace intrusive {
             bucket_type * pBucket = m_Buckets;
             for ( size_t i = 0; i < nBucketCount; ++i, ++pBucket )
                 pBucket->clear();
+
+            if ( m_OldBuckets ) {
+                pBucket = m_OldBuckets;
+                for ( size_t i = 0; i <= m_nOldBucketMask; ++i, ++pBucket )
+                    pBucket->clear();
+                drop_old_buckets();
+            }
             m_ItemCounter.reset();
         }
 
@@ -828,6 +1145,13 @@ namespace cds { namespace intrusive {
             bucket_type * pBucket = m_Buckets;
             for ( size_t i = 0; i < nBucketCount; ++i, ++pBucket )
                 pBucket->clear( disposer );
+
+            if ( m_OldBuckets ) {
+                pBucket = m_OldBuckets;
+                for ( size_t i = 0; i <= m_nOldBucketMask; ++i, ++pBucket )
+                    pBucket->clear( disposer );
+                drop_old_buckets();
+            }
             m_ItemCounter.reset();
         }
 
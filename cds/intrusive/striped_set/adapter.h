@@ -174,6 +174,17 @@ namespace cds { namespace intrusive {
             typedef typename type::value_type value_type  ;   ///< value type stored in the container
         };
 
+        /// Checks whether the lookup changes the bucket container
+        /**
+            Self-adjusting containers like \p boost::intrusive::splay_set reorganize itself on lookup,
+            so \p find() of such a bucket cannot be called concurrently even under the shared lock
+            of \p striped_set::rw_striping policy. The metafunction should be specialized
+            as \p std::true_type for such bucket types.
+        */
+        template <typename Bucket>
+        struct is_find_mutating: public std::false_type
+        {};
+
         //@cond
         struct adapted_sequential_container
         {
@@ -34,6 +34,11 @@ namespace cds { namespace intrusive { namespace striped_set {
         typedef details::boost_intrusive_set_adapter<container_type> type ;  ///< Result of the metafunction
 
     };
+
+    template <typename T, typename... BIOptons>
+    struct is_find_mutating< details::boost_intrusive_set_adapter< boost::intrusive::splay_set< T, BIOptons... >>>
+        : public std::true_type
+    {};
 #endif
 }}} // namespace cds::intrusive::striped_set
 //@endcond
@@ -263,6 +263,37 @@ namespace cds { namespace intrusive { namespace striped_set {
         {}
     };
 
+    /// [value-option] Incremental resizing of the bucket table
+    /**
+        By default (<tt>BucketsPerOp = 0</tt>) \p StripedSet resizes the bucket table in one go:
+        the resizing thread locks the entire lock array and rehashes all items,
+        so any other operation waits until the resizing is done.
+
+        If \p BucketsPerOp is positive, the resizing only allocates new bucket table of double capacity
+        and the items are moved to it gradually. Both tables coexist until the migration is completed:
+        - a modifying operation moves the old bucket of its key to the new table before changing it;
+        - after releasing its lock, each operation moves up to \p BucketsPerOp next old buckets;
+        - the lookups search the old bucket of the key too while it is not moved.
+
+        The operation that moves the last old bucket frees the old table.
+        A resizing request is ignored while the previous incremental resizing is not completed;
+        the resizing policy requests it again on a next insertion.
+
+        The incremental resizing requires a mutex policy with constant lock count,
+        see \p striped_set::is_lock_count_fixed: \p striping or \p rw_striping.
+    */
+    template <size_t BucketsPerOp>
+    struct incremental_resizing {
+        //@cond
+        template <typename Base> struct pack: public Base
+        {
+            enum: size_t {
+                incremental_resizing = BucketsPerOp
+            };
+        };
+        //@endcond
+    };
+
 }}} // namespace cds::intrusive::striped_set
 
 #endif // #define CDSLIB_INTRUSIVE_STRIPED_SET_RESIZING_POLICY_H
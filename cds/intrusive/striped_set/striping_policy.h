@@ -102,6 +102,66 @@ namespace cds { namespace intrusive { namespace striped_set {
     };
 
 
+    /// Reader-writer lock striping concurrent access policy
+    /**
+        This is one of available opt::mutex_policy option type for StripedSet
+
+        The policy is like \p striping but the lock array consists of reader-writer locks.
+        The modifying operations (insert, update, erase, clear, resize) lock the stripe exclusively,
+        \p find() and \p contains() lock the stripe in shared mode, so the lookups of the same stripe
+        do not block each other. The policy is intended for read-mostly sets and maps.
+
+        Note that \p find() functor is called under the shared lock,
+        therefore it may be called concurrently for the same item.
+        If the functor changes the item found, the change must be synchronized by the functor itself.
+        The bucket container should allow concurrent lookups; the self-adjusting containers like
+        \p boost::intrusive::splay_set are always locked exclusively.
+
+        Template arguments:
+        - \p SharedLock - the type of reader-writer lock. The default is \p cds::sync::shared_spin.
+            The lock should be default-constructible and should support \p std::shared_mutex interface:
+            \p lock(), \p unlock(), \p lock_shared(), \p unlock_shared().
+        - \p Alloc - allocator type used for lock array memory allocation. Default is \p CDS_DEFAULT_ALLOCATOR.
+    */
+    template <class SharedLock = cds::sync::shared_spin, class Alloc = CDS_DEFAULT_ALLOCATOR >
+    class rw_striping: public striping< SharedLock, Alloc >
+    {
+        //@cond
+        typedef striping< SharedLock, Alloc > base_class;
+        //@endcond
+    public:
+        typedef typename base_class::lock_type       lock_type;        ///< lock type
+        typedef typename base_class::allocator_type  allocator_type;   ///< allocator type
+        typedef typename base_class::lock_array_type lock_array_type;  ///< lock array type
+
+    public:
+        //@cond
+        class scoped_cell_shared_lock {
+            lock_type&  m_Lock;
+
+        public:
+            scoped_cell_shared_lock( rw_striping& policy, size_t nHash )
+                : m_Lock( policy.m_Locks.at( nHash & ( policy.m_Locks.size() - 1 )))
+            {
+                m_Lock.lock_shared();
+            }
+
+            ~scoped_cell_shared_lock()
+            {
+                m_Lock.unlock_shared();
+            }
+        };
+        //@endcond
+
+    public:
+        /// Constructor
+        rw_striping(
+            size_t nLockCount   ///< The size of lock array. Must be power of two.
+        )
+            : base_class( nLockCount )
+        {}
+    };
+
     /// Refinable concurrent access policy
     /**
         This is one of available opt::mutex_policy option type for StripedSet
@@ -359,6 +419,29 @@ namespace cds { namespace intrusive { namespace striped_set {
         }
     };
 
+    /// Checks whether the size of the lock array of \p MutexPolicy is constant
+    /**
+        If the lock array is never resized, the lock <tt>nHash mod L</tt> protects the bucket of \p nHash
+        in the bucket table of any capacity not less than \p L, where \p L is the size of lock array.
+        \p StripedSet relies on this property for incremental resizing, see \p striped_set::incremental_resizing.
+
+        The trait is \p true for \p striping and \p rw_striping, and \p false for \p refinable.
+        Specialize it for your own mutex policy if the policy does not resize the lock array.
+    */
+    template <typename MutexPolicy>
+    struct is_lock_count_fixed: public std::false_type
+    {};
+
+    //@cond
+    template <class Lock, class Alloc>
+    struct is_lock_count_fixed< striping< Lock, Alloc >>: public std::true_type
+    {};
+
+    template <class SharedLock, class Alloc>
+    struct is_lock_count_fixed< rw_striping< SharedLock, Alloc >>: public std::true_type
+    {};
+    //@endcond
+
 }}} // namespace cds::intrusive::striped_set
 
 #endif
@@ -0,0 +1,802 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_INTRUSIVE_TIMER_WHEEL_H
+#define CDSLIB_INTRUSIVE_TIMER_WHEEL_H
+
+#include <mutex>        // unique_lock
+#include <cds/intrusive/details/base.h>
+#include <cds/gc/default_gc.h>
+#include <cds/algo/atomic.h>
+#include <cds/algo/bitop.h>
+#include <cds/algo/backoff_strategy.h>
+#include <cds/sync/spinlock.h>
+#include <cds/details/allocator.h>
+
+namespace cds { namespace intrusive {
+
+    /// TimerWheel related definitions
+    /** @ingroup cds_intrusive_helper
+    */
+    namespace timer_wheel {
+
+        //@cond
+        template <typename Node>
+        struct entry;
+        //@endcond
+
+        /// Timer node
+        /**
+            The node is the anchor of the timer in the wheel. It points to the internal entry
+            allocated by \p TimerWheel::arm(), the entry is reclaimed by the garbage collector
+            after the timer is fired or cancelled.
+
+            Template parameters:
+            - \p GC - garbage collector used
+            - \p Tag - a \ref cds_intrusive_hook_tag "tag"
+        */
+        template <class GC, typename Tag = opt::none>
+        struct node
+        {
+            typedef GC  gc;     ///< Garbage collector
+            typedef Tag tag;    ///< tag
+
+            //@cond
+            typedef timer_wheel::entry<node> entry_type;
+            atomics::atomic<entry_type *> m_pEntry; // current entry, nullptr if the timer is not armed
+            //@endcond
+
+            node() noexcept
+                : m_pEntry( nullptr )
+            {}
+
+            /// Checks if the timer is armed
+            /**
+                The result is a snapshot: the timer can be fired or cancelled concurrently.
+            */
+            bool is_armed() const noexcept
+            {
+                return m_pEntry.load( atomics::memory_order_acquire ) != nullptr;
+            }
+        };
+
+        //@cond
+        // Entry states
+        // cancel() moves the entry from armed to cancelling, clears the node's link to the entry
+        // and only then marks it as cancelled. The wheel must not reclaim the entry in cancelling state,
+        // since concurrent cancel() may still protect it via the node's link; instead the wheel
+        // marks the entry as abandoned and the canceller reclaims it.
+        // The rescue path of insert() moves the timer to a new entry in the same way
+        // through moving and moved states; cancel() waits while the entry is moving.
+        enum entry_state: unsigned {
+            entry_armed,
+            entry_fired,
+            entry_cancelling,
+            entry_cancelled,
+            entry_abandoned,
+            entry_moving,
+            entry_moved
+        };
+
+        template <typename Node>
+        struct entry
+        {
+            atomics::atomic<entry *>    m_pNext;
+            Node *                      m_pNode;
+            uint64_t                    m_nDeadline;
+            atomics::atomic<unsigned>   m_nState;
+
+            entry( Node * pNode, uint64_t nDeadline ) noexcept
+                : m_pNext( nullptr )
+                , m_pNode( pNode )
+                , m_nDeadline( nDeadline )
+                , m_nState( entry_armed )
+            {}
+        };
+
+        struct default_hook {
+            typedef cds::gc::default_gc gc;
+            typedef opt::none           tag;
+        };
+
+        template < typename HookType, typename... Options>
+        struct hook
+        {
+            typedef typename opt::make_options< default_hook, Options...>::type  options;
+            typedef typename options::gc    gc;
+            typedef typename options::tag   tag;
+            typedef node<gc, tag>   node_type;
+            typedef HookType        hook_type;
+        };
+        //@endcond
+
+        /// Base hook
+        /**
+            \p Options are:
+            - \p opt::gc - garbage collector used.
+            - \p opt::tag - a \ref cds_intrusive_hook_tag "tag"
+        */
+        template < typename... Options >
+        struct base_hook: public hook< opt::base_hook_tag, Options... >
+        {};
+
+        /// Member hook
+        /**
+            \p MemberOffset specifies offset in bytes of \ref node member into your structure.
+            Use \p offsetof macro to define \p MemberOffset
+
+            \p Options are:
+            - \p opt::gc - garbage collector used.
+            - \p opt::tag - a \ref cds_intrusive_hook_tag "tag"
+        */
+        template < size_t MemberOffset, typename... Options >
+        struct member_hook: public hook< opt::member_hook_tag, Options... >
+        {
+            //@cond
+            static const size_t c_nMemberOffset = MemberOffset;
+            //@endcond
+        };
+
+        /// Traits hook
+        /**
+            \p NodeTraits defines type traits for node.
+            See \ref node_traits for \p NodeTraits interface description
+
+            \p Options are:
+            - \p opt::gc - garbage collector used.
+            - \p opt::tag - a \ref cds_intrusive_hook_tag "tag"
+        */
+        template <typename NodeTraits, typename... Options >
+        struct traits_hook: public hook< opt::traits_hook_tag, Options... >
+        {
+            //@cond
+            typedef NodeTraits node_traits;
+            //@endcond
+        };
+
+        /// TimerWheel internal statistics
+        template <typename Counter = cds::atomicity::event_counter>
+        struct stat {
+            typedef Counter counter_type;   ///< Event counter type
+
+            counter_type    m_nArm;             ///< Count of \p arm() call
+            counter_type    m_nArmFailed;       ///< Count of \p arm() call for the timer that is already armed
+            counter_type    m_nCancel;          ///< Count of successful \p cancel() call
+            counter_type    m_nCancelFailed;    ///< Count of \p cancel() call for the timer that is not armed
+            counter_type    m_nFire;            ///< Count of fired timers
+            counter_type    m_nTick;            ///< Count of processed ticks
+            counter_type    m_nCascade;         ///< Count of entries moved from an upper level of the wheel to a lower one
+            counter_type    m_nOverdue;         ///< Count of \p arm() call with the deadline that has already passed
+            counter_type    m_nRescue;          ///< Count of \p arm() race with the tick processing the slot of the timer
+            counter_type    m_nReclaim;         ///< Count of entries passed to the garbage collector
+            counter_type    m_nAdvanceContended; ///< Count of \p advance() call that found the wheel is advanced by another thread
+
+            //@cond
+            void onArm()            { ++m_nArm; }
+            void onArmFailed()      { ++m_nArmFailed; }
+            void onCancel()         { ++m_nCancel; }
+            void onCancelFailed()   { ++m_nCancelFailed; }
+            void onFire()           { ++m_nFire; }
+            void onTick()           { ++m_nTick; }
+            void onCascade()        { ++m_nCascade; }
+            void onOverdue()        { ++m_nOverdue; }
+            void onRescue()         { ++m_nRescue; }
+            void onReclaim()        { ++m_nReclaim; }
+            void onAdvanceContended() { ++m_nAdvanceContended; }
+            //@endcond
+        };
+
+        /// TimerWheel empty internal statistics
+        struct empty_stat {
+            //@cond
+            void onArm()            const {}
+            void onArmFailed()      const {}
+            void onCancel()         const {}
+            void onCancelFailed()   const {}
+            void onFire()           const {}
+            void onTick()           const {}
+            void onCascade()        const {}
+            void onOverdue()        const {}
+            void onRescue()         const {}
+            void onReclaim()        const {}
+            void onAdvanceContended() const {}
+            //@endcond
+        };
+
+        /// TimerWheel default traits
+        struct traits
+        {
+            /// Hook, possible types are \p timer_wheel::base_hook, \p timer_wheel::member_hook, \p timer_wheel::traits_hook
+            typedef timer_wheel::base_hook<> hook;
+
+            /// Number of bits of the slot index, the wheel level has <tt>2 ** slot_bits</tt> slots. Default is 6
+            static constexpr const unsigned slot_bits = 6;
+
+            /// Number of levels of the wheel. Default is 4
+            /**
+                The wheel covers <tt>2 ** (slot_bits * level_count)</tt> ticks.
+                The timers with more distant deadline are parked in the last level
+                and are rescheduled when the wheel turns around.
+            */
+            static constexpr const unsigned level_count = 4;
+
+            /// Allocator for internal timer entries
+            typedef CDS_DEFAULT_ALLOCATOR allocator;
+
+            /// Back-off strategy for slot push
+            typedef cds::backoff::Default back_off;
+
+            /// Lock serializing the wheel advancing, default is \p cds::sync::spin
+            typedef cds::sync::spin lock_type;
+
+            /// Item counting feature; by default, disabled. Use \p cds::atomicity::item_counter to count armed timers
+            typedef cds::atomicity::empty_item_counter item_counter;
+
+            /// Internal statistics, possible types are \p timer_wheel::stat, \p timer_wheel::empty_stat (the default)
+            typedef timer_wheel::empty_stat stat;
+        };
+
+        /// [type-option] Number of bits of the slot index
+        template <unsigned Bits>
+        struct slot_bits {
+            //@cond
+            template <class Base> struct pack: public Base
+            {
+                static constexpr const unsigned slot_bits = Bits;
+            };
+            //@endcond
+        };
+
+        /// [type-option] Number of levels of the wheel
+        template <unsigned Count>
+        struct level_count {
+            //@cond
+            template <class Base> struct pack: public Base
+            {
+                static constexpr const unsigned level_count = Count;
+            };
+            //@endcond
+        };
+
+        /// Metafunction converting option list to \p timer_wheel::traits
+        /**
+            \p Options are:
+            - \p opt::hook - hook used. Possible hooks are: \p timer_wheel::base_hook, \p timer_wheel::member_hook, \p timer_wheel::traits_hook.
+                If the option is not specified, \p %timer_wheel::base_hook<> is used.
+            - \p timer_wheel::slot_bits - number of bits of the slot index, default is 6.
+            - \p timer_wheel::level_count - number of levels of the wheel, default is 4.
+            - \p opt::allocator - allocator for internal timer entries. Default is \ref CDS_DEFAULT_ALLOCATOR.
+            - \p opt::back_off - back-off strategy for slot push. Default is \p cds::backoff::Default.
+            - \p opt::lock_type - lock serializing the wheel advancing. Default is \p cds::sync::spin.
+            - \p opt::item_counter - the type of item counting feature. Default is \p cds::atomicity::empty_item_counter.
+            - \p opt::stat - internal statistics. Possible types: \p timer_wheel::stat, \p timer_wheel::empty_stat (the default)
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                , Options...
+            >::type   type;
+#   endif
+        };
+
+    } // namespace timer_wheel
+
+    /// Hierarchical timer wheel
+    /** @ingroup cds_intrusive_priority_queue
+        Source:
+            - [1987] G.Varghese, T.Lauck "Hashed and Hierarchical Timing Wheels: Data Structures
+                for the Efficient Implementation of a Timer Facility"
+
+        The wheel consists of \p traits::level_count levels of <tt>2 ** traits::slot_bits</tt> slots.
+        The time is measured in abstract ticks of type \p uint64_t. A timer with the deadline \p D
+        is placed into the level \p k, where \p k is the highest slot-index bit group that differs
+        in \p D and in the current tick, so the slot \p s of the level \p k contains the timers
+        to be fired during <tt>2 ** (slot_bits * k)</tt> ticks. When the wheel passes the start tick of the slot
+        of an upper level, the timers of that slot are cascaded to lower levels.
+
+        Each slot is a lock-free single-linked list of timer entries. \p arm() allocates the entry
+        and pushes it to the slot, \p cancel() just marks the entry as cancelled; both are O(1).
+        Cancelled entries are excluded from the slot when the wheel processes it.
+        The entries are reclaimed by the garbage collector \p GC, so \p cancel() never accesses
+        the freed entry if the timer has been fired concurrently. The timer is the item of type \p T
+        with the \p timer_wheel::node hook. It can be re-armed right after it is cancelled or fired,
+        even in the expiry handler.
+
+        The wheel is advanced by \p advance() that processes all ticks up to the given one
+        and calls the expiry handler for each fired timer. Each tick is processed in batch:
+        the slot is detached from the wheel by one atomic exchange. Any thread can call \p advance();
+        if several threads call it concurrently, only one of them processes the ticks
+        and the others just pass their tick to it and return immediately.
+
+        Template parameters:
+        - \p GC - garbage collector: \p cds::gc::HP or \p cds::gc::DHP
+        - \p T - timer type with \p timer_wheel::node hook
+        - \p Traits - the traits, see \p timer_wheel::traits for explanation.
+            It is possible to declare option-based wheel with \p timer_wheel::make_traits
+            metafunction instead of \p Traits template argument.
+
+        @note The timer must not be destroyed while it is armed. If \p cancel() returns \p false
+        the expiry handler may be running in another thread.
+
+        Example:
+        \code
+        #include <cds/gc/hp.h>
+        #include <cds/intrusive/timer_wheel.h>
+
+        struct connection: public cds::intrusive::timer_wheel::node< cds::gc::HP >
+        {
+            // ...
+        };
+
+        typedef cds::intrusive::TimerWheel< cds::gc::HP, connection > timer_wheel;
+        timer_wheel wheel;
+
+        // arm the idle timeout
+        wheel.arm( conn, wheel.now() + 1000 );
+
+        // reset the idle timeout
+        if ( wheel.cancel( conn ))
+            wheel.arm( conn, wheel.now() + 1000 );
+
+        // the timer thread
+        wheel.advance( current_tick(), []( connection& c ) { c.close(); } );
+        \endcode
+    */
+    template <class GC, typename T, typename Traits = timer_wheel::traits>
+    class TimerWheel
+    {
+    public:
+        typedef GC      gc;         ///< Garbage collector
+        typedef T       value_type; ///< Timer type
+        typedef Traits  traits;     ///< Traits template parameter
+
+        typedef typename traits::hook       hook;       ///< hook type
+        typedef typename hook::node_type    node_type;  ///< node type
+        typedef typename get_node_traits< value_type, node_type, hook>::type node_traits ; ///< node traits
+        typedef typename traits::back_off   back_off;   ///< back-off strategy
+        typedef typename traits::lock_type  lock_type;  ///< advancing lock type
+        typedef typename traits::item_counter item_counter; ///< Item counter type
+        typedef typename traits::stat       stat;       ///< Internal statistics
+
+        static constexpr const unsigned c_nSlotBits = traits::slot_bits;     ///< Number of bits of the slot index
+        static constexpr const unsigned c_nLevelCount = traits::level_count; ///< Number of levels
+        static constexpr const size_t   c_nSlotCount = size_t(1) << c_nSlotBits; ///< Slot count per level
+
+        /// Count of hazard pointer required
+        static constexpr size_t const c_nHazardPtrCount = 1;
+
+        //@cond
+        static_assert( c_nSlotBits > 0 && c_nSlotBits <= 16, "slot_bits must be in range [1, 16]" );
+        static_assert( c_nLevelCount > 0, "level_count must be positive" );
+        static_assert( c_nSlotBits * c_nLevelCount < 64, "slot_bits * level_count must be less than 64" );
+        static_assert( std::is_same<gc, typename node_type::gc>::value, "GC and node_type::gc must be the same" );
+        //@endcond
+
+    protected:
+        //@cond
+        typedef typename node_type::entry_type entry_type;
+        typedef cds::details::Allocator< entry_type, typename traits::allocator > cxx_entry_allocator;
+
+        struct entry_disposer {
+            void operator()( entry_type * p ) const
+            {
+                cxx_entry_allocator().Delete( p );
+            }
+        };
+
+        static constexpr const uint64_t c_nSlotMask = c_nSlotCount - 1;
+        static constexpr const unsigned c_nWheelBits = c_nSlotBits * c_nLevelCount;
+
+        struct slot {
+            atomics::atomic<entry_type *>   pHead;  // lock-free list of entries
+            atomics::atomic<uint64_t>       nTick;  // the last tick when the slot has been processed
+
+            slot()
+                : pHead( nullptr )
+                , nTick( 0 )
+            {}
+        };
+
+        struct location {
+            slot *      pSlot;
+            uint64_t    nTick;  // the tick when the slot will be processed
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        slot                        m_Slots[c_nLevelCount][c_nSlotCount];
+        atomics::atomic<entry_type *> m_pOverdue;   // entries with the deadline has passed before arm()
+        atomics::atomic<uint64_t>   m_nNow;         // current tick
+        atomics::atomic<uint64_t>   m_nTarget;      // the tick up to which the wheel should be advanced
+        lock_type                   m_Lock;         // advancing lock
+        item_counter                m_ItemCounter;
+        stat                        m_Stat;
+        //@endcond
+
+    public:
+        /// Constructs the wheel with current tick \p nStartTick
+        explicit TimerWheel( uint64_t nStartTick = 0 )
+            : m_pOverdue( nullptr )
+            , m_nNow( nStartTick )
+            , m_nTarget( nStartTick )
+        {
+            for ( auto& level : m_Slots ) {
+                for ( slot& s : level )
+                    s.nTick.store( nStartTick, atomics::memory_order_relaxed );
+            }
+        }
+
+        /// Cancels all armed timers, see \p clear()
+        ~TimerWheel()
+        {
+            clear();
+        }
+
+        /// Arms the timer \p val to be fired at the tick \p nDeadline
+        /**
+            If the timer is already armed, the function returns \p false.
+            If \p nDeadline is not greater than \p now(), the timer is fired by the next \p advance() call.
+
+            The function is lock-free and does not depend on the number of armed timers.
+        */
+        bool arm( value_type& val, uint64_t nDeadline )
+        {
+            node_type * pNode = node_traits::to_node_ptr( val );
+            entry_type * pEntry = cxx_entry_allocator().New( pNode, nDeadline );
+
+            entry_type * pExpected = nullptr;
+            if ( !pNode->m_pEntry.compare_exchange_strong( pExpected, pEntry, atomics::memory_order_release, atomics::memory_order_relaxed )) {
+                cxx_entry_allocator().Delete( pEntry );
+                m_Stat.onArmFailed();
+                return false;
+            }
+
+            ++m_ItemCounter;
+            m_Stat.onArm();
+            insert( pEntry );
+            return true;
+        }
+
+        /// Cancels the timer \p val
+        /**
+            The function returns \p true if the timer has been cancelled.
+            If the timer is not armed or it has been fired already, the function returns \p false.
+
+            The function is lock-free and does not depend on the number of armed timers.
+            The entry of the cancelled timer stays in the wheel until the wheel processes its slot,
+            but the timer can be armed again immediately.
+        */
+        bool cancel( value_type& val )
+        {
+            node_type * pNode = node_traits::to_node_ptr( val );
+
+            typename gc::Guard guard;
+            back_off bkoff;
+            entry_type * pEntry;
+            while (( pEntry = guard.protect( pNode->m_pEntry )) != nullptr ) {
+                unsigned nState = timer_wheel::entry_armed;
+                if ( pEntry->m_nState.compare_exchange_strong( nState, timer_wheel::entry_cancelling, atomics::memory_order_acq_rel, atomics::memory_order_relaxed )) {
+                    pNode->m_pEntry.store( nullptr, atomics::memory_order_release );
+                    --m_ItemCounter;
+                    m_Stat.onCancel();
+
+                    // The entry is not reachable from the node anymore, it can be reclaimed
+                    if ( pEntry->m_nState.exchange( timer_wheel::entry_cancelled, atomics::memory_order_acq_rel ) == timer_wheel::entry_abandoned )
+                        reclaim( pEntry );
+                    return true;
+                }
+                if ( nState != timer_wheel::entry_moving && nState != timer_wheel::entry_moved )
+                    break;
+
+                // The timer is being moved to a new entry by insert(), retry with the new entry
+                bkoff();
+            }
+            m_Stat.onCancelFailed();
+            return false;
+        }
+
+        /// Advances the wheel to the tick \p nTick
+        /**
+            The function processes all ticks from <tt>now() + 1</tt> to \p nTick and fires the timers
+            whose deadline has come. For each fired timer the expiry handler \p f is called:
+            \code
+            void f( value_type& timer );
+            \endcode
+            The timer can be re-armed in \p f.
+
+            If the wheel is being advanced by another thread, the function passes \p nTick to that thread
+            and returns immediately. The function returns the number of timers fired by the current call.
+        */
+        template <typename Func>
+        size_t advance( uint64_t nTick, Func f )
+        {
+            uint64_t nTarget = m_nTarget.load( atomics::memory_order_relaxed );
+            while ( nTarget < nTick && !m_nTarget.compare_exchange_weak( nTarget, nTick, atomics::memory_order_seq_cst, atomics::memory_order_relaxed ));
+            atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+
+            size_t nFired = 0;
+            do {
+                std::unique_lock<lock_type> lock( m_Lock, std::try_to_lock );
+                if ( !lock.owns_lock()) {
+                    m_Stat.onAdvanceContended();
+                    break;
+                }
+
+                nTarget = m_nTarget.load( atomics::memory_order_acquire );
+                for ( uint64_t t = m_nNow.load( atomics::memory_order_relaxed ) + 1; t <= nTarget; ++t ) {
+                    m_nNow.store( t, atomics::memory_order_seq_cst );
+                    nFired += process_tick( t, f );
+                }
+                nFired += fire_overdue( f );
+
+                lock.unlock();
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+            } while ( m_nNow.load( atomics::memory_order_acquire ) < m_nTarget.load( atomics::memory_order_acquire ));
+
+            return nFired;
+        }
+
+        /// Advances the wheel to the tick \p nTick, the fired timers are just excluded from the wheel
+        size_t advance( uint64_t nTick )
+        {
+            return advance( nTick, []( value_type& ) {} );
+        }
+
+        /// Returns current tick of the wheel
+        uint64_t now() const
+        {
+            return m_nNow.load( atomics::memory_order_acquire );
+        }
+
+        /// Cancels all armed timers
+        /**
+            The function is not atomic: the timers armed concurrently may stay in the wheel.
+            The function should not be called concurrently with \p advance().
+        */
+        void clear()
+        {
+            for ( auto& level : m_Slots ) {
+                for ( slot& s : level )
+                    clear_list( s.pHead.exchange( nullptr, atomics::memory_order_acq_rel ));
+            }
+            clear_list( m_pOverdue.exchange( nullptr, atomics::memory_order_acq_rel ));
+        }
+
+        /// Checks if the wheel has no armed timers
+        /**
+            The function is meaningful only if \p traits::item_counter is not \p atomicity::empty_item_counter.
+        */
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /// Returns the number of armed timers
+        /**
+            The function is meaningful only if \p traits::item_counter is not \p atomicity::empty_item_counter.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter.value();
+        }
+
+        /// Returns the range of the wheel in ticks
+        /**
+            The timers with more distant deadline are rescheduled when the wheel turns around.
+        */
+        static constexpr uint64_t range()
+        {
+            return uint64_t(1) << c_nWheelBits;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        location locate( uint64_t nDeadline, uint64_t nNow )
+        {
+            assert( nDeadline > nNow );
+
+            uint64_t const nDiff = nDeadline ^ nNow;
+            if ( nDiff >> c_nWheelBits ) {
+                // Too distant deadline: park the entry in the slot 0 of the last level,
+                // the slot is processed when the wheel turns around
+                return location{ &m_Slots[c_nLevelCount - 1][0], (( nNow >> c_nWheelBits ) + 1 ) << c_nWheelBits };
+            }
+
+            unsigned const nLevel = static_cast<unsigned>( cds::bitop::MSBnz( nDiff )) / c_nSlotBits;
+            unsigned const nShift = nLevel * c_nSlotBits;
+            return location{ &m_Slots[nLevel][( nDeadline >> nShift ) & c_nSlotMask], ( nDeadline >> nShift ) << nShift };
+        }
+
+        void push( atomics::atomic<entry_type *>& head, entry_type * pEntry )
+        {
+            back_off bkoff;
+            entry_type * pHead = head.load( atomics::memory_order_relaxed );
+            do {
+                pEntry->m_pNext.store( pHead, atomics::memory_order_relaxed );
+                if ( head.compare_exchange_weak( pHead, pEntry, atomics::memory_order_seq_cst, atomics::memory_order_relaxed ))
+                    break;
+                bkoff();
+            } while ( true );
+        }
+
+        // Inserts the entry from arm() or the new entry of the rescued timer
+        void insert( entry_type * pEntry )
+        {
+            uint64_t const nNow = m_nNow.load( atomics::memory_order_seq_cst );
+            if ( pEntry->m_nDeadline <= nNow ) {
+                m_Stat.onOverdue();
+                push( m_pOverdue, pEntry );
+                return;
+            }
+
+            location loc = locate( pEntry->m_nDeadline, nNow );
+            push( loc.pSlot->pHead, pEntry );
+
+            if ( loc.pSlot->nTick.load( atomics::memory_order_seq_cst ) >= loc.nTick ) {
+                // The wheel might process the slot before the entry has been pushed.
+                // Only our entry is rescued: other late entries are rescued by their inserters,
+                // the rest of the slot belongs to the next turn of the wheel
+                m_Stat.onRescue();
+                rescue( pEntry );
+            }
+        }
+
+        // Moves the timer of pEntry to a new entry inserted relative to the new current tick.
+        // pEntry cannot be unlinked from the middle of the slot list, so it stays there
+        // as a dropped entry until the wheel processes the slot
+        void rescue( entry_type * pEntry )
+        {
+            node_type * pNode = pEntry->m_pNode;
+            entry_type * pNew = cxx_entry_allocator().New( pNode, pEntry->m_nDeadline );
+
+            unsigned nState = timer_wheel::entry_armed;
+            if ( !pEntry->m_nState.compare_exchange_strong( nState, timer_wheel::entry_moving, atomics::memory_order_acq_rel, atomics::memory_order_relaxed )) {
+                // The timer has been cancelled or fired on the next turn of the wheel
+                cxx_entry_allocator().Delete( pNew );
+                return;
+            }
+
+            pNode->m_pEntry.store( pNew, atomics::memory_order_release );
+            if ( pEntry->m_nState.exchange( timer_wheel::entry_moved, atomics::memory_order_acq_rel ) == timer_wheel::entry_abandoned )
+                reclaim( pEntry );
+
+            insert( pNew );
+        }
+
+        template <typename Func>
+        size_t process_tick( uint64_t nTick, Func& f )
+        {
+            m_Stat.onTick();
+            size_t nFired = 0;
+
+            if ( c_nLevelCount > 1 && ( nTick & c_nSlotMask ) == 0 ) {
+                // Cascade upper levels starting from the highest one whose slot starts at nTick
+                unsigned nLevel = 1;
+                while ( nLevel + 1 < c_nLevelCount && ( nTick & (( uint64_t(1) << ( c_nSlotBits * ( nLevel + 1 ))) - 1 )) == 0 )
+                    ++nLevel;
+                for ( ; nLevel > 0; --nLevel )
+                    nFired += process_slot( m_Slots[nLevel][( nTick >> ( c_nSlotBits * nLevel )) & c_nSlotMask], nTick, f );
+            }
+
+            return nFired + process_slot( m_Slots[0][nTick & c_nSlotMask], nTick, f );
+        }
+
+        template <typename Func>
+        size_t process_slot( slot& s, uint64_t nTick, Func& f )
+        {
+            s.nTick.store( nTick, atomics::memory_order_seq_cst );
+            entry_type * p = s.pHead.exchange( nullptr, atomics::memory_order_seq_cst );
+
+            size_t nFired = 0;
+            while ( p ) {
+                entry_type * pNext = p->m_pNext.load( atomics::memory_order_relaxed );
+                if ( is_cancelled( p ))
+                    drop_cancelled( p );
+                else if ( p->m_nDeadline <= nTick ) {
+                    if ( fire( p, f ))
+                        ++nFired;
+                }
+                else {
+                    // Cascade: the slot processed after nTick is never processed yet,
+                    // so the rescue check is not needed
+                    m_Stat.onCascade();
+                    push( locate( p->m_nDeadline, nTick ).pSlot->pHead, p );
+                }
+                p = pNext;
+            }
+            return nFired;
+        }
+
+        template <typename Func>
+        size_t fire_overdue( Func& f )
+        {
+            entry_type * p = m_pOverdue.exchange( nullptr, atomics::memory_order_acq_rel );
+            size_t nFired = 0;
+            while ( p ) {
+                entry_type * pNext = p->m_pNext.load( atomics::memory_order_relaxed );
+                if ( fire( p, f ))
+                    ++nFired;
+                p = pNext;
+            }
+            return nFired;
+        }
+
+        template <typename Func>
+        bool fire( entry_type * pEntry, Func& f )
+        {
+            unsigned nState = timer_wheel::entry_armed;
+            if ( pEntry->m_nState.compare_exchange_strong( nState, timer_wheel::entry_fired, atomics::memory_order_acq_rel, atomics::memory_order_relaxed )) {
+                node_type * pNode = pEntry->m_pNode;
+                pNode->m_pEntry.store( nullptr, atomics::memory_order_release );
+                --m_ItemCounter;
+                m_Stat.onFire();
+                reclaim( pEntry );
+                f( *node_traits::to_value_ptr( pNode ));
+                return true;
+            }
+
+            // cancelled concurrently
+            drop_cancelled( pEntry );
+            return false;
+        }
+
+        void clear_list( entry_type * p )
+        {
+            while ( p ) {
+                entry_type * pNext = p->m_pNext.load( atomics::memory_order_relaxed );
+                unsigned nState = timer_wheel::entry_armed;
+                if ( p->m_nState.compare_exchange_strong( nState, timer_wheel::entry_cancelled, atomics::memory_order_acq_rel, atomics::memory_order_relaxed )) {
+                    p->m_pNode->m_pEntry.store( nullptr, atomics::memory_order_release );
+                    --m_ItemCounter;
+                    reclaim( p );
+                }
+                else
+                    drop_cancelled( p );
+                p = pNext;
+            }
+        }
+
+        static bool is_cancelled( entry_type * p )
+        {
+            unsigned const nState = p->m_nState.load( atomics::memory_order_acquire );
+            return nState == timer_wheel::entry_cancelling || nState == timer_wheel::entry_cancelled
+                || nState == timer_wheel::entry_moving || nState == timer_wheel::entry_moved;
+        }
+
+        // Drops the cancelled or moved entry from the wheel.
+        // If cancel() or rescue() has not changed the node's link yet, the entry is reclaimed by them
+        void drop_cancelled( entry_type * p )
+        {
+            unsigned nState = p->m_nState.load( atomics::memory_order_acquire );
+            while ( nState == timer_wheel::entry_cancelling || nState == timer_wheel::entry_moving ) {
+                if ( p->m_nState.compare_exchange_weak( nState, timer_wheel::entry_abandoned, atomics::memory_order_acq_rel, atomics::memory_order_acquire ))
+                    return;
+            }
+            assert( nState == timer_wheel::entry_cancelled || nState == timer_wheel::entry_moved );
+            reclaim( p );
+        }
+
+        void reclaim( entry_type * p )
+        {
+            m_Stat.onReclaim();
+            gc::template retire<entry_disposer>( p );
+        }
+        //@endcond
+    };
+
+}} // namespace cds::intrusive
+
+#endif // #ifndef CDSLIB_INTRUSIVE_TIMER_WHEEL_H
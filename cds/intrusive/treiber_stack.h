@@ -106,6 +106,11 @@ namespace cds { namespace intrusive {
             counter_type m_PassivePushCollision ; ///< Count of passive push collision for elimination back-off
             counter_type m_PassivePopCollision  ; ///< Count of passive pop collision for elimination back-off
             counter_type m_EliminationFailed    ; ///< Count of unsuccessful elimination back-off
+            counter_type m_EliminationSkipped   ; ///< Count of elimination back-off skipped due to low contention (adaptive elimination only)
+            counter_type m_EliminationExpand    ; ///< Count of elimination array active width expanding (adaptive elimination only)
+            counter_type m_EliminationShrink    ; ///< Count of elimination array active width shrinking (adaptive elimination only)
+            counter_type m_PushChainCount       ; ///< Count of \p push_chain() calls; the items pushed are counted in \p m_PushCount
+            counter_type m_PopAllCount          ; ///< Count of nonempty \p pop_all() calls; the items popped are counted in \p m_PopCount
 
             //@cond
             void onPush()               { ++m_PushCount; }
@@ -130,6 +135,19 @@ namespace cds { namespace intrusive {
             {
                 ++m_EliminationFailed;
             }
+            void onEliminationSkipped()     { ++m_EliminationSkipped; }
+            void onEliminationExpand()      { ++m_EliminationExpand; }
+            void onEliminationShrink()      { ++m_EliminationShrink; }
+            void onPushChain( size_t nCount )
+            {
+                ++m_PushChainCount;
+                m_PushCount += nCount;
+            }
+            void onPopAll( size_t nCount )
+            {
+                ++m_PopAllCount;
+                m_PopCount += nCount;
+            }
             //@endcond
         };
 
@@ -144,6 +162,11 @@ namespace cds { namespace intrusive {
             void onActiveCollision( operation_id )  {}
             void onPassiveCollision( operation_id ) {}
             void onEliminationFailed() {}
+            void onEliminationSkipped() {}
+            void onEliminationExpand()  {}
+            void onEliminationShrink()  {}
+            void onPushChain( size_t )  {}
+            void onPopAll( size_t )     {}
             //@endcond
         };
 
@@ -208,9 +231,40 @@ namespace cds { namespace intrusive {
             /// Lock type used in elimination, default is cds::sync::spin
             typedef cds::sync::spin lock_type;
 
+            /// Adaptive elimination, default is \p false
+            /**
+                If \p true, the active width of the elimination array and the collision wait time
+                are adapted at runtime, see \p treiber_stack::adaptive_elimination.
+                \p elimination_backoff is not used in adaptive mode.
+            */
+            static constexpr const bool adaptive_elimination = false;
+
             ///@}
         };
 
+        /// [type-option] Enables adaptive elimination back-off
+        /**
+            In adaptive mode the elimination back-off tunes itself by observed collisions
+            (the idea is taken from Hendler et al. adaptive elimination policy):
+            - the active width of the elimination array (from 1 up to the buffer capacity) grows when a thread
+              finds the elimination slot occupied by the operation of the same kind
+              and shrinks when a thread waits for the collision in vain;
+            - the collision wait is a spin loop that becomes longer after the failed elimination
+              and shorter after the successful one;
+            - if elimination fails persistently, the back-off skips the elimination array
+              and uses plain \p traits::back_off, sampling the elimination array from time to time.
+              So, the elimination has near-zero overhead when the contention is low.
+        */
+        template <bool Enable>
+        struct adaptive_elimination {
+            //@cond
+            template <class Base> struct pack: public Base
+            {
+                static constexpr const bool adaptive_elimination = Enable;
+            };
+            //@endcond
+        };
+
         /// Metafunction converting option list to \p treiber_stack::traits
         /**
             Supported \p Options are:
@@ -239,6 +293,7 @@ namespace cds { namespace intrusive {
             - \p opt::elimination_storage - a storage class for elmination records. Default is \p cds::algo::elimination::storage.
             - \p opt::elimination_backoff - back-off strategy to wait for elimination, default is \p cds::backoff::delay<>
             - \p opt::lock_type - a lock type used in elimination back-off, default is \p cds::sync::spin
+            - \p treiber_stack::adaptive_elimination - adapt elimination array width and collision wait at runtime, default is \p false
 
             Example: declare \p %TreiberStack with elimination enabled and internal statistics
             \code
@@ -322,6 +377,9 @@ namespace cds { namespace intrusive {
                 /// Random engine used in elimination back-off
                 typedef typename Traits::random_engine elimination_random_engine;
 
+                /// Adaptive elimination
+                static constexpr const bool c_bAdaptive = Traits::adaptive_elimination;
+
                 /// Per-thread elimination record
                 typedef cds::algo::elimination::record  elimination_rec;
 
@@ -355,6 +413,21 @@ namespace cds { namespace intrusive {
 
                 elimination_data m_Elimination;
 
+                // Adaptive elimination state. The heuristic values are updated without synchronization
+                enum: unsigned {
+                    c_nMinSpin = 16,            // min collision wait, in spins
+                    c_nMaxSpin = 16 * 1024,     // max collision wait, in spins
+                    c_nInitialSpin = 256
+                };
+                enum: int {
+                    c_nScoreLimit = 32,         // elimination is skipped when the score drops to -c_nScoreLimit
+                    c_nSampleMask = 15          // the elimination is tried once per (c_nSampleMask + 1) skipped back-offs
+                };
+
+                atomics::atomic<size_t>     m_nWidth;   // active width of collision array
+                atomics::atomic<unsigned>   m_nSpin;    // collision wait
+                atomics::atomic<int>        m_nScore;   // elimination success score
+
                 enum operation_status {
                     op_free = 0,
                     op_waiting = 1,
@@ -366,25 +439,108 @@ namespace cds { namespace intrusive {
                 template <bool Exp2 = collision_array::c_bExp2>
                 typename std::enable_if< Exp2, size_t >::type slot_index() const
                 {
+                    constexpr_if( c_bAdaptive )
+                        return m_Elimination.randEngine() % m_nWidth.load( atomics::memory_order_relaxed );
                     return m_Elimination.randEngine() & (m_Elimination.collisions.capacity() - 1);
                 }
 
                 template <bool Exp2 = collision_array::c_bExp2>
                 typename std::enable_if< !Exp2, size_t >::type slot_index() const
                 {
+                    constexpr_if( c_bAdaptive )
+                        return m_Elimination.randEngine() % m_nWidth.load( atomics::memory_order_relaxed );
                     return m_Elimination.randEngine() % m_Elimination.collisions.capacity();
                 }
 
+                template <typename Stat>
+                void expand( Stat& stat )
+                {
+                    size_t const nWidth = m_nWidth.load( atomics::memory_order_relaxed );
+                    if ( nWidth < m_Elimination.collisions.capacity()) {
+                        m_nWidth.store( nWidth + 1, atomics::memory_order_relaxed );
+                        stat.onEliminationExpand();
+                    }
+                }
+
+                template <typename Stat>
+                void on_collided( Stat& )
+                {
+                    int const nScore = m_nScore.load( atomics::memory_order_relaxed );
+                    if ( nScore < c_nScoreLimit )
+                        m_nScore.store( nScore < 0 ? 0 : nScore + 1, atomics::memory_order_relaxed );
+
+                    unsigned const nSpin = m_nSpin.load( atomics::memory_order_relaxed );
+                    if ( nSpin > c_nMinSpin )
+                        m_nSpin.store( nSpin - nSpin / 8, atomics::memory_order_relaxed );
+                }
+
+                template <typename Stat>
+                void on_failed( Stat& stat )
+                {
+                    int const nScore = m_nScore.load( atomics::memory_order_relaxed );
+                    if ( nScore > -c_nScoreLimit )
+                        m_nScore.store( nScore - 1, atomics::memory_order_relaxed );
+
+                    // Nobody came to the slot: concentrate the collisions and wait longer
+                    size_t const nWidth = m_nWidth.load( atomics::memory_order_relaxed );
+                    if ( nWidth > 1 ) {
+                        m_nWidth.store( nWidth / 2, atomics::memory_order_relaxed );
+                        stat.onEliminationShrink();
+                    }
+
+                    unsigned const nSpin = m_nSpin.load( atomics::memory_order_relaxed );
+                    if ( nSpin < c_nMaxSpin )
+                        m_nSpin.store( nSpin * 2, atomics::memory_order_relaxed );
+                }
+
+                template <typename Stat>
+                bool skip_elimination( Stat& stat ) const
+                {
+                    if ( m_nScore.load( atomics::memory_order_relaxed ) > -c_nScoreLimit
+                      || ( m_Elimination.randEngine() & c_nSampleMask ) == 0 )
+                    {
+                        return false;
+                    }
+
+                    stat.onEliminationSkipped();
+                    back_off()();
+                    return true;
+                }
+
+                void wait_for_collision( operation_desc& op )
+                {
+                    auto pred = [&op]() noexcept -> bool { return op.nStatus.load( atomics::memory_order_acquire ) != op_waiting; };
+
+                    constexpr_if( c_bAdaptive ) {
+                        cds::backoff::pause spin;
+                        for ( unsigned i = m_nSpin.load( atomics::memory_order_relaxed ); i > 0 && !pred(); --i )
+                            spin();
+                        return;
+                    }
+
+                    elimination_backoff_type bkoff;
+                    bkoff( pred );
+                }
+
+                void init_adaptive()
+                {
+                    m_nWidth.store( 1, atomics::memory_order_relaxed );
+                    m_nSpin.store( c_nInitialSpin, atomics::memory_order_relaxed );
+                    m_nScore.store( 0, atomics::memory_order_relaxed );
+                }
+
             public:
                 elimination_backoff()
                 {
                     m_Elimination.collisions.zeroize();
+                    init_adaptive();
                 }
 
                 elimination_backoff( size_t nCollisionCapacity )
                     : m_Elimination( nCollisionCapacity )
                 {
                     m_Elimination.collisions.zeroize();
+                    init_adaptive();
                 }
 
                 typedef elimination_backoff& type;
@@ -397,10 +553,22 @@ namespace cds { namespace intrusive {
                 void reset()
                 {}
 
+                /// Returns active width of the elimination array
+                size_t width() const
+                {
+                    constexpr_if( c_bAdaptive )
+                        return m_nWidth.load( atomics::memory_order_relaxed );
+                    return m_Elimination.collisions.capacity();
+                }
+
                 template <typename Stat>
                 bool backoff( operation_desc& op, Stat& stat )
                 {
-                    elimination_backoff_type bkoff;
+                    constexpr_if( c_bAdaptive ) {
+                        if ( skip_elimination( stat ))
+                            return false;
+                    }
+
                     op.nStatus.store( op_waiting, atomics::memory_order_relaxed );
 
                     elimination_rec * myRec = cds::algo::elimination::init_record<elimination_storage>( op );
@@ -425,16 +593,22 @@ namespace cds { namespace intrusive {
 
                                 cds::algo::elimination::clear_record<elimination_storage>();
                                 stat.onActiveCollision( op.idOp );
+                                constexpr_if( c_bAdaptive )
+                                    on_collided( stat );
                                 return true;
                             }
                             //himOp->nStatus.store( op_free, atomics::memory_order_release );
+
+                            // The slot is occupied by the same operation: the array is too narrow
+                            constexpr_if( c_bAdaptive )
+                                expand( stat );
                         }
                         slot.pRec = myRec;
                         slot.lock.unlock();
                     }
 
                     // Wait for colliding operation
-                    bkoff( [&op]() noexcept -> bool { return op.nStatus.load( atomics::memory_order_acquire ) != op_waiting; } );
+                    wait_for_collision( op );
 
                     {
                         slot_scoped_lock l( slot.lock );
@@ -449,6 +623,13 @@ namespace cds { namespace intrusive {
                     else
                         stat.onPassiveCollision( op.idOp );
 
+                    constexpr_if( c_bAdaptive ) {
+                        if ( bCollided )
+                            on_collided( stat );
+                        else
+                            on_failed( stat );
+                    }
+
                     cds::algo::elimination::clear_record<elimination_storage>();
                     return bCollided;
                 }
@@ -691,6 +872,23 @@ namespace cds { namespace intrusive {
 
         template <bool EnableElimination>
         struct elimination_backoff_impl;
+
+        // Splices the chain pTop -> ... -> pBottom onto the stack top
+        void link_chain( node_type * pTop, node_type * pBottom, size_t nCount )
+        {
+            back_off bkoff;
+            node_type * t = m_Top.load( memory_model::memory_order_relaxed );
+            while ( true ) {
+                pBottom->m_pNext.store( t, memory_model::memory_order_relaxed );
+                if ( m_Top.compare_exchange_weak( t, pTop, memory_model::memory_order_release, atomics::memory_order_acquire ))
+                    break;
+                m_stat.onPushRace();
+                bkoff();
+            }
+
+            m_ItemCounter += nCount;
+            m_stat.onPushChain( nCount );
+        }
         //@endcond
 
     public:
@@ -791,6 +989,77 @@ namespace cds { namespace intrusive {
             }
         }
 
+        /// Pushes the items of the range <tt>[itFirst, itLast)</tt> on the stack by one CAS
+        /**
+            The items are linked into a chain locally, then the whole chain is spliced onto the stack top
+            by one CAS, so the bulk transfer from a thread-local cache costs one CAS instead of one CAS per item.
+            \p Iterator should be a forward iterator; <tt>*it</tt> is a reference or a pointer to \p value_type.
+            The resulting stack is the same as after pushing the items one by one: the last item of the range
+            becomes the top of the stack. The range is pushed atomically: no other thread can see
+            a part of the chain only.
+
+            The chain does not take part in elimination back-off: a chain cannot be exchanged
+            with one \p pop(). On the contention the function uses \p traits::back_off strategy.
+
+            The function returns \p false if the range is empty, \p true otherwise.
+        */
+        template <typename Iterator>
+        bool push_chain( Iterator itFirst, Iterator itLast )
+        {
+            if ( itFirst == itLast )
+                return false;
+
+            node_type * pBottom = node_traits::to_node_ptr( *itFirst );
+            link_checker::is_empty( pBottom );
+            node_type * pTop = pBottom;
+            size_t nCount = 1;
+            for ( ++itFirst; itFirst != itLast; ++itFirst ) {
+                node_type * pNode = node_traits::to_node_ptr( *itFirst );
+                link_checker::is_empty( pNode );
+                pNode->m_pNext.store( pTop, memory_model::memory_order_relaxed );
+                pTop = pNode;
+                ++nCount;
+            }
+
+            link_chain( pTop, pBottom, nCount );
+            return true;
+        }
+
+        /// Pops all items from the stack by one atomic operation
+        /**
+            The function detaches the whole list of the stack items by one atomic exchange,
+            then calls \p f for each item detached from the top to the bottom:
+            \code
+            void f( value_type& item );
+            \endcode
+            The item is unlinked when \p f is called; the disposer is <b>not</b> called.
+            As for \p pop(), the item can be reused or freed only when no thread can hold a hazard pointer
+            to it, see \ref cds_intrusive_item_destroying "Destroying items of intrusive containers".
+
+            The function returns the number of items popped.
+            Like \p clear(), \p %pop_all() does not interact with elimination back-off.
+        */
+        template <typename Func>
+        size_t pop_all( Func f )
+        {
+            node_type * pTop = m_Top.exchange( nullptr, memory_model::memory_order_acquire );
+            if ( pTop == nullptr )
+                return 0;
+
+            size_t nCount = 0;
+            while ( pTop ) {
+                node_type * p = pTop;
+                pTop = p->m_pNext.load( memory_model::memory_order_relaxed );
+                clear_links( p );
+                ++nCount;
+                f( *node_traits::to_value_ptr( p ));
+            }
+
+            m_ItemCounter -= nCount;
+            m_stat.onPopAll( nCount );
+            return nCount;
+        }
+
         /// Check if stack is empty
         bool empty() const
         {
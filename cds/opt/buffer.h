@@ -28,6 +28,7 @@ namespace cds { namespace opt {
             - \p opt::v::uninitialized_static_buffer
             - \p opt::v::initialized_dynamic_buffer
             - \p opt::v::uninitialized_dynamic_buffer
+            - \p opt::v::uninitialized_external_buffer
 
         Uninitialized buffer is just an array of uninitialized elements.
         Each element should be manually constructed, for example with a placement new operator.
@@ -545,6 +546,128 @@ namespace cds { namespace opt {
             //@endcond
         };
 
+        /// Uninitialized buffer placed in caller-supplied memory
+        /**
+            One of available type for \p opt::buffer option.
+
+            This buffer does not allocate any memory: it maintains an array of uninitialized elements
+            placed at the address passed to the constructor. The address is not stored as a raw pointer;
+            the buffer keeps the offset of the array relative to the buffer object itself.
+            Hence, if the buffer object and its array are both placed in one memory region, the region
+            can be mapped at different addresses in different processes (for example, \p mmap'd file
+            or \p shm_open shared memory), and the buffer remains valid in each of them.
+            See \p cds::container::process_shared::ring_segment.
+
+            The array should be at least <tt>storage_size( nCapacity )</tt> bytes and properly aligned for \p T.
+            The buffer does not own the array: the destructor does nothing.
+
+            \par Template parameters:
+                - \p T - item type storing in the buffer
+                - \p Exp2 - a boolean flag. If it is \p true the buffer capacity must be power of two.
+                    Otherwise it can be any positive number. Usually, it is required that the buffer has
+                    size of a power of two.
+        */
+        template <typename T, bool Exp2 = true>
+        class uninitialized_external_buffer
+        {
+        public:
+            typedef T     value_type;   ///< Value type
+            static constexpr const bool c_bExp2 = Exp2; ///< \p Exp2 flag
+
+            /// Rebind buffer for other template parameters
+            template <typename Q, bool Exp22 = c_bExp2>
+            struct rebind {
+                typedef uninitialized_external_buffer<Q, Exp22> other;  ///< Rebinding result type
+            };
+
+        private:
+            //@cond
+            ptrdiff_t       m_nOffset;
+            size_t const    m_nCapacity;
+            //@endcond
+
+        public:
+            /// Places the buffer of \p nCapacity elements at \p pStorage
+            /**
+                If \p Exp2 class template parameter is \p true then \p nCapacity must be power of two.
+            */
+            uninitialized_external_buffer( void* pStorage, size_t nCapacity )
+                : m_nOffset( reinterpret_cast<char*>( pStorage ) - reinterpret_cast<char*>( this ))
+                , m_nCapacity( nCapacity )
+            {
+                assert( pStorage != nullptr );
+                assert( ( reinterpret_cast<uintptr_t>( pStorage ) & ( alignof( value_type ) - 1 )) == 0 );
+                assert( m_nCapacity >= 2 );
+                // Capacity must be power of 2
+                assert( !c_bExp2 || (m_nCapacity & (m_nCapacity - 1)) == 0 );
+            }
+
+            uninitialized_external_buffer( const uninitialized_external_buffer& ) = delete;
+            uninitialized_external_buffer& operator =( const uninitialized_external_buffer& ) = delete;
+
+            /// Returns the size in bytes of the array required for \p nCapacity elements
+            static constexpr size_t storage_size( size_t nCapacity ) noexcept
+            {
+                return nCapacity * sizeof( value_type );
+            }
+
+            /// Get item \p i
+            value_type& operator []( size_t i )
+            {
+                assert( i < capacity());
+                return buffer()[i];
+            }
+
+            /// Get item \p i, const version
+            const value_type& operator []( size_t i ) const
+            {
+                assert( i < capacity());
+                return buffer()[i];
+            }
+
+            /// Returns buffer capacity
+            size_t capacity() const noexcept
+            {
+                return m_nCapacity;
+            }
+
+            /// Zeroize the buffer
+            void zeroize()
+            {
+                memset( buffer(), 0, capacity() * sizeof( value_type ));
+            }
+
+            /// Returns pointer to buffer array
+            value_type * buffer() const noexcept
+            {
+                return reinterpret_cast<value_type *>( const_cast<char*>( reinterpret_cast<char const*>( this )) + m_nOffset );
+            }
+
+            /// Returns <tt> idx % capacity() </tt>
+            /**
+                If the buffer size is a power of two, binary arithmethics is used
+                instead of modulo arithmetics
+            */
+            size_t mod( size_t idx )
+            {
+                constexpr_if ( c_bExp2 )
+                    return idx & ( capacity() - 1 );
+                else
+                    return idx % capacity();
+            }
+
+            //@cond
+            template <typename I>
+            typename std::enable_if< sizeof( I ) != sizeof( size_t ), size_t >::type mod( I idx )
+            {
+                constexpr_if ( c_bExp2 )
+                    return static_cast<size_t>( idx & static_cast<I>( capacity() - 1 ));
+                else
+                    return static_cast<size_t>( idx % capacity());
+            }
+            //@endcond
+        };
+
     }   // namespace v
 
 }}  // namespace cds::opt
@@ -872,6 +872,17 @@ namespace cds { namespace opt {
             }
         };
 
+        /// \p opt::copy_policy based on copy-assignment operator
+        struct assignment_copy_policy
+        {
+            /// <tt> dest = src </tt>
+            template <typename T>
+            void operator()( T& dest, T const& src ) const
+            {
+                dest = src;
+            }
+        };
+
         /// \p rand() -base random number generator for \p opt::random_engine
         /**
             This generator returns a pseudorandom integer in the range 0 to \p RAND_MAX (32767).
@@ -12,6 +12,8 @@
 #include <numeric>   // std::iota
 
 #include <cds/opt/options.h>
+#include <cds/algo/atomic.h>
+#include <cds/algo/thread_index.h>
 
 namespace cds { namespace opt {
 
@@ -61,6 +63,7 @@ namespace cds { namespace opt {
         - \p opt::v::random2_permutation
         - \p opt::v::random_shuffle_permutation
         - \p opt::v::skew_permutation
+        - \p opt::v::thread_affine_permutation
     */
     template <typename Generator>
     struct permutation_generator {
@@ -183,6 +186,83 @@ namespace cds { namespace opt {
             }
         };
 
+        /// Thread-affine permutation generator of power-of-2 length
+        /**
+            The class is suitable for \p opt::permutation_generator option.
+
+            Each thread gets a "home" position in <tt>[0, nLen)</tt>, and the generator produces the sequence
+            <tt>[h, (h + 1) % nLen, ..., (h + nLen - 1) % nLen]</tt> where \p h is the home position of the current thread.
+            So, each thread prefers its own range of the sequence and touches the ranges of other threads only
+            when its own range is exhausted.
+
+            The home position is the bit-reversed index of the thread (the threads are numbered in order
+            of the first call of the generator), scaled to \p nLen. Bit reversal spreads any number of threads
+            evenly: the threads 0, 1, 2, 3 get the home positions 0, nLen/2, nLen/4, 3*nLen/4 respectively.
+            The generator does not allocate any memory.
+            \p nLen must be power of two.
+
+            \p Int template argument specifies the type of generated value, it should be any integer.
+        */
+        template <typename Int=int>
+        class thread_affine_permutation
+        {
+        public:
+            typedef Int     integer_type;   ///< Type of generated value
+
+        protected:
+            //@cond
+            integer_type        m_nCur;
+            integer_type        m_nStart;
+            integer_type const  m_nMask;
+            //@endcond
+
+        public:
+            /// Initializes the generator of length \p nLength
+            /**
+                An assertion is raised if \p nLength is not a power of two.
+            */
+            thread_affine_permutation( size_t nLength )
+                : m_nCur(0)
+                , m_nStart(0)
+                , m_nMask( integer_type(nLength) - 1 )
+            {
+                // nLength must be power of two
+                assert( (nLength & (nLength - 1)) == 0 );
+                reset();
+            }
+
+            /// Returns the current value
+            operator integer_type() const
+            {
+                return m_nCur & m_nMask;
+            }
+
+            /// Goes to next value. Returns \p false if the sequence is exhausted
+            bool next()
+            {
+                return (++m_nCur & m_nMask) != m_nStart;
+            }
+
+            /// Resets the generator to produce the sequence starting from the home position of current thread
+            void reset()
+            {
+                m_nCur = m_nStart = home( static_cast<size_t>( m_nMask ) + 1 );
+            }
+
+            /// Returns the home position of current thread for the sequence of length \p nLength
+            static integer_type home( size_t nLength )
+            {
+                // reverse the bits of thread index within log2( nLength ) bits
+                size_t nIndex = cds::algo::thread_index();
+                size_t nHome = 0;
+                for ( size_t nBit = nLength >> 1; nBit; nBit >>= 1, nIndex >>= 1 ) {
+                    if ( nIndex & 1 )
+                        nHome |= nBit;
+                }
+                return integer_type( nHome );
+            }
+        };
+
         /// Permutation generator based on \p std::shuffle
         /**
             The class is suitable for \p opt::permutation_generator option.
@@ -0,0 +1,163 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_SYNC_READER_REGISTRY_H
+#define CDSLIB_SYNC_READER_REGISTRY_H
+
+#include <mutex>
+#include <thread>   // std::this_thread::yield
+#include <cds/algo/atomic.h>
+#include <cds/algo/thread_index.h>
+#include <cds/opt/options.h>
+
+namespace cds { namespace sync {
+
+    /// Epoch-based registry of optimistic lock-free readers
+    /**
+        The readers of a container with optimistic reads (see \p cds::sync::versioned_lock) do not lock anything,
+        so the item unlinked by a writer (or the old bucket table replaced by the resizing) cannot be freed
+        while a reader can access it. The reader registers itself by \p read_guard for the time of reading,
+        the writer calls \p synchronize() that waits while all readers registered before the call have finished;
+        after that the memory unlinked before the call can be freed.
+
+        The readers are counted by per-thread-group counters of two epochs; a thread is mapped
+        to a counter by \p cds::algo::thread_index(), so no thread attaching is required.
+        \p synchronize() switches the epoch and waits until the counters of the previous epoch are zero.
+        The concurrent callers of \p synchronize() share the waiting: one grace period serves all callers
+        queued while the previous one is in progress.
+
+        The reader must never wait for a lock of the writers while it is registered, and it must not call
+        \p synchronize() of the same registry: that would wait for itself forever (debug builds assert on that).
+    */
+    class reader_registry
+    {
+        //@cond
+        static size_t const c_nSlotCount = 32;
+
+        struct reader_slot {
+            atomics::atomic<size_t> m_nCount[2];
+
+            reader_slot()
+            {
+                m_nCount[0].store( 0, atomics::memory_order_relaxed );
+                m_nCount[1].store( 0, atomics::memory_order_relaxed );
+            }
+        };
+        typedef cds::opt::details::apply_padding< reader_slot, cds::opt::cache_line_padding >::type padded_reader_slot;
+
+        padded_reader_slot      m_arrSlot[c_nSlotCount];
+        atomics::atomic<size_t> m_nEpoch;
+        atomics::atomic<size_t> m_nGracePeriod;     // grace period sequence: odd while a grace period is in progress
+        std::mutex              m_SyncLock;         // serializes grace periods, not the callers of synchronize()
+        //@endcond
+
+    public:
+        /// Registers the current thread as a reader of the registry for the lifetime of the guard
+        class read_guard
+        {
+            //@cond
+            reader_slot&            m_Slot;
+            size_t                  m_nEpoch;
+#       ifdef CDS_DEBUG
+            reader_registry const*  m_pPrevReader;
+#       endif
+            //@endcond
+
+        public:
+            /// Registers the reader
+            explicit read_guard( reader_registry& r )
+                : m_Slot( r.m_arrSlot[ slot_index() ].data )
+            {
+#           ifdef CDS_DEBUG
+                m_pPrevReader = current_reader();
+                current_reader() = &r;
+#           endif
+                while ( true ) {
+                    m_nEpoch = r.m_nEpoch.load( atomics::memory_order_acquire ) & 1;
+                    m_Slot.m_nCount[m_nEpoch].fetch_add( 1, atomics::memory_order_seq_cst );
+                    if (( r.m_nEpoch.load( atomics::memory_order_seq_cst ) & 1 ) == m_nEpoch )
+                        break;
+                    m_Slot.m_nCount[m_nEpoch].fetch_sub( 1, atomics::memory_order_release );
+                }
+            }
+
+            /// Unregisters the reader
+            ~read_guard()
+            {
+                m_Slot.m_nCount[m_nEpoch].fetch_sub( 1, atomics::memory_order_release );
+#           ifdef CDS_DEBUG
+                current_reader() = m_pPrevReader;
+#           endif
+            }
+
+            read_guard( read_guard const& ) = delete;
+            read_guard& operator=( read_guard const& ) = delete;
+        };
+
+    public:
+        /// Initializes the registry
+        reader_registry()
+            : m_nEpoch( 0 )
+            , m_nGracePeriod( 0 )
+        {}
+
+        /// Waits while all readers registered before the call are done
+        /**
+            A caller needs only one grace period started after the call, so the callers queued
+            while a grace period is in progress are all served by the next one.
+        */
+        void synchronize()
+        {
+            // The waiting for its own read_guard would never end
+            CDS_DEBUG_ONLY( assert( current_reader() != this ); )
+
+            // RMW instead of load: the thread that starts the next grace period synchronizes with the caller,
+            // so the items unlinked by the caller are invisible to the readers registered after that
+            size_t const nStart = m_nGracePeriod.fetch_add( 0, atomics::memory_order_acq_rel );
+
+            // The end of the first grace period started after nStart
+            size_t const nTarget = ( nStart + 3 ) & ~size_t( 1 );
+
+            std::unique_lock< std::mutex > sl( m_SyncLock );
+            if ( static_cast<ptrdiff_t>( m_nGracePeriod.load( atomics::memory_order_acquire ) - nTarget ) < 0 )
+                wait_for_readers();
+        }
+
+    private:
+        //@cond
+        static size_t slot_index()
+        {
+            return cds::algo::thread_index() % c_nSlotCount;
+        }
+
+#   ifdef CDS_DEBUG
+        // The registry whose read_guard is held by the current thread, to detect synchronize() from a reader
+        static reader_registry const*& current_reader()
+        {
+            static thread_local reader_registry const* s_pReader = nullptr;
+            return s_pReader;
+        }
+#   endif
+
+        void wait_for_readers()
+        {
+            // m_SyncLock must be held
+            m_nGracePeriod.fetch_add( 1, atomics::memory_order_seq_cst );
+
+            size_t const nEpoch = m_nEpoch.fetch_add( 1, atomics::memory_order_seq_cst ) & 1;
+            for ( size_t i = 0; i < c_nSlotCount; ++i ) {
+                atomics::atomic<size_t>& nCount = m_arrSlot[i].data.m_nCount[nEpoch];
+                while ( nCount.load( atomics::memory_order_acquire ) != 0 )
+                    std::this_thread::yield();
+            }
+
+            m_nGracePeriod.fetch_add( 1, atomics::memory_order_release );
+        }
+        //@endcond
+    };
+
+}} // namespace cds::sync
+
+#endif // #ifndef CDSLIB_SYNC_READER_REGISTRY_H
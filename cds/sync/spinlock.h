@@ -376,6 +376,139 @@ namespace cds {
 
         /// Recursive 64bit spin-lock
         typedef reentrant_spin_lock<uint64_t, backoff::LockDefault> reentrant_spin64;
+
+        /// Reader-writer spin lock
+        /**
+            The spin-lock can be owned exclusively by one writer (\p lock() / \p unlock())
+            or shared by many readers (\p lock_shared() / \p unlock_shared()).
+            The interface follows C++17 \p std::shared_mutex, so \p std::unique_lock and \p std::shared_lock
+            (if available) can be used.
+
+            The lock prefers writers: a waiting writer sets "writer pending" flag
+            that prevents new readers from entering, so the writers are not starved
+            when the readers dominate.
+
+            The lock state is a single 32bit atomic word: bit 0 is "writer owns" flag, bit 1 is
+            "writer pending" flag, other bits contain the reader count.
+
+            This spin-lock is NOT recursive: neither writer nor reader can lock it again without deadlock.
+
+            Template parameters:
+                - \p Backoff - backoff strategy. Used when spin lock is locked
+        */
+        template <typename Backoff>
+        class shared_spin_lock
+        {
+        public:
+            typedef Backoff backoff_strategy;   ///< back-off strategy type
+
+        private:
+            //@cond
+            static constexpr uint32_t const c_nWriter = 1;
+            static constexpr uint32_t const c_nWriterPending = 2;
+            static constexpr uint32_t const c_nReader = 4;
+
+            atomics::atomic<uint32_t>   m_state;
+            //@endcond
+
+        public:
+            /// Construct free (unlocked) spin-lock
+            shared_spin_lock() noexcept
+                : m_state( 0 )
+            {}
+
+            /// Dummy copy constructor
+            /**
+                The ctor initializes the spin to free (unlocked) state like the default ctor.
+            */
+            shared_spin_lock( shared_spin_lock const& ) noexcept
+                : m_state( 0 )
+            {}
+
+            /// Destructor. On debug time it checks whether spin-lock is free
+            ~shared_spin_lock()
+            {
+                assert( ( m_state.load( atomics::memory_order_relaxed ) & ~c_nWriterPending ) == 0 );
+            }
+
+            /// Checks if the spin is locked by a writer
+            bool is_locked() const noexcept
+            {
+                return ( m_state.load( atomics::memory_order_relaxed ) & c_nWriter ) != 0;
+            }
+
+            /// Checks if the spin is locked by any reader
+            bool is_shared() const noexcept
+            {
+                return m_state.load( atomics::memory_order_relaxed ) >= c_nReader;
+            }
+
+            /// Tries to lock exclusively
+            bool try_lock() noexcept
+            {
+                uint32_t cur = m_state.load( atomics::memory_order_relaxed );
+                return ( cur & ~c_nWriterPending ) == 0
+                    && m_state.compare_exchange_strong( cur, c_nWriter, atomics::memory_order_acquire, atomics::memory_order_relaxed );
+            }
+
+            /// Locks exclusively. Waits while there is an owner, new readers are held off meanwhile
+            void lock() noexcept( noexcept( backoff_strategy()()))
+            {
+                backoff_strategy backoff;
+                while ( true ) {
+                    uint32_t cur = m_state.load( atomics::memory_order_relaxed );
+                    if ( ( cur & ~c_nWriterPending ) == 0 ) {
+                        // The pending flag is cleared: other waiting writers set it again
+                        if ( m_state.compare_exchange_weak( cur, c_nWriter, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                            return;
+                    }
+                    else if ( !( cur & c_nWriterPending ))
+                        m_state.fetch_or( c_nWriterPending, atomics::memory_order_relaxed );
+                    else
+                        backoff();
+                }
+            }
+
+            /// Unlocks exclusive lock
+            void unlock() noexcept
+            {
+                assert( is_locked());
+                m_state.fetch_sub( c_nWriter, atomics::memory_order_release );
+            }
+
+            /// Tries to lock shared. Fails if the spin is owned or awaited by a writer
+            bool try_lock_shared() noexcept
+            {
+                uint32_t cur = m_state.load( atomics::memory_order_relaxed );
+                return ( cur & ( c_nWriter | c_nWriterPending )) == 0
+                    && m_state.compare_exchange_strong( cur, cur + c_nReader, atomics::memory_order_acquire, atomics::memory_order_relaxed );
+            }
+
+            /// Locks shared. Waits while the spin is owned or awaited by a writer
+            void lock_shared() noexcept( noexcept( backoff_strategy()()))
+            {
+                backoff_strategy backoff;
+                while ( true ) {
+                    uint32_t cur = m_state.load( atomics::memory_order_relaxed );
+                    if ( ( cur & ( c_nWriter | c_nWriterPending )) == 0 ) {
+                        if ( m_state.compare_exchange_weak( cur, cur + c_nReader, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                            return;
+                    }
+                    else
+                        backoff();
+                }
+            }
+
+            /// Unlocks shared lock
+            void unlock_shared() noexcept
+            {
+                assert( is_shared());
+                m_state.fetch_sub( c_nReader, atomics::memory_order_release );
+            }
+        };
+
+        /// Default reader-writer spin-lock
+        typedef shared_spin_lock<backoff::LockDefault> shared_spin;
     }    // namespace sync
 } // namespace cds
 
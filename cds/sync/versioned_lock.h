@@ -0,0 +1,93 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSLIB_SYNC_VERSIONED_LOCK_H
+#define CDSLIB_SYNC_VERSIONED_LOCK_H
+
+#include <cds/algo/atomic.h>
+
+namespace cds { namespace sync {
+
+    /// Lock with the version counter for optimistic lock-free readers
+    /**
+        The wrapper over \p Lock increments the version when a writer acquires the lock
+        and when it releases the lock, so the version is odd while the lock is held.
+        An optimistic reader reads the version before and after reading the data protected by the lock;
+        the data read is consistent if the version is even and is unchanged.
+
+        \p Lock may be recursive, the version is changed by the outermost \p lock() and \p unlock() only.
+        The lock supports \p lock(), \p try_lock() and \p unlock(), so it can be used with \p std::unique_lock
+        and \p cds::sync::lock_array.
+
+        The readers of the data protected should not wait for the lock: the readers must not block the writers.
+        So, the memory of the data changed by the writers should be reclaimed after all readers started before
+        have finished, see \p cds::sync::reader_registry.
+    */
+    template <class Lock>
+    class versioned_lock
+    {
+    public:
+        typedef Lock lock_type; ///< Underlying lock type
+
+    private:
+        //@cond
+        lock_type               m_Lock;
+        atomics::atomic<size_t> m_nVersion;
+        unsigned int            m_nDepth;   // recursion depth, changed under m_Lock only
+        //@endcond
+
+    public:
+        /// Initializes the lock, the version is 0
+        versioned_lock()
+            : m_nVersion( 0 )
+            , m_nDepth( 0 )
+        {}
+
+        /// Acquires the lock
+        void lock()
+        {
+            m_Lock.lock();
+            acquired();
+        }
+
+        /// Tries to acquire the lock
+        bool try_lock()
+        {
+            if ( m_Lock.try_lock()) {
+                acquired();
+                return true;
+            }
+            return false;
+        }
+
+        /// Releases the lock
+        void unlock()
+        {
+            if ( --m_nDepth == 0 )
+                m_nVersion.fetch_add( 1, atomics::memory_order_release );
+            m_Lock.unlock();
+        }
+
+        /// Returns current version; the version is odd while the lock is held
+        size_t version() const
+        {
+            return m_nVersion.load( atomics::memory_order_acquire );
+        }
+
+    private:
+        //@cond
+        void acquired()
+        {
+            if ( m_nDepth++ == 0 ) {
+                m_nVersion.fetch_add( 1, atomics::memory_order_relaxed );
+                atomics::atomic_thread_fence( atomics::memory_order_release );
+            }
+        }
+        //@endcond
+    };
+
+}} // namespace cds::sync
+
+#endif // #ifndef CDSLIB_SYNC_VERSIONED_LOCK_H
@@ -78,7 +78,12 @@ namespace cds_test {
             << CDSSTRESS_STAT_OUT( s, m_nFindSuccess )
             << CDSSTRESS_STAT_OUT( s, m_nFindFailed )
             << CDSSTRESS_STAT_OUT( s, m_nFindWithSuccess )
-            << CDSSTRESS_STAT_OUT( s, m_nFindWithFailed );
+            << CDSSTRESS_STAT_OUT( s, m_nFindWithFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nOptimisticFindRetry )
+            << CDSSTRESS_STAT_OUT( s, m_nOptimisticFindFallback )
+            << CDSSTRESS_STAT_OUT( s, m_nRelocatePathFound )
+            << CDSSTRESS_STAT_OUT( s, m_nRelocatePathStale )
+            << CDSSTRESS_STAT_OUT( s, m_nRelocatePathLength );
     }
 
     static inline property_stream& operator <<( property_stream& o, cds::intrusive::cuckoo::empty_stat const& /*s*/ )
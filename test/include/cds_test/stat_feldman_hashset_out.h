@@ -35,6 +35,9 @@ namespace cds_test {
             << CDSSTRESS_STAT_OUT( s, m_nExpandNodeFailed )
             << CDSSTRESS_STAT_OUT( s, m_nSlotChanged )
             << CDSSTRESS_STAT_OUT( s, m_nSlotConverting )
+            << CDSSTRESS_STAT_OUT( s, m_nSlotFrozen )
+            << CDSSTRESS_STAT_OUT( s, m_nCompactNodeSuccess )
+            << CDSSTRESS_STAT_OUT( s, m_nCompactNodeFailed )
             << CDSSTRESS_STAT_OUT( s, m_nArrayNodeCount )
             << CDSSTRESS_STAT_OUT( s, m_nHeight );
     }
@@ -0,0 +1,39 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSTEST_STAT_FREEZABLE_HASH_OUT_H
+#define CDSTEST_STAT_FREEZABLE_HASH_OUT_H
+
+#include <cds/container/details/freezable_hash_base.h>
+
+namespace cds_test {
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::freezable_hash::empty_stat const& /*s*/ )
+    {
+        return o;
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::freezable_hash::stat<> const& s )
+    {
+        return o
+            << CDSSTRESS_STAT_OUT( s, m_nInsertSuccess )
+            << CDSSTRESS_STAT_OUT( s, m_nInsertFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nUpdateNew )
+            << CDSSTRESS_STAT_OUT( s, m_nUpdateExisting )
+            << CDSSTRESS_STAT_OUT( s, m_nUpdateFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nEraseSuccess )
+            << CDSSTRESS_STAT_OUT( s, m_nEraseFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nFindSuccess )
+            << CDSSTRESS_STAT_OUT( s, m_nFindFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nBucketRace )
+            << CDSSTRESS_STAT_OUT( s, m_nFrozenRetry )
+            << CDSSTRESS_STAT_OUT( s, m_nFindRetry )
+            << CDSSTRESS_STAT_OUT( s, m_nBucketInit )
+            << CDSSTRESS_STAT_OUT( s, m_nResize );
+    }
+
+} // namespace cds_test
+
+#endif // #ifndef CDSTEST_STAT_FREEZABLE_HASH_OUT_H
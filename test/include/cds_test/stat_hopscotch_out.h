@@ -0,0 +1,49 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSTEST_STAT_HOPSCOTCH_OUT_H
+#define CDSTEST_STAT_HOPSCOTCH_OUT_H
+
+#include <cds/container/details/hopscotch_base.h>
+
+namespace cds_test {
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::hopscotch::empty_stat const& /*s*/ )
+    {
+        return o;
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::hopscotch::stat<> const& s )
+    {
+        return o
+            << CDSSTRESS_STAT_OUT( s, m_nInsertSuccess )
+            << CDSSTRESS_STAT_OUT( s, m_nInsertFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nUpdateNew )
+            << CDSSTRESS_STAT_OUT( s, m_nUpdateExisting )
+            << CDSSTRESS_STAT_OUT( s, m_nUpdateFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nEraseSuccess )
+            << CDSSTRESS_STAT_OUT( s, m_nEraseFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nFindSuccess )
+            << CDSSTRESS_STAT_OUT( s, m_nFindFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nFindRetry )
+            << CDSSTRESS_STAT_OUT( s, m_nFindFallback )
+            << CDSSTRESS_STAT_OUT( s, m_nDisplacement )
+            << CDSSTRESS_STAT_OUT( s, m_nDisplacementMove )
+            << CDSSTRESS_STAT_OUT( s, m_nDisplacement1 )
+            << CDSSTRESS_STAT_OUT( s, m_nDisplacement2 )
+            << CDSSTRESS_STAT_OUT( s, m_nDisplacement3_4 )
+            << CDSSTRESS_STAT_OUT( s, m_nDisplacement5_8 )
+            << CDSSTRESS_STAT_OUT( s, m_nDisplacementLong )
+            << CDSSTRESS_STAT_OUT( s, m_nDisplacementFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nDisplacementLockFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nInsertRetry )
+            << CDSSTRESS_STAT_OUT( s, m_nNoFreeSlot )
+            << CDSSTRESS_STAT_OUT( s, m_nResize )
+            << CDSSTRESS_STAT_OUT( s, m_nReclaimBatch );
+    }
+
+} // namespace cds_test
+
+#endif // #ifndef CDSTEST_STAT_HOPSCOTCH_OUT_H
@@ -33,7 +33,10 @@ namespace cds_test {
             << CDSSTRESS_STAT_OUT( s, m_nBucketCount )
             << CDSSTRESS_STAT_OUT( s, m_nInitBucketRecursive )
             << CDSSTRESS_STAT_OUT( s, m_nInitBucketContention )
-            << CDSSTRESS_STAT_OUT( s, m_nBucketsExhausted );
+            << CDSSTRESS_STAT_OUT( s, m_nBucketsExhausted )
+            << CDSSTRESS_STAT_OUT( s, m_nBucketTableShrink )
+            << CDSSTRESS_STAT_OUT( s, m_nAuxNodeRetired )
+            << CDSSTRESS_STAT_OUT( s, m_nAuxNodeUnlinked );
     }
 
 } // namespace cds_test
@@ -0,0 +1,43 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSTEST_STAT_SWISS_HASH_OUT_H
+#define CDSTEST_STAT_SWISS_HASH_OUT_H
+
+#include <cds/container/details/swiss_hash_base.h>
+
+namespace cds_test {
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::swiss_hash::empty_stat const& /*s*/ )
+    {
+        return o;
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::swiss_hash::stat<> const& s )
+    {
+        return o
+            << CDSSTRESS_STAT_OUT( s, m_nInsertSuccess )
+            << CDSSTRESS_STAT_OUT( s, m_nInsertFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nUpdateNew )
+            << CDSSTRESS_STAT_OUT( s, m_nUpdateExisting )
+            << CDSSTRESS_STAT_OUT( s, m_nUpdateFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nEraseSuccess )
+            << CDSSTRESS_STAT_OUT( s, m_nEraseFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nFindSuccess )
+            << CDSSTRESS_STAT_OUT( s, m_nFindFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nFindRetry )
+            << CDSSTRESS_STAT_OUT( s, m_nSlotRace )
+            << CDSSTRESS_STAT_OUT( s, m_nSealedRetry )
+            << CDSSTRESS_STAT_OUT( s, m_nMigrateWait )
+            << CDSSTRESS_STAT_OUT( s, m_nBudgetExhausted )
+            << CDSSTRESS_STAT_OUT( s, m_nItemMoved )
+            << CDSSTRESS_STAT_OUT( s, m_nGroupMigrated )
+            << CDSSTRESS_STAT_OUT( s, m_nGrow )
+            << CDSSTRESS_STAT_OUT( s, m_nRehash );
+    }
+
+} // namespace cds_test
+
+#endif // #ifndef CDSTEST_STAT_SWISS_HASH_OUT_H
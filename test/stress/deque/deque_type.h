@@ -0,0 +1,167 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSSTRESS_DEQUE_TYPES_H
+#define CDSSTRESS_DEQUE_TYPES_H
+
+#include <cds/container/work_stealing_deque.h>
+#include <cds/container/work_stealing_deque_rcu.h>
+#include <cds/container/fcdeque.h>
+
+#include <cds/gc/hp.h>
+#include <cds/gc/dhp.h>
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+
+#include <cds_test/stress_test.h>
+#include <cds_test/stat_flat_combining_out.h>
+
+namespace deque {
+
+    // Work-stealing deque interface: the owner pushes/pops at one end, thieves steal from the other end
+    namespace details {
+
+        template <typename GC, typename T, typename Traits = cds::container::work_stealing_deque::traits>
+        class WorkStealingDeque: public cds::container::WorkStealingDeque< GC, T, Traits >
+        {
+            typedef cds::container::WorkStealingDeque< GC, T, Traits > base_class;
+        public:
+            WorkStealingDeque()
+                : base_class( 256 )
+            {}
+        };
+
+        template <typename T, typename Traits = cds::container::fcdeque::traits>
+        class FCDeque: public cds::container::FCDeque< T, std::deque<T>, Traits >
+        {
+            typedef cds::container::FCDeque< T, std::deque<T>, Traits > base_class;
+        public:
+            bool push( T const& v )
+            {
+                return base_class::push_back( v );
+            }
+
+            bool pop( T& v )
+            {
+                return base_class::pop_back( v );
+            }
+
+            bool steal( T& v )
+            {
+                return base_class::pop_front( v );
+            }
+        };
+
+    } // namespace details
+
+    template <typename T>
+    struct Types {
+
+    // WorkStealingDeque
+        struct traits_WorkStealingDeque_stat: public cds::container::work_stealing_deque::traits
+        {
+            typedef cds::container::work_stealing_deque::stat<> stat;
+        };
+        struct traits_WorkStealingDeque_yield: public cds::container::work_stealing_deque::traits
+        {
+            typedef cds::backoff::yield back_off;
+        };
+
+        typedef details::WorkStealingDeque< cds::gc::HP, T > WorkStealingDeque_HP;
+        typedef details::WorkStealingDeque< cds::gc::HP, T, traits_WorkStealingDeque_stat >  WorkStealingDeque_HP_stat;
+        typedef details::WorkStealingDeque< cds::gc::HP, T, traits_WorkStealingDeque_yield > WorkStealingDeque_HP_yield;
+        typedef details::WorkStealingDeque< cds::gc::DHP, T > WorkStealingDeque_DHP;
+        typedef details::WorkStealingDeque< cds::gc::DHP, T, traits_WorkStealingDeque_stat > WorkStealingDeque_DHP_stat;
+        typedef details::WorkStealingDeque< cds::urcu::gc< cds::urcu::general_instant<>>, T >  WorkStealingDeque_RCU_GPI;
+        typedef details::WorkStealingDeque< cds::urcu::gc< cds::urcu::general_buffered<>>, T > WorkStealingDeque_RCU_GPB;
+
+    // FCDeque
+        struct traits_FCDeque_stat:
+            public cds::container::fcdeque::make_traits<
+                cds::opt::stat< cds::container::fcdeque::stat<> >
+            >::type
+        {};
+        struct traits_FCDeque_elimination:
+            public cds::container::fcdeque::make_traits<
+                cds::opt::enable_elimination< true >
+            >::type
+        {};
+
+        typedef details::FCDeque< T > FCDeque;
+        typedef details::FCDeque< T, traits_FCDeque_stat > FCDeque_stat;
+        typedef details::FCDeque< T, traits_FCDeque_elimination > FCDeque_elimination;
+    };
+
+} // namespace deque
+
+// *********************************************
+// Deque statistics
+namespace cds_test {
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::work_stealing_deque::empty_stat const& /*s*/ )
+    {
+        return o;
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::work_stealing_deque::stat<> const& s )
+    {
+        return o
+            << CDSSTRESS_STAT_OUT( s, m_nPush )
+            << CDSSTRESS_STAT_OUT( s, m_nPop )
+            << CDSSTRESS_STAT_OUT( s, m_nPopEmpty )
+            << CDSSTRESS_STAT_OUT( s, m_nPopRace )
+            << CDSSTRESS_STAT_OUT( s, m_nSteal )
+            << CDSSTRESS_STAT_OUT( s, m_nStealEmpty )
+            << CDSSTRESS_STAT_OUT( s, m_nStealRace )
+            << CDSSTRESS_STAT_OUT( s, m_nGrow );
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::fcdeque::empty_stat const& /*s*/ )
+    {
+        return o;
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::fcdeque::stat<> const& s )
+    {
+        return o
+            << CDSSTRESS_STAT_OUT( s, m_nPushBack )
+            << CDSSTRESS_STAT_OUT( s, m_nPopFront )
+            << CDSSTRESS_STAT_OUT( s, m_nFailedPopFront )
+            << CDSSTRESS_STAT_OUT( s, m_nPopBack )
+            << CDSSTRESS_STAT_OUT( s, m_nFailedPopBack )
+            << CDSSTRESS_STAT_OUT( s, m_nCollided )
+            << static_cast<cds::algo::flat_combining::stat<> const&>( s );
+    }
+
+} // namespace cds_test
+
+#define CDSSTRESS_DEQUE_F( test_fixture, type_name ) \
+    TEST_F( test_fixture, type_name ) \
+    { \
+        typedef deque::Types< value_type >::type_name deque_type; \
+        test< deque_type >(); \
+    }
+
+#define CDSSTRESS_WorkStealingDeque_HP( test_fixture ) \
+    CDSSTRESS_DEQUE_F( test_fixture, WorkStealingDeque_HP ) \
+    CDSSTRESS_DEQUE_F( test_fixture, WorkStealingDeque_HP_stat ) \
+    CDSSTRESS_DEQUE_F( test_fixture, WorkStealingDeque_HP_yield ) \
+    CDSSTRESS_DEQUE_F( test_fixture, WorkStealingDeque_DHP ) \
+    CDSSTRESS_DEQUE_F( test_fixture, WorkStealingDeque_DHP_stat )
+
+#define CDSSTRESS_WorkStealingDeque_RCU( test_fixture ) \
+    CDSSTRESS_DEQUE_F( test_fixture, WorkStealingDeque_RCU_GPI ) \
+    CDSSTRESS_DEQUE_F( test_fixture, WorkStealingDeque_RCU_GPB )
+
+#define CDSSTRESS_WorkStealingDeque( test_fixture ) \
+    CDSSTRESS_WorkStealingDeque_HP( test_fixture ) \
+    CDSSTRESS_WorkStealingDeque_RCU( test_fixture )
+
+#define CDSSTRESS_FCDeque( test_fixture ) \
+    CDSSTRESS_DEQUE_F( test_fixture, FCDeque ) \
+    CDSSTRESS_DEQUE_F( test_fixture, FCDeque_stat ) \
+    CDSSTRESS_DEQUE_F( test_fixture, FCDeque_elimination )
+
+#endif // #ifndef CDSSTRESS_DEQUE_TYPES_H
@@ -0,0 +1,225 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "deque_type.h"
+
+#include <random>
+#include <thread>
+
+// Fork/join workload: recursive Fibonacci, each worker owns a deque and steals from others
+namespace {
+
+    static size_t s_nThreadCount = 8;
+    static size_t s_nFibN = 30;
+    static size_t s_nCutoff = 4;
+
+    class fork_join: public cds_test::stress_fixture
+    {
+    protected:
+        typedef size_t value_type;  // task: Fibonacci argument
+
+        static size_t fib( size_t n )
+        {
+            size_t f0 = 0;
+            size_t f1 = 1;
+            for ( size_t i = 0; i < n; ++i ) {
+                size_t f = f0 + f1;
+                f0 = f1;
+                f1 = f;
+            }
+            return f0;
+        }
+
+        // Number of tasks for fib(n)
+        static size_t task_count( size_t n )
+        {
+            // t(n) = 1 + t(n-1) + t(n-2) for n > cutoff, t(n) = 1 otherwise
+            std::vector<size_t> t( n + 1 );
+            for ( size_t i = 0; i <= n; ++i )
+                t[i] = ( i > s_nCutoff && i >= 2 ) ? 1 + t[i - 1] + t[i - 2] : 1;
+            return t[n];
+        }
+
+        struct shared_state
+        {
+            atomics::atomic<size_t> nPending;   // count of tasks pushed but not completed
+            char pad_[cds::c_nCacheLineSize];
+        };
+
+        template <class Deque>
+        class Worker: public cds_test::thread
+        {
+            typedef cds_test::thread base_class;
+
+        public:
+            Worker( cds_test::thread_pool& pool, std::vector< Deque* >& deques, shared_state& state )
+                : base_class( pool )
+                , m_deques( deques )
+                , m_state( state )
+            {}
+
+            Worker( Worker& src )
+                : base_class( src )
+                , m_deques( src.m_deques )
+                , m_state( src.m_state )
+            {}
+
+            virtual thread * clone()
+            {
+                return new Worker( *this );
+            }
+
+            virtual void test()
+            {
+                Deque& own = *m_deques[m_nIndex];
+                std::mt19937 rnd( static_cast<unsigned>( m_nIndex + 1 ));
+                std::uniform_int_distribution<size_t> victims( 0, m_deques.size() - 1 );
+
+                value_type task;
+                while ( true ) {
+                    if ( own.pop( task ))
+                        ++m_nOwnTasks;
+                    else if ( steal( rnd, victims, task ))
+                        ++m_nStolenTasks;
+                    else {
+                        if ( m_state.nPending.load( atomics::memory_order_acquire ) == 0 )
+                            break;
+                        ++m_nIdle;
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    execute( own, task );
+                }
+            }
+
+        private:
+            bool steal( std::mt19937& rnd, std::uniform_int_distribution<size_t>& victims, value_type& task )
+            {
+                size_t const nCount = m_deques.size();
+                size_t nVictim = victims( rnd );
+                for ( size_t i = 0; i < nCount; ++i, nVictim = ( nVictim + 1 ) % nCount ) {
+                    if ( nVictim != m_nIndex ) {
+                        ++m_nStealAttempts;
+                        if ( m_deques[nVictim]->steal( task ))
+                            return true;
+                    }
+                }
+                return false;
+            }
+
+            void execute( Deque& own, value_type n )
+            {
+                ++m_nExecuted;
+                if ( n > s_nCutoff && n >= 2 ) {
+                    // fork
+                    m_state.nPending.fetch_add( 2, atomics::memory_order_relaxed );
+                    if ( !own.push( n - 1 ))
+                        ++m_nPushError;
+                    if ( !own.push( n - 2 ))
+                        ++m_nPushError;
+                }
+                else
+                    m_nSum += fib( n );
+
+                m_state.nPending.fetch_sub( 1, atomics::memory_order_release );
+            }
+
+        public:
+            std::vector< Deque* >& m_deques;
+            shared_state&   m_state;
+            size_t  m_nIndex = 0;
+
+            size_t  m_nSum = 0;
+            size_t  m_nExecuted = 0;
+            size_t  m_nOwnTasks = 0;
+            size_t  m_nStolenTasks = 0;
+            size_t  m_nStealAttempts = 0;
+            size_t  m_nIdle = 0;
+            size_t  m_nPushError = 0;
+        };
+
+    public:
+        static void SetUpTestCase()
+        {
+            cds_test::config const& cfg = get_config( "fork_join" );
+
+            s_nThreadCount = cfg.get_size_t( "ThreadCount", s_nThreadCount );
+            s_nFibN = cfg.get_size_t( "FibN", s_nFibN );
+            s_nCutoff = cfg.get_size_t( "Cutoff", s_nCutoff );
+
+            if ( s_nThreadCount == 0 )
+                s_nThreadCount = 1;
+            if ( s_nFibN > 80 )
+                s_nFibN = 80;
+        }
+
+    protected:
+        template <class Deque>
+        void test()
+        {
+            cds_test::thread_pool& pool = get_pool();
+
+            std::vector< std::unique_ptr<Deque>> owned;
+            std::vector< Deque* > deques;
+            for ( size_t i = 0; i < s_nThreadCount; ++i ) {
+                owned.emplace_back( new Deque );
+                deques.push_back( owned.back().get());
+            }
+
+            shared_state state;
+            state.nPending.store( 1, atomics::memory_order_relaxed );
+            ASSERT_TRUE( deques[0]->push( s_nFibN ));
+
+            pool.add( new Worker<Deque>( pool, deques, state ), s_nThreadCount );
+            for ( size_t i = 0; i < pool.size(); ++i )
+                static_cast<Worker<Deque>&>( pool.get( i )).m_nIndex = i;
+
+            propout() << std::make_pair( "thread_count", s_nThreadCount )
+                << std::make_pair( "fib_n", s_nFibN )
+                << std::make_pair( "cutoff", s_nCutoff );
+
+            std::chrono::milliseconds duration = pool.run();
+
+            propout() << std::make_pair( "duration", duration );
+
+            size_t nSum = 0;
+            size_t nExecuted = 0;
+            size_t nStolen = 0;
+            size_t nStealAttempts = 0;
+            size_t nIdle = 0;
+            for ( size_t i = 0; i < pool.size(); ++i ) {
+                Worker<Deque>& w = static_cast<Worker<Deque>&>( pool.get( i ));
+                EXPECT_EQ( w.m_nPushError, 0u ) << "worker " << i;
+                EXPECT_EQ( w.m_nExecuted, w.m_nOwnTasks + w.m_nStolenTasks ) << "worker " << i;
+                nSum += w.m_nSum;
+                nExecuted += w.m_nExecuted;
+                nStolen += w.m_nStolenTasks;
+                nStealAttempts += w.m_nStealAttempts;
+                nIdle += w.m_nIdle;
+            }
+
+            size_t const nTaskCount = task_count( s_nFibN );
+            propout() << std::make_pair( "task_count", nExecuted )
+                << std::make_pair( "stolen_count", nStolen )
+                << std::make_pair( "steal_attempts", nStealAttempts )
+                << std::make_pair( "idle_count", nIdle )
+                << std::make_pair( "ns_per_task", static_cast<size_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( duration ).count() / ( nTaskCount ? nTaskCount : 1 )));
+
+            EXPECT_EQ( nSum, fib( s_nFibN ));
+            EXPECT_EQ( nExecuted, nTaskCount );
+            EXPECT_EQ( state.nPending.load(), 0u );
+
+            for ( size_t i = 0; i < deques.size(); ++i ) {
+                EXPECT_TRUE( deques[i]->empty()) << "deque " << i;
+                propout() << deques[i]->statistics();
+            }
+        }
+    };
+
+    CDSSTRESS_WorkStealingDeque( fork_join )
+    CDSSTRESS_FCDeque( fork_join )
+
+} // namespace
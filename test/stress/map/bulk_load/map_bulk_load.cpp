@@ -0,0 +1,75 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "map_bulk_load.h"
+
+namespace map {
+
+    size_t Map_BulkLoad::s_nThreadCount = 4;
+    size_t Map_BulkLoad::s_nMapSize = 1000000;
+    size_t Map_BulkLoad::s_nMaxLoadFactor = 4;
+
+    size_t Map_BulkLoad::s_nLoadFactor = 1;
+    std::vector<std::pair<Map_BulkLoad::key_type, Map_BulkLoad::value_type>> Map_BulkLoad::s_arrData;
+
+    void Map_BulkLoad::setup_test_case()
+    {
+        cds_test::config const& cfg = get_config( "map_bulk_load" );
+
+        s_nMapSize = cfg.get_size_t( "MapSize", s_nMapSize );
+        if ( s_nMapSize < 1000 )
+            s_nMapSize = 1000;
+
+        s_nThreadCount = cfg.get_size_t( "ThreadCount", s_nThreadCount );
+        if ( s_nThreadCount == 0 )
+            s_nThreadCount = 1;
+
+        s_nMaxLoadFactor = cfg.get_size_t( "MaxLoadFactor", s_nMaxLoadFactor );
+        if ( s_nMaxLoadFactor == 0 )
+            s_nMaxLoadFactor = 1;
+    }
+
+    void Map_BulkLoad::SetUpTestCase()
+    {
+        setup_test_case();
+
+        s_arrData.clear();
+        s_arrData.reserve( s_nMapSize );
+        for ( size_t i = 0; i < s_nMapSize; ++i )
+            s_arrData.emplace_back( i, i * 2 );
+        shuffle( s_arrData.begin(), s_arrData.end());
+    }
+
+    void Map_BulkLoad::TearDownTestCase()
+    {
+        s_arrData.clear();
+    }
+
+    std::vector<size_t> Map_BulkLoad::get_load_factors()
+    {
+        cds_test::config const& cfg = get_config( "map_bulk_load" );
+
+        s_nMaxLoadFactor = cfg.get_size_t( "MaxLoadFactor", s_nMaxLoadFactor );
+        if ( s_nMaxLoadFactor == 0 )
+            s_nMaxLoadFactor = 1;
+
+        std::vector<size_t> lf;
+        for ( size_t n = 1; n <= s_nMaxLoadFactor; n *= 2 )
+            lf.push_back( n );
+
+        return lf;
+    }
+
+#ifdef CDSTEST_GTEST_INSTANTIATE_TEST_CASE_P_HAS_4TH_ARG
+    static std::string get_test_parameter_name( testing::TestParamInfo<size_t> const& p )
+    {
+        return std::to_string( p.param );
+    }
+    INSTANTIATE_TEST_CASE_P( a, Map_BulkLoad_LF, ::testing::ValuesIn( Map_BulkLoad::get_load_factors()), get_test_parameter_name );
+#else
+    INSTANTIATE_TEST_CASE_P( a, Map_BulkLoad_LF, ::testing::ValuesIn( Map_BulkLoad::get_load_factors()));
+#endif
+
+} // namespace map
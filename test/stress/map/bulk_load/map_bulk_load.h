@@ -0,0 +1,128 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "map_type.h"
+#include <chrono>
+
+namespace map {
+
+    // Startup time: compares a loop of insert() with bulk_load() for the same data
+    class Map_BulkLoad: public cds_test::stress_fixture
+    {
+    public:
+        static size_t s_nThreadCount;       // thread count for bulk_load()
+        static size_t s_nMapSize;           // map size
+        static size_t s_nMaxLoadFactor;     // maximum load factor
+
+        static size_t s_nLoadFactor;        // current load factor
+
+        typedef size_t key_type;
+        typedef size_t value_type;
+
+        static std::vector<std::pair<key_type, value_type>> s_arrData;
+
+        static void SetUpTestCase();
+        static void TearDownTestCase();
+
+        static void setup_test_case();
+        static std::vector<size_t> get_load_factors();
+
+    protected:
+        typedef std::chrono::steady_clock clock_type;
+
+        template <class Map>
+        void check_content( Map& testMap )
+        {
+            typedef typename Map::value_type map_pair;
+
+            size_t nFound = 0;
+            size_t nWrong = 0;
+            for ( key_type key = 0; key < s_nMapSize; ++key ) {
+                if ( testMap.find( key, [&nWrong]( map_pair& item ) {
+                        if ( item.second != item.first * 2 )
+                            ++nWrong;
+                    } ))
+                {
+                    ++nFound;
+                }
+            }
+            EXPECT_EQ( nFound, s_nMapSize );
+            EXPECT_EQ( nWrong, 0u );
+        }
+
+        template <class Map>
+        void cleanup( Map& testMap )
+        {
+            check_before_cleanup( testMap );
+
+            testMap.clear();
+            additional_check( testMap );
+            print_stat( propout(), testMap );
+            additional_cleanup( testMap );
+        }
+
+        template <class Map>
+        void test()
+        {
+            propout() << std::make_pair( "thread_count", s_nThreadCount )
+                << std::make_pair( "map_size", s_nMapSize );
+
+            clock_type::duration durInsert;
+            clock_type::duration durBulkLoad;
+
+            {
+                Map testMap( *this );
+
+                size_t nInserted = 0;
+                clock_type::time_point const start = clock_type::now();
+                for ( auto const& item : s_arrData ) {
+                    if ( testMap.insert( item.first, item.second ))
+                        ++nInserted;
+                }
+                durInsert = clock_type::now() - start;
+
+                EXPECT_EQ( nInserted, s_nMapSize );
+                check_content( testMap );
+                cleanup( testMap );
+            }
+
+            {
+                Map testMap( *this );
+
+                clock_type::time_point const start = clock_type::now();
+                size_t const nInserted = testMap.bulk_load( s_arrData.begin(), s_arrData.end(), s_nThreadCount );
+                durBulkLoad = clock_type::now() - start;
+
+                EXPECT_EQ( nInserted, s_nMapSize );
+                check_content( testMap );
+                cleanup( testMap );
+            }
+
+            propout()
+                << std::make_pair( "insert_loop_duration", std::chrono::duration_cast<std::chrono::milliseconds>( durInsert ))
+                << std::make_pair( "bulk_load_duration", std::chrono::duration_cast<std::chrono::milliseconds>( durBulkLoad ));
+        }
+
+        template <class Map>
+        void run_test()
+        {
+            test<Map>();
+        }
+    };
+
+    class Map_BulkLoad_LF: public Map_BulkLoad
+        , public ::testing::WithParamInterface<size_t>
+    {
+    public:
+        template <class Map>
+        void run_test()
+        {
+            s_nLoadFactor = GetParam();
+            propout() << std::make_pair( "load_factor", s_nLoadFactor );
+            Map_BulkLoad::run_test<Map>();
+        }
+    };
+
+} // namespace map
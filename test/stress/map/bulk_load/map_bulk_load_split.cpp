@@ -0,0 +1,20 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "map_bulk_load.h"
+#include "map_type_split_list.h"
+
+namespace map {
+
+    CDSSTRESS_SplitListMap_case( Map_BulkLoad_LF, run_test, SplitList_Michael_HP_dyn_cmp,         Map_BulkLoad::key_type, Map_BulkLoad::value_type )
+    CDSSTRESS_SplitListMap_case( Map_BulkLoad_LF, run_test, SplitList_Michael_DHP_st_cmp,         Map_BulkLoad::key_type, Map_BulkLoad::value_type )
+    CDSSTRESS_SplitListMap_case( Map_BulkLoad_LF, run_test, SplitList_Michael_HP_dyn_cmp_shrink,  Map_BulkLoad::key_type, Map_BulkLoad::value_type )
+    CDSSTRESS_SplitListMap_case( Map_BulkLoad_LF, run_test, SplitList_Lazy_HP_dyn_cmp,            Map_BulkLoad::key_type, Map_BulkLoad::value_type )
+    CDSSTRESS_SplitListMap_case( Map_BulkLoad_LF, run_test, SplitList_Iterable_HP_dyn_cmp,        Map_BulkLoad::key_type, Map_BulkLoad::value_type )
+    CDSSTRESS_SplitListMap_case( Map_BulkLoad_LF, run_test, SplitList_Michael_RCU_GPI_dyn_cmp,    Map_BulkLoad::key_type, Map_BulkLoad::value_type )
+    CDSSTRESS_SplitListMap_case( Map_BulkLoad_LF, run_test, SplitList_Michael_RCU_GPB_st_cmp,     Map_BulkLoad::key_type, Map_BulkLoad::value_type )
+    CDSSTRESS_SplitListMap_case( Map_BulkLoad_LF, run_test, SplitList_Lazy_RCU_GPT_dyn_less,      Map_BulkLoad::key_type, Map_BulkLoad::value_type )
+
+} // namespace map
@@ -0,0 +1,96 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "map_find_batch.h"
+
+namespace map {
+
+    size_t Map_FindBatch::s_nThreadCount = 4;
+    size_t Map_FindBatch::s_nMapSize = 1000000;
+    size_t Map_FindBatch::s_nBatchSize = 64;
+    size_t Map_FindBatch::s_nPassCount = 4;
+    size_t Map_FindBatch::s_nMaxLoadFactor = 4;
+
+    size_t Map_FindBatch::s_nFeldmanMap_HeadBits = 10;
+    size_t Map_FindBatch::s_nFeldmanMap_ArrayBits = 4;
+
+    size_t Map_FindBatch::s_nLoadFactor = 1;
+    std::vector<Map_FindBatch::key_type> Map_FindBatch::s_arrKeys;
+
+    void Map_FindBatch::setup_test_case()
+    {
+        cds_test::config const& cfg = get_config( "map_find_batch" );
+
+        s_nMapSize = cfg.get_size_t( "MapSize", s_nMapSize );
+        if ( s_nMapSize < 1000 )
+            s_nMapSize = 1000;
+
+        s_nThreadCount = cfg.get_size_t( "ThreadCount", s_nThreadCount );
+        if ( s_nThreadCount == 0 )
+            s_nThreadCount = 1;
+
+        s_nBatchSize = cfg.get_size_t( "BatchSize", s_nBatchSize );
+        if ( s_nBatchSize == 0 )
+            s_nBatchSize = 1;
+
+        s_nPassCount = cfg.get_size_t( "PassCount", s_nPassCount );
+        if ( s_nPassCount == 0 )
+            s_nPassCount = 1;
+
+        s_nMaxLoadFactor = cfg.get_size_t( "MaxLoadFactor", s_nMaxLoadFactor );
+        if ( s_nMaxLoadFactor == 0 )
+            s_nMaxLoadFactor = 1;
+
+        s_nFeldmanMap_HeadBits = cfg.get_size_t( "FeldmanMapHeadBits", s_nFeldmanMap_HeadBits );
+        if ( s_nFeldmanMap_HeadBits == 0 )
+            s_nFeldmanMap_HeadBits = 2;
+
+        s_nFeldmanMap_ArrayBits = cfg.get_size_t( "FeldmanMapArrayBits", s_nFeldmanMap_ArrayBits );
+        if ( s_nFeldmanMap_ArrayBits == 0 )
+            s_nFeldmanMap_ArrayBits = 2;
+    }
+
+    void Map_FindBatch::SetUpTestCase()
+    {
+        setup_test_case();
+
+        s_arrKeys.clear();
+        s_arrKeys.reserve( s_nMapSize * 2 );
+        for ( size_t i = 0; i < s_nMapSize * 2; ++i )
+            s_arrKeys.push_back( i );
+        shuffle( s_arrKeys.begin(), s_arrKeys.end());
+    }
+
+    void Map_FindBatch::TearDownTestCase()
+    {
+        s_arrKeys.clear();
+    }
+
+    std::vector<size_t> Map_FindBatch::get_load_factors()
+    {
+        cds_test::config const& cfg = get_config( "map_find_batch" );
+
+        s_nMaxLoadFactor = cfg.get_size_t( "MaxLoadFactor", s_nMaxLoadFactor );
+        if ( s_nMaxLoadFactor == 0 )
+            s_nMaxLoadFactor = 1;
+
+        std::vector<size_t> lf;
+        for ( size_t n = 1; n <= s_nMaxLoadFactor; n *= 2 )
+            lf.push_back( n );
+
+        return lf;
+    }
+
+#ifdef CDSTEST_GTEST_INSTANTIATE_TEST_CASE_P_HAS_4TH_ARG
+    static std::string get_test_parameter_name( testing::TestParamInfo<size_t> const& p )
+    {
+        return std::to_string( p.param );
+    }
+    INSTANTIATE_TEST_CASE_P( a, Map_FindBatch_LF, ::testing::ValuesIn( Map_FindBatch::get_load_factors()), get_test_parameter_name );
+#else
+    INSTANTIATE_TEST_CASE_P( a, Map_FindBatch_LF, ::testing::ValuesIn( Map_FindBatch::get_load_factors()));
+#endif
+
+} // namespace map
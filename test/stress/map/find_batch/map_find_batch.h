@@ -0,0 +1,198 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "map_type.h"
+#include <chrono>
+
+namespace map {
+
+    // Compares find_batch() with a loop of find() for the same key sequence
+    class Map_FindBatch: public cds_test::stress_fixture
+    {
+    public:
+        static size_t s_nThreadCount;       // thread count
+        static size_t s_nMapSize;           // map size, the keys searched are [0, 2 * s_nMapSize), only even keys are in the map
+        static size_t s_nBatchSize;         // count of keys passed to find_batch() at once
+        static size_t s_nPassCount;
+        static size_t s_nMaxLoadFactor;     // maximum load factor
+
+        static size_t s_nFeldmanMap_HeadBits;
+        static size_t s_nFeldmanMap_ArrayBits;
+
+        static size_t s_nLoadFactor;        // current load factor
+
+        typedef size_t key_type;
+        typedef size_t value_type;
+
+        static std::vector<key_type> s_arrKeys;
+
+        static void SetUpTestCase();
+        static void TearDownTestCase();
+
+        static void setup_test_case();
+        static std::vector<size_t> get_load_factors();
+
+    private:
+        template <class Map>
+        class Worker: public cds_test::thread
+        {
+            typedef cds_test::thread base_class;
+            typedef std::chrono::steady_clock clock_type;
+
+            Map&     m_Map;
+
+        public:
+            size_t  m_nLoopFound = 0;
+            size_t  m_nLoopWrong = 0;
+            size_t  m_nBatchFound = 0;
+            size_t  m_nBatchWrong = 0;
+
+            clock_type::duration m_durLoop = clock_type::duration::zero();
+            clock_type::duration m_durBatch = clock_type::duration::zero();
+
+        public:
+            Worker( cds_test::thread_pool& pool, Map& map )
+                : base_class( pool )
+                , m_Map( map )
+            {}
+
+            Worker( Worker& src )
+                : base_class( src )
+                , m_Map( src.m_Map )
+            {}
+
+            virtual thread * clone()
+            {
+                return new Worker( *this );
+            }
+
+            virtual void test()
+            {
+                for ( size_t nPass = 0; nPass < s_nPassCount; ++nPass ) {
+                    // Alternate the order to not favour the second run by the warmed-up cache
+                    if (( nPass + id()) & 1 ) {
+                        find_loop();
+                        find_batch();
+                    }
+                    else {
+                        find_batch();
+                        find_loop();
+                    }
+                }
+            }
+
+        private:
+            void find_loop()
+            {
+                typedef typename Map::value_type map_pair;
+                Map& rMap = m_Map;
+                size_t nWrong = 0;
+
+                clock_type::time_point const start = clock_type::now();
+                for ( key_type key : s_arrKeys ) {
+                    if ( rMap.find( key, [&nWrong]( map_pair& item ) {
+                            if ( item.second != item.first * 2 )
+                                ++nWrong;
+                        } ))
+                    {
+                        ++m_nLoopFound;
+                    }
+                }
+                m_durLoop += clock_type::now() - start;
+                m_nLoopWrong += nWrong;
+            }
+
+            void find_batch()
+            {
+                typedef typename Map::value_type map_pair;
+                Map& rMap = m_Map;
+                size_t nWrong = 0;
+                size_t const nBatchSize = s_nBatchSize;
+                size_t const nCount = s_arrKeys.size();
+                key_type const* pKeys = s_arrKeys.data();
+
+                clock_type::time_point const start = clock_type::now();
+                for ( size_t nFirst = 0; nFirst < nCount; nFirst += nBatchSize ) {
+                    key_type const* pBatch = pKeys + nFirst;
+                    m_nBatchFound += rMap.find_batch( pBatch, std::min( nBatchSize, nCount - nFirst ),
+                        [pBatch, &nWrong]( size_t nIndex, map_pair& item ) {
+                            if ( item.first != pBatch[nIndex] || item.second != item.first * 2 )
+                                ++nWrong;
+                        } );
+                }
+                m_durBatch += clock_type::now() - start;
+                m_nBatchWrong += nWrong;
+            }
+        };
+
+    protected:
+        template <class Map>
+        void test( Map& testMap )
+        {
+            typedef Worker<Map> worker;
+
+            // Fill the map by even keys
+            for ( size_t i = 0; i < s_nMapSize; ++i )
+                EXPECT_TRUE( testMap.insert( i * 2, i * 4 ));
+
+            propout() << std::make_pair( "thread_count", s_nThreadCount )
+                << std::make_pair( "map_size", s_nMapSize )
+                << std::make_pair( "batch_size", s_nBatchSize )
+                << std::make_pair( "pass_count", s_nPassCount );
+
+            cds_test::thread_pool& pool = get_pool();
+            pool.add( new worker( pool, testMap ), s_nThreadCount );
+
+            std::chrono::milliseconds duration = pool.run();
+
+            propout() << std::make_pair( "duration", duration );
+
+            std::chrono::steady_clock::duration durLoop = std::chrono::steady_clock::duration::zero();
+            std::chrono::steady_clock::duration durBatch = std::chrono::steady_clock::duration::zero();
+            for ( size_t i = 0; i < pool.size(); ++i ) {
+                worker& w = static_cast<worker&>( pool.get( i ));
+                durLoop += w.m_durLoop;
+                durBatch += w.m_durBatch;
+
+                EXPECT_EQ( w.m_nLoopFound, s_nMapSize * s_nPassCount ) << "thread " << i;
+                EXPECT_EQ( w.m_nLoopWrong, 0u ) << "thread " << i;
+                EXPECT_EQ( w.m_nBatchFound, s_nMapSize * s_nPassCount ) << "thread " << i;
+                EXPECT_EQ( w.m_nBatchWrong, 0u ) << "thread " << i;
+            }
+
+            propout()
+                << std::make_pair( "find_loop_duration", std::chrono::duration_cast<std::chrono::milliseconds>( durLoop ))
+                << std::make_pair( "find_batch_duration", std::chrono::duration_cast<std::chrono::milliseconds>( durBatch ));
+
+            check_before_cleanup( testMap );
+
+            testMap.clear();
+            additional_check( testMap );
+            print_stat( propout(), testMap );
+            additional_cleanup( testMap );
+        }
+
+        template <class Map>
+        void run_test()
+        {
+            Map testMap( *this );
+            test( testMap );
+        }
+    };
+
+    class Map_FindBatch_LF: public Map_FindBatch
+        , public ::testing::WithParamInterface<size_t>
+    {
+    public:
+        template <class Map>
+        void run_test()
+        {
+            s_nLoadFactor = GetParam();
+            propout() << std::make_pair( "load_factor", s_nLoadFactor );
+            Map_FindBatch::run_test<Map>();
+        }
+    };
+
+} // namespace map
@@ -0,0 +1,18 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "map_find_batch.h"
+#include "map_type_feldman_hashmap.h"
+
+namespace map {
+
+    CDSSTRESS_FeldmanHashMap_case( Map_FindBatch, run_test, FeldmanHashMap_hp_fixed,          Map_FindBatch::key_type, Map_FindBatch::value_type )
+    CDSSTRESS_FeldmanHashMap_case( Map_FindBatch, run_test, FeldmanHashMap_dhp_fixed,         Map_FindBatch::key_type, Map_FindBatch::value_type )
+    CDSSTRESS_FeldmanHashMap_case( Map_FindBatch, run_test, FeldmanHashMap_hp_fixed_stat,     Map_FindBatch::key_type, Map_FindBatch::value_type )
+    CDSSTRESS_FeldmanHashMap_case( Map_FindBatch, run_test, FeldmanHashMap_rcu_gpi_fixed,     Map_FindBatch::key_type, Map_FindBatch::value_type )
+    CDSSTRESS_FeldmanHashMap_case( Map_FindBatch, run_test, FeldmanHashMap_rcu_gpb_fixed,     Map_FindBatch::key_type, Map_FindBatch::value_type )
+    CDSSTRESS_FeldmanHashMap_case( Map_FindBatch, run_test, FeldmanHashMap_rcu_gpt_fixed,     Map_FindBatch::key_type, Map_FindBatch::value_type )
+
+} // namespace map
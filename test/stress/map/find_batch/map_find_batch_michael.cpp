@@ -0,0 +1,19 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "map_find_batch.h"
+#include "map_type_michael.h"
+
+namespace map {
+
+    CDSSTRESS_MichaelMap_case( Map_FindBatch_LF, run_test, MichaelMap_HP_cmp,           Map_FindBatch::key_type, Map_FindBatch::value_type )
+    CDSSTRESS_MichaelMap_case( Map_FindBatch_LF, run_test, MichaelMap_DHP_cmp,          Map_FindBatch::key_type, Map_FindBatch::value_type )
+    CDSSTRESS_MichaelMap_case( Map_FindBatch_LF, run_test, MichaelMap_Lazy_HP_cmp,      Map_FindBatch::key_type, Map_FindBatch::value_type )
+    CDSSTRESS_MichaelMap_case( Map_FindBatch_LF, run_test, MichaelMap_Iterable_HP_cmp,  Map_FindBatch::key_type, Map_FindBatch::value_type )
+    CDSSTRESS_MichaelMap_case( Map_FindBatch_LF, run_test, MichaelMap_RCU_GPI_cmp,      Map_FindBatch::key_type, Map_FindBatch::value_type )
+    CDSSTRESS_MichaelMap_case( Map_FindBatch_LF, run_test, MichaelMap_RCU_GPB_less,     Map_FindBatch::key_type, Map_FindBatch::value_type )
+    CDSSTRESS_MichaelMap_case( Map_FindBatch_LF, run_test, MichaelMap_Lazy_RCU_GPT_cmp, Map_FindBatch::key_type, Map_FindBatch::value_type )
+
+} // namespace map
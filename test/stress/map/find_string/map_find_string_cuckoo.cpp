@@ -9,6 +9,7 @@
 namespace map {
 
     CDSSTRESS_CuckooMap( Map_find_string, run_test, std::string, Map_find_string::value_type )
+    CDSSTRESS_CuckooMap_optimistic( Map_find_string, run_test, std::string, Map_find_string::value_type )
 #if CDS_BUILD_BITS == 64
     CDSSTRESS_CuckooMap_city64( Map_find_string, run_test, std::string, Map_find_string::value_type )
 #endif
@@ -58,6 +58,8 @@ namespace map {
             size_t  m_nFindSuccess = 0;
             size_t  m_nFindFailed = 0;
 
+            std::chrono::nanoseconds m_nMaxLatency{ 0 };   // max latency of an operation
+
         public:
             Worker( cds_test::thread_pool& pool, Map& map )
                 : base_class( pool )
@@ -105,6 +107,8 @@ namespace map {
                 while ( !time_elapsed()) {
                     nRand = cds::bitop::RandXorShift( nRand );
                     size_t n = nRand / nNormalize;
+
+                    auto const tStart = std::chrono::steady_clock::now();
                     switch ( s_arrShuffle[i] ) {
                     case do_find:
                         if ( rMap.contains( n ))
@@ -134,6 +138,10 @@ namespace map {
                         break;
                     }
 
+                    std::chrono::nanoseconds const tOp = std::chrono::steady_clock::now() - tStart;
+                    if ( m_nMaxLatency < tOp )
+                        m_nMaxLatency = tOp;
+
                     if ( ++i >= c_nShuffleSize )
                         i = 0;
                 }
@@ -175,6 +183,7 @@ namespace map {
             size_t nDeleteFailed = 0;
             size_t nFindSuccess = 0;
             size_t nFindFailed = 0;
+            std::chrono::nanoseconds nMaxLatency{ 0 };
             for ( size_t i = 0; i < pool.size(); ++i ) {
                 worker& thr = static_cast<worker&>( pool.get( i ));
 
@@ -184,6 +193,7 @@ namespace map {
                 nDeleteFailed += thr.m_nDeleteFailed;
                 nFindSuccess += thr.m_nFindSuccess;
                 nFindFailed += thr.m_nFindFailed;
+                nMaxLatency = std::max( nMaxLatency, thr.m_nMaxLatency );
             }
 
             propout()
@@ -193,7 +203,8 @@ namespace map {
                 << std::make_pair( "delete_failed", nDeleteFailed )
                 << std::make_pair( "find_success", nFindSuccess )
                 << std::make_pair( "find_failed", nFindFailed )
-                << std::make_pair( "finish_map_size", testMap.size());
+                << std::make_pair( "finish_map_size", testMap.size())
+                << std::make_pair( "max_latency_us", std::chrono::duration_cast<std::chrono::microseconds>( nMaxLatency ).count());
 
             {
                 ASSERT_TRUE( std::chrono::duration_cast<std::chrono::seconds>(duration).count() > 0 );
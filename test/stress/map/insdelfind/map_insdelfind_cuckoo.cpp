@@ -9,5 +9,7 @@
 namespace map {
 
     CDSSTRESS_CuckooMap( Map_InsDelFind, run_test, size_t, size_t )
+    CDSSTRESS_CuckooMap_optimistic( Map_InsDelFind, run_test, size_t, size_t )
+    CDSSTRESS_CuckooMap_incremental( Map_InsDelFind, run_test, size_t, size_t )
 
 } // namespace map
@@ -0,0 +1,109 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSUNIT_MAP_TYPE_CTRIE_H
+#define CDSUNIT_MAP_TYPE_CTRIE_H
+
+#include "map_type.h"
+
+#include <cds/container/ctrie_map_rcu.h>
+
+#include <cds_test/stat_ctrie_out.h>
+
+namespace map {
+
+    template <class GC, typename Key, typename T, typename Traits = cc::ctrie::traits >
+    class CtrieMap : public cc::CtrieMap< GC, Key, T, Traits >
+    {
+        typedef cc::CtrieMap< GC, Key, T, Traits > base_class;
+    public:
+        template <typename Config>
+        CtrieMap( Config const& /*cfg*/ )
+            : base_class()
+        {}
+
+        // for testing
+        static constexpr bool const c_bExtractSupported = false;
+        static constexpr bool const c_bLoadFactorDepended = false;
+        static constexpr bool const c_bEraseExactKey = false;
+    };
+
+    struct tag_CtrieMap;
+
+    template <typename Key, typename Value>
+    struct map_type< tag_CtrieMap, Key, Value >: public map_type_base< Key, Value >
+    {
+        typedef map_type_base< Key, Value >      base_class;
+        typedef typename base_class::key_compare compare;
+        typedef typename base_class::key_less    less;
+        typedef typename base_class::key_hash    hash;
+
+        struct traits_CtrieMap_cmp:
+            public cc::ctrie::make_traits<
+                co::hash< hash >
+                ,co::compare< compare >
+            >::type
+        {};
+        typedef CtrieMap< rcu_gpi, Key, Value, traits_CtrieMap_cmp > CtrieMap_rcu_gpi_cmp;
+        typedef CtrieMap< rcu_gpb, Key, Value, traits_CtrieMap_cmp > CtrieMap_rcu_gpb_cmp;
+        typedef CtrieMap< rcu_gpt, Key, Value, traits_CtrieMap_cmp > CtrieMap_rcu_gpt_cmp;
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef CtrieMap< rcu_shb, Key, Value, traits_CtrieMap_cmp > CtrieMap_rcu_shb_cmp;
+#endif
+
+        struct traits_CtrieMap_less:
+            public cc::ctrie::make_traits<
+                co::hash< hash >
+                ,co::less< less >
+            >::type
+        {};
+        typedef CtrieMap< rcu_gpb, Key, Value, traits_CtrieMap_less > CtrieMap_rcu_gpb_less;
+
+        struct traits_CtrieMap_cmp_stat: public traits_CtrieMap_cmp
+        {
+            typedef cc::ctrie::stat<> stat;
+        };
+        typedef CtrieMap< rcu_gpi, Key, Value, traits_CtrieMap_cmp_stat > CtrieMap_rcu_gpi_cmp_stat;
+        typedef CtrieMap< rcu_gpb, Key, Value, traits_CtrieMap_cmp_stat > CtrieMap_rcu_gpb_cmp_stat;
+        typedef CtrieMap< rcu_gpt, Key, Value, traits_CtrieMap_cmp_stat > CtrieMap_rcu_gpt_cmp_stat;
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef CtrieMap< rcu_shb, Key, Value, traits_CtrieMap_cmp_stat > CtrieMap_rcu_shb_cmp_stat;
+#endif
+    };
+
+    template <typename GC, typename K, typename T, typename Traits >
+    static inline void print_stat( cds_test::property_stream& o, CtrieMap< GC, K, T, Traits > const& m )
+    {
+        o << m.statistics();
+    }
+
+} // namespace map
+
+#define CDSSTRESS_CtrieMap_case( fixture, test_case, ctrie_map_type, key_type, value_type ) \
+    TEST_F( fixture, ctrie_map_type ) \
+    { \
+        typedef map::map_type< tag_CtrieMap, key_type, value_type >::ctrie_map_type map_type; \
+        test_case<map_type>(); \
+    }
+
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+#   define CDSSTRESS_CtrieMap_SHRCU( fixture, test_case, key_type, value_type ) \
+        CDSSTRESS_CtrieMap_case( fixture, test_case, CtrieMap_rcu_shb_cmp,        key_type, value_type ) \
+        CDSSTRESS_CtrieMap_case( fixture, test_case, CtrieMap_rcu_shb_cmp_stat,   key_type, value_type )
+#else
+#   define CDSSTRESS_CtrieMap_SHRCU( fixture, test_case, key_type, value_type )
+#endif
+
+#define CDSSTRESS_CtrieMap( fixture, test_case, key_type, value_type ) \
+    CDSSTRESS_CtrieMap_case( fixture, test_case, CtrieMap_rcu_gpi_cmp,        key_type, value_type ) \
+    CDSSTRESS_CtrieMap_case( fixture, test_case, CtrieMap_rcu_gpb_cmp,        key_type, value_type ) \
+    CDSSTRESS_CtrieMap_case( fixture, test_case, CtrieMap_rcu_gpt_cmp,        key_type, value_type ) \
+    CDSSTRESS_CtrieMap_case( fixture, test_case, CtrieMap_rcu_gpb_less,       key_type, value_type ) \
+    CDSSTRESS_CtrieMap_case( fixture, test_case, CtrieMap_rcu_gpi_cmp_stat,   key_type, value_type ) \
+    CDSSTRESS_CtrieMap_case( fixture, test_case, CtrieMap_rcu_gpb_cmp_stat,   key_type, value_type ) \
+    CDSSTRESS_CtrieMap_case( fixture, test_case, CtrieMap_rcu_gpt_cmp_stat,   key_type, value_type ) \
+    CDSSTRESS_CtrieMap_SHRCU( fixture, test_case, key_type, value_type )
+
+#endif // ifndef CDSUNIT_MAP_TYPE_CTRIE_H
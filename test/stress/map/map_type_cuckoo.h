@@ -63,6 +63,22 @@ namespace map {
         {
             typedef cc::cuckoo::refinable<> mutex_policy;
         };
+        template <typename Traits>
+        struct traits_CuckooOptimisticMap : public Traits
+        {
+            typedef cc::cuckoo::optimistic_striping<> mutex_policy;
+        };
+        template <typename Traits>
+        struct traits_CuckooIncrementalMap : public Traits
+        {
+            typedef cc::cuckoo::striping<> mutex_policy;
+            static constexpr const size_t incremental_resizing = 4;
+        };
+        template <typename Traits>
+        struct traits_CuckooOptimisticIncrementalMap : public traits_CuckooOptimisticMap<Traits>
+        {
+            static constexpr const size_t incremental_resizing = 4;
+        };
 
         struct traits_CuckooMap_list_unord :
             public cc::cuckoo::make_traits <
@@ -73,6 +89,7 @@ namespace map {
         {};
         typedef CuckooMap< Key, Value, traits_CuckooStripedMap<traits_CuckooMap_list_unord>> CuckooStripedMap_list_unord;
         typedef CuckooMap< Key, Value, traits_CuckooRefinableMap<traits_CuckooMap_list_unord>> CuckooRefinableMap_list_unord;
+        typedef CuckooMap< Key, Value, traits_CuckooOptimisticMap<traits_CuckooMap_list_unord>> CuckooOptimisticMap_list_unord;
 
         struct traits_CuckooMap_list_unord_stat : public traits_CuckooMap_list_unord
         {
@@ -80,6 +97,9 @@ namespace map {
         };
         typedef CuckooMap< Key, Value, traits_CuckooStripedMap<traits_CuckooMap_list_unord_stat>> CuckooStripedMap_list_unord_stat;
         typedef CuckooMap< Key, Value, traits_CuckooRefinableMap<traits_CuckooMap_list_unord_stat>> CuckooRefinableMap_list_unord_stat;
+        typedef CuckooMap< Key, Value, traits_CuckooOptimisticMap<traits_CuckooMap_list_unord_stat>> CuckooOptimisticMap_list_unord_stat;
+        typedef CuckooMap< Key, Value, traits_CuckooIncrementalMap<traits_CuckooMap_list_unord_stat>> CuckooIncrementalMap_list_unord_stat;
+        typedef CuckooMap< Key, Value, traits_CuckooOptimisticIncrementalMap<traits_CuckooMap_list_unord_stat>> CuckooOptimisticIncrementalMap_list_unord_stat;
 
         struct traits_CuckooMap_list_unord_storehash : public traits_CuckooMap_list_unord
         {
@@ -87,6 +107,7 @@ namespace map {
         };
         typedef CuckooMap< Key, Value, traits_CuckooStripedMap<traits_CuckooMap_list_unord_storehash>> CuckooStripedMap_list_unord_storehash;
         typedef CuckooMap< Key, Value, traits_CuckooRefinableMap<traits_CuckooMap_list_unord_storehash>> CuckooRefinableMap_list_unord_storehash;
+        typedef CuckooMap< Key, Value, traits_CuckooOptimisticMap<traits_CuckooMap_list_unord_storehash>> CuckooOptimisticMap_list_unord_storehash;
 
         struct traits_CuckooMap_list_ord :
             public cc::cuckoo::make_traits <
@@ -145,6 +166,7 @@ namespace map {
         {};
         typedef CuckooMap< Key, Value, traits_CuckooStripedMap<traits_CuckooMap_vector_ord>> CuckooStripedMap_vector_ord;
         typedef CuckooMap< Key, Value, traits_CuckooRefinableMap<traits_CuckooMap_vector_ord>> CuckooRefinableMap_vector_ord;
+        typedef CuckooMap< Key, Value, traits_CuckooOptimisticMap<traits_CuckooMap_vector_ord>> CuckooOptimisticMap_vector_ord;
 
         struct traits_CuckooMap_vector_ord_stat : public traits_CuckooMap_vector_ord
         {
@@ -152,6 +174,7 @@ namespace map {
         };
         typedef CuckooMap< Key, Value, traits_CuckooStripedMap<traits_CuckooMap_vector_ord_stat>> CuckooStripedMap_vector_ord_stat;
         typedef CuckooMap< Key, Value, traits_CuckooRefinableMap<traits_CuckooMap_vector_ord_stat>> CuckooRefinableMap_vector_ord_stat;
+        typedef CuckooMap< Key, Value, traits_CuckooOptimisticMap<traits_CuckooMap_vector_ord_stat>> CuckooOptimisticMap_vector_ord_stat;
 
         struct traits_CuckooMap_vector_ord_storehash : public traits_CuckooMap_vector_ord
         {
@@ -159,6 +182,9 @@ namespace map {
         };
         typedef CuckooMap< Key, Value, traits_CuckooStripedMap<traits_CuckooMap_vector_ord_storehash>> CuckooStripedMap_vector_ord_storehash;
         typedef CuckooMap< Key, Value, traits_CuckooRefinableMap<traits_CuckooMap_vector_ord_storehash>> CuckooRefinableMap_vector_ord_storehash;
+        typedef CuckooMap< Key, Value, traits_CuckooOptimisticMap<traits_CuckooMap_vector_ord_storehash>> CuckooOptimisticMap_vector_ord_storehash;
+        typedef CuckooMap< Key, Value, traits_CuckooIncrementalMap<traits_CuckooMap_vector_ord_storehash>> CuckooIncrementalMap_vector_ord_storehash;
+        typedef CuckooMap< Key, Value, traits_CuckooOptimisticIncrementalMap<traits_CuckooMap_vector_ord_storehash>> CuckooOptimisticIncrementalMap_vector_ord_storehash;
 
 #if CDS_BUILD_BITS == 64
 
@@ -309,6 +335,20 @@ namespace map {
     CDSSTRESS_CuckooMap_case( fixture, test_case, CuckooStripedMap_vector_ord_storehash,    key_type, value_type ) \
     CDSSTRESS_CuckooMap_case( fixture, test_case, CuckooRefinableMap_vector_ord_storehash,  key_type, value_type )
 
+#define CDSSTRESS_CuckooMap_optimistic( fixture, test_case, key_type, value_type ) \
+    CDSSTRESS_CuckooMap_case( fixture, test_case, CuckooOptimisticMap_list_unord,           key_type, value_type ) \
+    CDSSTRESS_CuckooMap_case( fixture, test_case, CuckooOptimisticMap_list_unord_stat,      key_type, value_type ) \
+    CDSSTRESS_CuckooMap_case( fixture, test_case, CuckooOptimisticMap_list_unord_storehash, key_type, value_type ) \
+    CDSSTRESS_CuckooMap_case( fixture, test_case, CuckooOptimisticMap_vector_ord,           key_type, value_type ) \
+    CDSSTRESS_CuckooMap_case( fixture, test_case, CuckooOptimisticMap_vector_ord_stat,      key_type, value_type ) \
+    CDSSTRESS_CuckooMap_case( fixture, test_case, CuckooOptimisticMap_vector_ord_storehash, key_type, value_type )
+
+#define CDSSTRESS_CuckooMap_incremental( fixture, test_case, key_type, value_type ) \
+    CDSSTRESS_CuckooMap_case( fixture, test_case, CuckooIncrementalMap_list_unord_stat,               key_type, value_type ) \
+    CDSSTRESS_CuckooMap_case( fixture, test_case, CuckooIncrementalMap_vector_ord_storehash,          key_type, value_type ) \
+    CDSSTRESS_CuckooMap_case( fixture, test_case, CuckooOptimisticIncrementalMap_list_unord_stat,     key_type, value_type ) \
+    CDSSTRESS_CuckooMap_case( fixture, test_case, CuckooOptimisticIncrementalMap_vector_ord_storehash, key_type, value_type )
+
 #if CDS_BUILD_BITS == 64
 #   define CDSSTRESS_CuckooMap_city64( fixture, test_case, key_type, value_type ) \
         CDSSTRESS_CuckooMap_case( fixture, test_case, CuckooStripedMap_list_unord_city64,              key_type, value_type ) \
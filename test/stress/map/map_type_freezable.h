@@ -0,0 +1,100 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSUNIT_MAP_TYPE_FREEZABLE_H
+#define CDSUNIT_MAP_TYPE_FREEZABLE_H
+
+#include "map_type.h"
+
+#include <cds/gc/hp.h>
+#include <cds/gc/dhp.h>
+#include <cds/container/freezable_hash_map.h>
+
+#include <cds_test/stat_freezable_hash_out.h>
+
+namespace map {
+
+    template <class GC, typename Key, typename T, typename Traits = cc::freezable_hash::traits>
+    class FreezableHashMap : public cc::FreezableHashMap< GC, Key, T, Traits >
+    {
+        typedef cc::FreezableHashMap< GC, Key, T, Traits > base_class;
+    public:
+        // The map starts small and grows while the test fills it
+        static constexpr size_t const c_nInitialSize = 1024;
+
+        template <typename Config>
+        FreezableHashMap( Config const& cfg )
+            : base_class( c_nInitialSize, cfg.s_nLoadFactor )
+        {}
+
+        // for testing
+        static constexpr bool const c_bExtractSupported = false;
+        static constexpr bool const c_bLoadFactorDepended = true;
+        static constexpr bool const c_bEraseExactKey = false;
+    };
+
+    struct tag_FreezableHashMap;
+
+    template <typename Key, typename Value>
+    struct map_type< tag_FreezableHashMap, Key, Value >: public map_type_base< Key, Value >
+    {
+        typedef map_type_base< Key, Value > base_class;
+        typedef typename base_class::key_compare compare;
+        typedef typename base_class::key_less    less;
+        typedef typename base_class::key_hash    hash;
+
+        struct traits_FreezableMap_cmp:
+            public cc::freezable_hash::make_traits<
+                co::hash< hash >
+                ,co::compare< compare >
+                ,co::item_counter< cds::atomicity::cache_friendly_item_counter >
+            >::type
+        {};
+        typedef FreezableHashMap< cds::gc::HP,  Key, Value, traits_FreezableMap_cmp > FreezableMap_HP_cmp;
+        typedef FreezableHashMap< cds::gc::DHP, Key, Value, traits_FreezableMap_cmp > FreezableMap_DHP_cmp;
+
+        struct traits_FreezableMap_less:
+            public cc::freezable_hash::make_traits<
+                co::hash< hash >
+                ,co::less< less >
+                ,co::item_counter< cds::atomicity::cache_friendly_item_counter >
+            >::type
+        {};
+        typedef FreezableHashMap< cds::gc::HP,  Key, Value, traits_FreezableMap_less > FreezableMap_HP_less;
+        typedef FreezableHashMap< cds::gc::DHP, Key, Value, traits_FreezableMap_less > FreezableMap_DHP_less;
+
+        struct traits_FreezableMap_cmp_stat: public traits_FreezableMap_cmp
+        {
+            typedef cc::freezable_hash::stat<> stat;
+        };
+        typedef FreezableHashMap< cds::gc::HP,  Key, Value, traits_FreezableMap_cmp_stat > FreezableMap_HP_cmp_stat;
+        typedef FreezableHashMap< cds::gc::DHP, Key, Value, traits_FreezableMap_cmp_stat > FreezableMap_DHP_cmp_stat;
+    };
+
+    template <typename GC, typename K, typename T, typename Traits >
+    static inline void print_stat( cds_test::property_stream& o, FreezableHashMap< GC, K, T, Traits > const& m )
+    {
+        o << m.statistics()
+          << std::make_pair( "bucket_count", m.bucket_count());
+    }
+
+} // namespace map
+
+#define CDSSTRESS_FreezableHashMap_case( fixture, test_case, freezable_map_type, key_type, value_type ) \
+    TEST_P( fixture, freezable_map_type ) \
+    { \
+        typedef map::map_type< tag_FreezableHashMap, key_type, value_type >::freezable_map_type map_type; \
+        test_case<map_type>(); \
+    }
+
+#define CDSSTRESS_FreezableHashMap( fixture, test_case, key_type, value_type ) \
+    CDSSTRESS_FreezableHashMap_case( fixture, test_case, FreezableMap_HP_cmp,       key_type, value_type ) \
+    CDSSTRESS_FreezableHashMap_case( fixture, test_case, FreezableMap_DHP_cmp,      key_type, value_type ) \
+    CDSSTRESS_FreezableHashMap_case( fixture, test_case, FreezableMap_HP_less,      key_type, value_type ) \
+    CDSSTRESS_FreezableHashMap_case( fixture, test_case, FreezableMap_DHP_less,     key_type, value_type ) \
+    CDSSTRESS_FreezableHashMap_case( fixture, test_case, FreezableMap_HP_cmp_stat,  key_type, value_type ) \
+    CDSSTRESS_FreezableHashMap_case( fixture, test_case, FreezableMap_DHP_cmp_stat, key_type, value_type ) \
+
+#endif // ifndef CDSUNIT_MAP_TYPE_FREEZABLE_H
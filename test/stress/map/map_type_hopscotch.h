@@ -0,0 +1,108 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSUNIT_MAP_TYPE_HOPSCOTCH_H
+#define CDSUNIT_MAP_TYPE_HOPSCOTCH_H
+
+#include "map_type.h"
+
+#include <cds/container/hopscotch_map.h>
+#include <cds_test/stat_hopscotch_out.h>
+
+namespace map {
+
+    // InitialSize == 0: the map is sized for the test map size, otherwise it starts small and grows
+    template <typename K, typename V, typename Traits, size_t InitialSize = 0>
+    class HopscotchMap : public cc::HopscotchMap< K, V, Traits >
+    {
+    public:
+        typedef cc::HopscotchMap< K, V, Traits > hopscotch_base_class;
+
+    public:
+        template <typename Config>
+        HopscotchMap( Config const& cfg )
+            : hopscotch_base_class( InitialSize ? InitialSize : cfg.s_nMapSize )
+        {}
+
+        // for testing
+        static constexpr bool const c_bExtractSupported = false;
+        static constexpr bool const c_bLoadFactorDepended = false;
+        static constexpr bool const c_bEraseExactKey = false;
+    };
+
+    struct tag_HopscotchMap;
+
+    template <typename Key, typename Value>
+    struct map_type< tag_HopscotchMap, Key, Value >: public map_type_base< Key, Value >
+    {
+        typedef map_type_base< Key, Value > base_class;
+        typedef typename base_class::equal_to   equal_to;
+        typedef typename base_class::key_less   less;
+        typedef typename base_class::key_hash   hash;
+
+        struct traits_HopscotchMap_equal:
+            public cc::hopscotch::make_traits<
+                co::hash< hash >
+                ,co::equal_to< equal_to >
+                ,co::item_counter< cds::atomicity::cache_friendly_item_counter >
+            >::type
+        {};
+        typedef HopscotchMap< Key, Value, traits_HopscotchMap_equal > HopscotchMap_equal;
+
+        struct traits_HopscotchMap_less:
+            public cc::hopscotch::make_traits<
+                co::hash< hash >
+                ,co::less< less >
+                ,co::item_counter< cds::atomicity::cache_friendly_item_counter >
+            >::type
+        {};
+        typedef HopscotchMap< Key, Value, traits_HopscotchMap_less > HopscotchMap_less;
+
+        struct traits_HopscotchMap_equal_stat: public traits_HopscotchMap_equal
+        {
+            typedef cc::hopscotch::stat<> stat;
+        };
+        typedef HopscotchMap< Key, Value, traits_HopscotchMap_equal_stat > HopscotchMap_equal_stat;
+
+        struct traits_HopscotchMap_H16_stat: public cc::hopscotch::neighbourhood< 16 >::pack< traits_HopscotchMap_equal_stat >
+        {};
+        typedef HopscotchMap< Key, Value, traits_HopscotchMap_H16_stat > HopscotchMap_H16_stat;
+
+        struct traits_HopscotchMap_spin_stat: public traits_HopscotchMap_equal_stat
+        {
+            typedef cds::sync::spin lock_type;
+        };
+        typedef HopscotchMap< Key, Value, traits_HopscotchMap_spin_stat > HopscotchMap_spin_stat;
+
+        // Starts from 1024 items, so the table grows while the test fills it
+        typedef HopscotchMap< Key, Value, traits_HopscotchMap_equal_stat, 1024 > HopscotchMap_equal_stat_grow;
+    };
+
+    template <typename K, typename V, typename Traits, size_t InitialSize>
+    static inline void print_stat( cds_test::property_stream& o, HopscotchMap< K, V, Traits, InitialSize > const& m )
+    {
+        o << m.statistics()
+          << std::make_pair( "bucket_count", m.bucket_count())
+          << std::make_pair( "lock_count", m.lock_count());
+    }
+
+} // namespace map
+
+#define CDSSTRESS_HopscotchMap_case( fixture, test_case, hopscotch_map_type, key_type, value_type ) \
+    TEST_F( fixture, hopscotch_map_type ) \
+    { \
+        typedef map::map_type< tag_HopscotchMap, key_type, value_type >::hopscotch_map_type map_type; \
+        test_case<map_type>(); \
+    }
+
+#define CDSSTRESS_HopscotchMap( fixture, test_case, key_type, value_type ) \
+    CDSSTRESS_HopscotchMap_case( fixture, test_case, HopscotchMap_equal,            key_type, value_type ) \
+    CDSSTRESS_HopscotchMap_case( fixture, test_case, HopscotchMap_less,             key_type, value_type ) \
+    CDSSTRESS_HopscotchMap_case( fixture, test_case, HopscotchMap_equal_stat,       key_type, value_type ) \
+    CDSSTRESS_HopscotchMap_case( fixture, test_case, HopscotchMap_H16_stat,         key_type, value_type ) \
+    CDSSTRESS_HopscotchMap_case( fixture, test_case, HopscotchMap_spin_stat,        key_type, value_type ) \
+    CDSSTRESS_HopscotchMap_case( fixture, test_case, HopscotchMap_equal_stat_grow,  key_type, value_type )
+
+#endif // #ifndef CDSUNIT_MAP_TYPE_HOPSCOTCH_H
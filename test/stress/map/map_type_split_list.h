@@ -171,6 +171,13 @@ namespace map {
         typedef SplitListMap< rcu_shb, Key, Value, traits_SplitList_Michael_dyn_cmp_stat > SplitList_Michael_RCU_SHB_dyn_cmp_stat;
 #endif
 
+        struct traits_SplitList_Michael_dyn_cmp_shrink : public traits_SplitList_Michael_dyn_cmp_stat
+        {
+            enum { shrink_factor = 4 };
+        };
+        typedef SplitListMap< cds::gc::HP, Key, Value, traits_SplitList_Michael_dyn_cmp_shrink > SplitList_Michael_HP_dyn_cmp_shrink;
+        typedef SplitListMap< cds::gc::DHP, Key, Value, traits_SplitList_Michael_dyn_cmp_shrink > SplitList_Michael_DHP_dyn_cmp_shrink;
+
         struct traits_SplitList_Michael_dyn_cmp_seqcst: public cc::split_list::make_traits<
                 cc::split_list::ordered_list<cc::michael_list_tag>
                 ,co::hash< hash >
@@ -324,6 +331,13 @@ namespace map {
         typedef SplitListMap< rcu_shb, Key, Value, SplitList_Lazy_dyn_cmp_stat > SplitList_Lazy_RCU_SHB_dyn_cmp_stat;
 #endif
 
+        struct SplitList_Lazy_dyn_cmp_shrink : public SplitList_Lazy_dyn_cmp_stat
+        {
+            enum { shrink_factor = 4 };
+        };
+        typedef SplitListMap< cds::gc::HP, Key, Value, SplitList_Lazy_dyn_cmp_shrink > SplitList_Lazy_HP_dyn_cmp_shrink;
+        typedef SplitListMap< cds::gc::DHP, Key, Value, SplitList_Lazy_dyn_cmp_shrink > SplitList_Lazy_DHP_dyn_cmp_shrink;
+
         struct SplitList_Lazy_dyn_cmp_seqcst :
             public cc::split_list::make_traits<
                 cc::split_list::ordered_list<cc::lazy_list_tag>
@@ -646,6 +660,8 @@ namespace map {
         CDSSTRESS_SplitListMap_case( fixture, test_case, SplitList_Lazy_DHP_dyn_less,               key_type, value_type ) \
         CDSSTRESS_SplitListMap_case( fixture, test_case, SplitList_Lazy_HP_st_less,                 key_type, value_type ) \
         CDSSTRESS_SplitListMap_case( fixture, test_case, SplitList_Lazy_DHP_st_less_stat,           key_type, value_type ) \
+        CDSSTRESS_SplitListMap_case( fixture, test_case, SplitList_Michael_DHP_dyn_cmp_shrink,      key_type, value_type ) \
+        CDSSTRESS_SplitListMap_case( fixture, test_case, SplitList_Lazy_HP_dyn_cmp_shrink,          key_type, value_type ) \
 
 #   define CDSSTRESS_SplitListMap_RCU_1( fixture, test_case, key_type, value_type ) \
         CDSSTRESS_SplitListMap_case( fixture, test_case, SplitList_Michael_RCU_GPI_dyn_cmp_stat,    key_type, value_type ) \
@@ -693,6 +709,8 @@ namespace map {
     CDSSTRESS_SplitListMap_case( fixture, test_case, SplitList_Lazy_HP_dyn_less,                key_type, value_type ) \
     CDSSTRESS_SplitListMap_case( fixture, test_case, SplitList_Lazy_DHP_st_less,                key_type, value_type ) \
     CDSSTRESS_SplitListMap_case( fixture, test_case, SplitList_Lazy_HP_st_less_stat,            key_type, value_type ) \
+    CDSSTRESS_SplitListMap_case( fixture, test_case, SplitList_Michael_HP_dyn_cmp_shrink,       key_type, value_type ) \
+    CDSSTRESS_SplitListMap_case( fixture, test_case, SplitList_Lazy_DHP_dyn_cmp_shrink,         key_type, value_type ) \
     CDSSTRESS_SplitListMap_HP_1( fixture, test_case, key_type, value_type ) \
     CDSSTRESS_SplitListMap_HP_2( fixture, test_case, key_type, value_type ) \
 
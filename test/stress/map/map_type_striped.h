@@ -123,6 +123,42 @@ namespace map {
             , co::hash< hash2 >
         > StripedMap_boost_unordered_map;
 
+        // Reader-writer lock striping: find() locks the stripe in shared mode
+        typedef StripedHashMap_seq<
+            std::list< std::pair< Key const, Value > >
+            , co::hash< hash2 >
+            , co::less< less >
+            , co::mutex_policy< cc::striped_set::rw_striping<> >
+        > StripedMap_rw_list;
+
+        typedef StripedHashMap_ord<
+            std::unordered_map< Key, Value, hash, equal_to >
+            , co::hash< hash2 >
+            , co::mutex_policy< cc::striped_set::rw_striping<> >
+        > StripedMap_rw_hashmap;
+
+        typedef StripedHashMap_ord<
+            std::map< Key, Value, less >
+            , co::hash< hash2 >
+            , co::mutex_policy< cc::striped_set::rw_striping<> >
+        > StripedMap_rw_map;
+
+        // Incremental resizing: the old buckets are moved to the new table by the map operations
+        typedef StripedHashMap_seq<
+            std::list< std::pair< Key const, Value > >
+            , co::hash< hash2 >
+            , co::less< less >
+            , cc::striped_set::incremental_resizing< 4 >
+        > StripedMap_incremental_list;
+
+        typedef StripedHashMap_seq<
+            std::list< std::pair< Key const, Value > >
+            , co::hash< hash2 >
+            , co::less< less >
+            , co::mutex_policy< cc::striped_set::rw_striping<> >
+            , cc::striped_set::incremental_resizing< 4 >
+        > StripedMap_rw_incremental_list;
+
 #   if BOOST_VERSION >= 104800
         typedef StripedHashMap_seq<
             boost::container::slist< std::pair< Key const, Value > >
@@ -279,6 +315,11 @@ namespace map {
     CDSSTRESS_StripedMap_case( fixture, test_case, StripedMap_list,         key_type, value_type ) \
     CDSSTRESS_StripedMap_case( fixture, test_case, StripedMap_hashmap,      key_type, value_type ) \
     CDSSTRESS_StripedMap_case( fixture, test_case, StripedMap_map,          key_type, value_type ) \
+    CDSSTRESS_StripedMap_case( fixture, test_case, StripedMap_rw_list,      key_type, value_type ) \
+    CDSSTRESS_StripedMap_case( fixture, test_case, StripedMap_rw_hashmap,   key_type, value_type ) \
+    CDSSTRESS_StripedMap_case( fixture, test_case, StripedMap_rw_map,       key_type, value_type ) \
+    CDSSTRESS_StripedMap_case( fixture, test_case, StripedMap_incremental_list,   key_type, value_type ) \
+    CDSSTRESS_StripedMap_case( fixture, test_case, StripedMap_rw_incremental_list, key_type, value_type ) \
     CDSSTRESS_StripedMap_case( fixture, test_case, RefinableMap_list,       key_type, value_type ) \
     CDSSTRESS_StripedMap_case( fixture, test_case, RefinableMap_map,        key_type, value_type ) \
     CDSSTRESS_StripedMap_case( fixture, test_case, RefinableMap_hashmap,    key_type, value_type ) \
@@ -0,0 +1,111 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSUNIT_MAP_TYPE_SWISS_H
+#define CDSUNIT_MAP_TYPE_SWISS_H
+
+#include "map_type.h"
+
+#include <cds/gc/hp.h>
+#include <cds/gc/dhp.h>
+#include <cds/container/swiss_hash_map.h>
+
+#include <cds_test/stat_swiss_hash_out.h>
+
+namespace map {
+
+    // InitialSize == 0: the map is sized for the test map size, otherwise it starts small and grows
+    template <class GC, typename Key, typename T, typename Traits = cc::swiss_hash::traits, size_t InitialSize = 0>
+    class SwissHashMap : public cc::SwissHashMap< GC, Key, T, Traits >
+    {
+        typedef cc::SwissHashMap< GC, Key, T, Traits > base_class;
+    public:
+        template <typename Config>
+        SwissHashMap( Config const& cfg )
+            : base_class( InitialSize ? InitialSize : cfg.s_nMapSize )
+        {}
+
+        // for testing
+        static constexpr bool const c_bExtractSupported = false;
+        static constexpr bool const c_bLoadFactorDepended = false;
+        static constexpr bool const c_bEraseExactKey = false;
+    };
+
+    struct tag_SwissHashMap;
+
+    template <typename Key, typename Value>
+    struct map_type< tag_SwissHashMap, Key, Value >: public map_type_base< Key, Value >
+    {
+        typedef map_type_base< Key, Value > base_class;
+        typedef typename base_class::key_compare compare;
+        typedef typename base_class::key_less    less;
+        typedef typename base_class::key_hash    hash;
+
+        struct traits_SwissMap_cmp:
+            public cc::swiss_hash::make_traits<
+                co::hash< hash >
+                ,co::compare< compare >
+                ,co::item_counter< cds::atomicity::cache_friendly_item_counter >
+            >::type
+        {};
+        typedef SwissHashMap< cds::gc::HP,  Key, Value, traits_SwissMap_cmp > SwissMap_HP_cmp;
+        typedef SwissHashMap< cds::gc::DHP, Key, Value, traits_SwissMap_cmp > SwissMap_DHP_cmp;
+
+        struct traits_SwissMap_less:
+            public cc::swiss_hash::make_traits<
+                co::hash< hash >
+                ,co::less< less >
+                ,co::item_counter< cds::atomicity::cache_friendly_item_counter >
+            >::type
+        {};
+        typedef SwissHashMap< cds::gc::HP,  Key, Value, traits_SwissMap_less > SwissMap_HP_less;
+        typedef SwissHashMap< cds::gc::DHP, Key, Value, traits_SwissMap_less > SwissMap_DHP_less;
+
+        struct traits_SwissMap_cmp_swar: public traits_SwissMap_cmp
+        {
+            static constexpr const bool simd = false;
+        };
+        typedef SwissHashMap< cds::gc::HP,  Key, Value, traits_SwissMap_cmp_swar > SwissMap_HP_cmp_swar;
+
+        struct traits_SwissMap_cmp_stat: public traits_SwissMap_cmp
+        {
+            typedef cc::swiss_hash::stat<> stat;
+        };
+        typedef SwissHashMap< cds::gc::HP,  Key, Value, traits_SwissMap_cmp_stat > SwissMap_HP_cmp_stat;
+        typedef SwissHashMap< cds::gc::DHP, Key, Value, traits_SwissMap_cmp_stat > SwissMap_DHP_cmp_stat;
+
+        // Starts from 1024 items, so the table grows while the test fills it
+        typedef SwissHashMap< cds::gc::HP,  Key, Value, traits_SwissMap_cmp_stat, 1024 > SwissMap_HP_cmp_stat_grow;
+        typedef SwissHashMap< cds::gc::DHP, Key, Value, traits_SwissMap_cmp_stat, 1024 > SwissMap_DHP_cmp_stat_grow;
+    };
+
+    template <typename GC, typename K, typename T, typename Traits, size_t InitialSize >
+    static inline void print_stat( cds_test::property_stream& o, SwissHashMap< GC, K, T, Traits, InitialSize > const& m )
+    {
+        o << m.statistics()
+          << std::make_pair( "capacity", m.capacity());
+    }
+
+} // namespace map
+
+#define CDSSTRESS_SwissHashMap_case( fixture, test_case, swiss_map_type, key_type, value_type ) \
+    TEST_F( fixture, swiss_map_type ) \
+    { \
+        typedef map::map_type< tag_SwissHashMap, key_type, value_type >::swiss_map_type map_type; \
+        test_case<map_type>(); \
+    }
+
+#define CDSSTRESS_SwissHashMap( fixture, test_case, key_type, value_type ) \
+    CDSSTRESS_SwissHashMap_case( fixture, test_case, SwissMap_HP_cmp,               key_type, value_type ) \
+    CDSSTRESS_SwissHashMap_case( fixture, test_case, SwissMap_DHP_cmp,              key_type, value_type ) \
+    CDSSTRESS_SwissHashMap_case( fixture, test_case, SwissMap_HP_less,              key_type, value_type ) \
+    CDSSTRESS_SwissHashMap_case( fixture, test_case, SwissMap_DHP_less,             key_type, value_type ) \
+    CDSSTRESS_SwissHashMap_case( fixture, test_case, SwissMap_HP_cmp_swar,          key_type, value_type ) \
+    CDSSTRESS_SwissHashMap_case( fixture, test_case, SwissMap_HP_cmp_stat,          key_type, value_type ) \
+    CDSSTRESS_SwissHashMap_case( fixture, test_case, SwissMap_DHP_cmp_stat,         key_type, value_type ) \
+    CDSSTRESS_SwissHashMap_case( fixture, test_case, SwissMap_HP_cmp_stat_grow,     key_type, value_type ) \
+    CDSSTRESS_SwissHashMap_case( fixture, test_case, SwissMap_DHP_cmp_stat_grow,    key_type, value_type )
+
+#endif // ifndef CDSUNIT_MAP_TYPE_SWISS_H
@@ -186,8 +186,23 @@ namespace {
     CDSSTRESS_MSPriorityQueue( pqueue_pop, MSPriorityQueue_dyn_less )
     CDSSTRESS_MSPriorityQueue( pqueue_pop, MSPriorityQueue_dyn_less_stat )
     CDSSTRESS_MSPriorityQueue( pqueue_pop, MSPriorityQueue_dyn_cmp )
+    CDSSTRESS_MSPriorityQueue( pqueue_pop, MSPriorityQueue_dyn_4ary_less )
+    CDSSTRESS_MSPriorityQueue( pqueue_pop, MSPriorityQueue_dyn_8ary_less )
     //CDSSTRESS_MSPriorityQueue( pqueue_pop, MSPriorityQueue_dyn_mutex ) // too slow
 
+#define CDSSTRESS_MSPriorityQueue_growable( fixture_t, pqueue_t ) \
+    TEST_F( fixture_t, pqueue_t ) \
+    { \
+        typedef pqueue::Types<pqueue::simple_value>::pqueue_t pqueue_type; \
+        pqueue_type pq( 1024 ); /* the heap grows on demand */ \
+        test( pq ); \
+    }
+    CDSSTRESS_MSPriorityQueue_growable( pqueue_pop, MSPriorityQueue_growable_less )
+    CDSSTRESS_MSPriorityQueue_growable( pqueue_pop, MSPriorityQueue_growable_less_stat )
+    CDSSTRESS_MSPriorityQueue_growable( pqueue_pop, MSPriorityQueue_growable_4ary_less )
+    CDSSTRESS_MSPriorityQueue_growable( pqueue_pop, MSPriorityQueue_growable_8ary_less )
+    CDSSTRESS_MSPriorityQueue_growable( pqueue_pop, MSPriorityQueue_growable_8ary_less_stat )
+
 #define CDSSTRESS_MSPriorityQueue_static( fixture_t, pqueue_t ) \
     TEST_F( fixture_t, pqueue_t ) \
     { \
@@ -263,6 +278,17 @@ namespace {
     CDSSTRESS_PriorityQueue( pqueue_pop, SkipList32_RCU_shb_min )
 #endif
 
+    CDSSTRESS_PriorityQueue( pqueue_pop, SprayList_HP_strict )
+    CDSSTRESS_PriorityQueue( pqueue_pop, SprayList_HP_strict_stat )
+    CDSSTRESS_PriorityQueue( pqueue_pop, SprayList_DHP_strict )
+    CDSSTRESS_PriorityQueue( pqueue_pop, SprayList_DHP_strict_stat )
+    CDSSTRESS_PriorityQueue( pqueue_pop, SprayList_RCU_gpi_strict )
+    CDSSTRESS_PriorityQueue( pqueue_pop, SprayList_RCU_gpb_strict )
+    CDSSTRESS_PriorityQueue( pqueue_pop, SprayList_RCU_gpt_strict )
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+    CDSSTRESS_PriorityQueue( pqueue_pop, SprayList_RCU_shb_strict )
+#endif
+
     CDSSTRESS_PriorityQueue( pqueue_pop, StdPQueue_vector_spin )
     CDSSTRESS_PriorityQueue( pqueue_pop, StdPQueue_vector_mutex )
     CDSSTRESS_PriorityQueue( pqueue_pop, StdPQueue_deque_spin )
@@ -13,6 +13,7 @@
 
 #include <cds/container/mspriority_queue.h>
 #include <cds/container/fcpriority_queue.h>
+#include <cds/container/multi_queue.h>
 
 #include <cds/container/ellen_bintree_set_hp.h>
 #include <cds/container/ellen_bintree_set_dhp.h>
@@ -22,6 +23,10 @@
 #include <cds/container/skip_list_set_dhp.h>
 #include <cds/container/skip_list_set_rcu.h>
 
+#include <cds/container/spray_list_hp.h>
+#include <cds/container/spray_list_dhp.h>
+#include <cds/container/spray_list_rcu.h>
+
 #include <cds/sync/spinlock.h>
 
 #include <queue>
@@ -396,6 +401,107 @@ namespace pqueue {
         {};
         typedef cc::MSPriorityQueue< Value, traits_MSPriorityQueue_dyn_mutex > MSPriorityQueue_dyn_mutex;
 
+        struct traits_MSPriorityQueue_dyn_4ary: public traits_MSPriorityQueue_dyn
+        {
+            static constexpr const unsigned int arity = 4;
+        };
+        typedef cc::MSPriorityQueue< Value, traits_MSPriorityQueue_dyn_4ary > MSPriorityQueue_dyn_4ary_less;
+
+        struct traits_MSPriorityQueue_dyn_8ary: public traits_MSPriorityQueue_dyn
+        {
+            static constexpr const unsigned int arity = 8;
+        };
+        typedef cc::MSPriorityQueue< Value, traits_MSPriorityQueue_dyn_8ary > MSPriorityQueue_dyn_8ary_less;
+
+        struct traits_MSPriorityQueue_growable: public cc::mspriority_queue::traits
+        {
+            typedef cc::mspriority_queue::growable_buffer< char > buffer;
+        };
+        typedef cc::MSPriorityQueue< Value, traits_MSPriorityQueue_growable > MSPriorityQueue_growable_less;
+
+        struct traits_MSPriorityQueue_growable_stat: public traits_MSPriorityQueue_growable
+        {
+            typedef cc::mspriority_queue::stat<> stat;
+        };
+        typedef cc::MSPriorityQueue< Value, traits_MSPriorityQueue_growable_stat > MSPriorityQueue_growable_less_stat;
+
+        struct traits_MSPriorityQueue_growable_4ary: public traits_MSPriorityQueue_growable
+        {
+            static constexpr const unsigned int arity = 4;
+        };
+        typedef cc::MSPriorityQueue< Value, traits_MSPriorityQueue_growable_4ary > MSPriorityQueue_growable_4ary_less;
+
+        struct traits_MSPriorityQueue_growable_8ary: public traits_MSPriorityQueue_growable
+        {
+            static constexpr const unsigned int arity = 8;
+        };
+        typedef cc::MSPriorityQueue< Value, traits_MSPriorityQueue_growable_8ary > MSPriorityQueue_growable_8ary_less;
+
+        struct traits_MSPriorityQueue_growable_8ary_stat: public traits_MSPriorityQueue_growable_8ary
+        {
+            typedef cc::mspriority_queue::stat<> stat;
+        };
+        typedef cc::MSPriorityQueue< Value, traits_MSPriorityQueue_growable_8ary_stat > MSPriorityQueue_growable_8ary_less_stat;
+
+
+        // MultiQueue
+        typedef cc::MultiQueue< Value > MultiQueue_spin;
+
+        struct traits_MultiQueue_stat: public cc::multi_queue::traits
+        {
+            typedef cc::multi_queue::stat<> stat;
+        };
+        typedef cc::MultiQueue< Value, traits_MultiQueue_stat > MultiQueue_spin_stat;
+
+        struct traits_MultiQueue_mutex : public
+            cc::multi_queue::make_traits <
+                co::lock_type < std::mutex >
+            > ::type
+        {};
+        typedef cc::MultiQueue< Value, traits_MultiQueue_mutex > MultiQueue_mutex;
+
+        // SprayList: strict (Linden-Jonsson) and relaxed (SprayList) modes
+        struct traits_SprayList_strict: public cc::spray_list::traits
+        {};
+        typedef cc::SprayList< cds::gc::HP, Value, traits_SprayList_strict > SprayList_HP_strict;
+        typedef cc::SprayList< cds::gc::DHP, Value, traits_SprayList_strict > SprayList_DHP_strict;
+        typedef cc::SprayList< rcu_gpi, Value, traits_SprayList_strict > SprayList_RCU_gpi_strict;
+        typedef cc::SprayList< rcu_gpb, Value, traits_SprayList_strict > SprayList_RCU_gpb_strict;
+        typedef cc::SprayList< rcu_gpt, Value, traits_SprayList_strict > SprayList_RCU_gpt_strict;
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cc::SprayList< rcu_shb, Value, traits_SprayList_strict > SprayList_RCU_shb_strict;
+#endif
+
+        struct traits_SprayList_strict_stat: public traits_SprayList_strict
+        {
+            typedef cc::spray_list::stat<> stat;
+        };
+        typedef cc::SprayList< cds::gc::HP, Value, traits_SprayList_strict_stat > SprayList_HP_strict_stat;
+        typedef cc::SprayList< cds::gc::DHP, Value, traits_SprayList_strict_stat > SprayList_DHP_strict_stat;
+        typedef cc::SprayList< rcu_gpb, Value, traits_SprayList_strict_stat > SprayList_RCU_gpb_strict_stat;
+
+        struct traits_SprayList_relaxed: public
+            cc::spray_list::make_traits<
+                cc::spray_list::relaxed< true >
+            >::type
+        {};
+        typedef cc::SprayList< cds::gc::HP, Value, traits_SprayList_relaxed > SprayList_HP_relaxed;
+        typedef cc::SprayList< cds::gc::DHP, Value, traits_SprayList_relaxed > SprayList_DHP_relaxed;
+        typedef cc::SprayList< rcu_gpi, Value, traits_SprayList_relaxed > SprayList_RCU_gpi_relaxed;
+        typedef cc::SprayList< rcu_gpb, Value, traits_SprayList_relaxed > SprayList_RCU_gpb_relaxed;
+        typedef cc::SprayList< rcu_gpt, Value, traits_SprayList_relaxed > SprayList_RCU_gpt_relaxed;
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cc::SprayList< rcu_shb, Value, traits_SprayList_relaxed > SprayList_RCU_shb_relaxed;
+#endif
+
+        struct traits_SprayList_relaxed_stat: public traits_SprayList_relaxed
+        {
+            typedef cc::spray_list::stat<> stat;
+        };
+        typedef cc::SprayList< cds::gc::HP, Value, traits_SprayList_relaxed_stat > SprayList_HP_relaxed_stat;
+        typedef cc::SprayList< cds::gc::DHP, Value, traits_SprayList_relaxed_stat > SprayList_DHP_relaxed_stat;
+        typedef cc::SprayList< rcu_gpb, Value, traits_SprayList_relaxed_stat > SprayList_RCU_gpb_relaxed_stat;
+
 
         // Priority queue based on EllenBinTreeSet
         struct traits_EllenBinTree_max :
@@ -712,7 +818,48 @@ namespace cds_test {
             << CDSSTRESS_STAT_OUT( s, m_nPopHeapifySwapCount )
             << CDSSTRESS_STAT_OUT( s, m_nItemMovedTop )
             << CDSSTRESS_STAT_OUT( s, m_nItemMovedUp )
-            << CDSSTRESS_STAT_OUT( s, m_nPushEmptyPass );
+            << CDSSTRESS_STAT_OUT( s, m_nPushEmptyPass )
+            << CDSSTRESS_STAT_OUT( s, m_nHeapGrowCount );
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::multi_queue::empty_stat const& /*s*/ )
+    {
+        return o;
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::multi_queue::stat<> const& s )
+    {
+        return o
+            << CDSSTRESS_STAT_OUT( s, m_nPush )
+            << CDSSTRESS_STAT_OUT( s, m_nPushCollision )
+            << CDSSTRESS_STAT_OUT( s, m_nPop )
+            << CDSSTRESS_STAT_OUT( s, m_nPopEmpty )
+            << CDSSTRESS_STAT_OUT( s, m_nPopCollision )
+            << CDSSTRESS_STAT_OUT( s, m_nPopTwoChoice )
+            << CDSSTRESS_STAT_OUT( s, m_nPopOneChoice )
+            << CDSSTRESS_STAT_OUT( s, m_nPopEmptyHeap )
+            << CDSSTRESS_STAT_OUT( s, m_nPopFullScan )
+            << CDSSTRESS_STAT_OUT( s, m_nRankSample )
+            << CDSSTRESS_STAT_OUT( s, m_nRankExact )
+            << CDSSTRESS_STAT_OUT( s, m_nRankErrorSum )
+            << CDSSTRESS_STAT_OUT_( property_stream::stat_prefix() + ".m_nMaxRankError", s.m_nMaxRankError.load( atomics::memory_order_relaxed ));
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::spray_list::empty_stat const& /*s*/ )
+    {
+        return o;
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::spray_list::stat<> const& s )
+    {
+        return o
+            << CDSSTRESS_STAT_OUT( s, m_nPush )
+            << CDSSTRESS_STAT_OUT( s, m_nPop )
+            << CDSSTRESS_STAT_OUT( s, m_nPopEmpty )
+            << CDSSTRESS_STAT_OUT( s, m_nSprayPop )
+            << CDSSTRESS_STAT_OUT( s, m_nSprayFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nPrefixUnlink )
+            << CDSSTRESS_STAT_OUT( s, m_nPrefixUnlinkNode );
     }
 
 } // namespace cds_test
@@ -147,8 +147,23 @@ namespace pqueue {
     CDSSTRESS_MSPriorityQueue( pqueue_push, MSPriorityQueue_dyn_less )
     CDSSTRESS_MSPriorityQueue( pqueue_push, MSPriorityQueue_dyn_less_stat )
     CDSSTRESS_MSPriorityQueue( pqueue_push, MSPriorityQueue_dyn_cmp )
+    CDSSTRESS_MSPriorityQueue( pqueue_push, MSPriorityQueue_dyn_4ary_less )
+    CDSSTRESS_MSPriorityQueue( pqueue_push, MSPriorityQueue_dyn_8ary_less )
     //CDSSTRESS_MSPriorityQueue( pqueue_push, MSPriorityQueue_dyn_mutex ) // too slow
 
+#define CDSSTRESS_MSPriorityQueue_growable( fixture_t, pqueue_t ) \
+    TEST_F( fixture_t, pqueue_t ) \
+    { \
+        typedef pqueue::Types<pqueue::simple_value>::pqueue_t pqueue_type; \
+        pqueue_type pq( 1024 ); /* the heap grows on demand */ \
+        test( pq ); \
+    }
+    CDSSTRESS_MSPriorityQueue_growable( pqueue_push, MSPriorityQueue_growable_less )
+    CDSSTRESS_MSPriorityQueue_growable( pqueue_push, MSPriorityQueue_growable_less_stat )
+    CDSSTRESS_MSPriorityQueue_growable( pqueue_push, MSPriorityQueue_growable_4ary_less )
+    CDSSTRESS_MSPriorityQueue_growable( pqueue_push, MSPriorityQueue_growable_8ary_less )
+    CDSSTRESS_MSPriorityQueue_growable( pqueue_push, MSPriorityQueue_growable_8ary_less_stat )
+
 #define CDSSTRESS_MSPriorityQueue_static( fixture_t, pqueue_t ) \
     TEST_F( fixture_t, pqueue_t ) \
     { \
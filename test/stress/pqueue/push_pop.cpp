@@ -10,6 +10,7 @@ namespace {
     static size_t s_nPushThreadCount = 4;
     static size_t s_nPopThreadCount = 4;
     static size_t s_nQueueSize = 2000000;
+    static size_t s_nMultiQueueFactor = 2;
 
     atomics::atomic<size_t>  s_nProducerCount(0);
 
@@ -179,6 +180,7 @@ namespace {
             s_nPushThreadCount = cfg.get_size_t( "PushThreadCount", s_nPushThreadCount );
             s_nPopThreadCount = cfg.get_size_t( "PopThreadCount", s_nPopThreadCount );
             s_nQueueSize = cfg.get_size_t( "QueueSize", s_nQueueSize );
+            s_nMultiQueueFactor = cfg.get_size_t( "MultiQueueFactor", s_nMultiQueueFactor );
 
             if ( s_nPushThreadCount == 0u )
                 s_nPushThreadCount = 1;
@@ -186,6 +188,8 @@ namespace {
                 s_nPopThreadCount = 1;
             if ( s_nQueueSize == 0u )
                 s_nQueueSize = 1000;
+            if ( s_nMultiQueueFactor == 0u )
+                s_nMultiQueueFactor = 1;
         }
 
         //static void TearDownTestCase();
@@ -201,8 +205,23 @@ namespace {
     CDSSTRESS_MSPriorityQueue( pqueue_push_pop, MSPriorityQueue_dyn_less )
     CDSSTRESS_MSPriorityQueue( pqueue_push_pop, MSPriorityQueue_dyn_less_stat )
     CDSSTRESS_MSPriorityQueue( pqueue_push_pop, MSPriorityQueue_dyn_cmp )
+    CDSSTRESS_MSPriorityQueue( pqueue_push_pop, MSPriorityQueue_dyn_4ary_less )
+    CDSSTRESS_MSPriorityQueue( pqueue_push_pop, MSPriorityQueue_dyn_8ary_less )
     //CDSSTRESS_MSPriorityQueue( pqueue_push_pop, MSPriorityQueue_dyn_mutex ) // too slow
 
+#define CDSSTRESS_MSPriorityQueue_growable( fixture_t, pqueue_t ) \
+    TEST_F( fixture_t, pqueue_t ) \
+    { \
+        typedef pqueue::Types<pqueue::simple_value>::pqueue_t pqueue_type; \
+        pqueue_type pq( 1024 ); /* the heap grows on demand */ \
+        test( pq ); \
+    }
+    CDSSTRESS_MSPriorityQueue_growable( pqueue_push_pop, MSPriorityQueue_growable_less )
+    CDSSTRESS_MSPriorityQueue_growable( pqueue_push_pop, MSPriorityQueue_growable_less_stat )
+    CDSSTRESS_MSPriorityQueue_growable( pqueue_push_pop, MSPriorityQueue_growable_4ary_less )
+    CDSSTRESS_MSPriorityQueue_growable( pqueue_push_pop, MSPriorityQueue_growable_8ary_less )
+    CDSSTRESS_MSPriorityQueue_growable( pqueue_push_pop, MSPriorityQueue_growable_8ary_less_stat )
+
 #define CDSSTRESS_MSPriorityQueue_static( fixture_t, pqueue_t ) \
     TEST_F( fixture_t, pqueue_t ) \
     { \
@@ -215,6 +234,45 @@ namespace {
     //CDSSTRESS_MSPriorityQueue( pqueue_push_pop, MSPriorityQueue_static_cmp )
     //CDSSTRESS_MSPriorityQueue( pqueue_push_pop, MSPriorityQueue_static_mutex )
 
+#define CDSSTRESS_MultiQueue( fixture_t, pqueue_t ) \
+    TEST_F( fixture_t, pqueue_t ) \
+    { \
+        typedef pqueue::Types<pqueue::simple_value>::pqueue_t pqueue_type; \
+        pqueue_type pq( s_nMultiQueueFactor * ( s_nPushThreadCount + s_nPopThreadCount )); \
+        test( pq ); \
+    }
+    CDSSTRESS_MultiQueue( pqueue_push_pop, MultiQueue_spin )
+    CDSSTRESS_MultiQueue( pqueue_push_pop, MultiQueue_spin_stat )
+    CDSSTRESS_MultiQueue( pqueue_push_pop, MultiQueue_mutex )
+
+#define CDSSTRESS_SprayList( fixture_t, pqueue_t ) \
+    TEST_F( fixture_t, pqueue_t ) \
+    { \
+        typedef pqueue::Types<pqueue::simple_value>::pqueue_t pqueue_type; \
+        pqueue_type pq( static_cast<unsigned>( s_nPushThreadCount + s_nPopThreadCount )); \
+        test( pq ); \
+    }
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_HP_strict )
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_HP_strict_stat )
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_HP_relaxed )
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_HP_relaxed_stat )
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_DHP_strict )
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_DHP_strict_stat )
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_DHP_relaxed )
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_DHP_relaxed_stat )
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_RCU_gpi_strict )
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_RCU_gpi_relaxed )
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_RCU_gpb_strict )
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_RCU_gpb_strict_stat )
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_RCU_gpb_relaxed )
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_RCU_gpb_relaxed_stat )
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_RCU_gpt_strict )
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_RCU_gpt_relaxed )
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_RCU_shb_strict )
+    CDSSTRESS_SprayList( pqueue_push_pop, SprayList_RCU_shb_relaxed )
+#endif
+
 
 #define CDSSTRESS_PriorityQueue( fixture_t, pqueue_t ) \
     TEST_F( fixture_t, pqueue_t ) \
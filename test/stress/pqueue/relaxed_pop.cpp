@@ -0,0 +1,224 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "pqueue_type.h"
+#include "item.h"
+
+// Pop test for relaxed priority queues
+// The test measures rank error of popped items: the number of items with higher priority
+// than the item popped that are in the queue at the moment of pop
+namespace {
+    static size_t s_nThreadCount = 8;
+    static size_t s_nQueueSize = 2000000;
+    static size_t s_nMultiQueueFactor = 2;
+
+    static atomics::atomic<size_t> s_nPopTicket( 0 );
+
+    class pqueue_relaxed_pop: public cds_test::stress_fixture
+    {
+        typedef cds_test::stress_fixture base_class;
+
+    protected:
+        template <class PQueue>
+        class Consumer: public cds_test::thread
+        {
+            typedef cds_test::thread base_class;
+
+        public:
+            Consumer( cds_test::thread_pool& pool, PQueue& queue, std::vector<size_t>& order )
+                : base_class( pool )
+                , m_Queue( queue )
+                , m_arrOrder( order )
+            {}
+
+            Consumer( Consumer& src )
+                : base_class( src )
+                , m_Queue( src.m_Queue )
+                , m_arrOrder( src.m_arrOrder )
+            {}
+
+            virtual thread * clone()
+            {
+                return new Consumer( *this );
+            }
+
+            virtual void test()
+            {
+                typename PQueue::value_type val;
+                while ( m_Queue.pop( val )) {
+                    // the ticket defines the global order of pops
+                    size_t nTicket = s_nPopTicket.fetch_add( 1, atomics::memory_order_relaxed );
+                    if ( nTicket < m_arrOrder.size())
+                        m_arrOrder[nTicket] = val.key;
+                    ++m_nPopSuccess;
+                }
+            }
+
+        public:
+            PQueue&                 m_Queue;
+            std::vector<size_t>&    m_arrOrder;
+            size_t                  m_nPopSuccess = 0;
+        };
+
+        // Fenwick tree to count popped keys
+        class popped_counter
+        {
+            std::vector<size_t> m_arr;
+
+        public:
+            explicit popped_counter( size_t nSize )
+                : m_arr( nSize + 1, 0 )
+            {}
+
+            void add( size_t nKey )
+            {
+                for ( size_t i = nKey + 1; i < m_arr.size(); i += i & ( 0 - i ))
+                    ++m_arr[i];
+            }
+
+            // count of popped keys less than nKey
+            size_t less( size_t nKey ) const
+            {
+                size_t nCount = 0;
+                for ( size_t i = nKey; i > 0; i -= i & ( 0 - i ))
+                    nCount += m_arr[i];
+                return nCount;
+            }
+        };
+
+    protected:
+        template <class PQueue>
+        void test( PQueue& q )
+        {
+            cds_test::thread_pool& pool = get_pool();
+
+            // push
+            {
+                std::vector< size_t > arr;
+                arr.reserve( s_nQueueSize );
+                for ( size_t i = 0; i < s_nQueueSize; ++i )
+                    arr.push_back( i );
+                shuffle( arr.begin(), arr.end());
+
+                typedef typename PQueue::value_type value_type;
+                for ( auto it = arr.begin(); it != arr.end(); ++it )
+                    ASSERT_TRUE( q.push( value_type( *it )));
+            }
+
+            propout() << std::make_pair( "thread_count", s_nThreadCount )
+                << std::make_pair( "push_count", s_nQueueSize );
+
+            // pop
+            std::vector<size_t> arrOrder( s_nQueueSize, s_nQueueSize );
+            s_nPopTicket.store( 0, atomics::memory_order_release );
+
+            pool.add( new Consumer<PQueue>( pool, q, arrOrder ), s_nThreadCount );
+            std::chrono::milliseconds duration = pool.run();
+            propout() << std::make_pair( "consumer_duration", duration );
+
+            size_t nTotalPopped = 0;
+            for ( size_t i = 0; i < pool.size(); ++i )
+                nTotalPopped += static_cast<Consumer<PQueue>&>( pool.get( i )).m_nPopSuccess;
+            EXPECT_EQ( nTotalPopped, s_nQueueSize );
+
+            // Analyze: each key is popped once, compute rank error in the order of pop tickets
+            popped_counter popped( s_nQueueSize );
+            std::vector<bool> arrPopped( s_nQueueSize, false );
+            size_t nDoubleKey = 0;
+            size_t nRankErrorMax = 0;
+            double fRankErrorSum = 0;
+            size_t nExact = 0;
+
+            for ( size_t nTicket = 0; nTicket < s_nQueueSize; ++nTicket ) {
+                size_t const nKey = arrOrder[nTicket];
+                ASSERT_LT( nKey, s_nQueueSize ) << "ticket " << nTicket;
+                if ( arrPopped[nKey] ) {
+                    ++nDoubleKey;
+                    continue;
+                }
+                arrPopped[nKey] = true;
+
+                // The queue pops max key first: rank error is the number of keys greater than nKey not popped yet
+                size_t const nPoppedGreater = nTicket - nDoubleKey - popped.less( nKey );
+                size_t const nRankError = s_nQueueSize - 1 - nKey - nPoppedGreater;
+                popped.add( nKey );
+
+                fRankErrorSum += static_cast<double>( nRankError );
+                if ( nRankError > nRankErrorMax )
+                    nRankErrorMax = nRankError;
+                if ( nRankError == 0 )
+                    ++nExact;
+            }
+
+            propout()
+                << std::make_pair( "total_popped", nTotalPopped )
+                << std::make_pair( "error_pop_double", nDoubleKey )
+                << std::make_pair( "rank_error_avg", static_cast<size_t>( fRankErrorSum / s_nQueueSize + 0.5 ))
+                << std::make_pair( "rank_error_max", nRankErrorMax )
+                << std::make_pair( "exact_pop", nExact );
+
+            EXPECT_EQ( nDoubleKey, 0u ) << "double key";
+            EXPECT_TRUE( q.empty());
+
+            propout() << q.statistics();
+        }
+
+    public:
+        static void SetUpTestCase()
+        {
+            cds_test::config const& cfg = get_config( "pqueue_pop" );
+
+            s_nThreadCount = cfg.get_size_t( "ThreadCount", s_nThreadCount );
+            s_nQueueSize = cfg.get_size_t( "QueueSize", s_nQueueSize );
+            s_nMultiQueueFactor = cfg.get_size_t( "MultiQueueFactor", s_nMultiQueueFactor );
+
+            if ( s_nThreadCount == 0u )
+                s_nThreadCount = 1;
+            if ( s_nQueueSize == 0u )
+                s_nQueueSize = 1000;
+            if ( s_nMultiQueueFactor == 0u )
+                s_nMultiQueueFactor = 1;
+        }
+    };
+
+    // Strict priority queues: the rank error is caused by the pop-ticket race only
+    TEST_F( pqueue_relaxed_pop, MSPriorityQueue_dyn_less )
+    {
+        typedef pqueue::Types<pqueue::simple_value>::MSPriorityQueue_dyn_less pqueue_type;
+        pqueue_type pq( s_nQueueSize + 1 );
+        test( pq );
+    }
+
+    TEST_F( pqueue_relaxed_pop, FCPQueue_vector )
+    {
+        typedef pqueue::Types<pqueue::simple_value>::FCPQueue_vector pqueue_type;
+        pqueue_type pq;
+        test( pq );
+    }
+
+#define CDSSTRESS_MultiQueue( fixture_t, pqueue_t ) \
+    TEST_F( fixture_t, pqueue_t ) \
+    { \
+        typedef pqueue::Types<pqueue::simple_value>::pqueue_t pqueue_type; \
+        pqueue_type pq( s_nMultiQueueFactor * s_nThreadCount ); \
+        test( pq ); \
+    }
+    CDSSTRESS_MultiQueue( pqueue_relaxed_pop, MultiQueue_spin )
+    CDSSTRESS_MultiQueue( pqueue_relaxed_pop, MultiQueue_spin_stat )
+    CDSSTRESS_MultiQueue( pqueue_relaxed_pop, MultiQueue_mutex )
+
+#define CDSSTRESS_SprayList( fixture_t, pqueue_t ) \
+    TEST_F( fixture_t, pqueue_t ) \
+    { \
+        typedef pqueue::Types<pqueue::simple_value>::pqueue_t pqueue_type; \
+        pqueue_type pq( static_cast<unsigned>( s_nThreadCount )); \
+        test( pq ); \
+    }
+    CDSSTRESS_SprayList( pqueue_relaxed_pop, SprayList_HP_strict_stat )
+    CDSSTRESS_SprayList( pqueue_relaxed_pop, SprayList_HP_relaxed_stat )
+    CDSSTRESS_SprayList( pqueue_relaxed_pop, SprayList_DHP_relaxed_stat )
+    CDSSTRESS_SprayList( pqueue_relaxed_pop, SprayList_RCU_gpb_relaxed_stat )
+
+} // namespace
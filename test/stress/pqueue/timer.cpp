@@ -0,0 +1,347 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cds_test/stress_test.h>
+#include <cds_test/stat_flat_combining_out.h>
+#include <cds/intrusive/fcpriority_queue.h>
+#include <vector>
+
+// Timer-like workload for addressable priority queue:
+// the timer threads arm, cancel and reschedule their own timers,
+// the expiry threads pop the timer with the earliest deadline
+namespace {
+    static size_t s_nTimerThreadCount = 4;
+    static size_t s_nExpiryThreadCount = 2;
+    static size_t s_nTimerPerThread = 1000;
+    static size_t s_nPassCount = 1000;
+
+    static atomics::atomic<size_t> s_nTimerThreadDone( 0 );
+
+    enum timer_state {
+        idle,
+        armed,
+        fired
+    };
+
+    struct timer: public cds::intrusive::fcpqueue::node
+    {
+        uint64_t            nDeadline;
+        atomics::atomic<int> nState;
+
+        timer()
+            : nDeadline( 0 )
+            , nState( idle )
+        {}
+    };
+
+    // the earliest deadline has the highest priority
+    struct earliest_first
+    {
+        bool operator()( timer const& t1, timer const& t2 ) const
+        {
+            return t2.nDeadline < t1.nDeadline;
+        }
+    };
+
+    class pqueue_timer: public cds_test::stress_fixture
+    {
+        typedef cds_test::stress_fixture base_class;
+
+        enum {
+            timer_thread,
+            expiry_thread
+        };
+
+    protected:
+        template <class PQueue>
+        class TimerThread: public cds_test::thread
+        {
+            typedef cds_test::thread base_class;
+
+        public:
+            TimerThread( cds_test::thread_pool& pool, PQueue& queue )
+                : base_class( pool, timer_thread )
+                , m_Queue( queue )
+                , m_arrTimer( s_nTimerPerThread )
+            {}
+
+            TimerThread( TimerThread& src )
+                : base_class( src )
+                , m_Queue( src.m_Queue )
+                , m_arrTimer( s_nTimerPerThread )
+            {}
+
+            virtual thread * clone()
+            {
+                return new TimerThread( *this );
+            }
+
+            virtual void test()
+            {
+                uint32_t nRand = static_cast<uint32_t>( reinterpret_cast<uintptr_t>( this )) | 1;
+                uint64_t nNow = 0;
+
+                size_t const nOpCount = s_nPassCount * m_arrTimer.size();
+                for ( size_t nOp = 0; nOp < nOpCount; ++nOp ) {
+                    nRand ^= nRand << 13;
+                    nRand ^= nRand >> 17;
+                    nRand ^= nRand << 5;
+
+                    timer& t = m_arrTimer[nRand % m_arrTimer.size()];
+                    uint64_t const nTimeout = ( nRand >> 16 ) % 1000 + 1;
+                    ++nNow;
+
+                    if ( t.nState.load( atomics::memory_order_acquire ) != armed ) {
+                        // arm the timer
+                        t.nDeadline = nNow + nTimeout;
+                        t.nState.store( armed, atomics::memory_order_release );
+                        m_Queue.push( t );
+                        ++m_nArm;
+                    }
+                    else if ( nRand & 0x100 ) {
+                        // cancel the timer
+                        if ( m_Queue.erase( t )) {
+                            t.nState.store( idle, atomics::memory_order_release );
+                            ++m_nCancel;
+                        }
+                        else
+                            ++m_nCancelFailed;
+                    }
+                    else {
+                        // reschedule the timer
+                        uint64_t const nDeadline = nNow + nTimeout;
+                        if ( m_Queue.update( t, [nDeadline]( timer& tm ) { tm.nDeadline = nDeadline; } ))
+                            ++m_nReschedule;
+                        else
+                            ++m_nRescheduleFailed;
+                    }
+                }
+
+                s_nTimerThreadDone.fetch_add( 1, atomics::memory_order_release );
+            }
+
+        public:
+            PQueue&             m_Queue;
+            std::vector<timer>  m_arrTimer;
+
+            size_t  m_nArm = 0;
+            size_t  m_nCancel = 0;
+            size_t  m_nCancelFailed = 0;
+            size_t  m_nReschedule = 0;
+            size_t  m_nRescheduleFailed = 0;
+        };
+
+        template <class PQueue>
+        class ExpiryThread: public cds_test::thread
+        {
+            typedef cds_test::thread base_class;
+
+        public:
+            ExpiryThread( cds_test::thread_pool& pool, PQueue& queue )
+                : base_class( pool, expiry_thread )
+                , m_Queue( queue )
+            {}
+
+            ExpiryThread( ExpiryThread& src )
+                : base_class( src )
+                , m_Queue( src.m_Queue )
+            {}
+
+            virtual thread * clone()
+            {
+                return new ExpiryThread( *this );
+            }
+
+            virtual void test()
+            {
+                while ( s_nTimerThreadDone.load( atomics::memory_order_acquire ) < s_nTimerThreadCount ) {
+                    timer * p = m_Queue.pop();
+                    if ( p ) {
+                        int nExpected = armed;
+                        if ( p->nState.compare_exchange_strong( nExpected, fired, atomics::memory_order_acq_rel, atomics::memory_order_relaxed ))
+                            ++m_nFired;
+                        else
+                            ++m_nError;
+                    }
+                    else {
+                        ++m_nEmpty;
+                        cds::backoff::yield()();
+                    }
+                }
+            }
+
+        public:
+            PQueue& m_Queue;
+
+            size_t  m_nFired = 0;
+            size_t  m_nEmpty = 0;
+            size_t  m_nError = 0;
+        };
+
+    protected:
+        template <class PQueue>
+        void test( PQueue& q )
+        {
+            cds_test::thread_pool& pool = get_pool();
+
+            s_nTimerThreadDone.store( 0, atomics::memory_order_release );
+            pool.add( new TimerThread<PQueue>( pool, q ), s_nTimerThreadCount );
+            pool.add( new ExpiryThread<PQueue>( pool, q ), s_nExpiryThreadCount );
+
+            propout() << std::make_pair( "timer_thread_count", s_nTimerThreadCount )
+                << std::make_pair( "expiry_thread_count", s_nExpiryThreadCount )
+                << std::make_pair( "timer_per_thread", s_nTimerPerThread )
+                << std::make_pair( "pass_count", s_nPassCount );
+
+            std::chrono::milliseconds duration = pool.run();
+            propout() << std::make_pair( "duration", duration );
+
+            size_t nArm = 0;
+            size_t nCancel = 0;
+            size_t nCancelFailed = 0;
+            size_t nReschedule = 0;
+            size_t nRescheduleFailed = 0;
+            size_t nFired = 0;
+            size_t nEmpty = 0;
+            size_t nError = 0;
+
+            for ( size_t i = 0; i < pool.size(); ++i ) {
+                cds_test::thread& t = pool.get( i );
+                if ( t.type() == timer_thread ) {
+                    TimerThread<PQueue>& thr = static_cast<TimerThread<PQueue>&>( t );
+                    nArm += thr.m_nArm;
+                    nCancel += thr.m_nCancel;
+                    nCancelFailed += thr.m_nCancelFailed;
+                    nReschedule += thr.m_nReschedule;
+                    nRescheduleFailed += thr.m_nRescheduleFailed;
+                }
+                else {
+                    assert( t.type() == expiry_thread );
+                    ExpiryThread<PQueue>& thr = static_cast<ExpiryThread<PQueue>&>( t );
+                    nFired += thr.m_nFired;
+                    nEmpty += thr.m_nEmpty;
+                    nError += thr.m_nError;
+                }
+            }
+
+            // Drain the queue: the timers are popped in order of deadline
+            size_t nDrained = 0;
+            uint64_t nPrevDeadline = 0;
+            while ( timer * p = q.pop()) {
+                EXPECT_GE( p->nDeadline, nPrevDeadline );
+                nPrevDeadline = p->nDeadline;
+
+                int nExpected = armed;
+                if ( p->nState.compare_exchange_strong( nExpected, fired, atomics::memory_order_relaxed ))
+                    ++nDrained;
+                else
+                    ++nError;
+            }
+
+            size_t const nOpCount = s_nTimerThreadCount * s_nTimerPerThread * s_nPassCount;
+            propout() << std::make_pair( "arm_count", nArm )
+                << std::make_pair( "cancel_count", nCancel )
+                << std::make_pair( "cancel_failed", nCancelFailed )
+                << std::make_pair( "reschedule_count", nReschedule )
+                << std::make_pair( "reschedule_failed", nRescheduleFailed )
+                << std::make_pair( "fired_count", nFired )
+                << std::make_pair( "empty_pop", nEmpty )
+                << std::make_pair( "drained_count", nDrained )
+                << std::make_pair( "timer_ops_per_sec", duration.count() ? nOpCount * 1000 / static_cast<size_t>( duration.count()) : nOpCount );
+
+            EXPECT_EQ( nError, 0u );
+            EXPECT_EQ( nArm, nCancel + nFired + nDrained );
+            EXPECT_EQ( nArm + nCancel + nCancelFailed + nReschedule + nRescheduleFailed, nOpCount );
+
+            propout() << q.statistics();
+        }
+
+    public:
+        static void SetUpTestCase()
+        {
+            cds_test::config const& cfg = get_config( "pqueue_timer" );
+
+            s_nTimerThreadCount = cfg.get_size_t( "TimerThreadCount", s_nTimerThreadCount );
+            s_nExpiryThreadCount = cfg.get_size_t( "ExpiryThreadCount", s_nExpiryThreadCount );
+            s_nTimerPerThread = cfg.get_size_t( "TimerPerThread", s_nTimerPerThread );
+            s_nPassCount = cfg.get_size_t( "PassCount", s_nPassCount );
+
+            if ( s_nTimerThreadCount == 0u )
+                s_nTimerThreadCount = 1;
+            if ( s_nExpiryThreadCount == 0u )
+                s_nExpiryThreadCount = 1;
+            if ( s_nTimerPerThread == 0u )
+                s_nTimerPerThread = 100;
+            if ( s_nPassCount == 0u )
+                s_nPassCount = 1;
+        }
+    };
+
+    namespace ci = cds::intrusive;
+
+    typedef ci::FCPriorityQueue< timer,
+        ci::fcpqueue::make_traits<
+            cds::opt::less< earliest_first >
+        >::type
+    > FCPQueue_timer;
+
+    typedef ci::FCPriorityQueue< timer,
+        ci::fcpqueue::make_traits<
+            cds::opt::less< earliest_first >
+            ,cds::opt::stat< ci::fcpqueue::stat<> >
+        >::type
+    > FCPQueue_timer_stat;
+
+    typedef ci::FCPriorityQueue< timer,
+        ci::fcpqueue::make_traits<
+            cds::opt::less< earliest_first >
+            ,cds::opt::lock_type< std::mutex >
+            ,cds::opt::stat< ci::fcpqueue::stat<> >
+        >::type
+    > FCPQueue_timer_mutex_stat;
+
+    typedef ci::FCPriorityQueue< timer,
+        ci::fcpqueue::make_traits<
+            cds::opt::less< earliest_first >
+            ,cds::opt::wait_strategy< cds::algo::flat_combining::wait_strategy::multi_mutex_multi_condvar<> >
+            ,cds::opt::stat< ci::fcpqueue::stat<> >
+        >::type
+    > FCPQueue_timer_condvar_stat;
+
+#define CDSSTRESS_AddressablePQueue( fixture_t, pqueue_t ) \
+    TEST_F( fixture_t, pqueue_t ) \
+    { \
+        pqueue_t pq; \
+        test( pq ); \
+    }
+
+    CDSSTRESS_AddressablePQueue( pqueue_timer, FCPQueue_timer )
+    CDSSTRESS_AddressablePQueue( pqueue_timer, FCPQueue_timer_stat )
+    CDSSTRESS_AddressablePQueue( pqueue_timer, FCPQueue_timer_mutex_stat )
+    CDSSTRESS_AddressablePQueue( pqueue_timer, FCPQueue_timer_condvar_stat )
+
+} // namespace
+
+namespace cds_test {
+
+    static inline property_stream& operator <<( property_stream& o, cds::intrusive::fcpqueue::empty_stat const& )
+    {
+        return o;
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::intrusive::fcpqueue::stat<> const& s )
+    {
+        return o
+            << CDSSTRESS_STAT_OUT( s, m_nPush )
+            << CDSSTRESS_STAT_OUT( s, m_nPop )
+            << CDSSTRESS_STAT_OUT( s, m_nFailedPop )
+            << CDSSTRESS_STAT_OUT( s, m_nErase )
+            << CDSSTRESS_STAT_OUT( s, m_nFailedErase )
+            << CDSSTRESS_STAT_OUT( s, m_nUpdate )
+            << CDSSTRESS_STAT_OUT( s, m_nFailedUpdate )
+            << static_cast<cds::algo::flat_combining::stat<> const&>( s );
+    }
+
+} // namespace cds_test
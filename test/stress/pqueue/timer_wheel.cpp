@@ -0,0 +1,310 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cds_test/stress_test.h>
+#include <cds/gc/hp.h>
+#include <cds/gc/dhp.h>
+#include <cds/intrusive/timer_wheel.h>
+#include <vector>
+
+// Timer wheel stress test:
+// the timer threads arm and cancel their own timers, the advance threads turn the wheel
+namespace {
+    static size_t s_nTimerThreadCount = 4;
+    static size_t s_nAdvanceThreadCount = 1;
+    static size_t s_nTimerPerThread = 10000;
+    static size_t s_nPassCount = 100;
+    static size_t s_nMaxTimeout = 5000;
+
+    static atomics::atomic<size_t> s_nTimerThreadDone( 0 );
+
+    class timer_wheel: public cds_test::stress_fixture
+    {
+        typedef cds_test::stress_fixture base_class;
+
+        enum {
+            timer_thread,
+            advance_thread
+        };
+
+    public:
+        template <class GC>
+        struct timer: public cds::intrusive::timer_wheel::node< GC >
+        {};
+
+    protected:
+        template <class Wheel>
+        class TimerThread: public cds_test::thread
+        {
+            typedef cds_test::thread base_class;
+            typedef typename Wheel::value_type timer_type;
+
+        public:
+            TimerThread( cds_test::thread_pool& pool, Wheel& wheel )
+                : base_class( pool, timer_thread )
+                , m_Wheel( wheel )
+                , m_arrTimer( s_nTimerPerThread )
+            {}
+
+            TimerThread( TimerThread& src )
+                : base_class( src )
+                , m_Wheel( src.m_Wheel )
+                , m_arrTimer( s_nTimerPerThread )
+            {}
+
+            virtual thread * clone()
+            {
+                return new TimerThread( *this );
+            }
+
+            virtual void test()
+            {
+                uint32_t nRand = static_cast<uint32_t>( reinterpret_cast<uintptr_t>( this )) | 1;
+
+                size_t const nOpCount = s_nPassCount * m_arrTimer.size();
+                for ( size_t nOp = 0; nOp < nOpCount; ++nOp ) {
+                    nRand ^= nRand << 13;
+                    nRand ^= nRand >> 17;
+                    nRand ^= nRand << 5;
+
+                    timer_type& t = m_arrTimer[nRand % m_arrTimer.size()];
+                    if ( !t.is_armed()) {
+                        if ( m_Wheel.arm( t, m_Wheel.now() + 1 + ( nRand >> 8 ) % s_nMaxTimeout ))
+                            ++m_nArm;
+                        else
+                            ++m_nError;
+                    }
+                    else if ( m_Wheel.cancel( t ))
+                        ++m_nCancel;
+                    else
+                        ++m_nCancelFailed;
+                }
+
+                s_nTimerThreadDone.fetch_add( 1, atomics::memory_order_release );
+            }
+
+        public:
+            Wheel&                  m_Wheel;
+            std::vector<timer_type> m_arrTimer;
+
+            size_t  m_nArm = 0;
+            size_t  m_nCancel = 0;
+            size_t  m_nCancelFailed = 0;
+            size_t  m_nError = 0;
+        };
+
+        template <class Wheel>
+        class AdvanceThread: public cds_test::thread
+        {
+            typedef cds_test::thread base_class;
+
+        public:
+            AdvanceThread( cds_test::thread_pool& pool, Wheel& wheel )
+                : base_class( pool, advance_thread )
+                , m_Wheel( wheel )
+            {}
+
+            AdvanceThread( AdvanceThread& src )
+                : base_class( src )
+                , m_Wheel( src.m_Wheel )
+            {}
+
+            virtual thread * clone()
+            {
+                return new AdvanceThread( *this );
+            }
+
+            virtual void test()
+            {
+                while ( s_nTimerThreadDone.load( atomics::memory_order_acquire ) < s_nTimerThreadCount ) {
+                    m_nFired += m_Wheel.advance( m_Wheel.now() + 1 );
+                    ++m_nAdvance;
+                }
+            }
+
+        public:
+            Wheel&  m_Wheel;
+
+            size_t  m_nFired = 0;
+            size_t  m_nAdvance = 0;
+        };
+
+    protected:
+        template <class Wheel>
+        void test()
+        {
+            Wheel wheel;
+            cds_test::thread_pool& pool = get_pool();
+
+            s_nTimerThreadDone.store( 0, atomics::memory_order_release );
+            pool.add( new TimerThread<Wheel>( pool, wheel ), s_nTimerThreadCount );
+            pool.add( new AdvanceThread<Wheel>( pool, wheel ), s_nAdvanceThreadCount );
+
+            propout() << std::make_pair( "timer_thread_count", s_nTimerThreadCount )
+                << std::make_pair( "advance_thread_count", s_nAdvanceThreadCount )
+                << std::make_pair( "timer_per_thread", s_nTimerPerThread )
+                << std::make_pair( "pass_count", s_nPassCount )
+                << std::make_pair( "max_timeout", s_nMaxTimeout );
+
+            std::chrono::milliseconds duration = pool.run();
+            propout() << std::make_pair( "duration", duration );
+
+            size_t nArm = 0;
+            size_t nCancel = 0;
+            size_t nCancelFailed = 0;
+            size_t nError = 0;
+            size_t nFired = 0;
+            size_t nAdvance = 0;
+
+            for ( size_t i = 0; i < pool.size(); ++i ) {
+                cds_test::thread& t = pool.get( i );
+                if ( t.type() == timer_thread ) {
+                    TimerThread<Wheel>& thr = static_cast<TimerThread<Wheel>&>( t );
+                    nArm += thr.m_nArm;
+                    nCancel += thr.m_nCancel;
+                    nCancelFailed += thr.m_nCancelFailed;
+                    nError += thr.m_nError;
+                }
+                else {
+                    assert( t.type() == advance_thread );
+                    AdvanceThread<Wheel>& thr = static_cast<AdvanceThread<Wheel>&>( t );
+                    nFired += thr.m_nFired;
+                    nAdvance += thr.m_nAdvance;
+                }
+            }
+
+            // Fire the rest of the timers
+            size_t const nDrained = wheel.advance( wheel.now() + s_nMaxTimeout + 1 );
+            EXPECT_TRUE( wheel.empty());
+
+            for ( size_t i = 0; i < pool.size(); ++i ) {
+                cds_test::thread& t = pool.get( i );
+                if ( t.type() == timer_thread ) {
+                    for ( auto const& tm : static_cast<TimerThread<Wheel>&>( t ).m_arrTimer )
+                        EXPECT_FALSE( tm.is_armed());
+                }
+            }
+
+            size_t const nOpCount = s_nTimerThreadCount * s_nTimerPerThread * s_nPassCount;
+            propout() << std::make_pair( "arm_count", nArm )
+                << std::make_pair( "cancel_count", nCancel )
+                << std::make_pair( "cancel_failed", nCancelFailed )
+                << std::make_pair( "fired_count", nFired )
+                << std::make_pair( "drained_count", nDrained )
+                << std::make_pair( "advance_count", nAdvance )
+                << std::make_pair( "final_tick", wheel.now())
+                << std::make_pair( "timer_ops_per_sec", duration.count() ? nOpCount * 1000 / static_cast<size_t>( duration.count()) : nOpCount );
+
+            EXPECT_EQ( nError, 0u );
+            EXPECT_EQ( nArm, nCancel + nFired + nDrained );
+            EXPECT_EQ( nArm + nCancel + nCancelFailed, nOpCount );
+
+            propout() << wheel.statistics();
+
+            // The timers are owned by the threads
+            wheel.clear();
+            pool.clear();
+            Wheel::gc::force_dispose();
+        }
+
+    public:
+        static void SetUpTestCase()
+        {
+            cds_test::config const& cfg = get_config( "timer_wheel" );
+
+            s_nTimerThreadCount = cfg.get_size_t( "TimerThreadCount", s_nTimerThreadCount );
+            s_nAdvanceThreadCount = cfg.get_size_t( "AdvanceThreadCount", s_nAdvanceThreadCount );
+            s_nTimerPerThread = cfg.get_size_t( "TimerPerThread", s_nTimerPerThread );
+            s_nPassCount = cfg.get_size_t( "PassCount", s_nPassCount );
+            s_nMaxTimeout = cfg.get_size_t( "MaxTimeout", s_nMaxTimeout );
+
+            if ( s_nTimerThreadCount == 0u )
+                s_nTimerThreadCount = 1;
+            if ( s_nAdvanceThreadCount == 0u )
+                s_nAdvanceThreadCount = 1;
+            if ( s_nTimerPerThread == 0u )
+                s_nTimerPerThread = 1000;
+            if ( s_nPassCount == 0u )
+                s_nPassCount = 1;
+            if ( s_nMaxTimeout == 0u )
+                s_nMaxTimeout = 1000;
+        }
+    };
+
+    namespace ci = cds::intrusive;
+
+    template <class GC>
+    struct timer_wheel_traits: public ci::timer_wheel::traits
+    {
+        typedef ci::timer_wheel::base_hook< ci::opt::gc< GC >> hook;
+        typedef cds::atomicity::item_counter item_counter;
+    };
+
+    template <class GC>
+    struct timer_wheel_traits_stat: public timer_wheel_traits<GC>
+    {
+        typedef ci::timer_wheel::stat<> stat;
+    };
+
+    template <class GC>
+    struct timer_wheel_traits_small: public timer_wheel_traits<GC>
+    {
+        static constexpr const unsigned slot_bits = 4;
+        static constexpr const unsigned level_count = 3;
+    };
+
+    template <class GC>
+    struct timer_wheel_traits_small_stat: public timer_wheel_traits_small<GC>
+    {
+        typedef ci::timer_wheel::stat<> stat;
+    };
+
+    template <class GC>
+    struct timer_wheel_traits_mutex_stat: public timer_wheel_traits_stat<GC>
+    {
+        typedef std::mutex lock_type;
+    };
+
+#define CDSSTRESS_TimerWheel( gc_name, GC, traits_name ) \
+    typedef ci::TimerWheel< GC, timer_wheel::timer< GC >, timer_wheel_traits##traits_name< GC >> TimerWheel_##gc_name##traits_name; \
+    TEST_F( timer_wheel, TimerWheel_##gc_name##traits_name ) \
+    { \
+        test< TimerWheel_##gc_name##traits_name >(); \
+    }
+
+    CDSSTRESS_TimerWheel( HP, cds::gc::HP, )
+    CDSSTRESS_TimerWheel( HP, cds::gc::HP, _stat )
+    CDSSTRESS_TimerWheel( HP, cds::gc::HP, _small_stat )
+    CDSSTRESS_TimerWheel( HP, cds::gc::HP, _mutex_stat )
+    CDSSTRESS_TimerWheel( DHP, cds::gc::DHP, )
+    CDSSTRESS_TimerWheel( DHP, cds::gc::DHP, _stat )
+    CDSSTRESS_TimerWheel( DHP, cds::gc::DHP, _small_stat )
+
+} // namespace
+
+namespace cds_test {
+
+    static inline property_stream& operator <<( property_stream& o, cds::intrusive::timer_wheel::empty_stat const& )
+    {
+        return o;
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::intrusive::timer_wheel::stat<> const& s )
+    {
+        return o
+            << CDSSTRESS_STAT_OUT( s, m_nArm )
+            << CDSSTRESS_STAT_OUT( s, m_nArmFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nCancel )
+            << CDSSTRESS_STAT_OUT( s, m_nCancelFailed )
+            << CDSSTRESS_STAT_OUT( s, m_nFire )
+            << CDSSTRESS_STAT_OUT( s, m_nTick )
+            << CDSSTRESS_STAT_OUT( s, m_nCascade )
+            << CDSSTRESS_STAT_OUT( s, m_nOverdue )
+            << CDSSTRESS_STAT_OUT( s, m_nRescue )
+            << CDSSTRESS_STAT_OUT( s, m_nReclaim )
+            << CDSSTRESS_STAT_OUT( s, m_nAdvanceContended );
+    }
+
+} // namespace cds_test
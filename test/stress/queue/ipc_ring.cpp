@@ -0,0 +1,319 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cds_test/stress_test.h>
+
+#include <cds/container/weak_ringbuffer.h>
+#include <cds/container/vyukov_mpmc_cycle_queue.h>
+#include <cds/container/process_shared_ring.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sched.h>
+
+// Process-shared ring buffers: producer and consumers are different processes
+namespace {
+
+    static size_t s_nBufferSize = 1024 * 64;
+    static size_t s_nPushCount = 1000000;
+    static unsigned s_nConsumerCount = 2;
+
+    namespace cc = cds::container;
+
+    struct WeakRingBuffer_traits: public cc::weak_ringbuffer::traits
+    {
+        typedef cds::opt::v::uninitialized_external_buffer< void* > buffer;
+    };
+
+    struct VyukovMPMCCycleQueue_traits: public cc::vyukov_queue::traits
+    {
+        typedef cds::opt::v::uninitialized_external_buffer< void* > buffer;
+        typedef cds::atomicity::item_counter item_counter;
+    };
+
+    typedef cc::WeakRingBuffer< size_t, WeakRingBuffer_traits > WeakRingBuffer_shm;
+    typedef cc::WeakRingBuffer< void, WeakRingBuffer_traits >   WeakRingBuffer_void_shm;
+    typedef cc::VyukovMPMCCycleQueue< size_t, VyukovMPMCCycleQueue_traits > VyukovMPMCCycleQueue_shm;
+
+    // Results of consumer processes, placed in anonymous shared memory
+    struct ipc_result
+    {
+        atomics::atomic<size_t> producer_done;
+        struct consumer_result {
+            size_t  popped;
+            size_t  pop_empty;
+            size_t  bad_value;
+        };
+        consumer_result consumer[16];
+    };
+
+    class ipc_ring: public cds_test::stress_fixture
+    {
+    protected:
+        // Shared memory region mapped in the current process
+        class shm_region
+        {
+        public:
+            shm_region( std::string const& name, size_t size, bool create )
+                : size_( size )
+                , addr_( nullptr )
+            {
+                int fd = create ? shm_open( name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600 ) : shm_open( name.c_str(), O_RDWR, 0600 );
+                if ( fd < 0 )
+                    return;
+                if ( !create || ftruncate( fd, static_cast<off_t>( size )) == 0 ) {
+                    void* p = mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+                    if ( p != MAP_FAILED )
+                        addr_ = p;
+                }
+                close( fd );
+            }
+
+            ~shm_region()
+            {
+                if ( addr_ )
+                    munmap( addr_, size_ );
+            }
+
+            void* get() const
+            {
+                return addr_;
+            }
+
+        private:
+            size_t const size_;
+            void*        addr_;
+        };
+
+        template <class Ring>
+        static void producer( Ring& ring, ipc_result& res )
+        {
+            for ( size_t v = 0; v < s_nPushCount; ) {
+                if ( ring.push( v ))
+                    ++v;
+                else
+                    sched_yield();
+            }
+            res.producer_done.store( 1, atomics::memory_order_release );
+        }
+
+        static void producer( WeakRingBuffer_void_shm& ring, ipc_result& res )
+        {
+            for ( size_t v = 0; v < s_nPushCount; ) {
+                size_t len = v % 256 + sizeof( size_t );
+                void* buf = ring.back( len );
+                if ( buf ) {
+                    memset( buf, static_cast<int>( len ), len );
+                    *reinterpret_cast<size_t*>( buf ) = v;
+                    ring.push_back();
+                    ++v;
+                }
+                else
+                    sched_yield();
+            }
+            res.producer_done.store( 1, atomics::memory_order_release );
+        }
+
+        template <class Ring>
+        static void consumer( Ring& ring, ipc_result& res, unsigned idx )
+        {
+            ipc_result::consumer_result& r = res.consumer[idx];
+            size_t prev = 0 - 1;
+            while ( true ) {
+                size_t v;
+                if ( ring.pop( v )) {
+                    ++r.popped;
+                    // a single producer: each consumer sees increasing sequence
+                    if ( prev != size_t( 0 - 1 ) && v <= prev )
+                        ++r.bad_value;
+                    prev = v;
+                }
+                else {
+                    ++r.pop_empty;
+                    if ( res.producer_done.load( atomics::memory_order_acquire ) && ring.empty())
+                        break;
+                    sched_yield();
+                }
+            }
+        }
+
+        static void consumer( WeakRingBuffer_void_shm& ring, ipc_result& res, unsigned idx )
+        {
+            ipc_result::consumer_result& r = res.consumer[idx];
+            size_t expected = 0;
+            while ( true ) {
+                auto buf = ring.front();
+                if ( buf.first ) {
+                    ++r.popped;
+                    uint8_t const* p = reinterpret_cast<uint8_t const*>( buf.first );
+                    if ( *reinterpret_cast<size_t const*>( p ) != expected || buf.second != expected % 256 + sizeof( size_t ))
+                        ++r.bad_value;
+                    else {
+                        for ( size_t i = sizeof( size_t ); i < buf.second; ++i ) {
+                            if ( p[i] != static_cast<uint8_t>( buf.second )) {
+                                ++r.bad_value;
+                                break;
+                            }
+                        }
+                    }
+                    ++expected;
+                    ring.pop_front();
+                }
+                else {
+                    ++r.pop_empty;
+                    if ( res.producer_done.load( atomics::memory_order_acquire ) && ring.empty())
+                        break;
+                    sched_yield();
+                }
+            }
+        }
+
+        template <class Ring>
+        void test( unsigned nConsumerCount )
+        {
+            typedef cc::process_shared::ring_segment< Ring > segment;
+
+            ASSERT_LE( nConsumerCount, sizeof( ipc_result().consumer ) / sizeof( ipc_result().consumer[0] ));
+
+            std::string const name = "/cds_ipc_ring_" + std::to_string( static_cast<unsigned long>( getpid()));
+            size_t const nRegionSize = segment::size( s_nBufferSize );
+
+            void* pResult = mmap( nullptr, sizeof( ipc_result ), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0 );
+            ASSERT_TRUE( pResult != MAP_FAILED );
+            ipc_result& res = *new( pResult ) ipc_result;
+            res.producer_done.store( 0 );
+            memset( res.consumer, 0, sizeof( res.consumer ));
+
+            int nForkError = 0;
+            shm_unlink( name.c_str());
+            {
+                shm_region region( name, nRegionSize, true );
+                ASSERT_TRUE( region.get() != nullptr );
+
+                Ring* ring = segment::create( region.get(), nRegionSize, s_nBufferSize );
+                ASSERT_TRUE( ring != nullptr );
+
+                propout() << std::make_pair( "buffer_size", s_nBufferSize )
+                          << std::make_pair( "push_count", s_nPushCount )
+                          << std::make_pair( "consumer_count", nConsumerCount );
+
+                auto time_start = std::chrono::steady_clock::now();
+
+                std::vector<pid_t> consumers;
+                for ( unsigned i = 0; i < nConsumerCount; ++i ) {
+                    pid_t pid = fork();
+                    if ( pid < 0 ) {
+                        nForkError = errno;
+                        break;
+                    }
+                    if ( pid == 0 ) {
+                        // Consumer process maps the region at other address
+                        int ret = 1;
+                        {
+                            shm_region child_region( name, nRegionSize, false );
+                            if ( child_region.get()) {
+                                Ring* r = segment::attach( child_region.get(), nRegionSize );
+                                if ( r ) {
+                                    consumer( *r, res, i );
+                                    segment::detach( child_region.get());
+                                    ret = 0;
+                                }
+                            }
+                        }
+                        _exit( ret );
+                    }
+                    consumers.push_back( pid );
+                }
+
+                if ( nForkError != 0 ) {
+                    // Do not leave orphan consumers waiting for the producer
+                    for ( pid_t pid : consumers ) {
+                        kill( pid, SIGKILL );
+                        waitpid( pid, nullptr, 0 );
+                    }
+                }
+                else {
+                    producer( *ring, res );
+
+                    for ( pid_t pid : consumers ) {
+                        int status = 0;
+                        EXPECT_EQ( waitpid( pid, &status, 0 ), pid );
+                        EXPECT_TRUE( WIFEXITED( status ));
+                        EXPECT_EQ( WEXITSTATUS( status ), 0 );
+                    }
+
+                    std::chrono::milliseconds duration = std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() - time_start );
+                    propout() << std::make_pair( "duration", duration );
+
+                    EXPECT_TRUE( ring->empty());
+                    EXPECT_TRUE( segment::detach( region.get()));
+                }
+            }
+            shm_unlink( name.c_str());
+
+            if ( nForkError != 0 ) {
+                munmap( pResult, sizeof( ipc_result ));
+                FAIL() << "fork() failed: " << strerror( nForkError );
+            }
+
+            // analyze result
+            size_t nPopped = 0;
+            for ( unsigned i = 0; i < nConsumerCount; ++i ) {
+                EXPECT_EQ( res.consumer[i].bad_value, 0u ) << "consumer " << i;
+                nPopped += res.consumer[i].popped;
+
+                propout()
+                    << std::make_pair( "consumer_pop_count", res.consumer[i].popped )
+                    << std::make_pair( "consumer_pop_empty", res.consumer[i].pop_empty )
+                    << std::make_pair( "consumer_bad_value", res.consumer[i].bad_value );
+            }
+            EXPECT_EQ( nPopped, s_nPushCount );
+
+            munmap( pResult, sizeof( ipc_result ));
+        }
+
+    public:
+        static void SetUpTestCase()
+        {
+            cds_test::config const& cfg = get_config( "ipc_ring" );
+
+            s_nBufferSize = cfg.get_size_t( "BufferSize", s_nBufferSize );
+            s_nPushCount = cfg.get_size_t( "PushCount", s_nPushCount );
+            s_nConsumerCount = cfg.get_uint( "ConsumerCount", s_nConsumerCount );
+
+            s_nBufferSize = cds::beans::ceil2( s_nBufferSize );
+            if ( s_nBufferSize < 1024 * 4 )
+                s_nBufferSize = 1024 * 4;
+            if ( s_nPushCount == 0u )
+                s_nPushCount = 1024;
+            if ( s_nConsumerCount == 0u )
+                s_nConsumerCount = 1;
+            if ( s_nConsumerCount > 16 )
+                s_nConsumerCount = 16;
+        }
+    };
+
+    TEST_F( ipc_ring, WeakRingBuffer_shm )
+    {
+        test< WeakRingBuffer_shm >( 1 );
+    }
+
+    TEST_F( ipc_ring, WeakRingBuffer_void_shm )
+    {
+        test< WeakRingBuffer_void_shm >( 1 );
+    }
+
+    TEST_F( ipc_ring, VyukovMPMCCycleQueue_shm )
+    {
+        test< VyukovMPMCCycleQueue_shm >( s_nConsumerCount );
+    }
+
+} // namespace
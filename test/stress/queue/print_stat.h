@@ -6,6 +6,8 @@
 #ifndef CDSSTRESS_QUEUE_PRINT_STAT_H
 #define CDSSTRESS_QUEUE_PRINT_STAT_H
 
+#include <cds/container/details/ts_base.h>
+
 namespace cds_test {
 
     template <typename Counter>
@@ -87,7 +89,12 @@ namespace cds_test {
             << CDSSTRESS_STAT_OUT( s, m_nCreateSegmentReq )
             << CDSSTRESS_STAT_OUT( s, m_nDeleteSegmentReq )
             << CDSSTRESS_STAT_OUT( s, m_nSegmentCreated )
-            << CDSSTRESS_STAT_OUT( s, m_nSegmentDeleted );
+            << CDSSTRESS_STAT_OUT( s, m_nSegmentDeleted )
+            << CDSSTRESS_STAT_OUT( s, m_nPushFirstProbe )
+            << CDSSTRESS_STAT_OUT( s, m_nPopFirstProbe )
+            << CDSSTRESS_STAT_OUT( s, m_nSegmentGrow )
+            << CDSSTRESS_STAT_OUT( s, m_nSegmentShrink )
+            << CDSSTRESS_STAT_OUT_( property_stream::stat_prefix() + ".m_nMaxQuasiFactor", s.m_nMaxQuasiFactor.load( atomics::memory_order_relaxed ));
     }
 
     static inline property_stream& operator <<( property_stream& o, cds::intrusive::segmented_queue::empty_stat const& /*s*/ )
@@ -95,6 +102,21 @@ namespace cds_test {
         return o;
     }
 
+    static inline property_stream& operator <<( property_stream& o, cds::container::ts::stat<> const& s )
+    {
+        return o
+            << CDSSTRESS_STAT_OUT( s, m_nPush )
+            << CDSSTRESS_STAT_OUT( s, m_nPushRace )
+            << CDSSTRESS_STAT_OUT( s, m_nPop )
+            << CDSSTRESS_STAT_OUT( s, m_nPopEmpty )
+            << CDSSTRESS_STAT_OUT( s, m_nPopRetry );
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::ts::empty_stat const& /*s*/ )
+    {
+        return o;
+    }
+
 } // namespace cds_test
 
 #endif // CDSSTRESS_QUEUE_PRINT_STAT_H
@@ -341,6 +341,17 @@ namespace {
 
     CDSSTRESS_VyukovQueue( simple_queue_push_pop )
 
+#undef CDSSTRESS_Queue_F
+#define CDSSTRESS_Queue_F( test_fixture, type_name ) \
+    TEST_F( test_fixture, type_name ) \
+    { \
+        typedef queue::Types< value_type >::type_name queue_type; \
+        queue_type queue( s_nProducerThreadCount + s_nConsumerThreadCount ); \
+        test( queue ); \
+    }
+
+    CDSSTRESS_TSQueue( simple_queue_push_pop )
+
 #undef CDSSTRESS_Queue_F
 
 
@@ -412,4 +423,43 @@ namespace {
         ::testing::ValuesIn( segmented_queue_push_pop::get_test_parameters()));
 #endif
 
+    // ********************************************************************
+    // SegmentedQueue with adaptive segment size
+
+    class adaptive_segmented_queue_push_pop: public queue_push_pop<>
+    {
+        typedef queue_push_pop<> base_class;
+
+    protected:
+        template <typename Queue>
+        void test()
+        {
+            cds_test::config const& cfg = get_config( "queue_push_pop" );
+            size_t nMinQuasiFactor = cfg.get_size_t( "SegmentedQueue_MinSegmentSize", 16 );
+            size_t nMaxQuasiFactor = cfg.get_size_t( "SegmentedQueue_MaxSegmentSize", 1024 );
+            if ( nMinQuasiFactor < 2 )
+                nMinQuasiFactor = 2;
+
+            Queue q( nMinQuasiFactor, nMaxQuasiFactor );
+            propout() << std::make_pair( "min_quasi_factor", q.min_quasi_factor())
+                << std::make_pair( "max_quasi_factor", q.max_quasi_factor());
+            base_class::test_queue( q );
+
+            // FIFO order is violated no more than max_quasi_factor() positions
+            analyze( q, q.max_quasi_factor() * 2, q.max_quasi_factor());
+            propout() << std::make_pair( "last_quasi_factor", q.quasi_factor())
+                << q.statistics();
+        }
+    };
+
+#undef CDSSTRESS_Queue_F
+#define CDSSTRESS_Queue_F( test_fixture, type_name ) \
+    TEST_F( test_fixture, type_name ) \
+    { \
+        typedef queue::Types<value_type>::type_name queue_type; \
+        test< queue_type >(); \
+    }
+
+    CDSSTRESS_AdaptiveSegmentedQueue( adaptive_segmented_queue_push_pop )
+
 } // namespace
@@ -16,6 +16,8 @@
 #include <cds/container/fcdeque.h>
 #include <cds/container/segmented_queue.h>
 #include <cds/container/weak_ringbuffer.h>
+#include <cds/container/unbounded_spsc_queue.h>
+#include <cds/container/ts_queue.h>
 
 #include <cds/gc/hp.h>
 #include <cds/gc/dhp.h>
@@ -196,6 +198,38 @@ namespace fc_details{
         typedef cds::container::MoirQueue< cds::gc::DHP, Value, traits_MSQueue_stat > MoirQueue_DHP_stat;
 
 
+        // TSQueue
+        typedef cds::container::TSQueue< cds::gc::HP,  Value > TSQueue_HP;
+        typedef cds::container::TSQueue< cds::gc::DHP, Value > TSQueue_DHP;
+
+        struct traits_TSQueue_stat: public
+            cds::container::ts::make_traits <
+                cds::opt::stat< cds::container::ts::stat<> >
+                , cds::opt::item_counter< cds::atomicity::item_counter >
+            >::type
+        {};
+        typedef cds::container::TSQueue< cds::gc::HP,  Value, traits_TSQueue_stat > TSQueue_HP_stat;
+        typedef cds::container::TSQueue< cds::gc::DHP, Value, traits_TSQueue_stat > TSQueue_DHP_stat;
+
+        struct traits_TSQueue_atomic: public
+            cds::container::ts::make_traits <
+                cds::container::ts::timestamp< cds::container::ts::atomic_counter >
+                , cds::opt::stat< cds::container::ts::stat<> >
+            >::type
+        {};
+        typedef cds::container::TSQueue< cds::gc::HP,  Value, traits_TSQueue_atomic > TSQueue_HP_atomic;
+        typedef cds::container::TSQueue< cds::gc::DHP, Value, traits_TSQueue_atomic > TSQueue_DHP_atomic;
+
+        struct traits_TSQueue_hwcounter: public
+            cds::container::ts::make_traits <
+                cds::container::ts::timestamp< cds::container::ts::hardware_counter >
+                , cds::opt::back_off< cds::backoff::pause >
+            >::type
+        {};
+        typedef cds::container::TSQueue< cds::gc::HP,  Value, traits_TSQueue_hwcounter > TSQueue_HP_hwcounter;
+        typedef cds::container::TSQueue< cds::gc::DHP, Value, traits_TSQueue_hwcounter > TSQueue_DHP_hwcounter;
+
+
         // OptimisticQueue
         typedef cds::container::OptimisticQueue< cds::gc::HP, Value > OptimisticQueue_HP;
         typedef cds::container::OptimisticQueue< cds::gc::DHP, Value > OptimisticQueue_DHP;
@@ -355,6 +389,34 @@ namespace fc_details{
             }
         };
 
+        // UnboundedSPSCQueue
+        struct traits_UnboundedSPSCQueue_stat: public cds::container::unbounded_spsc_queue::traits
+        {
+            typedef cds::container::unbounded_spsc_queue::stat<> stat;
+        };
+        class UnboundedSPSCQueue
+            : public cds::container::UnboundedSPSCQueue< Value >
+        {
+            typedef cds::container::UnboundedSPSCQueue< Value > base_class;
+        public:
+            UnboundedSPSCQueue()
+            {}
+            UnboundedSPSCQueue( size_t nChunkSize )
+                : base_class( nChunkSize )
+            {}
+        };
+        class UnboundedSPSCQueue_stat
+            : public cds::container::UnboundedSPSCQueue< Value, traits_UnboundedSPSCQueue_stat >
+        {
+            typedef cds::container::UnboundedSPSCQueue< Value, traits_UnboundedSPSCQueue_stat > base_class;
+        public:
+            UnboundedSPSCQueue_stat()
+            {}
+            UnboundedSPSCQueue_stat( size_t nChunkSize )
+                : base_class( nChunkSize )
+            {}
+        };
+
         // BasketQueue
 
         typedef cds::container::BasketQueue< cds::gc::HP , Value > BasketQueue_HP;
@@ -543,6 +605,17 @@ namespace fc_details{
                 , cds::opt::padding< cds::opt::cache_line_padding >
             >::type
         {};
+        class traits_SegmentedQueue_affine:
+            public cds::container::segmented_queue::make_traits<
+                cds::opt::permutation_generator< cds::opt::v::thread_affine_permutation<int> >
+            >::type
+        {};
+        class traits_SegmentedQueue_affine_stat:
+            public cds::container::segmented_queue::make_traits<
+                cds::opt::permutation_generator< cds::opt::v::thread_affine_permutation<int> >
+                , cds::opt::stat< cds::intrusive::segmented_queue::stat<> >
+            >::type
+        {};
 
         typedef cds::container::SegmentedQueue< cds::gc::HP, Value >  SegmentedQueue_HP_spin;
         typedef cds::container::SegmentedQueue< cds::gc::HP, Value, traits_SegmentedQueue_spin_padding >  SegmentedQueue_HP_spin_padding;
@@ -550,6 +623,8 @@ namespace fc_details{
         typedef cds::container::SegmentedQueue< cds::gc::HP, Value, traits_SegmentedQueue_mutex >  SegmentedQueue_HP_mutex;
         typedef cds::container::SegmentedQueue< cds::gc::HP, Value, traits_SegmentedQueue_mutex_padding >  SegmentedQueue_HP_mutex_padding;
         typedef cds::container::SegmentedQueue< cds::gc::HP, Value, traits_SegmentedQueue_mutex_stat >  SegmentedQueue_HP_mutex_stat;
+        typedef cds::container::SegmentedQueue< cds::gc::HP, Value, traits_SegmentedQueue_affine >  SegmentedQueue_HP_affine;
+        typedef cds::container::SegmentedQueue< cds::gc::HP, Value, traits_SegmentedQueue_affine_stat >  SegmentedQueue_HP_affine_stat;
 
         typedef cds::container::SegmentedQueue< cds::gc::DHP, Value >  SegmentedQueue_DHP_spin;
         typedef cds::container::SegmentedQueue< cds::gc::DHP, Value, traits_SegmentedQueue_spin_padding >  SegmentedQueue_DHP_spin_padding;
@@ -557,6 +632,8 @@ namespace fc_details{
         typedef cds::container::SegmentedQueue< cds::gc::DHP, Value, traits_SegmentedQueue_mutex >  SegmentedQueue_DHP_mutex;
         typedef cds::container::SegmentedQueue< cds::gc::DHP, Value, traits_SegmentedQueue_mutex_padding >  SegmentedQueue_DHP_mutex_padding;
         typedef cds::container::SegmentedQueue< cds::gc::DHP, Value, traits_SegmentedQueue_mutex_stat >  SegmentedQueue_DHP_mutex_stat;
+        typedef cds::container::SegmentedQueue< cds::gc::DHP, Value, traits_SegmentedQueue_affine >  SegmentedQueue_DHP_affine;
+        typedef cds::container::SegmentedQueue< cds::gc::DHP, Value, traits_SegmentedQueue_affine_stat >  SegmentedQueue_DHP_affine_stat;
     };
 
     template <typename Value>
@@ -624,6 +701,19 @@ namespace cds_test {
         return o;
     }
 
+    static inline property_stream& operator <<( property_stream& o, cds::container::unbounded_spsc_queue::empty_stat const& /*s*/ )
+    {
+        return o;
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::unbounded_spsc_queue::stat<> const& s )
+    {
+        return o
+            << CDSSTRESS_STAT_OUT( s, m_nChunkAlloc )
+            << CDSSTRESS_STAT_OUT( s, m_nChunkReuse )
+            << CDSSTRESS_STAT_OUT( s, m_nChunkFree );
+    }
+
     static inline property_stream& operator <<( property_stream& o, cds::container::fcdeque::stat<> const& s )
     {
         return o
@@ -842,12 +932,32 @@ namespace cds_test {
     CDSSTRESS_Queue_F( test_fixture, SegmentedQueue_HP_spin_stat    ) \
     CDSSTRESS_Queue_F( test_fixture, SegmentedQueue_HP_mutex        ) \
     CDSSTRESS_Queue_F( test_fixture, SegmentedQueue_HP_mutex_stat   ) \
+    CDSSTRESS_Queue_F( test_fixture, SegmentedQueue_HP_affine       ) \
+    CDSSTRESS_Queue_F( test_fixture, SegmentedQueue_HP_affine_stat  ) \
     CDSSTRESS_Queue_F( test_fixture, SegmentedQueue_DHP_spin        ) \
     CDSSTRESS_Queue_F( test_fixture, SegmentedQueue_DHP_spin_stat   ) \
     CDSSTRESS_Queue_F( test_fixture, SegmentedQueue_DHP_mutex       ) \
     CDSSTRESS_Queue_F( test_fixture, SegmentedQueue_DHP_mutex_stat  ) \
+    CDSSTRESS_Queue_F( test_fixture, SegmentedQueue_DHP_affine      ) \
+    CDSSTRESS_Queue_F( test_fixture, SegmentedQueue_DHP_affine_stat ) \
     CDSSTRESS_SegmentedQueue_1( test_fixture )
 
+#define CDSSTRESS_AdaptiveSegmentedQueue( test_fixture ) \
+    CDSSTRESS_Queue_F( test_fixture, SegmentedQueue_HP_spin_stat    ) \
+    CDSSTRESS_Queue_F( test_fixture, SegmentedQueue_HP_affine_stat  ) \
+    CDSSTRESS_Queue_F( test_fixture, SegmentedQueue_DHP_spin_stat   ) \
+    CDSSTRESS_Queue_F( test_fixture, SegmentedQueue_DHP_affine_stat )
+
+#define CDSSTRESS_TSQueue( test_fixture ) \
+    CDSSTRESS_Queue_F( test_fixture, TSQueue_HP           ) \
+    CDSSTRESS_Queue_F( test_fixture, TSQueue_HP_stat      ) \
+    CDSSTRESS_Queue_F( test_fixture, TSQueue_HP_atomic    ) \
+    CDSSTRESS_Queue_F( test_fixture, TSQueue_HP_hwcounter ) \
+    CDSSTRESS_Queue_F( test_fixture, TSQueue_DHP          ) \
+    CDSSTRESS_Queue_F( test_fixture, TSQueue_DHP_stat     ) \
+    CDSSTRESS_Queue_F( test_fixture, TSQueue_DHP_atomic   ) \
+    CDSSTRESS_Queue_F( test_fixture, TSQueue_DHP_hwcounter )
+
 #define CDSSTRESS_VyukovQueue( test_fixture ) \
     CDSSTRESS_Queue_F( test_fixture, VyukovMPMCCycleQueue_dyn       ) \
     CDSSTRESS_Queue_F( test_fixture, VyukovMPMCCycleQueue_dyn_ic    )
@@ -862,6 +972,10 @@ namespace cds_test {
 #define CDSSTRESS_WeakRingBuffer_void( test_fixture ) \
     CDSSTRESS_Queue_F( test_fixture, WeakRingBuffer_void_dyn       )
 
+#define CDSSTRESS_UnboundedSPSCQueue( test_fixture ) \
+    CDSSTRESS_Queue_F( test_fixture, UnboundedSPSCQueue       ) \
+    CDSSTRESS_Queue_F( test_fixture, UnboundedSPSCQueue_stat  )
+
 #define CDSSTRESS_StdQueue( test_fixture ) \
     CDSSTRESS_Queue_F( test_fixture, StdQueue_deque_Spinlock ) \
     CDSSTRESS_Queue_F( test_fixture, StdQueue_list_Spinlock  ) \
@@ -15,6 +15,7 @@ namespace {
 
     static size_t s_nBufferSize = 1024*1024;
     static size_t s_nPushCount = 1000000;
+    static size_t s_nBatchSize = 32;
 
     static std::atomic<size_t> s_nProducerDone( 0 );
 
@@ -178,9 +179,137 @@ namespace {
             }
         };
 
+        template <class Queue>
+        class BatchProducer: public cds_test::thread
+        {
+            typedef cds_test::thread base_class;
+
+        public:
+            BatchProducer( cds_test::thread_pool& pool, Queue& queue )
+                : base_class( pool, producer_thread )
+                , m_Queue( queue )
+            {}
+
+            BatchProducer( BatchProducer& src )
+                : base_class( src )
+                , m_Queue( src.m_Queue )
+            {}
+
+            virtual thread * clone()
+            {
+                return new BatchProducer( *this );
+            }
+
+            virtual void test()
+            {
+                size_t const nPushCount = s_nPushCount;
+                size_t const nBatchSize = s_nBatchSize;
+
+                cds::backoff::Default bkoff;
+                size_t len = rand( 1024 ) + 64;
+                for ( size_t i = 0; i < nPushCount; ) {
+                    size_t nReserved = 0;
+                    for ( ; nReserved < nBatchSize && i < nPushCount; ++nReserved, ++i ) {
+                        void* buf = m_Queue.reserve( len );
+                        if ( !buf ) {
+                            ++m_nPushFailed;
+                            break;
+                        }
+                        memset( buf, len % 256, len );
+                        m_nPushed += len;
+                        len = rand( 1024 ) + 64;
+                    }
+                    if ( nReserved ) {
+                        m_Queue.commit();
+                        ++m_nBatchCount;
+                        bkoff.reset();
+                    }
+                    else {
+                        // The buffer is full, retry the same item when the consumer frees some space
+                        bkoff();
+                    }
+                }
+
+                s_nProducerDone.fetch_add( 1 );
+            }
+
+        public:
+            Queue&              m_Queue;
+            size_t              m_nPushFailed = 0;
+            size_t              m_nPushed = 0;
+            size_t              m_nBatchCount = 0;
+        };
+
+        template <class Queue>
+        class BatchConsumer: public cds_test::thread
+        {
+            typedef cds_test::thread base_class;
+
+        public:
+            Queue&              m_Queue;
+            size_t              m_nPopEmpty = 0;
+            size_t              m_nPopped = 0;
+            size_t              m_nPopCount = 0;
+            size_t              m_nBadValue = 0;
+            size_t              m_nBatchCount = 0;
+
+        public:
+            BatchConsumer( cds_test::thread_pool& pool, Queue& queue )
+                : base_class( pool, consumer_thread )
+                , m_Queue( queue )
+            {}
+            BatchConsumer( BatchConsumer& src )
+                : base_class( src )
+                , m_Queue( src.m_Queue )
+            {}
+
+            virtual thread * clone()
+            {
+                return new BatchConsumer( *this );
+            }
+
+            virtual void test()
+            {
+                size_t const nBatchSize = s_nBatchSize;
+
+                while ( true ) {
+                    size_t n = m_Queue.consume( [this]( void* data, size_t size ) {
+                            m_nPopped += size;
+                            ++m_nPopCount;
+
+                            uint8_t val = static_cast<uint8_t>( size % 256 );
+                            uint8_t const* p = reinterpret_cast<uint8_t*>( data );
+                            for ( uint8_t const* pEnd = p + size; p < pEnd; ++p ) {
+                                if ( *p != val ) {
+                                    ++m_nBadValue;
+                                    break;
+                                }
+                            }
+                        }, nBatchSize );
+
+                    if ( n )
+                        ++m_nBatchCount;
+                    else {
+                        ++m_nPopEmpty;
+                        if ( s_nProducerDone.load() != 0 ) {
+                            if ( m_Queue.empty())
+                                break;
+                        }
+                    }
+                }
+            }
+        };
+
     protected:
         size_t m_nThreadPushCount;
 
+    protected:
+        static double throughput( size_t nBytes, std::chrono::milliseconds duration )
+        {
+            // GB/s
+            return duration.count() ? static_cast<double>( nBytes ) / ( static_cast<double>( duration.count()) * 1.0e6 ) : 0.0;
+        }
+
     protected:
         template <class ProducerPayload, class ConsumerPayload, class Queue >
         void test_queue( Queue& q )
@@ -199,7 +328,8 @@ namespace {
 
             std::chrono::milliseconds duration = pool.run();
 
-            propout() << std::make_pair( "duration", duration );
+            propout() << std::make_pair( "duration", duration )
+                      << std::make_pair( "throughput_GBps", throughput( consumer->m_nPopped, duration ));
 
             // analyze result
             EXPECT_EQ( consumer->m_nBadValue, 0u );
@@ -222,6 +352,45 @@ namespace {
             propout() << q.statistics();
         }
 
+        template <class Queue>
+        void test_batch( Queue& q )
+        {
+            cds_test::thread_pool& pool = get_pool();
+            auto producer = new BatchProducer<Queue>( pool, q );
+            auto consumer = new BatchConsumer<Queue>( pool, q );
+
+            pool.add( producer, 1 );
+            pool.add( consumer, 1 );
+
+            s_nProducerDone.store( 0 );
+
+            propout() << std::make_pair( "buffer_size", s_nBufferSize )
+                      << std::make_pair( "push_count", s_nPushCount )
+                      << std::make_pair( "batch_size", s_nBatchSize );
+
+            std::chrono::milliseconds duration = pool.run();
+
+            propout() << std::make_pair( "duration", duration )
+                      << std::make_pair( "throughput_GBps", throughput( consumer->m_nPopped, duration ));
+
+            // analyze result
+            EXPECT_EQ( consumer->m_nBadValue, 0u );
+            EXPECT_EQ( consumer->m_nPopped, producer->m_nPushed );
+            EXPECT_EQ( consumer->m_nPopCount, s_nPushCount );
+
+            propout()
+                << std::make_pair( "producer_push_length", producer->m_nPushed )
+                << std::make_pair( "producer_push_failed", producer->m_nPushFailed )
+                << std::make_pair( "producer_batch_count", producer->m_nBatchCount )
+                << std::make_pair( "consumer_pop_length", consumer->m_nPopped )
+                << std::make_pair( "consumer_pop_count", consumer->m_nPopCount )
+                << std::make_pair( "consumer_pop_empty", consumer->m_nPopEmpty )
+                << std::make_pair( "consumer_batch_count", consumer->m_nBatchCount )
+                << std::make_pair( "consumer_bad_value", consumer->m_nBadValue );
+
+            propout() << q.statistics();
+        }
+
     public:
         static void SetUpTestCase()
         {
@@ -229,11 +398,14 @@ namespace {
 
             s_nBufferSize = cfg.get_size_t( "BufferSize", s_nBufferSize );
             s_nPushCount = cfg.get_size_t( "PushCount", s_nPushCount );
+            s_nBatchSize = cfg.get_size_t( "BatchSize", s_nBatchSize );
 
             if ( s_nBufferSize < 1024 * 64 )
                 s_nBufferSize = 1024 * 64;
             if ( s_nPushCount == 0u )
                 s_nPushCount = 1024;
+            if ( s_nBatchSize == 0u )
+                s_nBatchSize = 1;
         }
     };
 
@@ -272,6 +444,21 @@ namespace {
     CDSSTRESS_WeakRingBuffer_void( spsc_buffer_slow_producer )
     CDSSTRESS_WeakRingBuffer_void( spsc_buffer_slow_consumer )
 
+#undef CDSSTRESS_Queue_F
+#define CDSSTRESS_Queue_F( test_fixture, type_name ) \
+    TEST_F( test_fixture, type_name ) \
+    { \
+        typedef queue::Types< value_type >::type_name queue_type; \
+        queue_type queue( s_nBufferSize ); \
+        test_batch( queue ); \
+    }
+
+    // Batch reserve/commit and batch consume
+    class spsc_buffer_batch: public spsc_buffer
+    {};
+
+    CDSSTRESS_WeakRingBuffer_void( spsc_buffer_batch )
+
 #undef CDSSTRESS_Queue_F
 
 } // namespace
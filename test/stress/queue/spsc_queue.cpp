@@ -8,6 +8,14 @@
 #include <vector>
 #include <algorithm>
 #include <type_traits>
+#include <cstring>
+
+#ifdef __linux__
+#   include <linux/perf_event.h>
+#   include <sys/ioctl.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#endif
 
 // Single producer/single consumer queue push/pop test
 namespace {
@@ -17,6 +25,62 @@ namespace {
 
     static std::atomic<size_t> s_nProducerDone( 0 );
 
+    // Hardware cache-miss counter of the calling thread (Linux perf events)
+    class cache_miss_counter
+    {
+    public:
+        cache_miss_counter()
+            : m_fd( -1 )
+        {
+#ifdef __linux__
+            perf_event_attr attr;
+            memset( &attr, 0, sizeof( attr ));
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof( attr );
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            m_fd = static_cast<int>( syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 ));
+#endif
+        }
+
+        ~cache_miss_counter()
+        {
+#ifdef __linux__
+            if ( m_fd >= 0 )
+                close( m_fd );
+#endif
+        }
+
+        void start()
+        {
+#ifdef __linux__
+            if ( m_fd >= 0 ) {
+                ioctl( m_fd, PERF_EVENT_IOC_RESET, 0 );
+                ioctl( m_fd, PERF_EVENT_IOC_ENABLE, 0 );
+            }
+#endif
+        }
+
+        // Returns the count of cache misses since start(), or -1 if perf events are not available
+        long long stop()
+        {
+#ifdef __linux__
+            if ( m_fd >= 0 ) {
+                ioctl( m_fd, PERF_EVENT_IOC_DISABLE, 0 );
+                long long nCount = 0;
+                if ( read( m_fd, &nCount, sizeof( nCount )) == static_cast<ssize_t>( sizeof( nCount )))
+                    return nCount;
+            }
+#endif
+            return -1;
+        }
+
+    private:
+        int m_fd;
+    };
+
     class spsc_queue: public cds_test::stress_fixture
     {
     protected:
@@ -53,6 +117,10 @@ namespace {
                 size_t const nPushCount = s_nQueueSize * s_nPassCount;
                 m_nPushFailed = 0;
 
+                cache_miss_counter cm;
+                cm.start();
+                auto time_start = std::chrono::steady_clock::now();
+
                 for ( value_type v = 0; v < nPushCount; ++v ) {
                     if ( !m_Queue.push( v )) {
                         ++m_nPushFailed;
@@ -60,12 +128,17 @@ namespace {
                     }
                 }
 
+                m_Duration = std::chrono::steady_clock::now() - time_start;
+                m_nCacheMisses = cm.stop();
+
                 s_nProducerDone.fetch_add( 1 );
             }
 
         public:
             Queue&              m_Queue;
             size_t              m_nPushFailed = 0;
+            std::chrono::nanoseconds m_Duration;
+            long long           m_nCacheMisses = -1;
         };
 
         template <class Queue>
@@ -78,6 +151,8 @@ namespace {
             size_t              m_nPopEmpty = 0;
             size_t              m_nPopped = 0;
             size_t              m_nBadValue = 0;
+            std::chrono::nanoseconds m_Duration;
+            long long           m_nCacheMisses = -1;
 
         public:
             Consumer( cds_test::thread_pool& pool, Queue& queue )
@@ -99,6 +174,10 @@ namespace {
                 value_type v;
                 value_type prev = 0 - 1;
 
+                cache_miss_counter cm;
+                cm.start();
+                auto time_start = std::chrono::steady_clock::now();
+
                 while ( true ) {
                     if ( m_Queue.pop( v )) {
                         ++m_nPopped;
@@ -115,6 +194,9 @@ namespace {
                         }
                     }
                 }
+
+                m_Duration = std::chrono::steady_clock::now() - time_start;
+                m_nCacheMisses = cm.stop();
             }
         };
 
@@ -151,6 +233,21 @@ namespace {
                 << std::make_pair( "consumer_pop_count", consumer->m_nPopped )
                 << std::make_pair( "consumer_pop_empty", consumer->m_nPopEmpty )
                 << std::make_pair( "consumer_bad_value", consumer->m_nBadValue );
+
+            // benchmark: ns per operation and cache misses per operation
+            size_t const nOpCount = s_nQueueSize * s_nPassCount;
+            propout()
+                << std::make_pair( "producer_ns_per_op", static_cast<double>( producer->m_Duration.count()) / nOpCount )
+                << std::make_pair( "consumer_ns_per_op", static_cast<double>( consumer->m_Duration.count()) / nOpCount );
+            if ( producer->m_nCacheMisses >= 0 && consumer->m_nCacheMisses >= 0 ) {
+                propout()
+                    << std::make_pair( "producer_cache_misses", producer->m_nCacheMisses )
+                    << std::make_pair( "producer_cache_misses_per_op", static_cast<double>( producer->m_nCacheMisses ) / nOpCount )
+                    << std::make_pair( "consumer_cache_misses", consumer->m_nCacheMisses )
+                    << std::make_pair( "consumer_cache_misses_per_op", static_cast<double>( consumer->m_nCacheMisses ) / nOpCount );
+            }
+            else
+                propout() << std::make_pair( "cache_misses", "perf events are not available" );
         }
 
         template <class Queue>
@@ -196,6 +293,7 @@ namespace {
     CDSSTRESS_WeakRingBuffer( spsc_queue )
     CDSSTRESS_VyukovQueue( spsc_queue )
     CDSSTRESS_VyukovSingleConsumerQueue( spsc_queue )
+    CDSSTRESS_UnboundedSPSCQueue( spsc_queue )
 
 #undef CDSSTRESS_Queue_F
 
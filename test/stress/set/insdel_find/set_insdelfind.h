@@ -43,6 +43,21 @@ namespace set {
         typedef size_t  key_type;
         typedef size_t  value_type;
 
+        bool m_bResizeLatency = false;  // measure the latency of the operations during which the set has been resized
+
+        // Bucket count of the hash sets, 0 for other sets
+        template <class Set>
+        static auto bucket_count( Set const& s, int ) -> decltype( s.bucket_count())
+        {
+            return s.bucket_count();
+        }
+
+        template <class Set>
+        static size_t bucket_count( Set const&, long )
+        {
+            return 0;
+        }
+
         template <class Set>
         class Worker: public cds_test::thread
         {
@@ -57,6 +72,9 @@ namespace set {
             size_t  m_nFindSuccess = 0;
             size_t  m_nFindFailed = 0;
 
+            std::chrono::nanoseconds m_nMaxLatency{ 0 };        // max latency of an operation
+            std::chrono::nanoseconds m_nMaxResizeLatency{ 0 };  // max latency of an operation during which the bucket table has been resized
+
         public:
             Worker( cds_test::thread_pool& pool, Set& set )
                 : base_class( pool )
@@ -85,6 +103,9 @@ namespace set {
                 while ( !time_elapsed()) {
                     nRand = cds::bitop::RandXorShift(nRand);
                     size_t n = nRand / nNormalize;
+
+                    size_t const nBucketCount = fixture.m_bResizeLatency ? bucket_count( rSet, 0 ) : 0;
+                    auto const tStart = std::chrono::steady_clock::now();
                     switch ( s_arrShuffle[i] ) {
                     case do_find:
                         if ( rSet.contains( n ))
@@ -106,6 +127,12 @@ namespace set {
                         break;
                     }
 
+                    std::chrono::nanoseconds const tOp = std::chrono::steady_clock::now() - tStart;
+                    if ( m_nMaxLatency < tOp )
+                        m_nMaxLatency = tOp;
+                    if ( fixture.m_bResizeLatency && bucket_count( rSet, 0 ) != nBucketCount && m_nMaxResizeLatency < tOp )
+                        m_nMaxResizeLatency = tOp;
+
                     if ( ++i >= c_nShuffleSize )
                         i = 0;
                 }
@@ -114,12 +141,13 @@ namespace set {
 
     protected:
         template <class Set>
-        void do_test( Set& testSet )
+        void do_test( Set& testSet, bool bFill = true )
         {
             typedef Worker<Set> work_thread;
 
             // fill map - only odd number
-            {
+            m_bResizeLatency = !bFill;
+            if ( bFill ) {
                 size_t * pInitArr = new size_t[ s_nSetSize ];
                 size_t * pEnd = pInitArr + s_nSetSize;
                 for ( size_t i = 0; i < s_nSetSize; ++i )
@@ -149,6 +177,8 @@ namespace set {
             size_t nDeleteFailed = 0;
             size_t nFindSuccess = 0;
             size_t nFindFailed = 0;
+            std::chrono::nanoseconds nMaxLatency{ 0 };
+            std::chrono::nanoseconds nMaxResizeLatency{ 0 };
             for ( size_t i = 0; i < pool.size(); ++i ) {
                 work_thread& thr = static_cast<work_thread&>( pool.get( i ));
                 nInsertSuccess += thr.m_nInsertSuccess;
@@ -157,6 +187,8 @@ namespace set {
                 nDeleteFailed  += thr.m_nDeleteFailed;
                 nFindSuccess   += thr.m_nFindSuccess;
                 nFindFailed    += thr.m_nFindFailed;
+                nMaxLatency = std::max( nMaxLatency, thr.m_nMaxLatency );
+                nMaxResizeLatency = std::max( nMaxResizeLatency, thr.m_nMaxResizeLatency );
             }
 
             propout()
@@ -165,7 +197,12 @@ namespace set {
                 << std::make_pair( "delete_success", nDeleteSuccess )
                 << std::make_pair( "delete_failed", nDeleteFailed )
                 << std::make_pair( "find_success", nFindSuccess )
-                << std::make_pair( "find_failed", nFindFailed );
+                << std::make_pair( "find_failed", nFindFailed )
+                << std::make_pair( "max_latency_us", std::chrono::duration_cast<std::chrono::microseconds>( nMaxLatency ).count());
+            if ( m_bResizeLatency ) {
+                propout() << std::make_pair( "finish_bucket_count", bucket_count( testSet, 0 ))
+                    << std::make_pair( "max_resize_latency_us", std::chrono::duration_cast<std::chrono::microseconds>( nMaxResizeLatency ).count());
+            }
 
             {
                 ASSERT_TRUE( std::chrono::duration_cast<std::chrono::seconds>(duration).count() > 0 );
@@ -205,4 +242,30 @@ namespace set {
         static std::vector<size_t> get_load_factors();
     };
 
+    // The set is not filled before the test, so the workers run while the set is growing and resizing.
+    // The max latency of the operations during which the bucket table has been resized is reported
+    class Set_InsDelFind_Resize: public Set_InsDelFind
+    {
+    public:
+        template <class Set>
+        void run_test()
+        {
+            Set s( *this );
+            do_test( s, false );
+        }
+    };
+
+    class Set_InsDelFind_Resize_LF: public Set_InsDelFind_Resize
+        , public ::testing::WithParamInterface<size_t>
+    {
+    public:
+        template <class Set>
+        void run_test()
+        {
+            s_nLoadFactor = GetParam();
+            propout() << std::make_pair( "load_factor", s_nLoadFactor );
+            Set_InsDelFind_Resize::run_test<Set>();
+        }
+    };
+
 } // namespace set
@@ -10,4 +10,10 @@ namespace set {
 
     CDSSTRESS_CuckooSet( Set_InsDelFind, run_test, size_t, size_t )
 
+    // stop-the-world vs incremental resizing
+    CDSSTRESS_CuckooSet_case( Set_InsDelFind_Resize, run_test, CuckooStripedSet_list_unord_stat,            size_t, size_t )
+    CDSSTRESS_CuckooSet_case( Set_InsDelFind_Resize, run_test, CuckooIncrementalSet_list_unord_stat,        size_t, size_t )
+    CDSSTRESS_CuckooSet_case( Set_InsDelFind_Resize, run_test, CuckooStripedSet_vector_ord_storehash,       size_t, size_t )
+    CDSSTRESS_CuckooSet_case( Set_InsDelFind_Resize, run_test, CuckooIncrementalSet_vector_ord_storehash,   size_t, size_t )
+
 } // namespace set
@@ -10,5 +10,11 @@ namespace set {
 
     CDSSTRESS_StripedSet( Set_InsDelFind_LF, run_test, size_t, size_t )
 
+    // stop-the-world vs incremental resizing
+    CDSSTRESS_StripedSet_case( Set_InsDelFind_Resize_LF, run_test, StripedSet_list,                 size_t, size_t )
+    CDSSTRESS_StripedSet_case( Set_InsDelFind_Resize_LF, run_test, StripedSet_incremental_list,     size_t, size_t )
+    CDSSTRESS_StripedSet_case( Set_InsDelFind_Resize_LF, run_test, StripedSet_rw_vector,            size_t, size_t )
+    CDSSTRESS_StripedSet_case( Set_InsDelFind_Resize_LF, run_test, StripedSet_rw_incremental_vector, size_t, size_t )
+
 } // namespace set
 
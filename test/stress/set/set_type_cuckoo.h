@@ -165,6 +165,15 @@ namespace set {
         typedef CuckooSet< key_val, traits_CuckooStripedSet<traits_CuckooSet_vector_ord_storehash>> CuckooStripedSet_vector_ord_storehash;
         typedef CuckooSet< key_val, traits_CuckooRefinableSet<traits_CuckooSet_vector_ord_storehash>> CuckooRefinableSet_vector_ord_storehash;
 
+        // Incremental resizing: the old buckets are moved to the new tables by the set operations
+        template <typename Traits>
+        struct traits_CuckooIncrementalSet : public traits_CuckooStripedSet<Traits>
+        {
+            static constexpr const size_t incremental_resizing = 4;
+        };
+        typedef CuckooSet< key_val, traits_CuckooIncrementalSet<traits_CuckooSet_list_unord_stat>> CuckooIncrementalSet_list_unord_stat;
+        typedef CuckooSet< key_val, traits_CuckooIncrementalSet<traits_CuckooSet_vector_ord_storehash>> CuckooIncrementalSet_vector_ord_storehash;
+
     };
 
     template <typename T, typename Traits >
@@ -214,6 +223,8 @@ namespace set {
     CDSSTRESS_CuckooSet_case( fixture, test_case, CuckooRefinableSet_vector_ord_stat,           key_type, value_type ) \
     CDSSTRESS_CuckooSet_case( fixture, test_case, CuckooStripedSet_vector_ord_storehash,        key_type, value_type ) \
     CDSSTRESS_CuckooSet_case( fixture, test_case, CuckooRefinableSet_vector_ord_storehash,      key_type, value_type ) \
+    CDSSTRESS_CuckooSet_case( fixture, test_case, CuckooIncrementalSet_list_unord_stat,         key_type, value_type ) \
+    CDSSTRESS_CuckooSet_case( fixture, test_case, CuckooIncrementalSet_vector_ord_storehash,    key_type, value_type ) \
 
 
 #endif // #ifndef CDSUNIT_SET_TYPE_CUCKOO_H
@@ -0,0 +1,122 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSUNIT_SET_TYPE_HOPSCOTCH_H
+#define CDSUNIT_SET_TYPE_HOPSCOTCH_H
+
+#include "set/set_type.h"
+
+#include <cds/container/hopscotch_set.h>
+#include <cds_test/stat_hopscotch_out.h>
+
+namespace set {
+
+    // InitialSize == 0: the set is sized for the test set size, otherwise it starts small and grows
+    template <typename V, typename Traits, size_t InitialSize = 0>
+    class HopscotchSet : public cc::HopscotchSet< V, Traits >
+    {
+    public:
+        typedef cc::HopscotchSet< V, Traits > hopscotch_base_class;
+
+    public:
+        template <typename Config>
+        HopscotchSet( Config const& cfg )
+            : hopscotch_base_class( InitialSize ? InitialSize : cfg.s_nSetSize )
+        {}
+
+        template <typename Q, typename Pred>
+        bool erase_with( Q const& key, Pred /*pred*/ )
+        {
+            return hopscotch_base_class::erase_with( key, typename Pred::equal_to());
+        }
+
+        // for testing
+        static constexpr bool const c_bExtractSupported = false;
+        static constexpr bool const c_bLoadFactorDepended = false;
+        static constexpr bool const c_bEraseExactKey = false;
+    };
+
+    struct tag_HopscotchSet;
+
+    template <typename Key, typename Val>
+    struct set_type< tag_HopscotchSet, Key, Val >: public set_type_base< Key, Val >
+    {
+        typedef set_type_base< Key, Val > base_class;
+        typedef typename base_class::key_val key_val;
+        typedef typename base_class::equal_to equal_to;
+        typedef typename base_class::less less;
+        typedef typename base_class::hash hash;
+
+        struct traits_HopscotchSet_equal:
+            public cc::hopscotch::make_traits<
+                co::hash< hash >
+                ,co::equal_to< equal_to >
+                ,co::item_counter< cds::atomicity::cache_friendly_item_counter >
+            >::type
+        {};
+        typedef HopscotchSet< key_val, traits_HopscotchSet_equal > HopscotchSet_equal;
+
+        struct traits_HopscotchSet_less:
+            public cc::hopscotch::make_traits<
+                co::hash< hash >
+                ,co::less< less >
+                ,co::item_counter< cds::atomicity::cache_friendly_item_counter >
+            >::type
+        {};
+        typedef HopscotchSet< key_val, traits_HopscotchSet_less > HopscotchSet_less;
+
+        struct traits_HopscotchSet_equal_stat: public traits_HopscotchSet_equal
+        {
+            typedef cc::hopscotch::stat<> stat;
+        };
+        typedef HopscotchSet< key_val, traits_HopscotchSet_equal_stat > HopscotchSet_equal_stat;
+
+        struct traits_HopscotchSet_H16_stat: public cc::hopscotch::neighbourhood< 16 >::pack< traits_HopscotchSet_equal_stat >
+        {};
+        typedef HopscotchSet< key_val, traits_HopscotchSet_H16_stat > HopscotchSet_H16_stat;
+
+        struct traits_HopscotchSet_spin_stat: public traits_HopscotchSet_equal_stat
+        {
+            typedef cds::sync::spin lock_type;
+        };
+        typedef HopscotchSet< key_val, traits_HopscotchSet_spin_stat > HopscotchSet_spin_stat;
+
+        // Starts from 1024 items, so the table grows while the test fills it
+        typedef HopscotchSet< key_val, traits_HopscotchSet_equal_stat, 1024 > HopscotchSet_equal_stat_grow;
+    };
+
+    template <typename T, typename Traits >
+    static inline void print_stat( cds_test::property_stream& o, cc::HopscotchSet< T, Traits > const& s )
+    {
+        o << s.statistics()
+          << std::make_pair( "bucket_count", s.bucket_count())
+          << std::make_pair( "lock_count", s.lock_count());
+    }
+
+    template <typename V, typename Traits, size_t InitialSize>
+    static inline void print_stat( cds_test::property_stream& o, HopscotchSet< V, Traits, InitialSize > const& s )
+    {
+        typedef HopscotchSet< V, Traits, InitialSize > set_type;
+        print_stat( o, static_cast<typename set_type::hopscotch_base_class const&>(s));
+    }
+
+} // namespace set
+
+#define CDSSTRESS_HopscotchSet_case( fixture, test_case, hopscotch_set_type, key_type, value_type ) \
+    TEST_F( fixture, hopscotch_set_type ) \
+    { \
+        typedef set::set_type< tag_HopscotchSet, key_type, value_type >::hopscotch_set_type set_type; \
+        test_case<set_type>(); \
+    }
+
+#define CDSSTRESS_HopscotchSet( fixture, test_case, key_type, value_type ) \
+    CDSSTRESS_HopscotchSet_case( fixture, test_case, HopscotchSet_equal,            key_type, value_type ) \
+    CDSSTRESS_HopscotchSet_case( fixture, test_case, HopscotchSet_less,             key_type, value_type ) \
+    CDSSTRESS_HopscotchSet_case( fixture, test_case, HopscotchSet_equal_stat,       key_type, value_type ) \
+    CDSSTRESS_HopscotchSet_case( fixture, test_case, HopscotchSet_H16_stat,         key_type, value_type ) \
+    CDSSTRESS_HopscotchSet_case( fixture, test_case, HopscotchSet_spin_stat,        key_type, value_type ) \
+    CDSSTRESS_HopscotchSet_case( fixture, test_case, HopscotchSet_equal_stat_grow,  key_type, value_type )
+
+#endif // #ifndef CDSUNIT_SET_TYPE_HOPSCOTCH_H
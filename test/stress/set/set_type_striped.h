@@ -218,6 +218,30 @@ namespace set {
             , co::less< less >
         > StripedSet_rational_vector;
 
+        // Reader-writer lock striping: find() locks the stripe in shared mode
+        typedef StripedHashSet_seq<
+            std::vector< key_val >
+            , co::hash< hash2 >
+            , co::less< less >
+            , co::mutex_policy< cc::striped_set::rw_striping<> >
+        > StripedSet_rw_vector;
+
+        // Incremental resizing: the old buckets are moved to the new table by the set operations
+        typedef StripedHashSet_seq<
+            std::list< key_val >
+            , co::hash< hash2 >
+            , co::less< less >
+            , cc::striped_set::incremental_resizing< 4 >
+        > StripedSet_incremental_list;
+
+        typedef StripedHashSet_seq<
+            std::vector< key_val >
+            , co::hash< hash2 >
+            , co::less< less >
+            , co::mutex_policy< cc::striped_set::rw_striping<> >
+            , cc::striped_set::incremental_resizing< 4 >
+        > StripedSet_rw_incremental_vector;
+
 #if BOOST_VERSION >= 104800
         typedef StripedHashSet_seq<
             boost::container::slist< key_val >
@@ -288,6 +312,18 @@ namespace set {
             , co::hash< hash2 >
         > StripedSet_rational_hashset;
 
+        typedef StripedHashSet_ord<
+            std::set< key_val, less >
+            , co::hash< hash2 >
+            , co::mutex_policy< cc::striped_set::rw_striping<> >
+        > StripedSet_rw_set;
+
+        typedef StripedHashSet_ord<
+            std::unordered_set< key_val, hash, equal_to >
+            , co::hash< hash2 >
+            , co::mutex_policy< cc::striped_set::rw_striping<> >
+        > StripedSet_rw_hashset;
+
 #if BOOST_VERSION >= 104800
         typedef StripedHashSet_ord<
             boost::container::set< key_val, less >
@@ -607,6 +643,11 @@ namespace set {
     CDSSTRESS_StripedSet_case( fixture, test_case, StripedSet_rational_set,         key_type, value_type ) \
     CDSSTRESS_StripedSet_case( fixture, test_case, StripedSet_hashset,              key_type, value_type ) \
     CDSSTRESS_StripedSet_case( fixture, test_case, StripedSet_rational_hashset,     key_type, value_type ) \
+    CDSSTRESS_StripedSet_case( fixture, test_case, StripedSet_rw_vector,            key_type, value_type ) \
+    CDSSTRESS_StripedSet_case( fixture, test_case, StripedSet_rw_set,               key_type, value_type ) \
+    CDSSTRESS_StripedSet_case( fixture, test_case, StripedSet_rw_hashset,           key_type, value_type ) \
+    CDSSTRESS_StripedSet_case( fixture, test_case, StripedSet_incremental_list,     key_type, value_type ) \
+    CDSSTRESS_StripedSet_case( fixture, test_case, StripedSet_rw_incremental_vector, key_type, value_type ) \
     CDSSTRESS_StripedSet_case( fixture, test_case, RefinableSet_list,               key_type, value_type ) \
     CDSSTRESS_StripedSet_case( fixture, test_case, RefinableSet_rational_list,      key_type, value_type ) \
     CDSSTRESS_StripedSet_case( fixture, test_case, RefinableSet_vector,             key_type, value_type ) \
@@ -308,6 +308,31 @@ namespace istack {
         typedef cds::intrusive::TreiberStack< custom_HP,    T, traits_Elimination_exp<custom_HP>    > Elimination_custom_HP_exp;
         typedef cds::intrusive::TreiberStack< cds::gc::DHP, T, traits_Elimination_exp<cds::gc::DHP> > Elimination_DHP_exp;
 
+        template <class GC> struct traits_Elimination_adaptive: public
+            cds::intrusive::treiber_stack::make_traits <
+                cds::intrusive::opt::hook< base_hook<GC> >
+                , cds::opt::enable_elimination<true>
+                , cds::intrusive::treiber_stack::adaptive_elimination<true>
+                , cds::opt::buffer< cds::opt::v::initialized_dynamic_buffer<int> >
+            > ::type
+        {};
+        typedef cds::intrusive::TreiberStack< cds::gc::HP,  T, traits_Elimination_adaptive<cds::gc::HP>  > Elimination_HP_adaptive;
+        typedef cds::intrusive::TreiberStack< custom_HP,    T, traits_Elimination_adaptive<custom_HP>    > Elimination_custom_HP_adaptive;
+        typedef cds::intrusive::TreiberStack< cds::gc::DHP, T, traits_Elimination_adaptive<cds::gc::DHP> > Elimination_DHP_adaptive;
+
+        template <class GC> struct traits_Elimination_adaptive_stat: public
+            cds::intrusive::treiber_stack::make_traits <
+                cds::intrusive::opt::hook< base_hook<GC> >
+                , cds::opt::enable_elimination<true>
+                , cds::intrusive::treiber_stack::adaptive_elimination<true>
+                , cds::opt::buffer< cds::opt::v::initialized_dynamic_buffer<int> >
+                , cds::opt::stat<cds::intrusive::treiber_stack::stat<> >
+            > ::type
+        {};
+        typedef cds::intrusive::TreiberStack< cds::gc::HP,  T, traits_Elimination_adaptive_stat<cds::gc::HP>  > Elimination_HP_adaptive_stat;
+        typedef cds::intrusive::TreiberStack< custom_HP,    T, traits_Elimination_adaptive_stat<custom_HP>    > Elimination_custom_HP_adaptive_stat;
+        typedef cds::intrusive::TreiberStack< cds::gc::DHP, T, traits_Elimination_adaptive_stat<cds::gc::DHP> > Elimination_DHP_adaptive_stat;
+
     // FCStack
         typedef cds::intrusive::FCStack< T > FCStack_slist;
 
@@ -392,7 +417,12 @@ namespace cds_test {
             << CDSSTRESS_STAT_OUT( s, m_PassivePopCollision )
             << CDSSTRESS_STAT_OUT( s, m_ActivePopCollision )
             << CDSSTRESS_STAT_OUT( s, m_PassivePushCollision )
-            << CDSSTRESS_STAT_OUT( s, m_EliminationFailed );
+            << CDSSTRESS_STAT_OUT( s, m_EliminationFailed )
+            << CDSSTRESS_STAT_OUT( s, m_EliminationSkipped )
+            << CDSSTRESS_STAT_OUT( s, m_EliminationExpand )
+            << CDSSTRESS_STAT_OUT( s, m_EliminationShrink )
+            << CDSSTRESS_STAT_OUT( s, m_PushChainCount )
+            << CDSSTRESS_STAT_OUT( s, m_PopAllCount );
     }
 
 
@@ -447,6 +477,8 @@ namespace cds_test {
     CDSSTRESS_Stack_F( test_fixture, Elimination_HP_stat ) \
     CDSSTRESS_Stack_F( test_fixture, Elimination_HP_dyn ) \
     CDSSTRESS_Stack_F( test_fixture, Elimination_HP_dyn_stat ) \
+    CDSSTRESS_Stack_F( test_fixture, Elimination_HP_adaptive ) \
+    CDSSTRESS_Stack_F( test_fixture, Elimination_HP_adaptive_stat ) \
 
 #define CDSSTRESS_EliminationStack_custom_HP( test_fixture ) \
     CDSSTRESS_Stack_F( test_fixture, Elimination_custom_HP ) \
@@ -461,6 +493,8 @@ namespace cds_test {
     CDSSTRESS_Stack_F( test_fixture, Elimination_custom_HP_stat ) \
     CDSSTRESS_Stack_F( test_fixture, Elimination_custom_HP_dyn ) \
     CDSSTRESS_Stack_F( test_fixture, Elimination_custom_HP_dyn_stat ) \
+    CDSSTRESS_Stack_F( test_fixture, Elimination_custom_HP_adaptive ) \
+    CDSSTRESS_Stack_F( test_fixture, Elimination_custom_HP_adaptive_stat ) \
 
 #define CDSSTRESS_EliminationStack_DHP( test_fixture ) \
     CDSSTRESS_Stack_F( test_fixture, Elimination_DHP ) \
@@ -475,7 +509,9 @@ namespace cds_test {
     CDSSTRESS_Stack_F( test_fixture, Elimination_DHP_exp ) \
     CDSSTRESS_Stack_F( test_fixture, Elimination_DHP_stat ) \
     CDSSTRESS_Stack_F( test_fixture, Elimination_DHP_dyn ) \
-    CDSSTRESS_Stack_F( test_fixture, Elimination_DHP_dyn_stat )
+    CDSSTRESS_Stack_F( test_fixture, Elimination_DHP_dyn_stat ) \
+    CDSSTRESS_Stack_F( test_fixture, Elimination_DHP_adaptive ) \
+    CDSSTRESS_Stack_F( test_fixture, Elimination_DHP_adaptive_stat )
 
 #define CDSSTRESS_FCStack_slist( test_fixture ) \
     CDSSTRESS_Stack_F( test_fixture, FCStack_slist ) \
@@ -123,6 +123,24 @@ namespace {
             check_elimination_stat( stack.statistics());
         }
 
+        // Timestamped stack: each producer has its own buffer
+        template <typename Stack>
+        void test_timestamped()
+        {
+            Stack stack( s_nThreadCount );
+            test( stack );
+            check_timestamped_stat( stack.statistics());
+        }
+
+        void check_timestamped_stat( cds::container::ts::empty_stat const& )
+        {}
+
+        void check_timestamped_stat( cds::container::ts::stat<> const& s )
+        {
+            EXPECT_EQ( s.m_nPush.get(), s.m_nPop.get());
+            EXPECT_EQ( s.m_nEliminated.get(), 0u );
+        }
+
         void check_elimination_stat( cds::container::treiber_stack::empty_stat const& )
         {}
 
@@ -177,6 +195,7 @@ namespace {
 
     CDSSTRESS_TreiberStack( stack_push )
     CDSSTRESS_EliminationStack( stack_push )
+    CDSSTRESS_TSStack( stack_push )
     CDSSTRESS_FCStack( stack_push )
     CDSSTRESS_FCDeque( stack_push )
     CDSSTRESS_StdStack( stack_push )
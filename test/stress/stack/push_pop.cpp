@@ -11,6 +11,8 @@ namespace {
     static size_t s_nPopThreadCount = 4;
     static size_t s_nStackSize = 1000000;
     static size_t s_nEliminationSize = 4;
+    static size_t s_nSweepMaxThreadCount = 8;
+    static size_t s_nChainSize = 16;
 
     static atomics::atomic<size_t>  s_nWorkingProducers( 0 );
 
@@ -141,6 +143,100 @@ namespace {
             size_t m_nDirtyPop;
         };
 
+        // Pushes the items by chains of s_nChainSize items
+        template <class Stack>
+        class ChainProducer: public Producer<Stack>
+        {
+            typedef Producer<Stack> base_class;
+
+        public:
+            ChainProducer( cds_test::thread_pool& pool, Stack& stack, size_t push_count )
+                : base_class( pool, stack, push_count )
+            {}
+
+            ChainProducer( ChainProducer& src )
+                : base_class( src )
+            {}
+
+            virtual cds_test::thread * clone()
+            {
+                return new ChainProducer( *this );
+            }
+
+            virtual void test()
+            {
+                memset( this->m_arrPush, 0, sizeof( this->m_arrPush ));
+
+                std::vector<value_type> chain;
+                chain.reserve( s_nChainSize );
+
+                value_type v;
+                v.nThread = this->id();
+                for ( size_t i = 0; i < this->m_nItemCount; ++i ) {
+                    v.nNo = i % c_nValArraySize;
+                    chain.push_back( v );
+                    if ( chain.size() == s_nChainSize || i + 1 == this->m_nItemCount ) {
+                        if ( this->m_stack.push_chain( chain.begin(), chain.end())) {
+                            for ( auto const& item : chain )
+                                ++this->m_arrPush[item.nNo];
+                        }
+                        else
+                            this->m_nPushError += chain.size();
+                        chain.clear();
+                    }
+                }
+
+                s_nWorkingProducers.fetch_sub( 1, atomics::memory_order_release );
+            }
+        };
+
+        // Pops the items one by one and by pop_all() in turn
+        template <class Stack>
+        class ChainConsumer: public Consumer<Stack>
+        {
+            typedef Consumer<Stack> base_class;
+
+        public:
+            ChainConsumer( cds_test::thread_pool& pool, Stack& stack )
+                : base_class( pool, stack )
+            {}
+
+            ChainConsumer( ChainConsumer& src )
+                : base_class( src )
+            {}
+
+            virtual cds_test::thread * clone()
+            {
+                return new ChainConsumer( *this );
+            }
+
+            virtual void test()
+            {
+                memset( this->m_arrPop, 0, sizeof( this->m_arrPop ));
+
+                auto count_item = [this]( value_type const& v ) {
+                    ++this->m_nPopCount;
+                    if ( v.nNo < sizeof( this->m_arrPop ) / sizeof( this->m_arrPop[0] ))
+                        ++this->m_arrPop[v.nNo];
+                    else
+                        ++this->m_nDirtyPop;
+                };
+
+                value_type v;
+                size_t nPass = 0;
+                while ( !( s_nWorkingProducers.load( atomics::memory_order_acquire ) == 0 && this->m_stack.empty())) {
+                    if ( ++nPass % 4 == 0 ) {
+                        if ( this->m_stack.pop_all( count_item ) == 0 )
+                            ++this->m_nPopEmpty;
+                    }
+                    else if ( this->m_stack.pop( v ))
+                        count_item( v );
+                    else
+                        ++this->m_nPopEmpty;
+                }
+            }
+        };
+
     protected:
         static void SetUpTestCase()
         {
@@ -150,11 +246,15 @@ namespace {
             s_nPopThreadCount  = cfg.get_size_t( "PopThreadCount",  s_nPopThreadCount );
             s_nStackSize       = cfg.get_size_t( "StackSize",       s_nStackSize );
             s_nEliminationSize = cfg.get_size_t( "EliminationSize", s_nEliminationSize );
+            s_nSweepMaxThreadCount = cfg.get_size_t( "SweepMaxThreadCount", s_nSweepMaxThreadCount );
+            s_nChainSize       = cfg.get_size_t( "ChainSize",       s_nChainSize );
 
             if ( s_nPushThreadCount == 0 )
                 s_nPushThreadCount = 1;
             if ( s_nPopThreadCount == 0 )
                 s_nPopThreadCount = 1;
+            if ( s_nChainSize == 0 )
+                s_nChainSize = 1;
         }
 
         //static void TearDownTestCase();
@@ -192,6 +292,106 @@ namespace {
             check_elimination_stat( stack.statistics());
         }
 
+        // The producers push by push_chain(), the consumers pop by pop() and pop_all()
+        template <typename Stack>
+        void test_chain( Stack& stack )
+        {
+            cds_test::thread_pool& pool = get_pool();
+            size_t const nPushCount = s_nStackSize / s_nPushThreadCount;
+
+            pool.add( new ChainProducer<Stack>( pool, stack, nPushCount ), s_nPushThreadCount );
+            pool.add( new ChainConsumer<Stack>( pool, stack ), s_nPopThreadCount );
+
+            s_nWorkingProducers.store( s_nPushThreadCount );
+            s_nStackSize = nPushCount * s_nPushThreadCount;
+
+            propout() << std::make_pair( "producer_thread_count", s_nPushThreadCount )
+                << std::make_pair( "consumer_thread_count", s_nPopThreadCount )
+                << std::make_pair( "push_count", s_nStackSize )
+                << std::make_pair( "chain_size", s_nChainSize );
+
+            std::chrono::milliseconds duration = pool.run();
+
+            propout() << std::make_pair( "duration", duration );
+
+            analyze( stack );
+
+            propout() << stack.statistics();
+            check_elimination_stat( stack.statistics());
+        }
+
+        // Thread count sweep: the stack is tested with 1, 2, 4, ... SweepMaxThreadCount producers and as many consumers
+        template <typename Stack>
+        void test_sweep()
+        {
+            size_t const nPushThreadCount = s_nPushThreadCount;
+            size_t const nPopThreadCount = s_nPopThreadCount;
+            size_t const nStackSize = s_nStackSize;
+
+            propout() << std::make_pair( "sweep_max_thread_count", s_nSweepMaxThreadCount )
+                << std::make_pair( "elimination_size", s_nEliminationSize );
+
+            for ( size_t nThreadCount = 1; nThreadCount <= s_nSweepMaxThreadCount; nThreadCount *= 2 ) {
+                s_nPushThreadCount = s_nPopThreadCount = nThreadCount;
+                s_nStackSize = nStackSize;
+
+                Stack stack( s_nEliminationSize );
+                cds_test::thread_pool& pool = get_pool();
+                size_t const nPushCount = s_nStackSize / s_nPushThreadCount;
+
+                pool.add( new Producer<Stack>( pool, stack, nPushCount ), s_nPushThreadCount );
+                pool.add( new Consumer<Stack>( pool, stack ), s_nPopThreadCount );
+
+                s_nWorkingProducers.store( s_nPushThreadCount );
+                s_nStackSize = nPushCount * s_nPushThreadCount;
+
+                std::chrono::milliseconds duration = pool.run();
+
+                std::string const prefix = "threads_" + std::to_string( nThreadCount ) + ".";
+                propout() << std::make_pair( prefix + "duration", duration.count())
+                    << std::make_pair( prefix + "ops_per_sec",
+                        duration.count() ? s_nStackSize * 2000 / static_cast<size_t>( duration.count()) : s_nStackSize * 2 );
+                sweep_stat( prefix, stack.statistics());
+
+                analyze( stack );
+                check_elimination_stat( stack.statistics());
+                pool.clear();
+            }
+
+            s_nPushThreadCount = nPushThreadCount;
+            s_nPopThreadCount = nPopThreadCount;
+            s_nStackSize = nStackSize;
+        }
+
+        void sweep_stat( std::string const&, cds::container::treiber_stack::empty_stat const& )
+        {}
+
+        void sweep_stat( std::string const& prefix, cds::container::treiber_stack::stat<> const& s )
+        {
+            propout() << std::make_pair( prefix + "elimination_collisions", s.m_ActivePushCollision.get() + s.m_ActivePopCollision.get())
+                << std::make_pair( prefix + "elimination_failed", s.m_EliminationFailed.get())
+                << std::make_pair( prefix + "elimination_skipped", s.m_EliminationSkipped.get());
+        }
+
+        // Timestamped stack: each producer and each consumer has its own buffer
+        template <typename Stack>
+        void test_timestamped()
+        {
+            Stack stack( s_nPushThreadCount + s_nPopThreadCount );
+            test( stack );
+            check_timestamped_stat( stack.statistics());
+        }
+
+        void check_timestamped_stat( cds::container::ts::empty_stat const& )
+        {}
+
+        void check_timestamped_stat( cds::container::ts::stat<> const& s )
+        {
+            EXPECT_EQ( s.m_nPush.get(), s_nStackSize );
+            EXPECT_EQ( s.m_nPop.get(), s_nStackSize );
+            EXPECT_LE( s.m_nEliminated.get(), s.m_nPop.get());
+        }
+
         void check_elimination_stat( cds::container::treiber_stack::empty_stat const& )
         {}
 
@@ -254,6 +454,9 @@ namespace {
 
     CDSSTRESS_TreiberStack( stack_push_pop )
     CDSSTRESS_EliminationStack( stack_push_pop )
+    CDSSTRESS_EliminationStack_Sweep( stack_push_pop )
+    CDSSTRESS_TreiberStack_Chain( stack_push_pop )
+    CDSSTRESS_TSStack( stack_push_pop )
     CDSSTRESS_FCStack( stack_push_pop )
     CDSSTRESS_FCDeque( stack_push_pop )
     CDSSTRESS_StdStack( stack_push_pop )
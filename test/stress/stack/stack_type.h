@@ -9,6 +9,7 @@
 #include <cds/container/treiber_stack.h>
 #include <cds/container/fcstack.h>
 #include <cds/container/fcdeque.h>
+#include <cds/container/ts_stack.h>
 
 #include <cds/gc/hp.h>
 #include <cds/gc/dhp.h>
@@ -303,6 +304,66 @@ namespace stack {
         typedef cds::container::TreiberStack< cds::gc::HP,  T, traits_Elimination_exp > Elimination_HP_exp;
         typedef cds::container::TreiberStack< cds::gc::DHP, T, traits_Elimination_exp > Elimination_DHP_exp;
 
+        struct traits_Elimination_adaptive: public
+            cds::container::treiber_stack::make_traits <
+                cds::opt::enable_elimination<true>
+                , cds::container::treiber_stack::adaptive_elimination<true>
+                , cds::opt::buffer< cds::opt::v::initialized_dynamic_buffer<int> >
+            > ::type
+        {};
+        typedef cds::container::TreiberStack< cds::gc::HP,  T, traits_Elimination_adaptive > Elimination_HP_adaptive;
+        typedef cds::container::TreiberStack< cds::gc::DHP, T, traits_Elimination_adaptive > Elimination_DHP_adaptive;
+
+        struct traits_Elimination_adaptive_stat: public
+            cds::container::treiber_stack::make_traits <
+                cds::opt::enable_elimination<true>
+                , cds::container::treiber_stack::adaptive_elimination<true>
+                , cds::opt::buffer< cds::opt::v::initialized_dynamic_buffer<int> >
+                , cds::opt::stat<cds::intrusive::treiber_stack::stat<> >
+            > ::type
+        {};
+        typedef cds::container::TreiberStack< cds::gc::HP,  T, traits_Elimination_adaptive_stat > Elimination_HP_adaptive_stat;
+        typedef cds::container::TreiberStack< cds::gc::DHP, T, traits_Elimination_adaptive_stat > Elimination_DHP_adaptive_stat;
+
+    // TSStack
+        typedef cds::container::TSStack< cds::gc::HP,  T > TSStack_HP;
+        typedef cds::container::TSStack< cds::gc::DHP, T > TSStack_DHP;
+
+        struct traits_TSStack_stat: public
+            cds::container::ts::make_traits <
+                cds::opt::stat< cds::container::ts::stat<> >
+            > ::type
+        {};
+        typedef cds::container::TSStack< cds::gc::HP,  T, traits_TSStack_stat > TSStack_HP_stat;
+        typedef cds::container::TSStack< cds::gc::DHP, T, traits_TSStack_stat > TSStack_DHP_stat;
+
+        struct traits_TSStack_atomic: public
+            cds::container::ts::make_traits <
+                cds::container::ts::timestamp< cds::container::ts::atomic_counter >
+                , cds::opt::stat< cds::container::ts::stat<> >
+            > ::type
+        {};
+        typedef cds::container::TSStack< cds::gc::HP,  T, traits_TSStack_atomic > TSStack_HP_atomic;
+        typedef cds::container::TSStack< cds::gc::DHP, T, traits_TSStack_atomic > TSStack_DHP_atomic;
+
+        struct traits_TSStack_hwcounter: public
+            cds::container::ts::make_traits <
+                cds::container::ts::timestamp< cds::container::ts::hardware_counter >
+                , cds::opt::back_off< cds::backoff::pause >
+            > ::type
+        {};
+        typedef cds::container::TSStack< cds::gc::HP,  T, traits_TSStack_hwcounter > TSStack_HP_hwcounter;
+        typedef cds::container::TSStack< cds::gc::DHP, T, traits_TSStack_hwcounter > TSStack_DHP_hwcounter;
+
+        struct traits_TSStack_interval_stat: public
+            cds::container::ts::make_traits <
+                cds::container::ts::timestamp< cds::container::ts::hardware_interval< 32 > >
+                , cds::opt::stat< cds::container::ts::stat<> >
+            > ::type
+        {};
+        typedef cds::container::TSStack< cds::gc::HP,  T, traits_TSStack_interval_stat > TSStack_HP_interval_stat;
+        typedef cds::container::TSStack< cds::gc::DHP, T, traits_TSStack_interval_stat > TSStack_DHP_interval_stat;
+
 
     // FCStack
         typedef cds::container::FCStack< T > FCStack_deque;
@@ -409,7 +470,28 @@ namespace cds_test {
             << CDSSTRESS_STAT_OUT( s, m_PassivePopCollision  )
             << CDSSTRESS_STAT_OUT( s, m_ActivePopCollision   )
             << CDSSTRESS_STAT_OUT( s, m_PassivePushCollision )
-            << CDSSTRESS_STAT_OUT( s, m_EliminationFailed    );
+            << CDSSTRESS_STAT_OUT( s, m_EliminationFailed    )
+            << CDSSTRESS_STAT_OUT( s, m_EliminationSkipped   )
+            << CDSSTRESS_STAT_OUT( s, m_EliminationExpand    )
+            << CDSSTRESS_STAT_OUT( s, m_EliminationShrink    )
+            << CDSSTRESS_STAT_OUT( s, m_PushChainCount       )
+            << CDSSTRESS_STAT_OUT( s, m_PopAllCount          );
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::ts::empty_stat const& )
+    {
+        return o;
+    }
+
+    static inline property_stream& operator <<( property_stream& o, cds::container::ts::stat<> const& s )
+    {
+        return o
+            << CDSSTRESS_STAT_OUT( s, m_nPush )
+            << CDSSTRESS_STAT_OUT( s, m_nPushRace )
+            << CDSSTRESS_STAT_OUT( s, m_nPop )
+            << CDSSTRESS_STAT_OUT( s, m_nPopEmpty )
+            << CDSSTRESS_STAT_OUT( s, m_nPopRetry )
+            << CDSSTRESS_STAT_OUT( s, m_nEliminated );
     }
 
     static inline property_stream& operator <<( property_stream& o, cds::container::fcstack::empty_stat const& /*s*/ )
@@ -465,6 +547,26 @@ namespace cds_test {
         test_elimination( stack ); \
     }
 
+#define CDSSTRESS_EliminationStack_Sweep_F( test_fixture, type_name ) \
+    TEST_F( test_fixture, type_name##_sweep ) \
+    { \
+        test_sweep< stack::Types< value_type >::type_name >(); \
+    }
+
+#define CDSSTRESS_TreiberStack_Chain_F( test_fixture, type_name ) \
+    TEST_F( test_fixture, type_name##_chain ) \
+    { \
+        typedef stack::Types< value_type >::type_name stack_type; \
+        stack_type stack( s_nEliminationSize ); \
+        test_chain( stack ); \
+    }
+
+#define CDSSTRESS_TSStack_F( test_fixture, type_name ) \
+    TEST_F( test_fixture, type_name ) \
+    { \
+        test_timestamped< stack::Types< value_type >::type_name >(); \
+    }
+
 #define CDSSTRESS_TreiberStack( test_fixture ) \
     CDSSTRESS_Stack_F( test_fixture, Treiber_HP )        \
     CDSSTRESS_Stack_F( test_fixture, Treiber_HP_seqcst ) \
@@ -490,6 +592,8 @@ namespace cds_test {
     CDSSTRESS_EliminationStack_F( test_fixture, Elimination_HP_stat   ) \
     CDSSTRESS_EliminationStack_F( test_fixture, Elimination_HP_dyn    ) \
     CDSSTRESS_EliminationStack_F( test_fixture, Elimination_HP_dyn_stat) \
+    CDSSTRESS_EliminationStack_F( test_fixture, Elimination_HP_adaptive ) \
+    CDSSTRESS_EliminationStack_F( test_fixture, Elimination_HP_adaptive_stat ) \
     CDSSTRESS_EliminationStack_F( test_fixture, Elimination_DHP       ) \
     CDSSTRESS_EliminationStack_F( test_fixture, Elimination_DHP_2ms    ) \
     CDSSTRESS_EliminationStack_F( test_fixture, Elimination_DHP_2ms_stat) \
@@ -501,7 +605,35 @@ namespace cds_test {
     CDSSTRESS_EliminationStack_F( test_fixture, Elimination_DHP_exp   ) \
     CDSSTRESS_EliminationStack_F( test_fixture, Elimination_DHP_stat  ) \
     CDSSTRESS_EliminationStack_F( test_fixture, Elimination_DHP_dyn   ) \
-    CDSSTRESS_EliminationStack_F( test_fixture, Elimination_DHP_dyn_stat)
+    CDSSTRESS_EliminationStack_F( test_fixture, Elimination_DHP_dyn_stat) \
+    CDSSTRESS_EliminationStack_F( test_fixture, Elimination_DHP_adaptive ) \
+    CDSSTRESS_EliminationStack_F( test_fixture, Elimination_DHP_adaptive_stat )
+
+#define CDSSTRESS_EliminationStack_Sweep( test_fixture ) \
+    CDSSTRESS_EliminationStack_Sweep_F( test_fixture, Elimination_HP_dyn_stat ) \
+    CDSSTRESS_EliminationStack_Sweep_F( test_fixture, Elimination_HP_adaptive_stat ) \
+    CDSSTRESS_EliminationStack_Sweep_F( test_fixture, Elimination_DHP_dyn_stat ) \
+    CDSSTRESS_EliminationStack_Sweep_F( test_fixture, Elimination_DHP_adaptive_stat )
+
+#define CDSSTRESS_TreiberStack_Chain( test_fixture ) \
+    CDSSTRESS_TreiberStack_Chain_F( test_fixture, Treiber_HP_stat ) \
+    CDSSTRESS_TreiberStack_Chain_F( test_fixture, Treiber_DHP_stat ) \
+    CDSSTRESS_TreiberStack_Chain_F( test_fixture, Elimination_HP_dyn_stat ) \
+    CDSSTRESS_TreiberStack_Chain_F( test_fixture, Elimination_HP_adaptive_stat ) \
+    CDSSTRESS_TreiberStack_Chain_F( test_fixture, Elimination_DHP_dyn_stat ) \
+    CDSSTRESS_TreiberStack_Chain_F( test_fixture, Elimination_DHP_adaptive_stat )
+
+#define CDSSTRESS_TSStack( test_fixture ) \
+    CDSSTRESS_TSStack_F( test_fixture, TSStack_HP ) \
+    CDSSTRESS_TSStack_F( test_fixture, TSStack_HP_stat ) \
+    CDSSTRESS_TSStack_F( test_fixture, TSStack_HP_atomic ) \
+    CDSSTRESS_TSStack_F( test_fixture, TSStack_HP_hwcounter ) \
+    CDSSTRESS_TSStack_F( test_fixture, TSStack_HP_interval_stat ) \
+    CDSSTRESS_TSStack_F( test_fixture, TSStack_DHP ) \
+    CDSSTRESS_TSStack_F( test_fixture, TSStack_DHP_stat ) \
+    CDSSTRESS_TSStack_F( test_fixture, TSStack_DHP_atomic ) \
+    CDSSTRESS_TSStack_F( test_fixture, TSStack_DHP_hwcounter ) \
+    CDSSTRESS_TSStack_F( test_fixture, TSStack_DHP_interval_stat )
 
 #define CDSSTRESS_FCStack( test_fixture ) \
     CDSSTRESS_Stack_F( test_fixture, FCStack_deque ) \
@@ -0,0 +1,96 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSUNIT_DEQUE_TEST_WORK_STEALING_DEQUE_H
+#define CDSUNIT_DEQUE_TEST_WORK_STEALING_DEQUE_H
+
+#include <cds_test/ext_gtest.h>
+#include <cds/container/work_stealing_deque.h>
+
+namespace cds_test {
+
+    class WorkStealingDeque : public ::testing::Test
+    {
+    protected:
+        template <class Deque>
+        void test( Deque& dq )
+        {
+            typedef typename Deque::value_type value_type;
+
+            size_t const c_nSize = dq.capacity() * 4 + 3;
+            value_type val;
+
+            ASSERT_TRUE( dq.empty());
+            ASSERT_EQ( dq.size(), 0u );
+            ASSERT_FALSE( dq.pop( val ));
+            ASSERT_FALSE( dq.steal( val ));
+
+            // push/pop: LIFO
+            for ( size_t i = 0; i < c_nSize; ++i )
+                ASSERT_TRUE( dq.push( static_cast<value_type>( i )));
+            ASSERT_FALSE( dq.empty());
+            ASSERT_EQ( dq.size(), c_nSize );
+            ASSERT_GE( dq.capacity(), c_nSize );
+
+            for ( size_t i = c_nSize; i > 0; --i ) {
+                ASSERT_TRUE( dq.pop( val ));
+                ASSERT_EQ( val, static_cast<value_type>( i - 1 ));
+            }
+            ASSERT_TRUE( dq.empty());
+            ASSERT_FALSE( dq.pop( val ));
+
+            // push/steal: FIFO
+            for ( size_t i = 0; i < c_nSize; ++i )
+                ASSERT_TRUE( dq.push( static_cast<value_type>( i )));
+            ASSERT_EQ( dq.size(), c_nSize );
+
+            for ( size_t i = 0; i < c_nSize; ++i ) {
+                ASSERT_TRUE( dq.steal( val ));
+                ASSERT_EQ( val, static_cast<value_type>( i ));
+            }
+            ASSERT_TRUE( dq.empty());
+            ASSERT_FALSE( dq.steal( val ));
+
+            // mixed: pop from the bottom, steal from the top
+            for ( size_t i = 0; i < c_nSize; ++i )
+                ASSERT_TRUE( dq.push( static_cast<value_type>( i )));
+
+            size_t nTop = 0;
+            size_t nBottom = c_nSize;
+            while ( nTop < nBottom ) {
+                if ( ( nTop + nBottom ) & 1 ) {
+                    ASSERT_TRUE( dq.steal( val ));
+                    ASSERT_EQ( val, static_cast<value_type>( nTop ));
+                    ++nTop;
+                }
+                else {
+                    ASSERT_TRUE( dq.pop( val ));
+                    ASSERT_EQ( val, static_cast<value_type>( nBottom - 1 ));
+                    --nBottom;
+                }
+                ASSERT_EQ( dq.size(), nBottom - nTop );
+            }
+            ASSERT_TRUE( dq.empty());
+            ASSERT_FALSE( dq.pop( val ));
+            ASSERT_FALSE( dq.steal( val ));
+
+            // wrap-around without growing
+            size_t const nCapacity = dq.capacity();
+            for ( size_t pass = 0; pass < 3; ++pass ) {
+                for ( size_t i = 0; i < nCapacity - 1; ++i )
+                    ASSERT_TRUE( dq.push( static_cast<value_type>( i )));
+                for ( size_t i = 0; i < nCapacity - 1; ++i ) {
+                    ASSERT_TRUE( dq.steal( val ));
+                    ASSERT_EQ( val, static_cast<value_type>( i ));
+                }
+            }
+            ASSERT_EQ( dq.capacity(), nCapacity );
+            ASSERT_TRUE( dq.empty());
+        }
+    };
+
+} // namespace cds_test
+
+#endif // CDSUNIT_DEQUE_TEST_WORK_STEALING_DEQUE_H
@@ -0,0 +1,66 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSUNIT_DEQUE_TEST_WORK_STEALING_DEQUE_RCU_H
+#define CDSUNIT_DEQUE_TEST_WORK_STEALING_DEQUE_RCU_H
+
+#include "test_work_stealing_deque.h"
+#include <cds/container/work_stealing_deque_rcu.h>
+
+namespace cc = cds::container;
+
+template <class RCU>
+class WorkStealingDeque: public cds_test::WorkStealingDeque
+{
+public:
+    typedef cds::urcu::gc<RCU> rcu_type;
+
+protected:
+    void SetUp()
+    {
+        RCU::Construct();
+        cds::threading::Manager::attachThread();
+    }
+
+    void TearDown()
+    {
+        cds::threading::Manager::detachThread();
+        RCU::Destruct();
+    }
+};
+
+TYPED_TEST_CASE_P( WorkStealingDeque );
+
+TYPED_TEST_P( WorkStealingDeque, defaulted )
+{
+    typedef cc::WorkStealingDeque< typename TestFixture::rcu_type, int > deque_type;
+
+    deque_type dq;
+    this->test( dq );
+}
+
+TYPED_TEST_P( WorkStealingDeque, stat )
+{
+    typedef cc::WorkStealingDeque< typename TestFixture::rcu_type, unsigned,
+        typename cc::work_stealing_deque::make_traits<
+            cds::opt::stat< cc::work_stealing_deque::stat<>>
+            , cds::opt::back_off< cds::backoff::yield >
+        >::type
+    > deque_type;
+
+    deque_type dq( 4 );
+    this->test( dq );
+
+    EXPECT_GT( dq.statistics().m_nGrow.get(), 0u );
+    EXPECT_EQ( dq.statistics().m_nPush.get(), dq.statistics().m_nPop.get() + dq.statistics().m_nSteal.get());
+}
+
+// GCC 5: All test names should be written on single line, otherwise a runtime error will be encountered like as
+// "No test named <test_name> can be found in this test case"
+REGISTER_TYPED_TEST_CASE_P( WorkStealingDeque,
+    defaulted, stat
+);
+
+#endif // CDSUNIT_DEQUE_TEST_WORK_STEALING_DEQUE_RCU_H
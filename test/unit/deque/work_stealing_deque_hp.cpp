@@ -0,0 +1,84 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_work_stealing_deque.h"
+
+#include <cds/gc/hp.h>
+
+namespace {
+
+    namespace cc = cds::container;
+    typedef cds::gc::HP gc_type;
+
+    class WorkStealingDeque_HP : public cds_test::WorkStealingDeque
+    {
+    protected:
+        void SetUp()
+        {
+            typedef cc::WorkStealingDeque< gc_type, int > deque_type;
+
+            cds::gc::hp::GarbageCollector::Construct( deque_type::c_nHazardPtrCount, 1, 16 );
+            cds::threading::Manager::attachThread();
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            cds::gc::hp::GarbageCollector::Destruct( true );
+        }
+    };
+
+    TEST_F( WorkStealingDeque_HP, defaulted )
+    {
+        typedef cc::WorkStealingDeque< gc_type, int > deque_type;
+
+        deque_type dq;
+        test( dq );
+    }
+
+    TEST_F( WorkStealingDeque_HP, small_capacity )
+    {
+        typedef cc::WorkStealingDeque< gc_type, size_t > deque_type;
+
+        deque_type dq( 2 );
+        EXPECT_EQ( dq.capacity(), 2u );
+        test( dq );
+    }
+
+    TEST_F( WorkStealingDeque_HP, stat )
+    {
+        struct traits: public cc::work_stealing_deque::traits
+        {
+            typedef cc::work_stealing_deque::stat<> stat;
+            typedef cds::backoff::yield back_off;
+        };
+        typedef cc::WorkStealingDeque< gc_type, unsigned, traits > deque_type;
+
+        deque_type dq( 16 );
+        test( dq );
+
+        deque_type::stat const& s = dq.statistics();
+        EXPECT_GT( s.m_nGrow.get(), 0u );
+        EXPECT_EQ( s.m_nPush.get(), s.m_nPop.get() + s.m_nSteal.get());
+        EXPECT_GT( s.m_nPopEmpty.get(), 0u );
+        EXPECT_GT( s.m_nStealEmpty.get(), 0u );
+        EXPECT_EQ( s.m_nStealRace.get(), 0u );
+    }
+
+    TEST_F( WorkStealingDeque_HP, make_traits )
+    {
+        typedef cc::WorkStealingDeque< gc_type, int,
+            cc::work_stealing_deque::make_traits<
+                cds::opt::stat< cc::work_stealing_deque::stat<>>
+                , cds::opt::padding< cds::opt::no_special_padding >
+            >::type
+        > deque_type;
+
+        deque_type dq( 10 );
+        EXPECT_EQ( dq.capacity(), 16u );
+        test( dq );
+    }
+
+} // namespace
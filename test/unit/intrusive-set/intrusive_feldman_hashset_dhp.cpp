@@ -25,6 +25,7 @@ namespace {
                     ci::feldman_hashset::hash_accessor< hash_accessor >
                     ,ci::opt::less< std::less<int>>
                     ,ci::opt::disposer<mock_disposer>
+                    ,ci::feldman_hashset::compaction< true >
                 >::type
             > set_type;
 
@@ -175,4 +176,38 @@ namespace {
         test( s );
     }
 
+    TEST_F( IntrusiveFeldmanHashSet_DHP, compaction )
+    {
+        typedef ci::FeldmanHashSet< gc_type, int_item,
+            typename ci::feldman_hashset::make_traits<
+                ci::feldman_hashset::hash_accessor< hash_accessor >
+                , ci::opt::less< std::less<int>>
+                , ci::opt::disposer<mock_disposer>
+                , ci::feldman_hashset::compaction< true >
+            >::type
+        > set_type;
+
+        set_type s( 5, 2 );
+        test( s );
+        test_compaction( s );
+    }
+
+    TEST_F( IntrusiveFeldmanHashSet_DHP, compaction_stat )
+    {
+        typedef ci::FeldmanHashSet< gc_type, int_item,
+            typename ci::feldman_hashset::make_traits<
+                ci::feldman_hashset::hash_accessor< hash_accessor >
+                , ci::opt::compare< cmp >
+                , ci::opt::disposer<mock_disposer>
+                , ci::feldman_hashset::compaction< true >
+                , ci::opt::stat< ci::feldman_hashset::stat<>>
+            >::type
+        > set_type;
+
+        set_type s( 4, 3 );
+        test_compaction( s );
+        EXPECT_GT( s.statistics().m_nCompactNodeSuccess.get(), 0u );
+        test( s );
+    }
+
 } // namespace
@@ -383,4 +383,68 @@ namespace {
         test( s );
     }
 
+    TEST_F( IntrusiveSplitListLazySet_HP, base_shrink )
+    {
+        typedef ci::LazyList< gc_type
+            , base_item_type
+            ,ci::lazy_list::make_traits<
+                ci::opt::hook< ci::lazy_list::base_hook< ci::opt::gc< gc_type > > >
+                ,ci::opt::compare< cmp<base_item_type> >
+                ,ci::opt::disposer< mock_disposer >
+            >::type
+        > bucket_type;
+
+        typedef ci::SplitListSet< gc_type, bucket_type,
+            ci::split_list::make_traits<
+                ci::opt::hash< hash_int >
+                , ci::split_list::shrink_factor< 4 >
+                , ci::opt::stat< ci::split_list::stat<> >
+            >::type
+        > set_type;
+
+        // the capacity of bucket table is enough for kSize * 10 items
+        set_type s( kSize * 10, 1 );
+        test( s );
+        EXPECT_GT( s.statistics().m_nBucketTableShrink.get(), 0u );
+
+        std::vector< base_item_type > data;
+        for ( int i = 0; i < static_cast<int>( kSize * 10 ); ++i )
+            data.push_back( base_item_type( i ));
+
+        // grow the table
+        for ( auto& i : data )
+            ASSERT_TRUE( s.insert( i ));
+        size_t const nBucketCount = s.bucket_count();
+        EXPECT_GE( nBucketCount, kSize * 5 );
+
+        // erase most of the items: the table should shrink
+        for ( auto& i : data ) {
+            if ( i.key() >= 10 )
+                ASSERT_TRUE( s.erase( i.key()));
+        }
+        EXPECT_EQ( s.size(), 10u );
+        EXPECT_LE( s.bucket_count(), 64u );
+        for ( auto& i : data )
+            EXPECT_EQ( s.contains( i.key()), i.key() < 10 );
+
+        // reclaim all aux nodes of removed buckets
+        gc_type::force_dispose();
+        s.shrink();
+        EXPECT_GT( s.statistics().m_nAuxNodeRetired.get(), 0u );
+        EXPECT_EQ( s.statistics().m_nAuxNodeUnlinked.get(), s.statistics().m_nAuxNodeRetired.get());
+
+        // grow again
+        for ( auto& i : data ) {
+            if ( i.key() >= 10 )
+                ASSERT_TRUE( s.insert( i ));
+        }
+        EXPECT_EQ( s.bucket_count(), nBucketCount );
+        for ( auto& i : data )
+            EXPECT_TRUE( s.contains( i.key()));
+
+        s.clear();
+        EXPECT_TRUE( s.empty());
+        gc_type::force_dispose();
+    }
+
 } // namespace
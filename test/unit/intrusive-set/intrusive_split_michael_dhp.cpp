@@ -396,4 +396,29 @@ namespace {
         test( s );
     }
 
+    TEST_F( IntrusiveSplitListSet_DHP, base_shrink )
+    {
+        typedef ci::MichaelList< gc_type
+            , base_item_type
+            ,ci::michael_list::make_traits<
+                ci::opt::hook< ci::michael_list::base_hook< ci::opt::gc< gc_type > > >
+                ,ci::opt::compare< cmp<base_item_type> >
+                ,ci::opt::disposer< mock_disposer >
+            >::type
+        > bucket_type;
+
+        typedef ci::SplitListSet< gc_type, bucket_type,
+            ci::split_list::make_traits<
+                ci::opt::hash< hash_int >
+                , ci::split_list::shrink_factor< 4 >
+                , ci::opt::stat< ci::split_list::stat<> >
+            >::type
+        > set_type;
+
+        set_type s( kSize, 1 );
+        test( s );
+        EXPECT_GT( s.statistics().m_nBucketTableShrink.get(), 0u );
+        EXPECT_LE( s.bucket_count(), 4u );
+    }
+
 } // namespace
@@ -344,6 +344,82 @@ namespace cds_test {
                 EXPECT_EQ( i.nDisposeCount, 1u );
             }
         }
+
+        template <class Set>
+        void test_compaction( Set& s )
+        {
+            // Precondition: set is empty, array node compaction is enabled
+            // Postcondition: set is empty
+
+            ASSERT_TRUE( s.empty());
+            size_t const nSetSize = s.head_size() * 16;
+
+            typedef typename Set::value_type value_type;
+
+            std::vector< value_type > data;
+            std::vector< size_t> indices;
+            data.reserve( nSetSize );
+            indices.reserve( nSetSize );
+            for ( size_t key = 0; key < nSetSize; ++key ) {
+                data.push_back( value_type( static_cast<int>( key )));
+                indices.push_back( key );
+            }
+
+            auto check_compacted = [&s]() {
+                std::vector< typename Set::level_statistics > level_stat;
+                s.get_level_statistics( level_stat );
+                ASSERT_EQ( level_stat.size(), 1u );
+                EXPECT_EQ( level_stat[0].array_node_count, 1u );
+                EXPECT_EQ( level_stat[0].array_cell_count, 0u );
+                EXPECT_EQ( level_stat[0].data_cell_count, 0u );
+            };
+
+            for ( int pass = 0; pass < 2; ++pass ) {
+                shuffle( indices.begin(), indices.end());
+                for ( auto idx : indices )
+                    ASSERT_TRUE( s.insert( data[idx] ));
+                ASSERT_CONTAINER_SIZE( s, nSetSize );
+
+                {
+                    std::vector< typename Set::level_statistics > level_stat;
+                    s.get_level_statistics( level_stat );
+                    EXPECT_GT( level_stat.size(), 1u );
+                }
+
+                if ( pass == 0 ) {
+                    // erase half of the items: the set must be consistent after partial compaction
+                    shuffle( indices.begin(), indices.end());
+                    for ( size_t i = 0; i < nSetSize / 2; ++i )
+                        ASSERT_TRUE( s.erase( data[indices[i]].nKey ));
+                    for ( size_t i = 0; i < nSetSize / 2; ++i )
+                        ASSERT_FALSE( s.contains( data[indices[i]].nKey ));
+                    for ( size_t i = nSetSize / 2; i < nSetSize; ++i )
+                        ASSERT_TRUE( s.contains( data[indices[i]].nKey ));
+
+                    size_t nCount = 0;
+                    for ( auto it = s.begin(); it != s.end(); ++it )
+                        ++nCount;
+                    EXPECT_EQ( nCount, nSetSize - nSetSize / 2 );
+
+                    for ( size_t i = nSetSize / 2; i < nSetSize; ++i )
+                        ASSERT_TRUE( s.erase( data[indices[i]].nKey ));
+                }
+                else
+                    s.clear();
+
+                ASSERT_TRUE( s.empty());
+                ASSERT_CONTAINER_SIZE( s, 0u );
+                ASSERT_TRUE( s.begin() == s.end());
+                check_compacted();
+
+                // the items are reinserted in the next pass, so they must not be in the retired list
+                Set::gc::force_dispose();
+            }
+
+            for ( auto& i : data ) {
+                EXPECT_EQ( i.nDisposeCount, 2u );
+            }
+        }
     };
 
 } // namespace cds_test
@@ -253,10 +253,28 @@ TYPED_TEST_P( IntrusiveFeldmanHashSet, byte_cut_explicit_hash_size )
     this->test( s );
 }
 
+TYPED_TEST_P( IntrusiveFeldmanHashSet, compaction )
+{
+    typedef ci::FeldmanHashSet< typename TestFixture::rcu_type, typename TestFixture::int_item,
+        typename ci::feldman_hashset::make_traits<
+            ci::feldman_hashset::hash_accessor< typename TestFixture::hash_accessor >
+            , ci::opt::less< std::less<int>>
+            , ci::opt::disposer< typename TestFixture::mock_disposer >
+            , ci::feldman_hashset::compaction< true >
+            , ci::opt::stat< ci::feldman_hashset::stat<>>
+        >::type
+    > set_type;
+
+    set_type s( 5, 2 );
+    this->test( s );
+    this->test_compaction( s );
+    EXPECT_GT( s.statistics().m_nCompactNodeSuccess.get(), 0u );
+}
+
 // GCC 5: All test names should be written on single line, otherwise a runtime error will be encountered like as
 // "No test named <test_name> can be found in this test case"
 REGISTER_TYPED_TEST_CASE_P( IntrusiveFeldmanHashSet,
-    compare, less, cmpmix, backoff, stat, explicit_hash_size, byte_cut, byte_cut_explicit_hash_size
+    compare, less, cmpmix, backoff, stat, explicit_hash_size, byte_cut, byte_cut_explicit_hash_size, compaction
     );
 
 
@@ -471,8 +471,35 @@ TYPED_TEST_P( IntrusiveSplitMichaelSet, member_free_list )
 
 // GCC 5: All test names should be written on single line, otherwise a runtime error will be encountered like as
 // "No test named <test_name> can be found in this test case"
+TYPED_TEST_P( IntrusiveSplitMichaelSet, with_hash )
+{
+    typedef typename TestFixture::rcu_type rcu_type;
+    typedef typename TestFixture::base_item_type base_item_type;
+    typedef typename TestFixture::mock_disposer mock_disposer;
+    typedef typename TestFixture::template cmp<base_item_type> item_cmp;
+    typedef typename TestFixture::hash_int hash_int;
+
+    typedef ci::MichaelList< rcu_type
+        , base_item_type
+        , typename ci::michael_list::make_traits<
+            ci::opt::hook< ci::michael_list::base_hook< ci::opt::gc< rcu_type > > >
+            , ci::opt::compare< item_cmp >
+            , ci::opt::disposer< mock_disposer >
+        >::type
+    > bucket_type;
+
+    typedef ci::SplitListSet< rcu_type, bucket_type,
+        typename ci::split_list::make_traits<
+            ci::opt::hash< hash_int >
+        >::type
+    > set_type;
+
+    set_type s( TestFixture::kSize, 2 );
+    this->test_with_hash( s );
+}
+
 REGISTER_TYPED_TEST_CASE_P( IntrusiveSplitMichaelSet,
-    base_cmp, base_less, base_cmpmix, base_static_bucket_table, base_static_bucket_table_free_list, base_free_list, base_bit_reverse_swar, base_bit_reverse_lookup, base_bit_reverse_muldiv, member_cmp, member_less, member_cmpmix, member_static_bucket_table, member_static_bucket_table_free_list, member_free_list
+    base_cmp, base_less, base_cmpmix, base_static_bucket_table, base_static_bucket_table_free_list, base_free_list, base_bit_reverse_swar, base_bit_reverse_lookup, base_bit_reverse_muldiv, member_cmp, member_less, member_cmpmix, member_static_bucket_table, member_static_bucket_table_free_list, member_free_list, with_hash
 );
 
 
@@ -18,7 +18,11 @@ namespace {
 
         void SetUp()
         {
-            typedef cc::FeldmanHashMap< gc_type, key_type, value_type > map_type;
+            typedef cc::FeldmanHashMap< gc_type, key_type, value_type,
+                typename cc::feldman_hashmap::make_traits<
+                    cc::feldman_hashmap::compaction< true >
+                >::type
+            > map_type;
 
             cds::gc::dhp::smr::construct( map_type::c_nHazardPtrCount );
             cds::threading::Manager::attachThread();
@@ -157,4 +161,30 @@ namespace {
         test( m );
     }
 
+    TEST_F( FeldmanHashMap_DHP, compaction )
+    {
+        typedef cc::FeldmanHashMap< gc_type, key_type, value_type,
+            typename cc::feldman_hashmap::make_traits<
+                cc::feldman_hashmap::compaction< true >
+                , cds::opt::stat< cc::feldman_hashmap::stat<>>
+            >::type
+        > map_type;
+
+        map_type m( 4, 2 );
+        test( m );
+        EXPECT_GT( m.statistics().m_nCompactNodeSuccess.get(), 0u );
+    }
+
+    TEST_F( FeldmanHashMap_DHP, find_batch_compaction )
+    {
+        typedef cc::FeldmanHashMap< gc_type, key_type, value_type,
+            typename cc::feldman_hashmap::make_traits<
+                cc::feldman_hashmap::compaction< true >
+            >::type
+        > map_type;
+
+        map_type m( 4, 2 );
+        test_find_batch( m, kSize );
+    }
+
 } // namespace
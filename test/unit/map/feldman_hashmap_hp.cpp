@@ -18,7 +18,11 @@ namespace {
 
         void SetUp()
         {
-            typedef cc::FeldmanHashMap< gc_type, key_type, value_type > map_type;
+            typedef cc::FeldmanHashMap< gc_type, key_type, value_type,
+                typename cc::feldman_hashmap::make_traits<
+                    cc::feldman_hashmap::compaction< true >
+                >::type
+            > map_type;
 
             // +1 - for guarded_ptr
             cds::gc::hp::GarbageCollector::Construct( map_type::c_nHazardPtrCount + 1, 1, 16 );
@@ -168,4 +172,54 @@ namespace {
         test( m );
     }
 
+    TEST_F( FeldmanHashMap_HP, compaction )
+    {
+        typedef cc::FeldmanHashMap< gc_type, key_type, value_type,
+            typename cc::feldman_hashmap::make_traits<
+                cc::feldman_hashmap::compaction< true >
+                , cds::opt::stat< cc::feldman_hashmap::stat<>>
+            >::type
+        > map_type;
+
+        map_type m( 4, 2 );
+        test( m );
+        EXPECT_GT( m.statistics().m_nCompactNodeSuccess.get(), 0u );
+    }
+
+    TEST_F( FeldmanHashMap_HP, find_batch_compaction )
+    {
+        typedef cc::FeldmanHashMap< gc_type, key_type, value_type,
+            typename cc::feldman_hashmap::make_traits<
+                cc::feldman_hashmap::compaction< true >
+            >::type
+        > map_type;
+
+        map_type m( 4, 2 );
+        test_find_batch( m, kSize );
+    }
+
+    TEST_F( FeldmanHashMap_HP, find_batch )
+    {
+        typedef cc::FeldmanHashMap< gc_type, key_type, value_type,
+            typename cc::feldman_hashmap::make_traits<
+                cds::opt::compare< cmp >
+            >::type
+        > map_type;
+
+        map_type m( 4, 2 );
+        test_find_batch( m, kSize );
+    }
+
+    TEST_F( FeldmanHashMap_HP, with_hash )
+    {
+        typedef cc::FeldmanHashMap< gc_type, key_type, value_type,
+            typename cc::feldman_hashmap::make_traits<
+                cds::opt::compare< cmp >
+            >::type
+        > map_type;
+
+        map_type m( 4, 5 );
+        test_with_hash( m );
+    }
+
 } // namespace
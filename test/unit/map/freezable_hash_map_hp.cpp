@@ -0,0 +1,132 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_freezable_hash_map.h"
+
+#include <cds/gc/hp.h>
+#include <cds/container/freezable_hash_map.h>
+
+namespace {
+
+    namespace cc = cds::container;
+    typedef cds::gc::HP gc_type;
+
+    class FreezableHashMap_HP: public cds_test::freezable_hash_map
+    {
+    protected:
+        typedef cds_test::freezable_hash_map base_class;
+
+        void SetUp()
+        {
+            struct map_traits: public cc::freezable_hash::traits
+            {
+                typedef hash1 hash;
+            };
+            typedef cc::FreezableHashMap< gc_type, key_type, value_type, map_traits > map_type;
+
+            cds::gc::hp::GarbageCollector::Construct( map_type::c_nHazardPtrCount, 1, 16 );
+            cds::threading::Manager::attachThread();
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            cds::gc::hp::GarbageCollector::Destruct( true );
+        }
+    };
+
+    TEST_F( FreezableHashMap_HP, compare )
+    {
+        typedef cc::FreezableHashMap< gc_type, key_type, value_type,
+            typename cc::freezable_hash::make_traits<
+                cds::opt::hash< hash1 >
+                ,cds::opt::compare< cmp >
+            >::type
+        > map_type;
+
+        map_type m( kSize, 2 );
+        test( m );
+    }
+
+    TEST_F( FreezableHashMap_HP, less )
+    {
+        typedef cc::FreezableHashMap< gc_type, key_type, value_type,
+            typename cc::freezable_hash::make_traits<
+                cds::opt::hash< hash1 >
+                ,cds::opt::less< less >
+            >::type
+        > map_type;
+
+        map_type m( kSize, 1 );
+        test( m );
+    }
+
+    TEST_F( FreezableHashMap_HP, cmpmix )
+    {
+        typedef cc::FreezableHashMap< gc_type, key_type, value_type,
+            typename cc::freezable_hash::make_traits<
+                cds::opt::hash< hash1 >
+                ,cds::opt::less< less >
+                ,cds::opt::compare< cmp >
+            >::type
+        > map_type;
+
+        map_type m( kSize, 4 );
+        test( m );
+    }
+
+    TEST_F( FreezableHashMap_HP, stat )
+    {
+        struct map_traits: public cc::freezable_hash::traits
+        {
+            typedef hash1 hash;
+            typedef base_class::less less;
+            typedef cds::backoff::pause back_off;
+            typedef cc::freezable_hash::stat<> stat;
+        };
+        typedef cc::FreezableHashMap< gc_type, key_type, value_type, map_traits > map_type;
+
+        map_type m( kSize, 2 );
+        test( m );
+        EXPECT_EQ( m.statistics().m_nResize.get(), 0u );
+    }
+
+    TEST_F( FreezableHashMap_HP, grow )
+    {
+        struct map_traits: public cc::freezable_hash::traits
+        {
+            typedef hash1 hash;
+            typedef base_class::cmp compare;
+            typedef cc::freezable_hash::stat<> stat;
+        };
+        typedef cc::FreezableHashMap< gc_type, key_type, value_type, map_traits > map_type;
+
+        map_type m( 4, 1 );
+        EXPECT_EQ( m.bucket_count(), 4u );
+        test( m );
+        EXPECT_GT( m.statistics().m_nResize.get(), 0u );
+        EXPECT_GT( m.statistics().m_nBucketInit.get(), 0u );
+
+        test_grow( m );
+    }
+
+    TEST_F( FreezableHashMap_HP, grow_load_factor )
+    {
+        struct map_traits: public cc::freezable_hash::traits
+        {
+            typedef hash1 hash;
+            typedef base_class::less less;
+            typedef cds::atomicity::cache_friendly_item_counter item_counter;
+            typedef cc::freezable_hash::stat<> stat;
+        };
+        typedef cc::FreezableHashMap< gc_type, key_type, value_type, map_traits > map_type;
+
+        map_type m( 32, 8 );
+        EXPECT_EQ( m.bucket_count(), 4u );
+        test_grow( m );
+        EXPECT_GT( m.statistics().m_nResize.get(), 0u );
+    }
+
+} // namespace
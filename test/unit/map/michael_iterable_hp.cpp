@@ -171,5 +171,41 @@ namespace {
         EXPECT_GE( m.statistics().m_nInsertSuccess, 0u );
     }
 
+    TEST_F( MichaelIterableMap_HP, find_batch )
+    {
+        typedef cc::IterableKVList< gc_type, key_type, value_type,
+            typename cc::iterable_list::make_traits<
+                cds::opt::compare< cmp >
+            >::type
+        > list_type;
+
+        typedef cc::MichaelHashMap< gc_type, list_type,
+            typename cc::michael_map::make_traits<
+                cds::opt::hash< hash1 >
+            >::type
+        > map_type;
+
+        map_type m( kSize, 2 );
+        test_find_batch( m, kSize );
+    }
+
+    TEST_F( MichaelIterableMap_HP, bulk_load )
+    {
+        typedef cc::IterableKVList< gc_type, key_type, value_type,
+            typename cc::iterable_list::make_traits<
+                cds::opt::compare< cmp >
+            >::type
+        > list_type;
+
+        typedef cc::MichaelHashMap< gc_type, list_type,
+            typename cc::michael_map::make_traits<
+                cds::opt::hash< hash1 >
+            >::type
+        > map_type;
+
+        map_type m( kSize, 2 );
+        test_bulk_load( m, kSize );
+    }
+
 } // namespace
 
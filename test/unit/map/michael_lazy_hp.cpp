@@ -192,5 +192,23 @@ namespace {
         EXPECT_GE( m.statistics().m_nInsertSuccess, 0u );
     }
 
+    TEST_F( MichaelLazyMap_HP, bulk_load )
+    {
+        typedef cc::LazyKVList< gc_type, key_type, value_type,
+            typename cc::lazy_list::make_traits<
+                cds::opt::compare< cmp >
+            >::type
+        > list_type;
+
+        typedef cc::MichaelHashMap< gc_type, list_type,
+            typename cc::michael_map::make_traits<
+                cds::opt::hash< hash1 >
+            >::type
+        > map_type;
+
+        map_type m( kSize, 2 );
+        test_bulk_load( m, kSize );
+    }
+
 } // namespace
 
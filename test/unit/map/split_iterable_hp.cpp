@@ -230,4 +230,22 @@ namespace {
         test( m );
     }
 
+    TEST_F( SplitListIterableMap_HP, bulk_load )
+    {
+        typedef cc::SplitListMap< gc_type, key_type, value_type,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list< cc::iterable_list_tag >
+                , cds::opt::hash< hash1 >
+                , cc::split_list::ordered_list_traits<
+                    typename cc::iterable_list::make_traits<
+                        cds::opt::compare< cmp >
+                    >::type
+                >
+            >::type
+        > map_type;
+
+        map_type m( kSize, 2 );
+        test_bulk_load( m, kSize );
+    }
+
 } // namespace
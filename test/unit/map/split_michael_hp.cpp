@@ -285,4 +285,77 @@ namespace {
         test( m );
     }
 
+    TEST_F( SplitListMichaelMap_HP, find_batch )
+    {
+        typedef cc::SplitListMap< gc_type, key_type, value_type,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list< cc::michael_list_tag >
+                , cds::opt::hash< hash1 >
+                , cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        cds::opt::compare< cmp >
+                    >::type
+                >
+            >::type
+        > map_type;
+
+        map_type m( kSize, 2 );
+        test_find_batch( m, kSize );
+    }
+
+    TEST_F( SplitListMichaelMap_HP, find_batch_static_bucket_table )
+    {
+        typedef cc::SplitListMap< gc_type, key_type, value_type,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list< cc::michael_list_tag >
+                , cc::split_list::dynamic_bucket_table< false >
+                , cds::opt::hash< hash1 >
+                , cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        cds::opt::less< less >
+                    >::type
+                >
+            >::type
+        > map_type;
+
+        map_type m( kSize, 4 );
+        test_find_batch( m, kSize );
+    }
+
+    TEST_F( SplitListMichaelMap_HP, with_hash )
+    {
+        typedef cc::SplitListMap< gc_type, key_type, value_type,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list< cc::michael_list_tag >
+                , cds::opt::hash< hash1 >
+                , cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        cds::opt::compare< cmp >
+                    >::type
+                >
+            >::type
+        > map_type;
+
+        map_type m( kSize, 2 );
+        test_with_hash( m, kSize );
+    }
+
+    TEST_F( SplitListMichaelMap_HP, bulk_load )
+    {
+        typedef cc::SplitListMap< gc_type, key_type, value_type,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list< cc::michael_list_tag >
+                , cds::opt::hash< hash1 >
+                , cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        cds::opt::compare< cmp >
+                    >::type
+                >
+            >::type
+        > map_type;
+
+        map_type m( kSize, 2 );
+        test_bulk_load( m, kSize );
+    }
+
 } // namespace
@@ -0,0 +1,168 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_swiss_hash_map.h"
+
+#include <cds/gc/hp.h>
+#include <cds/container/swiss_hash_map.h>
+
+namespace {
+
+    namespace cc = cds::container;
+    typedef cds::gc::HP gc_type;
+
+    struct no_simd_traits: public cc::swiss_hash::traits
+    {
+        static constexpr const bool simd = false;
+    };
+
+    class SwissHashMap_HP: public cds_test::swiss_hash_map
+    {
+    protected:
+        typedef cds_test::swiss_hash_map base_class;
+
+        void SetUp()
+        {
+            struct map_traits: public cc::swiss_hash::traits
+            {
+                typedef hash1 hash;
+            };
+            typedef cc::SwissHashMap< gc_type, key_type, value_type, map_traits > map_type;
+
+            cds::gc::hp::GarbageCollector::Construct( map_type::c_nHazardPtrCount, 1, 16 );
+            cds::threading::Manager::attachThread();
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            cds::gc::hp::GarbageCollector::Destruct( true );
+        }
+    };
+
+    TEST_F( SwissHashMap_HP, compare )
+    {
+        typedef cc::SwissHashMap< gc_type, key_type, value_type,
+            typename cc::swiss_hash::make_traits<
+                cds::opt::hash< hash1 >
+                ,cds::opt::compare< cmp >
+            >::type
+        > map_type;
+
+        map_type m( kSize );
+        test( m );
+    }
+
+    TEST_F( SwissHashMap_HP, less )
+    {
+        typedef cc::SwissHashMap< gc_type, key_type, value_type,
+            typename cc::swiss_hash::make_traits<
+                cds::opt::hash< hash1 >
+                ,cds::opt::less< less >
+            >::type
+        > map_type;
+
+        map_type m( kSize );
+        test( m );
+    }
+
+    TEST_F( SwissHashMap_HP, cmpmix )
+    {
+        typedef cc::SwissHashMap< gc_type, key_type, value_type,
+            typename cc::swiss_hash::make_traits<
+                cds::opt::hash< hash1 >
+                ,cds::opt::less< less >
+                ,cds::opt::compare< cmp >
+            >::type
+        > map_type;
+
+        map_type m( kSize );
+        test( m );
+    }
+
+    TEST_F( SwissHashMap_HP, stat )
+    {
+        struct map_traits: public cc::swiss_hash::traits
+        {
+            typedef hash1 hash;
+            typedef base_class::less less;
+            typedef cds::backoff::pause back_off;
+            typedef cc::swiss_hash::stat<> stat;
+        };
+        typedef cc::SwissHashMap< gc_type, key_type, value_type, map_traits > map_type;
+
+        map_type m( kSize );
+        test( m );
+        EXPECT_EQ( m.statistics().m_nGrow.get(), 0u );
+    }
+
+    TEST_F( SwissHashMap_HP, no_simd )
+    {
+        struct map_traits: public no_simd_traits
+        {
+            typedef hash1 hash;
+            typedef base_class::cmp compare;
+            typedef cds::sync::reentrant_spin lock_type;
+        };
+        typedef cc::SwissHashMap< gc_type, key_type, value_type, map_traits > map_type;
+
+        map_type m( kSize );
+        test( m );
+    }
+
+    TEST_F( SwissHashMap_HP, grow )
+    {
+        struct map_traits: public cc::swiss_hash::traits
+        {
+            typedef hash1 hash;
+            typedef base_class::cmp compare;
+            typedef cc::swiss_hash::stat<> stat;
+        };
+        typedef cc::SwissHashMap< gc_type, key_type, value_type, map_traits > map_type;
+
+        map_type m( 4 );
+        EXPECT_EQ( m.capacity(), 32u );
+        test( m );
+        EXPECT_GT( m.statistics().m_nGrow.get(), 0u );
+        EXPECT_GT( m.statistics().m_nGroupMigrated.get(), 0u );
+
+        test_grow( m );
+        EXPECT_GT( m.statistics().m_nItemMoved.get(), 0u );
+    }
+
+    TEST_F( SwissHashMap_HP, grow_no_simd )
+    {
+        struct map_traits: public no_simd_traits
+        {
+            typedef hash1 hash;
+            typedef base_class::less less;
+            typedef cds::atomicity::cache_friendly_item_counter item_counter;
+            typedef cc::swiss_hash::stat<> stat;
+        };
+        typedef cc::SwissHashMap< gc_type, key_type, value_type, map_traits > map_type;
+
+        map_type m( 32 );
+        test_grow( m );
+        EXPECT_GT( m.statistics().m_nGrow.get(), 0u );
+    }
+
+    TEST_F( SwissHashMap_HP, rehash )
+    {
+        struct map_traits: public cc::swiss_hash::traits
+        {
+            typedef hash1 hash;
+            typedef base_class::cmp compare;
+            typedef cc::swiss_hash::stat<> stat;
+        };
+        typedef cc::SwissHashMap< gc_type, key_type, value_type, map_traits > map_type;
+
+        map_type m( 256 );
+        test_rehash( m );
+        EXPECT_EQ( m.statistics().m_nGrow.get(), 0u );
+        EXPECT_GT( m.statistics().m_nRehash.get(), 0u );
+        EXPECT_GT( m.statistics().m_nBudgetExhausted.get(), 0u );
+    }
+
+} // namespace
@@ -0,0 +1,470 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSUNIT_MAP_TEST_CTRIE_MAP_RCU_H
+#define CDSUNIT_MAP_TEST_CTRIE_MAP_RCU_H
+
+#include "test_map_data.h"
+#include <cds/container/ctrie_map_rcu.h>
+
+namespace {
+    namespace cc = cds::container;
+
+    template <typename RCU>
+    class CtrieMap: public cds_test::map_fixture
+    {
+    public:
+        enum: size_t {
+            kSize = 1000
+        };
+
+    protected:
+        typedef cds::urcu::gc<RCU> rcu_type;
+        typedef cds_test::map_fixture::key_type     key_type;
+        typedef cds_test::map_fixture::value_type   value_type;
+
+        // All keys fall into 4 lists of full hash collisions
+        struct collision_hash {
+            size_t operator()( int i ) const
+            {
+                return static_cast<size_t>( i % 4 );
+            }
+
+            size_t operator()( std::string const& str ) const
+            {
+                return static_cast<size_t>( std::stoi( str ) % 4 );
+            }
+
+            template <typename T>
+            size_t operator()( T const& i ) const
+            {
+                return static_cast<size_t>( i.nKey % 4 );
+            }
+        };
+
+        template <class Map>
+        void fill( Map& m, int nFirst, int nLast )
+        {
+            std::vector<int> arr;
+            for ( int i = nFirst; i < nLast; ++i )
+                arr.push_back( i );
+            shuffle( arr.begin(), arr.end());
+
+            for ( auto n : arr )
+                ASSERT_TRUE( m.insert( n, n ));
+        }
+
+        // Checks that m contains exactly the keys for which pred( key ) is true,
+        // the value of an item is nKey * nFactor( key )
+        template <class Map, typename Pred, typename Factor>
+        void check_content( Map& m, int nLast, Pred pred, Factor nFactor )
+        {
+            size_t nExpected = 0;
+            for ( int i = 0; i < nLast; ++i ) {
+                if ( pred( i )) {
+                    ++nExpected;
+                    ASSERT_TRUE( m.find( i, [i, &nFactor]( typename Map::value_type const& v ) {
+                        EXPECT_EQ( v.first.nKey, i );
+                        EXPECT_EQ( v.second.nVal, i * nFactor( i ));
+                    })) << "key=" << i;
+                }
+                else
+                    ASSERT_FALSE( m.contains( i )) << "key=" << i;
+            }
+
+            // iterator
+            std::vector<bool> arrVisited( static_cast<size_t>( nLast ), false );
+            size_t nCount = 0;
+            for ( auto it = m.begin(); it != m.end(); ++it ) {
+                ASSERT_GE( it->first.nKey, 0 );
+                ASSERT_LT( it->first.nKey, nLast );
+                EXPECT_TRUE( pred( it->first.nKey ));
+                EXPECT_FALSE( arrVisited[it->first.nKey] );
+                arrVisited[it->first.nKey] = true;
+                EXPECT_EQ( ( *it ).second.nVal, it->first.nKey * nFactor( it->first.nKey ));
+                ++nCount;
+            }
+            EXPECT_EQ( nCount, nExpected );
+            EXPECT_EQ( m.size(), nExpected );
+            EXPECT_EQ( m.empty(), nExpected == 0 );
+        }
+
+        template <class Map>
+        void test( Map& m )
+        {
+            // Precondition: map is empty
+            // Postcondition: map is empty
+
+            EXPECT_TRUE( m.empty());
+            EXPECT_EQ( m.size(), 0u );
+            EXPECT_FALSE( m.is_read_only());
+            EXPECT_TRUE( m.begin() == m.end());
+
+            typedef typename Map::value_type map_pair;
+            size_t const kkSize = kSize;
+
+            std::vector<key_type> arrKeys;
+            for ( int i = 0; i < static_cast<int>( kkSize ); ++i )
+                arrKeys.push_back( key_type( i ));
+            shuffle( arrKeys.begin(), arrKeys.end());
+
+            // insert/find
+            for ( auto const& i : arrKeys ) {
+                ASSERT_FALSE( m.contains( i ));
+                ASSERT_FALSE( m.contains( i.nKey ));
+                ASSERT_FALSE( m.find( i, []( map_pair const& ) {
+                    ASSERT_TRUE( false );
+                }));
+                ASSERT_FALSE( m.erase( i.nKey ));
+
+                std::pair<bool, bool> updResult = m.update( i.nKey, []( bool, map_pair& ) {
+                    ASSERT_TRUE( false );
+                }, false );
+                EXPECT_FALSE( updResult.first );
+                EXPECT_FALSE( updResult.second );
+
+                switch ( i.nKey % 5 ) {
+                case 0:
+                    ASSERT_TRUE( m.insert( i ));
+                    ASSERT_FALSE( m.insert( i ));
+                    updResult = m.update( i.nKey, []( bool bNew, map_pair& v ) {
+                        EXPECT_FALSE( bNew );
+                        EXPECT_EQ( v.second.nVal, 0 );
+                        v.second.nVal = v.first.nKey;
+                    }, false );
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_FALSE( updResult.second );
+                    break;
+                case 1:
+                    ASSERT_TRUE( m.insert( i.nKey, i.nKey ));
+                    ASSERT_FALSE( m.insert( i.nKey, i.nKey * 2 ));
+                    break;
+                case 2:
+                    ASSERT_TRUE( m.insert_with( i, []( map_pair& v ) {
+                        v.second.nVal = v.first.nKey;
+                    }));
+                    ASSERT_FALSE( m.insert_with( i.nKey, []( map_pair& ) {
+                        ASSERT_TRUE( false );
+                    }));
+                    break;
+                case 3:
+                    ASSERT_TRUE( m.emplace( i.nKey, i.nKey, std::to_string( i.nKey )));
+                    ASSERT_FALSE( m.emplace( i.nKey, i.nKey * 2 ));
+                    break;
+                case 4:
+                    updResult = m.update( i.nKey, []( bool bNew, map_pair& v ) {
+                        EXPECT_TRUE( bNew );
+                        v.second.nVal = v.first.nKey;
+                    });
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_TRUE( updResult.second );
+                    break;
+                }
+
+                ASSERT_TRUE( m.contains( i ));
+                ASSERT_TRUE( m.contains( i.nKey ));
+                ASSERT_TRUE( m.find( i, []( map_pair const& v ) {
+                    EXPECT_EQ( v.first.nKey, v.second.nVal );
+                }));
+                ASSERT_TRUE( m.find( std::to_string( i.nKey ), [&i]( map_pair const& v ) {
+                    EXPECT_EQ( v.first.nKey, i.nKey );
+                }));
+            }
+            ASSERT_FALSE( m.empty());
+            check_content( m, static_cast<int>( kkSize ), []( int ) { return true; }, []( int ) { return 1; } );
+
+            // update existing items
+            shuffle( arrKeys.begin(), arrKeys.end());
+            for ( auto const& i : arrKeys ) {
+                std::pair<bool, bool> updResult = m.update( i, []( bool bNew, map_pair& v ) {
+                    EXPECT_FALSE( bNew );
+                    v.second.nVal *= 2;
+                });
+                EXPECT_TRUE( updResult.first );
+                EXPECT_FALSE( updResult.second );
+            }
+            check_content( m, static_cast<int>( kkSize ), []( int ) { return true; }, []( int ) { return 2; } );
+
+            // erase
+            shuffle( arrKeys.begin(), arrKeys.end());
+            for ( auto const& i : arrKeys ) {
+                ASSERT_TRUE( m.contains( i.nKey ));
+                switch ( i.nKey % 3 ) {
+                case 0:
+                    ASSERT_TRUE( m.erase( i.nKey ));
+                    break;
+                case 1:
+                    ASSERT_TRUE( m.erase( i ));
+                    break;
+                case 2:
+                    {
+                        int nVal = 0;
+                        ASSERT_TRUE( m.erase( std::to_string( i.nKey ), [&nVal]( map_pair const& v ) {
+                            nVal = v.second.nVal;
+                        }));
+                        EXPECT_EQ( nVal, i.nKey * 2 );
+                    }
+                    break;
+                }
+                ASSERT_FALSE( m.contains( i.nKey ));
+                ASSERT_FALSE( m.erase( i ));
+            }
+            EXPECT_TRUE( m.empty());
+            EXPECT_EQ( m.size(), 0u );
+
+            // clear
+            fill( m, 0, static_cast<int>( kkSize ));
+            EXPECT_FALSE( m.empty());
+            m.clear();
+            EXPECT_TRUE( m.empty());
+            EXPECT_EQ( m.size(), 0u );
+            EXPECT_TRUE( m.begin() == m.end());
+        }
+
+        template <class Map>
+        void test_snapshot( Map& m )
+        {
+            // Precondition: map is empty
+            // Postcondition: map is empty
+
+            typedef typename Map::value_type map_pair;
+            int const nSize = static_cast<int>( kSize );
+
+            fill( m, 0, nSize );
+
+            Map ro = m.read_only_snapshot();
+            Map snap = m.snapshot();
+            EXPECT_TRUE( ro.is_read_only());
+            EXPECT_FALSE( snap.is_read_only());
+
+            // the iterator keeps the content of the map at the moment of begin()
+            auto itInitial = m.begin();
+
+            // change the map: remove even keys, double the values of odd keys, append new keys
+            for ( int i = 0; i < nSize; ++i ) {
+                if ( i % 2 == 0 )
+                    ASSERT_TRUE( m.erase( i ));
+                else {
+                    std::pair<bool, bool> updResult = m.update( i, []( bool, map_pair& v ) {
+                        v.second.nVal *= 2;
+                    }, false );
+                    ASSERT_TRUE( updResult.first );
+                    ASSERT_FALSE( updResult.second );
+                }
+            }
+            fill( m, nSize, nSize * 2 );
+
+            // change the writable snapshot: remove the keys multiple of 3
+            for ( int i = 0; i < nSize; i += 3 )
+                ASSERT_TRUE( snap.erase( i ));
+
+            // the read-only snapshot cannot be changed
+            EXPECT_FALSE( ro.insert( nSize * 3 ));
+            EXPECT_FALSE( ro.insert( 0, 0 ));
+            EXPECT_FALSE( ro.emplace( nSize * 3, 1 ));
+            EXPECT_FALSE( ro.insert_with( nSize * 3, []( map_pair& ) {} ));
+            EXPECT_FALSE( ro.erase( 1 ));
+            EXPECT_FALSE( ro.update( 1, []( bool, map_pair& ) { ASSERT_TRUE( false ); } ).first );
+            ro.clear();
+
+            check_content( ro, nSize * 2, [nSize]( int i ) { return i < nSize; }, []( int ) { return 1; } );
+            check_content( snap, nSize * 2, [nSize]( int i ) { return i < nSize && i % 3 != 0; }, []( int ) { return 1; } );
+            check_content( m, nSize * 2, [nSize]( int i ) { return i >= nSize || i % 2 != 0; }, [nSize]( int i ) { return i < nSize ? 2 : 1; } );
+
+            {
+                size_t nCount = 0;
+                for ( ; itInitial != m.end(); ++itInitial ) {
+                    EXPECT_LT( itInitial->first.nKey, nSize );
+                    EXPECT_EQ( itInitial->first.nKey, itInitial->second.nVal );
+                    ++nCount;
+                }
+                EXPECT_EQ( nCount, static_cast<size_t>( kSize ));
+            }
+
+            // writable copy of the read-only snapshot
+            {
+                Map copy = ro.snapshot();
+                EXPECT_FALSE( copy.is_read_only());
+                ASSERT_TRUE( copy.insert( nSize * 3, 1 ));
+                ASSERT_TRUE( copy.erase( 0 ));
+                EXPECT_TRUE( copy.contains( nSize * 3 ));
+                EXPECT_FALSE( copy.contains( 0 ));
+                EXPECT_FALSE( ro.contains( nSize * 3 ));
+                EXPECT_TRUE( ro.contains( 0 ));
+            }
+
+            // snapshot of the snapshot
+            {
+                Map snap2 = snap.snapshot();
+                snap.clear();
+                EXPECT_TRUE( snap.empty());
+                check_content( snap2, nSize * 2, [nSize]( int i ) { return i < nSize && i % 3 != 0; }, []( int ) { return 1; } );
+            }
+
+            // the iterator taken before clear() walks the old content
+            size_t const nSizeBeforeClear = m.size();
+            auto it = m.cbegin();
+            m.clear();
+            EXPECT_TRUE( m.empty());
+            EXPECT_TRUE( m.begin() == m.end());
+            {
+                size_t nCount = 0;
+                for ( ; it != m.cend(); ++it )
+                    ++nCount;
+                EXPECT_EQ( nCount, nSizeBeforeClear );
+            }
+
+            check_content( ro, nSize * 2, [nSize]( int i ) { return i < nSize; }, []( int ) { return 1; } );
+        }
+
+        void SetUp()
+        {
+            RCU::Construct();
+            cds::threading::Manager::attachThread();
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            RCU::Destruct();
+        }
+    };
+
+    TYPED_TEST_CASE_P( CtrieMap );
+
+    TYPED_TEST_P( CtrieMap, defaulted )
+    {
+        typedef typename TestFixture::rcu_type rcu_type;
+        typedef cc::CtrieMap< rcu_type, int, int > map_type;
+
+        map_type m;
+        EXPECT_TRUE( m.empty());
+        for ( int i = 0; i < static_cast<int>( TestFixture::kSize ); ++i )
+            ASSERT_TRUE( m.insert( i, i * 10 ));
+        EXPECT_EQ( m.size(), static_cast<size_t>( TestFixture::kSize ));
+
+        map_type snap = m.read_only_snapshot();
+        for ( int i = 0; i < static_cast<int>( TestFixture::kSize ); ++i ) {
+            ASSERT_TRUE( m.find( i, [i]( std::pair<int const, int> const& v ) {
+                EXPECT_EQ( v.second, i * 10 );
+            }));
+            ASSERT_TRUE( m.erase( i ));
+        }
+        EXPECT_TRUE( m.empty());
+        EXPECT_EQ( snap.size(), static_cast<size_t>( TestFixture::kSize ));
+    }
+
+    TYPED_TEST_P( CtrieMap, compare )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::CtrieMap< rcu_type, key_type, value_type,
+            typename cc::ctrie::make_traits<
+                cds::opt::hash< typename TestFixture::hash1 >
+                , cds::opt::compare< typename TestFixture::cmp >
+            >::type
+        > map_type;
+
+        map_type m;
+        this->test( m );
+    }
+
+    TYPED_TEST_P( CtrieMap, less )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::CtrieMap< rcu_type, key_type, value_type,
+            typename cc::ctrie::make_traits<
+                cds::opt::hash< typename TestFixture::hash1 >
+                , cds::opt::less< typename TestFixture::less >
+            >::type
+        > map_type;
+
+        map_type m;
+        this->test( m );
+    }
+
+    TYPED_TEST_P( CtrieMap, stat )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::CtrieMap< rcu_type, key_type, value_type,
+            typename cc::ctrie::make_traits<
+                cds::opt::hash< typename TestFixture::hash1 >
+                , cds::opt::compare< typename TestFixture::cmp >
+                , cds::opt::stat< cc::ctrie::stat<>>
+                , cds::opt::memory_model< cds::opt::v::sequential_consistent >
+            >::type
+        > map_type;
+
+        map_type m;
+        this->test( m );
+        EXPECT_EQ( m.statistics().m_nEraseSuccess.get(), static_cast<size_t>( TestFixture::kSize ));
+        EXPECT_GT( m.statistics().m_nUpdateExisting.get(), 0u );
+        EXPECT_EQ( m.statistics().m_nClear.get(), 1u );
+    }
+
+    TYPED_TEST_P( CtrieMap, collision )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::CtrieMap< rcu_type, key_type, value_type,
+            typename cc::ctrie::make_traits<
+                cds::opt::hash< typename TestFixture::collision_hash >
+                , cds::opt::compare< typename TestFixture::cmp >
+                , cds::opt::stat< cc::ctrie::stat<>>
+            >::type
+        > map_type;
+
+        map_type m;
+        this->test( m );
+        EXPECT_GT( m.statistics().m_nCollision.get(), 0u );
+
+        this->test_snapshot( m );
+    }
+
+    TYPED_TEST_P( CtrieMap, snapshot )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::CtrieMap< rcu_type, key_type, value_type,
+            typename cc::ctrie::make_traits<
+                cds::opt::hash< typename TestFixture::hash1 >
+                , cds::opt::compare< typename TestFixture::cmp >
+                , cds::opt::stat< cc::ctrie::stat<>>
+            >::type
+        > map_type;
+
+        map_type m;
+        this->test_snapshot( m );
+        EXPECT_GT( m.statistics().m_nSnapshot.get(), 0u );
+        EXPECT_GT( m.statistics().m_nReadOnlySnapshot.get(), 0u );
+        EXPECT_GT( m.statistics().m_nRenew.get(), 0u );
+
+        // move ctor
+        this->fill( m, 0, 100 );
+        map_type m2( std::move( m ));
+        EXPECT_TRUE( m.empty());
+        EXPECT_EQ( m2.size(), 100u );
+    }
+
+    // GCC 5: All test names should be written on single line, otherwise a runtime error will be encountered like as
+    // "No test named <test_name> can be found in this test case"
+    REGISTER_TYPED_TEST_CASE_P( CtrieMap,
+        defaulted, compare, less, stat, collision, snapshot
+        );
+} // namespace
+
+#endif // #ifndef CDSUNIT_MAP_TEST_CTRIE_MAP_RCU_H
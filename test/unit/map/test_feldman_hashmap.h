@@ -450,6 +450,59 @@ namespace cds_test {
             ASSERT_TRUE( m.empty());
             ASSERT_CONTAINER_SIZE( m, 0 );
         }
+
+        template <typename Map>
+        void test_with_hash( Map& m )
+        {
+            // Precondition: map is empty
+            // Postcondition: map is empty
+
+            ASSERT_TRUE( m.empty());
+            ASSERT_CONTAINER_SIZE( m, 0 );
+
+            typedef typename Map::key_type key_type;
+            typedef typename Map::value_type map_pair;
+            size_t const kkSize = kSize;
+
+            typename Map::hasher h;
+            std::vector<typename Map::hash_type> arrHash;
+            for ( int i = 0; i < static_cast<int>( kkSize ); ++i ) {
+                arrHash.push_back( h( key_type( i )));
+                if ( i % 2 == 0 )
+                    ASSERT_TRUE( m.insert( key_type( i ), typename Map::mapped_type( i * 10 )));
+            }
+            ASSERT_CONTAINER_SIZE( m, kkSize / 2 );
+
+            for ( int i = 0; i < static_cast<int>( kkSize ); ++i ) {
+                if ( i % 2 == 0 ) {
+                    EXPECT_TRUE( m.contains_with_hash( i, arrHash[i] ));
+                    EXPECT_TRUE( m.find_with_hash( key_type( i ), arrHash[i], []( map_pair& item ) {
+                        EXPECT_EQ( item.second.nVal, item.first.nKey * 10 );
+                        item.second.strVal = std::to_string( item.first.nKey );
+                    }));
+                }
+                else {
+                    EXPECT_FALSE( m.contains_with_hash( i, arrHash[i] ));
+                    EXPECT_FALSE( m.find_with_hash( key_type( i ), arrHash[i], []( map_pair& ) { EXPECT_TRUE( false ); }));
+                }
+            }
+
+            for ( int i = 0; i < static_cast<int>( kkSize ); ++i ) {
+                if ( i % 2 != 0 )
+                    EXPECT_FALSE( m.erase_with_hash( i, arrHash[i] ));
+                else if ( i % 4 == 0 )
+                    EXPECT_TRUE( m.erase_with_hash( i, arrHash[i] ));
+                else {
+                    EXPECT_TRUE( m.erase_with_hash( key_type( i ), arrHash[i], []( map_pair& item ) {
+                        EXPECT_EQ( item.second.strVal, std::to_string( item.first.nKey ));
+                    }));
+                }
+                EXPECT_FALSE( m.contains_with_hash( i, arrHash[i] ));
+            }
+
+            ASSERT_TRUE( m.empty());
+            ASSERT_CONTAINER_SIZE( m, 0 );
+        }
     };
 
 } // namespace cds_test
@@ -311,11 +311,76 @@ namespace {
         this->test( m );
     }
 
+    TYPED_TEST_P( FeldmanHashMap, compaction )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::FeldmanHashMap< rcu_type, key_type, value_type,
+            typename cc::feldman_hashmap::make_traits<
+                cc::feldman_hashmap::compaction< true >
+                , cds::opt::stat< cc::feldman_hashmap::stat<>>
+            >::type
+        > map_type;
+
+        map_type m( 4, 2 );
+        this->test( m );
+        EXPECT_GT( m.statistics().m_nCompactNodeSuccess.get(), 0u );
+    }
+
+    TYPED_TEST_P( FeldmanHashMap, find_batch_compaction )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::FeldmanHashMap< rcu_type, key_type, value_type,
+            typename cc::feldman_hashmap::make_traits<
+                cc::feldman_hashmap::compaction< true >
+            >::type
+        > map_type;
+
+        map_type m( 4, 2 );
+        this->test_find_batch( m, TestFixture::kSize );
+    }
+
+    TYPED_TEST_P( FeldmanHashMap, find_batch )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::FeldmanHashMap< rcu_type, key_type, value_type,
+            typename cc::feldman_hashmap::make_traits<
+                cds::opt::compare< typename TestFixture::cmp >
+            >::type
+        > map_type;
+
+        map_type m( 4, 2 );
+        this->test_find_batch( m, TestFixture::kSize );
+    }
+
+    TYPED_TEST_P( FeldmanHashMap, with_hash )
+    {
+        typedef typename TestFixture::rcu_type   rcu_type;
+        typedef typename TestFixture::key_type   key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::FeldmanHashMap< rcu_type, key_type, value_type,
+            typename cc::feldman_hashmap::make_traits<
+                cds::opt::compare< typename TestFixture::cmp >
+            >::type
+        > map_type;
+
+        map_type m( 4, 5 );
+        this->test_with_hash( m );
+    }
 
     // GCC 5: All test names should be written on single line, otherwise a runtime error will be encountered like as
     // "No test named <test_name> can be found in this test case"
     REGISTER_TYPED_TEST_CASE_P( FeldmanHashMap,
-        defaulted, compare, less, cmpmix, backoff, stat, explicit_key_size, byte_cut, byte_cut_explicit_key_size
+        defaulted, compare, less, cmpmix, backoff, stat, explicit_key_size, byte_cut, byte_cut_explicit_key_size, compaction, find_batch_compaction, find_batch, with_hash
         );
 } // namespace
 
@@ -214,6 +214,218 @@ namespace cds_test {
                 return v1.nKey < v2.nKey;
             }
         };
+
+    protected:
+        template <class Map>
+        void test_find_batch( Map& m, size_t nSize )
+        {
+            // Precondition: map is empty
+            // Postcondition: map is empty
+
+            EXPECT_TRUE( m.empty());
+
+            typedef typename Map::value_type map_pair;
+
+            // Even keys are in the map
+            for ( int i = 0; i < static_cast<int>( nSize ); i += 2 )
+                EXPECT_TRUE( m.insert( key_type( i ), value_type( i * 10 )));
+
+            std::vector<key_type> arrKeys;
+            std::vector<int> arrIntKeys;
+            for ( int i = 0; i < static_cast<int>( nSize ); ++i )
+                arrKeys.push_back( key_type( i ));
+            shuffle( arrKeys.begin(), arrKeys.end());
+            for ( auto const& key : arrKeys )
+                arrIntKeys.push_back( key.nKey );
+
+            std::vector<size_t> arrFound( nSize, 0 );
+            size_t nFound = m.find_batch( arrKeys.data(), arrKeys.size(), [&arrKeys, &arrFound]( size_t nIndex, map_pair& item ) {
+                EXPECT_EQ( item.first.nKey, arrKeys[nIndex].nKey );
+                EXPECT_EQ( item.second.nVal, item.first.nKey * 10 );
+                ++arrFound[nIndex];
+            } );
+            EXPECT_EQ( nFound, nSize / 2 );
+            for ( size_t i = 0; i < nSize; ++i )
+                EXPECT_EQ( arrFound[i], arrKeys[i].nKey % 2 == 0 ? 1u : 0u ) << "key=" << arrKeys[i].nKey;
+
+            // Batch of other key type, the size is not a multiple of the group size
+            nFound = m.find_batch( arrIntKeys.data(), nSize - 3, [&arrIntKeys]( size_t nIndex, map_pair& item ) {
+                EXPECT_EQ( item.first.nKey, arrIntKeys[nIndex] );
+                item.second.strVal = "found";
+            } );
+            size_t nExpected = 0;
+            for ( size_t i = 0; i < nSize - 3; ++i ) {
+                if ( arrIntKeys[i] % 2 == 0 )
+                    ++nExpected;
+            }
+            EXPECT_EQ( nFound, nExpected );
+            EXPECT_TRUE( m.find( arrIntKeys[0], [&arrIntKeys]( map_pair& item ) {
+                EXPECT_EQ( item.second.strVal, std::string( "found" ));
+            } ) == ( arrIntKeys[0] % 2 == 0 ));
+
+            // Empty batch
+            EXPECT_EQ( m.find_batch( arrIntKeys.data(), 0, []( size_t, map_pair& ) { EXPECT_TRUE( false ); } ), 0u );
+
+            m.clear();
+            EXPECT_TRUE( m.empty());
+        }
+
+        template <class Map>
+        void test_with_hash( Map& m, size_t nSize )
+        {
+            // Precondition: map is empty
+            // Postcondition: map is empty
+
+            EXPECT_TRUE( m.empty());
+
+            typedef typename Map::value_type map_pair;
+            hash1 h;
+
+            std::vector<int> arrKeys;
+            for ( int i = 0; i < static_cast<int>( nSize ); ++i )
+                arrKeys.push_back( i );
+            shuffle( arrKeys.begin(), arrKeys.end());
+
+            // insert/update/find with precomputed hash
+            for ( int nKey : arrKeys ) {
+                key_type key( nKey );
+                size_t const nHash = h( nKey );
+
+                EXPECT_FALSE( m.contains_with_hash( key, nHash ));
+                EXPECT_FALSE( m.find_with_hash( nKey, nHash, []( map_pair& ) { EXPECT_TRUE( false ); } ));
+
+                std::pair<bool, bool> updResult;
+                switch ( nKey % 3 ) {
+                case 0:
+                    EXPECT_TRUE( m.insert_with_hash( key, nHash ));
+                    EXPECT_FALSE( m.insert_with_hash( key, nHash ));
+                    break;
+                case 1:
+                    EXPECT_TRUE( m.insert_with_hash( nKey, nHash, value_type( nKey * 10 )));
+                    EXPECT_FALSE( m.insert_with_hash( nKey, nHash, value_type( nKey * 100 )));
+                    break;
+                case 2:
+                    updResult = m.update_with_hash( nKey, nHash, []( bool, map_pair& ) { EXPECT_TRUE( false ); }, false );
+                    EXPECT_FALSE( updResult.first );
+                    EXPECT_FALSE( updResult.second );
+
+                    updResult = m.update_with_hash( key, nHash, []( bool bNew, map_pair& item )
+                        {
+                            EXPECT_TRUE( bNew );
+                            item.second.nVal = item.first.nKey * 10;
+                        });
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_TRUE( updResult.second );
+                    break;
+                }
+
+                updResult = m.update_with_hash( nKey, nHash, []( bool bNew, map_pair& item )
+                    {
+                        EXPECT_FALSE( bNew );
+                        item.second.strVal = "updated";
+                    }, false );
+                EXPECT_TRUE( updResult.first );
+                EXPECT_FALSE( updResult.second );
+
+                EXPECT_TRUE( m.contains_with_hash( nKey, nHash ));
+                EXPECT_TRUE( m.find_with_hash( key, nHash, []( map_pair& item )
+                    {
+                        EXPECT_EQ( item.second.nVal, item.first.nKey % 3 == 0 ? 0 : item.first.nKey * 10 );
+                        EXPECT_EQ( item.second.strVal, std::string( "updated" ));
+                    }));
+            }
+            EXPECT_FALSE( m.empty());
+            EXPECT_CONTAINER_SIZE( m, nSize );
+
+            // erase with precomputed hash
+            shuffle( arrKeys.begin(), arrKeys.end());
+            for ( int nKey : arrKeys ) {
+                size_t const nHash = h( nKey );
+
+                if ( nKey & 1 ) {
+                    EXPECT_TRUE( m.erase_with_hash( key_type( nKey ), nHash ));
+                    EXPECT_FALSE( m.erase_with_hash( key_type( nKey ), nHash ));
+                }
+                else {
+                    int nFound = -1;
+                    EXPECT_TRUE( m.erase_with_hash( nKey, nHash, [&nFound]( map_pair& item ) { nFound = item.first.nKey; } ));
+                    EXPECT_EQ( nFound, nKey );
+                    nFound = -1;
+                    EXPECT_FALSE( m.erase_with_hash( nKey, nHash, [&nFound]( map_pair& item ) { nFound = item.first.nKey; } ));
+                    EXPECT_EQ( nFound, -1 );
+                }
+                EXPECT_FALSE( m.contains_with_hash( nKey, nHash ));
+            }
+            EXPECT_TRUE( m.empty());
+            EXPECT_CONTAINER_SIZE( m, 0u );
+        }
+
+        template <typename Map>
+        void test_bulk_load( Map& m, size_t nSize )
+        {
+            // Precondition: map is empty
+            // Postcondition: map is empty
+
+            EXPECT_TRUE( m.empty());
+
+            typedef typename Map::value_type map_pair;
+
+            // The second round is large enough to be loaded by several threads
+            size_t const arrThreads[] = { 1, 4 };
+            size_t const arrSize[] = { nSize, nSize * 8 < 8192 ? 8192 : nSize * 8 };
+
+            for ( size_t nRound = 0; nRound < 2; ++nRound ) {
+                size_t const nCount = arrSize[nRound];
+
+                std::vector<std::pair<int, int>> arrData;
+                for ( int i = 0; i < static_cast<int>( nCount ); ++i )
+                    arrData.emplace_back( i, i * 10 );
+                shuffle( arrData.begin(), arrData.end());
+
+                // Duplicates are not inserted
+                for ( size_t i = 0; i < 10; ++i )
+                    arrData.emplace_back( arrData[i].first, -1 );
+
+                EXPECT_EQ( m.bulk_load( arrData.begin(), arrData.end(), arrThreads[nRound] ), nCount );
+                EXPECT_FALSE( m.empty());
+                EXPECT_CONTAINER_SIZE( m, nCount );
+
+                for ( int i = 0; i < static_cast<int>( nCount ); ++i ) {
+                    EXPECT_TRUE( m.find( i, []( map_pair& item ) {
+                        EXPECT_EQ( item.second.nVal, item.first.nKey * 10 );
+                    } )) << "key=" << i;
+                }
+                EXPECT_FALSE( m.contains( static_cast<int>( nCount )));
+
+                // Loading into non-empty map
+                std::vector<std::pair<int, int>> arrMore;
+                for ( int i = static_cast<int>( nCount ) - 5; i < static_cast<int>( nCount ) + 5; ++i )
+                    arrMore.emplace_back( i, i * 10 );
+                EXPECT_EQ( m.bulk_load( arrMore.begin(), arrMore.end()), 5u );
+                EXPECT_CONTAINER_SIZE( m, nCount + 5 );
+                EXPECT_TRUE( m.contains( static_cast<int>( nCount ) + 4 ));
+
+                m.clear();
+                EXPECT_TRUE( m.empty());
+                EXPECT_CONTAINER_SIZE( m, 0u );
+            }
+
+            // An exception thrown by an insertion in any loading thread is rethrown to the caller
+            {
+                size_t const nCount = arrSize[1];
+                std::vector<std::pair<int, std::string>> arrData;
+                for ( int i = 0; i < static_cast<int>( nCount ); ++i )
+                    arrData.emplace_back( i, std::to_string( i * 10 ));
+                arrData[nCount / 2].second = "bad"; // value_type( std::string ) throws std::invalid_argument
+
+                EXPECT_THROW( m.bulk_load( arrData.begin(), arrData.end(), arrThreads[1] ), std::invalid_argument );
+                EXPECT_FALSE( m.contains( static_cast<int>( nCount / 2 )));
+
+                m.clear();
+                EXPECT_TRUE( m.empty());
+                EXPECT_CONTAINER_SIZE( m, 0u );
+            }
+        }
     };
 } // namespace cds_test
 
@@ -228,11 +228,33 @@ namespace {
         EXPECT_GE( m.statistics().m_nInsertSuccess, 0u );
     }
 
+    TYPED_TEST_P( MichaelLazyMap, bulk_load )
+    {
+        typedef typename TestFixture::rcu_type rcu_type;
+        typedef typename TestFixture::key_type key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::LazyKVList< rcu_type, key_type, value_type,
+            typename cc::lazy_list::make_traits<
+                cds::opt::compare< typename TestFixture::cmp >
+            >::type
+        > list_type;
+
+        typedef cc::MichaelHashMap< rcu_type, list_type,
+            typename cc::michael_map::make_traits<
+                cds::opt::hash< typename TestFixture::hash1 >
+            >::type
+        > map_type;
+
+        map_type m( TestFixture::kSize, 2 );
+        this->test_bulk_load( m, TestFixture::kSize );
+    }
+
 
     // GCC 5: All test names should be written on single line, otherwise a runtime error will be encountered like as
     // "No test named <test_name> can be found in this test case"
     REGISTER_TYPED_TEST_CASE_P( MichaelLazyMap,
-        compare, less, cmpmix, backoff, seq_cst, mutex, stat, wrapped_stat
+        compare, less, cmpmix, backoff, seq_cst, mutex, stat, wrapped_stat, bulk_load
     );
 } // namespace
 
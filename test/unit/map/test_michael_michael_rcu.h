@@ -203,8 +203,74 @@ namespace {
         EXPECT_GE( m.statistics().m_nInsertSuccess, 0u );
     }
 
+    TYPED_TEST_P( MichaelMap, find_batch )
+    {
+        typedef typename TestFixture::rcu_type rcu_type;
+        typedef typename TestFixture::key_type key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::MichaelKVList< rcu_type, key_type, value_type,
+            typename cc::michael_list::make_traits<
+                cds::opt::compare< typename TestFixture::cmp >
+            >::type
+        > list_type;
+
+        typedef cc::MichaelHashMap< rcu_type, list_type,
+            typename cc::michael_map::make_traits<
+                cds::opt::hash< typename TestFixture::hash1 >
+            >::type
+        > map_type;
+
+        map_type m( TestFixture::kSize, 2 );
+        this->test_find_batch( m, TestFixture::kSize );
+    }
+
+    TYPED_TEST_P( MichaelMap, with_hash )
+    {
+        typedef typename TestFixture::rcu_type rcu_type;
+        typedef typename TestFixture::key_type key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::MichaelKVList< rcu_type, key_type, value_type,
+            typename cc::michael_list::make_traits<
+                cds::opt::compare< typename TestFixture::cmp >
+            >::type
+        > list_type;
+
+        typedef cc::MichaelHashMap< rcu_type, list_type,
+            typename cc::michael_map::make_traits<
+                cds::opt::hash< typename TestFixture::hash1 >
+            >::type
+        > map_type;
+
+        map_type m( TestFixture::kSize, 2 );
+        this->test_with_hash( m, TestFixture::kSize );
+    }
+
+    TYPED_TEST_P( MichaelMap, bulk_load )
+    {
+        typedef typename TestFixture::rcu_type rcu_type;
+        typedef typename TestFixture::key_type key_type;
+        typedef typename TestFixture::value_type value_type;
+
+        typedef cc::MichaelKVList< rcu_type, key_type, value_type,
+            typename cc::michael_list::make_traits<
+                cds::opt::compare< typename TestFixture::cmp >
+            >::type
+        > list_type;
+
+        typedef cc::MichaelHashMap< rcu_type, list_type,
+            typename cc::michael_map::make_traits<
+                cds::opt::hash< typename TestFixture::hash1 >
+            >::type
+        > map_type;
+
+        map_type m( TestFixture::kSize, 2 );
+        this->test_bulk_load( m, TestFixture::kSize );
+    }
+
     REGISTER_TYPED_TEST_CASE_P( MichaelMap,
-        compare, less, cmpmix, backoff, seq_cst, stat, wrapped_stat
+        compare, less, cmpmix, backoff, seq_cst, stat, wrapped_stat, find_batch, with_hash, bulk_load
     );
 }
 
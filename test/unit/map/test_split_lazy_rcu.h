@@ -291,8 +291,31 @@ TYPED_TEST_P( SplitListLazyMap, static_bucket_table_free_list )
     this->test( m );
 }
 
+TYPED_TEST_P( SplitListLazyMap, bulk_load )
+{
+    typedef typename TestFixture::rcu_type   rcu_type;
+    typedef typename TestFixture::key_type   key_type;
+    typedef typename TestFixture::value_type value_type;
+    typedef typename TestFixture::hash1      hash1;
+
+    typedef cc::SplitListMap< rcu_type, key_type, value_type,
+        typename cc::split_list::make_traits<
+            cc::split_list::ordered_list< cc::lazy_list_tag >
+            , cds::opt::hash< hash1 >
+            , cc::split_list::ordered_list_traits<
+                typename cc::lazy_list::make_traits<
+                    cds::opt::compare< typename TestFixture::cmp >
+                >::type
+            >
+        >::type
+    > map_type;
+
+    map_type m( TestFixture::kSize, 2 );
+    this->test_bulk_load( m, TestFixture::kSize );
+}
+
 REGISTER_TYPED_TEST_CASE_P( SplitListLazyMap,
-    compare, less, cmpmix, item_counting, stat, back_off, mutex, free_list, static_bucket_table, static_bucket_table_free_list
+    compare, less, cmpmix, item_counting, stat, back_off, mutex, free_list, static_bucket_table, static_bucket_table_free_list, bulk_load
 );
 
 
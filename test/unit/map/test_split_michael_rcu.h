@@ -335,8 +335,77 @@ TYPED_TEST_P( SplitListMichaelMap, bit_reversal_muldiv )
 }
 
 
+TYPED_TEST_P( SplitListMichaelMap, find_batch )
+{
+    typedef typename TestFixture::rcu_type   rcu_type;
+    typedef typename TestFixture::key_type   key_type;
+    typedef typename TestFixture::value_type value_type;
+    typedef typename TestFixture::hash1      hash1;
+
+    typedef cc::SplitListMap< rcu_type, key_type, value_type,
+        typename cc::split_list::make_traits<
+            cc::split_list::ordered_list< cc::michael_list_tag >
+            , cds::opt::hash< hash1 >
+            , cc::split_list::ordered_list_traits<
+                typename cc::michael_list::make_traits<
+                    cds::opt::compare< typename TestFixture::cmp >
+                >::type
+            >
+        >::type
+    > map_type;
+
+    map_type m( TestFixture::kSize, 2 );
+    this->test_find_batch( m, TestFixture::kSize );
+}
+
+TYPED_TEST_P( SplitListMichaelMap, with_hash )
+{
+    typedef typename TestFixture::rcu_type   rcu_type;
+    typedef typename TestFixture::key_type   key_type;
+    typedef typename TestFixture::value_type value_type;
+    typedef typename TestFixture::hash1      hash1;
+
+    typedef cc::SplitListMap< rcu_type, key_type, value_type,
+        typename cc::split_list::make_traits<
+            cc::split_list::ordered_list< cc::michael_list_tag >
+            , cds::opt::hash< hash1 >
+            , cc::split_list::ordered_list_traits<
+                typename cc::michael_list::make_traits<
+                    cds::opt::compare< typename TestFixture::cmp >
+                >::type
+            >
+        >::type
+    > map_type;
+
+    map_type m( TestFixture::kSize, 2 );
+    this->test_with_hash( m, TestFixture::kSize );
+}
+
+TYPED_TEST_P( SplitListMichaelMap, bulk_load )
+{
+    typedef typename TestFixture::rcu_type   rcu_type;
+    typedef typename TestFixture::key_type   key_type;
+    typedef typename TestFixture::value_type value_type;
+    typedef typename TestFixture::hash1      hash1;
+
+    typedef cc::SplitListMap< rcu_type, key_type, value_type,
+        typename cc::split_list::make_traits<
+            cc::split_list::ordered_list< cc::michael_list_tag >
+            , cds::opt::hash< hash1 >
+            , cc::split_list::ordered_list_traits<
+                typename cc::michael_list::make_traits<
+                    cds::opt::compare< typename TestFixture::cmp >
+                >::type
+            >
+        >::type
+    > map_type;
+
+    map_type m( TestFixture::kSize, 2 );
+    this->test_bulk_load( m, TestFixture::kSize );
+}
+
 REGISTER_TYPED_TEST_CASE_P( SplitListMichaelMap,
-    compare, less, cmpmix, item_counting, stat, back_off, free_list, static_bucket_table, static_bucket_table_free_list, bit_reversal_swar, bit_reversal_lookup, bit_reversal_muldiv
+    compare, less, cmpmix, item_counting, stat, back_off, free_list, static_bucket_table, static_bucket_table_free_list, bit_reversal_swar, bit_reversal_lookup, bit_reversal_muldiv, find_batch, with_hash, bulk_load
 );
 
 
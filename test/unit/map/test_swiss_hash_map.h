@@ -0,0 +1,432 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSUNIT_MAP_TEST_SWISS_HASH_MAP_H
+#define CDSUNIT_MAP_TEST_SWISS_HASH_MAP_H
+
+#include "test_map_data.h"
+#include <cds/threading/model.h>
+
+// forward declaration
+namespace cds { namespace container {} }
+
+namespace cds_test {
+
+    class swiss_hash_map: public map_fixture
+    {
+    public:
+        static size_t const kSize = 1000;
+
+    protected:
+        template <class Map>
+        void test( Map& m )
+        {
+            // Precondition: map is empty
+            // Postcondition: map is empty
+
+            EXPECT_TRUE( m.empty());
+            EXPECT_CONTAINER_SIZE( m, 0 );
+
+            typedef typename Map::value_type map_pair;
+            size_t const kkSize = kSize;
+
+            std::vector<key_type> arrKeys;
+            for ( int i = 0; i < static_cast<int>(kkSize); ++i )
+                arrKeys.push_back( key_type( i ));
+            shuffle( arrKeys.begin(), arrKeys.end());
+
+            std::vector< value_type > arrVals;
+            for ( size_t i = 0; i < kkSize; ++i ) {
+                value_type val;
+                val.nVal = static_cast<int>( i );
+                val.strVal = std::to_string( i );
+                arrVals.push_back( val );
+            }
+
+            // insert/find
+            for ( auto const& i : arrKeys ) {
+                value_type const& val( arrVals.at( i.nKey ));
+
+                EXPECT_FALSE( m.contains( i.nKey ));
+                EXPECT_FALSE( m.contains( i ));
+                EXPECT_FALSE( m.find( i, []( map_pair const& ) {
+                    EXPECT_TRUE( false );
+                } ));
+                EXPECT_FALSE( m.find( i.nKey, []( map_pair const& ) {
+                    EXPECT_TRUE( false );
+                } ));
+
+                std::pair< bool, bool > updResult;
+
+                switch ( i.nKey % 16 ) {
+                case 0:
+                    EXPECT_TRUE( m.insert( i ));
+                    EXPECT_FALSE( m.insert( i ));
+                    EXPECT_TRUE( m.find( i.nKey, []( map_pair& v ) {
+                        v.second.nVal = v.first.nKey;
+                        v.second.strVal = std::to_string( v.first.nKey );
+                    } ));
+                    break;
+                case 1:
+                    EXPECT_TRUE( m.insert( i.nKey ));
+                    EXPECT_FALSE( m.insert( i.nKey ));
+                    EXPECT_TRUE( m.find( i.nKey, []( map_pair& v ) {
+                        v.second.nVal = v.first.nKey;
+                        v.second.strVal = std::to_string( v.first.nKey );
+                    } ));
+                    break;
+                case 2:
+                    EXPECT_TRUE( m.insert( std::to_string( i.nKey )));
+                    EXPECT_FALSE( m.insert( std::to_string( i.nKey )));
+                    EXPECT_TRUE( m.find( i.nKey, []( map_pair& v ) {
+                        v.second.nVal = v.first.nKey;
+                        v.second.strVal = std::to_string( v.first.nKey );
+                    } ));
+                    break;
+                case 3:
+                    EXPECT_TRUE( m.insert( i, val ));
+                    EXPECT_FALSE( m.insert( i, val ));
+                    break;
+                case 4:
+                    EXPECT_TRUE( m.insert( i.nKey, val.strVal ));
+                    EXPECT_FALSE( m.insert( i.nKey, val.strVal ));
+                    break;
+                case 5:
+                    EXPECT_TRUE( m.insert( val.strVal, i.nKey ));
+                    EXPECT_FALSE( m.insert( val.strVal, i.nKey ));
+                    break;
+                case 6:
+                    EXPECT_TRUE( m.insert_with( i, []( map_pair& v ) {
+                        v.second.nVal = v.first.nKey;
+                        v.second.strVal = std::to_string( v.first.nKey );
+                    } ));
+                    EXPECT_FALSE( m.insert_with( i, []( map_pair& ) {
+                        EXPECT_TRUE( false );
+                    } ));
+                    break;
+                case 7:
+                    EXPECT_TRUE( m.insert_with( i.nKey, []( map_pair& v ) {
+                        v.second.nVal = v.first.nKey;
+                        v.second.strVal = std::to_string( v.first.nKey );
+                    } ));
+                    EXPECT_FALSE( m.insert_with( i.nKey, []( map_pair& ) {
+                        EXPECT_TRUE( false );
+                    } ));
+                    break;
+                case 8:
+                    EXPECT_TRUE( m.insert_with( val.strVal, []( map_pair& v ) {
+                        v.second.nVal = v.first.nKey;
+                        v.second.strVal = std::to_string( v.first.nKey );
+                    } ));
+                    EXPECT_FALSE( m.insert_with( val.strVal, []( map_pair& ) {
+                        EXPECT_TRUE( false );
+                    } ));
+                    break;
+                case 9:
+                    updResult = m.update( i.nKey, []( bool, map_pair& ) {
+                        EXPECT_TRUE( false );
+                    }, false );
+                    EXPECT_FALSE( updResult.first );
+                    EXPECT_FALSE( updResult.second );
+
+                    updResult = m.update( i.nKey, []( bool bNew, map_pair& v ) {
+                        EXPECT_TRUE( bNew );
+                        v.second.nVal = v.first.nKey;
+                    });
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_TRUE( updResult.second );
+
+                    updResult = m.update( i.nKey, []( bool bNew, map_pair& v ) {
+                        EXPECT_FALSE( bNew );
+                        EXPECT_EQ( v.first.nKey, v.second.nVal );
+                        v.second.strVal = std::to_string( v.second.nVal );
+                    } );
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_FALSE( updResult.second );
+                    break;
+                case 10:
+                    updResult = m.update( i, []( bool, map_pair& ) {
+                        EXPECT_TRUE( false );
+                    }, false );
+                    EXPECT_FALSE( updResult.first );
+                    EXPECT_FALSE( updResult.second );
+
+                    updResult = m.update( i, []( bool bNew, map_pair& v ) {
+                        EXPECT_TRUE( bNew );
+                        v.second.nVal = v.first.nKey;
+                    });
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_TRUE( updResult.second );
+
+                    updResult = m.update( i, []( bool bNew, map_pair& v ) {
+                        EXPECT_FALSE( bNew );
+                        EXPECT_EQ( v.first.nKey, v.second.nVal );
+                        v.second.strVal = std::to_string( v.second.nVal );
+                    } );
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_FALSE( updResult.second );
+                    break;
+                case 11:
+                    updResult = m.update( val.strVal, []( bool, map_pair& ) {
+                        EXPECT_TRUE( false );
+                    }, false );
+                    EXPECT_FALSE( updResult.first );
+                    EXPECT_FALSE( updResult.second );
+
+                    updResult = m.update( val.strVal, []( bool bNew, map_pair& v ) {
+                        EXPECT_TRUE( bNew );
+                        v.second.nVal = v.first.nKey;
+                    });
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_TRUE( updResult.second );
+
+                    updResult = m.update( val.strVal, []( bool bNew, map_pair& v ) {
+                        EXPECT_FALSE( bNew );
+                        EXPECT_EQ( v.first.nKey, v.second.nVal );
+                        v.second.strVal = std::to_string( v.second.nVal );
+                    } );
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_FALSE( updResult.second );
+                    break;
+                case 12:
+                    EXPECT_TRUE( m.emplace( i.nKey ));
+                    EXPECT_FALSE( m.emplace( i.nKey ));
+                    EXPECT_TRUE( m.find( i.nKey, []( map_pair& v ) {
+                        v.second.nVal = v.first.nKey;
+                        v.second.strVal = std::to_string( v.first.nKey );
+                    } ));
+                    break;
+                case 13:
+                    EXPECT_TRUE( m.emplace( i, i.nKey ));
+                    EXPECT_FALSE( m.emplace( i, i.nKey ));
+                    break;
+                case 14:
+                    {
+                        std::string str = val.strVal;
+                        EXPECT_TRUE( m.emplace( i, std::move( str )));
+                        EXPECT_TRUE( str.empty());
+                        str = val.strVal;
+                        EXPECT_FALSE( m.emplace( i, std::move( str )));
+                        EXPECT_TRUE( str.empty());
+                    }
+                    break;
+                case 15:
+                    {
+                        std::string str = val.strVal;
+                        EXPECT_TRUE( m.emplace( i, i.nKey, std::move( str )));
+                        EXPECT_TRUE( str.empty());
+                        str = val.strVal;
+                        EXPECT_FALSE( m.emplace( i, i.nKey, std::move( str )));
+                        EXPECT_TRUE( str.empty());
+                    }
+                    break;
+                }
+
+                EXPECT_TRUE( m.contains( i.nKey ));
+                EXPECT_TRUE( m.contains( i ));
+                EXPECT_TRUE( m.find( i, []( map_pair const& v ) {
+                    EXPECT_EQ( v.first.nKey, v.second.nVal );
+                    EXPECT_EQ( std::to_string( v.first.nKey ), v.second.strVal );
+                } ));
+                EXPECT_TRUE( m.find( i.nKey, []( map_pair const& v ) {
+                    EXPECT_EQ( v.first.nKey, v.second.nVal );
+                    EXPECT_EQ( std::to_string( v.first.nKey ), v.second.strVal );
+                } ));
+            }
+            EXPECT_FALSE( m.empty());
+            EXPECT_CONTAINER_SIZE( m, kkSize );
+
+            shuffle( arrKeys.begin(), arrKeys.end());
+
+            // erase/find
+            for ( auto const& i : arrKeys ) {
+                value_type const& val( arrVals.at( i.nKey ));
+
+                EXPECT_TRUE( m.contains( i.nKey ));
+                EXPECT_TRUE( m.contains( val.strVal ));
+                EXPECT_TRUE( m.contains( i ));
+                EXPECT_TRUE( m.find( i, []( map_pair const& v ) {
+                    EXPECT_EQ( v.first.nKey, v.second.nVal );
+                    EXPECT_EQ( std::to_string( v.first.nKey ), v.second.strVal );
+                } ));
+                EXPECT_TRUE( m.find( i.nKey, []( map_pair const& v ) {
+                    EXPECT_EQ( v.first.nKey, v.second.nVal );
+                    EXPECT_EQ( std::to_string( v.first.nKey ), v.second.strVal );
+                } ));
+
+
+                switch ( i.nKey % 6 ) {
+                case 0:
+                    EXPECT_TRUE( m.erase( i ));
+                    EXPECT_FALSE( m.erase( i ));
+                    break;
+                case 1:
+                    EXPECT_TRUE( m.erase( i.nKey ));
+                    EXPECT_FALSE( m.erase( i.nKey ));
+                    break;
+                case 2:
+                    EXPECT_TRUE( m.erase( val.strVal ));
+                    EXPECT_FALSE( m.erase( val.strVal ));
+                    break;
+                case 3:
+                    EXPECT_TRUE( m.erase( i, []( map_pair& v ) {
+                        EXPECT_EQ( v.first.nKey, v.second.nVal );
+                        EXPECT_EQ( std::to_string( v.first.nKey ), v.second.strVal );
+                    }));
+                    EXPECT_FALSE( m.erase( i, []( map_pair& ) {
+                        EXPECT_TRUE( false );
+                    }));
+                    break;
+                case 4:
+                    EXPECT_TRUE( m.erase( i.nKey, []( map_pair& v ) {
+                        EXPECT_EQ( v.first.nKey, v.second.nVal );
+                        EXPECT_EQ( std::to_string( v.first.nKey ), v.second.strVal );
+                    }));
+                    EXPECT_FALSE( m.erase( i.nKey, []( map_pair& ) {
+                        EXPECT_TRUE( false );
+                    }));
+                    break;
+                case 5:
+                    EXPECT_TRUE( m.erase( val.strVal, []( map_pair& v ) {
+                        EXPECT_EQ( v.first.nKey, v.second.nVal );
+                        EXPECT_EQ( std::to_string( v.first.nKey ), v.second.strVal );
+                    }));
+                    EXPECT_FALSE( m.erase( val.strVal, []( map_pair& ) {
+                        EXPECT_TRUE( false );
+                    }));
+                    break;
+                }
+
+                EXPECT_FALSE( m.contains( i.nKey ));
+                EXPECT_FALSE( m.contains( i ));
+                EXPECT_FALSE( m.contains( val.strVal ));
+                EXPECT_FALSE( m.find( i, []( map_pair const& ) {
+                    EXPECT_TRUE( false );
+                } ));
+                EXPECT_FALSE( m.find( i.nKey, []( map_pair const& ) {
+                    EXPECT_TRUE( false );
+                } ));
+            }
+            EXPECT_TRUE( m.empty());
+            EXPECT_CONTAINER_SIZE( m, 0 );
+
+            // clear
+            for ( auto const& i : arrKeys )
+                EXPECT_TRUE( m.insert( i ));
+
+            EXPECT_FALSE( m.empty());
+            EXPECT_CONTAINER_SIZE( m, kkSize );
+
+            m.clear();
+
+            EXPECT_TRUE( m.empty());
+            EXPECT_CONTAINER_SIZE( m, 0 );
+        }
+
+        template <class Map>
+        void test_grow( Map& m )
+        {
+            // Precondition: map is empty, the initial table is small
+            // Postcondition: map is empty
+
+            EXPECT_TRUE( m.empty());
+            typedef typename Map::value_type map_pair;
+            size_t const kkSize = kSize * 8;
+            size_t const nInitialCapacity = m.capacity();
+
+            std::vector<int> arrKeys;
+            for ( int i = 0; i < static_cast<int>( kkSize ); ++i )
+                arrKeys.push_back( i );
+            shuffle( arrKeys.begin(), arrKeys.end());
+
+            size_t nCapacity = nInitialCapacity;
+            for ( size_t n = 0; n < kkSize; ++n ) {
+                int const key = arrKeys[n];
+                EXPECT_TRUE( m.insert( key, key ));
+
+                // the table never shrinks
+                EXPECT_GE( m.capacity(), nCapacity );
+                nCapacity = m.capacity();
+
+                // Each item inserted before is reachable while the groups are being migrated
+                int const prev = arrKeys[ n / 2 ];
+                EXPECT_TRUE( m.find( prev, [prev]( map_pair const& v ) {
+                    EXPECT_EQ( v.first.nKey, prev );
+                    EXPECT_EQ( v.second.nVal, prev );
+                } ));
+            }
+            EXPECT_CONTAINER_SIZE( m, kkSize );
+            EXPECT_GT( m.capacity(), nInitialCapacity );
+            EXPECT_LE( m.size(), m.capacity());
+
+            for ( int key : arrKeys ) {
+                EXPECT_TRUE( m.contains( key ));
+                EXPECT_FALSE( m.insert( key ));
+            }
+
+            // erase/insert churn leaves tombstones that are dropped by the same-size rehashing
+            shuffle( arrKeys.begin(), arrKeys.end());
+            for ( size_t nPass = 0; nPass < 4; ++nPass ) {
+                for ( size_t n = 0; n < kkSize / 2; ++n )
+                    EXPECT_TRUE( m.erase( arrKeys[n] ));
+                for ( size_t n = 0; n < kkSize; ++n )
+                    EXPECT_EQ( m.contains( arrKeys[n] ), n >= kkSize / 2 );
+                EXPECT_CONTAINER_SIZE( m, kkSize - kkSize / 2 );
+                for ( size_t n = 0; n < kkSize / 2; ++n )
+                    EXPECT_TRUE( m.insert( arrKeys[n], arrKeys[n] ));
+                EXPECT_CONTAINER_SIZE( m, kkSize );
+            }
+            EXPECT_GE( m.capacity(), nCapacity );
+
+            m.clear();
+            EXPECT_TRUE( m.empty());
+            EXPECT_CONTAINER_SIZE( m, 0 );
+            for ( int key : arrKeys )
+                EXPECT_FALSE( m.contains( key ));
+        }
+
+        template <typename Map>
+        void test_rehash( Map& m )
+        {
+            // Precondition: map is empty
+            // Postcondition: map is empty
+
+            EXPECT_TRUE( m.empty());
+            size_t const nCapacity = m.capacity();
+
+            // Insert/erase churn of distinct keys leaves tombstones, the live items take at most half of the table,
+            // so the table is rehashed to the same size. The keys are spread over the groups
+            int const nBatch = static_cast<int>( nCapacity / 2 );
+            int const nSpread = 7919;
+            int nKey = 0;
+            while ( m.statistics().m_nRehash.get() == 0 ) {
+                ASSERT_LT( static_cast<size_t>( nKey ), nCapacity * 64 );
+                for ( int i = 0; i < nBatch; ++i )
+                    EXPECT_TRUE( m.insert(( nKey + i ) * nSpread, nKey + i ));
+                for ( int i = 0; i < nBatch; ++i )
+                    EXPECT_TRUE( m.erase(( nKey + i ) * nSpread ));
+                nKey += nBatch;
+            }
+            EXPECT_EQ( m.capacity(), nCapacity );
+            EXPECT_TRUE( m.empty());
+
+            // The same-size table has no room for new items while the tombstones are being migrated:
+            // the inserters finish the migration first
+            for ( int i = 0; i < 16; ++i )
+                EXPECT_TRUE( m.insert( -i - 1, i ));
+            EXPECT_CONTAINER_SIZE( m, 16u );
+            for ( int i = 0; i < 16; ++i )
+                EXPECT_TRUE( m.contains( -i - 1 ));
+            for ( int i = 0; i < nKey; ++i )
+                EXPECT_FALSE( m.contains( i * nSpread ));
+
+            m.clear();
+            EXPECT_TRUE( m.empty());
+        }
+    };
+
+} // namespace cds_test
+
+#endif // #ifndef CDSUNIT_MAP_TEST_SWISS_HASH_MAP_H
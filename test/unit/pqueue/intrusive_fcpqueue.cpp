@@ -0,0 +1,217 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_data.h"
+#include <cds/intrusive/fcpriority_queue.h>
+#include <vector>
+
+namespace {
+
+    class IntrusiveFCPQueue : public cds_test::PQueueTest
+    {
+        typedef cds_test::PQueueTest base_class;
+
+    public:
+        struct item: public cds::intrusive::fcpqueue::node
+        {
+            key_type    k;
+            size_t      nDisposeCount;
+
+            item()
+                : k( 0 )
+                , nDisposeCount( 0 )
+            {}
+        };
+
+        struct item_less
+        {
+            bool operator()( item const& i1, item const& i2 ) const
+            {
+                return i1.k < i2.k;
+            }
+        };
+
+        struct item_cmp
+        {
+            int operator()( item const& i1, item const& i2 ) const
+            {
+                return i1.k < i2.k ? -1 : i2.k < i1.k ? 1 : 0;
+            }
+        };
+
+        struct item_disposer
+        {
+            void operator()( item * p )
+            {
+                ++p->nDisposeCount;
+            }
+        };
+
+    protected:
+        template <class PQueue>
+        void test( PQueue& pq )
+        {
+            data_array<value_type> arr( base_class::c_nCapacity );
+            std::vector<item> items( base_class::c_nCapacity );
+            for ( size_t i = 0; i < items.size(); ++i )
+                items[i].k = arr.begin()[i].k;
+
+            ASSERT_TRUE( pq.empty());
+            ASSERT_EQ( pq.size(), 0u );
+            ASSERT_TRUE( pq.pop() == nullptr );
+
+            // Push test
+            size_t nSize = 0;
+            for ( auto& i : items ) {
+                ASSERT_TRUE( pq.push( i ));
+                ASSERT_FALSE( pq.empty());
+                ASSERT_EQ( pq.size(), ++nSize );
+            }
+
+            // Pop test
+            key_type nPrev = base_class::c_nMinValue + key_type( base_class::c_nCapacity );
+            while ( !pq.empty()) {
+                item * p = pq.pop();
+                ASSERT_TRUE( p != nullptr );
+                EXPECT_EQ( p->k, nPrev - 1 );
+                nPrev = p->k;
+                ASSERT_EQ( pq.size(), --nSize );
+
+                // p is not in the queue
+                ASSERT_FALSE( pq.erase( *p ));
+                ASSERT_FALSE( pq.update( *p, []( item& ) { ASSERT_TRUE( false ); } ));
+            }
+            EXPECT_EQ( nPrev, base_class::c_nMinValue );
+            ASSERT_TRUE( pq.pop() == nullptr );
+
+            // Erase test: remove the items with odd keys from any position
+            for ( auto& i : items )
+                ASSERT_TRUE( pq.push( i ));
+            nSize = items.size();
+            for ( auto& i : items ) {
+                if ( i.k & 1 ) {
+                    ASSERT_TRUE( pq.erase( i ));
+                    ASSERT_FALSE( pq.erase( i ));
+                    ASSERT_EQ( pq.size(), --nSize );
+                }
+            }
+            nPrev = base_class::c_nMinValue + key_type( base_class::c_nCapacity ) + 2;
+            while ( item * p = pq.pop()) {
+                EXPECT_EQ( p->k & 1, 0 );
+                EXPECT_LT( p->k, nPrev );
+                nPrev = p->k;
+                --nSize;
+            }
+            EXPECT_EQ( nSize, 0u );
+
+            // Update test: increase and decrease the priority
+            for ( auto& i : items )
+                ASSERT_TRUE( pq.push( i ));
+            nSize = items.size();
+            key_type const nShift = key_type( base_class::c_nCapacity ) * 2;
+            for ( size_t n = 0; n < items.size(); ++n ) {
+                item& i = items[n];
+                if ( n & 1 )
+                    ASSERT_TRUE( pq.update( i, [nShift]( item& v ) { v.k += nShift; } ));
+                else
+                    ASSERT_TRUE( pq.update( i, [nShift]( item& v ) { v.k -= nShift; } ));
+            }
+            ASSERT_EQ( pq.size(), nSize );
+
+            nPrev = std::numeric_limits<key_type>::max();
+            while ( item * p = pq.pop()) {
+                EXPECT_LE( p->k, nPrev );
+                nPrev = p->k;
+                --nSize;
+                if ( nSize >= items.size() / 2 )
+                    EXPECT_GE( p->k, base_class::c_nMinValue + nShift );
+                else
+                    EXPECT_LT( p->k, base_class::c_nMinValue );
+            }
+            EXPECT_EQ( nSize, 0u );
+
+            // Clear test
+            for ( auto& i : items )
+                ASSERT_TRUE( pq.push( i ));
+            ASSERT_EQ( pq.size(), items.size());
+            pq.clear();
+            ASSERT_TRUE( pq.empty());
+            for ( auto& i : items ) {
+                ASSERT_FALSE( pq.erase( i ));
+                EXPECT_EQ( i.nDisposeCount, 0u );
+            }
+
+            // Clear and dispose test
+            for ( auto& i : items )
+                ASSERT_TRUE( pq.push( i ));
+            pq.clear( true );
+            ASSERT_TRUE( pq.empty());
+            ASSERT_EQ( pq.size(), 0u );
+            for ( auto& i : items )
+                EXPECT_EQ( i.nDisposeCount, 1u );
+        }
+    };
+
+    TEST_F( IntrusiveFCPQueue, less )
+    {
+        typedef cds::intrusive::FCPriorityQueue< item,
+            cds::intrusive::fcpqueue::make_traits<
+                cds::opt::less< item_less >
+                ,cds::intrusive::opt::disposer< item_disposer >
+            >::type
+        > pqueue;
+
+        pqueue pq;
+        test( pq );
+    }
+
+    TEST_F( IntrusiveFCPQueue, cmp )
+    {
+        struct pqueue_traits: public cds::intrusive::fcpqueue::traits
+        {
+            typedef IntrusiveFCPQueue::item_cmp compare;
+            typedef IntrusiveFCPQueue::item_disposer disposer;
+        };
+        typedef cds::intrusive::FCPriorityQueue< item, pqueue_traits > pqueue;
+
+        pqueue pq;
+        test( pq );
+    }
+
+    TEST_F( IntrusiveFCPQueue, mutex )
+    {
+        struct pqueue_traits: public cds::intrusive::fcpqueue::traits
+        {
+            typedef IntrusiveFCPQueue::item_cmp compare;
+            typedef IntrusiveFCPQueue::item_disposer disposer;
+            typedef std::mutex lock_type;
+        };
+        typedef cds::intrusive::FCPriorityQueue< item, pqueue_traits > pqueue;
+
+        pqueue pq;
+        test( pq );
+    }
+
+    TEST_F( IntrusiveFCPQueue, stat )
+    {
+        typedef cds::intrusive::FCPriorityQueue< item,
+            cds::intrusive::fcpqueue::make_traits<
+                cds::opt::less< item_less >
+                ,cds::intrusive::opt::disposer< item_disposer >
+                ,cds::opt::stat< cds::intrusive::fcpqueue::stat<> >
+            >::type
+        > pqueue;
+
+        pqueue pq;
+        test( pq );
+
+        EXPECT_EQ( pq.statistics().m_nPush.get(), static_cast<size_t>( c_nCapacity ) * 5 );
+        EXPECT_EQ( pq.statistics().m_nErase.get(), static_cast<size_t>( c_nCapacity ) / 2 );
+        EXPECT_EQ( pq.statistics().m_nUpdate.get(), static_cast<size_t>( c_nCapacity ));
+        EXPECT_GT( pq.statistics().m_nFailedErase.get(), 0u );
+        EXPECT_GT( pq.statistics().m_nFailedUpdate.get(), 0u );
+    }
+
+} // namespace
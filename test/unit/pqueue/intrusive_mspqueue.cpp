@@ -119,10 +119,58 @@ namespace {
                 ASSERT_EQ( disp.m_nCallCount, pq.capacity());
             }
         }
+
+        template <class PQueue>
+        void test_growable( PQueue& pq )
+        {
+            data_array<value_type> arr( base_class::c_nCapacity );
+            value_type * pFirst = arr.begin();
+            value_type * pLast = arr.end();
+
+            ASSERT_TRUE( pq.empty());
+            size_t const nInitialCapacity = pq.capacity();
+            ASSERT_LT( nInitialCapacity, static_cast<size_t>( base_class::c_nCapacity ));
+
+            // Push test: the heap grows
+            size_t nSize = 0;
+            for ( value_type * p = pFirst; p < pLast; ++p ) {
+                ASSERT_TRUE( pq.push( *p ));
+                ASSERT_EQ( pq.size(), ++nSize );
+                ASSERT_GE( pq.capacity(), nSize );
+            }
+            ASSERT_GE( pq.capacity(), static_cast<size_t>( base_class::c_nCapacity ));
+            EXPECT_GT( pq.statistics().m_nHeapGrowCount.get(), 0u );
+            EXPECT_EQ( pq.statistics().m_nPushFailCount.get(), 0u );
+
+            // Pop test
+            key_type nPrev = base_class::c_nMinValue + key_type( base_class::c_nCapacity );
+            while ( !pq.empty()) {
+                value_type * p = pq.pop();
+                ASSERT_TRUE( p != nullptr );
+                EXPECT_EQ( p->k, nPrev - 1 );
+                nPrev = p->k;
+                ASSERT_EQ( pq.size(), --nSize );
+            }
+            EXPECT_EQ( nPrev, base_class::c_nMinValue );
+            ASSERT_TRUE( pq.pop() == nullptr );
+
+            // The heap does not shrink
+            size_t const nCapacity = pq.capacity();
+            for ( value_type * p = pFirst; p < pLast; ++p )
+                ASSERT_TRUE( pq.push( *p ));
+            EXPECT_EQ( pq.capacity(), nCapacity );
+
+            disposer disp;
+            pq.clear_with( std::ref( disp ));
+            ASSERT_TRUE( pq.empty());
+            ASSERT_EQ( disp.m_nCallCount, static_cast<size_t>( base_class::c_nCapacity ));
+        }
     };
 
     typedef cds::opt::v::initialized_dynamic_buffer< char > dyn_buffer_type;
     typedef cds::opt::v::initialized_static_buffer< char, IntrusiveMSPQueue::c_nCapacity > static_buffer_type;
+    typedef cds::opt::v::initialized_dynamic_buffer< char, CDS_DEFAULT_ALLOCATOR, false > dyn_buffer_exact_type;
+    typedef cds::intrusive::mspriority_queue::growable_buffer< char > growable_buffer_type;
 
     TEST_F( IntrusiveMSPQueue, dynamic )
     {
@@ -242,4 +290,75 @@ namespace {
         test( *pq );
     }
 
+    TEST_F( IntrusiveMSPQueue, arity4 )
+    {
+        typedef cds::intrusive::MSPriorityQueue< value_type,
+            cds::intrusive::mspriority_queue::make_traits<
+                cds::opt::buffer< dyn_buffer_exact_type >
+                ,cds::intrusive::mspriority_queue::arity< 4 >
+            >::type
+        > pqueue;
+
+        // capacity() is the size of the heap array minus ( arity - 1 )
+        pqueue pq( c_nCapacity + 2 );
+        test( pq );
+    }
+
+    TEST_F( IntrusiveMSPQueue, arity8_cmp )
+    {
+        typedef cds::intrusive::MSPriorityQueue< value_type,
+            cds::intrusive::mspriority_queue::make_traits<
+                cds::opt::buffer< dyn_buffer_exact_type >
+                ,cds::intrusive::mspriority_queue::arity< 8 >
+                ,cds::opt::compare< compare >
+            >::type
+        > pqueue;
+
+        pqueue pq( c_nCapacity + 6 );
+        test( pq );
+    }
+
+    TEST_F( IntrusiveMSPQueue, growable )
+    {
+        typedef cds::intrusive::MSPriorityQueue< value_type,
+            cds::intrusive::mspriority_queue::make_traits<
+                cds::opt::buffer< growable_buffer_type >
+                ,cds::opt::stat< cds::intrusive::mspriority_queue::stat<> >
+            >::type
+        > pqueue;
+
+        pqueue pq( 10 );
+        test_growable( pq );
+    }
+
+    TEST_F( IntrusiveMSPQueue, growable_arity4 )
+    {
+        typedef cds::intrusive::MSPriorityQueue< value_type,
+            cds::intrusive::mspriority_queue::make_traits<
+                cds::opt::buffer< growable_buffer_type >
+                ,cds::intrusive::mspriority_queue::arity< 4 >
+                ,cds::opt::stat< cds::intrusive::mspriority_queue::stat<> >
+            >::type
+        > pqueue;
+
+        pqueue pq( 10 );
+        test_growable( pq );
+    }
+
+    TEST_F( IntrusiveMSPQueue, growable_arity8_mutex )
+    {
+        typedef cds::intrusive::MSPriorityQueue< value_type,
+            cds::intrusive::mspriority_queue::make_traits<
+                cds::opt::buffer< growable_buffer_type >
+                ,cds::intrusive::mspriority_queue::arity< 8 >
+                ,cds::opt::less< less >
+                ,cds::opt::lock_type< std::mutex >
+                ,cds::opt::stat< cds::intrusive::mspriority_queue::stat<> >
+            >::type
+        > pqueue;
+
+        pqueue pq( 0 );
+        test_growable( pq );
+    }
+
 } // namespace
@@ -0,0 +1,106 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_intrusive_timer_wheel.h"
+
+#include <cds/gc/hp.h>
+
+namespace {
+
+    namespace ci = cds::intrusive;
+    typedef cds::gc::HP gc_type;
+    typedef ci::timer_wheel::base_hook< ci::opt::gc< gc_type >> base_hook;
+
+    class IntrusiveTimerWheel_HP : public cds_test::IntrusiveTimerWheel
+    {
+        typedef cds_test::IntrusiveTimerWheel base_class;
+
+    protected:
+        void SetUp()
+        {
+            typedef ci::TimerWheel< gc_type, base_hook_item<gc_type>,
+                ci::timer_wheel::make_traits< ci::opt::hook< base_hook >>::type
+            > wheel_type;
+
+            cds::gc::hp::GarbageCollector::Construct( wheel_type::c_nHazardPtrCount, 1, 16 );
+            cds::threading::Manager::attachThread();
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            cds::gc::hp::GarbageCollector::Destruct( true );
+        }
+
+        template <typename Wheel>
+        void test()
+        {
+            Wheel wheel;
+            base_class::test( wheel );
+        }
+    };
+
+    TEST_F( IntrusiveTimerWheel_HP, base )
+    {
+        typedef ci::TimerWheel< gc_type, base_hook_item<gc_type>,
+            ci::timer_wheel::make_traits<
+                ci::opt::hook< base_hook >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+            >::type
+        > wheel_type;
+
+        test<wheel_type>();
+    }
+
+    TEST_F( IntrusiveTimerWheel_HP, base_small )
+    {
+        typedef ci::TimerWheel< gc_type, base_hook_item<gc_type>,
+            ci::timer_wheel::make_traits<
+                ci::opt::hook< base_hook >
+                ,ci::timer_wheel::slot_bits< 2 >
+                ,ci::timer_wheel::level_count< 3 >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cds::opt::stat< ci::timer_wheel::stat<> >
+            >::type
+        > wheel_type;
+
+        test<wheel_type>();
+    }
+
+    TEST_F( IntrusiveTimerWheel_HP, base_one_level )
+    {
+        typedef ci::TimerWheel< gc_type, base_hook_item<gc_type>,
+            ci::timer_wheel::make_traits<
+                ci::opt::hook< base_hook >
+                ,ci::timer_wheel::level_count< 1 >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+            >::type
+        > wheel_type;
+
+        test<wheel_type>();
+    }
+
+    TEST_F( IntrusiveTimerWheel_HP, member )
+    {
+        typedef ci::TimerWheel< gc_type, member_hook_item<gc_type>,
+            ci::timer_wheel::make_traits<
+                ci::opt::hook<
+                    ci::timer_wheel::member_hook<
+                        offsetof( member_hook_item<gc_type>, hMember ),
+                        ci::opt::gc< gc_type >
+                    >
+                >
+                ,ci::timer_wheel::slot_bits< 3 >
+                ,ci::timer_wheel::level_count< 2 >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cds::opt::lock_type< std::mutex >
+                ,cds::opt::stat< ci::timer_wheel::stat<> >
+            >::type
+        > wheel_type;
+
+        test<wheel_type>();
+    }
+
+} // namespace
@@ -135,10 +135,56 @@ namespace {
                 ASSERT_EQ( disp.m_nCallCount, pq.capacity());
             }
         }
+
+        template <class PQueue>
+        void test_growable( PQueue& pq )
+        {
+            data_array<value_type> arr( base_class::c_nCapacity );
+            value_type * pFirst = arr.begin();
+            value_type * pLast = arr.end();
+
+            ASSERT_TRUE( pq.empty());
+            ASSERT_LT( pq.capacity(), static_cast<size_t>( base_class::c_nCapacity ));
+
+            // Push test: the heap grows
+            size_t nSize = 0;
+            for ( value_type * p = pFirst; p < pLast; ++p ) {
+                if ( nSize & 1 )
+                    ASSERT_TRUE( pq.push( *p ));
+                else
+                    ASSERT_TRUE( pq.emplace( p->k, p->v ));
+                ASSERT_EQ( pq.size(), ++nSize );
+            }
+            ASSERT_GE( pq.capacity(), static_cast<size_t>( base_class::c_nCapacity ));
+            EXPECT_GT( pq.statistics().m_nHeapGrowCount.get(), 0u );
+
+            // Pop test
+            key_type nPrev = base_class::c_nMinValue + key_type( base_class::c_nCapacity );
+            value_type kv( 0 );
+            while ( pq.pop( kv )) {
+                EXPECT_EQ( kv.k, nPrev - 1 );
+                EXPECT_EQ( kv.v, kv.k );
+                nPrev = kv.k;
+                ASSERT_EQ( pq.size(), --nSize );
+            }
+            EXPECT_EQ( nPrev, base_class::c_nMinValue );
+            ASSERT_TRUE( pq.empty());
+
+            // clear_with test
+            for ( value_type * p = pFirst; p < pLast; ++p )
+                ASSERT_TRUE( pq.push( *p ));
+
+            disposer disp;
+            pq.clear_with( std::ref( disp ));
+            ASSERT_TRUE( pq.empty());
+            ASSERT_EQ( disp.m_nCallCount, static_cast<size_t>( base_class::c_nCapacity ));
+        }
     };
 
     typedef cds::opt::v::initialized_dynamic_buffer< char > dyn_buffer_type;
     typedef cds::opt::v::initialized_static_buffer< char, MSPQueue::c_nCapacity > static_buffer_type;
+    typedef cds::opt::v::initialized_dynamic_buffer< char, CDS_DEFAULT_ALLOCATOR, false > dyn_buffer_exact_type;
+    typedef cds::container::mspriority_queue::growable_buffer< char > growable_buffer_type;
 
     TEST_F( MSPQueue, dynamic )
     {
@@ -257,4 +303,60 @@ namespace {
         test( *pq );
     }
 
+    TEST_F( MSPQueue, arity4 )
+    {
+        typedef cds::container::MSPriorityQueue< value_type,
+            cds::container::mspriority_queue::make_traits<
+                cds::opt::buffer< dyn_buffer_exact_type >
+                ,cds::container::mspriority_queue::arity< 4 >
+            >::type
+        > pqueue;
+
+        // capacity() is the size of the heap array minus ( arity - 1 )
+        pqueue pq( c_nCapacity + 2 );
+        test( pq );
+    }
+
+    TEST_F( MSPQueue, arity8_less )
+    {
+        typedef cds::container::MSPriorityQueue< value_type,
+            cds::container::mspriority_queue::make_traits<
+                cds::opt::buffer< dyn_buffer_exact_type >
+                ,cds::container::mspriority_queue::arity< 8 >
+                ,cds::opt::less< less >
+            >::type
+        > pqueue;
+
+        pqueue pq( c_nCapacity + 6 );
+        test( pq );
+    }
+
+    TEST_F( MSPQueue, growable )
+    {
+        typedef cds::container::MSPriorityQueue< value_type,
+            cds::container::mspriority_queue::make_traits<
+                cds::opt::buffer< growable_buffer_type >
+                ,cds::opt::stat< cds::container::mspriority_queue::stat<> >
+            >::type
+        > pqueue;
+
+        pqueue pq( 16 );
+        test_growable( pq );
+    }
+
+    TEST_F( MSPQueue, growable_arity8 )
+    {
+        typedef cds::container::MSPriorityQueue< value_type,
+            cds::container::mspriority_queue::make_traits<
+                cds::opt::buffer< growable_buffer_type >
+                ,cds::container::mspriority_queue::arity< 8 >
+                ,cds::opt::compare< compare >
+                ,cds::opt::stat< cds::container::mspriority_queue::stat<> >
+            >::type
+        > pqueue;
+
+        pqueue pq( 16 );
+        test_growable( pq );
+    }
+
 } // namespace
@@ -0,0 +1,154 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_data.h"
+#include <cds/container/multi_queue.h>
+
+namespace {
+
+    class MultiQueue : public cds_test::PQueueTest
+    {
+        typedef cds_test::PQueueTest base_class;
+
+    protected:
+        template <class PQueue>
+        void test( PQueue& pq )
+        {
+            data_array<value_type> arr( base_class::c_nCapacity );
+            value_type * pFirst = arr.begin();
+            value_type * pLast = arr.end();
+
+            ASSERT_GE( pq.heap_count(), 2u );
+            ASSERT_TRUE( pq.empty());
+            ASSERT_EQ( pq.size(), 0u );
+
+            // Push test
+            size_t nSize = 0;
+            for ( value_type * p = pFirst; p < pLast; ++p ) {
+                ASSERT_TRUE( pq.push( *p ));
+                ASSERT_FALSE( pq.empty());
+                ASSERT_EQ( pq.size(), ++nSize );
+            }
+
+            // Pop test
+            // The queue is relaxed: any item may be popped but each item is popped exactly once
+            std::vector<bool> popped( base_class::c_nCapacity, false );
+            value_type kv( 0 );
+            while ( nSize > 0 ) {
+                ASSERT_TRUE( pq.pop( kv ));
+                ASSERT_GE( kv.k, base_class::c_nMinValue );
+                ASSERT_LT( kv.k, base_class::c_nMinValue + base_class::c_nCapacity );
+                size_t const nIdx = static_cast<size_t>( kv.k - base_class::c_nMinValue );
+                ASSERT_FALSE( popped[nIdx] ) << "key=" << kv.k;
+                popped[nIdx] = true;
+                EXPECT_EQ( kv.v, kv.k );
+                ASSERT_EQ( pq.size(), --nSize );
+            }
+            ASSERT_TRUE( pq.empty());
+
+            // pop from empty pqueue
+            kv.k = base_class::c_nCapacity * 2;
+            ASSERT_FALSE( pq.pop( kv ));
+            EXPECT_EQ( kv.k, base_class::c_nCapacity * 2 );
+
+            // The top of the heap is popped: in one heap the order is preserved
+            {
+                PQueue q1( 1 );
+                ASSERT_EQ( q1.heap_count(), 2u );
+                for ( value_type * p = pFirst; p < pLast; ++p )
+                    ASSERT_TRUE( q1.push( *p ));
+
+                // the item with highest priority is in one of two heaps
+                key_type const nMax = base_class::c_nMinValue + base_class::c_nCapacity - 1;
+                bool bFound = false;
+                for ( int i = 0; i < 2 && !bFound; ++i ) {
+                    ASSERT_TRUE( q1.pop( kv ));
+                    bFound = kv.k == nMax;
+                }
+                EXPECT_TRUE( bFound );
+            }
+
+            // emplace test
+            for ( key_type k = 0; k < 100; ++k )
+                ASSERT_TRUE( pq.emplace( k, k ));
+            ASSERT_EQ( pq.size(), 100u );
+
+            // Clear test
+            for ( value_type * p = pFirst; p < pLast; ++p )
+                ASSERT_TRUE( pq.push( *p ));
+            ASSERT_EQ( pq.size(), static_cast<size_t>( base_class::c_nCapacity + 100 ));
+
+            pq.clear();
+            ASSERT_TRUE( pq.empty());
+            ASSERT_EQ( pq.size(), 0u );
+            ASSERT_FALSE( pq.pop( kv ));
+        }
+    };
+
+    TEST_F( MultiQueue, less )
+    {
+        typedef cds::container::MultiQueue< value_type,
+            cds::container::multi_queue::make_traits<
+                cds::opt::less< less >
+            >::type
+        > pqueue_type;
+
+        pqueue_type pq( 8 );
+        ASSERT_EQ( pq.heap_count(), 8u );
+        test( pq );
+    }
+
+    TEST_F( MultiQueue, cmp )
+    {
+        typedef cds::container::MultiQueue< value_type,
+            cds::container::multi_queue::make_traits<
+                cds::opt::compare< compare >
+            >::type
+        > pqueue_type;
+
+        pqueue_type pq( 4 );
+        test( pq );
+    }
+
+    TEST_F( MultiQueue, mutex )
+    {
+        typedef cds::container::MultiQueue< value_type,
+            cds::container::multi_queue::make_traits<
+                cds::opt::less< less >
+                , cds::opt::lock_type< std::mutex >
+            >::type
+        > pqueue_type;
+
+        pqueue_type pq;
+        test( pq );
+    }
+
+    TEST_F( MultiQueue, stat )
+    {
+        struct pqueue_traits : public cds::container::multi_queue::traits
+        {
+            typedef cds::container::multi_queue::stat<> stat;
+            enum { padding = cds::opt::no_special_padding };
+        };
+        typedef cds::container::MultiQueue< value_type, pqueue_traits > pqueue_type;
+
+        pqueue_type pq( 16 );
+        test( pq );
+
+        pqueue_type::stat const& s = pq.statistics();
+        EXPECT_EQ( s.m_nPush.get(), static_cast<size_t>( c_nCapacity * 2 + 100 ));
+        EXPECT_EQ( s.m_nPop.get(), static_cast<size_t>( c_nCapacity ));
+        EXPECT_EQ( s.m_nPushCollision.get(), 0u );
+        EXPECT_EQ( s.m_nPopCollision.get(), 0u );
+        EXPECT_LE( s.m_nPopTwoChoice.get() + s.m_nPopOneChoice.get(), s.m_nPop.get());
+        EXPECT_GT( s.m_nPopTwoChoice.get(), 0u );
+        EXPECT_GE( s.m_nPopEmpty.get(), 2u );
+        EXPECT_LE( s.m_nRankSample.get(), s.m_nPop.get());
+        EXPECT_LE( s.m_nRankExact.get(), s.m_nRankSample.get());
+        EXPECT_LE( s.m_nMaxRankError.load( atomics::memory_order_relaxed ), s.m_nRankErrorSum.get());
+        EXPECT_LE( s.m_nMaxRankError.load( atomics::memory_order_relaxed ), s.m_nPush.get());
+    }
+
+} // namespace
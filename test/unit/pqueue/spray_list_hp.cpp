@@ -0,0 +1,108 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_spray_list.h"
+
+#include <cds/container/spray_list_hp.h>
+
+namespace {
+
+    namespace cc = cds::container;
+    typedef cds::gc::HP gc_type;
+
+    struct stat_traits : public cc::spray_list::traits
+    {
+        typedef cc::spray_list::stat<> stat;
+        typedef cds_test::SprayList::copy_value copy_policy;
+        static constexpr const size_t bound_offset = 4;
+    };
+
+    class SprayList_HP : public cds_test::SprayList
+    {
+    protected:
+        void SetUp()
+        {
+            // 2 * max height + 3 hazard pointers are required for the skip-list
+            cds::gc::hp::GarbageCollector::Construct( cds::intrusive::skip_list::c_nHeightLimit * 2 + 3, 1, 16 );
+            cds::threading::Manager::attachThread();
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            cds::gc::hp::GarbageCollector::Destruct( true );
+        }
+    };
+
+    TEST_F( SprayList_HP, less )
+    {
+        typedef cc::SprayList< gc_type, value_type,
+            cc::spray_list::make_traits<
+                cds::opt::less< less >
+                , cds::opt::copy_policy< copy_value >
+            >::type
+        > pqueue_type;
+
+        pqueue_type pq;
+        test( pq );
+    }
+
+    TEST_F( SprayList_HP, cmp )
+    {
+        typedef cc::SprayList< gc_type, value_type,
+            cc::spray_list::make_traits<
+                cds::opt::compare< compare >
+                , cds::opt::copy_policy< copy_value >
+                , cc::skip_list::random_level_generator< cc::skip_list::xorshift16 >
+            >::type
+        > pqueue_type;
+
+        pqueue_type pq;
+        test( pq );
+    }
+
+    TEST_F( SprayList_HP, stat )
+    {
+        typedef cc::SprayList< gc_type, value_type, stat_traits > pqueue_type;
+
+        pqueue_type pq;
+        test( pq );
+
+        pqueue_type::stat const& s = pq.statistics();
+        EXPECT_EQ( s.m_nPush.get(), static_cast<size_t>( c_nCapacity * 2 + 200 ));
+        EXPECT_EQ( s.m_nPop.get(), static_cast<size_t>( c_nCapacity + 210 ));
+        EXPECT_EQ( s.m_nSprayPop.get(), 0u );
+        EXPECT_GT( s.m_nPrefixUnlink.get(), 0u );
+        EXPECT_GT( s.m_nPrefixUnlinkNode.get(), 0u );
+        EXPECT_GE( s.m_nPopEmpty.get(), 2u );
+    }
+
+    TEST_F( SprayList_HP, relaxed )
+    {
+        typedef cc::SprayList< gc_type, value_type,
+            cc::spray_list::make_traits<
+                cds::opt::less< less >
+                , cds::opt::copy_policy< copy_value >
+                , cc::spray_list::relaxed< true >
+                , cds::opt::stat< cc::spray_list::stat<>>
+            >::type
+        > pqueue_type;
+
+        pqueue_type pq( 8 );
+        EXPECT_EQ( pq.spray_height(), 4u );
+        EXPECT_EQ( pq.spray_jump(), 27u );
+        test_relaxed( pq );
+
+        EXPECT_GT( pq.statistics().m_nSprayPop.get(), 0u );
+        EXPECT_EQ( pq.statistics().m_nPop.get(), static_cast<size_t>( c_nCapacity ));
+
+        // one thread - strict mode
+        pqueue_type pq1( 1 );
+        EXPECT_EQ( pq1.spray_height(), 0u );
+        test( pq1 );
+        EXPECT_EQ( pq1.statistics().m_nSprayPop.get(), 0u );
+    }
+
+} // namespace
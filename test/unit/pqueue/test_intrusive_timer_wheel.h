@@ -0,0 +1,172 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSUNIT_PQUEUE_TEST_INTRUSIVE_TIMER_WHEEL_H
+#define CDSUNIT_PQUEUE_TEST_INTRUSIVE_TIMER_WHEEL_H
+
+#include <cds_test/ext_gtest.h>
+#include <cds/intrusive/timer_wheel.h>
+#include <vector>
+#include <algorithm>
+
+namespace cds_test {
+
+    class IntrusiveTimerWheel : public ::testing::Test
+    {
+    protected:
+        static constexpr const size_t c_nTimerCount = 1000;
+
+        template <typename GC>
+        struct base_hook_item : public cds::intrusive::timer_wheel::node< GC >
+        {
+            uint64_t    nDeadline;
+            uint64_t    nFiredAt;
+            size_t      nFireCount;
+            size_t      nPeriod;
+
+            base_hook_item()
+                : nDeadline( 0 )
+                , nFiredAt( 0 )
+                , nFireCount( 0 )
+                , nPeriod( 0 )
+            {}
+        };
+
+        template <typename GC>
+        struct member_hook_item
+        {
+            uint64_t    nDeadline;
+            uint64_t    nFiredAt;
+            size_t      nFireCount;
+            size_t      nPeriod;
+            cds::intrusive::timer_wheel::node< GC > hMember;
+
+            member_hook_item()
+                : nDeadline( 0 )
+                , nFiredAt( 0 )
+                , nFireCount( 0 )
+                , nPeriod( 0 )
+            {}
+        };
+
+        template <typename Wheel>
+        void test( Wheel& wheel )
+        {
+            typedef typename Wheel::value_type value_type;
+            std::vector<value_type> arr( c_nTimerCount );
+
+            ASSERT_TRUE( wheel.empty());
+            ASSERT_EQ( wheel.size(), 0u );
+            ASSERT_EQ( wheel.now(), 0u );
+
+            // Nothing to fire
+            EXPECT_EQ( wheel.advance( 10 ), 0u );
+            ASSERT_EQ( wheel.now(), 10u );
+
+            // Arm: the deadlines cover several levels of the wheel and beyond its range for small wheels
+            uint64_t const nSpread = std::min( Wheel::range() * 3, uint64_t( 1 ) << 16 );
+            uint64_t nMaxDeadline = 0;
+            for ( size_t i = 0; i < arr.size(); ++i ) {
+                value_type& v = arr[i];
+                v.nDeadline = wheel.now() + 1 + ( i * 7919 ) % nSpread;
+                if ( v.nDeadline > nMaxDeadline )
+                    nMaxDeadline = v.nDeadline;
+                ASSERT_TRUE( wheel.arm( v, v.nDeadline ));
+                ASSERT_FALSE( wheel.arm( v, v.nDeadline ));
+                ASSERT_EQ( wheel.size(), i + 1 );
+            }
+
+            // Cancel every third timer; re-arm some of them
+            size_t nArmed = arr.size();
+            for ( size_t i = 0; i < arr.size(); i += 3 ) {
+                value_type& v = arr[i];
+                ASSERT_TRUE( wheel.cancel( v ));
+                ASSERT_FALSE( wheel.cancel( v ));
+                --nArmed;
+                if ( i % 2 == 0 ) {
+                    v.nDeadline += 5;
+                    if ( v.nDeadline > nMaxDeadline )
+                        nMaxDeadline = v.nDeadline;
+                    ASSERT_TRUE( wheel.arm( v, v.nDeadline ));
+                    ++nArmed;
+                }
+            }
+            ASSERT_EQ( wheel.size(), nArmed );
+
+            // Periodic timers are re-armed in the expiry handler
+            for ( size_t i = 1; i < arr.size(); i += 100 )
+                arr[i].nPeriod = 3;
+
+            auto handler = [&wheel]( value_type& v ) {
+                v.nFiredAt = wheel.now();
+                ++v.nFireCount;
+                if ( v.nPeriod ) {
+                    --v.nPeriod;
+                    v.nDeadline = wheel.now() + 17;
+                    EXPECT_TRUE( wheel.arm( v, v.nDeadline ));
+                }
+            };
+
+            // Advance the wheel by different steps: each timer is fired exactly at its deadline
+            size_t nFired = 0;
+            uint64_t nStep = 1;
+            while ( wheel.now() < nMaxDeadline + 100 ) {
+                nFired += wheel.advance( wheel.now() + nStep, handler );
+                nStep = nStep % 13 + 1;
+            }
+            EXPECT_TRUE( wheel.empty());
+
+            size_t nFireCount = 0;
+            for ( size_t i = 0; i < arr.size(); ++i ) {
+                value_type& v = arr[i];
+                ASSERT_FALSE( node_of( wheel, v )->is_armed()) << "i=" << i;
+                if ( i % 3 == 0 && i % 2 != 0 ) {
+                    // cancelled
+                    EXPECT_EQ( v.nFireCount, 0u ) << "i=" << i;
+                }
+                else {
+                    EXPECT_EQ( v.nFiredAt, v.nDeadline ) << "i=" << i;
+                    EXPECT_EQ( v.nFireCount, i % 100 == 1 ? 4u : 1u ) << "i=" << i;
+                }
+                nFireCount += v.nFireCount;
+            }
+            EXPECT_EQ( nFired, nFireCount );
+
+            // Overdue timers are fired by the next advance
+            for ( auto& v : arr ) {
+                v.nFireCount = 0;
+                v.nPeriod = 0;
+                v.nDeadline = wheel.now() - 1;
+                ASSERT_TRUE( wheel.arm( v, v.nDeadline ));
+            }
+            ASSERT_EQ( wheel.size(), arr.size());
+            EXPECT_EQ( wheel.advance( wheel.now(), handler ), arr.size());
+            EXPECT_TRUE( wheel.empty());
+            for ( auto& v : arr )
+                EXPECT_EQ( v.nFireCount, 1u );
+
+            // Clear test
+            for ( auto& v : arr )
+                ASSERT_TRUE( wheel.arm( v, wheel.now() + nSpread / 2 ));
+            ASSERT_EQ( wheel.size(), arr.size());
+            wheel.clear();
+            EXPECT_TRUE( wheel.empty());
+            for ( auto& v : arr ) {
+                ASSERT_FALSE( node_of( wheel, v )->is_armed());
+                ASSERT_FALSE( wheel.cancel( v ));
+            }
+            EXPECT_EQ( wheel.advance( wheel.now() + nSpread ), 0u );
+        }
+
+        template <typename Wheel>
+        static typename Wheel::node_type * node_of( Wheel&, typename Wheel::value_type& v )
+        {
+            return Wheel::node_traits::to_node_ptr( v );
+        }
+    };
+
+} // namespace cds_test
+
+#endif // CDSUNIT_PQUEUE_TEST_INTRUSIVE_TIMER_WHEEL_H
@@ -0,0 +1,143 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSUNIT_PQUEUE_TEST_SPRAY_LIST_H
+#define CDSUNIT_PQUEUE_TEST_SPRAY_LIST_H
+
+#include "test_data.h"
+#include <vector>
+
+namespace cds_test {
+
+    class SprayList : public PQueueTest
+    {
+        typedef PQueueTest base_class;
+
+    public:
+        // value_type has user-defined copy ctor and no copy assignment
+        struct copy_value {
+            void operator()( value_type& dest, value_type const& src ) const
+            {
+                dest.k = src.k;
+                dest.v = src.v;
+            }
+        };
+
+    protected:
+        // Strict mode: the items are popped in descending order
+        template <class PQueue>
+        void test( PQueue& pq )
+        {
+            data_array<value_type> arr( base_class::c_nCapacity );
+            value_type * pFirst = arr.begin();
+            value_type * pLast = arr.end();
+
+            ASSERT_TRUE( pq.empty());
+            ASSERT_EQ( pq.size(), 0u );
+
+            // Push test
+            size_t nSize = 0;
+            for ( value_type * p = pFirst; p < pLast; ++p ) {
+                ASSERT_TRUE( pq.push( *p ));
+                ASSERT_FALSE( pq.empty());
+                ASSERT_EQ( pq.size(), ++nSize );
+            }
+
+            // Pop test
+            key_type nPrev = base_class::c_nMinValue + key_type( base_class::c_nCapacity ) - 1;
+            value_type kv( 0 );
+            ASSERT_TRUE( pq.pop( kv ));
+            EXPECT_EQ( kv.k, nPrev );
+            EXPECT_EQ( kv.v, kv.k );
+            ASSERT_EQ( pq.size(), --nSize );
+
+            while ( nSize > 0 ) {
+                ASSERT_TRUE( pq.pop( kv ));
+                EXPECT_EQ( kv.k, nPrev - 1 );
+                EXPECT_EQ( kv.v, kv.k );
+                nPrev = kv.k;
+                ASSERT_EQ( pq.size(), --nSize );
+            }
+            ASSERT_TRUE( pq.empty());
+
+            // pop from empty pqueue
+            kv.k = base_class::c_nCapacity * 2;
+            ASSERT_FALSE( pq.pop( kv ));
+            EXPECT_EQ( kv.k, base_class::c_nCapacity * 2 );
+
+            // equal priorities
+            for ( key_type k = 0; k < 100; ++k ) {
+                ASSERT_TRUE( pq.emplace( k % 10, k ));
+                ASSERT_TRUE( pq.push( value_type( k % 10, k )));
+            }
+            ASSERT_EQ( pq.size(), 200u );
+
+            std::vector<bool> popped( 100, false );
+            for ( key_type k = 9; k >= 0; --k ) {
+                for ( int i = 0; i < 20; ++i ) {
+                    ASSERT_TRUE( pq.pop_with( [&popped, &kv]( value_type const& v ) { popped[v.v] = true; copy_value()( kv, v ); } ));
+                    EXPECT_EQ( kv.k, k );
+                    EXPECT_EQ( kv.v % 10, k );
+                }
+            }
+            for ( bool b : popped )
+                EXPECT_TRUE( b );
+            ASSERT_TRUE( pq.empty());
+
+            // Clear test
+            for ( value_type * p = pFirst; p < pLast; ++p )
+                ASSERT_TRUE( pq.push( *p ));
+            ASSERT_EQ( pq.size(), static_cast<size_t>( base_class::c_nCapacity ));
+            for ( int i = 0; i < 10; ++i )
+                ASSERT_TRUE( pq.pop( kv ));
+
+            pq.clear();
+            ASSERT_TRUE( pq.empty());
+            ASSERT_EQ( pq.size(), 0u );
+            ASSERT_FALSE( pq.pop( kv ));
+        }
+
+        // Relaxed mode: any item may be popped but each item is popped exactly once
+        template <class PQueue>
+        void test_relaxed( PQueue& pq )
+        {
+            data_array<value_type> arr( base_class::c_nCapacity );
+            value_type * pFirst = arr.begin();
+            value_type * pLast = arr.end();
+
+            ASSERT_TRUE( pq.empty());
+
+            size_t nSize = 0;
+            for ( value_type * p = pFirst; p < pLast; ++p ) {
+                ASSERT_TRUE( pq.push( *p ));
+                ASSERT_EQ( pq.size(), ++nSize );
+            }
+
+            std::vector<bool> popped( base_class::c_nCapacity, false );
+            value_type kv( 0 );
+            while ( nSize > 0 ) {
+                ASSERT_TRUE( pq.pop( kv ));
+                ASSERT_GE( kv.k, base_class::c_nMinValue );
+                ASSERT_LT( kv.k, base_class::c_nMinValue + base_class::c_nCapacity );
+                size_t const nIdx = static_cast<size_t>( kv.k - base_class::c_nMinValue );
+                ASSERT_FALSE( popped[nIdx] ) << "key=" << kv.k;
+                popped[nIdx] = true;
+                EXPECT_EQ( kv.v, kv.k );
+                ASSERT_EQ( pq.size(), --nSize );
+            }
+            ASSERT_TRUE( pq.empty());
+            ASSERT_FALSE( pq.pop( kv ));
+
+            for ( value_type * p = pFirst; p < pLast; ++p )
+                ASSERT_TRUE( pq.push( *p ));
+            pq.clear();
+            ASSERT_TRUE( pq.empty());
+            ASSERT_FALSE( pq.pop( kv ));
+        }
+    };
+
+} // namespace cds_test
+
+#endif // CDSUNIT_PQUEUE_TEST_SPRAY_LIST_H
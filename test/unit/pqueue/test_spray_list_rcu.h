@@ -0,0 +1,92 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSUNIT_PQUEUE_TEST_SPRAY_LIST_RCU_H
+#define CDSUNIT_PQUEUE_TEST_SPRAY_LIST_RCU_H
+
+#include "test_spray_list.h"
+#include <cds/container/spray_list_rcu.h>
+
+namespace cc = cds::container;
+
+template <class RCU>
+class SprayList: public cds_test::SprayList
+{
+public:
+    typedef cds::urcu::gc<RCU> rcu_type;
+
+protected:
+    void SetUp()
+    {
+        RCU::Construct();
+        cds::threading::Manager::attachThread();
+    }
+
+    void TearDown()
+    {
+        cds::threading::Manager::detachThread();
+        RCU::Destruct();
+    }
+};
+
+TYPED_TEST_CASE_P( SprayList );
+
+TYPED_TEST_P( SprayList, less )
+{
+    typedef cc::SprayList< typename TestFixture::rcu_type, typename TestFixture::value_type,
+        typename cc::spray_list::make_traits<
+            cds::opt::less< typename TestFixture::less >
+            , cds::opt::copy_policy< typename TestFixture::copy_value >
+        >::type
+    > pqueue_type;
+
+    pqueue_type pq;
+    this->test( pq );
+}
+
+TYPED_TEST_P( SprayList, stat )
+{
+    typedef cc::SprayList< typename TestFixture::rcu_type, typename TestFixture::value_type,
+        typename cc::spray_list::make_traits<
+            cds::opt::compare< typename TestFixture::compare >
+            , cds::opt::copy_policy< typename TestFixture::copy_value >
+            , cds::opt::stat< cc::spray_list::stat<>>
+            , cc::spray_list::bound_offset< 4 >
+        >::type
+    > pqueue_type;
+
+    pqueue_type pq;
+    this->test( pq );
+
+    EXPECT_EQ( pq.statistics().m_nPop.get(), static_cast<size_t>( TestFixture::c_nCapacity + 210 ));
+    EXPECT_GT( pq.statistics().m_nPrefixUnlink.get(), 0u );
+    EXPECT_GT( pq.statistics().m_nPrefixUnlinkNode.get(), 0u );
+}
+
+TYPED_TEST_P( SprayList, relaxed )
+{
+    typedef cc::SprayList< typename TestFixture::rcu_type, typename TestFixture::value_type,
+        typename cc::spray_list::make_traits<
+            cds::opt::less< typename TestFixture::less >
+            , cds::opt::copy_policy< typename TestFixture::copy_value >
+            , cc::spray_list::relaxed< true >
+            , cds::opt::stat< cc::spray_list::stat<>>
+        >::type
+    > pqueue_type;
+
+    pqueue_type pq( 16 );
+    this->test_relaxed( pq );
+
+    EXPECT_GT( pq.statistics().m_nSprayPop.get(), 0u );
+    EXPECT_EQ( pq.statistics().m_nPop.get(), static_cast<size_t>( TestFixture::c_nCapacity ));
+}
+
+// GCC 5: All test names should be written on single line, otherwise a runtime error will be encountered like as
+// "No test named <test_name> can be found in this test case"
+REGISTER_TYPED_TEST_CASE_P( SprayList,
+    less, stat, relaxed
+);
+
+#endif // CDSUNIT_PQUEUE_TEST_SPRAY_LIST_RCU_H
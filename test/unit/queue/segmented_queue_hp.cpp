@@ -85,6 +85,42 @@ namespace {
         test( q );
     }
 
+    TEST_F( SegmentedQueue_HP, thread_affine )
+    {
+        struct traits : public
+            cds::container::segmented_queue::make_traits <
+                cds::opt::permutation_generator< cds::opt::v::thread_affine_permutation<> >
+                , cds::opt::stat < cds::container::segmented_queue::stat<> >
+            > ::type
+        {};
+        typedef cds::container::SegmentedQueue< gc_type, int, traits > test_queue;
+
+        test_queue q( c_QuasiFactor );
+        ASSERT_EQ( q.quasi_factor(), cds::beans::ceil2( c_QuasiFactor ));
+        test( q );
+        EXPECT_EQ( q.statistics().m_nMaxQuasiFactor.load( atomics::memory_order_relaxed ), cds::beans::ceil2( c_QuasiFactor ));
+        EXPECT_EQ( q.statistics().m_nSegmentGrow.get(), 0u );
+    }
+
+    TEST_F( SegmentedQueue_HP, adaptive )
+    {
+        struct traits : public
+            cds::container::segmented_queue::make_traits <
+                cds::opt::permutation_generator< cds::opt::v::thread_affine_permutation<> >
+                , cds::opt::stat < cds::container::segmented_queue::stat<> >
+            > ::type
+        {};
+        typedef adaptive_queue< cds::container::SegmentedQueue< gc_type, int, traits >> test_queue;
+
+        test_queue q( c_QuasiFactor, c_QuasiFactor * 4 );
+        ASSERT_EQ( q.quasi_factor(), cds::beans::ceil2( c_QuasiFactor ));
+        ASSERT_EQ( q.min_quasi_factor(), cds::beans::ceil2( c_QuasiFactor ));
+        ASSERT_EQ( q.max_quasi_factor(), cds::beans::ceil2( c_QuasiFactor * 4 ));
+
+        // contention grows the segment size, quiet phase shrinks it back
+        test_adaptive( q );
+    }
+
     TEST_F( SegmentedQueue_HP, move )
     {
         typedef cds::container::SegmentedQueue< gc_type, std::string > test_queue;
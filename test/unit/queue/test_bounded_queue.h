@@ -190,6 +190,11 @@ namespace cds_test {
             ASSERT_CONTAINER_SIZE( q, 0 );
         }
 
+        // Aligns the memory block of at least cds::c_nCacheLineSize extra bytes on cache line boundary
+        static void* align_region( uint8_t* p )
+        {
+            return p + ( cds::c_nCacheLineSize - reinterpret_cast<uintptr_t>( p ) % cds::c_nCacheLineSize );
+        }
     };
 
 } // namespace cds_test
@@ -12,7 +12,96 @@ namespace cds_test {
 
     class segmented_queue : public ::testing::Test
     {
+    public:
+        // Adaptive queue with access to the tail segment
+        template <typename Queue>
+        class adaptive_queue: public Queue
+        {
+        public:
+            adaptive_queue( size_t nMinQuasiFactor, size_t nMaxQuasiFactor )
+                : Queue( nMinQuasiFactor, nMaxQuasiFactor )
+            {}
+
+            // Size of the tail segment
+            size_t tail_size()
+            {
+                typename Queue::gc::Guard guard;
+                auto pTail = this->m_SegmentList.tail( guard );
+                return pTail ? pTail->cell_count : 0;
+            }
+
+            // Simulates nCount failed CAS on the tail segment
+            void add_tail_contention( size_t nCount )
+            {
+                typename Queue::gc::Guard guard;
+                auto pTail = this->m_SegmentList.tail( guard );
+                ASSERT_TRUE( pTail != nullptr );
+                pTail->contention.fetch_add( nCount );
+            }
+        };
+
     protected:
+        template <typename Queue>
+        void test_adaptive( Queue& q )
+        {
+            typedef typename Queue::value_type value_type;
+
+            size_t const nMinQuasiFactor = q.min_quasi_factor();
+            size_t const nMaxQuasiFactor = q.max_quasi_factor();
+            ASSERT_LT( nMinQuasiFactor, nMaxQuasiFactor );
+            ASSERT_EQ( q.quasi_factor(), nMinQuasiFactor );
+            ASSERT_TRUE( q.empty());
+
+            size_t nPushed = 0;
+
+            // The first push of a round creates new segment, the segment is filled up by the round.
+            // Creating the next segment checks the contention on the filled segment.
+            auto fill_segment = [&q, &nPushed]( bool bContended ) {
+                ASSERT_TRUE( q.push( static_cast<value_type>( nPushed++ )));
+                size_t const nSegmentSize = q.tail_size();
+                ASSERT_GT( nSegmentSize, 0u );
+                if ( bContended )
+                    q.add_tail_contention( nSegmentSize );
+                for ( size_t i = 1; i < nSegmentSize; ++i )
+                    ASSERT_TRUE( q.push( static_cast<value_type>( nPushed++ )));
+            };
+
+            // High contention: the segment size grows up to the maximum
+            size_t nExpected = nMinQuasiFactor;
+            fill_segment( true );
+            while ( nExpected < nMaxQuasiFactor ) {
+                fill_segment( true );
+                nExpected *= 2;
+                EXPECT_EQ( q.quasi_factor(), nExpected );
+            }
+            fill_segment( true );
+            EXPECT_EQ( q.quasi_factor(), nMaxQuasiFactor );
+            EXPECT_EQ( q.tail_size(), nMaxQuasiFactor );
+            EXPECT_EQ( q.statistics().m_nMaxQuasiFactor.load( atomics::memory_order_relaxed ), nMaxQuasiFactor );
+            size_t const nGrowCount = q.statistics().m_nSegmentGrow.get();
+            EXPECT_GT( nGrowCount, 0u );
+            EXPECT_EQ( q.statistics().m_nSegmentShrink.get(), 0u );
+
+            // No contention: the segment size shrinks back to the minimum
+            for ( size_t i = 0; i < 16 && q.quasi_factor() > nMinQuasiFactor; ++i )
+                fill_segment( false );
+            EXPECT_EQ( q.quasi_factor(), nMinQuasiFactor );
+            EXPECT_EQ( q.statistics().m_nSegmentShrink.get(), nGrowCount );
+            EXPECT_EQ( q.statistics().m_nSegmentGrow.get(), nGrowCount );
+
+            fill_segment( false );
+            EXPECT_EQ( q.tail_size(), nMinQuasiFactor );
+
+            // All items are in the queue
+            ASSERT_CONTAINER_SIZE( q, nPushed );
+            size_t nPopped = 0;
+            value_type v;
+            while ( q.pop( v ))
+                ++nPopped;
+            EXPECT_EQ( nPopped, nPushed );
+            ASSERT_TRUE( q.empty());
+        }
+
         template <typename Queue>
         void test( Queue& q )
         {
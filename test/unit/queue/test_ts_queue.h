@@ -0,0 +1,54 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSUNIT_QUEUE_TEST_TS_QUEUE_H
+#define CDSUNIT_QUEUE_TEST_TS_QUEUE_H
+
+#include "test_generic_queue.h"
+#include <cds/threading/model.h>
+#include <thread>
+
+namespace cds_test {
+
+    class TSQueue : public generic_queue
+    {
+    protected:
+        static constexpr const size_t c_nThreadCount = 4;
+        static constexpr const int c_nItemCount = 100;
+
+        template <class Queue>
+        void test_buffers( Queue& q )
+        {
+            typedef typename Queue::value_type value_type;
+
+            // The threads are run one after another, each thread enqueues into its own buffer.
+            // The timestamps of the items of different threads are ordered
+            for ( size_t nThread = 0; nThread < c_nThreadCount; ++nThread ) {
+                std::thread thr( [&q, nThread]() {
+                    cds::threading::Manager::attachThread();
+                    for ( int i = 0; i < c_nItemCount; ++i )
+                        q.enqueue( static_cast<value_type>( nThread * c_nItemCount + i ));
+                    cds::threading::Manager::detachThread();
+                });
+                thr.join();
+            }
+            ASSERT_FALSE( q.empty());
+            ASSERT_CONTAINER_SIZE( q, c_nThreadCount * c_nItemCount );
+
+            value_type v;
+            for ( int i = 0; i < static_cast<int>( c_nThreadCount ) * c_nItemCount; ++i ) {
+                ASSERT_TRUE( q.dequeue( v ));
+                ASSERT_EQ( v, i );
+            }
+            ASSERT_TRUE( q.empty());
+            ASSERT_CONTAINER_SIZE( q, 0 );
+            ASSERT_FALSE( q.dequeue( v ));
+
+            Queue::gc::scan();
+        }
+    };
+} // namespace cds_test
+
+#endif // CDSUNIT_QUEUE_TEST_TS_QUEUE_H
@@ -0,0 +1,109 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_ts_queue.h"
+
+#include <cds/gc/dhp.h>
+#include <cds/container/ts_queue.h>
+
+namespace {
+    namespace cc = cds::container;
+    typedef cds::gc::DHP gc_type;
+
+
+    class TSQueue_DHP : public cds_test::TSQueue
+    {
+    protected:
+        void SetUp()
+        {
+            typedef cc::TSQueue< gc_type, int > queue_type;
+
+            cds::gc::dhp::smr::construct( queue_type::c_nHazardPtrCount );
+            cds::threading::Manager::attachThread();
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            cds::gc::dhp::smr::destruct();
+        }
+    };
+
+    TEST_F( TSQueue_DHP, defaulted )
+    {
+        typedef cc::TSQueue< gc_type, int > test_queue;
+
+        test_queue q;
+        test( q );
+    }
+
+    TEST_F( TSQueue_DHP, atomic_counter )
+    {
+        typedef cc::TSQueue< gc_type, int,
+            typename cc::ts::make_traits<
+                cc::ts::timestamp< cc::ts::atomic_counter >
+                , cds::opt::item_counter< cds::atomicity::item_counter >
+            >::type
+        > test_queue;
+
+        test_queue q( c_nThreadCount );
+        test( q );
+        test_buffers( q );
+    }
+
+    TEST_F( TSQueue_DHP, hardware_counter )
+    {
+        typedef cc::TSQueue< gc_type, int,
+            typename cc::ts::make_traits<
+                cc::ts::timestamp< cc::ts::hardware_counter >
+                , cds::opt::item_counter< cds::atomicity::item_counter >
+                , cds::opt::stat< cc::ts::stat<> >
+            >::type
+        > test_queue;
+
+        test_queue q( c_nThreadCount );
+        test( q );
+        test_buffers( q );
+    }
+
+    TEST_F( TSQueue_DHP, hardware_interval )
+    {
+        struct traits: public cc::ts::traits
+        {
+            typedef cc::ts::hardware_interval< 16 > timestamp;
+            typedef cds::atomicity::item_counter item_counter;
+            typedef cds::backoff::pause back_off;
+        };
+        typedef cc::TSQueue< gc_type, int, traits > test_queue;
+
+        test_queue q( c_nThreadCount );
+        test( q );
+        test_buffers( q );
+    }
+
+    TEST_F( TSQueue_DHP, single_buffer )
+    {
+        typedef cc::TSQueue< gc_type, int,
+            typename cc::ts::make_traits<
+                cds::opt::item_counter< cds::atomicity::item_counter >
+                , cds::opt::stat< cc::ts::stat<> >
+            >::type
+        > test_queue;
+
+        // all threads share the buffer
+        test_queue q( 1 );
+        test( q );
+        test_buffers( q );
+    }
+
+    TEST_F( TSQueue_DHP, move )
+    {
+        typedef cc::TSQueue< gc_type, std::string > test_queue;
+
+        test_queue q;
+        test_string( q );
+    }
+
+} // namespace
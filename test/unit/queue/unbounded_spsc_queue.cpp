@@ -0,0 +1,137 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_generic_queue.h"
+
+#include <cds/container/unbounded_spsc_queue.h>
+
+namespace {
+    namespace cc = cds::container;
+
+    class UnboundedSPSCQueue: public cds_test::generic_queue
+    {
+    protected:
+        template <class Queue>
+        void test_chunks( Queue& q )
+        {
+            typedef typename Queue::value_type value_type;
+
+            size_t const nChunkSize = q.chunk_size();
+            size_t const nSize = nChunkSize * 10 + nChunkSize / 2;
+            value_type v;
+
+            // several chunks are in use
+            for ( size_t i = 0; i < nSize; ++i )
+                ASSERT_TRUE( q.push( static_cast<value_type>( i )));
+            ASSERT_FALSE( q.empty());
+            ASSERT_CONTAINER_SIZE( q, nSize );
+
+            for ( size_t i = 0; i < nSize; ++i ) {
+                ASSERT_TRUE( q.front() != nullptr );
+                ASSERT_EQ( *q.front(), static_cast<value_type>( i ));
+                ASSERT_TRUE( q.pop( v ));
+                ASSERT_EQ( v, static_cast<value_type>( i ));
+            }
+            ASSERT_TRUE( q.empty());
+            ASSERT_TRUE( q.front() == nullptr );
+            ASSERT_FALSE( q.pop( v ));
+
+            // steady state: interleaved push/pop across chunk boundaries
+            size_t nPush = 0;
+            size_t nPop = 0;
+            for ( size_t pass = 0; pass < nChunkSize * 8; ++pass ) {
+                for ( size_t k = 0; k < 3; ++k )
+                    ASSERT_TRUE( q.push( static_cast<value_type>( nPush++ )));
+                for ( size_t k = 0; k < 2; ++k ) {
+                    ASSERT_TRUE( q.pop( v ));
+                    ASSERT_EQ( v, static_cast<value_type>( nPop++ ));
+                }
+            }
+            while ( q.pop( v ))
+                ASSERT_EQ( v, static_cast<value_type>( nPop++ ));
+            ASSERT_EQ( nPush, nPop );
+            ASSERT_TRUE( q.empty());
+            ASSERT_CONTAINER_SIZE( q, 0 );
+        }
+    };
+
+    TEST_F( UnboundedSPSCQueue, defaulted )
+    {
+        typedef cds::container::UnboundedSPSCQueue< int > test_queue;
+
+        test_queue q;
+        test( q );
+        test_chunks( q );
+    }
+
+    TEST_F( UnboundedSPSCQueue, small_chunk )
+    {
+        typedef cds::container::UnboundedSPSCQueue< int > test_queue;
+
+        test_queue q( 3, 1 );
+        EXPECT_EQ( q.chunk_size(), 4u );
+        test( q );
+        test_chunks( q );
+    }
+
+    TEST_F( UnboundedSPSCQueue, item_counting )
+    {
+        struct traits: public cc::unbounded_spsc_queue::traits
+        {
+            typedef cds::atomicity::item_counter item_counter;
+        };
+        typedef cds::container::UnboundedSPSCQueue< int, traits > test_queue;
+
+        test_queue q( 16 );
+        test( q );
+        test_chunks( q );
+    }
+
+    TEST_F( UnboundedSPSCQueue, stat )
+    {
+        typedef cds::container::UnboundedSPSCQueue< size_t,
+            cc::unbounded_spsc_queue::make_traits<
+                cds::opt::stat< cc::unbounded_spsc_queue::stat<>>
+                , cds::opt::item_counter< cds::atomicity::item_counter >
+                , cds::opt::padding< cds::opt::no_special_padding >
+            >::type
+        > test_queue;
+
+        test_queue q( 8, 4 );
+        test_chunks( q );
+
+        test_queue::stat const& s = q.statistics();
+        EXPECT_GT( s.m_nChunkAlloc.get(), 1u );
+        EXPECT_GT( s.m_nChunkReuse.get(), 0u );
+        // steady state does not allocate: only the cache overflow allocates new chunks
+        EXPECT_LE( s.m_nChunkAlloc.get(), 1u + 10u + s.m_nChunkFree.get() + 4u );
+    }
+
+    TEST_F( UnboundedSPSCQueue, move )
+    {
+        typedef cds::container::UnboundedSPSCQueue< std::string > test_queue;
+
+        test_queue q( 2 );
+        test_string( q );
+    }
+
+    TEST_F( UnboundedSPSCQueue, move_item_counting )
+    {
+        struct traits: public cc::unbounded_spsc_queue::traits
+        {
+            typedef cds::atomicity::item_counter item_counter;
+        };
+        typedef cds::container::UnboundedSPSCQueue< std::string, traits > test_queue;
+
+        test_queue q( 2 );
+        test_string( q );
+
+        // the items left in the queue are destroyed by the destructor
+        for ( int i = 0; i < 10; ++i )
+            ASSERT_TRUE( q.emplace( "long string that is not suitable for SSO" ));
+        ASSERT_CONTAINER_SIZE( q, 10u );
+    }
+
+} // namespace
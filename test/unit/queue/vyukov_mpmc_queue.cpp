@@ -6,6 +6,7 @@
 #include "test_bounded_queue.h"
 
 #include <cds/container/vyukov_mpmc_cycle_queue.h>
+#include <cds/container/process_shared_ring.h>
 
 namespace {
     namespace cc = cds::container;
@@ -154,5 +155,67 @@ namespace {
         test_single_consumer( q );
     }
 
+    TEST_F( VyukovMPMCCycleQueue, external )
+    {
+        struct traits: public cds::container::vyukov_queue::traits
+        {
+            typedef cds::opt::v::uninitialized_external_buffer<int> buffer;
+            typedef cds::atomicity::item_counter item_counter;
+        };
+        typedef cds::container::VyukovMPMCCycleQueue< int, traits > test_queue;
+
+        std::vector<uint64_t> storage( test_queue::storage_size( 128 ) / sizeof( uint64_t ) + 1 );
+        test_queue q( storage.data(), 128 );
+        test( q );
+    }
+
+    TEST_F( VyukovMPMCCycleQueue, process_shared )
+    {
+        struct traits: public cds::container::vyukov_queue::traits
+        {
+            typedef cds::opt::v::uninitialized_external_buffer<int> buffer;
+            typedef cds::atomicity::item_counter item_counter;
+        };
+        typedef cds::container::VyukovMPMCCycleQueue< int, traits > test_queue;
+        typedef cds::container::process_shared::ring_segment< test_queue > segment;
+
+        size_t const nSize = segment::size( 128 );
+        std::vector<uint8_t> mem1( nSize + segment::c_nAlignment );
+        std::vector<uint8_t> mem2( nSize + segment::c_nAlignment );
+        void* region1 = align_region( mem1.data());
+        void* region2 = align_region( mem2.data());
+
+        ASSERT_TRUE( segment::create( region1, nSize - 1, 128 ) == nullptr );
+        ASSERT_TRUE( segment::attach( region1, nSize ) == nullptr );
+
+        test_queue* q = segment::create( region1, nSize, 128 );
+        ASSERT_TRUE( q != nullptr );
+        ASSERT_EQ( segment::attached( region1), 1u );
+        test( *q );
+
+        for ( int i = 0; i < 100; ++i )
+            ASSERT_TRUE( q->push( i ));
+
+        // Relocate the segment: the queue must be valid at the new address
+        memcpy( region2, region1, nSize );
+        memset( region1, 0, nSize );
+
+        test_queue* q2 = segment::attach( region2, nSize );
+        ASSERT_TRUE( q2 != nullptr );
+        ASSERT_EQ( segment::attached( region2), 2u );
+        ASSERT_CONTAINER_SIZE( (*q2), 100u );
+        for ( int i = 0; i < 100; ++i ) {
+            int v;
+            ASSERT_TRUE( q2->pop( v ));
+            ASSERT_EQ( v, i );
+        }
+        ASSERT_TRUE( q2->empty());
+        test( *q2 );
+
+        ASSERT_FALSE( segment::detach( region2));
+        ASSERT_TRUE( segment::detach( region2));
+        ASSERT_TRUE( segment::attach( region2, nSize ) == nullptr );
+    }
+
 } // namespace
 
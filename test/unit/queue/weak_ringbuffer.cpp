@@ -6,6 +6,7 @@
 #include "test_bounded_queue.h"
 
 #include <cds/container/weak_ringbuffer.h>
+#include <cds/container/process_shared_ring.h>
 #include <cds_test/fixture.h>
 
 namespace {
@@ -211,6 +212,104 @@ namespace {
             ASSERT_TRUE( q.front().first == nullptr );
             ASSERT_FALSE( q.pop_front());
         }
+
+        template <typename Queue>
+        void test_varsize_batch( Queue& q )
+        {
+            size_t const capacity = q.capacity();
+            static size_t const c_nBatchSize = 16;
+
+            std::pair<void*, size_t> records[c_nBatchSize];
+            ASSERT_EQ( q.front( records, c_nBatchSize ), 0u );
+            ASSERT_FALSE( q.pop_front( 1 ));
+            ASSERT_EQ( q.consume( []( void*, size_t ) {} ), 0u );
+
+            // reserve/commit
+            size_t total_push = 0;
+            uint8_t chfill = 0;
+            while ( total_push < capacity * 4 ) {
+                size_t nCount = cds_test::fixture::rand( c_nBatchSize ) + 1;
+                size_t sizes[c_nBatchSize];
+                for ( size_t i = 0; i < nCount; ++i ) {
+                    sizes[i] = cds_test::fixture::rand( static_cast<unsigned>( capacity / ( c_nBatchSize * 4 ))) + 1;
+                    void* buf = q.reserve( sizes[i] );
+                    ASSERT_TRUE( buf != nullptr );
+                    memset( buf, static_cast<uint8_t>( chfill + i ), sizes[i] );
+                    total_push += sizes[i];
+                }
+
+                // reserved records are invisible
+                ASSERT_EQ( q.front( records, c_nBatchSize ), 0u );
+                ASSERT_NE( q.commit(), 0u );
+
+                ASSERT_EQ( q.front( records, c_nBatchSize ), nCount );
+                for ( size_t i = 0; i < nCount; ++i ) {
+                    ASSERT_EQ( records[i].second, sizes[i] );
+                    for ( size_t k = 0; k < sizes[i]; ++k )
+                        ASSERT_EQ( reinterpret_cast<uint8_t*>( records[i].first )[k], static_cast<uint8_t>( chfill + i ));
+                }
+                ASSERT_FALSE( q.pop_front( nCount + 1 ));
+                ASSERT_TRUE( q.pop_front( nCount ));
+                ASSERT_TRUE( q.empty());
+                chfill += static_cast<uint8_t>( nCount );
+            }
+
+            // rollback
+            ASSERT_TRUE( q.reserve( 100 ) != nullptr );
+            q.rollback();
+            ASSERT_EQ( q.commit(), 0u );
+            ASSERT_TRUE( q.empty());
+
+            // contiguous batch reservation and consume
+            total_push = 0;
+            while ( total_push < capacity * 4 ) {
+                size_t nCount = cds_test::fixture::rand( c_nBatchSize ) + 1;
+                size_t sizes[c_nBatchSize];
+                void* bufs[c_nBatchSize];
+                for ( size_t i = 0; i < nCount; ++i )
+                    sizes[i] = cds_test::fixture::rand( static_cast<unsigned>( capacity / ( c_nBatchSize * 4 ))) + 1;
+
+                ASSERT_TRUE( q.reserve( sizes, nCount, bufs ));
+                for ( size_t i = 0; i < nCount; ++i ) {
+                    memset( bufs[i], static_cast<uint8_t>( i ), sizes[i] );
+                    total_push += sizes[i];
+                    if ( i > 0 ) {
+                        // the batch is contiguous
+                        ASSERT_GT( bufs[i], bufs[i - 1] );
+                        ASSERT_LE( reinterpret_cast<uint8_t*>( bufs[i] ) - reinterpret_cast<uint8_t*>( bufs[i - 1] ), static_cast<ptrdiff_t>( sizes[i - 1] + sizeof( size_t ) * 2 ));
+                    }
+                }
+                q.commit();
+
+                size_t nProcessed = 0;
+                size_t nRecords = q.consume( [&]( void* data, size_t size ) {
+                    EXPECT_EQ( data, bufs[nProcessed] );
+                    EXPECT_EQ( size, sizes[nProcessed] );
+                    for ( size_t k = 0; k < size; ++k )
+                        EXPECT_EQ( reinterpret_cast<uint8_t*>( data )[k], static_cast<uint8_t>( nProcessed ));
+                    ++nProcessed;
+                });
+                ASSERT_EQ( nRecords, nCount );
+                ASSERT_EQ( nProcessed, nCount );
+                ASSERT_TRUE( q.empty());
+            }
+
+            // not enough space: the batch is all-or-nothing
+            size_t nReserved = 0;
+            while ( q.reserve( 64 ))
+                ++nReserved;
+            size_t const nBusy = q.commit();
+            size_t too_big[2] = { 64, 64 };
+            void* bufs[2];
+            ASSERT_FALSE( q.reserve( too_big, 2, bufs ));
+            ASSERT_EQ( q.commit(), 0u );
+            ASSERT_EQ( q.size(), nBusy );
+            ASSERT_EQ( q.consume( []( void*, size_t ) {} ), nReserved );
+
+            ASSERT_TRUE( q.empty());
+            ASSERT_EQ( q.size(), 0u );
+            ASSERT_TRUE( q.front().first == nullptr );
+        }
     };
 
     TEST_F( WeakRingBuffer, defaulted )
@@ -281,6 +380,7 @@ namespace {
 
         test_queue q( 1024 * 64 );
         test_varsize_buffer( q );
+        test_varsize_batch( q );
     }
 
     TEST_F( WeakRingBuffer, var_sized_static )
@@ -293,6 +393,61 @@ namespace {
 
         test_queue q;
         test_varsize_buffer( q );
+        test_varsize_batch( q );
+    }
+
+    TEST_F( WeakRingBuffer, external )
+    {
+        struct traits: public cds::container::weak_ringbuffer::traits
+        {
+            typedef cds::opt::v::uninitialized_external_buffer<int> buffer;
+        };
+        typedef cds::container::WeakRingBuffer< int, traits > test_queue;
+
+        std::vector<uint64_t> storage( test_queue::storage_size( 128 ) / sizeof( uint64_t ) + 1 );
+        test_queue q( storage.data(), 128 );
+        test( q );
+        test_array( q );
+    }
+
+    TEST_F( WeakRingBuffer, var_sized_process_shared )
+    {
+        struct traits: public cds::container::weak_ringbuffer::traits
+        {
+            typedef cds::opt::v::uninitialized_external_buffer<int> buffer;
+        };
+        typedef cds::container::WeakRingBuffer< void, traits > test_queue;
+        typedef cds::container::process_shared::ring_segment< test_queue > segment;
+
+        size_t const nCapacity = 1024 * 64;
+        size_t const nSize = segment::size( nCapacity );
+        std::vector<uint8_t> mem1( nSize + segment::c_nAlignment );
+        std::vector<uint8_t> mem2( nSize + segment::c_nAlignment );
+        void* region1 = align_region( mem1.data());
+        void* region2 = align_region( mem2.data());
+
+        test_queue* q = segment::create( region1, nSize, nCapacity );
+        ASSERT_TRUE( q != nullptr );
+        test_varsize_buffer( *q );
+
+        char const str[] = "process-shared ring";
+        ASSERT_TRUE( q->push_back( str, sizeof( str )));
+
+        // Relocate the segment: the ring must be valid at the new address
+        memcpy( region2, region1, nSize );
+        memset( region1, 0, nSize );
+
+        test_queue* q2 = segment::attach( region2, nSize );
+        ASSERT_TRUE( q2 != nullptr );
+        auto buf = q2->front();
+        ASSERT_TRUE( buf.first != nullptr );
+        ASSERT_EQ( buf.second, sizeof( str ));
+        ASSERT_EQ( memcmp( buf.first, str, sizeof( str )), 0 );
+        ASSERT_TRUE( q2->pop_front());
+        test_varsize_buffer( *q2 );
+
+        ASSERT_FALSE( segment::detach( region2));
+        ASSERT_TRUE( segment::detach( region2));
     }
 
 } // namespace
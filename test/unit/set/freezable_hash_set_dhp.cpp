@@ -0,0 +1,131 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_freezable_hash_set.h"
+
+#include <cds/gc/dhp.h>
+#include <cds/container/freezable_hash_set.h>
+
+namespace {
+    namespace cc = cds::container;
+    typedef cds::gc::DHP gc_type;
+
+    class FreezableHashSet_DHP : public cds_test::freezable_hash_set
+    {
+    protected:
+        typedef cds_test::freezable_hash_set base_class;
+
+        void SetUp()
+        {
+            struct set_traits: public cc::freezable_hash::traits
+            {
+                typedef hash_int hash;
+            };
+            typedef cc::FreezableHashSet< gc_type, int_item, set_traits > set_type;
+
+            cds::gc::dhp::smr::construct( set_type::c_nHazardPtrCount );
+            cds::threading::Manager::attachThread();
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            cds::gc::dhp::smr::destruct();
+        }
+    };
+
+    TEST_F( FreezableHashSet_DHP, compare )
+    {
+        typedef cc::FreezableHashSet< gc_type, int_item,
+            typename cc::freezable_hash::make_traits<
+                cds::opt::hash< hash_int >
+                ,cds::opt::compare< cmp >
+            >::type
+        > set_type;
+
+        set_type s( kSize, 2 );
+        test( s );
+    }
+
+    TEST_F( FreezableHashSet_DHP, less )
+    {
+        typedef cc::FreezableHashSet< gc_type, int_item,
+            typename cc::freezable_hash::make_traits<
+                cds::opt::hash< hash_int >
+                ,cds::opt::less< less >
+            >::type
+        > set_type;
+
+        set_type s( kSize, 1 );
+        test( s );
+    }
+
+    TEST_F( FreezableHashSet_DHP, cmpmix )
+    {
+        typedef cc::FreezableHashSet< gc_type, int_item,
+            typename cc::freezable_hash::make_traits<
+                cds::opt::hash< hash_int >
+                ,cds::opt::less< less >
+                ,cds::opt::compare< cmp >
+            >::type
+        > set_type;
+
+        set_type s( kSize, 4 );
+        test( s );
+    }
+
+    TEST_F( FreezableHashSet_DHP, stat )
+    {
+        struct set_traits: public cc::freezable_hash::traits
+        {
+            typedef hash_int hash;
+            typedef base_class::less less;
+            typedef cds::backoff::pause back_off;
+            typedef cc::freezable_hash::stat<> stat;
+        };
+        typedef cc::FreezableHashSet< gc_type, int_item, set_traits > set_type;
+
+        set_type s( kSize, 2 );
+        test( s );
+        EXPECT_EQ( s.statistics().m_nResize.get(), 0u );
+    }
+
+    TEST_F( FreezableHashSet_DHP, grow )
+    {
+        struct set_traits: public cc::freezable_hash::traits
+        {
+            typedef hash_int hash;
+            typedef base_class::cmp compare;
+            typedef cc::freezable_hash::stat<> stat;
+        };
+        typedef cc::FreezableHashSet< gc_type, int_item, set_traits > set_type;
+
+        set_type s( 4, 1 );
+        EXPECT_EQ( s.bucket_count(), 4u );
+        test( s );
+        EXPECT_GT( s.statistics().m_nResize.get(), 0u );
+        EXPECT_GT( s.statistics().m_nBucketInit.get(), 0u );
+
+        test_grow( s );
+    }
+
+    TEST_F( FreezableHashSet_DHP, grow_load_factor )
+    {
+        struct set_traits: public cc::freezable_hash::traits
+        {
+            typedef hash_int hash;
+            typedef base_class::less less;
+            typedef cds::atomicity::cache_friendly_item_counter item_counter;
+            typedef cc::freezable_hash::stat<> stat;
+        };
+        typedef cc::FreezableHashSet< gc_type, int_item, set_traits > set_type;
+
+        set_type s( 32, 8 );
+        EXPECT_EQ( s.bucket_count(), 4u );
+        test_grow( s );
+        EXPECT_GT( s.statistics().m_nResize.get(), 0u );
+    }
+
+} // namespace
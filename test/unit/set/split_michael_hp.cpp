@@ -294,5 +294,23 @@ namespace {
         test( s );
     }
 
+    TEST_F( SplitListMichaelSet_HP, with_hash )
+    {
+        typedef cc::SplitListSet< gc_type, int_item,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list< cc::michael_list_tag >
+                , cds::opt::hash< hash_int >
+                , cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        cds::opt::compare< cmp >
+                    >::type
+                >
+            >::type
+        > set_type;
+
+        set_type s( kSize, 2 );
+        test_with_hash( s );
+    }
+
 } // namespace
 
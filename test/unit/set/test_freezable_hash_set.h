@@ -0,0 +1,321 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSUNIT_SET_TEST_FREEZABLE_HASH_SET_H
+#define CDSUNIT_SET_TEST_FREEZABLE_HASH_SET_H
+
+#include "test_set_data.h"
+
+#include <cds/opt/hash.h>
+#include <cds/threading/model.h>
+
+namespace cds_test {
+
+    class freezable_hash_set : public container_set_data
+    {
+    protected:
+        template <typename Set>
+        void test( Set& s )
+        {
+            // Precondition: set is empty
+            // Postcondition: set is empty
+
+            ASSERT_TRUE( s.empty());
+            ASSERT_CONTAINER_SIZE( s, 0 );
+            size_t const nSetSize = kSize;
+
+            typedef typename Set::value_type value_type;
+
+            std::vector< value_type > data;
+            std::vector< size_t> indices;
+            data.reserve( kSize );
+            indices.reserve( kSize );
+            for ( size_t key = 0; key < kSize; ++key ) {
+                data.push_back( value_type( static_cast<int>(key)));
+                indices.push_back( key );
+            }
+
+            // insert/find
+            for ( auto idx : indices ) {
+                auto& i = data[idx];
+
+                ASSERT_FALSE( s.contains( i.nKey ));
+                ASSERT_FALSE( s.contains( i ));
+                ASSERT_FALSE( s.find( i.nKey, []( value_type&, int ) {} ));
+                ASSERT_FALSE( s.find( i, []( value_type&, value_type const& ) {} ));
+
+                std::pair<bool, bool> updResult;
+
+                std::string str;
+                updResult = s.update( i.key(), []( bool, value_type&, int )
+                {
+                    ASSERT_TRUE( false );
+                }, false );
+                EXPECT_FALSE( updResult.first );
+                EXPECT_FALSE( updResult.second );
+
+                switch ( idx % 8 ) {
+                case 0:
+                    ASSERT_TRUE( s.insert( i ));
+                    ASSERT_FALSE( s.insert( i ));
+                    updResult = s.update( i, []( bool bNew, value_type& val, value_type const& arg)
+                        {
+                            EXPECT_FALSE( bNew );
+                            EXPECT_EQ( val.key(), arg.key());
+                        }, false );
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_FALSE( updResult.second );
+                    break;
+                case 1:
+                    ASSERT_TRUE( s.insert( i.key()));
+                    ASSERT_FALSE( s.insert( i.key()));
+                    updResult = s.update( i.key(), []( bool bNew, value_type& val, int arg)
+                        {
+                            EXPECT_FALSE( bNew );
+                            EXPECT_EQ( val.key(), arg );
+                        }, false );
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_FALSE( updResult.second );
+                    break;
+                case 2:
+                    ASSERT_TRUE( s.insert( i, []( value_type& v ) { ++v.nFindCount; } ));
+                    ASSERT_FALSE( s.insert( i, []( value_type& v ) { ++v.nFindCount; } ));
+                    ASSERT_TRUE( s.find( i.nKey, []( value_type const& v, int key )
+                        {
+                            EXPECT_EQ( v.key(), key );
+                            EXPECT_EQ( v.nFindCount, 1u );
+                        }));
+                    break;
+                case 3:
+                    ASSERT_TRUE( s.insert( i.key(), []( value_type& v ) { ++v.nFindCount; } ));
+                    ASSERT_FALSE( s.insert( i.key(), []( value_type& v ) { ++v.nFindCount; } ));
+                    ASSERT_TRUE( s.find( i.nKey, []( value_type const& v, int key )
+                        {
+                            EXPECT_EQ( v.key(), key );
+                            EXPECT_EQ( v.nFindCount, 1u );
+                        }));
+                    break;
+                case 4:
+                    updResult = s.update( i, []( bool bNew, value_type& v, value_type const& arg )
+                        {
+                            EXPECT_TRUE( bNew );
+                            EXPECT_EQ( v.key(), arg.key());
+                            ++v.nUpdateNewCount;
+                        });
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_TRUE( updResult.second );
+
+                    updResult = s.update( i, []( bool bNew, value_type& v, value_type const& arg )
+                        {
+                            EXPECT_FALSE( bNew );
+                            EXPECT_EQ( v.key(), arg.key());
+                            ++v.nUpdateNewCount;
+                        }, false );
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_FALSE( updResult.second );
+
+                    ASSERT_TRUE( s.find( i.nKey, []( value_type const& v, int key )
+                        {
+                            EXPECT_EQ( v.key(), key );
+                            EXPECT_EQ( v.nUpdateNewCount, 2u );
+                        }));
+                    break;
+                case 5:
+                    updResult = s.update( i.key(), []( bool bNew, value_type& v, int arg )
+                        {
+                            EXPECT_TRUE( bNew );
+                            EXPECT_EQ( v.key(), arg );
+                            ++v.nUpdateNewCount;
+                        });
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_TRUE( updResult.second );
+
+                    updResult = s.update( i.key(), []( bool bNew, value_type& v, int arg )
+                        {
+                            EXPECT_FALSE( bNew );
+                            EXPECT_EQ( v.key(), arg );
+                            ++v.nUpdateNewCount;
+                        }, false );
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_FALSE( updResult.second );
+
+                    ASSERT_TRUE( s.find( i, []( value_type const& v, value_type const& arg )
+                        {
+                            EXPECT_EQ( v.key(), arg.key());
+                            EXPECT_EQ( v.nUpdateNewCount, 2u );
+                        }));
+                    break;
+                case 6:
+                    ASSERT_TRUE( s.emplace( i.key()));
+                    ASSERT_TRUE( s.find( i, []( value_type const& v, value_type const& arg )
+                        {
+                            EXPECT_EQ( v.key(), arg.key());
+                            EXPECT_EQ( v.nVal, arg.nVal );
+                        }));
+                    break;
+                case 7:
+                    str = "Hello!";
+                    ASSERT_TRUE( s.emplace( i.key(), std::move( str )));
+                    EXPECT_TRUE( str.empty());
+                    ASSERT_TRUE( s.find( i, []( value_type const& v, value_type const& arg )
+                        {
+                            EXPECT_EQ( v.key(), arg.key());
+                            EXPECT_EQ( v.nVal, arg.nVal );
+                            EXPECT_EQ( v.strVal, std::string( "Hello!" ));
+                        } ));
+                    break;
+                default:
+                    // forgot anything?..
+                    ASSERT_TRUE( false );
+                }
+
+                ASSERT_TRUE( s.contains( i.nKey ));
+                ASSERT_TRUE( s.contains( i ));
+                ASSERT_TRUE( s.find( i.nKey, []( value_type&, int ) {} ));
+                ASSERT_TRUE( s.find( i, []( value_type&, value_type const& ) {} ));
+            }
+
+            ASSERT_FALSE( s.empty());
+            ASSERT_CONTAINER_SIZE( s, nSetSize );
+
+            // erase
+            for ( auto idx : indices ) {
+                auto& i = data[idx];
+
+                ASSERT_TRUE( s.contains( i.nKey ));
+                ASSERT_TRUE( s.contains( i ));
+                ASSERT_TRUE( s.find( i.nKey, []( value_type& v, int )
+                    {
+                        v.nFindCount = 1;
+                    }));
+                ASSERT_TRUE( s.find( i, []( value_type& v, value_type const& )
+                    {
+                        EXPECT_EQ( ++v.nFindCount, 2u );
+                    }));
+
+                int nKey = i.key() - 1;
+                switch ( idx % 4 ) {
+                case 0:
+                    ASSERT_TRUE( s.erase( i.key()));
+                    ASSERT_FALSE( s.erase( i.key()));
+                    break;
+                case 1:
+                    ASSERT_TRUE( s.erase( i ));
+                    ASSERT_FALSE( s.erase( i ));
+                    break;
+                case 2:
+                    ASSERT_TRUE( s.erase( i.key(), [&nKey]( value_type const& v )
+                        {
+                            nKey = v.key();
+                        } ));
+                    EXPECT_EQ( i.key(), nKey );
+
+                    nKey = i.key() - 1;
+                    ASSERT_FALSE( s.erase( i.key(), [&nKey]( value_type const& v )
+                        {
+                            nKey = v.key();
+                        } ));
+                    EXPECT_EQ( i.key(), nKey + 1 );
+                    break;
+                case 3:
+                    ASSERT_TRUE( s.erase( i, [&nKey]( value_type const& v )
+                        {
+                            nKey = v.key();
+                        } ));
+                    EXPECT_EQ( i.key(), nKey );
+
+                    nKey = i.key() - 1;
+                    ASSERT_FALSE( s.erase( i, [&nKey]( value_type const& v )
+                        {
+                            nKey = v.key();
+                        } ));
+                    EXPECT_EQ( i.key(), nKey + 1 );
+                    break;
+                }
+
+                ASSERT_FALSE( s.contains( i.nKey ));
+                ASSERT_FALSE( s.contains( i ));
+                ASSERT_FALSE( s.find( i.nKey, []( value_type&, int ) {} ));
+                ASSERT_FALSE( s.find( i, []( value_type&, value_type const& ) {} ));
+            }
+            ASSERT_TRUE( s.empty());
+            ASSERT_CONTAINER_SIZE( s, 0u );
+
+            // clear
+            for ( auto& i : data ) {
+                ASSERT_TRUE( s.insert( i ));
+            }
+
+            ASSERT_FALSE( s.empty());
+            ASSERT_CONTAINER_SIZE( s, nSetSize );
+
+            s.clear();
+
+            ASSERT_TRUE( s.empty());
+            ASSERT_CONTAINER_SIZE( s, 0u );
+        }
+
+        template <typename Set>
+        void test_grow( Set& s )
+        {
+            // Precondition: set is empty, the initial bucket table is small
+            // Postcondition: set is empty
+
+            ASSERT_TRUE( s.empty());
+            typedef typename Set::value_type value_type;
+            size_t const nSetSize = kSize * 8;
+            size_t const nInitialBucketCount = s.bucket_count();
+
+            std::vector< int > keys;
+            for ( size_t key = 0; key < nSetSize; ++key )
+                keys.push_back( static_cast<int>( key ));
+            shuffle( keys.begin(), keys.end());
+
+            for ( size_t n = 0; n < nSetSize; ++n ) {
+                ASSERT_TRUE( s.insert( keys[n] ));
+
+                // Each item inserted before is reachable while the buckets are being migrated
+                ASSERT_TRUE( s.find( keys[n / 2], []( value_type& v, int key )
+                    {
+                        EXPECT_EQ( v.key(), key );
+                        EXPECT_EQ( v.nVal, key * 2 );
+                    }));
+            }
+            ASSERT_CONTAINER_SIZE( s, nSetSize );
+            EXPECT_GT( s.bucket_count(), nInitialBucketCount );
+            EXPECT_LE( s.size(), s.bucket_count() * s.load_factor());
+
+            size_t const nBucketCount = s.bucket_count();
+            shuffle( keys.begin(), keys.end());
+            for ( size_t n = 0; n < nSetSize; ++n ) {
+                std::pair<bool, bool> updResult = s.update( keys[n], []( bool bNew, value_type& v, int )
+                    {
+                        EXPECT_FALSE( bNew );
+                        ++v.nUpdateCount;
+                    }, false );
+                EXPECT_TRUE( updResult.first );
+                EXPECT_FALSE( updResult.second );
+
+                if ( n % 2 )
+                    ASSERT_TRUE( s.erase( keys[n] ));
+            }
+            ASSERT_CONTAINER_SIZE( s, nSetSize / 2 );
+            for ( size_t n = 0; n < nSetSize; ++n )
+                EXPECT_EQ( s.contains( keys[n] ), n % 2 == 0 );
+
+            // The bucket table never shrinks
+            EXPECT_EQ( s.bucket_count(), nBucketCount );
+
+            s.clear();
+            ASSERT_TRUE( s.empty());
+            ASSERT_CONTAINER_SIZE( s, 0u );
+            for ( int key : keys )
+                EXPECT_FALSE( s.contains( key ));
+        }
+    };
+
+} // namespace cds_test
+
+#endif // CDSUNIT_SET_TEST_FREEZABLE_HASH_SET_H
@@ -217,10 +217,31 @@ TYPED_TEST_P( MichaelSet, wrapped_stat )
     EXPECT_GE( s.statistics().m_nInsertSuccess, 0u );
 }
 
+TYPED_TEST_P( MichaelSet, with_hash )
+{
+    typedef typename TestFixture::rcu_type rcu_type;
+    typedef typename TestFixture::int_item int_item;
+
+    typedef cc::MichaelList< rcu_type, int_item,
+        typename cc::michael_list::make_traits<
+            cds::opt::compare< typename TestFixture::cmp >
+        >::type
+    > list_type;
+
+    typedef cc::MichaelHashSet< rcu_type, list_type,
+        typename cc::michael_set::make_traits<
+            cds::opt::hash< typename TestFixture::hash_int >
+        >::type
+    > set_type;
+
+    set_type s( TestFixture::kSize, 2 );
+    this->test_with_hash( s );
+}
+
 // GCC 5: All test names should be written on single line, otherwise a runtime error will be encountered like as
 // "No test named <test_name> can be found in this test case"
 REGISTER_TYPED_TEST_CASE_P( MichaelSet,
-    compare, less, cmpmix, item_counting, backoff, seq_cst, stat, wrapped_stat
+    compare, less, cmpmix, item_counting, backoff, seq_cst, stat, wrapped_stat, with_hash
 );
 
 
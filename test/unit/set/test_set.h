@@ -290,6 +290,104 @@ namespace cds_test {
             ASSERT_TRUE( s.begin() == s.end());
             ASSERT_TRUE( s.cbegin() == s.cend());
         }
+
+        template <typename Set>
+        void test_with_hash( Set& s )
+        {
+            // Precondition: set is empty
+            // Postcondition: set is empty
+
+            ASSERT_TRUE( s.empty());
+            ASSERT_CONTAINER_SIZE( s, 0 );
+
+            typedef typename Set::value_type value_type;
+            hash_int h;
+
+            size_t const nSetSize = kSize;
+            std::vector<int> keys;
+            keys.reserve( nSetSize );
+            for ( size_t key = 0; key < nSetSize; ++key )
+                keys.push_back( static_cast<int>( key ));
+            shuffle( keys.begin(), keys.end());
+
+            // insert/update/find with precomputed hash
+            for ( int key : keys ) {
+                size_t const nHash = h( key );
+
+                ASSERT_FALSE( s.contains_with_hash( key, nHash ));
+                ASSERT_FALSE( s.find_with_hash( key, nHash, []( value_type&, int ) {} ));
+
+                std::pair<bool, bool> updResult;
+                switch ( key % 3 ) {
+                case 0:
+                    ASSERT_TRUE( s.insert_with_hash( key, nHash ));
+                    ASSERT_FALSE( s.insert_with_hash( value_type( key ), nHash ));
+                    break;
+                case 1:
+                    ASSERT_TRUE( s.insert_with_hash( key, nHash, []( value_type& v ) { ++v.nFindCount; } ));
+                    ASSERT_FALSE( s.insert_with_hash( key, nHash, []( value_type& v ) { ++v.nFindCount; } ));
+                    break;
+                case 2:
+                    updResult = s.update_with_hash( key, nHash, []( bool, value_type&, int )
+                        {
+                            ASSERT_TRUE( false );
+                        }, false );
+                    EXPECT_FALSE( updResult.first );
+                    EXPECT_FALSE( updResult.second );
+
+                    updResult = s.update_with_hash( key, nHash, []( bool bNew, value_type& v, int arg )
+                        {
+                            EXPECT_TRUE( bNew );
+                            EXPECT_EQ( v.key(), arg );
+                            ++v.nFindCount;
+                        });
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_TRUE( updResult.second );
+                    break;
+                }
+
+                updResult = s.update_with_hash( key, nHash, []( bool bNew, value_type& v, int arg )
+                    {
+                        EXPECT_FALSE( bNew );
+                        EXPECT_EQ( v.key(), arg );
+                        ++v.nUpdateCount;
+                    }, false );
+                EXPECT_TRUE( updResult.first );
+                EXPECT_FALSE( updResult.second );
+
+                ASSERT_TRUE( s.contains_with_hash( key, nHash ));
+                ASSERT_TRUE( s.find_with_hash( key, nHash, []( value_type& v, int arg )
+                    {
+                        EXPECT_EQ( v.key(), arg );
+                        EXPECT_EQ( v.nUpdateCount, 1u );
+                        EXPECT_EQ( v.nFindCount, arg % 3 == 0 ? 0u : 1u );
+                    }));
+            }
+            ASSERT_FALSE( s.empty());
+            ASSERT_CONTAINER_SIZE( s, nSetSize );
+
+            // erase with precomputed hash
+            shuffle( keys.begin(), keys.end());
+            for ( int key : keys ) {
+                size_t const nHash = h( key );
+
+                if ( key & 1 ) {
+                    ASSERT_TRUE( s.erase_with_hash( key, nHash ));
+                    ASSERT_FALSE( s.erase_with_hash( key, nHash ));
+                }
+                else {
+                    int nKey = -1;
+                    ASSERT_TRUE( s.erase_with_hash( key, nHash, [&nKey]( value_type const& v ) { nKey = v.key(); } ));
+                    EXPECT_EQ( nKey, key );
+                    nKey = -1;
+                    ASSERT_FALSE( s.erase_with_hash( key, nHash, [&nKey]( value_type const& v ) { nKey = v.key(); } ));
+                    EXPECT_EQ( nKey, -1 );
+                }
+                ASSERT_FALSE( s.contains_with_hash( key, nHash ));
+            }
+            ASSERT_TRUE( s.empty());
+            ASSERT_CONTAINER_SIZE( s, 0u );
+        }
     };
 
 } // namespace cds_test
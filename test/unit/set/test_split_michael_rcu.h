@@ -330,8 +330,30 @@ TYPED_TEST_P( SplitListMichaelSet, bit_reversal_muldiv )
 
 // GCC 5: All this->test names should be written on single line, otherwise a runtime error will be encountered like as
 // "No this->test named <test_name> can be found in this this->test case"
+TYPED_TEST_P( SplitListMichaelSet, with_hash )
+{
+    typedef typename TestFixture::rcu_type rcu_type;
+    typedef typename TestFixture::int_item int_item;
+    typedef typename TestFixture::hash_int hash_int;
+
+    typedef cc::SplitListSet< rcu_type, int_item,
+        typename cc::split_list::make_traits<
+            cc::split_list::ordered_list< cc::michael_list_tag >
+            , cds::opt::hash< hash_int >
+            , cc::split_list::ordered_list_traits<
+                typename cc::michael_list::make_traits<
+                    cds::opt::compare< typename TestFixture::cmp >
+                >::type
+            >
+        >::type
+    > set_type;
+
+    set_type s( TestFixture::kSize, 2 );
+    this->test_with_hash( s );
+}
+
 REGISTER_TYPED_TEST_CASE_P( SplitListMichaelSet,
-    compare, less, cmpmix, item_counting, stat, back_off, static_bucket_table, free_list, static_bucket_table_free_list, bit_reversal_swar, bit_reversal_lookup, bit_reversal_muldiv
+    compare, less, cmpmix, item_counting, stat, back_off, static_bucket_table, free_list, static_bucket_table_free_list, bit_reversal_swar, bit_reversal_lookup, bit_reversal_muldiv, with_hash
 );
 
 
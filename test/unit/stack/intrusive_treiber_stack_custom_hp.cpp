@@ -48,6 +48,7 @@ namespace {
         {
             Stack stack;
             base_class::test( stack );
+            base_class::test_chain( stack );
         }
 
         template <typename Stack>
@@ -55,6 +56,7 @@ namespace {
         {
             Stack stack( elimination_size );
             base_class::test( stack );
+            base_class::test_chain( stack );
         }
     };
 
@@ -37,6 +37,7 @@ namespace {
         {
             Stack stack;
             base_class::test( stack );
+            base_class::test_chain( stack );
         }
 
         template <typename Stack>
@@ -44,6 +45,7 @@ namespace {
         {
             Stack stack( elimination_size );
             base_class::test( stack );
+            base_class::test_chain( stack );
         }
     };
 
@@ -266,5 +268,43 @@ namespace {
         test_dyn<stack_type>( 2 );
     }
 
+    TEST_F( IntrusiveTreiberStack_HP, elimination_adaptive_base )
+    {
+        typedef cds::intrusive::TreiberStack< gc_type,
+            base_hook_item<gc_type>
+            , typename ci::treiber_stack::make_traits<
+                cds::opt::enable_elimination<true>
+                ,ci::treiber_stack::adaptive_elimination<true>
+                ,ci::opt::hook<
+                    ci::treiber_stack::base_hook< ci::opt::gc<gc_type> >
+                >
+                ,ci::opt::stat< ci::treiber_stack::stat<> >
+            >::type
+        > stack_type;
+
+        test<stack_type>();
+    }
+
+    TEST_F( IntrusiveTreiberStack_HP, elimination_adaptive_member_dynamic )
+    {
+        typedef cds::intrusive::TreiberStack< gc_type,
+            member_hook_item<gc_type>
+            , typename ci::treiber_stack::make_traits<
+                cds::opt::enable_elimination<true>
+                ,ci::treiber_stack::adaptive_elimination<true>
+                ,ci::opt::hook<
+                    ci::treiber_stack::member_hook<
+                        offsetof( member_hook_item<gc_type>, hMember),
+                        ci::opt::gc<gc_type>
+                    >
+                >
+                ,ci::opt::buffer< ci::opt::v::initialized_dynamic_buffer<void *> >
+                ,ci::opt::disposer< mock_disposer >
+            >::type
+        > stack_type;
+
+        test_dyn<stack_type>( 8 );
+    }
+
 } // namespace
 
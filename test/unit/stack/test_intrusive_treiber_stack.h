@@ -8,6 +8,7 @@
 
 #include <cds_test/ext_gtest.h>
 #include <cds/intrusive/details/single_link_struct.h>
+#include <vector>
 
 namespace cds_test {
 
@@ -102,6 +103,59 @@ namespace cds_test {
                 ASSERT_EQ( v3.nDisposeCount, 1 );
             }
         }
+
+        template <typename Stack>
+        void test_chain( Stack& stack )
+        {
+            typedef typename Stack::value_type  value_type;
+            static constexpr const int c_nSize = 10;
+
+            value_type arr[c_nSize];
+            for ( int i = 0; i < c_nSize; ++i )
+                arr[i].nVal = i;
+
+            ASSERT_TRUE( stack.empty());
+            ASSERT_FALSE( stack.push_chain( arr, arr ));
+            ASSERT_TRUE( stack.empty());
+
+            // the chain of references, the last item of the chain is the top
+            ASSERT_TRUE( stack.push_chain( arr, arr + c_nSize ));
+            ASSERT_TRUE( !stack.empty());
+
+            value_type * pv = stack.pop();
+            ASSERT_EQ( pv, &arr[c_nSize - 1] );
+            ASSERT_TRUE( stack.push( *pv ));
+
+            int nExpected = c_nSize - 1;
+            size_t nCount = stack.pop_all( [&nExpected]( value_type& item ) {
+                EXPECT_EQ( item.nVal, nExpected );
+                --nExpected;
+            });
+            ASSERT_EQ( nCount, static_cast<size_t>( c_nSize ));
+            ASSERT_EQ( nExpected, -1 );
+            ASSERT_TRUE( stack.empty());
+            ASSERT_EQ( stack.pop_all( []( value_type& ) {} ), 0u );
+
+            // the chain of pointers is spliced on nonempty stack
+            std::vector<value_type *> chain;
+            for ( int i = 0; i < c_nSize; ++i ) {
+                if ( i < c_nSize / 2 )
+                    ASSERT_TRUE( stack.push( arr[i] ));
+                else
+                    chain.push_back( &arr[i] );
+            }
+            ASSERT_TRUE( stack.push_chain( chain.begin(), chain.end()));
+
+            for ( int i = c_nSize - 1; i >= 0; --i ) {
+                pv = stack.pop();
+                ASSERT_EQ( pv, &arr[i] );
+            }
+            ASSERT_TRUE( stack.empty());
+            ASSERT_EQ( stack.pop(), nullptr );
+
+            for ( int i = 0; i < c_nSize; ++i )
+                ASSERT_EQ( arr[i].nDisposeCount, 0 );
+        }
     };
 
 } // namespace cds_test
@@ -7,6 +7,7 @@
 #define CDSUNIT_STACK_TREIBER_STACK_H
 
 #include <cds_test/ext_gtest.h>
+#include <vector>
 
 namespace cds_test {
 
@@ -56,6 +57,42 @@ namespace cds_test {
 
             Stack::gc::scan();
         }
+
+        template <class Stack>
+        void test_chain( Stack& stack )
+        {
+            typedef typename Stack::value_type value_type;
+
+            std::vector<value_type> arr;
+            for ( int i = 0; i < 10; ++i )
+                arr.push_back( i );
+
+            ASSERT_TRUE( stack.empty());
+            ASSERT_FALSE( stack.push_chain( arr.begin(), arr.begin()));
+            ASSERT_TRUE( stack.empty());
+
+            ASSERT_TRUE( stack.push( 100 ));
+            ASSERT_TRUE( stack.push_chain( arr.begin(), arr.end()));
+            ASSERT_TRUE( !stack.empty());
+
+            // the last item of the chain is the top
+            value_type v;
+            ASSERT_TRUE( stack.pop( v ));
+            ASSERT_EQ( v, 9 );
+
+            std::vector<value_type> res;
+            ASSERT_EQ( stack.pop_all( [&res]( value_type& src ) { res.push_back( src ); } ), 10u );
+            ASSERT_TRUE( stack.empty());
+            ASSERT_EQ( res.size(), 10u );
+            for ( int i = 0; i < 9; ++i )
+                EXPECT_EQ( res[i], 8 - i );
+            EXPECT_EQ( res.back(), 100 );
+
+            ASSERT_EQ( stack.pop_all( []( value_type& ) {} ), 0u );
+            ASSERT_TRUE( !stack.pop( v ));
+
+            Stack::gc::scan();
+        }
     };
 } // namespace cds_test
 
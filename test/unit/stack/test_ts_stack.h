@@ -0,0 +1,52 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CDSUNIT_STACK_TEST_TS_STACK_H
+#define CDSUNIT_STACK_TEST_TS_STACK_H
+
+#include "test_treiber_stack.h"
+#include <cds/threading/model.h>
+#include <thread>
+
+namespace cds_test {
+
+    class TSStack : public TreiberStack
+    {
+    protected:
+        static constexpr const size_t c_nThreadCount = 4;
+        static constexpr const int c_nItemCount = 100;
+
+        template <class Stack>
+        void test_buffers( Stack& stack )
+        {
+            typedef typename Stack::value_type value_type;
+
+            // The threads are run one after another, each thread pushes into its own buffer.
+            // The timestamps of the items of different threads are ordered
+            for ( size_t nThread = 0; nThread < c_nThreadCount; ++nThread ) {
+                std::thread thr( [&stack, nThread]() {
+                    cds::threading::Manager::attachThread();
+                    for ( int i = 0; i < c_nItemCount; ++i )
+                        stack.push( static_cast<value_type>( nThread * c_nItemCount + i ));
+                    cds::threading::Manager::detachThread();
+                });
+                thr.join();
+            }
+            ASSERT_FALSE( stack.empty());
+
+            value_type v;
+            for ( int i = static_cast<int>( c_nThreadCount ) * c_nItemCount - 1; i >= 0; --i ) {
+                ASSERT_TRUE( stack.pop( v ));
+                ASSERT_EQ( v, i );
+            }
+            ASSERT_TRUE( stack.empty());
+            ASSERT_FALSE( stack.pop( v ));
+
+            Stack::gc::scan();
+        }
+    };
+} // namespace cds_test
+
+#endif // CDSUNIT_STACK_TEST_TS_STACK_H
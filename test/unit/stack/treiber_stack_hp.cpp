@@ -37,6 +37,7 @@ namespace {
         {
             Stack stack;
             base_class::test( stack );
+            base_class::test_chain( stack );
         }
 
         template <typename Stack>
@@ -44,6 +45,7 @@ namespace {
         {
             Stack stack( elimination_size );
             base_class::test( stack );
+            base_class::test_chain( stack );
         }
     };
 
@@ -145,4 +147,30 @@ namespace {
         test_dyn<stack_type>( 2 );
     }
 
+    TEST_F( TreiberStack_HP, elimination_adaptive )
+    {
+        typedef cc::TreiberStack< gc_type, int
+            , typename cc::treiber_stack::make_traits<
+                cds::opt::enable_elimination<true>
+                , cc::treiber_stack::adaptive_elimination<true>
+                , cds::opt::stat< cc::treiber_stack::stat<> >
+            >::type
+        > stack_type;
+
+        test<stack_type>();
+    }
+
+    TEST_F( TreiberStack_HP, elimination_adaptive_dynamic )
+    {
+        typedef cc::TreiberStack< gc_type, int
+            , typename cc::treiber_stack::make_traits<
+                cds::opt::enable_elimination<true>
+                , cc::treiber_stack::adaptive_elimination<true>
+                , cds::opt::buffer< cds::opt::v::initialized_dynamic_buffer<void *> >
+            >::type
+        > stack_type;
+
+        test_dyn<stack_type>( 8 );
+    }
+
 } // namespace
@@ -0,0 +1,106 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_ts_stack.h"
+
+#include <cds/gc/hp.h>
+#include <cds/container/ts_stack.h>
+
+namespace {
+
+    namespace cc = cds::container;
+    typedef cds::gc::HP gc_type;
+
+    class TSStack_HP : public cds_test::TSStack
+    {
+    protected:
+        typedef cds_test::TSStack base_class;
+
+        void SetUp()
+        {
+            typedef cc::TSStack< gc_type, int > stack_type;
+
+            cds::gc::hp::GarbageCollector::Construct( stack_type::c_nHazardPtrCount, 1, 16 );
+            cds::threading::Manager::attachThread();
+        }
+
+        void TearDown()
+        {
+            cds::threading::Manager::detachThread();
+            cds::gc::hp::GarbageCollector::Destruct( true );
+        }
+
+        template <typename Stack>
+        void test()
+        {
+            Stack stack( c_nThreadCount );
+            base_class::test( stack );
+            base_class::test_buffers( stack );
+        }
+    };
+
+    TEST_F( TSStack_HP, defaulted )
+    {
+        typedef cc::TSStack< gc_type, int > stack_type;
+
+        stack_type stack;
+        base_class::test( stack );
+    }
+
+    TEST_F( TSStack_HP, atomic_counter )
+    {
+        typedef cc::TSStack< gc_type, int
+            , typename cc::ts::make_traits<
+                cc::ts::timestamp< cc::ts::atomic_counter >
+                , cds::opt::item_counter< cds::atomicity::item_counter >
+            >::type
+        > stack_type;
+
+        test<stack_type>();
+    }
+
+    TEST_F( TSStack_HP, hardware_counter )
+    {
+        typedef cc::TSStack< gc_type, int
+            , typename cc::ts::make_traits<
+                cc::ts::timestamp< cc::ts::hardware_counter >
+                , cds::opt::back_off< cds::backoff::pause >
+            >::type
+        > stack_type;
+
+        test<stack_type>();
+    }
+
+    TEST_F( TSStack_HP, hardware_interval )
+    {
+        struct traits: public cc::ts::traits
+        {
+            typedef cc::ts::hardware_interval< 16 > timestamp;
+            typedef cc::ts::stat<> stat;
+        };
+        typedef cc::TSStack< gc_type, int, traits > stack_type;
+
+        // the stack is instantiated here, otherwise the traits typedefs are reported as unused
+        stack_type stack( c_nThreadCount );
+        base_class::test( stack );
+        base_class::test_buffers( stack );
+    }
+
+    TEST_F( TSStack_HP, single_buffer )
+    {
+        typedef cc::TSStack< gc_type, int
+            , typename cc::ts::make_traits<
+                cds::opt::stat< cc::ts::stat<> >
+                , cds::opt::padding< 16 >
+            >::type
+        > stack_type;
+
+        // all threads share the buffer
+        stack_type stack( 1 );
+        base_class::test( stack );
+        base_class::test_buffers( stack );
+    }
+
+} // namespace
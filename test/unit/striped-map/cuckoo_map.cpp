@@ -488,5 +488,71 @@ namespace {
         test( m );
     }
 
+    TEST_F( CuckooMap, optimistic_list_unordered_storehash )
+    {
+        struct map_traits: public store_hash_traits
+        {
+            typedef cc::cuckoo::optimistic_striping<> mutex_policy;
+            typedef cds::opt::hash_tuple< hash1, hash2 > hash;
+            typedef base_class::equal_to equal_to;
+            typedef cc::cuckoo::list     probeset_type;
+            typedef cc::cuckoo::stat     stat;
+        };
+        typedef cc::CuckooMap< key_type, value_type, map_traits > map_type;
+
+        map_type m;
+        test( m );
+    }
+
+    TEST_F( CuckooMap, optimistic_vector_ordered_stat )
+    {
+        typedef cc::CuckooMap< key_type, value_type
+            , cc::cuckoo::make_traits<
+                cds::opt::hash< std::tuple< hash1, hash2 > >
+                ,cds::opt::mutex_policy< cc::cuckoo::optimistic_striping<>>
+                ,cds::opt::less< less >
+                ,cds::opt::compare< cmp >
+                ,cds::opt::stat< cc::cuckoo::stat >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::vector<8>>
+            >::type
+        > map_type;
+
+        map_type m( 32, 8, 4 );
+        test( m );
+    }
+
+
+    TEST_F( CuckooMap, incremental_list_unordered )
+    {
+        typedef cc::CuckooMap< key_type, value_type
+            , cc::cuckoo::make_traits<
+                cds::opt::hash< std::tuple< hash1, hash2 > >
+                ,cds::opt::equal_to< equal_to >
+                ,cds::opt::stat< cc::cuckoo::stat >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::list >
+                ,cc::cuckoo::incremental_resizing< 1 >
+            >::type
+        > map_type;
+
+        map_type m( 8, 4 );
+        test( m );
+    }
+
+    TEST_F( CuckooMap, incremental_optimistic_vector_ordered )
+    {
+        typedef cc::CuckooMap< key_type, value_type
+            , cc::cuckoo::make_traits<
+                cds::opt::hash< std::tuple< hash1, hash2 > >
+                ,cds::opt::mutex_policy< cc::cuckoo::optimistic_striping<>>
+                ,cds::opt::compare< cmp >
+                ,cds::opt::stat< cc::cuckoo::stat >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::vector<8>>
+                ,cc::cuckoo::incremental_resizing< 4 >
+            >::type
+        > map_type;
+
+        map_type m( 8, 8, 4 );
+        test( m );
+    }
 
 } // namespace
@@ -0,0 +1,130 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_map.h"
+
+#include <cds/container/hopscotch_map.h>
+
+namespace {
+    namespace cc = cds::container;
+
+    class HopscotchMap : public cds_test::container_map
+    {
+    protected:
+        typedef cds_test::container_map base_class;
+
+        template <typename Map>
+        void test( Map& m )
+        {
+            // Precondition: map is empty
+            // Postcondition: map is empty
+
+            base_class::test_< Map::c_isSorted>( m );
+        }
+
+        //void SetUp()
+        //{}
+
+        //void TearDown()
+        //{}
+    };
+
+    // Four keys share one hash value, so inserting has to displace the items
+    struct cluster_hash {
+        size_t operator()( int i ) const
+        {
+            // spread the groups of four keys over the table
+            uint64_t h = static_cast<uint64_t>( i / 4 ) * 0xff51afd7ed558ccdULL;
+            return static_cast<size_t>( h ^ ( h >> 29 ));
+        }
+
+        size_t operator()( std::string const& str ) const
+        {
+            return (*this)( std::stoi( str ));
+        }
+
+        template <typename T>
+        size_t operator()( T const& i ) const
+        {
+            return (*this)( i.nKey );
+        }
+    };
+
+    TEST_F( HopscotchMap, equal_to )
+    {
+        struct map_traits: public cc::hopscotch::traits
+        {
+            typedef hash1 hash;
+            typedef base_class::equal_to equal_to;
+        };
+        typedef cc::HopscotchMap< key_type, value_type, map_traits > map_type;
+
+        map_type m;
+        test( m );
+    }
+
+    TEST_F( HopscotchMap, compare )
+    {
+        typedef cc::HopscotchMap< key_type, value_type
+            , cc::hopscotch::make_traits<
+                cds::opt::hash< hash1 >
+                ,cds::opt::compare< cmp >
+            >::type
+        > map_type;
+
+        map_type m( 32, 4 );
+        test( m );
+    }
+
+    TEST_F( HopscotchMap, less )
+    {
+        typedef cc::HopscotchMap< key_type, value_type
+            , cc::hopscotch::make_traits<
+                cds::opt::hash< hash2 >
+                ,cds::opt::less< less >
+            >::type
+        > map_type;
+
+        map_type m( 100, 16 );
+        test( m );
+    }
+
+    TEST_F( HopscotchMap, stat )
+    {
+        typedef cc::HopscotchMap< key_type, value_type
+            , cc::hopscotch::make_traits<
+                cds::opt::hash< hash1 >
+                ,cds::opt::equal_to< equal_to >
+                ,cds::opt::item_counter< cds::atomicity::cache_friendly_item_counter >
+                ,cds::opt::stat< cc::hopscotch::stat<>>
+            >::type
+        > map_type;
+
+        map_type m( kSize );
+        test( m );
+        EXPECT_EQ( m.statistics().m_nResize.get(), 0u );
+    }
+
+    TEST_F( HopscotchMap, displacement )
+    {
+        typedef cc::HopscotchMap< key_type, value_type
+            , cc::hopscotch::make_traits<
+                cds::opt::hash< cluster_hash >
+                ,cds::opt::equal_to< equal_to >
+                ,cc::hopscotch::neighbourhood< 8 >
+                ,cds::opt::stat< cc::hopscotch::stat<>>
+            >::type
+        > map_type;
+
+        map_type m( 16, 4 );
+        EXPECT_EQ( m.bucket_count(), 32u );
+        test( m );
+
+        EXPECT_GT( m.bucket_count(), 32u );
+        EXPECT_GT( m.statistics().m_nResize.get(), 0u );
+        EXPECT_GT( m.statistics().m_nDisplacement.get(), 0u );
+    }
+
+} // namespace
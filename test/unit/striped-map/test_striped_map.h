@@ -434,6 +434,96 @@ namespace {
             ASSERT_TRUE( m.empty());
             ASSERT_CONTAINER_SIZE( m, 0 );
         }
+
+        template <class Map>
+        void test_with_hash( Map& m, size_t nSize )
+        {
+            // Precondition: map is empty
+            // Postcondition: map is empty
+
+            EXPECT_TRUE( m.empty());
+
+            typedef typename Map::value_type map_pair;
+            hash1 h;
+
+            std::vector<int> arrKeys;
+            for ( int i = 0; i < static_cast<int>( nSize ); ++i )
+                arrKeys.push_back( i );
+            shuffle( arrKeys.begin(), arrKeys.end());
+
+            // insert/update/find with precomputed hash
+            for ( int nKey : arrKeys ) {
+                key_type key( nKey );
+                size_t const nHash = h( nKey );
+
+                EXPECT_FALSE( m.contains_with_hash( key, nHash ));
+                EXPECT_FALSE( m.find_with_hash( nKey, nHash, []( map_pair& ) { EXPECT_TRUE( false ); } ));
+
+                std::pair<bool, bool> updResult;
+                switch ( nKey % 3 ) {
+                case 0:
+                    EXPECT_TRUE( m.insert_with_hash( key, nHash ));
+                    EXPECT_FALSE( m.insert_with_hash( key, nHash ));
+                    break;
+                case 1:
+                    EXPECT_TRUE( m.insert_with_hash( nKey, nHash, value_type( nKey * 10 )));
+                    EXPECT_FALSE( m.insert_with_hash( nKey, nHash, value_type( nKey * 100 )));
+                    break;
+                case 2:
+                    updResult = m.update_with_hash( nKey, nHash, []( bool, map_pair& ) { EXPECT_TRUE( false ); }, false );
+                    EXPECT_FALSE( updResult.first );
+                    EXPECT_FALSE( updResult.second );
+
+                    updResult = m.update_with_hash( key, nHash, []( bool bNew, map_pair& item )
+                        {
+                            EXPECT_TRUE( bNew );
+                            item.second.nVal = item.first.nKey * 10;
+                        });
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_TRUE( updResult.second );
+                    break;
+                }
+
+                updResult = m.update_with_hash( nKey, nHash, []( bool bNew, map_pair& item )
+                    {
+                        EXPECT_FALSE( bNew );
+                        item.second.strVal = "updated";
+                    }, false );
+                EXPECT_TRUE( updResult.first );
+                EXPECT_FALSE( updResult.second );
+
+                EXPECT_TRUE( m.contains_with_hash( nKey, nHash ));
+                EXPECT_TRUE( m.find_with_hash( key, nHash, []( map_pair& item )
+                    {
+                        EXPECT_EQ( item.second.nVal, item.first.nKey % 3 == 0 ? 0 : item.first.nKey * 10 );
+                        EXPECT_EQ( item.second.strVal, std::string( "updated" ));
+                    }));
+            }
+            EXPECT_FALSE( m.empty());
+            EXPECT_CONTAINER_SIZE( m, nSize );
+
+            // erase with precomputed hash
+            shuffle( arrKeys.begin(), arrKeys.end());
+            for ( int nKey : arrKeys ) {
+                size_t const nHash = h( nKey );
+
+                if ( nKey & 1 ) {
+                    EXPECT_TRUE( m.erase_with_hash( key_type( nKey ), nHash ));
+                    EXPECT_FALSE( m.erase_with_hash( key_type( nKey ), nHash ));
+                }
+                else {
+                    int nFound = -1;
+                    EXPECT_TRUE( m.erase_with_hash( nKey, nHash, [&nFound]( map_pair& item ) { nFound = item.first.nKey; } ));
+                    EXPECT_EQ( nFound, nKey );
+                    nFound = -1;
+                    EXPECT_FALSE( m.erase_with_hash( nKey, nHash, [&nFound]( map_pair& item ) { nFound = item.first.nKey; } ));
+                    EXPECT_EQ( nFound, -1 );
+                }
+                EXPECT_FALSE( m.contains_with_hash( nKey, nHash ));
+            }
+            EXPECT_TRUE( m.empty());
+            EXPECT_CONTAINER_SIZE( m, 0u );
+        }
     };
 
     template <typename Traits>
@@ -500,6 +590,63 @@ namespace {
         this->test( m );
     }
 
+    TYPED_TEST_P( StripedMap, rw_striping )
+    {
+        typedef cc::StripedMap<
+            typename TestFixture::container_type,
+            cds::opt::mutex_policy< cc::striped_set::rw_striping<>>,
+            cds::opt::hash< typename TestFixture::hash1 >,
+            cds::opt::less< typename TestFixture::less >,
+            cds::opt::compare< typename TestFixture::cmp >
+        > map_type;
+
+        map_type m;
+        this->test( m );
+    }
+
+    TYPED_TEST_P( StripedMap, rw_striping_resizing )
+    {
+        typedef cc::StripedMap<
+            typename TestFixture::container_type,
+            cds::opt::mutex_policy< cc::striped_set::rw_striping<>>,
+            cds::opt::hash< typename TestFixture::hash1 >,
+            cds::opt::compare< typename TestFixture::cmp >,
+            cds::opt::resizing_policy< cc::striped_set::load_factor_resizing<0>>
+        > map_type;
+
+        map_type m( 30, cc::striped_set::load_factor_resizing<0>( 8 ));
+        this->test( m );
+    }
+
+    TYPED_TEST_P( StripedMap, incremental_resizing )
+    {
+        typedef cc::StripedMap<
+            typename TestFixture::container_type,
+            cds::opt::hash< typename TestFixture::hash1 >,
+            cds::opt::less< typename TestFixture::less >,
+            cds::opt::resizing_policy< cc::striped_set::load_factor_resizing<0>>,
+            cc::striped_set::incremental_resizing< 1 >
+        > map_type;
+
+        map_type m( 30, cc::striped_set::load_factor_resizing<0>( 2 ));
+        this->test( m );
+    }
+
+    TYPED_TEST_P( StripedMap, rw_striping_incremental_resizing )
+    {
+        typedef cc::StripedMap<
+            typename TestFixture::container_type,
+            cds::opt::mutex_policy< cc::striped_set::rw_striping<>>,
+            cds::opt::hash< typename TestFixture::hash1 >,
+            cds::opt::compare< typename TestFixture::cmp >,
+            cds::opt::resizing_policy< cc::striped_set::single_bucket_size_threshold<0>>,
+            cc::striped_set::incremental_resizing< 4 >
+        > map_type;
+
+        map_type m( 30, cc::striped_set::single_bucket_size_threshold<0>( 4 ));
+        this->test( m );
+    }
+
     TYPED_TEST_P( StripedMap, load_factor_resizing )
     {
         typedef cc::StripedMap<
@@ -791,8 +938,22 @@ namespace {
         this->test( m );
     }
 
+    TYPED_TEST_P( StripedMap, with_hash )
+    {
+        typedef cc::StripedMap<
+            typename TestFixture::container_type,
+            cds::opt::hash< typename TestFixture::hash1 >,
+            cds::opt::less< typename TestFixture::less >,
+            cds::opt::resizing_policy< cc::striped_set::load_factor_resizing<0>>,
+            cc::striped_set::incremental_resizing< 1 >
+        > map_type;
+
+        map_type m( 30, cc::striped_set::load_factor_resizing<0>( 2 ));
+        this->test_with_hash( m, TestFixture::kSize );
+    }
+
     REGISTER_TYPED_TEST_CASE_P( StripedMap,
-        compare, less, cmpmix, spinlock, load_factor_resizing, load_factor_resizing_rt, single_bucket_resizing, single_bucket_resizing_rt, copy_policy_copy, copy_policy_move, copy_policy_swap, copy_policy_special
+        compare, less, cmpmix, spinlock, rw_striping, rw_striping_resizing, incremental_resizing, rw_striping_incremental_resizing, load_factor_resizing, load_factor_resizing_rt, single_bucket_resizing, single_bucket_resizing_rt, copy_policy_copy, copy_policy_move, copy_policy_swap, copy_policy_special, with_hash
     );
 
     REGISTER_TYPED_TEST_CASE_P( RefinableMap,
@@ -488,5 +488,71 @@ namespace {
         test( s );
     }
 
+    TEST_F( CuckooSet, optimistic_list_unordered_storehash )
+    {
+        struct set_traits: public store_hash_traits
+        {
+            typedef cc::cuckoo::optimistic_striping<> mutex_policy;
+            typedef cds::opt::hash_tuple< hash1, hash2 > hash;
+            typedef base_class::equal_to equal_to;
+            typedef cc::cuckoo::list     probeset_type;
+            typedef cc::cuckoo::stat     stat;
+        };
+        typedef cc::CuckooSet< int_item, set_traits > set_type;
+
+        set_type s;
+        test( s );
+    }
+
+    TEST_F( CuckooSet, optimistic_vector_ordered_stat )
+    {
+        typedef cc::CuckooSet< int_item
+            , cc::cuckoo::make_traits<
+                cds::opt::hash< std::tuple< hash1, hash2 > >
+                ,cds::opt::mutex_policy< cc::cuckoo::optimistic_striping<>>
+                ,cds::opt::less< less >
+                ,cds::opt::compare< cmp >
+                ,cds::opt::stat< cc::cuckoo::stat >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::vector<8>>
+            >::type
+        > set_type;
+
+        set_type s( 32, 8, 4 );
+        test( s );
+    }
+
+
+    TEST_F( CuckooSet, incremental_list_unordered )
+    {
+        typedef cc::CuckooSet< int_item
+            , cc::cuckoo::make_traits<
+                cds::opt::hash< std::tuple< hash1, hash2 > >
+                ,cds::opt::equal_to< equal_to >
+                ,cds::opt::stat< cc::cuckoo::stat >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::list >
+                ,cc::cuckoo::incremental_resizing< 1 >
+            >::type
+        > set_type;
+
+        set_type s( 8, 4 );
+        test( s );
+    }
+
+    TEST_F( CuckooSet, incremental_optimistic_vector_ordered )
+    {
+        typedef cc::CuckooSet< int_item
+            , cc::cuckoo::make_traits<
+                cds::opt::hash< std::tuple< hash1, hash2 > >
+                ,cds::opt::mutex_policy< cc::cuckoo::optimistic_striping<>>
+                ,cds::opt::compare< cmp >
+                ,cds::opt::stat< cc::cuckoo::stat >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::vector<8>>
+                ,cc::cuckoo::incremental_resizing< 4 >
+            >::type
+        > set_type;
+
+        set_type s( 8, 8, 4 );
+        test( s );
+    }
 
 } // namespace
@@ -0,0 +1,147 @@
+// Copyright (c) 2006-2018 Maxim Khizhinsky
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_set.h"
+
+#include <cds/container/hopscotch_set.h>
+#include <cds/sync/spinlock.h>
+
+namespace {
+    namespace cc = cds::container;
+
+    class HopscotchSet : public cds_test::container_set
+    {
+    protected:
+        typedef cds_test::container_set base_class;
+
+        template <typename Set>
+        void test( Set& s )
+        {
+            // Precondition: set is empty
+            // Postcondition: set is empty
+
+            base_class::test_< Set::c_isSorted>( s );
+        }
+
+        //void SetUp()
+        //{}
+
+        //void TearDown()
+        //{}
+    };
+
+    // Four keys share one hash value, so inserting has to displace the items
+    struct cluster_hash {
+        size_t operator()( int i ) const
+        {
+            // spread the groups of four keys over the table
+            uint64_t h = static_cast<uint64_t>( i / 4 ) * 0xff51afd7ed558ccdULL;
+            return static_cast<size_t>( h ^ ( h >> 29 ));
+        }
+        template <typename Item>
+        size_t operator()( const Item& i ) const
+        {
+            return (*this)( i.key());
+        }
+    };
+
+    TEST_F( HopscotchSet, equal_to )
+    {
+        struct set_traits: public cc::hopscotch::traits
+        {
+            typedef hash1 hash;
+            typedef base_class::equal_to equal_to;
+        };
+        typedef cc::HopscotchSet< int_item, set_traits > set_type;
+
+        set_type s;
+        test( s );
+    }
+
+    TEST_F( HopscotchSet, compare )
+    {
+        typedef cc::HopscotchSet< int_item
+            , cc::hopscotch::make_traits<
+                cds::opt::hash< hash1 >
+                ,cds::opt::compare< cmp >
+            >::type
+        > set_type;
+
+        set_type s( 32, 4 );
+        test( s );
+    }
+
+    TEST_F( HopscotchSet, less )
+    {
+        typedef cc::HopscotchSet< int_item
+            , cc::hopscotch::make_traits<
+                cds::opt::hash< hash2 >
+                ,cds::opt::less< less >
+                ,cds::opt::lock_type< cds::sync::spin >
+            >::type
+        > set_type;
+
+        set_type s( 100, 16 );
+        test( s );
+    }
+
+    TEST_F( HopscotchSet, stat )
+    {
+        typedef cc::HopscotchSet< int_item
+            , cc::hopscotch::make_traits<
+                cds::opt::hash< hash1 >
+                ,cds::opt::equal_to< equal_to >
+                ,cds::opt::item_counter< cds::atomicity::cache_friendly_item_counter >
+                ,cds::opt::stat< cc::hopscotch::stat<>>
+            >::type
+        > set_type;
+
+        set_type s( kSize );
+        test( s );
+        EXPECT_EQ( s.statistics().m_nResize.get(), 0u );
+        EXPECT_GT( s.statistics().m_nReclaimBatch.get(), 0u );
+    }
+
+    TEST_F( HopscotchSet, displacement )
+    {
+        typedef cc::HopscotchSet< int_item
+            , cc::hopscotch::make_traits<
+                cds::opt::hash< cluster_hash >
+                ,cds::opt::equal_to< equal_to >
+                ,cc::hopscotch::neighbourhood< 8 >
+                ,cds::opt::stat< cc::hopscotch::stat<>>
+            >::type
+        > set_type;
+
+        set_type s( 16, 4 );
+        EXPECT_EQ( s.bucket_count(), 32u );
+        EXPECT_EQ( s.lock_count(), 4u );
+        EXPECT_EQ( set_type::neighbourhood_size(), 8u );
+
+        test( s );
+
+        EXPECT_GT( s.bucket_count(), 32u );
+        EXPECT_GT( s.statistics().m_nResize.get(), 0u );
+        EXPECT_GT( s.statistics().m_nDisplacement.get(), 0u );
+        EXPECT_GE( s.statistics().m_nDisplacementMove.get(), s.statistics().m_nDisplacement.get());
+    }
+
+    TEST_F( HopscotchSet, neighbourhood64 )
+    {
+        struct set_traits: public cc::hopscotch::neighbourhood< 64 >::pack< cc::hopscotch::traits >
+        {
+            typedef cluster_hash hash;
+            typedef base_class::less less;
+            typedef cc::hopscotch::stat<> stat;
+        };
+        typedef cc::HopscotchSet< int_item, set_traits > set_type;
+
+        set_type s( 0, 1 );
+        EXPECT_EQ( s.bucket_count(), 64u );
+        test( s );
+        EXPECT_GT( s.statistics().m_nResize.get(), 0u );
+    }
+
+} // namespace
@@ -1378,4 +1378,148 @@ namespace {
         }
     }
 
+//************************************************************
+// optimistic striping
+
+    TEST_F( IntrusiveCuckooSet, optimistic_list_basehook_unordered )
+    {
+        typedef base_class::base_int_item< ci::cuckoo::node< ci::cuckoo::list, 0 > >  item_type;
+        struct set_traits: public ci::cuckoo::traits
+        {
+            typedef ci::cuckoo::optimistic_striping<> mutex_policy;
+            typedef cds::opt::hash_tuple< hash1, hash2 > hash;
+            typedef base_class::equal_to<item_type> equal_to;
+            typedef mock_disposer disposer;
+        };
+        typedef ci::CuckooSet< item_type, set_traits > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s;
+            test( s, data );
+        }
+    }
+
+    TEST_F( IntrusiveCuckooSet, optimistic_vector_basehook_unordered_storehash )
+    {
+        typedef base_class::base_int_item< ci::cuckoo::node< ci::cuckoo::vector<4>, 2 >> item_type;
+        struct set_traits: public ci::cuckoo::traits
+        {
+            typedef ci::cuckoo::base_hook<
+                ci::cuckoo::probeset_type< item_type::probeset_type >
+                ,ci::cuckoo::store_hash< item_type::hash_array_size >
+            > hook;
+            typedef ci::cuckoo::optimistic_striping<> mutex_policy;
+            typedef cds::opt::hash_tuple< hash1, hash2 > hash;
+            typedef base_class::equal_to<item_type> equal_to;
+            typedef mock_disposer disposer;
+            typedef ci::cuckoo::stat stat;
+        };
+        typedef ci::CuckooSet< item_type, set_traits > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s( 32, 4 );
+            test( s, data );
+        }
+    }
+
+    TEST_F( IntrusiveCuckooSet, optimistic_list_memberhook_ordered_stat )
+    {
+        typedef base_class::member_int_item< ci::cuckoo::node< ci::cuckoo::list, 0 >> item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::member_hook< offsetof( item_type, hMember ),
+                    ci::cuckoo::probeset_type< item_type::member_type::probeset_type >
+                > >
+                ,ci::opt::mutex_policy<ci::cuckoo::optimistic_striping<>>
+                ,cds::opt::hash< std::tuple< hash1, hash2 > >
+                ,cds::opt::less< less<item_type> >
+                ,cds::opt::compare< cmp<item_type> >
+                ,ci::opt::stat< ci::cuckoo::stat >
+                ,ci::opt::disposer< mock_disposer >
+            >::type
+        > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s( 32, 6, 4 );
+            test( s, data );
+        }
+    }
+
+    TEST_F( IntrusiveCuckooSet, optimistic_vector_memberhook_ordered_storehash )
+    {
+        typedef base_class::member_int_item< ci::cuckoo::node< ci::cuckoo::vector<6>, 2 >> item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::member_hook< offsetof( item_type, hMember ),
+                    ci::cuckoo::probeset_type< item_type::member_type::probeset_type >
+                    ,ci::cuckoo::store_hash< item_type::member_type::hash_array_size >
+                > >
+                ,ci::opt::mutex_policy<ci::cuckoo::optimistic_striping<>>
+                ,cds::opt::hash< std::tuple< hash1, hash2 > >
+                ,cds::opt::compare< cmp<item_type> >
+                ,ci::opt::disposer< mock_disposer >
+            >::type
+        > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s( 32, 6, 4 );
+            test( s, data );
+        }
+    }
+
+    TEST_F( IntrusiveCuckooSet, incremental_list_basehook_unordered )
+    {
+        typedef base_class::base_int_item< ci::cuckoo::node< ci::cuckoo::list, 0 >> item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,cds::opt::hash< std::tuple< hash1, hash2 > >
+                ,cds::opt::equal_to< equal_to<item_type> >
+                ,ci::opt::stat< ci::cuckoo::stat >
+                ,ci::opt::disposer< mock_disposer >
+                ,ci::cuckoo::incremental_resizing< 1 >
+            >::type
+        > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s( 8, 4 );
+            test( s, data );
+        }
+    }
+
+    TEST_F( IntrusiveCuckooSet, incremental_optimistic_vector_memberhook_ordered_storehash )
+    {
+        typedef base_class::member_int_item< ci::cuckoo::node< ci::cuckoo::vector<6>, 2 >> item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::member_hook< offsetof( item_type, hMember ),
+                    ci::cuckoo::probeset_type< item_type::member_type::probeset_type >
+                    ,ci::cuckoo::store_hash< item_type::member_type::hash_array_size >
+                > >
+                ,ci::opt::mutex_policy<ci::cuckoo::optimistic_striping<>>
+                ,cds::opt::hash< std::tuple< hash1, hash2 > >
+                ,cds::opt::compare< cmp<item_type> >
+                ,ci::opt::disposer< mock_disposer >
+                ,ci::cuckoo::incremental_resizing< 4 >
+            >::type
+        > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s( 8, 6, 4 );
+            test( s, data );
+        }
+    }
+
 } // namespace
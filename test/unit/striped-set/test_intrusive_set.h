@@ -477,6 +477,98 @@ namespace cds_test {
             }
 
         }
+
+        template <class Set>
+        void test_with_hash( Set& s, std::vector< typename Set::value_type >& data )
+        {
+            // Precondition: set is empty
+            // Postcondition: set is empty
+
+            ASSERT_TRUE( s.empty());
+            ASSERT_CONTAINER_SIZE( s, 0 );
+
+            typedef typename Set::value_type value_type;
+            hash1 h;
+            size_t const nSetSize = kSize;
+
+            std::vector< size_t> indices;
+            data.reserve( nSetSize );
+            indices.reserve( nSetSize );
+            for ( size_t key = 0; key < nSetSize; ++key ) {
+                data.push_back( value_type( static_cast<int>( key )));
+                indices.push_back( key );
+            }
+            shuffle( indices.begin(), indices.end());
+
+            // insert/update/find with precomputed hash
+            for ( auto idx : indices ) {
+                auto& i = data[ idx ];
+                size_t const nHash = h( i.key());
+
+                ASSERT_FALSE( s.contains_with_hash( i.nKey, nHash ));
+                ASSERT_FALSE( s.find_with_hash( i.nKey, nHash, []( value_type&, int ) {} ));
+
+                std::pair<bool, bool> updResult;
+                switch ( i.key() % 3 ) {
+                case 0:
+                    ASSERT_TRUE( s.insert_with_hash( i, nHash ));
+                    ASSERT_FALSE( s.insert_with_hash( i, nHash ));
+                    break;
+                case 1:
+                    ASSERT_TRUE( s.insert_with_hash( i, nHash, []( value_type& v ) { ++v.nUpdateNewCount; } ));
+                    EXPECT_EQ( i.nUpdateNewCount, 1u );
+                    ASSERT_FALSE( s.insert_with_hash( i, nHash, []( value_type& v ) { ++v.nUpdateNewCount; } ));
+                    EXPECT_EQ( i.nUpdateNewCount, 1u );
+                    break;
+                case 2:
+                    updResult = s.update_with_hash( i, nHash, []( bool bNew, value_type& val, value_type& arg )
+                        {
+                            EXPECT_TRUE( bNew );
+                            EXPECT_EQ( &val, &arg );
+                        });
+                    EXPECT_TRUE( updResult.first );
+                    EXPECT_TRUE( updResult.second );
+                    break;
+                }
+
+                updResult = s.update_with_hash( i, nHash, []( bool bNew, value_type& val, value_type& arg )
+                    {
+                        EXPECT_FALSE( bNew );
+                        EXPECT_EQ( &val, &arg );
+                        ++val.nUpdateCount;
+                    }, false );
+                EXPECT_TRUE( updResult.first );
+                EXPECT_FALSE( updResult.second );
+                EXPECT_EQ( i.nUpdateCount, 1u );
+
+                ASSERT_TRUE( s.contains_with_hash( i.nKey, nHash ));
+                ASSERT_TRUE( s.find_with_hash( i.nKey, nHash, []( value_type& v, int ) { ++v.nFindCount; } ));
+                EXPECT_EQ( i.nFindCount, 1u );
+            }
+            ASSERT_FALSE( s.empty());
+            ASSERT_CONTAINER_SIZE( s, nSetSize );
+
+            // erase with precomputed hash
+            shuffle( indices.begin(), indices.end());
+            for ( auto idx : indices ) {
+                auto& i = data[ idx ];
+                size_t const nHash = h( i.key());
+
+                if ( i.key() & 1 ) {
+                    ASSERT_TRUE( s.erase_with_hash( i.nKey, nHash ) == &i );
+                    ASSERT_TRUE( s.erase_with_hash( i.nKey, nHash ) == nullptr );
+                }
+                else {
+                    ASSERT_TRUE( s.erase_with_hash( i.nKey, nHash, []( value_type& val ) { ++val.nEraseCount; } ) == &i );
+                    EXPECT_EQ( i.nEraseCount, 1u );
+                    ASSERT_TRUE( s.erase_with_hash( i.nKey, nHash, []( value_type& val ) { ++val.nEraseCount; } ) == nullptr );
+                    EXPECT_EQ( i.nEraseCount, 1u );
+                }
+                ASSERT_FALSE( s.contains_with_hash( i.nKey, nHash ));
+            }
+            ASSERT_TRUE( s.empty());
+            ASSERT_CONTAINER_SIZE( s, 0u );
+        }
     };
 
 } // namespace cds_test
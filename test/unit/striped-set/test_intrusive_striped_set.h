@@ -202,6 +202,78 @@ namespace {
         }
     }
 
+    TYPED_TEST_P( IntrusiveStripedSet, rw_striping_basehook )
+    {
+        typedef ci::StripedSet<
+            typename TestFixture::base_hook_container,
+            ci::opt::mutex_policy< ci::striped_set::rw_striping<>>,
+            ci::opt::hash< typename TestFixture::hash1 >,
+            ci::opt::less< typename TestFixture::template less< typename TestFixture::base_item >>,
+            ci::opt::compare< typename TestFixture::template cmp< typename TestFixture::base_item >>,
+            ci::opt::resizing_policy< ci::striped_set::load_factor_resizing< 8 >>
+        > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s( 64 );
+            this->test( s, data );
+        }
+    }
+
+    TYPED_TEST_P( IntrusiveStripedSet, rw_striping_memberhook )
+    {
+        typedef ci::StripedSet<
+            typename TestFixture::member_hook_container,
+            ci::opt::mutex_policy< ci::striped_set::rw_striping<>>,
+            ci::opt::hash< typename TestFixture::hash2 >,
+            ci::opt::less< typename TestFixture::template less< typename TestFixture::member_item >>,
+            ci::opt::compare< typename TestFixture::template cmp< typename TestFixture::member_item >>,
+            ci::opt::resizing_policy< ci::striped_set::single_bucket_size_threshold<0>>
+        > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s( 64, ci::striped_set::single_bucket_size_threshold<0>( 4 ));
+            this->test( s, data );
+        }
+    }
+
+    TYPED_TEST_P( IntrusiveStripedSet, incremental_resizing_basehook )
+    {
+        typedef ci::StripedSet<
+            typename TestFixture::base_hook_container,
+            ci::opt::hash< typename TestFixture::hash1 >,
+            ci::opt::less< typename TestFixture::template less< typename TestFixture::base_item >>,
+            ci::opt::compare< typename TestFixture::template cmp< typename TestFixture::base_item >>,
+            ci::opt::resizing_policy< ci::striped_set::load_factor_resizing< 2 >>,
+            ci::striped_set::incremental_resizing< 1 >
+        > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s( 32 );
+            this->test( s, data );
+        }
+    }
+
+    TYPED_TEST_P( IntrusiveStripedSet, incremental_resizing_memberhook )
+    {
+        typedef ci::StripedSet<
+            typename TestFixture::member_hook_container,
+            ci::opt::mutex_policy< ci::striped_set::rw_striping<>>,
+            ci::opt::hash< typename TestFixture::hash2 >,
+            ci::opt::less< typename TestFixture::template less< typename TestFixture::member_item >>,
+            ci::opt::compare< typename TestFixture::template cmp< typename TestFixture::member_item >>,
+            ci::opt::resizing_policy< ci::striped_set::single_bucket_size_threshold<0>>,
+            ci::striped_set::incremental_resizing< 4 >
+        > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s( 32, ci::striped_set::single_bucket_size_threshold<0>( 4 ));
+            this->test( s, data );
+        }
+    }
 
 // ****************************************************************
 // refinable base hook
@@ -371,8 +443,26 @@ namespace {
         }
     }
 
+    TYPED_TEST_P( IntrusiveStripedSet, with_hash )
+    {
+        typedef ci::StripedSet<
+            typename TestFixture::base_hook_container,
+            ci::opt::hash< typename TestFixture::hash1 >,
+            ci::opt::less< typename TestFixture::template less< typename TestFixture::base_item >>,
+            ci::opt::compare< typename TestFixture::template cmp< typename TestFixture::base_item >>,
+            ci::opt::resizing_policy< ci::striped_set::load_factor_resizing< 2 >>,
+            ci::striped_set::incremental_resizing< 1 >
+        > set_type;
+
+        std::vector< typename set_type::value_type > data;
+        {
+            set_type s( 32 );
+            this->test_with_hash( s, data );
+        }
+    }
+
     REGISTER_TYPED_TEST_CASE_P( IntrusiveStripedSet,
-        striped_basehook_compare, striped_basehook_less, striped_basehook_cmpmix, striped_basehook_resizing_threshold, striped_basehook_resizing_threshold_rt, striped_memberhook_compare, striped_memberhook_less, striped_memberhook_cmpmix, striped_memberhook_resizing_threshold, striped_memberhook_resizing_threshold_rt, refinable_basehook_compare, refinable_basehook_less, refinable_basehook_cmpmix, refinable_basehook_resizing_threshold, refinable_basehook_resizing_threshold_rt, refinable_memberhook_compare, refinable_memberhook_less, refinable_memberhook_cmpmix, refinable_memberhook_resizing_threshold, refinable_memberhook_resizing_threshold_rt
+        striped_basehook_compare, striped_basehook_less, striped_basehook_cmpmix, striped_basehook_resizing_threshold, striped_basehook_resizing_threshold_rt, striped_memberhook_compare, striped_memberhook_less, striped_memberhook_cmpmix, striped_memberhook_resizing_threshold, striped_memberhook_resizing_threshold_rt, rw_striping_basehook, rw_striping_memberhook, incremental_resizing_basehook, incremental_resizing_memberhook, refinable_basehook_compare, refinable_basehook_less, refinable_basehook_cmpmix, refinable_basehook_resizing_threshold, refinable_basehook_resizing_threshold_rt, refinable_memberhook_compare, refinable_memberhook_less, refinable_memberhook_cmpmix, refinable_memberhook_resizing_threshold, refinable_memberhook_resizing_threshold_rt, with_hash
         );
 
 } // namespace
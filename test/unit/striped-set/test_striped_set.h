@@ -439,6 +439,63 @@ namespace {
         this->test( s );
     }
 
+    TYPED_TEST_P( StripedSet, rw_striping )
+    {
+        typedef cc::StripedSet<
+            typename TestFixture::container_type,
+            cds::opt::mutex_policy< cc::striped_set::rw_striping<>>,
+            cds::opt::hash< typename TestFixture::hash1 >,
+            cds::opt::less< typename TestFixture::less >,
+            cds::opt::compare< typename TestFixture::cmp >
+        > set_type;
+
+        set_type s;
+        this->test( s );
+    }
+
+    TYPED_TEST_P( StripedSet, rw_striping_resizing )
+    {
+        typedef cc::StripedSet<
+            typename TestFixture::container_type,
+            cds::opt::mutex_policy< cc::striped_set::rw_striping<>>,
+            cds::opt::hash< typename TestFixture::hash1 >,
+            cds::opt::compare< typename TestFixture::cmp >,
+            cds::opt::resizing_policy< cc::striped_set::load_factor_resizing<0>>
+        > set_type;
+
+        set_type s( 30, cc::striped_set::load_factor_resizing<0>( 8 ));
+        this->test( s );
+    }
+
+    TYPED_TEST_P( StripedSet, incremental_resizing )
+    {
+        typedef cc::StripedSet<
+            typename TestFixture::container_type,
+            cds::opt::hash< typename TestFixture::hash1 >,
+            cds::opt::less< typename TestFixture::less >,
+            cds::opt::resizing_policy< cc::striped_set::load_factor_resizing<0>>,
+            cc::striped_set::incremental_resizing< 1 >
+        > set_type;
+
+        set_type s( 30, cc::striped_set::load_factor_resizing<0>( 2 ));
+        this->test( s );
+    }
+
+    TYPED_TEST_P( StripedSet, rw_striping_incremental_resizing )
+    {
+        typedef cc::StripedSet<
+            typename TestFixture::container_type,
+            cds::opt::mutex_policy< cc::striped_set::rw_striping<>>,
+            cds::opt::hash< typename TestFixture::hash1 >,
+            cds::opt::compare< typename TestFixture::cmp >,
+            cds::opt::resizing_policy< cc::striped_set::single_bucket_size_threshold<0>>,
+            cc::striped_set::incremental_resizing< 4 >
+        > set_type;
+
+        set_type s( 30, cc::striped_set::single_bucket_size_threshold<0>( 4 ));
+        this->test( s );
+    }
+
     TYPED_TEST_P( StripedSet, load_factor_resizing )
     {
         typedef cc::StripedSet<
@@ -730,8 +787,22 @@ namespace {
         this->test( s );
     }
 
+    TYPED_TEST_P( StripedSet, with_hash )
+    {
+        typedef cc::StripedSet<
+            typename TestFixture::container_type,
+            cds::opt::hash< typename TestFixture::hash1 >,
+            cds::opt::less< typename TestFixture::less >,
+            cds::opt::resizing_policy< cc::striped_set::load_factor_resizing<0>>,
+            cc::striped_set::incremental_resizing< 1 >
+        > set_type;
+
+        set_type s( 30, cc::striped_set::load_factor_resizing<0>( 2 ));
+        this->test_with_hash( s );
+    }
+
     REGISTER_TYPED_TEST_CASE_P( StripedSet,
-        compare, less, cmpmix, spinlock, load_factor_resizing, load_factor_resizing_rt, single_bucket_resizing, single_bucket_resizing_rt, copy_policy_copy, copy_policy_move, copy_policy_swap, copy_policy_special
+        compare, less, cmpmix, spinlock, rw_striping, rw_striping_resizing, incremental_resizing, rw_striping_incremental_resizing, load_factor_resizing, load_factor_resizing_rt, single_bucket_resizing, single_bucket_resizing_rt, copy_policy_copy, copy_policy_move, copy_policy_swap, copy_policy_special, with_hash
         );
 
     REGISTER_TYPED_TEST_CASE_P( RefinableSet,